@@ -0,0 +1,175 @@
+
+/**
+  ******************************************************************************
+  * @file    anomaly_detector.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Anomaly Detector component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup AnomalyDetector
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ANOMALY_DETECTOR_H
+#define ANOMALY_DETECTOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "arm_nnfunctions.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup AnomalyDetector
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Features of the model, in the order of #ANOM_Feature_t */
+#define ANOM_FEATURE_NBR            6U
+
+/* Fully connected layers of the autoencoder: encoder, code, decoder, output */
+#define ANOM_LAYER_NBR              4U
+
+/* Widest layer of a model */
+#define ANOM_MAX_WIDTH              16U
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Features of the model, averaged over the decimation of the medium frequency task.
+  */
+typedef enum
+{
+  ANOM_IQ = 0,                    /*!< Measured Iq, digit */
+  ANOM_ID,                        /*!< Measured Id, digit */
+  ANOM_VQ,                        /*!< Applied Vq, digit */
+  ANOM_SPEED_ERROR,               /*!< Speed reference minus measured speed, rpm */
+  ANOM_VBUS,                      /*!< Bus voltage, V */
+  ANOM_TEMPERATURE                /*!< Heatsink temperature, Celsius degree */
+} ANOM_Feature_t;
+
+/**
+  * @brief  Fully connected q7 layer, in the format of arm_fully_connected_q7.
+  */
+typedef struct
+{
+  const q7_t *pWeights;           /*!< hOutputs rows of hInputs weights */
+  const q7_t *pBias;
+  uint16_t hInputs;
+  uint16_t hOutputs;
+  uint16_t hBiasShift;            /*!< Left shift of the bias to the accumulator format */
+  uint16_t hOutShift;             /*!< Right shift of the accumulator to the output format */
+  bool bRelu;                     /*!< Output rectified */
+} ANOM_Layer_t;
+
+/**
+  * @brief  Autoencoder of the features, generated by the host training script.
+  */
+typedef struct
+{
+  float_t fOffset[ANOM_FEATURE_NBR]; /*!< Feature of the q7 input 0, feature unit */
+  float_t fScale[ANOM_FEATURE_NBR];  /*!< q7 input per feature unit */
+  ANOM_Layer_t Layers[ANOM_LAYER_NBR];
+  uint16_t hThreshold;            /*!< Score above which the features are anomalous, from the training set */
+} ANOM_Model_t;
+
+/**
+  * @brief  Handle of the Anomaly Detector component
+  */
+typedef struct
+{
+  const ANOM_Model_t *pModel;
+  uint16_t hDecimation;           /*!< Medium frequency task periods averaged per inference */
+  uint16_t hPersistence;          /*!< Consecutive inferences above or below the threshold changing the flag */
+  uint8_t bScoreShift;            /*!< Low pass of the score, 2^-bScoreShift per inference */
+  bool bRunning;                  /*!< Drive running at the previous medium frequency task */
+  volatile bool bRestart;         /*!< Drive started, the background task resets the score */
+  volatile bool bReady;           /*!< Features averaged, the background task infers */
+  uint16_t hCount;
+  float_t fSum[ANOM_FEATURE_NBR];
+  float_t fFeatures[ANOM_FEATURE_NBR]; /*!< Features of the next inference */
+  q7_t bActivations[2U * ANOM_MAX_WIDTH]; /*!< Outputs of the layers, in turn, word aligned for the kernels */
+  q15_t hVecBuffer[ANOM_MAX_WIDTH]; /*!< Scratch of arm_fully_connected_q7 */
+  uint16_t hRawScore;             /*!< Reconstruction error of the last inference, q7 squared */
+  uint32_t wScoreAcc;             /*!< Score times 2^bScoreShift */
+  uint16_t hScore;                /*!< Reconstruction error low passed, q7 squared */
+  uint16_t hCrossings;            /*!< Consecutive inferences on the other side of the threshold */
+  bool bAnomaly;
+  uint16_t hInferences;
+  uint32_t wCycles;               /*!< Duration of the last inference, core clock cycles, preemptions included */
+} ANOM_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Anomaly Detector component */
+void ANOM_Init(ANOM_Handle_t *pHandle);
+
+/* Averages the features, to be called by the medium frequency task */
+void ANOM_Accumulate(ANOM_Handle_t *pHandle, const float_t *pFeatures, bool bRunning);
+
+/* Infers on the features averaged, to be called in the idle time */
+void ANOM_BackgroundTask(ANOM_Handle_t *pHandle);
+
+/* Returns the reconstruction error of the model on a set of features */
+uint16_t ANOM_Infer(const ANOM_Model_t *pModel, const float_t *pFeatures, q7_t *pActivations, q15_t *pVecBuffer);
+
+/**
+  * @brief  Returns the anomaly score, the reconstruction error low passed, q7 squared.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  */
+static inline uint16_t ANOM_GetScore(const ANOM_Handle_t *pHandle)
+{
+  return (pHandle->hScore);
+}
+
+/**
+  * @brief  Returns true when the score stayed above the threshold of the model.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  */
+static inline bool ANOM_IsAnomaly(const ANOM_Handle_t *pHandle)
+{
+  return (pHandle->bAnomaly);
+}
+
+/**
+  * @brief  Returns the duration of the last inference, core clock cycles.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  */
+static inline uint32_t ANOM_GetCycles(const ANOM_Handle_t *pHandle)
+{
+  return (pHandle->wCycles);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* ANOMALY_DETECTOR_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -147,6 +147,7 @@ uint8_t ASPEP_sendPacket(MCTL_Handle_t *pHandle, void *txBuffer, uint16_t txData
 uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pHandle, uint16_t *packetLength);
 /*   */
 void ASPEP_HWDataReceivedIT(ASPEP_Handle_t *pHandle);
+bool ASPEP_IsPacketPending(const ASPEP_Handle_t *pHandle);
 void ASPEP_HWDataTransmittedIT(ASPEP_Handle_t *pHandle);
 /* Debugger stuff */
 void ASPEP_HWReset(ASPEP_Handle_t *pHandle);
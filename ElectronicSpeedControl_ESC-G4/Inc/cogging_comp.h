@@ -0,0 +1,172 @@
+
+/**
+  ******************************************************************************
+  * @file    cogging_comp.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Cogging Compensation component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup CoggingComp
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef COGGING_COMP_H
+#define COGGING_COMP_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "speed_torq_ctrl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup CoggingComp
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Entries of the table over one revolution of the index angle */
+#define COG_TABLE_BITS              7U
+#define COG_TABLE_SIZE              (1U << COG_TABLE_BITS)
+
+/* Bits of the index angle interpolated between two entries */
+#define COG_FRACTION_BITS           (16U - COG_TABLE_BITS)
+#define COG_FRACTION_MASK           ((1U << COG_FRACTION_BITS) - 1U)
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Modes of the Cogging Compensation component.
+  */
+typedef enum
+{
+  COG_OFF = 0,                    /*!< No Iq added, the table is kept */
+  COG_COMPENSATE,                 /*!< The table is added to the Iq reference */
+  COG_LEARN                       /*!< The table is added and refined from the speed ripple */
+} COG_Mode_t;
+
+/**
+  * @brief  Handle of the Cogging Compensation component
+  */
+typedef struct
+{
+  SpeednTorqCtrl_Handle_t *pSTC;  /*!< Speed and ramp of the drive */
+  uint16_t hSpeedRatio;           /*!< Electrical revolutions per revolution of the index angle */
+  int16_t hIqMax;                 /*!< Largest magnitude of the entries, digit */
+  int16_t hCompMaxSpeed;          /*!< Speed above which nothing is added, #SPEED_UNIT */
+  int16_t hLearnMinSpeed;         /*!< Speed range of the learning, #SPEED_UNIT */
+  int16_t hLearnMaxSpeed;
+  uint16_t hLearnRevolutions;     /*!< Revolutions of the index angle averaged by a learning iteration */
+  float_t fAccelPerDigit;         /*!< Electrical acceleration of one Iq digit, s16 per current control period squared */
+  float_t fLearnGain;             /*!< Share of the residual removed by an iteration, in range ]0, 1] */
+  float_t fSensorLag;             /*!< Lag of the instantaneous speed, current control periods */
+  COG_Mode_t Mode;
+  bool bActive;                   /*!< The table is added, updated by the medium frequency task */
+  bool bAcquire;                  /*!< The speed is accumulated by the current control */
+  volatile bool bReady;           /*!< hLearnRevolutions accumulated, the medium frequency task learns */
+  uint8_t bLastBin;
+  uint16_t hRevolutions;
+  uint16_t hIterations;           /*!< Learning iterations since the table was cleared */
+  int16_t hTable[COG_TABLE_SIZE]; /*!< Iq added at each index angle, digit */
+  float_t fTable[COG_TABLE_SIZE]; /*!< Table learnt, before its rounding */
+  int32_t wSpeedSum[COG_TABLE_SIZE]; /*!< Instantaneous electrical speed accumulated per entry, s16 per period */
+  uint16_t hSamples[COG_TABLE_SIZE];
+} COG_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Cogging Compensation component, the table cleared */
+void COG_Init(COG_Handle_t *pHandle);
+
+/* Stops the acquisition, to be called when the drive stops */
+void COG_Clear(COG_Handle_t *pHandle);
+
+/* Clears the table */
+void COG_ClearTable(COG_Handle_t *pHandle);
+
+/* Accumulates the speed at the index angle when learning, to be called by the current control */
+void COG_Accumulate(COG_Handle_t *pHandle, int16_t hAngle, int16_t hElSpeedDpp);
+
+/* Enables the table and learns from the accumulated speed, to be called by the medium frequency task */
+void COG_Task(COG_Handle_t *pHandle, bool bRunning);
+
+/* Sets the mode of the Cogging Compensation component */
+void COG_SetMode(COG_Handle_t *pHandle, COG_Mode_t Mode);
+
+/**
+  * @brief  Returns the mode of the Cogging Compensation component.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  */
+static inline COG_Mode_t COG_GetMode(const COG_Handle_t *pHandle)
+{
+  return (pHandle->Mode);
+}
+
+/**
+  * @brief  Returns the learning iterations since the table was cleared.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  */
+static inline uint16_t COG_GetIterations(const COG_Handle_t *pHandle)
+{
+  return (pHandle->hIterations);
+}
+
+/**
+  * @brief  Returns the Iq to add to the reference at an index angle, digit.
+  *
+  *         A single read of two neighbouring entries, linearly interpolated.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  * @param  hAngle: index angle, electrical or mechanical, s16degree.
+  */
+static inline int16_t COG_GetIq(const COG_Handle_t *pHandle, int16_t hAngle)
+{
+  int16_t hIq = 0;
+
+  if (true == pHandle->bActive)
+  {
+    uint32_t wAngle = (uint32_t)((uint16_t)hAngle);
+    uint32_t wIndex = wAngle >> COG_FRACTION_BITS;
+    int32_t wLow = (int32_t)pHandle->hTable[wIndex];
+    int32_t wHigh = (int32_t)pHandle->hTable[(wIndex + 1U) & (COG_TABLE_SIZE - 1U)];
+
+    hIq = (int16_t)(wLow + (((wHigh - wLow) * (int32_t)(wAngle & COG_FRACTION_MASK)) >> COG_FRACTION_BITS));
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (hIq);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* COGGING_COMP_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
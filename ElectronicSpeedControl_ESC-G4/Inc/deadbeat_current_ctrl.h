@@ -0,0 +1,145 @@
+
+/**
+  ******************************************************************************
+  * @file    deadbeat_current_ctrl.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Deadbeat Current Controller component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup DeadbeatCurrentCtrl
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef DEADBEAT_CURRENT_CTRL_H
+#define DEADBEAT_CURRENT_CTRL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "pid_regulator.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup DeadbeatCurrentCtrl
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Handle of the Deadbeat Current Controller component
+  *
+  * Voltages are expressed as the s16 Vqd at the nominal bus voltage, currents as the s16 Iqd.
+  */
+typedef struct
+{
+  PID_Handle_t *pPIDIq;           /*!< PI regulators taking over on saturation, their integral terms kept tracking */
+  PID_Handle_t *pPIDId;
+  float_t fResistance;            /*!< Stator resistance, voltage digit per current digit */
+  float_t fInductance;            /*!< Voltage holding a change of one current digit per period */
+  float_t fEmfPerDpp;             /*!< Back-emf per electrical speed unit, voltage digit per dpp */
+  float_t fGain;                  /*!< Part of the current error corrected per period, 1: deadbeat */
+  float_t fDisturbanceGain;       /*!< Part of the prediction error added to the disturbance per period */
+  uint16_t hMaxModule;            /*!< Largest voltage vector of the deadbeat, above it the PI regulates */
+  uint16_t hHoldPeriods;          /*!< Periods regulated by the PI after a saturation */
+  bool bEnabled;                  /*!< false: the PI regulates */
+  float_t fAlpha;                 /*!< Current kept over a period, exp(-Rs.Ts/Ls) */
+  float_t fBeta;                  /*!< Current change per voltage digit over a period */
+  float_t fInvBeta;               /*!< Voltage per current digit changed over a period */
+  qd_t Vqd;                       /*!< Voltage applied over the current period */
+  float_t fIqPredicted;           /*!< Currents predicted for the current period */
+  float_t fIdPredicted;
+  bool bPredicted;                /*!< The prediction was computed in the previous period */
+  float_t fDisturbanceQ;          /*!< Voltage errors of the model, voltage digit */
+  float_t fDisturbanceD;
+  uint16_t hHold;                 /*!< Periods left to the PI */
+  uint32_t wFallbacks;            /*!< Saturations handed over to the PI */
+  uint32_t wCycles;               /*!< Duration of the last current regulation, core clock cycles */
+} DBC_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Deadbeat Current Controller component */
+void DBC_Init(DBC_Handle_t *pHandle);
+
+/* Clears the voltage applied and the fallback, to be called before each motor restart */
+void DBC_Clear(DBC_Handle_t *pHandle);
+
+/* Computes the voltage settling the currents at their references, false when the PI shall regulate */
+bool DBC_Controller(DBC_Handle_t *pHandle, qd_t Iqd, int32_t wIqref, int32_t wIdref, int16_t hElSpeedDpp,
+                    qd_t *pVqd);
+
+/* Records the voltage computed by the PI regulators, applied over the next period */
+void DBC_SetApplied(DBC_Handle_t *pHandle, qd_t Vqd);
+
+/* Enables or disables the deadbeat regulation, the PI regulating when disabled */
+void DBC_SetEnabled(DBC_Handle_t *pHandle, bool bEnable);
+
+/**
+  * @brief  Returns true when the deadbeat regulation is enabled.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  */
+static inline bool DBC_IsEnabled(const DBC_Handle_t *pHandle)
+{
+  return (pHandle->bEnabled);
+}
+
+/**
+  * @brief  Returns the number of saturations handed over to the PI regulators.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  */
+static inline uint32_t DBC_GetFallbacks(const DBC_Handle_t *pHandle)
+{
+  return (pHandle->wFallbacks);
+}
+
+/**
+  * @brief  Records the duration of the current regulation, measured by the caller.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  * @param  wCycles: core clock cycles.
+  */
+static inline void DBC_SetCycles(DBC_Handle_t *pHandle, uint32_t wCycles)
+{
+  pHandle->wCycles = wCycles;
+}
+
+/**
+  * @brief  Returns the duration of the last current regulation, core clock cycles.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  */
+static inline uint32_t DBC_GetCycles(const DBC_Handle_t *pHandle)
+{
+  return (pHandle->wCycles);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* DEADBEAT_CURRENT_CTRL_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -67,6 +67,8 @@
 #define REV_PARK_ANGLE_COMPENSATION_FACTOR  0
 /* USER CODE END angle reconstruction M1 */
 
+#define FOC_PIPELINE_ENABLE                 1   /* 1: transforms and PI regulators of the current loop inlined */
+
 /**************************    DRIVE SETTINGS SECTION   **********************/
 /* PWM generation and current reading */
 #define PWM_FREQUENCY                       16000
@@ -168,6 +170,10 @@
 #define PHASE5_FINAL_CURRENT_A              10
 
 #define ENABLE_SL_ALGO_FROM_PHASE           2
+/* Shortest duration of the acceleration phase, used by the adaptive rev-up while the observer tracks the rotor */
+#define ADAPTIVE_REVUP_MIN_DURATION         1000 /*milliseconds */
+/* Bemf consistency required of the observer during the adaptive rev-up, tighter than M1_BEMF_CONSISTENCY_TOL */
+#define REVUP_BEMF_CONSISTENCY_TOL          48
 
 /* Sensor-less rev-up sequence */
 #define STARTING_ANGLE_DEG                  0  /*!< degrees [0...359] */
@@ -185,6 +191,8 @@
 
 /******************************   BUS VOLTAGE Motor 1  **********************/
 #define  M1_VBUS_SAMPLING_TIME              LL_ADC_SAMPLING_CYCLE(47)
+#define VBUS_COMPENSATION_ENABLE            0    /* 1: current regulators output scaled each period by the nominal over
+                                                    the sampled bus voltage, when it sags below the nominal */
 
 /******************************   Temperature sensing Motor 1  **********************/
 #define  M1_TEMP_SAMPLING_TIME              LL_ADC_SAMPLING_CYCLE(47)
@@ -195,12 +203,175 @@
 /******************************   ADDITIONAL FEATURES   **********************/
 
 /*** On the fly start-up ***/
+#define OTF_DETECTION_DURATION              200 /* Null current observation of the rotor before rev-up, ms */
+
+/*** Initial rotor position detection by inductive pulses ***/
+#define POLPULSE_ENABLE                     0  /* 1: rotor position detected by pulses instead of the alignment phase */
+#define POLPULSE_CURRENT_A                  8  /* Peak current of the pulses, high enough to saturate the d axis */
+#define POLPULSE_PULSE_PERIODS              1  /* PWM periods of each voltage pulse */
+#define POLPULSE_DECAY_PERIODS              16 /* PWM periods of null voltage after each pulse, about 5 Ls/Rs */
+#define POLPULSE_NUM_ANGLES                 6  /* Number of pulse directions, 5 or 6 */
+#define POLPULSE_MIN_CONTRAST               0.012 /* Polarity signal over the mean pulse current, else alignment */
+
+/*** Low speed sensor-less by high frequency injection, for motors with Ld < Lq ***/
+#define HFI_STARTUP_ENABLE                  0    /* 1: closed loop from standstill on the saliency, no rev-up */
+#define HFI_INJECTION_VOLTAGE_V             1.0  /* Amplitude of the d axis square wave */
+#define HFI_INJECTION_HALF_PERIOD           2    /* Current control periods, 2 to 4: square wave at PWM_FREQUENCY/4 */
+#define HFI_CROSSOVER_LOW_RPM               800  /*!< rpm, mechanical: State Observer blended in above */
+#define HFI_CROSSOVER_HIGH_RPM              1600 /*!< rpm, mechanical: injection off and State Observer only above */
+#define HFI_PLL_KP_GAIN                     52
+#define HFI_PLL_KI_GAIN                     47
+#define HFI_PLL_KPDIV                       64
+#define HFI_PLL_KPDIV_LOG                   LOG2((HFI_PLL_KPDIV))
+#define HFI_PLL_KIDIV                       2048
+#define HFI_PLL_KIDIV_LOG                   LOG2((HFI_PLL_KIDIV))
+
+/*** High Sensitivity Observer, rotor flux observer ***/
+#define HSO_MAIN_SENSOR                     0   /* 1: speed sensor of the closed loop instead of the State Observer */
+#define HSO_CROSSOVER_HZ                    20  /* Crossover of the flux integrator at start */
+#define HSO_CROSSOVER_MIN_HZ                5   /* The crossover follows half the electrical frequency, within these limits */
+#define HSO_CROSSOVER_MAX_HZ                200
+#define HSO_SPEED_POLE_HZ                   50  /* Low pass filter of the speed */
+#define HSO_CHECKDIR_BW_HZ                  5   /* Bandwidth of the rotation direction check */
+
+/*** Stator resistance and winding temperature estimation ***/
+#define RS_ESTIMATION_ENABLE                0   /* 1: observers follow the resistance estimated in RUN */
+#define RS_EST_INJECTION_CURRENT_A          1.0 /* Amplitude of the d axis low frequency injection */
+#define RS_EST_INJECTION_FREQ_HZ            20
+#define RS_EST_BANDWIDTH_RPS                0.5 /* Low pass filter of the estimate */
+#define RS_EST_RATED_CELSIUS                25  /* Winding temperature at which RS is given */
+
+/*** Motor self commissioning, run by the profiler command of the Motor Control Protocol ***/
+#define SELF_COMMISSIONING_ENABLE           0    /* 1: R, L, Ke, J and F measured, the drive tuned on them */
+#define SCC_RS_MEAS_CURRENT_A               5    /* DC current of the R and L measurements, also the start-up current */
+#define SCC_OVERCURRENT_A                   15   /* Peak current restarting the R and L measurements at a lower current */
+#define SCC_DUTY_RAMP_DURATION              2000 /* Voltage ramp searching SCC_RS_MEAS_CURRENT_A, ms */
+#define SCC_ALIGNMENT_DURATION              500  /* ms */
+#define SCC_RS_DETECTION_DURATION           500  /* Per current level, also the duration of the L measurement, ms */
+#define SCC_LD_LQ_RATIO                     1.0
+#define SCC_CURRENT_BW_RPS                  6900 /* Bandwidth of the current regulators tuned on R and L */
+#define SCC_NOMINAL_SPEED_RPM               MAX_APPLICATION_SPEED_RPM /* Ke measured up to half of it */
+#define OTT_SPEED_BW_RPS                    30   /* Bandwidth of the speed regulator tuned on J and F */
+#define OTT_MEAS_WINDOW_S                   0.2
+#define OTT_SPEED_STAB_TIME_S               0.5
+#define OTT_CURR_REG_STAB_TIME_S            0.1
+#define OTT_TIMEOUT_S                       10
+#define OTT_LOW_SPEED_PERC                  0.3  /* Speed points of the friction measurement, of the nominal speed */
+#define OTT_HIGH_SPEED_PERC                 0.6
+#define OTT_SPEED_MARGIN                    0.1
+
+/*** Parameter store, read at boot from the last flash pages and written by the Motor Control Protocol ***/
+#define PST_OFFSETS_MAX_DRIFT_CELSIUS       10   /* Stored current offsets are used up to this temperature change */
+
+/*** Fault recorder, the drive state preceding a fault written to the flash ***/
+#define FLR_DECIMATION                      4    /* Current control periods between two samples, 8 ms recorded */
+
+/*** Regular conversions scanned continuously by the ADC into a DMA buffer, none started by the current control ***/
+#define RCM_DMA_ENABLE                      0    /* 1: once the current sampling instants are measured unchanged on target */
+#define RCM_DMA                             DMA1
+#define RCM_DMA_CHANNEL                     LL_DMA_CHANNEL_3
+#define RCM_OVERSAMPLING_LOG2               4    /* Hardware average of 2^n conversions: 0 (none), or 4 to 8 */
+
+/*** Regenerative braking limited by the bus voltage, dissipation in the windings by Id beforehand ***/
+#define REGEN_LIMITER_ENABLE                0    /* 1: Iq limited and Id injected when the bus voltage rises in braking */
+#define REGEN_VBUS_START_V                  17.2 /* Bus voltage regulated during the braking, below OV_VOLTAGE_THRESHOLD_V */
+#define REGEN_ID_MAX_A                      6    /* Largest Id injected before the regenerative Iq is reduced */
+#define PID_REGEN_KP_DEFAULT                400  /* Run by the current control, u16Volt error to current */
+#define PID_REGEN_KI_DEFAULT                8000
+#define REGEN_KPDIV                         256
+#define REGEN_KIDIV                         16384
+#define REGEN_KPDIV_LOG                     LOG2((256))
+#define REGEN_KIDIV_LOG                     LOG2((16384))
+
+/*** Throttle of a flight controller on PA15, TIM2_CH1: DShot captured by DMA, or servo pulses ***/
+#define THR_INPUT_ENABLE                    0    /* 1: replaces the start of the motor at boot */
+#define THR_PROTOCOL                        THR_DSHOT /* THR_DSHOT (150, 300 or 600) or THR_PWM */
+#define THR_TIM                             TIM2 /* 32 bits timer */
+#define THR_DMA                             DMA1
+#define THR_DMA_CHANNEL                     LL_DMA_CHANNEL_4
+#define THR_DMA_REQUEST                     LL_DMAMUX_REQ_TIM2_CH1
+#define THR_PWM_MIN_US                      1000 /* Pulse of the null throttle */
+#define THR_PWM_MAX_US                      2000 /* Pulse of the full throttle */
+#define THR_DSHOT_GAP_US                    8    /* Low level between two frames, longer than a DShot150 bit */
+#define THR_ARMING_TIME_MS                  500  /* Null throttle received before the motor can start */
+#define THR_FAILSAFE_TIMEOUT_MS             100  /* Time without a valid throttle before the motor stops */
+#define THR_CONTROL_MODE                    MCM_SPEED_MODE /* MCM_SPEED_MODE or MCM_TORQUE_MODE */
+#define THR_SPEED_MIN_RPM                   OBS_MINIMUM_SPEED_RPM /* Speed of the smallest throttle */
+#define THR_SPEED_MAX_RPM                   MAX_APPLICATION_SPEED_RPM /* Speed of the full throttle */
+#define THR_TORQUE_MAX_A                    NOMINAL_CURRENT_A /* Iq of the full throttle in torque mode */
+#define THR_RAMP_DURATION_MS                20   /* Ramp to a new throttle */
+#define THR_DSHOT_TELEMETRY_ENABLE          1    /* eRPM and extended telemetry replied to the bidirectional DShot */
+#define THR_TLM_TIM                         TIM4 /* Reset by the edges captured, then pacing the reply */
+#define THR_TLM_TRIGGER                     LL_TIM_TS_ITR1 /* TIM2 trigger output on TIM4 */
+#define THR_TLM_DMA_CHANNEL                 LL_DMA_CHANNEL_5 /* On THR_DMA */
+#define THR_TLM_DMA_REQUEST                 LL_DMAMUX_REQ_TIM4_UP
+#define THR_TURNAROUND_US                   30   /* End of a frame to the start of its reply */
+
+/*** Speed loop filters: biquads on the speed feedback and on the torque reference, adaptive notch ***/
+#define SPD_FILTER_ENABLE                   0    /* 1: filters of the speed loop, tuned on the drive train */
+#define SPD_FLT_NOTCH_HZ                    0    /* Fixed notch of the speed feedback, 0: none */
+#define SPD_FLT_NOTCH_Q                     2.0  /* Centre frequency over the -3 dB width, of all the notches */
+#define SPD_FLT_SPEED_LPF_HZ                0    /* Low pass of the speed feedback, 0: none */
+#define SPD_FLT_TORQUE_LPF_HZ               0    /* Low pass of the torque reference, 0: none */
+#define SPD_FLT_ADAPTIVE_ENABLE             1    /* Notch following the dominant vibration of the speed */
+#define SPD_FLT_ADAPTIVE_MIN_HZ             80   /* Well above the bandwidth of the speed regulator */
+#define SPD_FLT_ADAPTIVE_MAX_HZ             450  /* Below half of SPEED_LOOP_FREQUENCY_HZ */
+#define SPD_FLT_ADAPTIVE_MIN_RPM            12   /* Vibration amplitude below which the notch is not tuned */
+#define SPD_FLT_ADAPTIVE_STEP               0.005 /* Normalized adaptation gain */
+
+/*** Cogging compensation: Iq table along the rotor angle, learnt at a constant low speed ***/
+#define COGGING_COMP_ENABLE                 0    /* 1: built, off at boot, the Motor Control Protocol sets its mode */
+#define COG_MECHANICAL_INDEX                0    /* 1: table along the mechanical angle, for an absolute position sensor */
+#define COG_INERTIA_KGM2                    MOTOR_INERTIA_KGM2 /* Sets the learning rate only */
+#define COG_IQ_MAX_A                        1.5  /* Largest Iq of the table */
+#define COG_COMP_MAX_RPM                    1500 /* Speed above which the inertia filters the cogging */
+#define COG_LEARN_MIN_RPM                   120  /* Learning range, below OBS_MINIMUM_SPEED_RPM: needs the HFI or */
+#define COG_LEARN_MAX_RPM                   250  /* the HSO speed sensor, cogging within the speed sensor bandwidth */
+#define COG_LEARN_REVOLUTIONS               32   /* Revolutions of the index angle averaged by an iteration */
+#define COG_LEARN_GAIN                      0.3  /* Share of the residual removed by an iteration */
+#define COG_SENSOR_LAG_US                   400  /* Lag of the instantaneous speed at the cogging frequency */
+
+/*** Vibration monitor: spectrum of Iq at the harmonics of the mechanical frequency, in the idle time ***/
+#define VIB_MONITOR_ENABLE                  0    /* 1: Iq spectrum measured in RUN, read by the Motor Control Protocol */
+#define VIB_DECIMATION                      8    /* Current control periods per sample: 128 ms windows, 1x from 1875 rpm */
+#define VIB_HARMONIC_N                      3    /* Order of the third harmonic measured, after 1x and 2x */
+#define VIB_SPEED_TOLERANCE                 0.05 /* Speed variation over a window above which it is discarded */
+
+/*** Anomaly detector: int8 autoencoder on the telemetry, Src/anomaly_model.c from Utilities/AnomalyDetector ***/
+#define ANOMALY_DETECTOR_ENABLE             0    /* 1: once the model is trained on flight logs of the drive */
+#define ANOM_DECIMATION                     20   /* Medium frequency task periods averaged per inference: 50 Hz */
+#define ANOM_SCORE_SHIFT                    5    /* Low pass of the score, as the --score-shift of the training */
+#define ANOM_PERSISTENCE                    25   /* Inferences above the threshold raising the flag: 0.5 s */
+#define ANOM_FAULT_ENABLE                   0    /* 1: the anomaly flag stops the drive with MC_SW_ERROR */
+
+/*** Load torque observer: inertia and friction model of the motor parameters, fed forward to the speed loop ***/
+#define LOAD_OBSERVER_ENABLE                0    /* 1: once the inertia and friction are measured on the drive train */
+#define LTO_FEEDFORWARD_ENABLE              1    /* 0: load estimated only, the Motor Control Protocol enables it */
+#define LTO_BANDWIDTH_HZ                    30   /* Double pole of the estimation error, below the speed sensor one */
+
+/*** Deadbeat current control: Rs/Ls model with delay compensation, the PI regulating on saturation ***/
+#define DEADBEAT_CURRENT_ENABLE             0    /* 1: the model regulates the currents, the PI regulators on saturation */
+#define DBC_GAIN                            0.6  /* Part of the current error corrected per period, 1: deadbeat */
+#define DBC_DISTURBANCE_GAIN                0.3  /* Part of the prediction error integrated per period */
+#define DBC_HOLD_PERIODS                    16   /* Current control periods left to the PI after a saturation */
 
 /**************************
  *** Control Parameters ***
  **************************/
 
 /* ##@@_USER_CODE_START_##@@ */
+/*** State Observer + PLL gain schedule ***/
+/* Speed points of the schedule, rpm, mechanical. Below STO_GS_SPEED1_RPM GAIN1, GAIN2 and PLL gains are used */
+#define STO_GS_SPEED1_RPM                   OBS_MINIMUM_SPEED_RPM
+#define STO_GS_SPEED2_RPM                   6500
+#define STO_GS_SPEED3_RPM                   MAX_APPLICATION_SPEED_RPM
+/* Discrete poles of the observer error dynamics at each speed point, in range [0, 1[.
+   Poles closer to 1 reduce the observer bandwidth and its sensitivity to current noise, but shift the angle
+   estimated at high speed: see Utilities/StateObserver */
+#define STO_GS_SPEED2_POLE_A                0.40
+#define STO_GS_SPEED2_POLE_B                0.00
+#define STO_GS_SPEED3_POLE_A                0.50
+#define STO_GS_SPEED3_POLE_B                0.00
 /* ##@@_USER_CODE_END_##@@ */
 
 #endif /*DRIVE_PARAMETERS_H*/
@@ -0,0 +1,158 @@
+
+/**
+  ******************************************************************************
+  * @file    fault_recorder.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Fault Recorder component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup FaultRecorder
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FAULT_RECORDER_H
+#define FAULT_RECORDER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "flash_records.h"
+#include "bus_voltage_sensor.h"
+#include "ntc_temperature_sensor.h"
+#include "speed_torq_ctrl.h"
+#include "pwm_curr_fdbk.h"
+#include "mc_interface.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup FaultRecorder
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Layout version of #FLR_Record_t, to be incremented when the layout changes */
+#define FLR_VERSION                 1U
+
+/* Samples kept before a fault */
+#define FLR_SAMPLE_NBR              32U
+
+/* Flash slot of a record, rounded up to the flash program unit */
+#define FLR_SLOT_SIZE               ((uint16_t)((sizeof(FREC_Header_t) + sizeof(FLR_Record_t) + 7U) & ~7U))
+
+/* Record bytes returned by a read command */
+#define FLR_CHUNK_SIZE              128U
+
+/* Commands of FLR_CMD, first byte of the MCP payload */
+#define FLR_CMD_READ                0U  /*!< Returns a chunk of a record: age (2 bytes, 0 for the newest), chunk */
+#define FLR_CMD_ERASE               1U  /*!< Erases the log, in IDLE */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Drive state sampled before a fault.
+  */
+typedef struct
+{
+  int16_t hIq;                    /*!< Currents, digit */
+  int16_t hId;
+  int16_t hVq;                    /*!< Voltages, digit */
+  int16_t hVd;
+  uint16_t hVbus;                 /*!< Bus voltage, u16Volt */
+  int16_t hMecSpeedUnit;          /*!< Speed of the speed loop sensor, #SPEED_UNIT */
+} FLR_Sample_t;
+
+/**
+  * @brief  Fault record, also the MCP payload of the read command.
+  */
+typedef struct
+{
+  uint32_t wTimestamp;            /*!< GLOBAL_TIMESTAMP at the fault, current control periods since boot */
+  uint16_t hFaults;               /*!< Faults at the fault, with those latched until the record is written */
+  uint8_t bState;                 /*!< #MCI_State_t at the fault */
+  uint8_t bSampleNbr;             /*!< Valid samples, the oldest first */
+  int16_t hCelsius;               /*!< Power stage temperature at the fault */
+  uint16_t hDecimation;           /*!< Current control periods between two samples */
+  FLR_Sample_t Samples[FLR_SAMPLE_NBR];
+} FLR_Record_t;
+
+/**
+  * @brief  States of the Fault Recorder component.
+  */
+typedef enum
+{
+  FLR_SAMPLING = 0,               /*!< Samples are added to the ring */
+  FLR_FROZEN,                     /*!< A fault froze the ring, the record waits to be written */
+  FLR_RECORDED                    /*!< The record is written, sampling restarts once the faults are acknowledged */
+} FLR_State_t;
+
+/**
+  * @brief  Handle of the Fault Recorder component
+  */
+typedef struct
+{
+  FREC_Handle_t Records;          /*!< Flash records of the log */
+  FLR_Record_t Record;            /*!< Record being built, its samples used as a ring until a fault */
+  FOCVars_t *pFOCVars;
+  BusVoltageSensor_Handle_t *pBusSensor;
+  NTC_Handle_t *pTemperatureSensor;
+  SpeednTorqCtrl_Handle_t *pSTC;
+  PWMC_Handle_t *pPWMC;
+  MCI_Handle_t *pMCI;
+  uint16_t hDecimation;           /*!< Current control periods between two samples */
+  uint16_t hDecimationCnt;
+  uint8_t bIndex;                 /*!< Ring position of the next sample */
+  volatile FLR_State_t State;
+  volatile bool bEraseRequest;    /*!< Log erase requested by the MCP */
+  uint16_t hWriteErrors;          /*!< Records that could not be written */
+} FLR_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Fault Recorder component */
+void FLR_Init(FLR_Handle_t *pHandle);
+
+/* Samples the drive, or freezes the samples on a fault */
+void FLR_Sample(FLR_Handle_t *pHandle, uint32_t wTimestamp);
+
+/* Writes the frozen record to the flash, to be called out of the interrupts */
+void FLR_BackgroundTask(FLR_Handle_t *pHandle);
+
+/* Returns true while a record waits to be written */
+bool FLR_IsPending(const FLR_Handle_t *pHandle);
+
+/* Executes a fault recorder command received by the MCP */
+uint8_t FLR_CMD(FLR_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace,
+                uint16_t *txLength, uint8_t *txBuffer);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* FAULT_RECORDER_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,118 @@
+
+/**
+  ******************************************************************************
+  * @file    flash_records.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Flash Records component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup FlashRecords
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FLASH_RECORDS_H
+#define FLASH_RECORDS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup FlashRecords
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Marks the header of a programmed record */
+#define FREC_MAGIC                  0x4345524DU
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Header programmed in front of each record.
+  */
+typedef struct
+{
+  uint32_t wMagic;           /*!< #FREC_MAGIC */
+  uint16_t hVersion;         /*!< Layout version of the payload */
+  uint16_t hSize;            /*!< Payload bytes */
+  uint32_t wSequence;        /*!< Incremented at each record, the highest one being the newest */
+  uint32_t wCRC;             /*!< CRC-32 of the version, size, sequence and payload */
+} FREC_Header_t;
+
+/**
+  * @brief  Flash Records parameters definition
+  */
+typedef struct
+{
+  uint32_t wBaseAddress;     /*!< Address of the first page */
+  uint32_t wPageSize;        /*!< Erase unit, bytes */
+  uint16_t hSlotSize;        /*!< Bytes taken by a record, header included, multiple of the program unit */
+  uint16_t hVersion;         /*!< Layout version of the payload, records of another version are ignored */
+  uint8_t bPageNbr;          /*!< Pages used as a ring, at least 2 */
+} FREC_Params_t;
+
+/**
+  * @brief  Handle of the Flash Records component
+  */
+typedef struct
+{
+  const FREC_Params_t *pParams;
+  uint32_t wLastAddress;     /*!< Newest valid record, 0 if there is none */
+  uint32_t wNextAddress;     /*!< Slot of the next record */
+  uint32_t wSequence;        /*!< Sequence number of the newest valid record */
+} FREC_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Finds the newest record and the next free slot */
+void FREC_Init(FREC_Handle_t *pHandle);
+
+/* Reads the payload of the newest record */
+bool FREC_ReadLast(FREC_Handle_t *pHandle, void *pPayload, uint16_t hSize);
+
+/* Reads part of the payload of a record older than the newest one */
+bool FREC_Read(FREC_Handle_t *pHandle, uint32_t wAge, uint16_t hOffset, void *pData, uint16_t hSize);
+
+/* Appends a record */
+bool FREC_Append(FREC_Handle_t *pHandle, const void *pPayload, uint16_t hSize);
+
+/* Erases all the records */
+bool FREC_Erase(FREC_Handle_t *pHandle);
+
+/* Computes a CRC-32 */
+uint32_t FREC_CalcCRC(uint32_t wCRC, const void *pData, uint32_t wSize);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* FLASH_RECORDS_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
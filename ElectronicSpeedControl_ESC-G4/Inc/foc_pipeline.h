@@ -0,0 +1,287 @@
+
+/**
+  ******************************************************************************
+  * @file    foc_pipeline.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains the inline stages of the current loop, the
+  *          FOC Pipeline component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup FOCPipeline
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FOC_PIPELINE_H
+#define FOC_PIPELINE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "mc_math.h"
+#include "pid_regulator.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup FOCPipeline FOC Pipeline
+  * @brief Inline stages of the current loop
+  *
+  * The transforms and the PI regulators of the current loop are called once or twice per PWM
+  * period. As __weak functions of other compilation units they can not be inlined, their calls
+  * and the separate sine and cosine evaluations of the Park and reverse Park transforms cost more
+  * than the arithmetics. These stages give the same results as MCM_Clarke(), MCM_Park(),
+  * MCM_Rev_Park() and PI_Controller(), and are compiled within the current loop, as is the
+  * compensation of the bus voltage of the regulator outputs.
+  *
+  * The Park transforms take the sine and cosine of the angle, so that one CORDIC evaluation
+  * serves both when the angle compensations are the same. The current sensing and the speed
+  * sensor remain called through their handles: the PWM component switches its current reading
+  * function for the offset calibration and the R/L measurement, and the speed sensor of the
+  * loop changes during the start-up.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Returns the cosine and the sine of an angle, computed by the CORDIC.
+  * @param  hAngle: angle in q1.15 format.
+  */
+static inline Trig_Components FOCP_CosSin(int16_t hAngle)
+{
+  Trig_Components CosSin;
+  uint32_t wResult;
+
+  WRITE_REG(CORDIC->CSR, CORDIC_CONFIG_COSINE);
+  LL_CORDIC_WriteData(CORDIC, ((uint32_t)0x7FFF0000) + ((uint32_t)hAngle));
+  wResult = LL_CORDIC_ReadData(CORDIC);
+  CosSin.hCos = (int16_t)(uint16_t)wResult;
+  CosSin.hSin = (int16_t)(uint16_t)(wResult >> 16);
+  return (CosSin);
+}
+
+/**
+  * @brief  Saturates a q1.15 result to +/-32767, as the transforms of the MC math do.
+  */
+static inline int16_t FOCP_Sat16(int32_t wValue)
+{
+  int16_t hValue;
+
+  if (wValue > INT16_MAX)
+  {
+    hValue = INT16_MAX;
+  }
+  else if (wValue < -INT16_MAX)
+  {
+    hValue = -INT16_MAX;
+  }
+  else
+  {
+    hValue = (int16_t)wValue;
+  }
+  return (hValue);
+}
+
+/**
+  * @brief  Clarke transform, same result as MCM_Clarke().
+  * @param  Input: stator values a and b.
+  */
+static inline alphabeta_t FOCP_Clarke(ab_t Input)
+{
+  alphabeta_t Output;
+  int32_t a_divSQRT3_tmp = (int32_t)0x49E6 * ((int32_t)Input.a);
+  int32_t b_divSQRT3_tmp = (int32_t)0x49E6 * ((int32_t)Input.b);
+
+  Output.alpha = Input.a;
+#ifndef FULL_MISRA_C_COMPLIANCY_MC_MATH
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  Output.beta = FOCP_Sat16((-(a_divSQRT3_tmp) - (b_divSQRT3_tmp) - (b_divSQRT3_tmp)) >> 15);
+#else
+  Output.beta = FOCP_Sat16((-(a_divSQRT3_tmp) - (b_divSQRT3_tmp) - (b_divSQRT3_tmp)) / 32768);
+#endif
+  return (Output);
+}
+
+/**
+  * @brief  Park transform, same result as MCM_Park() on the angle of CosSin.
+  * @param  Input: stator values alpha and beta.
+  * @param  CosSin: cosine and sine of the rotating frame angle, see FOCP_CosSin().
+  */
+static inline qd_t FOCP_Park(alphabeta_t Input, Trig_Components CosSin)
+{
+  qd_t Output;
+  int32_t q_tmp = (Input.alpha * ((int32_t)CosSin.hCos)) - (Input.beta * ((int32_t)CosSin.hSin));
+  int32_t d_tmp = (Input.alpha * ((int32_t)CosSin.hSin)) + (Input.beta * ((int32_t)CosSin.hCos));
+
+#ifndef FULL_MISRA_C_COMPLIANCY_MC_MATH
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  Output.q = FOCP_Sat16(q_tmp >> 15);
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  Output.d = FOCP_Sat16(d_tmp >> 15);
+#else
+  Output.q = FOCP_Sat16(q_tmp / 32768);
+  Output.d = FOCP_Sat16(d_tmp / 32768);
+#endif
+  return (Output);
+}
+
+/**
+  * @brief  Reverse Park transform, same result as MCM_Rev_Park() on the angle of CosSin.
+  * @param  Input: stator voltages q and d.
+  * @param  CosSin: cosine and sine of the rotating frame angle, see FOCP_CosSin().
+  */
+static inline alphabeta_t FOCP_RevPark(qd_t Input, Trig_Components CosSin)
+{
+  alphabeta_t Output;
+  int32_t alpha_tmp = (Input.q * ((int32_t)CosSin.hCos)) + (Input.d * ((int32_t)CosSin.hSin));
+  int32_t beta_tmp = (Input.d * ((int32_t)CosSin.hCos)) - (Input.q * ((int32_t)CosSin.hSin));
+
+#ifndef FULL_MISRA_C_COMPLIANCY_MC_MATH
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  Output.alpha = (int16_t)(alpha_tmp >> 15);
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  Output.beta = (int16_t)(beta_tmp >> 15);
+#else
+  Output.alpha = (int16_t)(alpha_tmp / 32768);
+  Output.beta = (int16_t)(beta_tmp / 32768);
+#endif
+  return (Output);
+}
+
+/**
+  * @brief  PI regulator, same result and state update as PI_Controller().
+  * @param  pHandle: handle of the PID component.
+  * @param  wProcessVarError: reference minus the process variable.
+  */
+static inline int16_t FOCP_PI(PID_Handle_t *pHandle, int32_t wProcessVarError)
+{
+  int32_t wProportional_Term = pHandle->hKpGain * wProcessVarError;
+  int32_t wOutput_32;
+  int32_t wDischarge = 0;
+
+  if (0 == pHandle->hKiGain)
+  {
+    pHandle->wIntegralTerm = 0;
+  }
+  else
+  {
+    int32_t wIntegral_Term = pHandle->hKiGain * wProcessVarError;
+    int32_t wIntegral_sum_temp = pHandle->wIntegralTerm + wIntegral_Term;
+
+    /* Wrap around of the sum, saturated */
+    if ((wIntegral_sum_temp < 0) && (pHandle->wIntegralTerm > 0) && (wIntegral_Term > 0))
+    {
+      wIntegral_sum_temp = INT32_MAX;
+    }
+    else if ((wIntegral_sum_temp >= 0) && (pHandle->wIntegralTerm < 0) && (wIntegral_Term < 0))
+    {
+      wIntegral_sum_temp = -INT32_MAX;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (wIntegral_sum_temp > pHandle->wUpperIntegralLimit)
+    {
+      pHandle->wIntegralTerm = pHandle->wUpperIntegralLimit;
+    }
+    else if (wIntegral_sum_temp < pHandle->wLowerIntegralLimit)
+    {
+      pHandle->wIntegralTerm = pHandle->wLowerIntegralLimit;
+    }
+    else
+    {
+      pHandle->wIntegralTerm = wIntegral_sum_temp;
+    }
+  }
+
+#ifndef FULL_MISRA_C_COMPLIANCY_PID_REGULATOR
+  //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+  wOutput_32 = (wProportional_Term >> pHandle->hKpDivisorPOW2) + (pHandle->wIntegralTerm >> pHandle->hKiDivisorPOW2);
+#else
+  wOutput_32 = (wProportional_Term / (int32_t)pHandle->hKpDivisor)
+             + (pHandle->wIntegralTerm / (int32_t)pHandle->hKiDivisor);
+#endif
+
+  if (wOutput_32 > pHandle->hUpperOutputLimit)
+  {
+    wDischarge = pHandle->hUpperOutputLimit - wOutput_32;
+    wOutput_32 = pHandle->hUpperOutputLimit;
+  }
+  else if (wOutput_32 < pHandle->hLowerOutputLimit)
+  {
+    wDischarge = pHandle->hLowerOutputLimit - wOutput_32;
+    wOutput_32 = pHandle->hLowerOutputLimit;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  pHandle->wIntegralTerm += wDischarge;
+  return ((int16_t)wOutput_32);
+}
+
+/**
+  * @brief  Scales the current regulator outputs, s16 voltages of the nominal bus voltage, to the
+  *         modulation of the bus voltage sampled in this period. Below the nominal voltage, the gain of
+  *         the current loops and the applied voltages then do not depend on the battery sag and ripple.
+  *         Above it the outputs are not lowered, the regulators full scale would cap the voltage of a
+  *         charged battery.
+  * @param  Vqd: current regulator outputs.
+  * @param  hVbus_d: bus voltage sample, u16 of the ADC full scale.
+  * @param  hNominal_d: nominal bus voltage the regulators are tuned for, same unit.
+  * @param  hMinimum_d: lowest bus voltage compensated, the under voltage threshold, same unit.
+  */
+static inline qd_t FOCP_CompensateVbus(qd_t Vqd, uint16_t hVbus_d, uint16_t hNominal_d, uint16_t hMinimum_d)
+{
+  qd_t Output = Vqd;
+
+  if (hVbus_d < hNominal_d)
+  {
+    /* Down to the under voltage threshold, the gain is at most about 2 */
+    uint32_t wVbus_d = (hVbus_d > hMinimum_d) ? hVbus_d : hMinimum_d;
+    int32_t wGain = (int32_t)((((uint32_t)hNominal_d) << 14) / wVbus_d);
+    int32_t wq = (Vqd.q * wGain) >> 14;
+    int32_t wd = (Vqd.d * wGain) >> 14;
+
+    /* Saturated here, limited to the modulation circle next */
+    Output.q = FOCP_Sat16(wq);
+    Output.d = FOCP_Sat16(wd);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (Output);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* FOC_PIPELINE_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
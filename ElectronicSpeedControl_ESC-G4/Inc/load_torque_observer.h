@@ -0,0 +1,110 @@
+
+/**
+  ******************************************************************************
+  * @file    load_torque_observer.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Load Torque Observer component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup LoadTorqueObserver
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef LOAD_TORQUE_OBSERVER_H
+#define LOAD_TORQUE_OBSERVER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup LoadTorqueObserver
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Handle of the Load Torque Observer component
+  */
+typedef struct
+{
+  const qd_t *pIqd;               /*!< Measured currents, written by the current control */
+  float_t fSamplingFreq_Hz;       /*!< Rate of the speed regulator */
+  float_t fAccelPerDigit;         /*!< Speed change of one Iq digit over a period, #SPEED_UNIT */
+  float_t fDamping;               /*!< Speed lost to the friction over a period, per #SPEED_UNIT */
+  float_t fBandwidth_Hz;          /*!< Double pole of the estimation error */
+  int16_t hLoadMax;               /*!< Largest load estimated, digit */
+  bool bFeedForward;              /*!< The speed regulator adds the load to its output */
+  float_t fGainSpeed;             /*!< Corrections of the model by the speed error */
+  float_t fGainLoad;
+  float_t fSpeed;                 /*!< Speed estimated, #SPEED_UNIT */
+  float_t fLoad;                  /*!< Load torque estimated, Iq digit */
+  bool bPrimed;                   /*!< The estimates follow the drive */
+  int16_t hLoad;                  /*!< Load torque estimated, Iq digit, for the Motor Control Protocol */
+} LTO_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Load Torque Observer component */
+void LTO_Init(LTO_Handle_t *pHandle);
+
+/* Restarts the observer from the next period, to be called when the drive stops */
+void LTO_Clear(LTO_Handle_t *pHandle);
+
+/* Updates the estimates and returns the feed-forward, to be called once per speed regulator period */
+int16_t LTO_Update(LTO_Handle_t *pHandle, int16_t hMecSpeedUnit);
+
+/* Enables or disables the feed-forward of the load to the speed regulator */
+void LTO_SetFeedForward(LTO_Handle_t *pHandle, bool bEnable);
+
+/**
+  * @brief  Returns the load torque estimated, expressed as the Iq balancing it, digit.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  */
+static inline int16_t LTO_GetLoad(const LTO_Handle_t *pHandle)
+{
+  return (pHandle->hLoad);
+}
+
+/**
+  * @brief  Returns true when the speed regulator adds the load to its output.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  */
+static inline bool LTO_IsFeedForward(const LTO_Handle_t *pHandle)
+{
+  return (pHandle->bFeedForward);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* LOAD_TORQUE_OBSERVER_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
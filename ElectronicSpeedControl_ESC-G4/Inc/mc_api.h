@@ -182,6 +182,12 @@ float_t MC_GetAveragePowerMotor1_F(void);
 /* Call the Profiler command */
 uint8_t MC_ProfilerCommand (uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer);
 
+/* Call the parameter store command */
+uint8_t MC_ParamStoreCommand (uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer);
+
+/* Call the fault recorder command */
+uint8_t MC_FaultLogCommand (uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer);
+
 /**
   * @}
   */
@@ -48,6 +48,11 @@ void MC_APP_BootHook(void);
 /* Hook function called right after the Medium Frequency Task of Motor 1 */
 void MC_APP_PostMediumFrequencyHook_M1(void);
 
+#if (NBR_OF_MOTORS > 1)
+/* Hook function called right after the Medium Frequency Task of Motor 2 */
+void MC_APP_PostMediumFrequencyHook_M2(void);
+#endif
+
 /** @} */
 
 /** @} */
@@ -33,6 +33,21 @@
 #include "circle_limitation.h"
 #include "sto_speed_pos_fdbk.h"
 #include "sto_pll_speed_pos_fdbk.h"
+#include "polpulse.h"
+#include "hfi_speed_pos_fdbk.h"
+#include "hso_speed_pos_fdbk.h"
+#include "rstemp.h"
+#include "mp_self_com_ctrl.h"
+#include "mc_param_store.h"
+#include "fault_recorder.h"
+#include "regen_limiter.h"
+#include "throttle_input.h"
+#include "speed_filter.h"
+#include "load_torque_observer.h"
+#include "deadbeat_current_ctrl.h"
+#include "cogging_comp.h"
+#include "vibration_monitor.h"
+#include "anomaly_detector.h"
 
 /* USER CODE BEGIN Additional include */
 
@@ -46,6 +61,40 @@ extern PQD_MotorPowMeas_Handle_t *pPQD_MotorPowMeasM1;
 extern STO_Handle_t STO_M1;
 extern RevUpCtrl_Handle_t RevUpControlM1;
 extern STO_PLL_Handle_t STO_PLL_M1;
+extern const STO_PLL_GainSchedPoint_t STO_PLL_GainSchedM1[];
+extern POLPULSE_Obj PolPulseM1;
+extern const POLPULSE_Params PolPulseParamsM1;
+extern HFI_Handle_t HFI_M1;
+extern HSO_Obj HSO_ObjM1;
+extern const HSO_Params HSO_ParamsM1;
+extern HSO_SPD_Handle_t HSO_M1;
+extern RSTEMP_Obj RSTempM1;
+extern const RSTEMP_Params RSTempParamsM1;
+extern SCC_Params_t SCC_ParamsM1;
+extern SCC_Handle_t SCC_M1;
+extern const OTT_Params_t OTT_ParamsM1;
+extern OTT_Handle_t OTT_M1;
+extern const FREC_Params_t ParamStoreRecordsM1;
+extern PST_Handle_t ParamStoreM1;
+extern const FREC_Params_t FaultRecorderRecordsM1;
+extern FLR_Handle_t FaultRecorderM1;
+extern PID_Handle_t PIDRegenHandle_M1;
+extern REGEN_Handle_t RegenLimiterM1;
+extern THR_Handle_t ThrottleInputM1;
+extern SPDFLT_Handle_t SpeedFilterM1;
+extern LTO_Handle_t LoadObserverM1;
+extern DBC_Handle_t DeadbeatCurrM1;
+extern COG_Handle_t CoggingCompM1;
+extern VIB_Handle_t VibMonitorM1;
+extern const ANOM_Model_t AnomalyModelM1;
+extern ANOM_Handle_t AnomalyDetectorM1;
+
+/* Speed sensor of the closed loop */
+#if (HSO_MAIN_SENSOR == 1)
+#define MAIN_SPEED_SENSOR_M1                (&HSO_M1._Super)
+#else
+#define MAIN_SPEED_SENSOR_M1                (&STO_PLL_M1._Super)
+#endif
 
 extern CircleLimitation_Handle_t CircleLimitationM1;
 extern RampExtMngr_Handle_t RampExtMngrHFParamsM1;
@@ -54,6 +103,9 @@ extern FOCVars_t FOCVars[NBR_OF_MOTORS];
 extern PID_Handle_t *pPIDIq[NBR_OF_MOTORS];
 extern PID_Handle_t *pPIDId[NBR_OF_MOTORS];
 extern PQD_MotorPowMeas_Handle_t *pMPM[NBR_OF_MOTORS];
+extern PID_Handle_t *pPIDSpeed[NBR_OF_MOTORS];
+extern STO_PLL_Handle_t *pSTO_PLL[NBR_OF_MOTORS];
+extern RevUpCtrl_Handle_t *pRevUpCtrl[NBR_OF_MOTORS];
 extern MCI_Handle_t* pMCI[NBR_OF_MOTORS];
 extern SpeednTorqCtrl_Handle_t *pSTC[NBR_OF_MOTORS];
 extern MCI_Handle_t Mci[NBR_OF_MOTORS];
@@ -38,6 +38,10 @@ extern RegConv_t VbusRegConv_M1;
 extern RDivider_Handle_t BusVoltageSensor_M1;
 extern PWMC_Handle_t *pwmcHandle[NBR_OF_MOTORS];
 extern NTC_Handle_t *pTemperatureSensor[NBR_OF_MOTORS];
+extern RegConv_t *pTempRegConv[NBR_OF_MOTORS];
+extern RegConv_t *pVbusRegConv[NBR_OF_MOTORS];
+extern RDivider_Handle_t *pBusSensor[NBR_OF_MOTORS];
+extern VirtualSpeedSensor_Handle_t *pVSS[NBR_OF_MOTORS];
 
 /* USER CODE BEGIN Additional extern */
 
@@ -0,0 +1,87 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_flash.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          flash driver of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup MCFlash
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MC_FLASH_H
+#define MC_FLASH_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "stm32g4xx_hal.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup MCFlash
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Erase unit of the flash, bytes */
+#define MC_FLASH_PAGE_SIZE          FLASH_PAGE_SIZE
+
+/* Program unit of the flash, bytes */
+#define MC_FLASH_PROGRAM_SIZE       8U
+
+/* Pages taken out of the FLASH region by STM32G431CBUX_FLASH.ld for the parameter store */
+#define MC_FLASH_PARAMS_ADDRESS     0x0801F000U
+#define MC_FLASH_PARAMS_PAGES       2U
+
+/* Pages taken out of the FLASH region, in front of the parameter store, for the fault recorder */
+#define MC_FLASH_LOG_ADDRESS        0x0801D000U
+#define MC_FLASH_LOG_PAGES          4U
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Erases the page holding an address */
+bool MCFLASH_ErasePage(uint32_t wAddress);
+
+/* Programs a buffer to erased flash */
+bool MCFLASH_Program(uint32_t wAddress, const void *pData, uint32_t wSize);
+
+/* Reads the flash to a buffer */
+void MCFLASH_Read(uint32_t wAddress, void *pData, uint32_t wSize);
+
+/* Checks that a flash area is erased */
+bool MCFLASH_IsErased(uint32_t wAddress, uint32_t wSize);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* MC_FLASH_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -90,7 +90,9 @@ typedef enum
                           *  application is not controlling the motor. This state is exited
                           *  when the application sends a motor command or when a fault occurs. */
   ALIGNMENT = 2,        /**< The encoder alignment procedure that will properly align the
-                          *  the encoder to a set mechanical angle is being executed. */
+                          *  the encoder to a set mechanical angle is being executed.
+                          *  Sensor-less: the initial rotor position is being detected by
+                          *  pulse injection before the rev-up. */
   CHARGE_BOOT_CAP = 16, /**< The gate driver boot capacitors are being charged. */
   OFFSET_CALIB = 17,    /**< The offset of motor currents and voltages measurement cirtcuitry
                           *  are being calibrated. */
@@ -112,8 +114,11 @@ typedef enum
                           * acknowledges the faults (in which case it goes to the #IDLE state).
                           */
   WAIT_STOP_MOTOR = 20,  /**< Temporisation to make sure the motor is stopped. */
-  OTF_DETECTION = 21,  /**< Temporisation to make sure the motor is stopped. */
-  OTF_BRAKE = 22  /**< Temporisation to make sure the motor is stopped. */
+  OTF_DETECTION = 21,  /**< The rotor is observed with null currents to catch it on the fly
+                         *  if it is already spinning. */
+  OTF_BRAKE = 22, /**< Temporisation to make sure the motor is stopped. */
+  PROFILE = 23    /**< The motor parameters are measured and the drive tuned on them
+                    *  by the self commissioning procedure. */
 } MCI_State_t;
 
 /**
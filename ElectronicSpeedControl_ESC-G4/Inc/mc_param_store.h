@@ -0,0 +1,165 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_param_store.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Parameter Store component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup ParamStore
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MC_PARAM_STORE_H
+#define MC_PARAM_STORE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "flash_records.h"
+#include "pid_regulator.h"
+#include "speed_torq_ctrl.h"
+#include "revup_ctrl.h"
+#include "pwm_curr_fdbk.h"
+#include "mc_interface.h"
+#include "mp_self_com_ctrl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup ParamStore
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Layout version of #PST_Data_t, to be incremented when the layout changes */
+#define PST_VERSION                 1U
+
+/* Flash slot of a parameter block, rounded up to the flash program unit */
+#define PST_SLOT_SIZE               ((uint16_t)((sizeof(FREC_Header_t) + sizeof(PST_Data_t) + 7U) & ~7U))
+
+/* Commands of PST_CMD, first byte of the MCP payload */
+#define PST_CMD_READ                0U  /*!< Returns the block */
+#define PST_CMD_WRITE               1U  /*!< Applies the block that follows the version, in IDLE */
+#define PST_CMD_CAPTURE             2U  /*!< Copies the running parameters to the block */
+#define PST_CMD_COMMIT              3U  /*!< Appends the block to the flash from the background task, in IDLE */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Rev-up phase of the parameter block.
+  */
+typedef struct
+{
+  uint16_t hDurationms;           /*!< Duration of the phase, ms */
+  int16_t hFinalMecSpeedUnit;     /*!< Speed at the end of the phase, #SPEED_UNIT */
+  int16_t hFinalTorque;           /*!< Torque at the end of the phase, digit */
+  uint16_t hReserved;
+} PST_RevUpPhase_t;
+
+/**
+  * @brief  Parameter block, also the MCP payload of the read and write commands.
+  */
+typedef struct
+{
+  int16_t hIqKp;                                   /*!< Current and speed regulator gains, the divisors */
+  int16_t hIqKi;                                   /*!< being the built-in ones */
+  int16_t hIdKp;
+  int16_t hIdKi;
+  int16_t hSpeedKp;
+  int16_t hSpeedKi;
+  uint16_t hMaxAppPositiveMecSpeedUnit;            /*!< Speed and torque limits of the speed and torque control */
+  int16_t hMinAppNegativeMecSpeedUnit;
+  uint16_t hMaxPositiveTorque;
+  int16_t hMinNegativeTorque;
+  PST_RevUpPhase_t RevUp[RUC_MAX_PHASE_NUMBER];    /*!< Rev-up sequence */
+  float fRs;                                       /*!< Stator resistance, Ohm */
+  float fLs;                                       /*!< Stator inductance, H */
+  float fKe;                                       /*!< Bemf constant, Vrms ph-ph/kRPM */
+  PolarizationOffsets_t Offsets;                   /*!< Current reading offsets */
+  int16_t hOffsetsCelsius;                         /*!< Temperature of the offsets measurement */
+  uint8_t bOffsetsValid;                           /*!< 1 if Offsets were measured */
+  uint8_t bReserved;
+} PST_Data_t;
+
+/**
+  * @brief  Handle of the Parameter Store component
+  */
+typedef struct
+{
+  FREC_Handle_t Records;          /*!< Flash records holding the blocks */
+  PST_Data_t Data;                /*!< Running block, written to the flash by PST_Commit */
+  PID_Handle_t *pPIDIq;
+  PID_Handle_t *pPIDId;
+  PID_Handle_t *pPIDSpeed;
+  SpeednTorqCtrl_Handle_t *pSTC;
+  RevUpCtrl_Handle_t *pRevupCtrl;
+  SCC_Handle_t *pSCC;             /*!< Holds the motor model, MC_NULL without self commissioning */
+  MCI_Handle_t *pMCI;
+  int16_t hOffsetsMaxDrift;       /*!< Stored offsets are used up to this temperature change, Celsius */
+  bool bLoaded;                   /*!< A block was read from the flash at boot */
+  volatile bool bCommitRequest;   /*!< Commit requested, executed by the background task */
+  uint16_t hWriteErrors;          /*!< Commits that could not be written */
+} PST_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Reads the parameter block from the flash and applies it to the component defaults */
+bool PST_Load(PST_Handle_t *pHandle);
+
+/* Completes the load on the initialized components */
+void PST_Init(PST_Handle_t *pHandle);
+
+/* Copies the running parameters to the block */
+void PST_Capture(PST_Handle_t *pHandle);
+
+/* Appends the block to the flash */
+bool PST_Commit(PST_Handle_t *pHandle);
+
+/* Requests the block to be appended to the flash by the background task */
+void PST_RequestCommit(PST_Handle_t *pHandle);
+
+/* Executes the commit requests */
+void PST_BackgroundTask(PST_Handle_t *pHandle);
+
+/* Returns the stored offsets if they were measured at about the present temperature */
+bool PST_GetOffsets(PST_Handle_t *pHandle, int16_t hCelsius, PolarizationOffsets_t *pOffsets);
+
+/* Records offsets just measured */
+void PST_SetOffsets(PST_Handle_t *pHandle, const PolarizationOffsets_t *pOffsets, int16_t hCelsius);
+
+/* Executes a parameter store command received by the MCP */
+uint8_t PST_CMD(PST_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace,
+                uint16_t *txLength, uint8_t *txBuffer);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* MC_PARAM_STORE_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
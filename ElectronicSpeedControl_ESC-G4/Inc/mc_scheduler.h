@@ -0,0 +1,152 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_scheduler.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Task Scheduler component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup TaskScheduler
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MC_SCHEDULER_H
+#define MC_SCHEDULER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup TaskScheduler
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Task body, run to completion.
+  */
+typedef void (*SCHED_TaskFct_t)(void);
+
+/**
+  * @brief  Execution context of a task.
+  */
+typedef enum
+{
+  SCHED_TICK = 0,                 /*!< Run in the tick interrupt, right after the release */
+  SCHED_DEFERRED                  /*!< Run in the PendSV exception, preempted by the tick and the control interrupts */
+} SCHED_Context_t;
+
+/**
+  * @brief  Task definition, constant.
+  */
+typedef struct
+{
+  SCHED_TaskFct_t pFct;           /*!< Task body */
+  uint16_t hPeriod;               /*!< Ticks between two releases, 0 for a task released by SCHED_Trigger only */
+  uint16_t hPhase;                /*!< Tick of the first release, lower than hPeriod */
+  uint16_t hDeadlineUs;           /*!< Completion time allowed after the release, us */
+  uint8_t bPriority;              /*!< Order among the ready tasks of a context, 0 the highest */
+  SCHED_Context_t Context;
+} SCHED_Task_t;
+
+/**
+  * @brief  Task state and statistics.
+  *
+  * A counter is only written by one context: hReleases by the tick, hStarts by the context of the task.
+  */
+typedef struct
+{
+  uint32_t wReleaseCycles;        /*!< Cycle counter at the last release */
+  uint32_t wRuns;                 /*!< Completed jobs */
+  uint32_t wOverruns;             /*!< Releases while the previous job was still pending or running */
+  uint32_t wDeadlineMisses;       /*!< Jobs completed after their deadline */
+  uint32_t wMaxExecCycles;        /*!< Longest job, preemptions included */
+  uint32_t wMaxResponseCycles;    /*!< Longest time from a release to the end of its job */
+  volatile uint16_t hReleases;    /*!< Jobs released, a job is pending while it differs from hStarts */
+  volatile uint16_t hStarts;      /*!< Jobs started */
+  uint16_t hCountdown;            /*!< Ticks to the next release */
+  volatile bool bRunning;
+} SCHED_TaskState_t;
+
+/**
+  * @brief  Handle of the Task Scheduler component
+  */
+typedef struct
+{
+  const SCHED_Task_t *pTasks;     /*!< Task table */
+  SCHED_TaskState_t *pStates;     /*!< One state per task */
+  uint8_t bTaskNbr;
+  uint32_t wCyclesPerUs;          /*!< Set by SCHED_Init from the core clock */
+  volatile uint32_t wTick;        /*!< Ticks since SCHED_Init */
+} SCHED_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Task Scheduler component and the cycle counter */
+void SCHED_Init(SCHED_Handle_t *pHandle);
+
+/* Releases the periodic tasks and runs the tick tasks, to be called by the tick interrupt */
+void SCHED_Tick(SCHED_Handle_t *pHandle);
+
+/* Releases a task out of its period, to be called at the tick interrupt priority */
+void SCHED_Trigger(SCHED_Handle_t *pHandle, uint8_t bTask);
+
+/* Runs the deferred tasks, to be called by the PendSV exception */
+void SCHED_RunDeferred(SCHED_Handle_t *pHandle);
+
+/* Clears the statistics of the tasks */
+void SCHED_ClearStats(SCHED_Handle_t *pHandle);
+
+/**
+  * @brief  Returns the ticks elapsed since SCHED_Init.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  */
+static inline uint32_t SCHED_GetTick(const SCHED_Handle_t *pHandle)
+{
+  return (pHandle->wTick);
+}
+
+/**
+  * @brief  Returns true when a job of the task is released and not yet started.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  * @param  bTask: index of the task in the table.
+  */
+static inline bool SCHED_IsPending(const SCHED_Handle_t *pHandle, uint8_t bTask)
+{
+  return (pHandle->pStates[bTask].hReleases != pHandle->pStates[bTask].hStarts);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* MC_SCHEDULER_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
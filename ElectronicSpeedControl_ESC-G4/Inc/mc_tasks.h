@@ -24,6 +24,7 @@
 #define MCTASKS_H
 
 /* Includes ------------------------------------------------------------------*/
+#include "mc_scheduler.h"
 #include "mc_parameters.h"
 
 #ifdef __cplusplus
@@ -55,6 +56,24 @@ void MC_RunMotorControlTasks(void);
 /* Executes the Medium Frequency Task functions for each drive instance */
 void MC_Scheduler(void);
 
+/* Scheduler of the Motor Control tasks, its task states holding their timing statistics */
+extern SCHED_Handle_t MCTaskScheduler;
+
+/* Runs the Motor Control tasks deferred by the scheduler, from the PendSV exception */
+void MC_RunDeferredTasks(void);
+
+/* Runs the Safety Task out of its period */
+void MC_TriggerSafetyTask(void);
+
+/* Releases the Motor Control Protocol task, on a packet received */
+void MC_TriggerMCPTask(void);
+
+/* Runs the Motor Control tasks that are not time critical, from the main loop */
+void MC_RunBackgroundTasks(void);
+
+/* Processes the packets received by the Motor Control Protocol */
+void TSK_MCPTask(void);
+
 /* Executes safety checks (e.g. bus voltage and temperature) for all drive instances */
 void TSK_SafetyTask(void);
 
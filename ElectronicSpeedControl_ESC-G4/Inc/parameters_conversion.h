@@ -75,6 +75,9 @@
 /* max phase voltage, 0-peak Volts*/
 #define MAX_VOLTAGE                         (int16_t)((ADC_REFERENCE_VOLTAGE / SQRT_3) / VBUS_PARTITIONING_FACTOR)
 #define MAX_CURRENT                         (ADC_REFERENCE_VOLTAGE / (2 * RSHUNT * AMPLIFICATION_GAIN))
+/* Per unit scales of the flux observer and of the resistance estimation */
+#define FULL_SCALE_VOLTAGE_V                ((ADC_REFERENCE_VOLTAGE / SQRT_3) / VBUS_PARTITIONING_FACTOR)
+#define FULL_SCALE_FREQ_HZ                  ((1.5 * MAX_APPLICATION_SPEED_RPM * POLE_PAIR_NUM) / 60.0)
 #define OBS_MINIMUM_SPEED_UNIT              (uint16_t)((OBS_MINIMUM_SPEED_RPM * SPEED_UNIT) / U_RPM)
 #define MAX_APPLICATION_SPEED_UNIT          ((MAX_APPLICATION_SPEED_RPM * SPEED_UNIT) / U_RPM)
 #define MIN_APPLICATION_SPEED_UNIT          ((MIN_APPLICATION_SPEED_RPM * SPEED_UNIT) / U_RPM)
@@ -88,6 +91,33 @@
 #define C5                                  (int32_t)((((int16_t)F1) * MAX_VOLTAGE)\
                                             / (LS * MAX_CURRENT * TF_REGULATION_RATE))
 #define PERCENTAGE_FACTOR                   (uint16_t)(VARIANCE_THRESHOLD*128u)
+
+/* Observer gains placing the discrete poles of the observer error dynamics in pA and pB.
+   STO_GAIN1(pA, pB) = F1 x (pA + pB - 2 + Rs x Ts / Ls)
+   STO_GAIN2(pA, pB) = F2 x (1 - pA) x (1 - pB) / (C3 / F1) */
+#define STO_GAIN1(pA, pB)                   (int16_t)(F1 * ((pA) + (pB) - 2.0 + (RS / (LS * TF_REGULATION_RATE))))
+#define STO_GAIN2(pA, pB)                   (int16_t)((F2 * (1.0 - (pA)) * (1.0 - (pB)) * LS * MAX_CURRENT\
+                                            * TF_REGULATION_RATE) / MAX_BEMF_VOLTAGE)
+/* The PLL loop gain grows with the Bemf amplitude, PLL gains are scaled by the inverse of the speed above
+   STO_GS_SPEED1_RPM to keep the PLL bandwidth constant */
+#define STO_GS_PLL_GAIN(gain, rpm)          (int16_t)(((int32_t)(gain) * STO_GS_SPEED1_RPM) / (rpm))
+#define STO_GS_SPEED1_UNIT                  (uint16_t)((STO_GS_SPEED1_RPM * SPEED_UNIT) / U_RPM)
+#define STO_GS_SPEED2_UNIT                  (uint16_t)((STO_GS_SPEED2_RPM * SPEED_UNIT) / U_RPM)
+#define STO_GS_SPEED3_UNIT                  (uint16_t)((STO_GS_SPEED3_RPM * SPEED_UNIT) / U_RPM)
+#define STO_GAIN_SCHED_SIZE                 3U
+#define HFI_INJECTION_VOLTAGE               (int16_t)((HFI_INJECTION_VOLTAGE_V * 32767.0 * SQRT_3) / NOMINAL_BUS_VOLTAGE_V)
+#define HFI_CROSSOVER_LOW_UNIT              (uint16_t)((HFI_CROSSOVER_LOW_RPM * SPEED_UNIT) / U_RPM)
+#define HFI_CROSSOVER_HIGH_UNIT             (uint16_t)((HFI_CROSSOVER_HIGH_RPM * SPEED_UNIT) / U_RPM)
+/* Rotor flux, Wb peak, from the line to line rms voltage constant */
+#define HSO_FLUX_WB                         ((MOTOR_VOLTAGE_CONSTANT * SQRT_2 / SQRT_3)\
+                                            / ((1000.0 / 60.0) * 2.0 * 3.1416 * POLE_PAIR_NUM))
+/* Electrical speed in dpp to frequency in fixp30 per unit of FULL_SCALE_FREQ_HZ */
+#define RS_EST_DPP_TO_FREQ_PU               (int32_t)((16384.0 * TF_REGULATION_RATE) / FULL_SCALE_FREQ_HZ)
+/* Mean phase voltage error of the dead time, per volt of bus voltage, and in s16 of the phase voltage */
+#define RS_EST_DEADTIME_RATIO               ((DEADTIME_NS * (double)PWM_FREQUENCY) / 1.0e9)
+#define RS_EST_DEADTIME_S16                 (int32_t)(RS_EST_DEADTIME_RATIO * SQRT_3 * 32768.0)
+/* Least load current of the estimation, s16A: the injection alone takes the phase currents through zero */
+#define RS_EST_MIN_LOAD_S16                 (int16_t)(RS_EST_INJECTION_CURRENT_A * CURRENT_CONV_FACTOR)
 #define HFI_MINIMUM_SPEED                   (uint16_t) (HFI_MINIMUM_SPEED_RPM/6u)
 
 #define MAX_APPLICATION_SPEED_UNIT2         ((MAX_APPLICATION_SPEED_RPM2 * SPEED_UNIT) / U_RPM)
@@ -100,6 +130,38 @@
                                             (ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR))
 #define UNDERVOLTAGE_THRESHOLD_d            (uint16_t)((UD_VOLTAGE_THRESHOLD_V * 65535) /\
                                             ((uint16_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR)))
+#define NOMINAL_BUS_VOLTAGE_d               (uint16_t)((NOMINAL_BUS_VOLTAGE_V * 65536) /\
+                                            (ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR))
+#define REGEN_VBUS_START_d                  (uint16_t)((REGEN_VBUS_START_V * 65536) /\
+                                            (ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR))
+#define REGEN_ID_MAX                        (REGEN_ID_MAX_A * CURRENT_CONV_FACTOR)
+#define THR_SPEED_MIN_UNIT                  ((THR_SPEED_MIN_RPM * SPEED_UNIT) / U_RPM)
+#define THR_SPEED_MAX_UNIT                  ((THR_SPEED_MAX_RPM * SPEED_UNIT) / U_RPM)
+#define THR_TORQUE_MAX                      (THR_TORQUE_MAX_A * CURRENT_CONV_FACTOR)
+#define THR_ARMING_TIME                     ((THR_ARMING_TIME_MS * MEDIUM_FREQUENCY_TASK_RATE) / 1000)
+#define THR_FAILSAFE_TIMEOUT                ((THR_FAILSAFE_TIMEOUT_MS * MEDIUM_FREQUENCY_TASK_RATE) / 1000)
+#define SPD_FLT_ADAPTIVE_MIN_UNIT           ((SPD_FLT_ADAPTIVE_MIN_RPM * SPEED_UNIT) / U_RPM)
+#define SPD_FLT_ADAPTIVE_MIN_POWER          (0.5 * SPD_FLT_ADAPTIVE_MIN_UNIT * SPD_FLT_ADAPTIVE_MIN_UNIT)
+#define COG_IQ_MAX                          (COG_IQ_MAX_A * CURRENT_CONV_FACTOR)
+#define COG_COMP_MAX_UNIT                   ((COG_COMP_MAX_RPM * SPEED_UNIT) / U_RPM)
+#define COG_LEARN_MIN_UNIT                  ((COG_LEARN_MIN_RPM * SPEED_UNIT) / U_RPM)
+#define COG_LEARN_MAX_UNIT                  ((COG_LEARN_MAX_RPM * SPEED_UNIT) / U_RPM)
+#define COG_SENSOR_LAG                      ((COG_SENSOR_LAG_US * (double)TF_REGULATION_RATE) / 1.0e6)
+/* Electrical acceleration of one Iq digit, s16 per current control period squared */
+#define COG_ACCEL_PER_DIGIT                 (((1.5 * POLE_PAIR_NUM * POLE_PAIR_NUM * HSO_FLUX_WB)\
+                                            / (COG_INERTIA_KGM2 * CURRENT_CONV_FACTOR)) * (65536.0 / (2.0 * 3.1416))\
+                                            / ((double)TF_REGULATION_RATE * (double)TF_REGULATION_RATE))
+/* Speed change of one Iq digit over a speed regulator period, #SPEED_UNIT */
+#define LTO_ACCEL_PER_DIGIT                 (((1.5 * POLE_PAIR_NUM * HSO_FLUX_WB) / (MOTOR_INERTIA_KGM2 * CURRENT_CONV_FACTOR))\
+                                            * ((double)SPEED_UNIT / (2.0 * 3.1416)) / (double)MEDIUM_FREQUENCY_TASK_RATE)
+#define LTO_DAMPING                         (MOTOR_FRICTION_NMS / (MOTOR_INERTIA_KGM2 * (double)MEDIUM_FREQUENCY_TASK_RATE))
+/* Windings of the deadbeat current control, s16 Vqd at the nominal bus voltage per s16 Iqd */
+#define DBC_DIGIT_PER_VOLT                  ((32767.0 * SQRT_3) / (double)NOMINAL_BUS_VOLTAGE_V)
+#define DBC_RESISTANCE                      ((RS * DBC_DIGIT_PER_VOLT) / (double)CURRENT_CONV_FACTOR)
+#define DBC_INDUCTANCE                      ((LS * (double)TF_REGULATION_RATE * DBC_DIGIT_PER_VOLT)\
+                                            / (double)CURRENT_CONV_FACTOR)
+#define DBC_EMF_PER_DPP                     (HSO_FLUX_WB * ((2.0 * 3.1416) / 65536.0) * (double)TF_REGULATION_RATE\
+                                            * DBC_DIGIT_PER_VOLT)
 #define INT_SUPPLY_VOLTAGE                  (uint16_t)(65536 / ADC_REFERENCE_VOLTAGE)
 #define DELTA_TEMP_THRESHOLD                (OV_TEMPERATURE_THRESHOLD_C - T0_C)
 #define DELTA_V_THRESHOLD                   (dV_dT * DELTA_TEMP_THRESHOLD)
@@ -39,6 +39,8 @@
 /*************************  IRQ Handler Mapping  *********************/
 #define TIMx_UP_M1_IRQHandler            TIM1_UP_TIM16_IRQHandler
 #define TIMx_BRK_M1_IRQHandler           TIM1_BRK_TIM15_IRQHandler
+#define THR_TLM_TIM_IRQHandler           TIM4_IRQHandler
+#define THR_TLM_DMA_IRQHandler           DMA1_Channel5_IRQHandler
 
 #define ADC_TRIG_CONV_LATENCY_CYCLES     3.5
 #define ADC_SAR_CYCLES                   12.5
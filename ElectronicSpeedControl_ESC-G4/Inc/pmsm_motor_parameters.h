@@ -47,6 +47,12 @@
 
 #define ID_DEMAG_A              -10 /*!< Demagnetization current */
 
+/***************** MOTOR MECHANICAL PARAMETERS  ******************************/
+#define MOTOR_INERTIA_KGM2      2.0e-5 /*!< Rotor and propeller, kg.m^2 */
+#define MOTOR_FRICTION_NMS      2.0e-6 /*!< Viscous friction, N.m.s/rad.
+                                            The aerodynamic torque of the
+                                            propeller is estimated as load */
+
 /***************** MOTOR SENSORS PARAMETERS  ******************************/
 /* Motor sensors parameters are always generated but really meaningful only
    if the corresponding sensor is actually present in the motor         */
@@ -0,0 +1,125 @@
+
+/**
+  ******************************************************************************
+  * @file    regen_limiter.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Regenerative Braking Limiter component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup RegenLimiter
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef REGEN_LIMITER_H
+#define REGEN_LIMITER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "pid_regulator.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup RegenLimiter
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Handle of the Regenerative Braking Limiter component
+  */
+typedef struct
+{
+  PID_Handle_t *pPIRegen;         /*!< Bus voltage regulator, its output is the regenerative current in excess, digit */
+  PID_Handle_t *pPISpeed;         /*!< Speed regulator, its output limits follow the regenerative current allowed */
+  uint16_t hVbusStart_d;          /*!< Bus voltage above which the regeneration is limited, u16Volt */
+  int16_t hIdBrakeMax;            /*!< Largest Id injected to dissipate the braking energy in the windings, digit */
+  int16_t hIqRegenMax;            /*!< Regenerative Iq allowed when the bus voltage is below hVbusStart_d, digit */
+  int16_t hSpeedUpperLimit;       /*!< Output limits of the speed regulator, saved by REGEN_Init */
+  int16_t hSpeedLowerLimit;
+  int32_t wSpeedUpperIntegralLimit; /*!< Integral term limits of the speed regulator, saved by REGEN_Init */
+  int32_t wSpeedLowerIntegralLimit;
+  int16_t hIdBrake;               /*!< Id added to the reference, null or negative, digit */
+  int16_t hIqLimit;               /*!< Largest magnitude of the regenerative Iq, digit */
+  int8_t bSpeedSign;              /*!< Direction of the rotation, 0 at standstill */
+} REGEN_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Regenerative Braking Limiter component */
+void REGEN_Init(REGEN_Handle_t *pHandle);
+
+/* Releases the limits, to be called when the drive stops */
+void REGEN_Clear(REGEN_Handle_t *pHandle);
+
+/* Computes the regenerative current limit and the braking Id from the bus voltage */
+void REGEN_CalcLimits(REGEN_Handle_t *pHandle, uint16_t hVbus_d, int16_t hIqref);
+
+/* Updates the direction of the rotation and the speed regulator output limits */
+void REGEN_SetSpeedLimits(REGEN_Handle_t *pHandle, int16_t hMecSpeedUnit);
+
+/**
+  * @brief  Returns the Iq reference with its regenerative part limited.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  * @param  hIqref: Iq reference, digit.
+  */
+static inline int16_t REGEN_LimitIq(const REGEN_Handle_t *pHandle, int16_t hIqref)
+{
+  int16_t hIq = hIqref;
+
+  if ((pHandle->bSpeedSign > 0) && (hIq < -pHandle->hIqLimit))
+  {
+    hIq = -pHandle->hIqLimit;
+  }
+  else if ((pHandle->bSpeedSign < 0) && (hIq > pHandle->hIqLimit))
+  {
+    hIq = pHandle->hIqLimit;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (hIq);
+}
+
+/**
+  * @brief  Returns the Id to add to the reference, null or negative, digit.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  */
+static inline int16_t REGEN_GetIdBrake(const REGEN_Handle_t *pHandle)
+{
+  return (pHandle->hIdBrake);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* REGEN_LIMITER_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
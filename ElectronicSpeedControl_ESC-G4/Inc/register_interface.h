@@ -89,6 +89,10 @@
 #define  MC_REG_OPENLOOP_SENSING         ((35U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_IPD_ENABLE               ((36U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_IPD_DEBUG                ((37U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_COGGING_MODE             ((38U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_ANOMALY_FLAG             ((39U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_LOAD_FEEDFORWARD         ((40U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_CURRENT_DEADBEAT         ((41U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 
 /* TYPE_DATA_16BIT registers definition */
 #define  MC_REG_SPEED_KP                 ((2U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
@@ -198,6 +202,15 @@
 #define  MC_REG_IPD_VSTR                 ((114U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
 #define  MC_REG_OPENLOOP_EL_ANGLE        ((115U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
 #define  MC_REG_IPD_VSTPTR               ((116U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_WINDING_TEMP             ((117U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_SPEED_NOTCH_FREQ         ((118U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_COGGING_ITERATIONS       ((119U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_VIB_SPEED                ((120U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_VIB_HARMONIC_1           ((121U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_VIB_HARMONIC_2           ((122U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_VIB_HARMONIC_N           ((123U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_ANOMALY_SCORE            ((124U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_LOAD_TORQUE              ((125U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
 
 /* TYPE_DATA_32BIT registers definition */
 #define  MC_REG_FAULTS_FLAGS             ((0 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
@@ -230,6 +243,10 @@
 #define  MC_REG_RESISTOR_OFFSET          ((116 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 
 #define  MC_REG_MOTOR_POWER              ((109 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_VIB_CYCLES               ((117 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_ANOMALY_CYCLES           ((118 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_CURRENT_CTRL_CYCLES      ((119 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_DEADBEAT_FALLBACKS       ((120 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 
 #define  MC_REG_FW_NAME                  ((0U << ELT_IDENTIFIER_POS) | TYPE_DATA_STRING)
 #define  MC_REG_CTRL_STAGE_NAME          ((1U << ELT_IDENTIFIER_POS) | TYPE_DATA_STRING)
@@ -246,6 +263,7 @@
 #define  MC_REG_REVUP_DATA               ((8U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW) /* Configure all steps*/
 #define  MC_REG_CURRENT_REF              ((13U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_POSITION_RAMP            ((14U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_SPEED_FILTER             ((15U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW) /* Biquads of the speed loop */
 #define  MC_REG_ASYNC_UARTA              ((20U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_ASYNC_UARTB              ((21U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_ASYNC_STLNK              ((22U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
@@ -267,6 +285,12 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t * data, uin
 
 uint8_t RI_GetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t * data, uint16_t *size, int16_t freeSpace);
 
+#if (NBR_OF_MOTORS > 1)
+uint8_t RI_SetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable);
+
+uint8_t RI_GetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace);
+#endif
+
 uint8_t RI_MovString(const char_t * srcString, char_t * destString, uint16_t *size, int16_t maxSize);
 
 uint8_t HF_GetPtrReg(uint16_t dataID, void **dataPtr);
@@ -29,6 +29,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "mc_type.h"
+#include "drive_parameters.h"
 
 /** @addtogroup MCSDK
   * @{
@@ -57,6 +58,27 @@ typedef struct
 
 typedef void (*RCM_exec_cb_t)(RegConv_t *regConv, uint16_t data, void *UserData);
 
+/* Exported defines ----------------------------------------------------------*/
+/**
+  * @brief Number of regular conversion allowed By default.
+  *
+  * In single drive configuration, it is defined to 4. 2 of them are consumed by
+  * Bus voltage and temperature reading. This leaves 2 handles available for
+  * user conversions
+  *
+  * In dual drives configuration, it is defined to 6. 2 of them are consumed by
+  * Bus voltage and temperature reading for each motor. This leaves 2 handles
+  * available for user conversion.
+  *
+  * Defined to 4 here.
+  */
+#define RCM_MAX_CONV  4U
+
+#if (RCM_DMA_ENABLE == 1)
+/* Results of the scanned conversions, written by the DMA, indexed by RegConv_t id */
+extern volatile uint16_t RCM_DMABuffer[RCM_MAX_CONV];
+#endif
+
 /* Exported functions ------------------------------------------------------- */
 
 /*  Function used to register a regular conversion */
@@ -74,11 +96,19 @@ uint16_t RCM_ExecRegularConv(RegConv_t *regConv);
 /* This function is used to read the result of a regular conversion stored in the data structure. */
 static inline uint16_t RCM_GetRegularConv(const RegConv_t *regConv)
 {
+#if (RCM_DMA_ENABLE == 1)
+#ifdef NULL_PTR_CHECK_REG_CON_MNG
+  return ((MC_NULL == regConv) ? 0U : RCM_DMABuffer[regConv->id]);
+#else
+  return (RCM_DMABuffer[regConv->id]);
+#endif
+#else
 #ifdef NULL_PTR_CHECK_REG_CON_MNG
   return ((MC_NULL == regConv) ? 0U : regConv->data);
 #else
   return (regConv->data);
 #endif
+#endif
 }
 
 /* This function is used to wait for a the result of a regular conversion. */
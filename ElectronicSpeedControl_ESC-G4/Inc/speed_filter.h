@@ -0,0 +1,154 @@
+
+/**
+  ******************************************************************************
+  * @file    speed_filter.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Speed Loop Filter component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup SpeedFilter
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SPEED_FILTER_H
+#define SPEED_FILTER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "arm_math.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeedFilter
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Biquads of each chain, the unused ones pass their input */
+#define SPDFLT_STAGE_NBR            3U
+
+/* Coefficients of a biquad, in the order of CMSIS-DSP: b0, b1, b2, a1, a2, the a coefficients negated */
+#define SPDFLT_COEFF_NBR            5U
+
+/* Stage of the speed chain written by the adaptive notch, when enabled */
+#define SPDFLT_ADAPTIVE_STAGE       0U
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Filter chains of the Speed Loop Filter component.
+  */
+typedef enum
+{
+  SPDFLT_SPEED = 0,               /*!< Speed feedback of the speed regulator */
+  SPDFLT_TORQUE,                  /*!< Torque reference output by the speed regulator */
+  SPDFLT_CHAIN_NBR
+} SPDFLT_Chain_t;
+
+/**
+  * @brief  Cascade of biquads.
+  */
+typedef struct
+{
+  arm_biquad_cascade_df2T_instance_f32 Cascade;
+  float_t fCoeffs[SPDFLT_STAGE_NBR * SPDFLT_COEFF_NBR];
+  float_t fState[SPDFLT_STAGE_NBR * 2U];
+  bool bPrimed;                   /*!< The state holds the steady state of the last input */
+} SPDFLT_Cascade_t;
+
+/**
+  * @brief  Handle of the Speed Loop Filter component
+  */
+typedef struct
+{
+  float_t fSamplingFreq_Hz;       /*!< Rate of the speed regulator */
+  float_t fSpeedNotch_Hz;         /*!< Fixed notch of the speed feedback, 0 if none */
+  float_t fSpeedLowPass_Hz;       /*!< Low pass of the speed feedback, 0 if none */
+  float_t fTorqueLowPass_Hz;      /*!< Low pass of the torque reference, 0 if none */
+  float_t fNotchQ;                /*!< Quality factor of the notches, centre frequency over the -3 dB width */
+  bool bAdaptive;                 /*!< Notch following the dominant vibration of the speed */
+  float_t fAdaptMin_Hz;           /*!< Range of the frequencies followed */
+  float_t fAdaptMax_Hz;
+  float_t fAdaptMinPower;         /*!< Vibration power below which the notch is released, #SPEED_UNIT squared */
+  float_t fAdaptStep;             /*!< Normalized adaptation gain */
+  SPDFLT_Cascade_t Chain[SPDFLT_CHAIN_NBR];
+  float_t fPending[SPDFLT_COEFF_NBR]; /*!< Coefficients written by the Motor Control Protocol */
+  volatile uint8_t bPendingStage; /*!< 1 + index of the stage to write, 0 if none */
+  float_t fHighPassPole;          /*!< Removes the mean speed from the adaptation */
+  float_t fHighPassIn;
+  float_t fHighPassOut;
+  float_t fA;                     /*!< Parameter of the adaptive notch, -2.cos(w) */
+  float_t fAMin;
+  float_t fAMax;
+  float_t fS1;                    /*!< States of the adaptive notch */
+  float_t fS2;
+  float_t fPowerS;                /*!< Mean powers of the state, of the input and of the notch output */
+  float_t fPowerIn;
+  float_t fPowerOut;
+  bool bLocked;                   /*!< The notch removes the dominant vibration */
+} SPDFLT_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Speed Loop Filter component */
+void SPDFLT_Init(SPDFLT_Handle_t *pHandle);
+
+/* Restarts the filters from the next samples, to be called when the drive stops */
+void SPDFLT_Clear(SPDFLT_Handle_t *pHandle);
+
+/* Filters the speed feedback, to be called once per speed regulator period */
+int16_t SPDFLT_FilterSpeed(SPDFLT_Handle_t *pHandle, int16_t hMecSpeedUnit);
+
+/* Filters the torque reference, to be called once per speed regulator period */
+int16_t SPDFLT_FilterTorque(SPDFLT_Handle_t *pHandle, int16_t hTorqueRef);
+
+/* Writes the coefficients of a biquad, applied by the next speed regulator period */
+bool SPDFLT_SetCoefficients(SPDFLT_Handle_t *pHandle, SPDFLT_Chain_t Chain, uint8_t bStage,
+                            const float_t *pCoeffs);
+
+/* Reads the coefficients of a biquad */
+bool SPDFLT_GetCoefficients(const SPDFLT_Handle_t *pHandle, SPDFLT_Chain_t Chain, uint8_t bStage,
+                            float_t *pCoeffs);
+
+/* Designs a notch biquad */
+void SPDFLT_DesignNotch(float_t *pCoeffs, float_t fFreq_Hz, float_t fQ, float_t fSamplingFreq_Hz);
+
+/* Designs a second order Butterworth low pass biquad */
+void SPDFLT_DesignLowPass(float_t *pCoeffs, float_t fFreq_Hz, float_t fSamplingFreq_Hz);
+
+/* Returns the frequency of the adaptive notch, Hz, 0 when it is released */
+float_t SPDFLT_GetNotchFrequency(const SPDFLT_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* SPEED_FILTER_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
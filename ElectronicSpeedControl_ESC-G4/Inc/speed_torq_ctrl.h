@@ -32,6 +32,8 @@ extern "C" {
 #include "mc_type.h"
 #include "pid_regulator.h"
 #include "speed_pos_fdbk.h"
+#include "speed_filter.h"
+#include "load_torque_observer.h"
 
 /** @addtogroup MCSDK
   * @{
@@ -86,6 +88,10 @@ typedef struct
   int16_t TorqueRefDefault;            /*!< Default motor torque reference. This value represents actually the Iq
                                             current reference expressed in digit. */
   int16_t IdrefDefault;                /*!< Default Id current reference expressed in digit. */
+  SPDFLT_Handle_t *SpeedFilter;        /*!< Filters of the speed feedback and of the torque reference of the speed
+                                            loop, MC_NULL if not used. */
+  LTO_Handle_t *LoadObserver;          /*!< Load torque observer feeding forward the output of the speed
+                                            regulator, MC_NULL if not used. */
 } SpeednTorqCtrl_Handle_t;
 
 /* Initializes all the object variables */
@@ -0,0 +1,209 @@
+
+/**
+  ******************************************************************************
+  * @file    throttle_input.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Throttle Input component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup ThrottleInput
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef THROTTLE_INPUT_H
+#define THROTTLE_INPUT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "mc_interface.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup ThrottleInput
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Edges kept by the DMA, two DShot frames of 32 edges and the partial frame being received */
+#define THR_EDGE_NBR                128U
+
+/* Throttle full scale, the DShot throttle steps */
+#define THR_FULL_SCALE              2000U
+
+/* DShot frame: 11 bits of throttle or command, telemetry request, 4 bits of CRC */
+#define THR_DSHOT_BITS              16U
+#define THR_DSHOT_CMD_MAX           47U   /*!< Values 1 to 47 are commands, 48 to 2047 the throttle */
+
+/* Decoding results of THR_DecodeDShot(), the frames are positive */
+#define THR_NO_FRAME                (-1)
+#define THR_BAD_FRAME               (-2)
+
+/* Bidirectional DShot reply: a start bit and 20 bits of GCR, 12 bits of value and a 4 bits CRC */
+#define THR_TLM_BITS                21U
+#define THR_TLM_PAD_MAX             32U   /*!< Idle bits of the turnaround written before the reply */
+#define THR_TLM_SLOTS               4U    /*!< eRPM, then the temperature, voltage and current frames */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Protocols of the throttle input.
+  */
+typedef enum
+{
+  THR_PWM = 0,                    /*!< Servo pulses, the width gives the throttle */
+  THR_DSHOT                       /*!< DShot150, DShot300 or DShot600, the bit rate is measured on each frame */
+} THR_Protocol_t;
+
+/**
+  * @brief  States of the Throttle Input component.
+  */
+typedef enum
+{
+  THR_DISARMED = 0,               /*!< The motor is not started, a null throttle arms */
+  THR_ARMED,                      /*!< A throttle starts the motor */
+  THR_RUNNING                     /*!< The throttle drives the motor */
+} THR_State_t;
+
+/**
+  * @brief  DShot frame found by THR_DecodeDShot().
+  */
+typedef struct
+{
+  uint32_t wStart;                /*!< Timestamp of the first edge, timer ticks */
+  uint32_t wBitPeriod;            /*!< Bit period measured, timer ticks */
+  bool bInverted;                 /*!< Inverted CRC of the bidirectional DShot */
+} THR_Frame_t;
+
+/**
+  * @brief  Handle of the Throttle Input component
+  */
+typedef struct
+{
+  TIM_TypeDef *TIMx;              /*!< 32 bits timer capturing the signal on its channel 1 */
+  DMA_TypeDef *DMAx;              /*!< DMA of the DShot edges */
+  uint32_t wDMAChannel;
+  uint32_t wDMARequest;           /*!< DMAMUX request of the capture of the channel 1 */
+  MCI_Handle_t *pMCI;
+  THR_Protocol_t Protocol;
+  MC_ControlMode_t ControlMode;   /*!< MCM_SPEED_MODE or MCM_TORQUE_MODE */
+  uint16_t hTicksPerUs;           /*!< Timer clock, MHz */
+  uint16_t hPulseMin;             /*!< PWM pulse of the null throttle, us */
+  uint16_t hPulseMax;             /*!< PWM pulse of the full throttle, us */
+  uint16_t hGapMin;               /*!< Low level separating two DShot frames, us */
+  uint16_t hArmingTime;           /*!< Null throttle received before the arming, medium frequency periods */
+  uint16_t hFailsafeTime;         /*!< Time without a valid throttle before the motor is stopped, medium frequency periods */
+  int16_t hSpeedMin;              /*!< Speed of the smallest throttle, #SPEED_UNIT */
+  int16_t hSpeedMax;              /*!< Speed of the full throttle, #SPEED_UNIT */
+  int16_t hTorqueMax;             /*!< Iq of the full throttle, digit */
+  uint16_t hRampDuration;         /*!< Ramp to a new throttle, ms */
+  bool bTelemetry;                /*!< Replies the telemetry to the bidirectional DShot frames */
+  TIM_TypeDef *TLM_TIMx;          /*!< 16 bits timer reset by the edges captured, then pacing the reply bits */
+  uint32_t wTlmDMAChannel;        /*!< DMA channel of the reply, on DMAx */
+  uint32_t wTlmDMARequest;        /*!< DMAMUX request of the update of TLM_TIMx */
+  uint32_t wTlmTrigger;           /*!< Internal trigger of TLM_TIMx from TIMx */
+  GPIO_TypeDef *GPIOx;            /*!< Port of the throttle pin, driven during the reply */
+  uint32_t wPin;                  /*!< LL_GPIO_PIN_x of the throttle pin */
+  uint16_t hTurnaround;           /*!< Delay between the end of a frame and its reply, us */
+  uint16_t hPolePairs;
+  volatile uint32_t wEdges[THR_EDGE_NBR]; /*!< Edge timestamps written by the DMA */
+  uint32_t wLastStart;            /*!< Timestamp of the last DShot frame decoded */
+  uint16_t hThrottle;             /*!< Last valid throttle, 0 to #THR_FULL_SCALE */
+  int16_t hTarget;                /*!< Last ramp target sent to the motor */
+  uint16_t hCounter;              /*!< Arming time count */
+  uint16_t hTimeout;              /*!< Failsafe time count */
+  uint16_t hFrameErrors;          /*!< Frames rejected, counted with saturation */
+  uint8_t bCommand;               /*!< Last DShot command received, 0 if none */
+  bool bTelemetryRequest;         /*!< Telemetry bit of the last DShot frame */
+  THR_State_t State;
+  uint8_t bBidirCount;            /*!< Consecutive frames with an inverted CRC */
+  bool bBidirectional;            /*!< The flight controller expects the replies */
+  bool bExtendedTelemetry;        /*!< Extended telemetry frames interleaved, enabled by a DShot command */
+  uint16_t hReplyCount;
+  uint32_t wReplyBit;             /*!< Reply bit of the bidirectional frames decoded, timer ticks, 0 if none */
+  uint16_t hReplyWrite;           /*!< Edge written at the previous end of frame */
+  volatile uint32_t wReplies[THR_TLM_SLOTS]; /*!< Replies encoded by the medium frequency task, line levels */
+  uint32_t wTxBuffer[THR_TLM_PAD_MAX + THR_TLM_BITS + 1U]; /*!< Port set and reset words written by the DMA */
+} THR_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Throttle Input component and starts the capture */
+void THR_Init(THR_Handle_t *pHandle);
+
+/* Decodes the throttle and drives the motor, to be called by the medium frequency task */
+void THR_Task(THR_Handle_t *pHandle);
+
+/* Decodes the newest complete DShot frame of the edges captured */
+int32_t THR_DecodeDShot(const THR_Handle_t *pHandle, uint16_t hNewest, THR_Frame_t *pFrame);
+
+/* Encodes the telemetry replied to the bidirectional DShot frames, to be called by the medium frequency task */
+void THR_SetTelemetry(THR_Handle_t *pHandle, int16_t hMecSpeedUnit, int16_t hTemp_C, uint16_t hVbus_V4,
+                      uint16_t hCurrent_A);
+
+/* Encodes a 12 bits telemetry value into the line levels of the reply */
+uint32_t THR_EncodeReply(uint16_t hValue);
+
+/* Starts the reply at the end of a bidirectional DShot frame, channel 1 compare interrupt of TLM_TIMx */
+void THR_FrameEnd_IRQHandler(THR_Handle_t *pHandle);
+
+/* Releases the line at the end of the reply, transfer complete interrupt of the reply DMA */
+void THR_ReplyEnd_IRQHandler(THR_Handle_t *pHandle);
+
+/* Converts a DShot frame to the throttle and the command */
+bool THR_DShotToThrottle(THR_Handle_t *pHandle, uint16_t hFrame, uint16_t *pThrottle);
+
+/* Converts a PWM pulse to the throttle */
+bool THR_PulseToThrottle(const THR_Handle_t *pHandle, uint32_t wPulseTicks, uint32_t wPeriodTicks,
+                         uint16_t *pThrottle);
+
+/**
+  * @brief  Returns the state of the Throttle Input component.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  */
+static inline THR_State_t THR_GetState(const THR_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+/**
+  * @brief  Returns the last valid throttle, 0 to #THR_FULL_SCALE.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  */
+static inline uint16_t THR_GetThrottle(const THR_Handle_t *pHandle)
+{
+  return (pHandle->hThrottle);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* THROTTLE_INPUT_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,141 @@
+
+/**
+  ******************************************************************************
+  * @file    vibration_monitor.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Vibration Monitor component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup VibrationMonitor
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef VIBRATION_MONITOR_H
+#define VIBRATION_MONITOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "mc_interface.h"
+#include "arm_math.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup VibrationMonitor
+  * @{
+  */
+
+/* Exported defines ----------------------------------------------------------*/
+
+/* Samples of a window, 256 or 512: the FFT tables of this length only are linked */
+#define VIB_FFT_SIZE                256U
+
+/* Harmonics of the mechanical frequency measured: 1x, 2x and Nx */
+#define VIB_HARMONIC_NBR            3U
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Handle of the Vibration Monitor component
+  */
+typedef struct
+{
+  MCI_Handle_t *pMCI;             /*!< Windows captured in the RUN state only */
+  int16_t *pCapture;              /*!< #VIB_FFT_SIZE Iq samples written by the current control */
+  uint16_t hDecimation;           /*!< Current control periods averaged per sample */
+  uint16_t hPolePairs;
+  float_t fControlFreq_Hz;        /*!< Rate of the current control */
+  float_t fSpeedTolerance;        /*!< Speed variation over a window, relative, above which it is discarded */
+  uint8_t bOrders[VIB_HARMONIC_NBR]; /*!< Orders of the harmonics of the mechanical frequency */
+  arm_rfft_fast_instance_f32 Rfft;
+  volatile bool bCapturing;       /*!< The current control writes the window */
+  volatile bool bFull;            /*!< The window is complete, the background task analyses it */
+  uint16_t hIndex;                /*!< Samples of the window captured */
+  uint16_t hCount;                /*!< Current control periods of the sample */
+  int32_t wIqSum;                 /*!< Sums of the sample, digit and s16 per period */
+  int32_t wSpeedSum;
+  int32_t wSpeedTotal;            /*!< Electrical angle travelled over the window, s16 */
+  int32_t wSpeedMin;              /*!< Extreme angles travelled in a sample, s16 */
+  int32_t wSpeedMax;
+  float_t fSamples[VIB_FFT_SIZE]; /*!< Window of the analysis, then scratch of the FFT */
+  float_t fSpectrum[VIB_FFT_SIZE];
+  uint16_t hHarmonic[VIB_HARMONIC_NBR]; /*!< Iq amplitude of each harmonic, digit, 0 above the bandwidth */
+  int16_t hMecSpeedUnit;          /*!< Speed of the last window analysed, #SPEED_UNIT */
+  uint16_t hWindows;              /*!< Windows analysed */
+  uint16_t hRejected;             /*!< Windows discarded, speed varying or too low */
+  uint32_t wCycles;               /*!< Duration of the last analysis, core clock cycles, preemptions included */
+} VIB_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Vibration Monitor component */
+void VIB_Init(VIB_Handle_t *pHandle);
+
+/* Aborts the window being captured, to be called when the drive stops */
+void VIB_Clear(VIB_Handle_t *pHandle);
+
+/* Accumulates Iq and the speed into the window, to be called by the current control */
+void VIB_Capture(VIB_Handle_t *pHandle, int16_t hIq, int16_t hElSpeedDpp);
+
+/* Starts the windows and analyses them, to be called in the idle time */
+void VIB_BackgroundTask(VIB_Handle_t *pHandle);
+
+/**
+  * @brief  Returns the Iq amplitude of a harmonic of the mechanical frequency, digit.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  * @param  bHarmonic: index of the harmonic in bOrders.
+  */
+static inline uint16_t VIB_GetHarmonic(const VIB_Handle_t *pHandle, uint8_t bHarmonic)
+{
+  return ((bHarmonic < VIB_HARMONIC_NBR) ? pHandle->hHarmonic[bHarmonic] : 0U);
+}
+
+/**
+  * @brief  Returns the speed of the last window analysed, #SPEED_UNIT.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  */
+static inline int16_t VIB_GetMecSpeedUnit(const VIB_Handle_t *pHandle)
+{
+  return (pHandle->hMecSpeedUnit);
+}
+
+/**
+  * @brief  Returns the duration of the last analysis, core clock cycles.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  */
+static inline uint32_t VIB_GetCycles(const VIB_Handle_t *pHandle)
+{
+  return (pHandle->wCycles);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* VIBRATION_MONITOR_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
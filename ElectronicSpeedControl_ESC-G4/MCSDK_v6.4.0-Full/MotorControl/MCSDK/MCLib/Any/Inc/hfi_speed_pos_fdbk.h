@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file    hfi_speed_pos_fdbk.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          High Frequency Injection Speed & Position Feedback component of the
+  *          Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup HFI_SpeednPosFdbk
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HFI_SPEEDNPOSFDBK_H
+#define HFI_SPEEDNPOSFDBK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "speed_pos_fdbk.h"
+#include "pid_regulator.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @addtogroup HFI_SpeednPosFdbk
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @brief Longest half period of the injected square wave, in current control periods */
+#define HFI_MAX_HALF_PERIOD  4U
+
+/** @brief Value of HFI_Handle_t::hBlend when only the high speed sensor is used */
+#define HFI_BLEND_FULL       32767
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  This structure is used to handle an instance of the High Frequency
+  *         Injection speed and position feedback component.
+  */
+typedef struct
+{
+  SpeednPosFdbk_Handle_t _Super;
+  SpeednPosFdbk_Handle_t *pHighSpeedSensor; /*!< Back-EMF based sensor the angle is blended into at high speed */
+  PID_Handle_t PIRegulator;               /*!< PI regulator of the PLL tracking the saliency, output in
+                                               [dpp](measurement_units.md) */
+
+  int16_t hInjVoltage;                    /*!< Amplitude of the d axis square wave, in s16V */
+  uint8_t bInjHalfPeriod;                 /*!< Half period of the square wave, in current control periods,
+                                               2 to #HFI_MAX_HALF_PERIOD */
+  uint16_t hCrossoverLowUnit;             /*!< Speed above which the high speed sensor is blended in, in the
+                                               unit defined by #SPEED_UNIT */
+  uint16_t hCrossoverHighUnit;            /*!< Speed above which only the high speed sensor is used, in the
+                                               unit defined by #SPEED_UNIT */
+
+  int16_t hHFIElAngle;                    /*!< Electrical angle tracked on the saliency */
+  int16_t hHFIElSpeedDpp;                 /*!< Electrical speed tracked on the saliency, in
+                                               [dpp](measurement_units.md) */
+  int16_t hBlend;                         /*!< Weight of the high speed sensor, 0 to #HFI_BLEND_FULL */
+  int16_t hAvrElSpeedDpp;                 /*!< Low pass filtered output electrical speed */
+  uint8_t bInjCnt;                        /*!< Current control periods elapsed in the half period */
+  uint8_t bInjSignHistory;                /*!< Signs of the last injected half waves, bit 0 the latest,
+                                               bit set when negative */
+  int16_t hIqPrev;                        /*!< Iq sampled in the previous period */
+  uint8_t bAvgIndex;                      /*!< Write index of the demodulation buffers */
+  int16_t hIdBuffer[2U * HFI_MAX_HALF_PERIOD]; /*!< Id samples over one injection period */
+  int16_t hIqBuffer[2U * HFI_MAX_HALF_PERIOD]; /*!< Iq samples over one injection period */
+  int32_t wIdSum;                         /*!< Running sum of hIdBuffer */
+  int32_t wIqSum;                         /*!< Running sum of hIqBuffer */
+} HFI_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the High Frequency Injection component */
+void HFI_Init(HFI_Handle_t *pHandle);
+
+/* Clears the High Frequency Injection component state */
+void HFI_Clear(HFI_Handle_t *pHandle);
+
+/* Returns the d axis voltage to inject in the current control period */
+int16_t HFI_CalcInjection(HFI_Handle_t *pHandle);
+
+/* Tracks the saliency on the Iq response and returns the fundamental of the currents */
+qd_t HFI_Demodulate(HFI_Handle_t *pHandle, qd_t Iqd);
+
+/* Computes the rotor average mechanical speed and the blend of the high speed sensor */
+bool HFI_CalcAvrgMecSpeedUnit(HFI_Handle_t *pHandle, int16_t *pMecSpeedUnit);
+
+/* Sets the rotor mechanical angle */
+void HFI_SetMecAngle(HFI_Handle_t *pHandle, int16_t hMecAngle);
+
+/**
+  * @brief  Returns true while the d axis square wave is injected.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  */
+static inline bool HFI_IsInjecting(const HFI_Handle_t *pHandle)
+{
+  return (pHandle->hBlend < HFI_BLEND_FULL);
+}
+
+/** @} */
+/** @} */
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* HFI_SPEEDNPOSFDBK_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
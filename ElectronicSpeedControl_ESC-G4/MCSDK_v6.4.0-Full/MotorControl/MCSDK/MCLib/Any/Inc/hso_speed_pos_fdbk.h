@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file    hso_speed_pos_fdbk.h
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          High Sensitivity Observer Speed & Position Feedback component of the
+  *          Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup HSO_SpeednPosFdbk
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HSO_SPEEDNPOSFDBK_H
+#define HSO_SPEEDNPOSFDBK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "speed_pos_fdbk.h"
+#include "hso.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @addtogroup HSO_SpeednPosFdbk
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  This structure is used to handle an instance of the High Sensitivity
+  *         Observer speed and position feedback component.
+  */
+typedef struct
+{
+  SpeednPosFdbk_Handle_t _Super;
+  HSO_Obj *pHSO;                    /*!< Flux observer, word aligned */
+  const HSO_Params *pParams;        /*!< Flux observer parameters, voltages in pu of
+                                         HSO_Params::FullScaleVoltage_V, the maximum phase voltage */
+  float_t Rs;                       /*!< Stator resistance, Ohm */
+  float_t Ls;                       /*!< Stator inductance, H */
+  float_t FullScaleCurrent_A;       /*!< Current read as 32767 */
+
+  fixp30_t Kr;                      /*!< Resistive drop per pu of current, pu of voltage */
+  FIXP_scaled_t Kl;                 /*!< Inductive drop per pu of current step, pu of voltage */
+  int32_t wSpeedPuToDpp;            /*!< Frequency pu to [dpp](measurement_units.md) */
+  int32_t wSpeedPuToUnit;           /*!< Frequency pu to electrical speed in the unit defined by #SPEED_UNIT */
+  alphabeta_t IalphabetaPrev;       /*!< Currents of the previous period */
+  alphabeta_t ValphabetaPrev[2];    /*!< Voltages set in the last two periods, latest first */
+} HSO_SPD_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the High Sensitivity Observer component */
+void HSO_SPD_Init(HSO_SPD_Handle_t *pHandle);
+
+/* Clears the High Sensitivity Observer component state */
+void HSO_SPD_Clear(HSO_SPD_Handle_t *pHandle);
+
+/* Runs the flux observer and returns the rotor electrical angle */
+int16_t HSO_SPD_CalcElAngle(HSO_SPD_Handle_t *pHandle, const Observer_Inputs_t *pInputs);
+
+/* Computes the rotor average mechanical speed in the unit defined by #SPEED_UNIT */
+bool HSO_SPD_CalcAvrgMecSpeedUnit(HSO_SPD_Handle_t *pHandle, int16_t *pMecSpeedUnit);
+
+/* Sets the rotor mechanical angle */
+void HSO_SPD_SetMecAngle(HSO_SPD_Handle_t *pHandle, int16_t hMecAngle);
+
+/* Sets the stator resistance of the back-EMF computation */
+void HSO_SPD_SetRs(HSO_SPD_Handle_t *pHandle, float_t Rs);
+
+/** @} */
+/** @} */
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* HSO_SPEEDNPOSFDBK_H */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -47,6 +47,8 @@
 #define PROFILER_CMD                     0x68
 #define SW_RESET                         0x78
 #define SENSOR_SWITCH					 0x80
+#define PARAM_STORE_CMD                  0x88
+#define FAULT_LOG_CMD                    0x90
 #define MCP_USER_CMD                     0x100U
 
 /* MCP ERROR CODE */
@@ -36,7 +36,7 @@
 #include "r_divider_bus_voltage_sensor.h"
 #include "sto_pll_speed_pos_fdbk.h"
 #include "mp_one_touch_tuning.h"
-#include "mp_hall_tuning.h"
+#include "mc_interface.h"
 #include "mc_math.h"
 #include "arm_math.h"
 
@@ -59,6 +59,7 @@
 #define CMD_HT_END 5u
 #define CMD_PPD_START 6u
 #define PB_CHARACTERIZATION_DISABLE 0
+#define SCC_OBS_GAIN_SCHED_MAX 8u
 
 /** @defgroup SelfComCtrl_class_private_types SelfComCtrl class private types
   * @{
@@ -150,7 +151,14 @@ typedef struct
   uint16_t hPWMFreqHz;                   /*!< PWM frequency used for the test.*/
   uint8_t bFOCRepRate;                   /*!< FOC repetition rate used for the test.*/
   float fMCUPowerSupply;                 /*!< MCU Power Supply */
-  float IThreshold;
+  float IThreshold;                      /*!< Peak current that restarts R and L
+                                              detection at a lower current.*/
+  float fRSRated;                        /*!< Stator resistance the firmware is
+                                              configured with.*/
+  float fLSRated;                        /*!< Stator inductance the firmware is
+                                              configured with.*/
+  float fKeRated;                        /*!< Voltage constant the firmware is
+                                              configured with, Vrms ph-ph/kRPM.*/
 } SCC_Params_t, *pSCC_Params_t;
 
 /**
@@ -170,7 +178,6 @@ typedef struct
   STO_PLL_Handle_t *pSTO;            /*!< State Observer used.*/
   SpeednTorqCtrl_Handle_t *pSTC;            /*!< Speed and torque controller used.*/
   OTT_Handle_t *pOTT;
-  HT_Handle_t *pHT;
 
   SCC_State_t sm_state; /*!< SCC state machine state.*/
   RampExtMngr_Handle_t *pREMng;        /*!< Ramp manager used.*/
@@ -240,12 +247,26 @@ typedef struct
   float fCurrentBW;       /*!< Bandwidth of speed regulator.*/
   uint8_t bMPOngoing;     /*!< It is 1 if MP is ongoing, 0 otherwise.*/
   uint32_t wSpeedThToValidateStartupRPM; /*!< Speed threshold to validate the startup.*/
-  float IaBuff[256];
   bool detectBemfState;
   
   bool polePairDetection; //profiler ppDetection
   uint32_t ppDtcCnt;           /*!< Counter of pole pairs detection time.*/
 
+  int16_t hVAlpha;             /*!< Alpha voltage imposed while the current regulators
+                                    are bypassed, s16V.*/
+  int16_t hVAlphaPrev[2];      /*!< Alpha voltages set in the last two periods, latest first.*/
+  int16_t hIAlphaPrev;         /*!< Alpha current of the previous period, s16A.*/
+  int16_t hLSMeanVoltage;      /*!< Mean of the square wave of L detection, s16V.*/
+  int16_t hLSDeltaVoltage;     /*!< Amplitude of the square wave of L detection, s16V.*/
+  uint16_t hIPeak;             /*!< Highest alpha current since the last check, s16A.*/
+  float fResistorOffset;       /*!< Power board resistance subtracted from the R measurement.*/
+  float fVdt;                  /*!< Inverter voltage drop found by the R measurement.*/
+  float fRSApplied;            /*!< Stator resistance the regulators and observer are tuned for.*/
+  float fLSApplied;            /*!< Stator inductance the regulators and observer are tuned for.*/
+  float fKeApplied;            /*!< Voltage constant the observer is tuned for.*/
+  STO_PLL_GainSchedPoint_t ObsGainSched[SCC_OBS_GAIN_SCHED_MAX]; /*!< Observer gain schedule
+                                    retuned on the measured parameters.*/
+
   pSCC_Params_t pSCC_Params_str;  /**< SelfComCtrl parameters */
 
 } SCC_Handle_t;
@@ -305,6 +326,30 @@ static inline uint8_t SCC_GetSteps(SCC_Handle_t *pHandle)
   return 5u;
 }
 
+/**
+  * @brief  It returns true while the SCC is running on the motor.
+  * @param  pHandle: handler of SCC component.
+  * @retval bool true if MP is ongoing.
+  */
+static inline bool SCC_IsOngoing(SCC_Handle_t *pHandle)
+{
+  return (1u == pHandle->bMPOngoing);
+}
+
+/**
+  * @brief  It returns true in the SCC states where the phase voltage is imposed
+  *         by SCC_SetPhaseVoltage instead of the current regulators.
+  * @param  pHandle: handler of SCC component.
+  * @retval bool true if the current regulators are bypassed.
+  */
+static inline bool SCC_IsPhaseVoltageImposed(SCC_Handle_t *pHandle)
+{
+  return ((SCC_DUTY_DETECTING_PHASE == pHandle->sm_state) || (SCC_ALIGN_PHASE == pHandle->sm_state)
+          || (SCC_RS_DETECTING_PHASE_RAMP == pHandle->sm_state) || (SCC_RS_DETECTING_PHASE == pHandle->sm_state)
+          || (SCC_LS_DETECTING_PHASE == pHandle->sm_state) || (SCC_WAIT_RESTART == pHandle->sm_state)
+          || (SCC_RESTART_SCC == pHandle->sm_state));
+}
+
 /**
   * @brief  It returns the measured Rs.
   * @param  pHandle: handler of SCC component.
@@ -553,6 +598,7 @@ static inline void SCC_SetUnderVoltageThreshold(SCC_Handle_t *pHandle,uint16_t v
 uint8_t SCC_CMD(SCC_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer);
 void SCC_SetNominalCurrent(SCC_Handle_t *pHandle, float fCurrent);
 void SCC_SetNominalSpeed(SCC_Handle_t *pHandle, int32_t wNominalSpeed);
+bool SCC_SetMotorParams(SCC_Handle_t *pHandle, float fRS, float fLS, float fKe);
 uint8_t SCC_GetState(SCC_Handle_t *pHandle);
 float SCC_GetResistorOffset(SCC_Handle_t *pHandle);
 
@@ -44,6 +44,7 @@ typedef struct _POLPULSE_Params_
     float_t         Ts;
     float_t         Lsd;
     float_t         PulseCurrentGoal_A;
+    float_t         MinContrast;         /* Polarity signal over the mean current below which the angle is not valid */
     uint16_t        N;                   /* Number of pulse-periods */
     uint16_t        Nd;                  /* Number of decay-periods */
     uint16_t        N_Angles;            /* Number of directions to pulse in */
@@ -92,6 +93,7 @@ void POLPULSE_trigger(POLPULSE_Obj *obj);
 /* Accessors */
 
 fixp30_t				POLPULSE_getAngleEstimated(const POLPULSE_Obj *obj);
+bool				POLPULSE_getFlagAngleValid(const POLPULSE_Obj *obj);
 float_t             POLPULSE_getCurrentGoal(const POLPULSE_Obj *obj);
 uint16_t            POLPULSE_getDecayPeriods(const POLPULSE_Obj *obj);
 Duty_Dab_t			POLPULSE_getDutyAB(const POLPULSE_Obj *obj);
@@ -53,6 +53,18 @@ extern "C" {
   */
 #define RUC_MAX_PHASE_NUMBER 5u
 
+/**
+  * @brief Status of the on-the-fly detection returned by RUC_OTF_Detect.
+  *
+  */
+typedef enum
+{
+  RUC_OTF_DETECTING = 0,  /**< @brief Detection window is running, rotor not caught yet. */
+  RUC_OTF_CAUGHT,         /**< @brief Rotor caught, state observer convergence has been forced. */
+  RUC_OTF_NOT_CAUGHT      /**< @brief Detection window elapsed: rotor at standstill, too slow or spinning
+                               in the reverse direction. */
+} RUC_OTF_Status_t;
+
 /**
   * @brief RevUpCtrl_PhaseParams_t structure used for phases definition
   *
@@ -130,6 +142,25 @@ typedef struct
 
   RevUpCtrl_PhaseParams_t OTFPhaseParams;                   /**< @brief RevUp phase parameter of OTF feature.*/
 
+  bool AdaptiveEnabled;                                     /**< @brief Flag for adaptive acceleration activation.
+                                                                 When true, the first acceleration stage is sped up
+                                                                 while the state observer tracks the rotor, and
+                                                                 falls back to a tracked acceleration when it loses
+                                                                 track of it. */
+  uint16_t hAdaptMinDurationms;                             /**< @brief Shortest duration of the first acceleration
+                                                                 stage used by the adaptive rev-up, millisecond.
+                                                                 Must be non zero and lower than the programmed
+                                                                 duration. */
+  uint16_t hAdaptDurationms;                                /**< @brief Duration of the first acceleration stage
+                                                                 presently applied by the adaptive rev-up,
+                                                                 millisecond. Zero until the stage is entered. */
+  uint8_t bAdaptLostCnt;                                    /**< @brief Counter of consecutive speed loop periods
+                                                                 during which the observer did not track the rotor. */
+  uint8_t bAdaptTrackCnt;                                   /**< @brief Counter of consecutive speed loop periods
+                                                                 during which the observer tracked the rotor. */
+  bool AdaptFallback;                                       /**< @brief Set once the adaptive rev-up fell back to
+                                                                 the programmed profile. */
+
   SpeednTorqCtrl_Handle_t *pSTC;                            /**< @brief Speed and torque controller object used by
                                                                  RevUpCtrl.*/
 
@@ -151,12 +182,24 @@ void RUC_Init(RevUpCtrl_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC, Virtua
 /* Initializes the internal RevUp controller state */
 void RUC_Clear(RevUpCtrl_Handle_t *pHandle, int16_t hMotorDirection);
 
+/* Starts the programmed RevUp from a known rotor electrical angle */
+void RUC_SetStartingElAngle(RevUpCtrl_Handle_t *pHandle, int16_t hElAngle);
+
 /* Main Rev-Up controller procedure executing overall programmed phases */
 bool RUC_Exec(RevUpCtrl_Handle_t *pHandle);
 
 /* Main Rev-Up controller procedure that executes overall programmed phases and on-the-fly startup handling */
 bool RUC_OTF_Exec(RevUpCtrl_Handle_t *pHandle);
 
+/* Adapts the acceleration of the first acceleration stage to the tracking of the state observer */
+void RUC_AdaptAcceleration(RevUpCtrl_Handle_t *pHandle, bool ObserverTracking, bool RotorObserved);
+
+/* Starts the on-the-fly detection window with null current references */
+void RUC_OTF_StartDetection(RevUpCtrl_Handle_t *pHandle);
+
+/* On-the-fly detection procedure catching an already spinning rotor */
+RUC_OTF_Status_t RUC_OTF_Detect(RevUpCtrl_Handle_t *pHandle);
+
 /* Checks that alignment and first acceleration stage are completed */
 bool RUC_FirstAccelerationStageReached(RevUpCtrl_Handle_t *pHandle);
 
@@ -76,6 +76,7 @@ Vector_dq_t		RSTEMP_getIdqLFref(const RSTEMP_Handle handle);
 
 /* Setters */
 void			RSTEMP_setBandwidth(RSTEMP_Handle handle, const float_t value); /* in rad/s */
+void			RSTEMP_setDeadTimeVoltage_V(RSTEMP_Handle handle, const float_t value); /* mean phase voltage error */
 void			RSTEMP_setFlagEnable(RSTEMP_Handle handle, const bool value);
 void			RSTEMP_setFreqXY_Hz(RSTEMP_Handle handle, const float_t value);
 void			RSTEMP_setIref_A(RSTEMP_Handle handle, const float_t value);
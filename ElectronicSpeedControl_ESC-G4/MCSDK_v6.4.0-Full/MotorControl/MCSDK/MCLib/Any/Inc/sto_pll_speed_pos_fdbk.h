@@ -38,6 +38,23 @@
   */
 
 
+/**
+  * @brief Point of the speed-indexed gain schedule of the STO PLL component.
+  *
+  * Observer gains @f$ C_2 @f$, @f$ C_4 @f$ and PLL PI gains are linearly interpolated between two consecutive
+  * points according to the absolute mechanical speed of the rotor. Points must be sorted by increasing speed.
+  */
+typedef struct
+{
+  uint16_t hMecSpeedUnit;                 /**< @brief Absolute mechanical speed of the point.
+                                            *         Expressed in the unit defined by #SPEED_UNIT.
+                                            */
+  int16_t  hC2;                           /**< @brief State observer constant @f$ C_2 @f$ at this speed. */
+  int16_t  hC4;                           /**< @brief State observer constant @f$ C_4 @f$ at this speed. */
+  int16_t  hPLLKpGain;                    /**< @brief PLL proportional gain at this speed. */
+  int16_t  hPLLKiGain;                    /**< @brief PLL integral gain at this speed. */
+} STO_PLL_GainSchedPoint_t;
+
 /**
   * @brief Handle of the Speed and Position Feedback STO PLL component.
   *
@@ -181,6 +198,12 @@ typedef struct
 
   int8_t hForcedDirection;                /**< @brief Variable to force rotation direction. */
 
+  const STO_PLL_GainSchedPoint_t *pGainSched; /**< @brief Speed-indexed gain schedule, MC_NULL if gains are fixed. */
+  uint8_t bGainSchedSize;                 /**< @brief Number of points of the gain schedule pointed by pGainSched. */
+  int16_t hC1Rated;                       /**< @brief State observer constant @f$ C_1 @f$ at the stator resistance
+                                            *         the gain schedule is computed with.
+                                            */
+
 } STO_PLL_Handle_t;
 
 
@@ -219,13 +242,20 @@ alphabeta_t STO_PLL_GetEstimatedCurrent(STO_PLL_Handle_t *pHandle);
 /* Stores in the handler the new values for observer gains */
 void STO_PLL_SetObserverGains(STO_PLL_Handle_t *pHandle, int16_t hhC1, int16_t hhC2);
 
+/* Stores in the handler the observer constant C1 of a new stator resistance */
+void STO_PLL_SetStatorResistanceGain(STO_PLL_Handle_t *pHandle, int16_t hhC1);
+
 /* Exports current observer gains from the handler to parameters hhC2 and hhC4 */
 void STO_PLL_GetObserverGains(STO_PLL_Handle_t *pHandle, int16_t *phC2, int16_t *phC4);
 
 /* Exports the current PLL gains from the handler to parameters pPgain and pIgain */
 void STO_GetPLLGains(STO_PLL_Handle_t *pHandle, int16_t *pPgain, int16_t *pIgain);
 
-/* Empty function. Could be declared to set instantaneous information on rotor mechanical angle */
+/* Interpolates the gain schedule of the handler at the given mechanical speed */
+void STO_PLL_CalcScheduledGains(STO_PLL_Handle_t *pHandle, int16_t hMecSpeedUnit,
+                                STO_PLL_GainSchedPoint_t *pGains);
+
+/* Sets instantaneous information on rotor mechanical angle */
 void STO_PLL_SetMecAngle(STO_PLL_Handle_t *pHandle, int16_t hMecAngle);
 
 /* Enables/Disables additional reliability check based on observed Bemf */
@@ -234,6 +264,9 @@ void STO_PLL_BemfConsistencyCheckSwitch(STO_PLL_Handle_t *pHandle, bool bSel);
 /* Checks if the Bemf is consistent */
 bool STO_PLL_IsBemfConsistent(STO_PLL_Handle_t *pHandle);
 
+/* Checks if the Bemf is consistent within a given tolerance */
+bool STO_PLL_IsBemfConsistentWithin(const STO_PLL_Handle_t *pHandle, uint8_t bTolerance);
+
 /* Checks the value of the variance */
 bool STO_PLL_IsVarianceTight(const STO_Handle_t *pHandle);
 
@@ -0,0 +1,379 @@
+/**
+  ******************************************************************************
+  * @file    hfi_speed_pos_fdbk.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the High Frequency Injection Speed & Position Feedback component
+  *          of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup HFI_SpeednPosFdbk
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hfi_speed_pos_fdbk.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @defgroup HFI_SpeednPosFdbk High Frequency Injection Speed & Position Feedback
+  * @brief High Frequency Injection Speed & Position Feedback implementation
+  *
+  * This component tracks the rotor of a salient motor at standstill and low speed, where
+  * the back-EMF is too small for the @ref SpeednPosFdbk_STO "State Observer".
+  *
+  * A square wave voltage is added on the estimated d axis. Its half period lasts
+  * #HFI_Handle_t::bInjHalfPeriod current control periods. With an angle error the
+  * difference between the d and q inductances couples part of the resulting current
+  * ripple into the estimated q axis. The Iq step of each period, multiplied by the sign
+  * of the half wave that caused it, is proportional to the sine of twice the angle error
+  * and drives a PLL whose output is the electrical speed. The moving average of the
+  * currents over one injection period gives the fundamental to the current regulators.
+  *
+  * Above #HFI_Handle_t::hCrossoverLowUnit the angle and speed of the high speed sensor
+  * are blended in, and above #HFI_Handle_t::hCrossoverHighUnit only the high speed sensor
+  * is used and the injection stops. The saliency only gives the d axis up to its polarity,
+  * which must be known at start-up, for instance from the initial position detection.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Software initialization of the High Frequency Injection component.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  */
+__weak void HFI_Init(HFI_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (pHandle->bInjHalfPeriod < 2U)
+    {
+      pHandle->bInjHalfPeriod = 2U;
+    }
+    else if (pHandle->bInjHalfPeriod > HFI_MAX_HALF_PERIOD)
+    {
+      pHandle->bInjHalfPeriod = (uint8_t)HFI_MAX_HALF_PERIOD;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    PID_HandleInit(&pHandle->PIRegulator);
+    HFI_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Clears the state of the High Frequency Injection component, the injection restarts.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  */
+__weak void HFI_Clear(HFI_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+    pHandle->_Super.bSpeedErrorNumber = 0U;
+    pHandle->_Super.hElSpeedDpp = 0;
+    pHandle->_Super.InstantaneousElSpeedDpp = 0;
+    pHandle->_Super.hAvrMecSpeedUnit = 0;
+    pHandle->_Super.hMecAccelUnitP = 0;
+    pHandle->hHFIElSpeedDpp = 0;
+    pHandle->hAvrElSpeedDpp = 0;
+    pHandle->hBlend = 0;
+    pHandle->bInjCnt = 0U;
+    pHandle->bInjSignHistory = 0U;
+    pHandle->hIqPrev = 0;
+    pHandle->bAvgIndex = 0U;
+    for (i = 0U; i < (2U * HFI_MAX_HALF_PERIOD); i++)
+    {
+      pHandle->hIdBuffer[i] = 0;
+      pHandle->hIqBuffer[i] = 0;
+    }
+    pHandle->wIdSum = 0;
+    pHandle->wIqSum = 0;
+    PID_SetIntegralTerm(&pHandle->PIRegulator, 0);
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the d axis voltage to add to the output of the current regulators.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  * @retval int16_t Square wave voltage in s16V, 0 once only the high speed sensor is used.
+  *
+  * - Called every current control period, after HFI_Demodulate.
+  */
+__weak int16_t HFI_CalcInjection(HFI_Handle_t *pHandle)
+{
+  int16_t hVd = 0;
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t bNegative = pHandle->bInjSignHistory & 1U;
+
+    if (pHandle->hBlend < HFI_BLEND_FULL)
+    {
+      if (pHandle->bInjCnt >= pHandle->bInjHalfPeriod)
+      {
+        pHandle->bInjCnt = 0U;
+        bNegative ^= 1U;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->bInjCnt++;
+      hVd = (0U == bNegative) ? pHandle->hInjVoltage : -pHandle->hInjVoltage;
+    }
+    else
+    {
+      pHandle->bInjCnt = 0U;
+    }
+    pHandle->bInjSignHistory = (uint8_t)(pHandle->bInjSignHistory << 1U) | bNegative;
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+  return (hVd);
+}
+
+/**
+  * @brief  Tracks the rotor on the Iq response to the injection and blends in the high speed sensor.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  * @param  Iqd: stator currents in the estimated rotor frame, as sampled.
+  * @retval qd_t Currents averaged over one injection period, for the current regulators.
+  *
+  * - Called every current control period, after the Park transformation.
+  * - Updates the electrical angle used in the next period.
+  */
+__weak qd_t HFI_Demodulate(HFI_Handle_t *pHandle, qd_t Iqd)
+{
+  qd_t Iqd_f = Iqd;
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const SpeednPosFdbk_Handle_t *pHigh = pHandle->pHighSpeedSensor;
+    int32_t wError;
+    int32_t wAux;
+    int16_t hElAngle;
+    int16_t hElSpeedDpp;
+    /* The high speed sensor runs after the current regulation: predict its angle one period ahead */
+    int16_t hHighElAngle = pHigh->hElAngle + pHigh->hElSpeedDpp;
+    uint8_t bLength = 2U * pHandle->bInjHalfPeriod;
+
+    if (pHandle->hBlend < HFI_BLEND_FULL)
+    {
+      /* The duty computed in a period is loaded at the next PWM update, half way between two current
+       * samples: the Iq step since the last sample is driven by the last two half waves and only
+       * carries the saliency when both have the same sign */
+      wError = (int32_t)Iqd.q - (int32_t)pHandle->hIqPrev;
+      switch (pHandle->bInjSignHistory & 3U)
+      {
+        case 0U:
+        {
+          break;
+        }
+
+        case 3U:
+        {
+          wError = -wError;
+          break;
+        }
+
+        default:
+        {
+          wError = 0;
+          break;
+        }
+      }
+      pHandle->hHFIElSpeedDpp = PI_Controller(&pHandle->PIRegulator, wError);
+      pHandle->hHFIElAngle += pHandle->hHFIElSpeedDpp;
+    }
+    else
+    {
+      /* Follow the high speed sensor, ready for the injection to restart */
+      pHandle->hHFIElAngle = hHighElAngle;
+      pHandle->hHFIElSpeedDpp = pHigh->hElSpeedDpp;
+      PID_SetIntegralTerm(&pHandle->PIRegulator,
+                          (int32_t)pHigh->hElSpeedDpp * (int32_t)pHandle->PIRegulator.hKiDivisor);
+    }
+    pHandle->hIqPrev = Iqd.q;
+
+    hElAngle = pHandle->hHFIElAngle;
+    hElSpeedDpp = pHandle->hHFIElSpeedDpp;
+    if (pHandle->hBlend > 0)
+    {
+      wAux = (int32_t)((int16_t)(hHighElAngle - hElAngle)) * pHandle->hBlend;
+      hElAngle += (int16_t)(wAux >> 15);
+      wAux = ((int32_t)pHigh->hElSpeedDpp - hElSpeedDpp) * pHandle->hBlend;
+      hElSpeedDpp += (int16_t)(wAux >> 15);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    pHandle->_Super.hElAngle = hElAngle;
+    pHandle->_Super.hElSpeedDpp = hElSpeedDpp;
+    pHandle->_Super.InstantaneousElSpeedDpp = hElSpeedDpp;
+    pHandle->_Super.hMecAngle += hElSpeedDpp / (int16_t)pHandle->_Super.bElToMecRatio;
+    pHandle->hAvrElSpeedDpp += (int16_t)(((int32_t)hElSpeedDpp - pHandle->hAvrElSpeedDpp) / 16);
+
+    /* Average over one injection period to remove the ripple */
+    pHandle->wIdSum += (int32_t)Iqd.d - pHandle->hIdBuffer[pHandle->bAvgIndex];
+    pHandle->wIqSum += (int32_t)Iqd.q - pHandle->hIqBuffer[pHandle->bAvgIndex];
+    pHandle->hIdBuffer[pHandle->bAvgIndex] = Iqd.d;
+    pHandle->hIqBuffer[pHandle->bAvgIndex] = Iqd.q;
+    pHandle->bAvgIndex++;
+    if (pHandle->bAvgIndex >= bLength)
+    {
+      pHandle->bAvgIndex = 0U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Iqd_f.d = (int16_t)(pHandle->wIdSum / (int32_t)bLength);
+    Iqd_f.q = (int16_t)(pHandle->wIqSum / (int32_t)bLength);
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+  return (Iqd_f);
+}
+
+/**
+  * @brief  Computes the rotor average mechanical speed and updates the blend of the high speed sensor.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  * @param  pMecSpeedUnit: pointer to int16_t, used to return the rotor average
+  *         mechanical speed (expressed in the unit defined by #SPEED_UNIT).
+  * @retval true = sensor information is reliable and false = sensor information is not reliable.
+  *
+  * - Called with the speed and position feedback computation frequency.
+  * - Once only the high speed sensor is used, its reliability is returned.
+  */
+__weak bool HFI_CalcAvrgMecSpeedUnit(HFI_Handle_t *pHandle, int16_t *pMecSpeedUnit)
+{
+  bool bReliable = false;
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if ((MC_NULL == pHandle) || (MC_NULL == pMecSpeedUnit))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int32_t wAux;
+    int32_t wAbsSpeed;
+
+    wAux = (int32_t)pHandle->hAvrElSpeedDpp * (int32_t)pHandle->_Super.hMeasurementFrequency;
+    wAux = wAux * (int32_t)pHandle->_Super.SpeedUnit;
+    wAux = wAux / (int32_t)pHandle->_Super.DPPConvFactor;
+    wAux = wAux / (int16_t)pHandle->_Super.bElToMecRatio;
+    *pMecSpeedUnit = (int16_t)wAux;
+    pHandle->_Super.hAvrMecSpeedUnit = (int16_t)wAux;
+
+    wAbsSpeed = (wAux < 0) ? -wAux : wAux;
+    if (wAbsSpeed <= (int32_t)pHandle->hCrossoverLowUnit)
+    {
+      pHandle->hBlend = 0;
+    }
+    else if (wAbsSpeed >= (int32_t)pHandle->hCrossoverHighUnit)
+    {
+      pHandle->hBlend = HFI_BLEND_FULL;
+    }
+    else
+    {
+      wAux = (wAbsSpeed - (int32_t)pHandle->hCrossoverLowUnit) * HFI_BLEND_FULL;
+      pHandle->hBlend = (int16_t)(wAux / ((int32_t)pHandle->hCrossoverHighUnit
+                                         - (int32_t)pHandle->hCrossoverLowUnit));
+    }
+
+    bReliable = SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit);
+    if ((HFI_BLEND_FULL == pHandle->hBlend) && (false == SPD_Check(pHandle->pHighSpeedSensor)))
+    {
+      pHandle->_Super.bSpeedErrorNumber = pHandle->_Super.bMaximumSpeedErrorsNumber;
+      bReliable = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+  return (bReliable);
+}
+
+/**
+  * @brief  Sets the rotor mechanical angle, the electrical angle tracked on the saliency follows.
+  * @param  pHandle: handler of the current instance of the High Frequency Injection component.
+  * @param  hMecAngle: rotor mechanical angle, in s16degrees.
+  *
+  * - Called at start-up with the polarity resolved angle of the initial position detection.
+  */
+__weak void HFI_SetMecAngle(HFI_Handle_t *pHandle, int16_t hMecAngle)
+{
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->_Super.hMecAngle = hMecAngle;
+    pHandle->hHFIElAngle = hMecAngle * (int16_t)pHandle->_Super.bElToMecRatio;
+    pHandle->_Super.hElAngle = pHandle->hHFIElAngle;
+#ifdef NULL_PTR_CHECK_HFI_SPD_POS_FDB
+  }
+#endif
+}
+
+/** @} */
+
+/** @} */
+
+/** @} */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
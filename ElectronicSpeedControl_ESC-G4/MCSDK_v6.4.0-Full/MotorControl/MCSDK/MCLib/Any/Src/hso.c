@@ -0,0 +1,533 @@
+/**
+  ******************************************************************************
+  * @file    hso.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the High Sensitivity Observer component
+  *          of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/*
+ * High Sensitivity Observer, rotor flux observer.
+ *
+ * The back-EMF (stator voltage corrected for the resistive and inductive drops) is integrated into the rotor
+ * flux vector, in Wb. A pure integrator drifts on any offset, so the flux is pulled towards a reference vector
+ * of the nominal flux amplitude, aligned on the estimated angle rotated by the external Correction:
+ *
+ *   Flux_ab += Emf_ab.FullScaleVoltage.Ts + Kc.(FluxRef.e^j(theta + Correction) - Flux_ab)
+ *
+ * With a null Correction the pull is radial only, the angle of the flux vector is not biased by it. The
+ * crossover frequency Kc/(2.pi.Ts) follows the speed when the adaptive filter is enabled. The residual error
+ * is integrated into an estimate of the Emf offset. The angle is the argument of the flux vector, the speed its
+ * derivative, low pass filtered. The speed computed from the Emf, e x Flux / |Flux|^2, is compared to it to
+ * check the rotation direction.
+ */
+
+#include "hso.h"
+
+#define HSO_DEFAULT_OBSERVER_RATIO	(0.5f)			/* Adaptive crossover, ratio of the electrical frequency */
+#define HSO_DEFAULT_OFFSET_LIMIT	FIXP30(0.05f)	/* Emf offset compensation limit, pu of the full scale voltage */
+#define HSO_MIN_FLUX_RATIO			(8)				/* Emf speed not computed below FluxRef/8 */
+
+typedef struct _HSO_Private_
+{
+	/* Parameters */
+	float_t				isrTime_s;
+	float_t				FullScaleVoltage_V;
+	float_t				FullScaleFreq_Hz;
+	float_t				speedPole_rps;
+	float_t				CheckDirBW_Hz;
+	float_t				LPfiltcompPole_rps;
+	float_t				CrossOver_Hz;
+	float_t				MinCrossOver_Hz;
+	float_t				MaxCrossOver_Hz;
+	float_t				EoffsetThreshold_Hz;
+	float_t				ObserverRatio;
+
+	/* Scaling */
+	fixp30_t			Kint;			/* Flux increment per pu of Emf and ISR period, Wb */
+	fixp30_t			Kemf;			/* Flux giving one pu of Emf at full scale frequency, Wb */
+	fixp30_t			Kfreq;			/* 2.pi.FullScaleFreq.Ts, crossover pu to correction gain */
+	FIXP_scaled_t		KdeltaToSpeed;	/* 1/(FullScaleFreq.Ts), angle increment to frequency pu */
+	fixp30_t			KspeedPole;
+	fixp30_t			KcheckDir;
+	fixp30_t			KlpComp;
+	fixp30_t			ObserverRatio_pu;
+	fixp30_t			MinCrossOver_pu;
+	fixp30_t			MaxCrossOver_pu;
+	fixp30_t			EoffsetThreshold_pu;
+
+	/* Settings */
+	fixp30_t			FluxRef_Wb;
+	fixp30_t			CrossOver_pu;
+	fixp30_t			Kc;
+	fixp30_t			Koffset;
+	fixp30_t			OffsetLimit;
+	bool				flag_FilterAdaptive;
+	bool				flag_EnableOffsetUpdate;
+	bool				flag_TrackAngle;
+
+	/* State */
+	Vector_ab_t			Flux_ab_Wb;
+	fixp30_t			FluxAmpl_Wb;
+	Vector_ab_t			Offset_ab_pu;
+	fixp30_t			angle_pu;
+	FIXP_CosSin_t		cosSin;
+	fixp30_t			delta_theta_pu;
+	fixp30_t			speedLP_pu;
+	fixp30_t			emfSpeed_pu;
+	fixp30_t			checkDir;
+} HSO_Private;
+
+/* Compile time check that the private data fits in the public object */
+typedef char HSO_SizeCheck[(sizeof(HSO_Private) <= sizeof(HSO_Obj)) ? 1 : -1];
+
+static inline HSO_Private *HSO_priv(HSO_Obj *obj)
+{
+	return ((HSO_Private *) obj);
+}
+
+static inline const HSO_Private *HSO_cpriv(const HSO_Obj *obj)
+{
+	return ((const HSO_Private *) obj);
+}
+
+static inline fixp30_t HSO_wrapAngle(const fixp30_t angle_pu)
+{
+	return (angle_pu & (FIXP30(1.0f) - 1));
+}
+
+static inline fixp30_t HSO_wrapDelta(const fixp30_t delta_pu)
+{
+	/* Angle difference in [-0.5, 0.5[ */
+	return (HSO_wrapAngle(delta_pu + FIXP30(0.5f)) - FIXP30(0.5f));
+}
+
+static inline fixp30_t HSO_HzToPu(const HSO_Private *p, const float_t freq_Hz)
+{
+	return (FIXP30(freq_Hz / p->FullScaleFreq_Hz));
+}
+
+static inline fixp30_t HSO_poleToGain(const HSO_Private *p, const float_t pole_rps)
+{
+	/* Forward Euler low pass filter gain */
+	return (FIXP30(pole_rps * p->isrTime_s));
+}
+
+static void HSO_updateCrossOver(HSO_Private *p, fixp30_t CrossOver_pu)
+{
+	CrossOver_pu = FIXP_sat(CrossOver_pu, p->MaxCrossOver_pu, p->MinCrossOver_pu);
+	p->CrossOver_pu = CrossOver_pu;
+	p->Kc = FIXP30_mpy(CrossOver_pu, p->Kfreq);
+}
+
+static void HSO_setAngleState(HSO_Private *p, const fixp30_t angle_pu)
+{
+	p->angle_pu = HSO_wrapAngle(angle_pu);
+	FIXP30_CosSinPU(p->angle_pu, &p->cosSin);
+}
+
+void HSO_setParams(HSO_Handle handle, const HSO_Params *pParams)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->isrTime_s = pParams->isrTime_s;
+	p->FullScaleVoltage_V = pParams->FullScaleVoltage_V;
+	p->FullScaleFreq_Hz = pParams->FullScaleFreq_Hz;
+	p->CheckDirBW_Hz = pParams->CheckDirBW_Hz;
+	p->ObserverRatio = HSO_DEFAULT_OBSERVER_RATIO;
+	p->flag_FilterAdaptive = pParams->flag_FilterAdaptive;
+	p->flag_EnableOffsetUpdate = false;
+	p->flag_TrackAngle = true;
+
+	p->Kint = FIXP30(pParams->FullScaleVoltage_V * pParams->isrTime_s);
+	p->Kemf = FIXP30(pParams->FullScaleVoltage_V / ((float_t) MATH_TWO_PI * pParams->FullScaleFreq_Hz));
+	p->Kfreq = FIXP30((float_t) MATH_TWO_PI * pParams->FullScaleFreq_Hz * pParams->isrTime_s);
+	FIXPSCALED_floatToFIXPscaled(1.0f / (pParams->FullScaleFreq_Hz * pParams->isrTime_s), &p->KdeltaToSpeed);
+	p->KcheckDir = HSO_poleToGain(p, (float_t) MATH_TWO_PI * pParams->CheckDirBW_Hz);
+	p->ObserverRatio_pu = FIXP30(p->ObserverRatio);
+
+	HSO_setSpeedPole_rps(handle, pParams->speedPole_rps);
+	HSO_setLPfiltcompPole_rps(handle, pParams->speedPole_rps);
+	HSO_setMinCrossOver_Hz(handle, pParams->Filter_adapt_fmin_Hz);
+	HSO_setMaxCrossOver_Hz(handle, pParams->Filter_adapt_fmax_Hz);
+	HSO_setCrossOver_Hz(handle, pParams->CrossOver_Hz);
+	HSO_setEoffsetThreshold_Hz(handle, pParams->Filter_adapt_fmin_Hz);
+	HSO_setFluxRef_Wb(handle, FIXP30(pParams->Flux_Wb));
+
+	/* Offset loop about ten times slower than the flux correction at the minimum crossover */
+	float_t KcMin = (float_t) MATH_TWO_PI * pParams->Filter_adapt_fmin_Hz * pParams->isrTime_s;
+	p->Koffset = FIXP30((KcMin * KcMin) / (10.0f * pParams->FullScaleVoltage_V * pParams->isrTime_s));
+	p->OffsetLimit = HSO_DEFAULT_OFFSET_LIMIT;
+
+	HSO_clear(handle);
+}
+
+void HSO_run(HSO_Handle handle, Voltages_Uab_t *pVback_ab, const fixp30_t Correction)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	/* Emf corrected for its estimated offset */
+	Voltages_Uab_t Emf_ab;
+	Emf_ab.A = pVback_ab->A - p->Offset_ab_pu.A;
+	Emf_ab.B = pVback_ab->B - p->Offset_ab_pu.B;
+
+	/* Reference flux on the estimated angle, rotated by the correction */
+	FIXP_CosSin_t refCosSin = p->cosSin;
+	if (0 != Correction)
+	{
+		FIXP30_CosSinPU(HSO_wrapAngle(p->angle_pu + Correction), &refCosSin);
+	}
+	Vector_ab_t Error_ab;
+	Error_ab.A = FIXP30_mpy(p->FluxRef_Wb, refCosSin.cos) - p->Flux_ab_Wb.A;
+	Error_ab.B = FIXP30_mpy(p->FluxRef_Wb, refCosSin.sin) - p->Flux_ab_Wb.B;
+
+	/* Integration with crossover correction */
+	p->Flux_ab_Wb.A += FIXP30_mpy(Emf_ab.A, p->Kint) + FIXP30_mpy(Error_ab.A, p->Kc);
+	p->Flux_ab_Wb.B += FIXP30_mpy(Emf_ab.B, p->Kint) + FIXP30_mpy(Error_ab.B, p->Kc);
+
+	/* Angle and speed from the flux vector */
+	fixp30_t angle_pu;
+	FIXP30_polar(p->Flux_ab_Wb.A, p->Flux_ab_Wb.B, &angle_pu, &p->FluxAmpl_Wb);
+	if (true == p->flag_TrackAngle)
+	{
+		p->delta_theta_pu = HSO_wrapDelta(angle_pu - p->angle_pu);
+		HSO_setAngleState(p, angle_pu);
+	}
+	else
+	{
+		/* Angle held by HSO_setAngle_pu(), the flux is pulled on it */
+		p->delta_theta_pu = 0;
+	}
+	fixp30_t speed_pu = FIXP_mpyFIXPscaled(p->delta_theta_pu, &p->KdeltaToSpeed);
+	p->speedLP_pu += FIXP30_mpy(speed_pu - p->speedLP_pu, p->KspeedPole);
+
+	/* Speed from the Emf component perpendicular to the flux, e = j.w.Flux */
+	if (p->FluxAmpl_Wb > (p->FluxRef_Wb / HSO_MIN_FLUX_RATIO))
+	{
+		fixp30_t Emf_t = FIXP30_mpy(Emf_ab.B, p->cosSin.cos) - FIXP30_mpy(Emf_ab.A, p->cosSin.sin);
+		fixp30_t emfSpeed_pu = FIXP30_div(FIXP30_mpy(Emf_t, p->Kemf), p->FluxAmpl_Wb);
+		p->emfSpeed_pu += FIXP30_mpy(emfSpeed_pu - p->emfSpeed_pu, p->KlpComp);
+	}
+
+	/* Direction check, +1 when both speeds agree, -1 when opposite */
+	fixp30_t dirAgree = ((p->emfSpeed_pu ^ p->speedLP_pu) >= 0) ? FIXP30(1.0f) : FIXP30(-1.0f);
+	p->checkDir += FIXP30_mpy(dirAgree - p->checkDir, p->KcheckDir);
+
+	fixp30_t absSpeed_pu = FIXP30_abs(p->speedLP_pu);
+
+	/* Emf offset estimation, a constant offset shifts the flux circle away from the reference */
+	if ((true == p->flag_EnableOffsetUpdate) && (absSpeed_pu > p->EoffsetThreshold_pu))
+	{
+		p->Offset_ab_pu.A -= FIXP30_mpy(Error_ab.A, p->Koffset);
+		p->Offset_ab_pu.B -= FIXP30_mpy(Error_ab.B, p->Koffset);
+		p->Offset_ab_pu.A = FIXP_sat(p->Offset_ab_pu.A, p->OffsetLimit, -p->OffsetLimit);
+		p->Offset_ab_pu.B = FIXP_sat(p->Offset_ab_pu.B, p->OffsetLimit, -p->OffsetLimit);
+	}
+
+	if (true == p->flag_FilterAdaptive)
+	{
+		HSO_updateCrossOver(p, FIXP30_mpy(absSpeed_pu, p->ObserverRatio_pu));
+	}
+}
+
+void HSO_adjustAngle_pu(HSO_Handle handle, const fixp30_t rotation_pu)
+{
+	HSO_Private *p = HSO_priv(handle);
+	FIXP_CosSin_t rot;
+
+	FIXP30_CosSinPU(rotation_pu, &rot);
+	Vector_ab_t Flux = p->Flux_ab_Wb;
+	p->Flux_ab_Wb.A = FIXP30_mpy(Flux.A, rot.cos) - FIXP30_mpy(Flux.B, rot.sin);
+	p->Flux_ab_Wb.B = FIXP30_mpy(Flux.A, rot.sin) + FIXP30_mpy(Flux.B, rot.cos);
+	HSO_setAngleState(p, p->angle_pu + rotation_pu);
+}
+
+void HSO_clear(HSO_Handle handle)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->Offset_ab_pu.A = 0;
+	p->Offset_ab_pu.B = 0;
+	p->delta_theta_pu = 0;
+	p->speedLP_pu = 0;
+	p->emfSpeed_pu = 0;
+	p->checkDir = 0;
+	HSO_updateCrossOver(p, HSO_HzToPu(p, p->CrossOver_Hz));
+
+	/* Flux at its nominal amplitude on the present angle */
+	HSO_setFluxPolar_pu(handle, p->angle_pu, FIXP30(1.0f));
+}
+
+void HSO_flip_angle(HSO_Handle handle)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->Flux_ab_Wb.A = -p->Flux_ab_Wb.A;
+	p->Flux_ab_Wb.B = -p->Flux_ab_Wb.B;
+	HSO_setAngleState(p, p->angle_pu + FIXP30(0.5f));
+}
+
+fixp30_t HSO_getAngle_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->angle_pu);
+}
+
+fixp30_t HSO_getCheckDir(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->checkDir);
+}
+
+void HSO_getCosSinTh_ab(const HSO_Handle handle, FIXP_CosSin_t *pCosSinTh)
+{
+	*pCosSinTh = HSO_cpriv(handle)->cosSin;
+}
+
+FIXP_CosSin_t HSO_getCosSin(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->cosSin);
+}
+
+float_t HSO_getCrossOver_Hz(const HSO_Handle handle)
+{
+	const HSO_Private *p = HSO_cpriv(handle);
+	return (FIXP30_toF(p->CrossOver_pu) * p->FullScaleFreq_Hz);
+}
+
+fixp30_t HSO_getDelta_theta_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->delta_theta_pu);
+}
+
+fixp30_t HSO_getEmfSpeed_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->emfSpeed_pu);
+}
+
+float_t HSO_getEoffsetThreshold_Hz(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->EoffsetThreshold_Hz);
+}
+
+bool HSO_getFlag_EnableOffsetUpdate(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->flag_EnableOffsetUpdate);
+}
+
+bool HSO_getFlag_FilterAdaptive(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->flag_FilterAdaptive);
+}
+
+Vector_ab_t HSO_getFlux_ab_Wb(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->Flux_ab_Wb);
+}
+
+fixp30_t HSO_getFluxAmpl_Wb(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->FluxAmpl_Wb);
+}
+
+fixp30_t HSO_getFluxRef_Wb(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->FluxRef_Wb);
+}
+
+fixp30_t HSO_getKoffset(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->Koffset);
+}
+
+float_t HSO_getLPfiltcompPole_rps(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->LPfiltcompPole_rps);
+}
+
+fixp30_t HSO_getOffsetLimit(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->OffsetLimit);
+}
+
+Vector_ab_t HSO_getOffset_ab_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->Offset_ab_pu);
+}
+
+float_t HSO_getMaxCrossOver_Hz(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->MaxCrossOver_Hz);
+}
+
+float_t HSO_getMinCrossOver_Hz(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->MinCrossOver_Hz);
+}
+
+fixp30_t HSO_getMinCrossOver_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->MinCrossOver_pu);
+}
+
+fixp30_t HSO_getSpeedLP_pu(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->speedLP_pu);
+}
+
+float_t HSO_getSpeedPole_rps(const HSO_Handle handle)
+{
+	return (HSO_cpriv(handle)->speedPole_rps);
+}
+
+void HSO_resetOffsetLimit(HSO_Handle handle)
+{
+	HSO_priv(handle)->OffsetLimit = HSO_DEFAULT_OFFSET_LIMIT;
+}
+
+void HSO_setAngle_pu(HSO_Handle handle, const fixp30_t theta)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	/* Rotate the flux vector with the angle to keep the observer consistent */
+	HSO_adjustAngle_pu(handle, HSO_wrapDelta(theta - p->angle_pu));
+}
+
+void HSO_setCrossOver_Hz(HSO_Handle handle, const float_t CrossOver_Hz)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->CrossOver_Hz = CrossOver_Hz;
+	HSO_updateCrossOver(p, HSO_HzToPu(p, CrossOver_Hz));
+}
+
+void HSO_setCrossOver_pu(HSO_Handle handle, const fixp30_t CrossOver_pu)
+{
+	HSO_updateCrossOver(HSO_priv(handle), CrossOver_pu);
+}
+
+void HSO_setEoffsetThreshold_Hz(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->EoffsetThreshold_Hz = value;
+	p->EoffsetThreshold_pu = HSO_HzToPu(p, value);
+}
+
+void HSO_setFlag_EnableOffsetUpdate(HSO_Handle handle, const bool value)
+{
+	HSO_priv(handle)->flag_EnableOffsetUpdate = value;
+}
+
+void HSO_setFlag_FilterAdaptive(HSO_Handle handle, const bool value)
+{
+	HSO_priv(handle)->flag_FilterAdaptive = value;
+}
+
+void HSO_setFlag_TrackAngle(HSO_Handle handle, const bool value)
+{
+	HSO_priv(handle)->flag_TrackAngle = value;
+}
+
+void HSO_setFluxPolar_pu(HSO_Handle handle, const fixp30_t angle_pu, const fixp30_t magn_pu)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	/* Magnitude in pu of the reference flux */
+	HSO_setAngleState(p, angle_pu);
+	p->FluxAmpl_Wb = FIXP30_mpy(p->FluxRef_Wb, magn_pu);
+	p->Flux_ab_Wb.A = FIXP30_mpy(p->FluxAmpl_Wb, p->cosSin.cos);
+	p->Flux_ab_Wb.B = FIXP30_mpy(p->FluxAmpl_Wb, p->cosSin.sin);
+}
+
+void HSO_setFluxRef_ab_Wb(HSO_Handle handle, const Vector_ab_t *pFluxRef_ab_Wb)
+{
+	HSO_Private *p = HSO_priv(handle);
+	fixp30_t angle_pu;
+
+	/* Flux vector and reference amplitude, for instance at the end of an alignment */
+	p->Flux_ab_Wb = *pFluxRef_ab_Wb;
+	FIXP30_polar(pFluxRef_ab_Wb->A, pFluxRef_ab_Wb->B, &angle_pu, &p->FluxRef_Wb);
+	p->FluxAmpl_Wb = p->FluxRef_Wb;
+	HSO_setAngleState(p, angle_pu);
+}
+
+void HSO_setFluxRef_Wb(HSO_Handle handle, const fixp30_t FluxWb)
+{
+	HSO_priv(handle)->FluxRef_Wb = FluxWb;
+}
+
+void HSO_setKoffset(HSO_Handle handle, const fixp30_t value)
+{
+	HSO_priv(handle)->Koffset = value;
+}
+
+void HSO_setLPfiltcompPole_rps(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	/* Pole of the low pass filter of the Emf speed */
+	p->LPfiltcompPole_rps = value;
+	p->KlpComp = HSO_poleToGain(p, value);
+}
+
+void HSO_setMaxCrossOver_Hz(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->MaxCrossOver_Hz = value;
+	p->MaxCrossOver_pu = HSO_HzToPu(p, value);
+}
+
+void HSO_setMinCrossOver_Hz(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->MinCrossOver_Hz = value;
+	p->MinCrossOver_pu = HSO_HzToPu(p, value);
+}
+
+void HSO_setMinCrossOver_pu(HSO_Handle handle, const fixp30_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->MinCrossOver_pu = value;
+	p->MinCrossOver_Hz = FIXP30_toF(value) * p->FullScaleFreq_Hz;
+}
+
+void HSO_setObserverRatio(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->ObserverRatio = value;
+	p->ObserverRatio_pu = FIXP30(value);
+}
+
+void HSO_setOffsetLimit(HSO_Handle handle, const fixp30_t value)
+{
+	HSO_priv(handle)->OffsetLimit = value;
+}
+
+void HSO_setSpeedPole_rps(HSO_Handle handle, const float_t value)
+{
+	HSO_Private *p = HSO_priv(handle);
+
+	p->speedPole_rps = value;
+	p->KspeedPole = HSO_poleToGain(p, value);
+}
+
+/* end of hso.c */
+
+/************************ (C) COPYRIGHT 2025 Piak Electronic Design B.V. *****END OF FILE****/
@@ -0,0 +1,276 @@
+/**
+  ******************************************************************************
+  * @file    hso_speed_pos_fdbk.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the High Sensitivity Observer Speed & Position Feedback component
+  *          of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup HSO_SpeednPosFdbk
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hso_speed_pos_fdbk.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @defgroup HSO_SpeednPosFdbk High Sensitivity Observer Speed & Position Feedback
+  * @brief High Sensitivity Observer Speed & Position Feedback implementation
+  *
+  * This component gives the @ref SpeednPosFdbk interface to the HSO rotor flux observer, so that it can
+  * replace the @ref SpeednPosFdbk_STO "State Observer" as speed sensor of the closed loop.
+  *
+  * The back-EMF fed to the observer is the stator voltage minus the resistive and inductive drops. The
+  * voltage applied between two current samples is the mean of the last two voltages set, each one being
+  * loaded by the PWM update half way between two samples.
+  *
+  * The observer works on the polar angle of the flux in the alpha beta plane. The Park transformation of
+  * the library puts the d axis at (sin, cos) of the electrical angle: the electrical angle is a quarter
+  * turn minus the angle of the flux, and the flux of a positive speed turns clockwise.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Quarter turn, s16degrees */
+#define HSO_SPD_QUARTER_TURN        16384
+
+/* Below this value of the direction check the flux is taken as turning against the Emf */
+#define HSO_SPD_CHECKDIR_THRESHOLD  FIXP30(-0.5f)
+
+/**
+  * @brief  Software initialization of the High Sensitivity Observer component.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  */
+__weak void HSO_SPD_Init(HSO_SPD_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const HSO_Params *pParams = pHandle->pParams;
+    float_t fullScaleVoltage_V = pParams->FullScaleVoltage_V;
+
+    (void)HSO_init(pHandle->pHSO, sizeof(HSO_Obj));
+    HSO_setParams(pHandle->pHSO, pParams);
+
+    pHandle->Kr = FIXP30((pHandle->Rs * pHandle->FullScaleCurrent_A) / fullScaleVoltage_V);
+    FIXPSCALED_floatToFIXPscaled((pHandle->Ls * pHandle->FullScaleCurrent_A) / (pParams->isrTime_s * fullScaleVoltage_V),
+                                 &pHandle->Kl);
+    pHandle->wSpeedPuToDpp = (int32_t)(pParams->FullScaleFreq_Hz * pParams->isrTime_s * 65536.0f);
+    pHandle->wSpeedPuToUnit = (int32_t)(pParams->FullScaleFreq_Hz * (float_t)pHandle->_Super.SpeedUnit);
+
+    HSO_SPD_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Clears the state of the High Sensitivity Observer component.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  *
+  * - The flux restarts at its nominal amplitude on the last estimated angle.
+  */
+__weak void HSO_SPD_Clear(HSO_SPD_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    HSO_clear(pHandle->pHSO);
+    pHandle->_Super.bSpeedErrorNumber = 0U;
+    pHandle->_Super.hElSpeedDpp = 0;
+    pHandle->_Super.InstantaneousElSpeedDpp = 0;
+    pHandle->_Super.hAvrMecSpeedUnit = 0;
+    pHandle->_Super.hMecAccelUnitP = 0;
+    pHandle->IalphabetaPrev.alpha = 0;
+    pHandle->IalphabetaPrev.beta = 0;
+    pHandle->ValphabetaPrev[0] = pHandle->IalphabetaPrev;
+    pHandle->ValphabetaPrev[1] = pHandle->IalphabetaPrev;
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Runs the flux observer on the last current sample and returns the rotor electrical angle.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  * @param  pInputs: currents sampled in this period, voltage set in this period and bus voltage.
+  * @retval int16_t rotor electrical angle (s16degrees).
+  *
+  * - Called every current control period, after the current regulation.
+  */
+__weak int16_t HSO_SPD_CalcElAngle(HSO_SPD_Handle_t *pHandle, const Observer_Inputs_t *pInputs)
+{
+  int16_t hElAngle = 0;
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if ((MC_NULL == pHandle) || (MC_NULL == pInputs))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    Voltages_Uab_t Emf_ab;
+    fixp30_t wVbusHalf = (fixp30_t)(pInputs->Vbus >> 1U);
+    const alphabeta_t *pVprev = pHandle->ValphabetaPrev;
+    const alphabeta_t *pI = &pInputs->Ialfa_beta;
+    const alphabeta_t *pIprev = &pHandle->IalphabetaPrev;
+
+    /* Applied voltage in pu of the full scale voltage: s16 of the bus voltage times bus voltage in u16 */
+    Emf_ab.A = (((fixp30_t)pVprev[0].alpha + pVprev[1].alpha) / 2) * wVbusHalf;
+    Emf_ab.B = (((fixp30_t)pVprev[0].beta + pVprev[1].beta) / 2) * wVbusHalf;
+
+    /* Minus resistive drop on the mean current and inductive drop on the current step, currents in fixp30 */
+    Emf_ab.A -= FIXP30_mpy(((fixp30_t)pI->alpha + pIprev->alpha) << 14, pHandle->Kr);
+    Emf_ab.B -= FIXP30_mpy(((fixp30_t)pI->beta + pIprev->beta) << 14, pHandle->Kr);
+    Emf_ab.A -= FIXP_mpyFIXPscaled(((fixp30_t)pI->alpha - pIprev->alpha) << 15, &pHandle->Kl);
+    Emf_ab.B -= FIXP_mpyFIXPscaled(((fixp30_t)pI->beta - pIprev->beta) << 15, &pHandle->Kl);
+
+    pHandle->ValphabetaPrev[1] = pHandle->ValphabetaPrev[0];
+    pHandle->ValphabetaPrev[0] = pInputs->Valfa_beta;
+    pHandle->IalphabetaPrev = pInputs->Ialfa_beta;
+
+    HSO_run(pHandle->pHSO, &Emf_ab, 0);
+
+    pHandle->_Super.InstantaneousElSpeedDpp = -(int16_t)(HSO_getDelta_theta_pu(pHandle->pHSO) >> 14);
+    pHandle->_Super.hElSpeedDpp = -(int16_t)FIXP30_mpy(HSO_getSpeedLP_pu(pHandle->pHSO), pHandle->wSpeedPuToDpp);
+
+    /* Per unit angle of the flux to electrical angle in s16degrees. The flux is the one of this sample and the
+       angle is used at the next one, a period later */
+    hElAngle = (int16_t)(HSO_SPD_QUARTER_TURN - (HSO_getAngle_pu(pHandle->pHSO) >> 14));
+    hElAngle += pHandle->_Super.hElSpeedDpp;
+    pHandle->_Super.hElAngle = hElAngle;
+    pHandle->_Super.hMecAngle += pHandle->_Super.InstantaneousElSpeedDpp
+                               / (int16_t)pHandle->_Super.bElToMecRatio;
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+  return (hElAngle);
+}
+
+/**
+  * @brief  Computes the rotor average mechanical speed from the filtered speed of the observer.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  * @param  pMecSpeedUnit: pointer to int16_t, used to return the rotor average
+  *         mechanical speed (expressed in the unit defined by #SPEED_UNIT).
+  * @retval true = sensor information is reliable and false = sensor information is not reliable.
+  *
+  * - Called with the speed and position feedback computation frequency.
+  * - Flux turning against the back-EMF is reported as a speed feedback fault.
+  */
+__weak bool HSO_SPD_CalcAvrgMecSpeedUnit(HSO_SPD_Handle_t *pHandle, int16_t *pMecSpeedUnit)
+{
+  bool bReliable = false;
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if ((MC_NULL == pHandle) || (MC_NULL == pMecSpeedUnit))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int32_t wAux = -FIXP30_mpy(HSO_getSpeedLP_pu(pHandle->pHSO), pHandle->wSpeedPuToUnit);
+
+    wAux = wAux / (int16_t)pHandle->_Super.bElToMecRatio;
+    *pMecSpeedUnit = (int16_t)wAux;
+    pHandle->_Super.hAvrMecSpeedUnit = (int16_t)wAux;
+
+    bReliable = SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit);
+    if (HSO_getCheckDir(pHandle->pHSO) < HSO_SPD_CHECKDIR_THRESHOLD)
+    {
+      pHandle->_Super.bSpeedErrorNumber = pHandle->_Super.bMaximumSpeedErrorsNumber;
+      bReliable = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+  return (bReliable);
+}
+
+/**
+  * @brief  Sets the rotor mechanical angle, the observed flux is rotated onto it.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  * @param  hMecAngle: rotor mechanical angle, in s16degrees.
+  */
+__weak void HSO_SPD_SetMecAngle(HSO_SPD_Handle_t *pHandle, int16_t hMecAngle)
+{
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int16_t hElAngle = hMecAngle * (int16_t)pHandle->_Super.bElToMecRatio;
+
+    pHandle->_Super.hMecAngle = hMecAngle;
+    pHandle->_Super.hElAngle = hElAngle;
+    HSO_setAngle_pu(pHandle->pHSO, ((fixp30_t)(uint16_t)(HSO_SPD_QUARTER_TURN - hElAngle)) << 14);
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the stator resistance used to compute the back-EMF, for instance from an online estimate.
+  * @param  pHandle: handler of the current instance of the High Sensitivity Observer component.
+  * @param  Rs: stator resistance, Ohm.
+  */
+__weak void HSO_SPD_SetRs(HSO_SPD_Handle_t *pHandle, float_t Rs)
+{
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Rs = Rs;
+    pHandle->Kr = FIXP30((Rs * pHandle->FullScaleCurrent_A) / pHandle->pParams->FullScaleVoltage_V);
+#ifdef NULL_PTR_CHECK_HSO_SPD_POS_FDB
+  }
+#endif
+}
+
+/** @} */
+
+/** @} */
+
+/** @} */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
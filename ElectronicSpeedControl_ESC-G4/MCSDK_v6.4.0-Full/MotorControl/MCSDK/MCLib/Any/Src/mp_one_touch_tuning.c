@@ -0,0 +1,510 @@
+/**
+  ******************************************************************************
+  * @file    mp_one_touch_tuning.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the One Touch Tuning component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup OneTouchTuning
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mp_one_touch_tuning.h"
+
+/** @addtogroup STM32_PMSM_MC_Library
+  * @{
+  */
+
+/** @defgroup OneTouchTuning One Touch Tuning
+  * @brief Identification of the mechanical load and tuning of the speed regulator
+  *
+  * The motor runs in closed loop on the speed sensor given to the component, with the speed
+  * regulator at conservative gains. The friction is the slope of the steady state Iq between
+  * a low and a high speed. The inertia follows from the time a torque step takes to accelerate
+  * the rotor from the low to the high speed against that friction. The speed regulator is then
+  * tuned for the bandwidth OTT_Handle_t::fBW and checked on a speed ramp.
+  *
+  * Iq is in digit and the speed in rad/s of the rotor, so OTT_Handle_t::fJ is in digit.s^2/rad
+  * and OTT_Handle_t::fF in digit.s/rad; OTT_GetJ and OTT_GetF convert them in SI units.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Duration of a speed ramp of the nominal speed, ms */
+#define OTT_RAMP_NOMINAL_MS       2000.0f
+
+/* Ratio between the bandwidth and the zero of the tuned speed regulator */
+#define OTT_BW_TO_ZERO_RATIO      4.0f
+
+/* Smallest torque step used for the inertia detection, fraction of the maximum torque */
+#define OTT_MIN_TORQUE_STEP_RATIO 0.125f
+
+/* Below this product of friction and speed over the torque step the friction is neglected */
+#define OTT_MIN_FRICTION_RATIO    0.01f
+
+/* Mechanical speed in the unit defined by #SPEED_UNIT to rad/s */
+#define OTT_UNIT_TO_RADS          (6.2831853f / (float)SPEED_UNIT)
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Ramps the speed reference to a new target, in a time proportional to the speed change.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  * @param  hTargetRPM: speed target, RPM.
+  */
+static void OTT_RampToRPM(OTT_Handle_t *pHandle, int16_t hTargetRPM)
+{
+  float fDelta = (float)hTargetRPM - (((float)SPD_GetAvrgMecSpeedUnit(pHandle->pSpeedSensor) * (float)U_RPM)
+                                      / (float)SPEED_UNIT);
+  float fDurationms = (fDelta < 0.0f) ? -fDelta : fDelta;
+
+  fDurationms = (fDurationms * OTT_RAMP_NOMINAL_MS) / pHandle->fEstNominalSpdRPM;
+  (void)STC_ExecRamp(pHandle->pSTC, (int16_t)(((int32_t)hTargetRPM * (int32_t)SPEED_UNIT) / (int32_t)U_RPM),
+                     (uint32_t)fDurationms);
+  pHandle->hCurRegStabCnt = 0U;
+}
+
+/**
+  * @brief  Checks that the speed stays in OTT_Params_t::fSpeedMargin of the target for the speed
+  *         stabilization time, once the ramp is completed.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  * @param  hTargetRPM: speed target, RPM.
+  * @retval bool true once the speed is stable.
+  */
+static bool OTT_IsSpeedSettled(OTT_Handle_t *pHandle, int16_t hTargetRPM)
+{
+  float fSpeedRPM = ((float)SPD_GetAvrgMecSpeedUnit(pHandle->pSpeedSensor) * (float)U_RPM) / (float)SPEED_UNIT;
+  float fError = fSpeedRPM - (float)hTargetRPM;
+  float fMargin = pHandle->pOTT_Params_str->fSpeedMargin * (float)hTargetRPM;
+
+  if ((true == STC_RampCompleted(pHandle->pSTC)) && (fError <= fMargin) && (fError >= -fMargin))
+  {
+    pHandle->hCurRegStabCnt++;
+  }
+  else
+  {
+    pHandle->hCurRegStabCnt = 0U;
+  }
+  return (pHandle->hCurRegStabCnt >= pHandle->hSpeedStabTks);
+}
+
+/**
+  * @brief  Accumulates Iq and speed over the measurement window.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  * @param  bIndex: 0 for the low speed, 1 for the high speed.
+  * @retval bool true once the window is completed, the means are then stored in
+  *         OTT_Handle_t::hFDetIq and OTT_Handle_t::fFDetOmega.
+  */
+static bool OTT_MeasureSteadyState(OTT_Handle_t *pHandle, uint8_t bIndex)
+{
+  bool bDone = false;
+
+  pHandle->wIqsum += pHandle->pFOCVars->Iqd.q;
+  pHandle->wSpeed01Hzsum += SPD_GetAvrgMecSpeedUnit(pHandle->pSpeedSensor);
+  pHandle->hIqCnt++;
+  if (pHandle->hIqCnt >= pHandle->hMeasWinTicks)
+  {
+    pHandle->hFDetIq[bIndex] = (int16_t)(pHandle->wIqsum / (int32_t)pHandle->hIqCnt);
+    pHandle->fFDetOmega[bIndex] = ((float)pHandle->wSpeed01Hzsum * OTT_UNIT_TO_RADS) / (float)pHandle->hIqCnt;
+    pHandle->wIqsum = 0;
+    pHandle->wSpeed01Hzsum = 0;
+    pHandle->hIqCnt = 0U;
+    bDone = true;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bDone);
+}
+
+/**
+  * @brief  Computes the inertia from the acceleration time and tunes the speed regulator.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  */
+static void OTT_TuneSpeedRegulator(OTT_Handle_t *pHandle)
+{
+  PID_Handle_t *pPID = pHandle->pPIDSpeed;
+  float fTime = (float)pHandle->hJdetCnt / (float)pHandle->pOTT_Params_str->rampExtMngrParams.FrequencyHz;
+  float fDeltaOmega = pHandle->fOmegaTh - pHandle->fFDetOmega[0];
+  float fRatio = (pHandle->fF * fDeltaOmega) / (float)pHandle->hIqAcc;
+
+  /* J dw/dt = step - F (w - wL) reaches wH at t: J = -F t / ln(1 - F (wH - wL) / step) */
+  if (fRatio > OTT_MIN_FRICTION_RATIO)
+  {
+    pHandle->fJ = -(pHandle->fF * fTime) / logf(1.0f - fRatio);
+  }
+  else
+  {
+    pHandle->fJ = ((float)pHandle->hIqAcc * fTime) / fDeltaOmega;
+  }
+  pHandle->fTau = (pHandle->fF > 0.0f) ? (pHandle->fJ / pHandle->fF) : 0.0f;
+
+  /* Kp in digit per speed unit, the zero of the regulator a fraction of the bandwidth */
+  pHandle->fKp = pHandle->fJ * pHandle->fBW * OTT_UNIT_TO_RADS;
+  pHandle->fKi = (pHandle->fKp * pHandle->fBW)
+               / (OTT_BW_TO_ZERO_RATIO * (float)pHandle->pOTT_Params_str->rampExtMngrParams.FrequencyHz);
+  pHandle->fKp *= (float)PID_GetKPDivisor(pPID);
+  pHandle->fKi *= (float)PID_GetKIDivisor(pPID);
+  pHandle->fKp = (pHandle->fKp > (float)INT16_MAX) ? (float)INT16_MAX : pHandle->fKp;
+  pHandle->fKi = (pHandle->fKi > (float)INT16_MAX) ? (float)INT16_MAX : pHandle->fKi;
+  pHandle->fKi = (pHandle->fKi < 1.0f) ? 1.0f : pHandle->fKi;
+
+  PID_SetKP(pPID, (int16_t)pHandle->fKp);
+  PID_SetKI(pPID, (int16_t)pHandle->fKi);
+
+  /* Back in speed control from the present speed, the integral term carrying the present torque */
+  PID_SetIntegralTerm(pPID, (int32_t)pHandle->pFOCVars->Iqdref.q * (int32_t)PID_GetKIDivisor(pPID));
+  STC_SetControlMode(pHandle->pSTC, MCM_SPEED_MODE);
+  STC_ForceSpeedReferenceToCurrentSpeed(pHandle->pSTC);
+}
+
+/**
+  * @brief  Initializes all the object variables, usually it has to be called
+  *         once right after object creation.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  */
+__weak void OTT_Init(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pOTT_Params_t pParams = pHandle->pOTT_Params_str;
+    float fFreq = (float)pParams->rampExtMngrParams.FrequencyHz;
+
+    pHandle->fBW = pParams->fBWdef;
+    pHandle->bPolesPairs = pParams->bPolesPairs;
+    pHandle->hMaxPositiveTorque = pParams->hMaxPositiveTorque;
+    pHandle->hMeasWinTicks = (uint16_t)(pParams->fMeasWin * fFreq);
+    pHandle->hCurRegStabTks = (uint16_t)(pParams->fCurrtRegStabTimeSec * fFreq);
+    pHandle->hSpeedStabTks = (uint16_t)(pParams->fSpeedStabTimeSec * fFreq);
+    pHandle->hTimeOutTks = (uint16_t)(pParams->fTimeOutSec * fFreq);
+    pHandle->wNominalSpeed = pParams->wNominalSpeed;
+    pHandle->fEstNominalSpdRPM = (float)pParams->wNominalSpeed;
+    pHandle->spdKp = pParams->spdKp;
+    pHandle->spdKi = pParams->spdKi;
+    pHandle->spdKs = pParams->spdKs;
+    pHandle->fJ = 0.0f;
+    pHandle->fF = 0.0f;
+    pHandle->fKe = 0.0f;
+    pHandle->bPI_Tuned = false;
+    OTT_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @brief  Resets the state of the OneTouchTuning procedure.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  */
+__weak void OTT_Clear(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bState = OTT_IDLE;
+    pHandle->wIqsum = 0;
+    pHandle->wSpeed01Hzsum = 0;
+    pHandle->hIqCnt = 0U;
+    pHandle->wCnt = 0;
+    pHandle->hCurRegStabCnt = 0U;
+    pHandle->hJdetCnt = 0U;
+    pHandle->stabCnt = 0;
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @brief  Starts the OneTouchTuning procedure, the motor running in speed control on
+  *         OTT_Handle_t::pSpeedSensor.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  *
+  * - The speed regulator restarts from the conservative gains OTT_Params_t::spdKp and OTT_Params_t::spdKi.
+  * - OTT_Handle_t::fEstNominalSpdRPM shall be set before, the test speeds are fractions of it.
+  */
+__weak void OTT_SR(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    OTT_Clear(pHandle);
+    PID_SetKP(pHandle->pPIDSpeed, (int16_t)pHandle->spdKp);
+    PID_SetKI(pHandle->pPIDSpeed, (int16_t)pHandle->spdKi);
+    pHandle->hTargetHRPM = (int16_t)(pHandle->pOTT_Params_str->fOttHighSpeedPerc * pHandle->fEstNominalSpdRPM);
+    pHandle->hTargetLRPM = (int16_t)(pHandle->pOTT_Params_str->fOttLowSpeedPerc * pHandle->fEstNominalSpdRPM);
+    pHandle->bPI_Tuned = false;
+    OTT_RampToRPM(pHandle, pHandle->hTargetHRPM);
+    pHandle->bState = OTT_NOMINAL_SPEED_DET;
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @brief  Runs the OneTouchTuning state machine, called at the medium frequency
+  *         OTT_Params_t::rampExtMngrParams FrequencyHz.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  *
+  * - A state lasting more than the timeout aborts the procedure back to #OTT_IDLE.
+  */
+__weak void OTT_MF(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    OTT_State_t bPrevState = pHandle->bState;
+
+    switch (pHandle->bState)
+    {
+      case OTT_NOMINAL_SPEED_DET:
+      {
+        if (true == OTT_IsSpeedSettled(pHandle, pHandle->hTargetHRPM))
+        {
+          pHandle->bState = OTT_H_SPEED_TEST;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_H_SPEED_TEST:
+      {
+        if (true == OTT_MeasureSteadyState(pHandle, 1U))
+        {
+          pHandle->hIqNominal = pHandle->hFDetIq[1];
+          OTT_RampToRPM(pHandle, pHandle->hTargetLRPM);
+          pHandle->bState = OTT_RAMP_DOWN_L_SPEED;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_RAMP_DOWN_L_SPEED:
+      {
+        if (true == OTT_IsSpeedSettled(pHandle, pHandle->hTargetLRPM))
+        {
+          pHandle->bState = OTT_L_SPEED_TEST;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_L_SPEED_TEST:
+      {
+        if (true == OTT_MeasureSteadyState(pHandle, 0U))
+        {
+          float fDeltaIq = (float)pHandle->hFDetIq[1] - (float)pHandle->hFDetIq[0];
+
+          pHandle->fF = fDeltaIq / (pHandle->fFDetOmega[1] - pHandle->fFDetOmega[0]);
+          pHandle->fF = (pHandle->fF < 0.0f) ? 0.0f : pHandle->fF;
+          pHandle->bState = OTT_DYNAMICS_DET_SET_TORQUE;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_DYNAMICS_DET_SET_TORQUE:
+      {
+        int32_t wStep = 2 * ((int32_t)pHandle->hFDetIq[1] - (int32_t)pHandle->hFDetIq[0]);
+        int32_t wMinStep = (int32_t)((float)pHandle->hMaxPositiveTorque * OTT_MIN_TORQUE_STEP_RATIO);
+        int32_t wMaxStep = (int32_t)pHandle->hMaxPositiveTorque - (int32_t)pHandle->hFDetIq[0];
+
+        wStep = (wStep < wMinStep) ? wMinStep : wStep;
+        wStep = (wStep > wMaxStep) ? wMaxStep : wStep;
+        pHandle->hIqAcc = (int16_t)wStep;
+        pHandle->fOmegaTh = pHandle->fFDetOmega[1];
+        pHandle->hJdetCnt = 0U;
+        STC_SetControlMode(pHandle->pSTC, MCM_TORQUE_MODE);
+        (void)STC_ExecRamp(pHandle->pSTC, (int16_t)(pHandle->hFDetIq[0] + pHandle->hIqAcc), 0U);
+        pHandle->bState = OTT_DYNAMICS_DETECTION;
+        break;
+      }
+
+      case OTT_DYNAMICS_DETECTION:
+      {
+        pHandle->hJdetCnt++;
+        if (((float)SPD_GetAvrgMecSpeedUnit(pHandle->pSpeedSensor) * OTT_UNIT_TO_RADS) >= pHandle->fOmegaTh)
+        {
+          OTT_TuneSpeedRegulator(pHandle);
+          OTT_RampToRPM(pHandle, pHandle->hTargetHRPM);
+          pHandle->bState = OTT_RAMP_DOWN_H_SPEED;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_RAMP_DOWN_H_SPEED:
+      {
+        /* The tuned regulator first catches the overshoot of the torque step */
+        if (true == OTT_IsSpeedSettled(pHandle, pHandle->hTargetHRPM))
+        {
+          OTT_RampToRPM(pHandle, pHandle->hTargetLRPM);
+          pHandle->bState = OTT_DYNAMICS_DET_RAMP_DOWN;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case OTT_DYNAMICS_DET_RAMP_DOWN:
+      {
+        /* Then follows a speed ramp */
+        if (true == OTT_IsSpeedSettled(pHandle, pHandle->hTargetLRPM))
+        {
+          pHandle->bPI_Tuned = true;
+          pHandle->bState = OTT_END;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+
+    if ((OTT_IDLE == pHandle->bState) || (OTT_END == pHandle->bState) || (bPrevState != pHandle->bState))
+    {
+      pHandle->wCnt = 0;
+    }
+    else
+    {
+      pHandle->wCnt++;
+      if (pHandle->wCnt > (int32_t)pHandle->hTimeOutTks)
+      {
+        pHandle->bState = OTT_IDLE;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @brief  Forces a new tuning at the next procedure.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  */
+__weak void OTT_ForceTuning(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bPI_Tuned = false;
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the nominal speed the test speeds are computed from.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  * @retval float nominal speed, RPM.
+  */
+__weak float OTT_fGetNominalSpeedRPM(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  return ((MC_NULL == pHandle) ? 0.0f : pHandle->fEstNominalSpdRPM);
+#else
+  return (pHandle->fEstNominalSpdRPM);
+#endif
+}
+
+/**
+  * @brief  Aborts the procedure if it is not completed, the tuned gains are kept.
+  * @param  pHandle: handler of the current instance of the OneTouchTuning component.
+  */
+__weak void OTT_Stop(OTT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_OTT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (OTT_END == pHandle->bState)
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      OTT_Clear(pHandle);
+    }
+#ifdef NULL_PTR_CHECK_OTT
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
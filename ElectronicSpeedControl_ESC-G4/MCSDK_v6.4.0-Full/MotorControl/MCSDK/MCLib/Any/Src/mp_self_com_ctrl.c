@@ -0,0 +1,1586 @@
+/**
+  ******************************************************************************
+  * @file    mp_self_com_ctrl.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Self Commissioning component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup SelfComCtrl
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mp_self_com_ctrl.h"
+#include "mcp.h"
+
+/** @addtogroup STM32_PMSM_MC_Library
+  * @{
+  */
+
+/** @defgroup SelfComCtrl Self Commissioning
+  * @brief Measurement of the motor parameters and tuning of the drive on the motor
+  *
+  * The procedure runs in the PROFILE state of the motor control state machine:
+  *
+  * - The rotor is aligned on the alpha axis by a DC current, the current regulators bypassed:
+  *   SCC_SetPhaseVoltage imposes the alpha voltage every current control period.
+  * - R: the DC voltage is regulated on #RSCURRLEVELNUM current levels, the slope of voltage
+  *   versus current is the resistance, the intercept the inverter voltage drop.
+  * - L: a square wave is added to the DC voltage, the inductance is the voltage over the
+  *   current slope. The voltage applied between two samples is the mean of the last two
+  *   voltages set, as in the flux observers. The current regulators are tuned on R and L.
+  * - Ke: the rotor is dragged in current mode by the virtual speed sensor up to half the
+  *   nominal speed, the back-EMF is computed from the regulated voltages on #EMF_BUFF_VAL
+  *   speed points. The observer is retuned on R, L and Ke, then takes over the speed loop.
+  * - J and friction: @ref OneTouchTuning runs in closed loop and tunes the speed regulator.
+  * - The rev-up is set from Ke, the start-up current and the inertia.
+  *
+  * The results are applied to the running components. At the end of a complete run, the motor
+  * task copies them to the @ref ParamStore "parameter store" and requests their commit to the
+  * flash, so that they are loaded at the next boot.
+  *
+  * Voltages are read in s16V, Vbus / sqrt(3) being 32767, currents in s16A, M1_MAX_READABLE_CURRENT
+  * being 32767.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Half period of the square wave of the L detection, current control periods */
+#define SCC_LS_HALF_PERIOD        4u
+
+/* Acceleration of the speed points of the Ke detection, RPM/s */
+#define SCC_KE_ACC_RPM_S          1000.0f
+
+/* Settling and measurement time of each speed point of the Ke detection, ms */
+#define SCC_KE_SETTLE_MS          200u
+#define SCC_KE_MEAS_MS            200u
+
+/* Fraction of the maximum voltage ending the Ke detection */
+#define SCC_KE_MAX_VOLTAGE_RATIO  0.8f
+
+/* Band around the forced speed the observer has to stay in, and for how long, before the switch over */
+#define SCC_PLL_TRACK_BAND        0.1f
+#define SCC_PLL_TRACK_TICKS       100
+#define SCC_PLL_TIMEOUT_MS        2000u
+
+/* Duration of the switch over from the virtual speed sensor to the observer, ms */
+#define SCC_SWITCH_OVER_MS        100u
+
+/* Wait after an over current before restarting the R and L detection, ms */
+#define SCC_WAIT_RESTART_MS       500u
+
+/* Current reduction after an over current */
+#define SCC_OC_CURRENT_REDUCTION  0.75f
+
+/* Margins of the rev-up: final speed over the start-up validation speed, and fraction of the
+   acceleration the start-up current could give */
+#define SCC_STARTUP_SPEED_MARGIN  1.2f
+#define SCC_STARTUP_ACC_MARGIN    0.5f
+
+/* Gain of the voltage integrator of the R detection */
+#define SCC_RS_LOOP_GAIN          0.5f
+
+/* Torque constant, Nm/A, per Vrms ph-ph/kRPM of voltage constant */
+#define SCC_KT_PER_KE             0.0116955f
+
+#define SCC_SQRT3                 1.7320508f
+#define SCC_SQRT2                 1.4142136f
+#define SCC_TWO_PI                6.2831853f
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Converts a voltage in s16V to Volt.
+  * @param  pHandle: handler of SCC component.
+  * @param  fS16: voltage, s16V.
+  */
+static inline float SCC_S16ToVolt(const SCC_Handle_t *pHandle, float fS16)
+{
+  return ((fS16 * pHandle->fBusV) / (SCC_SQRT3 * 32768.0f));
+}
+
+/**
+  * @brief  Converts a current in s16A to Ampere.
+  * @param  pHandle: handler of SCC component.
+  * @param  fS16: current, s16A.
+  */
+static inline float SCC_S16ToAmp(const SCC_Handle_t *pHandle, float fS16)
+{
+  return ((fS16 * pHandle->fMax_current) / 32768.0f);
+}
+
+/**
+  * @brief  Converts a current in Ampere to s16A.
+  * @param  pHandle: handler of SCC component.
+  * @param  fAmp: current, A.
+  */
+static inline int16_t SCC_AmpToS16(const SCC_Handle_t *pHandle, float fAmp)
+{
+  return ((int16_t)((fAmp * 32768.0f) / pHandle->fMax_current));
+}
+
+/**
+  * @brief  Converts a number of milliseconds in medium frequency ticks.
+  * @param  pHandle: handler of SCC component.
+  * @param  wms: duration, ms.
+  */
+static inline uint32_t SCC_MsToTicks(const SCC_Handle_t *pHandle, uint32_t wms)
+{
+  return ((wms * pHandle->pREMng->FrequencyHz) / 1000u);
+}
+
+/**
+  * @brief  Aborts the procedure with a fault, SCC_Stop is then called by the state machine.
+  * @param  pHandle: handler of SCC component.
+  * @param  hFaultCode: fault to raise.
+  */
+static void SCC_Fail(SCC_Handle_t *pHandle, uint16_t hFaultCode)
+{
+  pHandle->hVAlpha = 0;
+  MCI_FaultProcessing(pHandle->pMCI, hFaultCode, 0);
+}
+
+/**
+  * @brief  Clamps a gain in the range of an int16_t.
+  * @param  fGain: gain to clamp.
+  * @param  pResult: clamped gain.
+  * @retval bool true if the gain was in range.
+  */
+static bool SCC_ToInt16(float fGain, int16_t *pResult)
+{
+  bool bInRange = true;
+
+  if (fGain > (float)INT16_MAX)
+  {
+    *pResult = INT16_MAX;
+    bInRange = false;
+  }
+  else if (fGain < (float)INT16_MIN)
+  {
+    *pResult = INT16_MIN;
+    bInRange = false;
+  }
+  else
+  {
+    *pResult = (int16_t)fGain;
+  }
+  return (bInRange);
+}
+
+/**
+  * @brief  Starts the R and L detection: the alpha voltage is ramped until the current
+  *         reaches SCC_Handle_t::fLastTargetCurr.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_StartRL(SCC_Handle_t *pHandle)
+{
+  /* Enter critical section */
+  /* Disable interrupts so that the HF task sees the new state with cleared sums */
+  __disable_irq();
+  pHandle->hVAlpha = 0;
+  pHandle->hVAlphaPrev[0] = 0;
+  pHandle->hVAlphaPrev[1] = 0;
+  pHandle->hIAlphaPrev = 0;
+  pHandle->hIPeak = 0u;
+  pHandle->hDutyMax = 0u;
+  pHandle->fIsum = 0.0f;
+  pHandle->fVsum = 0.0f;
+  pHandle->wICnt = 0u;
+  pHandle->wLSTimeCnt = 0u;
+  pHandle->sm_state = SCC_DUTY_DETECTING_PHASE;
+
+  /* Exit critical section */
+  __enable_irq();
+
+  pHandle->bRSCurrLevelTests = 0u;
+  pHandle->hMFCount = 0u;
+  REMNG_Init(pHandle->pREMng);
+  (void)REMNG_ExecRamp(pHandle->pREMng, 0, 0u);
+  (void)REMNG_ExecRamp(pHandle->pREMng, (int32_t)pHandle->hMax_voltage / 2, pHandle->pSCC_Params_str->hDutyRampDuration);
+}
+
+/**
+  * @brief  Takes the mean alpha current measured by the HF task since the last call.
+  * @param  pHandle: handler of SCC component.
+  * @retval float mean alpha current, A.
+  */
+static float SCC_TakeMeanCurrent(SCC_Handle_t *pHandle)
+{
+  float fIsum;
+  uint32_t wICnt;
+
+  /* Enter critical section */
+  __disable_irq();
+  fIsum = pHandle->fIsum;
+  wICnt = pHandle->wICnt;
+  pHandle->fIsum = 0.0f;
+  pHandle->wICnt = 0u;
+
+  /* Exit critical section */
+  __enable_irq();
+
+  return ((0u == wICnt) ? 0.0f : (fIsum / (float)wICnt));
+}
+
+/**
+  * @brief  Regulates the alpha voltage so that the mean current reaches SCC_Handle_t::fTargetCurr.
+  * @param  pHandle: handler of SCC component.
+  * @retval float mean alpha current of the last medium frequency period, A.
+  */
+static float SCC_RegulateRSCurrent(SCC_Handle_t *pHandle)
+{
+  float fImean = SCC_TakeMeanCurrent(pHandle);
+  float fVAlpha = (float)pHandle->hVAlpha;
+
+  /* Integral control, the plant gain taken from the voltage found by the duty detection */
+  fVAlpha += ((SCC_RS_LOOP_GAIN * (float)pHandle->hDutyMax) / pHandle->fLastTargetCurr)
+           * (pHandle->fTargetCurr - fImean);
+  fVAlpha = (fVAlpha < 0.0f) ? 0.0f : fVAlpha;
+  fVAlpha = (fVAlpha > (float)pHandle->hMax_voltage) ? (float)pHandle->hMax_voltage : fVAlpha;
+  pHandle->hVAlpha = (int16_t)fVAlpha;
+  return (fImean);
+}
+
+/**
+  * @brief  Sets the current of the next R detection level.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_NextRSLevel(SCC_Handle_t *pHandle)
+{
+  /* From the full current down, the first level continues the alignment */
+  pHandle->fTargetCurr = (pHandle->fLastTargetCurr * (float)(RSCURRLEVELNUM - pHandle->bRSCurrLevelTests))
+                       / (float)RSCURRLEVELNUM;
+  pHandle->fImaxArray[pHandle->bRSCurrLevelTests] = 0.0f;
+  pHandle->fVmaxArray[pHandle->bRSCurrLevelTests] = 0.0f;
+  pHandle->index = 0u;
+  pHandle->hMFCount = 0u;
+  pHandle->sm_state = SCC_RS_DETECTING_PHASE_RAMP;
+}
+
+/**
+  * @brief  Computes R and the inverter drop from the current levels and starts the L detection.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_EndRSDetection(SCC_Handle_t *pHandle)
+{
+  float fSumI = 0.0f;
+  float fSumV = 0.0f;
+  float fSumII = 0.0f;
+  float fSumIV = 0.0f;
+  float fN = (float)RSCURRLEVELNUM;
+  float fSlope;
+  uint8_t i;
+
+  for (i = 0u; i < RSCURRLEVELNUM; i++)
+  {
+    fSumI += pHandle->fImaxArray[i];
+    fSumV += pHandle->fVmaxArray[i];
+    fSumII += pHandle->fImaxArray[i] * pHandle->fImaxArray[i];
+    fSumIV += pHandle->fImaxArray[i] * pHandle->fVmaxArray[i];
+  }
+  fSlope = ((fN * fSumIV) - (fSumI * fSumV)) / ((fN * fSumII) - (fSumI * fSumI));
+  pHandle->fVdt = (fSumV - (fSlope * fSumI)) / fN;
+
+  if (PB_CHARACTERIZATION_DISABLE != pHandle->pSCC_Params_str->bPBCharacterization)
+  {
+    /* Phases shorted at the board output: the slope is the resistance of the power board */
+    pHandle->fResistorOffset = fSlope;
+    pHandle->hVAlpha = 0;
+    pHandle->sm_state = SCC_PHASE_STOP;
+    (void)MCI_StopMotor(pHandle->pMCI);
+  }
+  else
+  {
+    pHandle->fRS = fSlope - pHandle->fResistorOffset;
+    if (pHandle->fRS <= 0.0f)
+    {
+      SCC_Fail(pHandle, MC_SW_ERROR);
+    }
+    else
+    {
+      /* Square wave between the voltages of the 2 mid levels, swinging over the 4 levels */
+      float fV0 = (pHandle->fVmaxArray[1] + pHandle->fVmaxArray[2]) / 2.0f;
+      float fDeltaV = (pHandle->fVmaxArray[0] - pHandle->fVmaxArray[RSCURRLEVELNUM - 1u]) / 2.0f;
+      float fToS16 = (SCC_SQRT3 * 32768.0f) / pHandle->fBusV;
+      uint32_t wPeriod = 2u * SCC_LS_HALF_PERIOD;
+      uint32_t wTestCnt = ((uint32_t)pHandle->pSCC_Params_str->hRSDetectionDuration
+                         * (uint32_t)pHandle->fFocRate) / 1000u;
+
+      pHandle->fLSsum = 0.0f;
+
+      /* Enter critical section */
+      __disable_irq();
+      pHandle->hLSMeanVoltage = (int16_t)(fV0 * fToS16);
+      pHandle->hLSDeltaVoltage = (int16_t)(fDeltaV * fToS16);
+      pHandle->wLSTestCnt = (((wTestCnt / wPeriod) + 1u) * wPeriod);
+      pHandle->wLSTimeCnt = 0u;
+      pHandle->fIsum = 0.0f;
+      pHandle->fVsum = 0.0f;
+      pHandle->sm_state = SCC_LS_DETECTING_PHASE;
+
+      /* Exit critical section */
+      __enable_irq();
+    }
+  }
+}
+
+/**
+  * @brief  Tunes the current regulators for the bandwidth SCC_Handle_t::fCurrentBW on the measured R and L.
+  * @param  pHandle: handler of SCC component.
+  *
+  * - Kp = L x BW, Ki = R x BW x Ts, from A to s16A and from s16V to V at the present bus voltage.
+  */
+static void SCC_SetCurrentRegulators(SCC_Handle_t *pHandle)
+{
+  float fScale = (pHandle->fMax_current * SCC_SQRT3) / pHandle->fBusV;
+  float fR = pHandle->fRS + pHandle->fResistorOffset;
+  float fKpd = pHandle->fLS * pHandle->fCurrentBW * fScale * (float)PID_GetKPDivisor(pHandle->pPIDId);
+  float fKpq = ((pHandle->fLS / pHandle->fLdLqRatio) * pHandle->fCurrentBW * fScale)
+             * (float)PID_GetKPDivisor(pHandle->pPIDIq);
+  float fKi = (fR * pHandle->fCurrentBW * fScale) / pHandle->fFocRate;
+  int16_t hGain;
+
+  (void)SCC_ToInt16(fKpd, &hGain);
+  PID_SetKP(pHandle->pPIDId, hGain);
+  (void)SCC_ToInt16(fKpq, &hGain);
+  PID_SetKP(pHandle->pPIDIq, hGain);
+  (void)SCC_ToInt16(fKi * (float)PID_GetKIDivisor(pHandle->pPIDId), &hGain);
+  PID_SetKI(pHandle->pPIDId, hGain);
+  (void)SCC_ToInt16(fKi * (float)PID_GetKIDivisor(pHandle->pPIDIq), &hGain);
+  PID_SetKI(pHandle->pPIDIq, hGain);
+}
+
+/**
+  * @brief  Starts the Ke detection: the rotor, aligned on the alpha axis, is dragged by a q current
+  *         rotating at the speed of the virtual speed sensor.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_StartKeDetection(SCC_Handle_t *pHandle)
+{
+  pFOCVars_t pFOCVars = pHandle->pFOCVars;
+  qd_t Iqdref;
+
+  SCC_SetCurrentRegulators(pHandle);
+  STC_SetSpeedSensor(pHandle->pSTC, &pHandle->pVSS->_Super);
+  VSS_Clear(pHandle->pVSS);
+
+  /* The q axis on the alpha axis: the first current vector is the one of the alignment */
+  VSS_SetElAngle(pHandle->pVSS, -16384);
+  STO_PLL_Clear(pHandle->pSTO);
+  STO_SetDirection(pHandle->pSTO, 1);
+
+  Iqdref.q = SCC_AmpToS16(pHandle, pHandle->fLastTargetCurr);
+  Iqdref.d = 0;
+  pFOCVars->bDriveInput = EXTERNAL;
+  pFOCVars->Iqdref = Iqdref;
+  PID_SetIntegralTerm(pHandle->pPIDIq, (int32_t)pHandle->hVAlpha * (int32_t)PID_GetKIDivisor(pHandle->pPIDIq));
+  PID_SetIntegralTerm(pHandle->pPIDId, 0);
+
+  pHandle->hVal_ctn = 0u;
+  pHandle->res = RampIdle;
+  pHandle->wMaxOLSpeed = 0;
+  pHandle->KEDetState = KEDET_REVUP;
+  pHandle->sm_state = SCC_KE_DETECTING_PHASE;
+}
+
+/**
+  * @brief  Ends the L detection and starts the Ke detection.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_EndLSDetection(SCC_Handle_t *pHandle)
+{
+  float fIsum;
+  float fVsum;
+
+  /* Enter critical section */
+  __disable_irq();
+  fIsum = pHandle->fIsum;
+  fVsum = pHandle->fVsum;
+  pHandle->hVAlpha = pHandle->hLSMeanVoltage;
+
+  /* Exit critical section */
+  __enable_irq();
+
+  /* Sum of s x (v - R i) over the sum of s x di, di per current control period */
+  if (fIsum <= 0.0f)
+  {
+    SCC_Fail(pHandle, MC_SW_ERROR);
+  }
+  else
+  {
+    pHandle->fLS = fVsum / (fIsum * pHandle->fFocRate);
+    pHandle->fLSsum = fVsum;
+    SCC_StartKeDetection(pHandle);
+  }
+}
+
+/**
+  * @brief  Commands the ramp of the virtual speed sensor to a Ke detection speed point.
+  * @param  pHandle: handler of SCC component.
+  * @param  fTargetRPM: speed of the point, RPM.
+  */
+static void SCC_RampToSpeedPoint(SCC_Handle_t *pHandle, float fTargetRPM)
+{
+  float fSpeedRPM = ((float)SPD_GetAvrgMecSpeedUnit(&pHandle->pVSS->_Super) * (float)U_RPM) / (float)SPEED_UNIT;
+  float fDelta = fTargetRPM - fSpeedRPM;
+
+  fDelta = (fDelta < 0.0f) ? -fDelta : fDelta;
+  VSS_SetMecAcceleration(pHandle->pVSS, (int16_t)((fTargetRPM * (float)SPEED_UNIT) / (float)U_RPM),
+                         (uint16_t)((fDelta * 1000.0f) / SCC_KE_ACC_RPM_S));
+  pHandle->wKeAcqCnt = 0u;
+  pHandle->hMFCount = 0u;
+  pHandle->fVdsum = 0.0f;
+  pHandle->fVqsum = 0.0f;
+  pHandle->fIqsum = 0.0f;
+  pHandle->fIsum = 0.0f;
+  pHandle->fFesum = 0.0f;
+  pHandle->res = RampOngoing;
+}
+
+/**
+  * @brief  Ends the present speed point of the Ke detection.
+  * @param  pHandle: handler of SCC component.
+  * @retval bool true if the detection shall move to the next speed point.
+  *
+  * - The back-EMF is the regulated voltage minus the resistive, inverter and inductive drops.
+  * - A back-EMF not growing with the speed means that the rotor lost the rotating current.
+  */
+static bool SCC_EndSpeedPoint(SCC_Handle_t *pHandle)
+{
+  bool bContinue = false;
+  float fN = (float)pHandle->wKeAcqCnt;
+  float fVd = SCC_S16ToVolt(pHandle, pHandle->fVdsum / fN);
+  float fVq = SCC_S16ToVolt(pHandle, pHandle->fVqsum / fN);
+  float fId = SCC_S16ToAmp(pHandle, pHandle->fIsum / fN);
+  float fIq = SCC_S16ToAmp(pHandle, pHandle->fIqsum / fN);
+  float fOmega = ((pHandle->fFesum / fN) * SCC_TWO_PI * pHandle->fPP) / (float)SPEED_UNIT;
+  float fImod = sqrtf((fId * fId) + (fIq * fIq));
+  float fLd = pHandle->fLS;
+  float fLq = pHandle->fLS / pHandle->fLdLqRatio;
+
+  /* Fundamental of the inverter drop, along the current */
+  float fRdt = pHandle->fRS + pHandle->fResistorOffset + ((3.0f * pHandle->fVdt) / (3.1415927f * fImod));
+  float fEd = fVd - (fRdt * fId) + (fOmega * fLq * fIq);
+  float fEq = fVq - (fRdt * fIq) - (fOmega * fLd * fId);
+  float fEm = sqrtf((fEd * fEd) + (fEq * fEq));
+  float fVmod = sqrtf(((pHandle->fVdsum * pHandle->fVdsum) + (pHandle->fVqsum * pHandle->fVqsum)) / (fN * fN));
+  uint16_t i = pHandle->hVal_ctn;
+
+  if ((i > 0u) && (fEm < (pHandle->fEm_val[i - 1u] * (1.0f + (((fOmega / pHandle->fw_val[i - 1u]) - 1.0f) / 2.0f)))))
+  {
+    pHandle->res = LoseControl;
+    pHandle->wLoseControlAtRPM = (uint32_t)((fOmega * 60.0f) / (SCC_TWO_PI * pHandle->fPP));
+  }
+  else
+  {
+    pHandle->fEm_val[i] = fEm;
+    pHandle->fw_val[i] = fOmega;
+    pHandle->hVal_ctn++;
+    pHandle->wMaxOLSpeed = (int32_t)((fOmega * 60.0f) / (SCC_TWO_PI * pHandle->fPP));
+    pHandle->res = RampSucces;
+    bContinue = (pHandle->hVal_ctn < EMF_BUFF_VAL) && (fVmod < (SCC_KE_MAX_VOLTAGE_RATIO * (float)pHandle->hMax_voltage));
+  }
+  return (bContinue);
+}
+
+/**
+  * @brief  Computes Ke from the speed points, the back-EMF being linear with the speed.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_ComputeKe(SCC_Handle_t *pHandle)
+{
+  float fN = (float)pHandle->hVal_ctn;
+  float fSumW = 0.0f;
+  float fSumE = 0.0f;
+  float fSumWW = 0.0f;
+  float fSumWE = 0.0f;
+  float fFlux;
+  uint16_t i;
+
+  for (i = 0u; i < pHandle->hVal_ctn; i++)
+  {
+    fSumW += pHandle->fw_val[i];
+    fSumE += pHandle->fEm_val[i];
+    fSumWW += pHandle->fw_val[i] * pHandle->fw_val[i];
+    fSumWE += pHandle->fw_val[i] * pHandle->fEm_val[i];
+  }
+
+  /* Slope with intercept, the intercept taking the residual of the inverter drop */
+  fFlux = ((fN * fSumWE) - (fSumW * fSumE)) / ((fN * fSumWW) - (fSumW * fSumW));
+
+  /* Wb peak to Vrms ph-ph/kRPM */
+  pHandle->fKe = (fFlux * ((1000.0f * SCC_TWO_PI * pHandle->fPP) / 60.0f) * SCC_SQRT3) / SCC_SQRT2;
+  OTT_SetKe(pHandle->pOTT, pHandle->fKe);
+}
+
+/**
+  * @brief  Retunes the observer on the given R, L and Ke.
+  * @param  pHandle: handler of SCC component.
+  * @param  fRS: stator resistance, Ohm.
+  * @param  fLS: stator inductance, H.
+  * @param  fKe: Bemf constant, Vrms ph-ph/kRPM.
+  * @retval bool false if a constant of the observer is out of range, the observer being then unchanged.
+  *
+  * - The Bemf full scale of the observer is scaled with Ke, so that the Bemf in digit per speed unit,
+  *   the PLL gains and the Bemf consistency check are unchanged.
+  * - C1 ~ R / L, C3 ~ Ke / L, C5 ~ 1 / L, C4 ~ L / Ke. The gain schedule is copied in RAM with C2 moved
+  *   by the change of C1.
+  */
+static bool SCC_TuneObserver(SCC_Handle_t *pHandle, float fRS, float fLS, float fKe)
+{
+  STO_PLL_Handle_t *pSTO = pHandle->pSTO;
+  VirtualSpeedSensor_Handle_t *pVSS = pHandle->pVSS;
+  STO_PLL_GainSchedPoint_t Sched[SCC_OBS_GAIN_SCHED_MAX];
+  STO_PLL_GainSchedPoint_t Gains;
+  float fLRatio = pHandle->fLSApplied / fLS;
+  float fKeRatio = fKe / pHandle->fKeApplied;
+  uint8_t bSize = ((MC_NULL == pSTO->pGainSched) ? 0u : pSTO->bGainSchedSize);
+  int16_t hC1;
+  int16_t hC2;
+  int16_t hC3;
+  int16_t hC4;
+  int16_t hC5;
+  int16_t hC1Delta;
+  bool bInRange;
+  uint8_t i;
+
+  bInRange = SCC_ToInt16(((float)pSTO->hF1 * fRS) / (fLS * pHandle->fFocRate), &hC1);
+  bInRange = SCC_ToInt16((float)pSTO->hC3 * fKeRatio * fLRatio, &hC3) && bInRange;
+  bInRange = SCC_ToInt16((float)pSTO->hC5 * fLRatio, &hC5) && bInRange;
+  hC1Delta = hC1 - pSTO->hC1Rated;
+  bInRange = SCC_ToInt16((float)pSTO->hC2 + (float)hC1 - (float)pSTO->hC1, &hC2) && bInRange;
+  bInRange = SCC_ToInt16((float)pSTO->hC4 / (fKeRatio * fLRatio), &hC4) && bInRange;
+  bInRange = (bSize <= SCC_OBS_GAIN_SCHED_MAX) && bInRange;
+
+  for (i = 0u; (i < bSize) && (true == bInRange); i++)
+  {
+    Sched[i] = pSTO->pGainSched[i];
+    bInRange = SCC_ToInt16((float)Sched[i].hC2 + (float)hC1Delta, &Sched[i].hC2) && bInRange;
+    bInRange = SCC_ToInt16((float)Sched[i].hC4 / (fKeRatio * fLRatio), &Sched[i].hC4) && bInRange;
+  }
+
+  if (true == bInRange)
+  {
+    /* The observed Bemf is detected at a speed inversely proportional to Ke */
+    float fMinValid = ((float)pSTO->MinStartUpValidSpeed) / fKeRatio;
+    uint16_t hMinValid = (fMinValid > (float)pHandle->pSTC->MaxAppPositiveMecSpeedUnit)
+                       ? pHandle->pSTC->MaxAppPositiveMecSpeedUnit : (uint16_t)fMinValid;
+
+    for (i = 0u; i < bSize; i++)
+    {
+      pHandle->ObsGainSched[i] = Sched[i];
+    }
+
+    /* Enter critical section */
+    /* Disable interrupts so that the HF task never runs the observer with a mix of old and new constants */
+    __disable_irq();
+    pSTO->hC1 = hC1;
+    pSTO->hC1Rated = hC1;
+    pSTO->hC2 = hC2;
+    pSTO->hC3 = hC3;
+    pSTO->hC4 = hC4;
+    pSTO->hC5 = hC5;
+    if (bSize > 0u)
+    {
+      pSTO->pGainSched = pHandle->ObsGainSched;
+    }
+    else
+    {
+      /* Nothing to do, fixed gains */
+    }
+    STO_PLL_CalcScheduledGains(pSTO, SPD_GetAvrgMecSpeedUnit(&pVSS->_Super), &Gains);
+    STO_PLL_SetObserverGains(pSTO, Gains.hC2, Gains.hC4);
+    STO_SetPLLGains(pSTO, Gains.hPLLKpGain, Gains.hPLLKiGain);
+
+    /* Exit critical section */
+    __enable_irq();
+
+    STO_SetMinStartUpValidSpeedUnit(pSTO, hMinValid);
+    pHandle->pRevupCtrl->hMinStartUpValidSpeed = hMinValid;
+    pHandle->pRevupCtrl->hMinStartUpFlySpeed = (int16_t)(hMinValid / 2u);
+    pHandle->fRSApplied = fRS;
+    pHandle->fLSApplied = fLS;
+    pHandle->fKeApplied = fKe;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bInRange);
+}
+
+/**
+  * @brief  Retunes the observer on the measured R, L and Ke, then presets its PLL on the forced rotor.
+  * @param  pHandle: handler of SCC component.
+  * @retval bool false if a constant of the observer is out of range, the observer being then unchanged.
+  */
+static bool SCC_SetObserverParams(SCC_Handle_t *pHandle)
+{
+  VirtualSpeedSensor_Handle_t *pVSS = pHandle->pVSS;
+  bool bInRange = SCC_TuneObserver(pHandle, pHandle->fRS, pHandle->fLS, pHandle->fKe);
+
+  if (true == bInRange)
+  {
+    /* Enter critical section */
+    __disable_irq();
+    STO_SetPLL(pHandle->pSTO, pVSS->_Super.hElSpeedDpp, pVSS->_Super.hElAngle);
+
+    /* Exit critical section */
+    __enable_irq();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bInRange);
+}
+
+/**
+  * @brief  Sets the rev-up on the start-up current, the observer validation speed and the inertia.
+  * @param  pHandle: handler of SCC component.
+  *
+  * - The acceleration is a fraction of the one the start-up current gives on the inertia alone.
+  */
+static void SCC_SetRevUp(SCC_Handle_t *pHandle)
+{
+  RevUpCtrl_Handle_t *pRUC = pHandle->pRevupCtrl;
+  float fJ = OTT_GetJ(pHandle->pOTT);
+  float fFinalUnit = SCC_STARTUP_SPEED_MARGIN * (float)pRUC->hMinStartUpValidSpeed;
+  float fFinalRPM;
+  float fDurationms = 65535.0f;
+  int16_t hTorque = SCC_AmpToS16(pHandle, pHandle->fLastTargetCurr);
+  uint8_t i;
+
+  fFinalUnit = (fFinalUnit > (float)pHandle->pSTC->MaxAppPositiveMecSpeedUnit)
+             ? (float)pHandle->pSTC->MaxAppPositiveMecSpeedUnit : fFinalUnit;
+  fFinalRPM = (fFinalUnit * (float)U_RPM) / (float)SPEED_UNIT;
+  pHandle->wSpeedThToValidateStartupRPM = (uint32_t)(((uint32_t)pRUC->hMinStartUpValidSpeed * U_RPM) / SPEED_UNIT);
+
+  if (fJ > 0.0f)
+  {
+    float fAccRads2 = (SCC_STARTUP_ACC_MARGIN * SCC_KT_PER_KE * pHandle->fKe * pHandle->fLastTargetCurr) / fJ;
+
+    pHandle->wAccRPMs = (uint32_t)((fAccRads2 * 60.0f) / SCC_TWO_PI);
+    fDurationms = (pHandle->wAccRPMs > 0u) ? ((fFinalRPM * 1000.0f) / (float)pHandle->wAccRPMs) : fDurationms;
+  }
+  else
+  {
+    pHandle->wAccRPMs = 0u;
+  }
+  fDurationms = (fDurationms > 65535.0f) ? 65535.0f : fDurationms;
+  fDurationms = (fDurationms <= (float)pRUC->hAdaptMinDurationms) ? ((float)pRUC->hAdaptMinDurationms + 1.0f)
+                                                                 : fDurationms;
+
+  RUC_SetPhaseDurationms(pRUC, pRUC->bFirstAccelerationStage, (uint16_t)fDurationms);
+  for (i = 0u; i < RUC_MAX_PHASE_NUMBER; i++)
+  {
+    if (i >= pRUC->bFirstAccelerationStage)
+    {
+      RUC_SetPhaseFinalMecSpeedUnit(pRUC, i, (int16_t)fFinalUnit);
+    }
+    else
+    {
+      /* Nothing to do, alignment */
+    }
+    RUC_SetPhaseFinalTorque(pRUC, i, hTorque);
+  }
+}
+
+/**
+  * @brief  Runs the Ke detection, the switch over to the observer and the OneTouchTuning.
+  * @param  pHandle: handler of SCC component.
+  */
+static void SCC_KeDetectionMF(SCC_Handle_t *pHandle)
+{
+  VirtualSpeedSensor_Handle_t *pVSS = pHandle->pVSS;
+  pFOCVars_t pFOCVars = pHandle->pFOCVars;
+  int16_t hForcedMecSpeedUnit;
+  float fPointRPM = ((float)pHandle->wNominalSpeed * (float)(pHandle->hVal_ctn + 1u)) / (2.0f * (float)EMF_BUFF_VAL);
+
+  if (KEDET_RUN != pHandle->KEDetState)
+  {
+    (void)VSS_CalcAvrgMecSpeedUnit(pVSS, &hForcedMecSpeedUnit);
+  }
+  else
+  {
+    /* Nothing to do, closed loop */
+  }
+
+  switch (pHandle->KEDetState)
+  {
+    case KEDET_REVUP:
+    {
+      SCC_RampToSpeedPoint(pHandle, fPointRPM);
+      pHandle->KEDetState = KEDET_DETECTION;
+      break;
+    }
+
+    case KEDET_DETECTION:
+    {
+      if (true == VSS_RampCompleted(pVSS))
+      {
+        pHandle->hMFCount++;
+        if (pHandle->hMFCount > SCC_MsToTicks(pHandle, SCC_KE_SETTLE_MS))
+        {
+          pHandle->fVdsum += (float)pFOCVars->Vqd.d;
+          pHandle->fVqsum += (float)pFOCVars->Vqd.q;
+          pHandle->fIsum += (float)pFOCVars->Iqd.d;
+          pHandle->fIqsum += (float)pFOCVars->Iqd.q;
+          pHandle->fFesum += (float)SPD_GetAvrgMecSpeedUnit(&pVSS->_Super);
+          pHandle->wKeAcqCnt++;
+          if (pHandle->wKeAcqCnt >= SCC_MsToTicks(pHandle, SCC_KE_MEAS_MS))
+          {
+            if (true == SCC_EndSpeedPoint(pHandle))
+            {
+              SCC_RampToSpeedPoint(pHandle, ((float)pHandle->wNominalSpeed * (float)(pHandle->hVal_ctn + 1u))
+                                            / (2.0f * (float)EMF_BUFF_VAL));
+            }
+            else if (pHandle->hVal_ctn < 3u)
+            {
+              SCC_Fail(pHandle, MC_START_UP);
+            }
+            else
+            {
+              SCC_ComputeKe(pHandle);
+              if (LoseControl == pHandle->res)
+              {
+                /* Back to the last speed the rotor followed */
+                SCC_RampToSpeedPoint(pHandle, (float)pHandle->wMaxOLSpeed);
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+              pHandle->KEDetState = KEDET_SET_OBS_PARAMS;
+            }
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        else
+        {
+          /* Nothing to do, settling */
+        }
+      }
+      else
+      {
+        /* Nothing to do, ramping */
+      }
+      break;
+    }
+
+    case KEDET_SET_OBS_PARAMS:
+    {
+      if (true == VSS_RampCompleted(pVSS))
+      {
+        if (true == SCC_SetObserverParams(pHandle))
+        {
+          pHandle->stabCnt = 0;
+          pHandle->hMFTimeout = 0u;
+          pHandle->KEDetState = KEDET_STABILIZEPLL;
+        }
+        else
+        {
+          SCC_Fail(pHandle, MC_SW_ERROR);
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      break;
+    }
+
+    case KEDET_STABILIZEPLL:
+    {
+      float fForced = (float)hForcedMecSpeedUnit;
+      float fError = (float)SPD_GetAvrgMecSpeedUnit(&pHandle->pSTO->_Super) - fForced;
+
+      if ((fError <= (SCC_PLL_TRACK_BAND * fForced)) && (fError >= -(SCC_PLL_TRACK_BAND * fForced)))
+      {
+        pHandle->stabCnt++;
+      }
+      else
+      {
+        pHandle->stabCnt = 0;
+      }
+
+      if (pHandle->stabCnt >= SCC_PLL_TRACK_TICKS)
+      {
+        qd_t StatorCurrent = MCM_Park(pFOCVars->Ialphabeta, SPD_GetElAngle(&pHandle->pSTO->_Super));
+        int16_t hObsMecSpeedUnit = SPD_GetAvrgMecSpeedUnit(&pHandle->pSTO->_Super);
+
+        /* Latch the convergence, the speed reliability of the observer is then checked in closed loop */
+        (void)STO_PLL_IsObserverConverged(pHandle->pSTO, &hObsMecSpeedUnit);
+
+        /* Switch over ramp, from the forced current to the one carrying the load on the observer angle */
+        REMNG_Init(pHandle->pREMng);
+        (void)REMNG_ExecRamp(pHandle->pREMng, pFOCVars->Iqdref.q, 0u);
+        (void)REMNG_ExecRamp(pHandle->pREMng, StatorCurrent.q, SCC_SWITCH_OVER_MS);
+        (void)VSS_SetStartTransition(pVSS, true);
+        pHandle->KEDetState = KEDET_RESTART;
+      }
+      else
+      {
+        pHandle->hMFTimeout++;
+        if (pHandle->hMFTimeout > SCC_MsToTicks(pHandle, SCC_PLL_TIMEOUT_MS))
+        {
+          SCC_Fail(pHandle, MC_START_UP);
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      break;
+    }
+
+    case KEDET_RESTART:
+    {
+      pFOCVars->Iqdref.q = (int16_t)REMNG_Calc(pHandle->pREMng);
+      if ((true == VSS_TransitionEnded(pVSS)) && (true == REMNG_RampCompleted(pHandle->pREMng)))
+      {
+        float fMaxRPM = (1000.0f * 0.9f * pHandle->fBusV) / (SCC_SQRT2 * pHandle->fKe);
+        SpeednTorqCtrl_Handle_t *pSTC = pHandle->pSTC;
+
+        STC_SetSpeedSensor(pSTC, &pHandle->pSTO->_Super);
+        STC_SetControlMode(pSTC, MCM_SPEED_MODE);
+        PID_SetIntegralTerm(pSTC->PISpeed, (int32_t)pFOCVars->Iqdref.q * (int32_t)PID_GetKIDivisor(pSTC->PISpeed));
+        STC_ForceSpeedReferenceToCurrentSpeed(pSTC);
+        pFOCVars->bDriveInput = INTERNAL;
+
+        pHandle->pOTT->fEstNominalSpdRPM = ((float)pHandle->wNominalSpeed < fMaxRPM) ? (float)pHandle->wNominalSpeed
+                                                                                     : fMaxRPM;
+        pHandle->fEstNominalSpdRPM = pHandle->pOTT->fEstNominalSpdRPM;
+        OTT_SR(pHandle->pOTT);
+        pHandle->KEDetState = KEDET_RUN;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      break;
+    }
+
+    case KEDET_RUN:
+    {
+      if (false == SPD_Check(&pHandle->pSTO->_Super))
+      {
+        SCC_Fail(pHandle, MC_SPEED_FDBK);
+      }
+      else
+      {
+        OTT_MF(pHandle->pOTT);
+        if (true == OTT_IsSpeedPITuned(pHandle->pOTT))
+        {
+          SCC_SetRevUp(pHandle);
+          pHandle->sm_state = SCC_CALIBRATION_END;
+          (void)MCI_StopMotor(pHandle->pMCI);
+        }
+        else if (OTT_IDLE == OTT_GetState(pHandle->pOTT))
+        {
+          SCC_Fail(pHandle, MC_START_UP);
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  Initializes all the object variables, usually it has to be called
+  *         once right after object creation.
+  * @param  pHandle: handler of SCC component.
+  */
+__weak void SCC_Init(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pSCC_Params_t pParams = pHandle->pSCC_Params_str;
+
+    pHandle->pREMng = &pParams->rampExtMngrParams;
+    REMNG_Init(pHandle->pREMng);
+    pHandle->fTPWM = 1.0f / (float)pParams->hPWMFreqHz;
+    pHandle->fFocRate = (float)pParams->hPWMFreqHz / (float)pParams->bFOCRepRate;
+    pHandle->fMax_current = pParams->fMCUPowerSupply / (2.0f * pParams->fRshunt * pParams->fAmplificationGain);
+    pHandle->hMax_voltage = INT16_MAX;
+    pHandle->fPP = (float)pHandle->pSTO->_Super.bElToMecRatio;
+    pHandle->fLastTargetCurr = pParams->fRSMeasCurrLevelMax;
+    pHandle->fLdLqRatio = pParams->fLdLqRatio;
+    pHandle->fCurrentBW = pParams->fCurrentBW;
+    pHandle->wNominalSpeed = pParams->wNominalSpeed;
+    pHandle->fRS = pParams->fRSRated;
+    pHandle->fLS = pParams->fLSRated;
+    pHandle->fKe = pParams->fKeRated;
+    pHandle->fRSApplied = pParams->fRSRated;
+    pHandle->fLSApplied = pParams->fLSRated;
+    pHandle->fKeApplied = pParams->fKeRated;
+    pHandle->fResistorOffset = 0.0f;
+    pHandle->fBusV = 0.0f;
+    pHandle->hVAlpha = 0;
+    pHandle->sm_state = SCC_IDLE;
+    pHandle->bMPOngoing = 0u;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Arms the procedure, it runs once the motor is started in the PROFILE state.
+  * @param  pHandle: handler of SCC component.
+  * @retval bool false if the procedure is already ongoing.
+  */
+__weak bool SCC_Start(SCC_Handle_t *pHandle)
+{
+  bool bStarted = false;
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (0u == pHandle->bMPOngoing)
+    {
+      pHandle->fBusV = (float)VBS_GetAvBusVoltage_d(&pHandle->pVBS->_Super) * pHandle->pSCC_Params_str->fVbusConvFactor
+                     / 65536.0f;
+      OTT_Clear(pHandle->pOTT);
+      OTT_SetNominalSpeed(pHandle->pOTT, pHandle->wNominalSpeed);
+      SCC_StartRL(pHandle);
+      pHandle->bMPOngoing = 1u;
+      bStarted = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+  return (bStarted);
+}
+
+/**
+  * @brief  Ends the procedure when the motor stops, on completion, on a stop command or on a fault.
+  * @param  pHandle: handler of SCC component.
+  *
+  * - The parameters measured so far and applied are kept.
+  */
+__weak void SCC_Stop(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((SCC_CALIBRATION_END == pHandle->sm_state) || (SCC_PHASE_STOP == pHandle->sm_state))
+    {
+      /* Nothing to do, completed */
+    }
+    else
+    {
+      pHandle->sm_state = SCC_IDLE;
+    }
+    pHandle->hVAlpha = 0;
+    pHandle->bMPOngoing = 0u;
+    OTT_Stop(pHandle->pOTT);
+    STC_SetControlMode(pHandle->pSTC, pHandle->pSTC->ModeDefault);
+    pHandle->pFOCVars->bDriveInput = EXTERNAL;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Replaces the current controllers during the R and L detection: the alpha voltage
+  *         is imposed and the resulting currents sampled.
+  * @param  pHandle: handler of SCC component.
+  * @retval uint16_t MC_DURATION if the PWM update came too late, MC_NO_ERROR otherwise.
+  *
+  * - Called every current control period while SCC_IsPhaseVoltageImposed is true.
+  */
+__weak uint16_t SCC_SetPhaseVoltage(SCC_Handle_t *pHandle)
+{
+  uint16_t hCodeError = MC_NO_ERROR;
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pFOCVars_t pFOCVars = pHandle->pFOCVars;
+    ab_t Iab;
+    alphabeta_t Ialphabeta;
+    alphabeta_t Valphabeta;
+    int32_t wIAbs;
+
+    PWMC_GetPhaseCurrents(pHandle->pPWMC, &Iab);
+    Ialphabeta = MCM_Clarke(Iab);
+    wIAbs = (Ialphabeta.alpha < 0) ? -(int32_t)Ialphabeta.alpha : (int32_t)Ialphabeta.alpha;
+    pHandle->hIPeak = ((uint16_t)wIAbs > pHandle->hIPeak) ? (uint16_t)wIAbs : pHandle->hIPeak;
+
+    switch (pHandle->sm_state)
+    {
+      case SCC_DUTY_DETECTING_PHASE:
+      {
+        if ((0u == pHandle->hDutyMax)
+            && (SCC_S16ToAmp(pHandle, (float)Ialphabeta.alpha) >= pHandle->fLastTargetCurr))
+        {
+          pHandle->hDutyMax = (uint16_t)pHandle->hVAlpha;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_RS_DETECTING_PHASE_RAMP:
+      case SCC_RS_DETECTING_PHASE:
+      {
+        pHandle->fIsum += SCC_S16ToAmp(pHandle, (float)Ialphabeta.alpha);
+        pHandle->wICnt++;
+        break;
+      }
+
+      case SCC_LS_DETECTING_PHASE:
+      {
+        if (pHandle->wLSTimeCnt < pHandle->wLSTestCnt)
+        {
+          /* The first period only starts the wave */
+          if (pHandle->wLSTimeCnt > (2u * SCC_LS_HALF_PERIOD))
+          {
+            int32_t wVeff2 = (int32_t)pHandle->hVAlphaPrev[0] + pHandle->hVAlphaPrev[1];
+            int32_t wSign = wVeff2 - (2 * (int32_t)pHandle->hLSMeanVoltage);
+            float fImid = SCC_S16ToAmp(pHandle, ((float)Ialphabeta.alpha + (float)pHandle->hIAlphaPrev) / 2.0f);
+            float fVL = SCC_S16ToVolt(pHandle, (float)wVeff2 / 2.0f)
+                      - ((pHandle->fRS + pHandle->fResistorOffset) * fImid);
+            float fDeltaI = SCC_S16ToAmp(pHandle, (float)Ialphabeta.alpha - (float)pHandle->hIAlphaPrev);
+
+            if (wSign > 0)
+            {
+              pHandle->fVsum += fVL;
+              pHandle->fIsum += fDeltaI;
+            }
+            else if (wSign < 0)
+            {
+              pHandle->fVsum -= fVL;
+              pHandle->fIsum -= fDeltaI;
+            }
+            else
+            {
+              /* Nothing to do, edge of the wave */
+            }
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          pHandle->wLSTimeCnt++;
+          pHandle->hVAlpha = (0u == ((pHandle->wLSTimeCnt / SCC_LS_HALF_PERIOD) & 1u))
+                           ? (pHandle->hLSMeanVoltage + pHandle->hLSDeltaVoltage)
+                           : (pHandle->hLSMeanVoltage - pHandle->hLSDeltaVoltage);
+        }
+        else
+        {
+          pHandle->hVAlpha = pHandle->hLSMeanVoltage;
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+
+    Valphabeta.alpha = pHandle->hVAlpha;
+    Valphabeta.beta = 0;
+    hCodeError = PWMC_SetPhaseVoltage(pHandle->pPWMC, Valphabeta);
+    pHandle->hVAlphaPrev[1] = pHandle->hVAlphaPrev[0];
+    pHandle->hVAlphaPrev[0] = pHandle->hVAlpha;
+    pHandle->hIAlphaPrev = Ialphabeta.alpha;
+
+    pFOCVars->Iab = Iab;
+    pFOCVars->Ialphabeta = Ialphabeta;
+    pFOCVars->Valphabeta = Valphabeta;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+  return (hCodeError);
+}
+
+/**
+  * @brief  Runs the procedure, called by the medium frequency task in the PROFILE state.
+  * @param  pHandle: handler of SCC component.
+  */
+__weak void SCC_MF(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pSCC_Params_t pParams = pHandle->pSCC_Params_str;
+
+    pHandle->fBusV = (float)VBS_GetAvBusVoltage_d(&pHandle->pVBS->_Super) * pParams->fVbusConvFactor / 65536.0f;
+    if (true == SCC_IsPhaseVoltageImposed(pHandle))
+    {
+      SCC_CheckOC_RL(pHandle);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    switch (pHandle->sm_state)
+    {
+      case SCC_DUTY_DETECTING_PHASE:
+      {
+        if (pHandle->hDutyMax > 0u)
+        {
+          pHandle->hMFCount = 0u;
+          pHandle->sm_state = SCC_ALIGN_PHASE;
+        }
+        else if (true == REMNG_RampCompleted(pHandle->pREMng))
+        {
+          /* Half the bus voltage does not give the current: open phase */
+          SCC_Fail(pHandle, MC_SW_ERROR);
+        }
+        else
+        {
+          pHandle->hVAlpha = (int16_t)REMNG_Calc(pHandle->pREMng);
+        }
+        break;
+      }
+
+      case SCC_ALIGN_PHASE:
+      {
+        pHandle->hMFCount++;
+        if (pHandle->hMFCount >= SCC_MsToTicks(pHandle, pParams->hAlignmentDuration))
+        {
+          (void)SCC_TakeMeanCurrent(pHandle);
+          SCC_NextRSLevel(pHandle);
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_RS_DETECTING_PHASE_RAMP:
+      {
+        (void)SCC_RegulateRSCurrent(pHandle);
+        pHandle->hMFCount++;
+        if (pHandle->hMFCount >= SCC_MsToTicks(pHandle, (uint32_t)pParams->hRSDetectionDuration / 2u))
+        {
+          pHandle->hMFCount = 0u;
+          pHandle->sm_state = SCC_RS_DETECTING_PHASE;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_RS_DETECTING_PHASE:
+      {
+        uint8_t bLevel = pHandle->bRSCurrLevelTests;
+        float fV = SCC_S16ToVolt(pHandle, (float)pHandle->hVAlpha);
+
+        pHandle->fImaxArray[bLevel] += SCC_RegulateRSCurrent(pHandle);
+        pHandle->fVmaxArray[bLevel] += fV;
+        pHandle->index++;
+        pHandle->hMFCount++;
+        if (pHandle->hMFCount >= SCC_MsToTicks(pHandle, (uint32_t)pParams->hRSDetectionDuration / 2u))
+        {
+          pHandle->fImaxArray[bLevel] /= (float)pHandle->index;
+          pHandle->fVmaxArray[bLevel] /= (float)pHandle->index;
+          pHandle->bRSCurrLevelTests++;
+          if (pHandle->bRSCurrLevelTests < RSCURRLEVELNUM)
+          {
+            SCC_NextRSLevel(pHandle);
+          }
+          else
+          {
+            SCC_EndRSDetection(pHandle);
+          }
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_LS_DETECTING_PHASE:
+      {
+        if (pHandle->wLSTimeCnt >= pHandle->wLSTestCnt)
+        {
+          SCC_EndLSDetection(pHandle);
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_WAIT_RESTART:
+      {
+        pHandle->hMFCount++;
+        if (pHandle->hMFCount >= SCC_MsToTicks(pHandle, SCC_WAIT_RESTART_MS))
+        {
+          pHandle->sm_state = SCC_RESTART_SCC;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case SCC_RESTART_SCC:
+      {
+        SCC_StartRL(pHandle);
+        break;
+      }
+
+      case SCC_KE_DETECTING_PHASE:
+      {
+        SCC_KeDetectionMF(pHandle);
+        break;
+      }
+
+      default:
+        /* Nothing to do, waiting for the stop */
+        break;
+    }
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Restarts the R and L detection at a lower current if the peak current exceeded
+  *         SCC_Params_t::IThreshold.
+  * @param  pHandle: handler of SCC component.
+  */
+__weak void SCC_CheckOC_RL(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float fIPeak = SCC_S16ToAmp(pHandle, (float)pHandle->hIPeak);
+
+    pHandle->hIPeak = 0u;
+    if ((fIPeak > pHandle->pSCC_Params_str->IThreshold) && (SCC_WAIT_RESTART != pHandle->sm_state)
+        && (SCC_RESTART_SCC != pHandle->sm_state))
+    {
+      pHandle->fLastTargetCurr *= SCC_OC_CURRENT_REDUCTION;
+      pHandle->hVAlpha = 0;
+      pHandle->hMFCount = 0u;
+      pHandle->sm_state = SCC_WAIT_RESTART;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Executes a profiler command received by the Motor Control Protocol.
+  * @param  pHandle: handler of SCC component.
+  * @param  rxLength: length of the command payload.
+  * @param  rxBuffer: command payload, the first byte is the command.
+  * @param  txSyncFreeSpace: space left in the answer buffer.
+  * @param  txLength: length of the answer.
+  * @param  txBuffer: answer, state of the procedure and state of the OneTouchTuning.
+  * @retval uint8_t MCP_CMD_OK, MCP_CMD_NOK if the command can not be executed now, MCP_CMD_UNKNOWN otherwise.
+  */
+__weak uint8_t SCC_CMD(SCC_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace,
+                       uint16_t *txLength, uint8_t *txBuffer)
+{
+  uint8_t bResult = MCP_CMD_UNKNOWN;
+#ifdef NULL_PTR_CHECK_SCC
+  if ((MC_NULL == pHandle) || (MC_NULL == rxBuffer) || (MC_NULL == txLength) || (MC_NULL == txBuffer))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((0u == rxLength) || (txSyncFreeSpace < 2))
+    {
+      bResult = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else
+    {
+      switch (rxBuffer[0])
+      {
+        case CMD_SC_START:
+        {
+          if ((IDLE == MCI_GetSTMState(pHandle->pMCI)) && (MC_NO_FAULTS == MCI_GetOccurredFaults(pHandle->pMCI))
+              && (true == SCC_Start(pHandle)))
+          {
+            if (true == MCI_StartMotor(pHandle->pMCI))
+            {
+              bResult = MCP_CMD_OK;
+            }
+            else
+            {
+              pHandle->bMPOngoing = 0u;
+              pHandle->sm_state = SCC_IDLE;
+              bResult = MCP_CMD_NOK;
+            }
+          }
+          else
+          {
+            bResult = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+        case CMD_SC_STOP:
+        {
+          (void)MCI_StopMotor(pHandle->pMCI);
+          bResult = MCP_CMD_OK;
+          break;
+        }
+
+        default:
+          /* Hall sensors tuning and pole pairs detection are not supported */
+          break;
+      }
+
+      txBuffer[0] = (uint8_t)pHandle->sm_state;
+      txBuffer[1] = OTT_GetState(pHandle->pOTT);
+      *txLength = 2u;
+    }
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+  return (bResult);
+}
+
+/**
+  * @brief  Sets the current of the R and L detection, which is also the start-up current.
+  * @param  pHandle: handler of SCC component.
+  * @param  fCurrent: current, A.
+  */
+__weak void SCC_SetNominalCurrent(SCC_Handle_t *pHandle, float fCurrent)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->fLastTargetCurr = fCurrent;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the nominal speed, the Ke detection runs up to half of it.
+  * @param  pHandle: handler of SCC component.
+  * @param  wNominalSpeed: nominal speed, RPM.
+  */
+__weak void SCC_SetNominalSpeed(SCC_Handle_t *pHandle, int32_t wNominalSpeed)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->wNominalSpeed = wNominalSpeed;
+    OTT_SetNominalSpeed(pHandle->pOTT, wNominalSpeed);
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Applies motor parameters known beforehand, for instance stored by a previous procedure.
+  * @param  pHandle: handler of SCC component.
+  * @param  fRS: stator resistance, Ohm.
+  * @param  fLS: stator inductance, H.
+  * @param  fKe: Bemf constant, Vrms ph-ph/kRPM.
+  * @retval bool false if the procedure is ongoing or a parameter is out of range, nothing being then changed.
+  *
+  * - The observer, its start-up validation speed and the online resistance estimate are retuned
+  *   as at the end of the Ke detection. To be called with the motor stopped.
+  */
+__weak bool SCC_SetMotorParams(SCC_Handle_t *pHandle, float fRS, float fLS, float fKe)
+{
+  bool bApplied = false;
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((0u == pHandle->bMPOngoing) && (fRS > 0.0f) && (fLS > 0.0f) && (fKe > 0.0f))
+    {
+      bApplied = SCC_TuneObserver(pHandle, fRS, fLS, fKe);
+      if (true == bApplied)
+      {
+        pHandle->fRS = fRS;
+        pHandle->fLS = fLS;
+        pHandle->fKe = fKe;
+        OTT_SetKe(pHandle->pOTT, fKe);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+  return (bApplied);
+}
+
+/**
+  * @brief  Returns the state of the procedure, one of #SCC_State_t.
+  * @param  pHandle: handler of SCC component.
+  */
+__weak uint8_t SCC_GetState(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  return ((MC_NULL == pHandle) ? (uint8_t)SCC_IDLE : (uint8_t)pHandle->sm_state);
+#else
+  return ((uint8_t)pHandle->sm_state);
+#endif
+}
+
+/**
+  * @brief  Returns the power board resistance subtracted from the R measurement.
+  * @param  pHandle: handler of SCC component.
+  * @retval float resistance, Ohm.
+  */
+__weak float SCC_GetResistorOffset(SCC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  return ((MC_NULL == pHandle) ? 0.0f : pHandle->fResistorOffset);
+#else
+  return (pHandle->fResistorOffset);
+#endif
+}
+
+/**
+  * @brief  Selects the power board characterization: the next procedure measures the board
+  *         resistance, the phases being shorted at the board output, and stops after R.
+  * @param  pHandle: handler of SCC component.
+  * @param  value: PB_CHARACTERIZATION_DISABLE or 1.
+  */
+__weak void SCC_SetPBCharacterization(SCC_Handle_t *pHandle, uint8_t value)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->pSCC_Params_str->bPBCharacterization = value;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the power board resistance subtracted from the R measurement.
+  * @param  pHandle: handler of SCC component.
+  * @param  Offset: resistance, Ohm.
+  */
+__weak void SCC_SetResistorOffset(SCC_Handle_t *pHandle, float Offset)
+{
+#ifdef NULL_PTR_CHECK_SCC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->fResistorOffset = Offset;
+#ifdef NULL_PTR_CHECK_SCC
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
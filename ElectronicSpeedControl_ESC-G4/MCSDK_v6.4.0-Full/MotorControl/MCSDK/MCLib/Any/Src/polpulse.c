@@ -0,0 +1,454 @@
+/**
+  ******************************************************************************
+  * @file    polpulse.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Initial Position Detection by inductive pulses component
+  *          of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Initial rotor position detection by inductive pulse injection.
+ *
+ * A voltage pulse of N PWM periods is applied in N_Angles evenly spaced directions, each followed by Nd
+ * periods of null voltage to let the current decay. The current reached at the end of each pulse, projected
+ * on the pulse direction, is inversely proportional to the inductance seen in that direction:
+ *
+ *   i(theta) = I0 + I1.cos(theta - theta_r) + I2.cos(2.(theta - theta_r))
+ *
+ * The second harmonic comes from saliency (Ld < Lq) and gives the d axis modulo one half turn. The first
+ * harmonic comes from the saturation of the d axis when the pulse adds to the magnet flux, and tells the
+ * north pole from the south pole. The angle is only valid when the first harmonic along the d axis stands out
+ * of the mean current by MinContrast: without saturation, or with too little of it, the poles cannot be told
+ * apart and the caller falls back to an alignment.
+ */
+
+#include "polpulse.h"
+
+#define POLPULSE_MIN_ANGLES		(5)				/* Second harmonic is aliased below five directions */
+#define POLPULSE_MAX_DUTY		FIXP30(0.5f)	/* Limit of the pulse duty, ratio of the DC bus voltage */
+
+typedef struct _POLPULSE_Private_
+{
+	/* Parameters */
+	float_t				VoltageScale;
+	float_t				Ts;
+	float_t				Lsd;
+	float_t				PulseCurrentGoal_A;
+	uint16_t			N;
+	uint16_t			Nd;
+	uint16_t			N_Angles;
+	fixp30_t			minContrast;		/* First harmonic along the d axis over the mean current */
+
+	/* State */
+	POLPULSE_State_e	state;
+	bool				flagTriggerPulse;
+	bool				flagOverruleDuty;
+	uint16_t			counter;
+	uint16_t			angleIndex;
+	fixp30_t			pulseVoltage_pu;	/* Voltage giving PulseCurrentGoal_A in N periods, pu of VoltageScale */
+	fixp30_t			pulseDuty;
+	Duty_Dab_t			DutyAB;
+	fixp30_t			angleEstimated;
+	bool				flagAngleValid;
+
+	POLPULSE_Angles		Angles[POLPULSE_NUMSAMPLES];
+	POLPULSE_Data		Data[POLPULSE_NUMSAMPLES];
+} POLPULSE_Private;
+
+/* Compile time check that the private data fits in the public object */
+typedef char POLPULSE_SizeCheck[(sizeof(POLPULSE_Private) <= sizeof(POLPULSE_Obj)) ? 1 : -1];
+
+static inline POLPULSE_Private *POLPULSE_priv(POLPULSE_Obj *obj)
+{
+	return ((POLPULSE_Private *) obj);
+}
+
+static inline const POLPULSE_Private *POLPULSE_cpriv(const POLPULSE_Obj *obj)
+{
+	return ((const POLPULSE_Private *) obj);
+}
+
+static void POLPULSE_calcPulseVoltage(POLPULSE_Private *p)
+{
+	/* U = L.di/dt, the current rising linearly over N periods plus the half period before the sampling point */
+	float_t pulseVoltage_V = (p->Lsd * p->PulseCurrentGoal_A) / (((float_t) p->N + 0.5f) * p->Ts);
+	float_t pulseVoltage_pu = pulseVoltage_V / p->VoltageScale;
+
+	if (pulseVoltage_pu > 1.0f)
+	{
+		pulseVoltage_pu = 1.0f;
+	}
+	p->pulseVoltage_pu = FIXP30(pulseVoltage_pu);
+}
+
+static void POLPULSE_estimateAngle(POLPULSE_Private *p)
+{
+	fixp30_t H0 = 0;
+	Vector_ab_t H1 = { 0, 0 };
+	Vector_ab_t H2 = { 0, 0 };
+	int32_t nAngles = (int32_t) p->N_Angles;
+
+	for (uint16_t k = 0; k < p->N_Angles; k++)
+	{
+		FIXP_CosSin_t *pPhasor = &p->Angles[k].Phasor;
+		Currents_Iab_t *pIab = &p->Data[k].IabSample;
+
+		/* Current response in the pulse direction */
+		fixp30_t i_k = FIXP30_mpy(pIab->A, pPhasor->cos) + FIXP30_mpy(pIab->B, pPhasor->sin);
+		fixp30_t cos2 = FIXP30_mpy(pPhasor->cos, pPhasor->cos) - FIXP30_mpy(pPhasor->sin, pPhasor->sin);
+		fixp30_t sin2 = FIXP30_mpy(pPhasor->cos, pPhasor->sin) * 2;
+
+		/* Fourier coefficients, averaged to stay within the fixp30 range */
+		H0 += i_k / nAngles;
+		H1.A += FIXP30_mpy(i_k, pPhasor->cos) / nAngles;
+		H1.B += FIXP30_mpy(i_k, pPhasor->sin) / nAngles;
+		H2.A += FIXP30_mpy(i_k, cos2) / nAngles;
+		H2.B += FIXP30_mpy(i_k, sin2) / nAngles;
+	}
+
+	fixp30_t H1_angle_pu, H1_magn_pu;
+	fixp30_t H2_angle_pu, H2_magn_pu;
+	FIXP30_polar(H1.A, H1.B, &H1_angle_pu, &H1_magn_pu);
+	FIXP30_polar(H2.A, H2.B, &H2_angle_pu, &H2_magn_pu);
+
+	fixp30_t angle_pu;
+	fixp30_t polarity;
+	if (H2_magn_pu > H1_magn_pu)
+	{
+		/* Salient rotor, d axis from the second harmonic, polarity from the first one */
+		angle_pu = H2_angle_pu / 2;
+
+		FIXP_CosSin_t axis;
+		FIXP30_CosSinPU(angle_pu, &axis);
+		polarity = FIXP30_mpy(H1.A, axis.cos) + FIXP30_mpy(H1.B, axis.sin);
+		if (polarity < 0)
+		{
+			angle_pu += FIXP30(0.5f);
+			polarity = -polarity;
+		}
+	}
+	else
+	{
+		/* Little saliency, the saturation alone points at the north pole */
+		angle_pu = H1_angle_pu;
+		polarity = H1_magn_pu;
+	}
+	p->angleEstimated = angle_pu & (FIXP30(1.0f) - 1);
+	p->flagAngleValid = (H0 > 0) && (polarity > FIXP30_mpy(H0, p->minContrast));
+}
+
+/* Initialization */
+
+POLPULSE_Handle POLPULSE_init(void *pMemory, const size_t size)
+{
+	POLPULSE_Handle handle = (POLPULSE_Handle) NULL;
+
+	if ((NULL != pMemory) && (size >= sizeof(POLPULSE_Obj)))
+	{
+		handle = (POLPULSE_Handle) pMemory;
+		POLPULSE_resetState(handle);
+		POLPULSE_priv(handle)->angleEstimated = 0;
+		POLPULSE_priv(handle)->flagAngleValid = false;
+	}
+	return (handle);
+}
+
+void POLPULSE_setParams(POLPULSE_Obj *obj, const POLPULSE_Params *pParams)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	p->VoltageScale = pParams->VoltageScale;
+	p->Ts = pParams->Ts;
+	p->Lsd = pParams->Lsd;
+	p->PulseCurrentGoal_A = pParams->PulseCurrentGoal_A;
+	p->minContrast = FIXP30(pParams->MinContrast);
+	POLPULSE_setPulsePeriods(obj, pParams->N);
+	POLPULSE_setDecayPeriods(obj, pParams->Nd);
+	POLPULSE_setNumAngles(obj, pParams->N_Angles);
+}
+
+/* Functional */
+
+/**
+  * @brief  Pulse sequencer, called from the current control loop.
+  *
+  * @param  pIab_pu: alpha-beta currents measured in this PWM period, per unit.
+  * @param  pUab_pu: alpha-beta voltages, unused: the pulse is sized from the DC bus voltage.
+  * @param  angle: electrical angle the pulse pattern is referred to, per unit.
+  */
+void POLPULSE_run(POLPULSE_Obj *obj, const Currents_Iab_t *pIab_pu, const Voltages_Uab_t *pUab_pu, const fixp30_t angle)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+	(void) pUab_pu;
+
+	switch (p->state)
+	{
+	case POLPULSE_STATE_Clear:
+		/* Angles are planned in the background, with the DC bus voltage */
+		p->angleIndex = 0;
+		for (uint16_t k = 0; k < p->N_Angles; k++)
+		{
+			p->Angles[k].PulseAngle = (angle + (fixp30_t) ((FIXP30(1.0f) / p->N_Angles) * k)) & (FIXP30(1.0f) - 1);
+		}
+		p->state = POLPULSE_STATE_Precalcs;
+		break;
+
+	case POLPULSE_STATE_WaitDecay:
+		if (p->counter > 0)
+		{
+			p->counter--;
+		}
+		else if (p->angleIndex < p->N_Angles)
+		{
+			FIXP_CosSin_t *pPhasor = &p->Angles[p->angleIndex].Phasor;
+			p->DutyAB.A = FIXP30_mpy(p->pulseDuty, pPhasor->cos);
+			p->DutyAB.B = FIXP30_mpy(p->pulseDuty, pPhasor->sin);
+			p->counter = p->N;
+			p->state = POLPULSE_STATE_WaitPulse;
+		}
+		else
+		{
+			p->flagOverruleDuty = false;
+			p->state = POLPULSE_STATE_Postcalcs;
+		}
+		break;
+
+	case POLPULSE_STATE_WaitPulse:
+		if (p->counter > 0)
+		{
+			p->counter--;
+		}
+		else
+		{
+			/* Pulse is held until the sample: the current seen is the peak, free of any decay */
+			p->Data[p->angleIndex].IabSample = *pIab_pu;
+			p->DutyAB.A = 0;
+			p->DutyAB.B = 0;
+			p->angleIndex++;
+			p->counter = p->Nd;
+			p->state = POLPULSE_STATE_WaitDecay;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+  * @brief  Background calculations, called from the medium frequency task.
+  *
+  * @param  oneoverUdc_pu: inverse of the DC bus voltage, per unit.
+  * @param  Udc_pu: DC bus voltage in per unit of VoltageScale.
+  */
+void POLPULSE_runBackground(POLPULSE_Obj *obj, const fixp_t oneoverUdc_pu, const fixp30_t Udc_pu)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	switch (p->state)
+	{
+	case POLPULSE_STATE_Precalcs:
+		if (Udc_pu > 0)
+		{
+			fixp30_t pulseDuty = FIXP_mpy(p->pulseVoltage_pu, oneoverUdc_pu);
+			p->pulseDuty = (pulseDuty > POLPULSE_MAX_DUTY) ? POLPULSE_MAX_DUTY : pulseDuty;
+
+			for (uint16_t k = 0; k < p->N_Angles; k++)
+			{
+				FIXP30_CosSinPU(p->Angles[k].PulseAngle, &p->Angles[k].Phasor);
+			}
+
+			/* Start with a decay period, to begin from null currents */
+			p->DutyAB.A = 0;
+			p->DutyAB.B = 0;
+			p->counter = p->Nd;
+			p->flagOverruleDuty = true;
+			p->state = POLPULSE_STATE_WaitDecay;
+		}
+		break;
+
+	case POLPULSE_STATE_Postcalcs:
+		POLPULSE_estimateAngle(p);
+		p->flagTriggerPulse = false;
+		p->state = POLPULSE_STATE_PostcalcsComplete;
+		break;
+
+	default:
+		break;
+	}
+}
+
+void POLPULSE_clearTriggerPulse(POLPULSE_Obj *obj)
+{
+	POLPULSE_priv(obj)->flagTriggerPulse = false;
+}
+
+bool POLPULSE_isBusy(POLPULSE_Obj *obj)
+{
+	POLPULSE_State_e state = POLPULSE_priv(obj)->state;
+
+	return ((POLPULSE_STATE_Idle != state) && (POLPULSE_STATE_PostcalcsComplete != state));
+}
+
+void POLPULSE_resetState(POLPULSE_Obj *obj)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	p->state = POLPULSE_STATE_Idle;
+	p->flagTriggerPulse = false;
+	p->flagOverruleDuty = false;
+	p->counter = 0;
+	p->angleIndex = 0;
+	p->DutyAB.A = 0;
+	p->DutyAB.B = 0;
+}
+
+void POLPULSE_stopPulse(POLPULSE_Obj *obj)
+{
+	POLPULSE_resetState(obj);
+}
+
+void POLPULSE_trigger(POLPULSE_Obj *obj)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	if (false == POLPULSE_isBusy(obj))
+	{
+		p->flagTriggerPulse = true;
+		p->state = POLPULSE_STATE_Clear;
+	}
+}
+
+/* Accessors */
+
+fixp30_t POLPULSE_getAngleEstimated(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->angleEstimated);
+}
+
+bool POLPULSE_getFlagAngleValid(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->flagAngleValid);
+}
+
+float_t POLPULSE_getCurrentGoal(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->PulseCurrentGoal_A);
+}
+
+uint16_t POLPULSE_getDecayPeriods(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->Nd);
+}
+
+Duty_Dab_t POLPULSE_getDutyAB(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->DutyAB);
+}
+
+uint16_t POLPULSE_getNumAngles(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->N_Angles);
+}
+
+bool POLPULSE_getOverruleDuty(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->flagOverruleDuty);
+}
+
+fixp30_t POLPULSE_getPulseDuty(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->pulseDuty);
+}
+
+uint16_t POLPULSE_getPulsePeriods(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->N);
+}
+
+POLPULSE_State_e POLPULSE_getState(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->state);
+}
+
+bool POLPULSE_getTriggerPulse(const POLPULSE_Obj *obj)
+{
+	return (POLPULSE_cpriv(obj)->flagTriggerPulse);
+}
+
+void POLPULSE_setCurrentGoal(POLPULSE_Obj *obj, const float_t currentgoal)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	p->PulseCurrentGoal_A = currentgoal;
+	POLPULSE_calcPulseVoltage(p);
+}
+
+void POLPULSE_setDecayPeriods(POLPULSE_Obj *obj, const uint16_t periods)
+{
+	POLPULSE_priv(obj)->Nd = periods;
+}
+
+void POLPULSE_setLsd(POLPULSE_Obj *obj, const float_t Lsd)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	p->Lsd = Lsd;
+	POLPULSE_calcPulseVoltage(p);
+}
+
+void POLPULSE_setNumAngles(POLPULSE_Obj *obj, const uint16_t angles)
+{
+	uint16_t n = angles;
+
+	if (n < POLPULSE_MIN_ANGLES)
+	{
+		n = POLPULSE_MIN_ANGLES;
+	}
+	else if (n > POLPULSE_NUMSAMPLES)
+	{
+		n = POLPULSE_NUMSAMPLES;
+	}
+	else
+	{
+		/* Nothing to do */
+	}
+	POLPULSE_priv(obj)->N_Angles = n;
+}
+
+void POLPULSE_setPulseDone(POLPULSE_Obj *obj)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	/* Pulse timed externally: sample at the next run */
+	if (POLPULSE_STATE_WaitPulse == p->state)
+	{
+		p->counter = 0;
+	}
+}
+
+void POLPULSE_setPulsePeriods(POLPULSE_Obj *obj, const uint16_t periods)
+{
+	POLPULSE_Private *p = POLPULSE_priv(obj);
+
+	p->N = (periods > 0) ? periods : 1;
+	POLPULSE_calcPulseVoltage(p);
+}
+
+/* end of polpulse.c */
+
+/************************ (C) COPYRIGHT 2025 Piak Electronic Design B.V. *****END OF FILE****/
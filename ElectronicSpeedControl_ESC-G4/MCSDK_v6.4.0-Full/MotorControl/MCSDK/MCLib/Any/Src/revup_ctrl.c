@@ -87,6 +87,34 @@
   */
 #define RUC_OTF_PLL_RESET_TIMEOUT 100u
 
+/**
+  * @brief Time the observed speed must stay reliable, collinear with the imposed direction and above the
+  *  minimum start-up valid speed before a spinning rotor is caught. It is expressed in ms.
+  *
+  */
+#define RUC_OTF_CATCH_TIMEOUT 20u
+
+/**
+  * @brief Time the state observer may lose track of the rotor during the adaptive acceleration
+  *  before the adaptive rev-up falls back. It is expressed in ms.
+  *
+  */
+#define RUC_ADAPT_LOST_TIMEOUT 10u
+
+/**
+  * @brief Electrical angle the virtual speed sensor is set behind the observed rotor when the adaptive
+  *  acceleration resumes the ramp from it, s16degree.
+  *
+  */
+#define RUC_ADAPT_RESYNC_ANGLE 8192
+
+/**
+  * @brief Time the state observer must track the rotor before the adaptive acceleration is doubled.
+  *  It is expressed in ms.
+  *
+  */
+#define RUC_ADAPT_STEP_TIME 50u
+
 
 /* Private functions ----------------------------------------------------------*/
 
@@ -211,6 +239,52 @@ __weak void RUC_Clear(RevUpCtrl_Handle_t *pHandle, int16_t hMotorDirection)
 
     /* Timeout counter for PLL reset during OTF */
     pHandle->bResetPLLCnt = 0U;
+
+    /* Adaptive acceleration restarts from the programmed profile */
+    pHandle->hAdaptDurationms = 0U;
+    pHandle->bAdaptLostCnt = 0U;
+    pHandle->bAdaptTrackCnt = 0U;
+    pHandle->AdaptFallback = false;
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  }
+#endif
+}
+
+/**
+  * @brief  Starts the programmed RevUp from a known rotor electrical angle.
+  *
+  *  To be called after RUC_Clear, once the initial rotor position has been detected.
+  *  The forced angle is aligned on the rotor so that the current produces full torque
+  *  at once: if the first phase is an alignment (null final speed), it is skipped and
+  *  its final torque is applied straight away.
+  * @param  pHandle: Pointer on Handle structure of RevUp controller.
+  * @param  hElAngle: Rotor electrical angle in [s16degree](measurement_units.md).
+  */
+__weak void RUC_SetStartingElAngle(RevUpCtrl_Handle_t *pHandle, int16_t hElAngle)
+{
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    RevUpCtrl_PhaseParams_t *pPhaseParams = pHandle->ParamsData;
+
+    VSS_SetMecAngle(pHandle->pVSS, hElAngle);
+
+    if ((0U == pHandle->bStageCnt) && (0 == pPhaseParams->hFinalMecSpeedUnit))
+    {
+      (void)STC_ExecRamp(pHandle->pSTC, pPhaseParams->hFinalTorque * pHandle->hDirection, 0U);
+
+      /* Next phase is programmed at the next RUC_Exec */
+      pHandle->hPhaseRemainingTicks = 1U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
 #ifdef NULL_PTR_CHECK_REV_UP_CTL
   }
 #endif
@@ -497,6 +571,278 @@ __weak bool RUC_OTF_Exec(RevUpCtrl_Handle_t *pHandle)
   return (retVal);
 }
 
+/**
+  * @brief  Adapts the acceleration of the first acceleration stage to the tracking of the state observer.
+  *
+  *  The first acceleration stage starts with the programmed profile. Above hMinStartUpFlySpeed, where the
+  *  Bemf is large enough to be observed, each time the observer has tracked the rotor during
+  *  #RUC_ADAPT_STEP_TIME the acceleration of the rest of the ramp is doubled, up to the one of a ramp
+  *  lasting hAdaptMinDurationms. A rotor too heavy for a faster acceleration would stall before it can be
+  *  observed, so that the ramp is never made faster than programmed before the observer proves that the
+  *  rotor follows it. If the observer then loses track of the rotor during #RUC_ADAPT_LOST_TIMEOUT, the
+  *  adaptive rev-up falls back for the rest of the stage:
+  *  - a rotor still observed has slipped: the virtual speed sensor resumes from the observed speed,
+  *    #RUC_ADAPT_RESYNC_ANGLE behind the observed angle, with the last acceleration the rotor followed;
+  *  - a rotor without Bemf has stalled: the previous stage is run again, then the programmed profile.
+  *  The overall stage duration is left unchanged so that the rotor keeps the final speed of the stage
+  *  until the observer converges or the stage elapses, and at least until the end of a re-programmed
+  *  ramp. It must be called at speed loop frequency, after RUC_Exec.
+  * @param  pHandle: Pointer on Handle structure of RevUp controller.
+  * @param  ObserverTracking: true if the observed speed is reliable, consistent with the observed Bemf
+  *         and if the forced current still drives the observed rotor.
+  * @param  RotorObserved: true if the observed Bemf is consistent with the observed speed.
+  */
+__weak void RUC_AdaptAcceleration(RevUpCtrl_Handle_t *pHandle, bool ObserverTracking, bool RotorObserved)
+{
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((true == pHandle->AdaptiveEnabled) && (pHandle->hAdaptMinDurationms > 0U)
+     && (pHandle->bFirstAccelerationStage > 0U) && (pHandle->bStageCnt == pHandle->bFirstAccelerationStage))
+    {
+      const RevUpCtrl_PhaseParams_t *pPhase = &pHandle->ParamsData[pHandle->bFirstAccelerationStage];
+      int32_t wStartSpeed = pHandle->ParamsData[pHandle->bFirstAccelerationStage - 1U].hFinalMecSpeedUnit;
+      int32_t wFinalSpeed = pPhase->hFinalMecSpeedUnit;
+      int32_t wForcedSpeed = (int32_t)SPD_GetAvrgMecSpeedUnit(&pHandle->pVSS->_Super) * pHandle->hDirection;
+      uint8_t bTimeout = (uint8_t)((RUC_ADAPT_LOST_TIMEOUT * pHandle->hRUCFrequencyHz) / 1000U);
+      uint8_t bStepTicks = (uint8_t)((RUC_ADAPT_STEP_TIME * pHandle->hRUCFrequencyHz) / 1000U);
+      uint16_t hNewDurationms = pHandle->hAdaptDurationms;
+      bool bResync = false;
+
+      if (0U == pHandle->hAdaptDurationms)
+      {
+        /* Stage just entered: programmed profile until the observer tracks the rotor */
+        pHandle->hAdaptDurationms = pPhase->hDurationms;
+        hNewDurationms = pPhase->hDurationms;
+        pHandle->bAdaptLostCnt = 0U;
+        pHandle->bAdaptTrackCnt = 0U;
+      }
+      else if ((wForcedSpeed <= (int32_t)pHandle->hMinStartUpFlySpeed) || (wForcedSpeed >= wFinalSpeed)
+            || (true == pHandle->AdaptFallback))
+      {
+        /* Nothing to do, Bemf too low to judge the tracking, ramp completed or adaptive rev-up fallen back */
+      }
+      else if (true == ObserverTracking)
+      {
+        /* Double the acceleration each time the observer has tracked the rotor long enough */
+        pHandle->bAdaptLostCnt = 0U;
+        pHandle->bAdaptTrackCnt++;
+        if ((pHandle->bAdaptTrackCnt >= bStepTicks) && (pHandle->hAdaptDurationms > pHandle->hAdaptMinDurationms))
+        {
+          hNewDurationms = ((pHandle->hAdaptDurationms / 2U) > pHandle->hAdaptMinDurationms)
+                         ? (pHandle->hAdaptDurationms / 2U) : pHandle->hAdaptMinDurationms;
+          pHandle->bAdaptTrackCnt = 0U;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else if (pHandle->hAdaptDurationms == pPhase->hDurationms)
+      {
+        /* Programmed profile: left to the rev-up as it is */
+        pHandle->bAdaptTrackCnt = 0U;
+      }
+      else
+      {
+        pHandle->bAdaptLostCnt++;
+        if (pHandle->bAdaptLostCnt < bTimeout)
+        {
+          /* Nothing to do */
+        }
+        else if (true == RotorObserved)
+        {
+          /* Too fast for the rotor: resume from the observed rotor with the last acceleration it followed */
+          int16_t hObsSpeedUnit = SPD_GetAvrgMecSpeedUnit(pHandle->pSNSL->_Super);
+          int16_t hObsElAngle = SPD_GetElAngle(pHandle->pSNSL->_Super);
+
+          VSS_SetMecAcceleration(pHandle->pVSS, hObsSpeedUnit, 0U);
+          VSS_SetElAngle(pHandle->pVSS, (int16_t)(hObsElAngle - (RUC_ADAPT_RESYNC_ANGLE * pHandle->hDirection)));
+          wForcedSpeed = (int32_t)hObsSpeedUnit * pHandle->hDirection;
+          bResync = true;
+          pHandle->AdaptFallback = true;
+          hNewDurationms = ((2U * pHandle->hAdaptDurationms) < pPhase->hDurationms) ? (2U * pHandle->hAdaptDurationms)
+                                                                                   : pPhase->hDurationms;
+        }
+        else
+        {
+          /* Stalled rotor: run the previous stage again, then the programmed profile */
+          const RevUpCtrl_PhaseParams_t *pPrevious = &pHandle->ParamsData[pHandle->bFirstAccelerationStage - 1U];
+
+          VSS_SetMecAcceleration(pHandle->pVSS, (int16_t)(wStartSpeed * pHandle->hDirection), 0U);
+          pHandle->hPhaseRemainingTicks = (uint16_t)((((uint32_t)pPrevious->hDurationms)
+                                                   * (uint32_t)pHandle->hRUCFrequencyHz) / 1000U);
+          pHandle->hPhaseRemainingTicks++;
+          pHandle->pCurrentPhaseParams = &pHandle->ParamsData[pHandle->bFirstAccelerationStage];
+          pHandle->bStageCnt = pHandle->bFirstAccelerationStage - 1U;
+          pHandle->AdaptFallback = true;
+          pHandle->hAdaptDurationms = pPhase->hDurationms;
+          hNewDurationms = pPhase->hDurationms;
+        }
+      }
+
+      if (((hNewDurationms != pHandle->hAdaptDurationms) || (true == bResync)) && (wFinalSpeed > wStartSpeed)
+       && (wForcedSpeed < wFinalSpeed))
+      {
+        /* Re-program the remaining part of the ramp */
+        int32_t wRemainingms = (((int32_t)hNewDurationms) * (wFinalSpeed - ((wForcedSpeed > wStartSpeed)
+                               ? wForcedSpeed : wStartSpeed))) / (wFinalSpeed - wStartSpeed);
+        uint16_t hRampTicks = (uint16_t)(((wRemainingms * (int32_t)pHandle->hRUCFrequencyHz) / 1000) + 1);
+
+        pHandle->hAdaptDurationms = hNewDurationms;
+        VSS_SetMecAcceleration(pHandle->pVSS, pPhase->hFinalMecSpeedUnit * pHandle->hDirection,
+                               (uint16_t)wRemainingms);
+
+        /* The stage lasts at least until the end of the ramp */
+        pHandle->hPhaseRemainingTicks = (pHandle->hPhaseRemainingTicks > hRampTicks) ? pHandle->hPhaseRemainingTicks
+                                                                                     : hRampTicks;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  }
+#endif
+}
+
+/**
+  * @brief  Starts the on-the-fly detection window.
+  *
+  *  The window lasts hOTFSection1Duration milliseconds. During the window the motor is driven with
+  *  null current references, so that the state observer is fed by the Bemf of the spinning rotor
+  *  only. It must be called after RUC_Clear, once the state observer has been cleared.
+  * @param  pHandle: Pointer on Handle structure of RevUp controller.
+  */
+__weak void RUC_OTF_StartDetection(RevUpCtrl_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->hPhaseRemainingTicks = (uint16_t)((((uint32_t)pHandle->hOTFSection1Duration)
+                                              * ((uint32_t)pHandle->hRUCFrequencyHz)) / 1000U);
+    pHandle->hPhaseRemainingTicks++;
+    pHandle->bOTFRelCounter = 0U;
+    pHandle->bResetPLLCnt = 0U;
+    pHandle->EnteredZone1 = false;
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  }
+#endif
+}
+
+/**
+  * @brief  On-the-fly detection procedure, to be called at speed loop frequency during the
+  *         detection window started by RUC_OTF_StartDetection.
+  *
+  *  The rotor is caught when the observed speed is reliable, has the same sign as the imposed
+  *  direction and is above hMinStartUpValidSpeed during #RUC_OTF_CATCH_TIMEOUT. Convergence of the
+  *  state observer is then forced so that the closed loop can be entered directly.
+  *  As long as the speed is not reliable, the PLL integral term is periodically reset to help it
+  *  lock on the Bemf.
+  * @param  pHandle: Pointer on Handle structure of RevUp controller.
+  *  @retval RUC_OTF_Status_t Status of the detection.
+  */
+__weak RUC_OTF_Status_t RUC_OTF_Detect(RevUpCtrl_Handle_t *pHandle)
+{
+  RUC_OTF_Status_t retVal = RUC_OTF_DETECTING;
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  if (MC_NULL == pHandle)
+  {
+    retVal = RUC_OTF_NOT_CAUGHT;
+  }
+  else
+  {
+#endif
+    uint8_t bCatchTh = (uint8_t)((RUC_OTF_CATCH_TIMEOUT * pHandle->hRUCFrequencyHz) / 1000U);
+    int16_t hObsSpeedUnit = SPD_GetAvrgMecSpeedUnit(pHandle->pSNSL->_Super);
+    int16_t hObsSpeedUnitAbsValue = ((hObsSpeedUnit < 0) ? (-hObsSpeedUnit) : (hObsSpeedUnit));
+    bool IsSpeedReliable = pHandle->pSNSL->pFctSTO_SpeedReliabilityCheck(pHandle->pSNSL);
+    bool bCollinearSpeed = ((int32_t)hObsSpeedUnit * pHandle->hDirection) > 0;
+
+    if (pHandle->hPhaseRemainingTicks > 0U)
+    {
+      pHandle->hPhaseRemainingTicks--;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (false == IsSpeedReliable)
+    {
+      pHandle->bOTFRelCounter = 0U;
+      if (pHandle->pSNSL->pFctStoOtfResetPLL != MC_NULL)
+      {
+        pHandle->bResetPLLCnt++;
+        if (pHandle->bResetPLLCnt > pHandle->bResetPLLTh)
+        {
+          pHandle->pSNSL->pFctStoOtfResetPLL(pHandle->pSNSL);
+          pHandle->bResetPLLCnt = 0U;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else if ((true == bCollinearSpeed) && ((uint16_t)hObsSpeedUnitAbsValue > pHandle->hMinStartUpValidSpeed))
+    {
+      pHandle->bResetPLLCnt = 0U;
+      if (pHandle->bOTFRelCounter < 127U)
+      {
+        pHandle->bOTFRelCounter++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Reliable but too slow or reverse speed, not a catch candidate */
+      pHandle->bResetPLLCnt = 0U;
+      pHandle->bOTFRelCounter = 0U;
+    }
+
+    if (pHandle->bOTFRelCounter >= bCatchTh)
+    {
+      pHandle->pSNSL->pFctForceConvergency1(pHandle->pSNSL);
+      pHandle->EnteredZone1 = true;
+      retVal = RUC_OTF_CAUGHT;
+    }
+    else if (0U == pHandle->hPhaseRemainingTicks)
+    {
+      retVal = RUC_OTF_NOT_CAUGHT;
+    }
+    else
+    {
+      /* Nothing to do, detection is ongoing */
+    }
+#ifdef NULL_PTR_CHECK_REV_UP_CTL
+  }
+#endif
+  return (retVal);
+}
+
 /**
   * @brief  FOC Main Rev-Up controller procedure executing overall programmed phases.
   * @param  pHandle: Pointer on Handle structure of RevUp controller.
@@ -0,0 +1,504 @@
+/**
+  ******************************************************************************
+  * @file    rstemp.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Stator Resistance and Temperature estimation component
+  *          of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Stator resistance and winding temperature estimation by low frequency injection.
+ *
+ * A sine wave of amplitude Iref and frequency FreqXY is added to the d axis current reference. Over each whole
+ * period of the injection, the d axis voltage and current are correlated with the sine and the cosine of the
+ * injection angle. The resistance is the real part of the ratio of the voltage and current phasors:
+ *
+ *   Rs = (Vs.Is + Vc.Ic) / (Is^2 + Ic^2)
+ *
+ * The inductive drop is in quadrature and cancels out, as do the back-EMF and any constant voltage error such as
+ * the dead time, which do not correlate with the injection. A period during which the electrical frequency moved
+ * is discarded.
+ *
+ * The dead time voltage error Vdt is aligned on the phase current vector. The injection rotates this vector
+ * slightly, so Vdt shows up as an extra resistance 4.Vdt/(pi.Ipeak), removed with the mean current amplitude of
+ * the period. The accepted estimates are low pass filtered in the background, and the winding temperature follows
+ * from the temperature coefficient of copper.
+ */
+
+#include "rstemp.h"
+
+#define RSTEMP_COPPER_TEMPCO		(0.00393f)		/* Relative resistance increase per deg C, copper */
+#define RSTEMP_DEFAULT_FREQ_HZ		(20.0f)			/* Injection frequency */
+#define RSTEMP_DEFAULT_IREF_RATIO	(0.1f)			/* Injection amplitude, ratio of the motor max current */
+#define RSTEMP_DEFAULT_BW_RPS		(0.5f)			/* Estimate filter bandwidth */
+#define RSTEMP_MIN_FREQ_HZ			(1.0f)
+#define RSTEMP_MAX_IREF_RATIO		(0.25f)
+#define RSTEMP_MIN_RS_RATIO			(0.5f)			/* Estimates outside these ratios of Rated Rs are rejected */
+#define RSTEMP_MAX_RS_RATIO			(2.5f)
+#define RSTEMP_MIN_RESPONSE_RATIO	(0.25f)			/* Minimum measured current response, ratio of Iref */
+#define RSTEMP_MAX_FREQ_DRIFT		FIXP30(1.0f / 64.0f)	/* Electrical frequency change over a period, pu */
+#define RSTEMP_SETTLE_TAUS			(3.0f)			/* Filter time constants before the estimate is used */
+
+typedef struct _RSTEMP_Private_
+{
+	/* Parameters */
+	float_t				FullScaleCurrent_A;
+	float_t				FullScaleImpedance_Ohm;		/* FullScaleVoltage/FullScaleCurrent */
+	float_t				FullScaleFreq_Hz;
+	float_t				RatedCelcius;
+	float_t				RsRated_Ohm;
+	float_t				Ls_H;
+	float_t				MotorMaxCurrent_A;
+	float_t				F_interrupt_Hz;
+
+	/* Settings */
+	bool				flag_Enable;
+	float_t				FreqXY_Hz;					/* Actual frequency, an integer number of interrupts per period */
+	float_t				Iref_A;
+	float_t				Bandwidth_rps;
+	float_t				DeadTimeVoltage_V;
+	uint16_t			periodCount;				/* Interrupts per injection period */
+	fixp30_t			angleInc_pu;
+	fixp30_t			Iref_pu;
+	fixp30_t			Krs_pu;						/* Feedforward resistance, pu of the full scale impedance */
+	fixp30_t			Kwl_pu;						/* Feedforward reactance at FreqXY, pu */
+
+	/* Interrupt state */
+	volatile bool		flag_Inject;				/* Written by the background */
+	volatile bool		flag_Restart;				/* Set by the background, cleared by the interrupt */
+	volatile bool		flag_PeriodReady;			/* Set by the interrupt, cleared by the background */
+	bool				flag_PeriodValid;
+	uint16_t			counter;
+	fixp30_t			injAngle_pu;
+	FIXP_CosSin_t		injCosSin;
+	fixp30_t			freqStart_pu;
+	int64_t				sumVs;
+	int64_t				sumVc;
+	int64_t				sumIs;
+	int64_t				sumIc;
+	int64_t				sumIsquared;				/* Current vector magnitude squared */
+	float_t				latched[5];					/* Vs, Vc, Is, Ic, Isquared of the last complete period */
+	Vector_dq_t			IdqLFref;
+	Vector_ab_t			LFabDuty;
+
+	/* Background state */
+	RSTEMP_State_e		state;
+	bool				flag_UpdateEnable;
+	float_t				settleTime_s;
+	float_t				rs_Ohm;
+	float_t				TempCelcius;
+} RSTEMP_Private;
+
+/* Compile time check that the private data fits in the public object */
+typedef char RSTEMP_SizeCheck[(sizeof(RSTEMP_Private) <= sizeof(RSTEMP_Obj)) ? 1 : -1];
+
+static inline RSTEMP_Private *RSTEMP_priv(RSTEMP_Obj *obj)
+{
+	return ((RSTEMP_Private *) obj);
+}
+
+static inline const RSTEMP_Private *RSTEMP_cpriv(const RSTEMP_Obj *obj)
+{
+	return ((const RSTEMP_Private *) obj);
+}
+
+static void RSTEMP_updateFeedforward(RSTEMP_Private *p)
+{
+	p->Krs_pu = FIXP30(p->rs_Ohm / p->FullScaleImpedance_Ohm);
+	p->Kwl_pu = FIXP30(((float_t) MATH_TWO_PI * p->FreqXY_Hz * p->Ls_H) / p->FullScaleImpedance_Ohm);
+}
+
+static void RSTEMP_updateTemperature(RSTEMP_Private *p)
+{
+	p->TempCelcius = p->RatedCelcius + (((p->rs_Ohm / p->RsRated_Ohm) - 1.0f) / RSTEMP_COPPER_TEMPCO);
+}
+
+static void RSTEMP_stopInjection(RSTEMP_Private *p)
+{
+	p->flag_Inject = false;
+	p->IdqLFref.D = 0;
+	p->IdqLFref.Q = 0;
+	p->LFabDuty.A = 0;
+	p->LFabDuty.B = 0;
+	p->state = RSTEMP_STATE_Idle;
+}
+
+RSTEMP_Handle RSTEMP_init(void *pMemory, const size_t size)
+{
+	RSTEMP_Handle handle = (RSTEMP_Handle) NULL;
+
+	if (size >= sizeof(RSTEMP_Obj))
+	{
+		RSTEMP_Private *p = (RSTEMP_Private *) pMemory;
+
+		p->flag_Inject = false;
+		p->flag_Restart = false;
+		p->flag_PeriodReady = false;
+		p->state = RSTEMP_STATE_Idle;
+		p->flag_UpdateEnable = false;
+		handle = (RSTEMP_Handle) pMemory;
+	}
+
+	return (handle);
+}
+
+void RSTEMP_setParams(RSTEMP_Handle handle, const RSTEMP_Params *pParams)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	p->FullScaleCurrent_A = pParams->FullScaleCurrent_A;
+	p->FullScaleImpedance_Ohm = pParams->FullScaleVoltage_V / pParams->FullScaleCurrent_A;
+	p->FullScaleFreq_Hz = pParams->FullScaleFreq_Hz;
+	p->RatedCelcius = pParams->RatedCelcius;
+	p->RsRated_Ohm = pParams->RsRatedOhm;
+	p->Ls_H = pParams->LsHenry;
+	p->MotorMaxCurrent_A = pParams->MotorMaxCurrent_A;
+	p->F_interrupt_Hz = pParams->F_interrupt_Hz;
+
+	p->flag_Enable = false;
+	p->Bandwidth_rps = RSTEMP_DEFAULT_BW_RPS;
+	p->DeadTimeVoltage_V = 0.0f;
+	p->rs_Ohm = pParams->RsRatedOhm;
+	RSTEMP_stopInjection(p);
+	RSTEMP_setFreqXY_Hz(handle, RSTEMP_DEFAULT_FREQ_HZ);
+	RSTEMP_setIref_A(handle, RSTEMP_DEFAULT_IREF_RATIO * pParams->MotorMaxCurrent_A);
+	RSTEMP_updateTemperature(p);
+}
+
+void RSTEMP_run(RSTEMP_Handle handle, const Vector_ab_t *pUab, const Currents_Iab_t *pIab, const FIXP_CosSin_t *pCossinPark, const fixp30_t freq_pu)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	if (false == p->flag_Inject)
+	{
+		/* Nothing to do, references cleared by the background */
+	}
+	else
+	{
+		if (p->flag_Restart)
+		{
+			p->counter = 0;
+			p->injAngle_pu = 0;
+			p->injCosSin.cos = FIXP30(1.0f);
+			p->injCosSin.sin = 0;
+			p->sumVs = 0;
+			p->sumVc = 0;
+			p->sumIs = 0;
+			p->sumIc = 0;
+			p->sumIsquared = 0;
+			p->freqStart_pu = freq_pu;
+			p->flag_Restart = false;
+		}
+		else
+		{
+			/* d axis voltage and current, correlated with the injection applied since the previous period */
+			fixp30_t Ud = FIXP30_mpy(pUab->A, pCossinPark->cos) + FIXP30_mpy(pUab->B, pCossinPark->sin);
+			fixp30_t Id = FIXP30_mpy(pIab->A, pCossinPark->cos) + FIXP30_mpy(pIab->B, pCossinPark->sin);
+
+			p->sumVs += FIXP30_mpy(Ud, p->injCosSin.sin);
+			p->sumVc += FIXP30_mpy(Ud, p->injCosSin.cos);
+			p->sumIs += FIXP30_mpy(Id, p->injCosSin.sin);
+			p->sumIc += FIXP30_mpy(Id, p->injCosSin.cos);
+			p->sumIsquared += FIXP30_mpy(pIab->A, pIab->A) + FIXP30_mpy(pIab->B, pIab->B);
+
+			p->counter++;
+			p->injAngle_pu += p->angleInc_pu;
+			if (p->counter >= p->periodCount)
+			{
+				/* Whole period, restart exactly on angle zero */
+				fixp30_t freqDrift = freq_pu - p->freqStart_pu;
+
+				if (false == p->flag_PeriodReady)
+				{
+					p->latched[0] = (float_t) p->sumVs;
+					p->latched[1] = (float_t) p->sumVc;
+					p->latched[2] = (float_t) p->sumIs;
+					p->latched[3] = (float_t) p->sumIc;
+					p->latched[4] = (float_t) p->sumIsquared;
+					p->flag_PeriodValid = (freqDrift < RSTEMP_MAX_FREQ_DRIFT) && (freqDrift > -RSTEMP_MAX_FREQ_DRIFT);
+					p->flag_PeriodReady = true;
+				}
+				p->counter = 0;
+				p->injAngle_pu = 0;
+				p->sumVs = 0;
+				p->sumVc = 0;
+				p->sumIs = 0;
+				p->sumIc = 0;
+				p->sumIsquared = 0;
+				p->freqStart_pu = freq_pu;
+			}
+			FIXP30_CosSinPU(p->injAngle_pu, &p->injCosSin);
+		}
+
+		p->IdqLFref.D = FIXP30_mpy(p->Iref_pu, p->injCosSin.sin);
+		p->IdqLFref.Q = 0;
+
+		/* Voltage of the injection, (Rs + jwLs).Iref, rotated to the stationary frame */
+		fixp30_t Ud_ff = FIXP30_mpy(p->Iref_pu, FIXP30_mpy(p->Krs_pu, p->injCosSin.sin) + FIXP30_mpy(p->Kwl_pu, p->injCosSin.cos));
+		p->LFabDuty.A = FIXP30_mpy(Ud_ff, pCossinPark->cos);
+		p->LFabDuty.B = FIXP30_mpy(Ud_ff, pCossinPark->sin);
+	}
+}
+
+void RSTEMP_runBackground(RSTEMP_Handle handle, const float_t active_Rs_ohm, const bool flag_OKtoGo)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	if ((false == p->flag_Enable) || (false == flag_OKtoGo))
+	{
+		RSTEMP_stopInjection(p);
+	}
+	else
+	{
+		switch (p->state)
+		{
+		case RSTEMP_STATE_Idle:
+			if (false == p->flag_UpdateEnable)
+			{
+				/* First run, start from the resistance in use */
+				p->rs_Ohm = active_Rs_ohm;
+				p->settleTime_s = 0.0f;
+			}
+			p->flag_PeriodReady = false;
+			p->flag_Restart = true;
+			p->flag_Inject = true;
+			p->state = RSTEMP_STATE_Starting;
+			break;
+
+		case RSTEMP_STATE_Starting:
+			if (false == p->flag_Restart)
+			{
+				p->flag_PeriodReady = false;
+				p->state = RSTEMP_STATE_PreActive;
+			}
+			break;
+
+		case RSTEMP_STATE_PreActive:
+			if (p->flag_PeriodReady)
+			{
+				/* First period discarded, the current loop settles on the injection */
+				p->flag_PeriodReady = false;
+				p->state = RSTEMP_STATE_Active;
+			}
+			break;
+
+		case RSTEMP_STATE_Active:
+			if (p->flag_PeriodReady)
+			{
+				float_t Vs = p->latched[0];
+				float_t Vc = p->latched[1];
+				float_t Is = p->latched[2];
+				float_t Ic = p->latched[3];
+				float_t Isquared = (Is * Is) + (Ic * Ic);
+				/* Ideal response to the sine is Iref.periodCount/2 */
+				float_t Imin = RSTEMP_MIN_RESPONSE_RATIO * 0.5f * (float_t) p->periodCount * (float_t) p->Iref_pu;
+				bool valid = p->flag_PeriodValid && (Isquared > (Imin * Imin));
+
+				p->flag_PeriodReady = false;
+				if (valid)
+				{
+					float_t rsMeas_Ohm = (((Vs * Is) + (Vc * Ic)) / Isquared) * p->FullScaleImpedance_Ohm;
+					float_t Ipeak_A = sqrtf(p->latched[4] / ((float_t) p->periodCount * FIXP30(1.0f)))
+									* p->FullScaleCurrent_A;
+
+					/* Dead time resistance 4.Vdt/(pi.Ipeak), Ipeak is at least the injection response */
+					rsMeas_Ohm -= (8.0f * p->DeadTimeVoltage_V) / ((float_t) MATH_TWO_PI * Ipeak_A);
+
+					if ((rsMeas_Ohm > (RSTEMP_MIN_RS_RATIO * p->RsRated_Ohm))
+						&& (rsMeas_Ohm < (RSTEMP_MAX_RS_RATIO * p->RsRated_Ohm)))
+					{
+						float_t Tperiod_s = (float_t) p->periodCount / p->F_interrupt_Hz;
+						float_t k = p->Bandwidth_rps * Tperiod_s;
+
+						k = (k > 1.0f) ? 1.0f : k;
+						p->rs_Ohm += k * (rsMeas_Ohm - p->rs_Ohm);
+						RSTEMP_updateFeedforward(p);
+						RSTEMP_updateTemperature(p);
+
+						p->settleTime_s += Tperiod_s;
+						if (p->settleTime_s > (RSTEMP_SETTLE_TAUS / p->Bandwidth_rps))
+						{
+							p->flag_UpdateEnable = true;
+						}
+					}
+				}
+			}
+			break;
+
+		default:
+			RSTEMP_stopInjection(p);
+			break;
+		}
+	}
+}
+
+void RSTEMP_setFilterStates(const RSTEMP_Handle handle, bool running)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	if (false == running)
+	{
+		/* Hold the estimate, the injection restarts with a new period */
+		RSTEMP_stopInjection(p);
+	}
+	else
+	{
+		/* Nothing to do, the injection resumes at the next background call */
+	}
+}
+
+void RSTEMP_setFilterStart(const RSTEMP_Handle handle)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	/* The filter restarts from the resistance given at the next background call */
+	p->flag_UpdateEnable = false;
+	RSTEMP_stopInjection(p);
+}
+
+/* Getters */
+
+float_t RSTEMP_getBandwidth(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->Bandwidth_rps);
+}
+
+bool RSTEMP_getFlagEnable(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->flag_Enable);
+}
+
+bool RSTEMP_getFlagUpdateEnable(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->flag_UpdateEnable);
+}
+
+float_t RSTEMP_getFreqXY_Hz(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->FreqXY_Hz);
+}
+
+float_t RSTEMP_getIref_A(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->Iref_A);
+}
+
+float RSTEMP_getRsOhm(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->rs_Ohm);
+}
+
+RSTEMP_State_e RSTEMP_getState(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->state);
+}
+
+float_t RSTEMP_getTempCelcius(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->TempCelcius);
+}
+
+fixp20_t RSTEMP_getTempCelcius_pu(const RSTEMP_Handle handle)
+{
+	return (FIXP20(RSTEMP_cpriv(handle)->TempCelcius));
+}
+
+Vector_ab_t RSTEMP_getLFabDuty(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->LFabDuty);
+}
+
+Vector_dq_t RSTEMP_getIdqLFref(const RSTEMP_Handle handle)
+{
+	return (RSTEMP_cpriv(handle)->IdqLFref);
+}
+
+/* Setters */
+
+void RSTEMP_setBandwidth(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	p->Bandwidth_rps = (value > 0.0f) ? value : RSTEMP_DEFAULT_BW_RPS;
+}
+
+void RSTEMP_setDeadTimeVoltage_V(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_priv(handle)->DeadTimeVoltage_V = value;
+}
+
+void RSTEMP_setFlagEnable(RSTEMP_Handle handle, const bool value)
+{
+	RSTEMP_priv(handle)->flag_Enable = value;
+}
+
+void RSTEMP_setFreqXY_Hz(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+	float_t freq_Hz = (value > RSTEMP_MIN_FREQ_HZ) ? value : RSTEMP_MIN_FREQ_HZ;
+	float_t count = (p->F_interrupt_Hz / freq_Hz) + 0.5f;
+
+	/* Whole number of interrupts per period */
+	count = (count > 65535.0f) ? 65535.0f : count;
+	p->periodCount = (uint16_t) count;
+	p->angleInc_pu = FIXP30(1.0f / (float_t) p->periodCount);
+	p->FreqXY_Hz = p->F_interrupt_Hz / (float_t) p->periodCount;
+	RSTEMP_updateFeedforward(p);
+
+	/* Running sums are no longer consistent */
+	p->flag_Restart = true;
+}
+
+void RSTEMP_setIref_A(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+	float_t maxIref_A = RSTEMP_MAX_IREF_RATIO * p->MotorMaxCurrent_A;
+
+	p->Iref_A = (value < maxIref_A) ? ((value > 0.0f) ? value : 0.0f) : maxIref_A;
+	p->Iref_pu = FIXP30(p->Iref_A / p->FullScaleCurrent_A);
+}
+
+void RSTEMP_setRsOhm(RSTEMP_Handle handle, const float_t rs_ohm)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	p->rs_Ohm = rs_ohm;
+	RSTEMP_updateFeedforward(p);
+	RSTEMP_updateTemperature(p);
+}
+
+void RSTEMP_setRsRatedOhm(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_Private *p = RSTEMP_priv(handle);
+
+	p->RsRated_Ohm = value;
+	RSTEMP_updateTemperature(p);
+}
+
+void RSTEMP_setRsToRated(RSTEMP_Handle handle)
+{
+	RSTEMP_setRsOhm(handle, RSTEMP_priv(handle)->RsRated_Ohm);
+}
+
+void RSTEMP_setTempRfactor(RSTEMP_Handle handle, const float_t value)
+{
+	RSTEMP_setRsOhm(handle, value * RSTEMP_priv(handle)->RsRated_Ohm);
+}
+
+/* end of rstemp.c */
+
+/************************ (C) COPYRIGHT 2025 Piak Electronic Design B.V. *****END OF FILE****/
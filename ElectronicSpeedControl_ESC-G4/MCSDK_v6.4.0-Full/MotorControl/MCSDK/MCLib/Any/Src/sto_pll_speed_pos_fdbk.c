@@ -961,6 +961,29 @@ __weak void STO_PLL_SetObserverGains(STO_PLL_Handle_t *pHandle, int16_t hhC1, in
 #endif
 }
 
+/**
+  * @brief  Stores in @p pHandle the observer constant @p hhC1 of a new stator resistance.
+  *
+  *  @f$ C_2 @f$ is moved by the change of @f$ C_1 @f$ so that the observer poles stay where they were placed.
+  *  Both constants are used by the high frequency task: call this function with interrupts disabled.
+  */
+__weak void STO_PLL_SetStatorResistanceGain(STO_PLL_Handle_t *pHandle, int16_t hhC1)
+{
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->hC2 = (int16_t)((int32_t)pHandle->hC2 + hhC1 - pHandle->hC1);
+    pHandle->hC1 = hhC1;
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  }
+#endif
+}
+
 /**
   * @brief  Exports current PLL gains from @p pHandle to @p pPgain and @p pIgain.
   * 
@@ -983,25 +1006,117 @@ __weak void STO_GetPLLGains(STO_PLL_Handle_t *pHandle, int16_t *pPgain, int16_t
 }
 
 /**
-  * @brief  Empty function. Could be declared to set instantaneous information on rotor mechanical angle.
-  * 
-  * Note: Mechanical angle management is not implemented in this
-  * version of State observer sensor class.
-  * 
+  * @brief  Interpolates the gain schedule of @p pHandle at the mechanical speed @p hMecSpeedUnit.
+  *
+  * The schedule is indexed by the absolute value of @p hMecSpeedUnit and saturates on its first and
+  * last points. If no schedule is configured, the gains currently in use are returned.
+  * Results are only computed, it is up to the caller to apply them consistently with respect to
+  * the high frequency task, using STO_PLL_SetObserverGains and STO_SetPLLGains.
+  *
+  * @param  pHandle: Handler of the current instance of the STO component.
+  * @param  hMecSpeedUnit: Mechanical speed expressed in the unit defined by #SPEED_UNIT.
+  * @param  pGains: Interpolated gains. hMecSpeedUnit member is set to the absolute input speed.
+  */
+__weak void STO_PLL_CalcScheduledGains(STO_PLL_Handle_t *pHandle, int16_t hMecSpeedUnit,
+                                       STO_PLL_GainSchedPoint_t *pGains)
+{
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  if ((MC_NULL == pHandle) || (MC_NULL == pGains))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const STO_PLL_GainSchedPoint_t *pPoints = pHandle->pGainSched;
+    int32_t wSpeed = (hMecSpeedUnit < 0) ? -(int32_t)hMecSpeedUnit : (int32_t)hMecSpeedUnit;
+
+    pGains->hMecSpeedUnit = (uint16_t)wSpeed;
+
+    if ((MC_NULL == pPoints) || (0U == pHandle->bGainSchedSize))
+    {
+      pGains->hC2 = pHandle->hC2;
+      pGains->hC4 = pHandle->hC4;
+      pGains->hPLLKpGain = PID_GetKP(&pHandle->PIRegulator);
+      pGains->hPLLKiGain = PID_GetKI(&pHandle->PIRegulator);
+    }
+    else if (wSpeed <= (int32_t)pPoints[0].hMecSpeedUnit)
+    {
+      pGains->hC2 = pPoints[0].hC2;
+      pGains->hC4 = pPoints[0].hC4;
+      pGains->hPLLKpGain = pPoints[0].hPLLKpGain;
+      pGains->hPLLKiGain = pPoints[0].hPLLKiGain;
+    }
+    else
+    {
+      uint8_t bIndex = 1U;
+
+      while ((bIndex < pHandle->bGainSchedSize) && (wSpeed > (int32_t)pPoints[bIndex].hMecSpeedUnit))
+      {
+        bIndex++;
+      }
+
+      if (bIndex >= pHandle->bGainSchedSize)
+      {
+        bIndex = pHandle->bGainSchedSize - 1U;
+        pGains->hC2 = pPoints[bIndex].hC2;
+        pGains->hC4 = pPoints[bIndex].hC4;
+        pGains->hPLLKpGain = pPoints[bIndex].hPLLKpGain;
+        pGains->hPLLKiGain = pPoints[bIndex].hPLLKiGain;
+      }
+      else
+      {
+        const STO_PLL_GainSchedPoint_t *pLow = &pPoints[bIndex - 1U];
+        const STO_PLL_GainSchedPoint_t *pHigh = &pPoints[bIndex];
+        int32_t wDelta = wSpeed - (int32_t)pLow->hMecSpeedUnit;
+        int32_t wSpan = (int32_t)pHigh->hMecSpeedUnit - (int32_t)pLow->hMecSpeedUnit;
+
+        /* wSpan cannot be zero here as wSpeed is strictly between the two points */
+        pGains->hC2 = (int16_t)(pLow->hC2 + ((((int32_t)pHigh->hC2 - pLow->hC2) * wDelta) / wSpan));
+        pGains->hC4 = (int16_t)(pLow->hC4 + ((((int32_t)pHigh->hC4 - pLow->hC4) * wDelta) / wSpan));
+        pGains->hPLLKpGain = (int16_t)(pLow->hPLLKpGain
+                                       + ((((int32_t)pHigh->hPLLKpGain - pLow->hPLLKpGain) * wDelta) / wSpan));
+        pGains->hPLLKiGain = (int16_t)(pLow->hPLLKiGain
+                                       + ((((int32_t)pHigh->hPLLKiGain - pLow->hPLLKiGain) * wDelta) / wSpan));
+      }
+    }
+
+    if ((MC_NULL != pPoints) && (0U != pHandle->bGainSchedSize))
+    {
+      /* The schedule holds C2 at the rated stator resistance */
+      pGains->hC2 = (int16_t)((int32_t)pGains->hC2 + pHandle->hC1 - pHandle->hC1Rated);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Sets instantaneous information on rotor mechanical angle.
+  *
+  * Seeds the angle integrated by the PLL, for instance with the result of an initial rotor
+  * position detection. The Bemf estimation itself is not affected.
+  *
   * @param  pHandle: Handler of the current instance of the STO component.
   * @param  hMecAngle: Instantaneous measure of rotor mechanical angle.
   */
-//cstat !MISRAC2012-Rule-8.13 !RED-func-no-effect
 __weak void STO_PLL_SetMecAngle(STO_PLL_Handle_t *pHandle, int16_t hMecAngle)
 {
 #ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
-  if ((MC_NULL == (void *)pHandle) || ((int16_t)0 == hMecAngle))
+  if (MC_NULL == pHandle)
   {
     /* Nothing to do */
   }
   else
   {
-    /* nothing to do */
+#endif
+    pHandle->_Super.hMecAngle = hMecAngle;
+    pHandle->_Super.hElAngle = hMecAngle * (int16_t)pHandle->_Super.bElToMecRatio;
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
   }
 #endif
 }
@@ -1065,6 +1180,36 @@ __weak bool STO_PLL_IsBemfConsistent(STO_PLL_Handle_t *pHandle)
 #endif
 }
 
+/**
+  * @brief  Checks if the Bemf is consistent within a given tolerance.
+  *
+  *  Applies the test of the Bemf consistency check to the levels computed by the last call to
+  *  STO_PLL_CalcAvrgMecSpeedUnit, with the tolerance of the caller instead of BemfConsistencyCheck. A check
+  *  tighter than the one of the speed reliability can so be made without changing the latter.
+  * @param  pHandle: Handler of the current instance of the STO component.
+  * @param  bTolerance: Degree of consistency of the observed Bemf, in the scale of BemfConsistencyCheck.
+  * @retval bool True when the observed Bemf level is above the estimated one lowered by the tolerance.
+  */
+__weak bool STO_PLL_IsBemfConsistentWithin(const STO_PLL_Handle_t *pHandle, uint8_t bTolerance)
+{
+  bool bConsistent;
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  if (MC_NULL == pHandle)
+  {
+    bConsistent = false;
+  }
+  else
+  {
+#endif
+    int32_t wEstBemfSqLo = pHandle->Est_Bemf_Level - ((pHandle->Est_Bemf_Level / 64) * ((int32_t)bTolerance));
+
+    bConsistent = (pHandle->Obs_Bemf_Level > wEstBemfSqLo);
+#ifdef NULL_PTR_CHECK_STO_PLL_SPD_POS_FDB
+  }
+#endif
+  return (bConsistent);
+}
+
 /**
   * @brief  Checks the value of the variance.
   * 
@@ -475,7 +475,9 @@ __weak void R3_2_CurrentReadingPolarization(PWMC_Handle_t *pHdl)
   volatile PWMC_GetPhaseCurr_Cb_t GetPhaseCurrCbSave;
   volatile PWMC_SetSampPointSectX_Cb_t SetSampPointSectXCbSave;
 
-
+  /* Offsets already set, for instance from the parameter store: only the PWM outputs are restored */
+  if (false == pHandle->_Super.offsetCalibStatus)
+  {
     /* Save callback routines */
     GetPhaseCurrCbSave = pHandle->_Super.pFctGetPhaseCurrents;
     SetSampPointSectXCbSave = pHandle->_Super.pFctSetADCSampPointSectX;
@@ -534,23 +536,28 @@ __weak void R3_2_CurrentReadingPolarization(PWMC_Handle_t *pHdl)
     /* Change back function to be executed in ADCx_ISR */
     pHandle->_Super.pFctGetPhaseCurrents = GetPhaseCurrCbSave;
     pHandle->_Super.pFctSetADCSampPointSectX = SetSampPointSectXCbSave;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
 
-    /* It over write TIMx CCRy wrongly written by FOC during calibration so as to
-     force 50% duty cycle on the three inverer legs */
-    /* Disable TIMx preload */
-    LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH1);
-    LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH2);
-    LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH3);
-    LL_TIM_OC_SetCompareCH1 (TIMx, pHandle->Half_PWMPeriod >> 1u);
-    LL_TIM_OC_SetCompareCH2 (TIMx, pHandle->Half_PWMPeriod >> 1u);
-    LL_TIM_OC_SetCompareCH3 (TIMx, pHandle->Half_PWMPeriod >> 1u);
-    /* Apply new CC values */
-    LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH1);
-    LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH2);
-    LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH3);
+  /* It over write TIMx CCRy wrongly written by FOC during calibration so as to
+   force 50% duty cycle on the three inverer legs */
+  /* Disable TIMx preload */
+  LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH1);
+  LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH2);
+  LL_TIM_OC_DisablePreload(TIMx, LL_TIM_CHANNEL_CH3);
+  LL_TIM_OC_SetCompareCH1 (TIMx, pHandle->Half_PWMPeriod >> 1u);
+  LL_TIM_OC_SetCompareCH2 (TIMx, pHandle->Half_PWMPeriod >> 1u);
+  LL_TIM_OC_SetCompareCH3 (TIMx, pHandle->Half_PWMPeriod >> 1u);
+  /* Apply new CC values */
+  LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH1);
+  LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH2);
+  LL_TIM_OC_EnablePreload(TIMx, LL_TIM_CHANNEL_CH3);
 
-    /* It re-enable drive of TIMx CHy and CHyN by TIMx CHyRef */
-    LL_TIM_CC_EnableChannel(TIMx, TIMxCCER_MASK_CH123);
+  /* It re-enable drive of TIMx CHy and CHyN by TIMx CHyRef */
+  LL_TIM_CC_EnableChannel(TIMx, TIMxCCER_MASK_CH123);
 
   /* At the end of calibration, all phases are at 50% we will sample A&B */
   pHandle->_Super.Sector = SECTOR_5;
@@ -5,23 +5,88 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df2T_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df2T_init_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_bitreversal2.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_cfft_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_cfft_radix8_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/CommonTables/arm_common_tables.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FastMathFunctions/arm_cos_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/FullyConnectedFunctions/arm_fully_connected_q7.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/NNSupportFunctions/arm_q7_to_q15_reordered_no_shift.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/ActivationFunctions/arm_relu_q7.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_rfft_fast_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_rfft_fast_init_f32.c \
+C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FastMathFunctions/arm_sin_f32.c \
 C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Src/system_stm32g4xx.c 
 
 OBJS += \
+./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.o \
+./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.o \
+./Drivers/CMSIS/arm_bitreversal2.o \
+./Drivers/CMSIS/arm_cfft_f32.o \
+./Drivers/CMSIS/arm_cfft_radix8_f32.o \
+./Drivers/CMSIS/arm_common_tables.o \
+./Drivers/CMSIS/arm_cos_f32.o \
+./Drivers/CMSIS/arm_fully_connected_q7.o \
+./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.o \
+./Drivers/CMSIS/arm_relu_q7.o \
+./Drivers/CMSIS/arm_rfft_fast_f32.o \
+./Drivers/CMSIS/arm_rfft_fast_init_f32.o \
+./Drivers/CMSIS/arm_sin_f32.o \
 ./Drivers/CMSIS/system_stm32g4xx.o 
 
 C_DEPS += \
+./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.d \
+./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.d \
+./Drivers/CMSIS/arm_bitreversal2.d \
+./Drivers/CMSIS/arm_cfft_f32.d \
+./Drivers/CMSIS/arm_cfft_radix8_f32.d \
+./Drivers/CMSIS/arm_common_tables.d \
+./Drivers/CMSIS/arm_cos_f32.d \
+./Drivers/CMSIS/arm_fully_connected_q7.d \
+./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.d \
+./Drivers/CMSIS/arm_relu_q7.d \
+./Drivers/CMSIS/arm_rfft_fast_f32.d \
+./Drivers/CMSIS/arm_rfft_fast_init_f32.d \
+./Drivers/CMSIS/arm_sin_f32.d \
 ./Drivers/CMSIS/system_stm32g4xx.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
+Drivers/CMSIS/arm_biquad_cascade_df2T_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df2T_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df2T_init_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_bitreversal2.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_bitreversal2.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_cfft_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_cfft_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_cfft_radix8_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_cfft_radix8_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_common_tables.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/CommonTables/arm_common_tables.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_cos_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FastMathFunctions/arm_cos_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_fully_connected_q7.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/FullyConnectedFunctions/arm_fully_connected_q7.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/NNSupportFunctions/arm_q7_to_q15_reordered_no_shift.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_relu_q7.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/NN/Source/ActivationFunctions/arm_relu_q7.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_rfft_fast_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_rfft_fast_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_rfft_fast_init_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/TransformFunctions/arm_rfft_fast_init_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Drivers/CMSIS/arm_sin_f32.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Drivers/CMSIS/DSP/Source/FastMathFunctions/arm_sin_f32.c Drivers/CMSIS/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Drivers/CMSIS/system_stm32g4xx.o: C:/Users/Kenneth/Documents/B-G431B-ESC1/ElectronicSpeedControl_ESC-G4/Src/system_stm32g4xx.c Drivers/CMSIS/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DARM_MATH_CM4 -DUSE_HAL_DRIVER -DSTM32G431xx -c -I../../Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc -I../../Drivers/STM32G4xx_HAL_Driver/Inc/Legacy -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/Any/Inc -I../../MCSDK_v6.4.0-Full/MotorControl/MCSDK/MCLib/G4xx/Inc -I../../Drivers/CMSIS/Device/ST/STM32G4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/CMSIS/DSP/Include -I../../Drivers/CMSIS/NN/Include -Ofast -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Drivers-2f-CMSIS
 
 clean-Drivers-2f-CMSIS:
-	-$(RM) ./Drivers/CMSIS/system_stm32g4xx.cyclo ./Drivers/CMSIS/system_stm32g4xx.d ./Drivers/CMSIS/system_stm32g4xx.o ./Drivers/CMSIS/system_stm32g4xx.su
+	-$(RM) ./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.cyclo ./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.d ./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.o ./Drivers/CMSIS/arm_biquad_cascade_df2T_f32.su ./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.cyclo ./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.d ./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.o ./Drivers/CMSIS/arm_biquad_cascade_df2T_init_f32.su ./Drivers/CMSIS/arm_bitreversal2.cyclo ./Drivers/CMSIS/arm_bitreversal2.d ./Drivers/CMSIS/arm_bitreversal2.o ./Drivers/CMSIS/arm_bitreversal2.su ./Drivers/CMSIS/arm_cfft_f32.cyclo ./Drivers/CMSIS/arm_cfft_f32.d ./Drivers/CMSIS/arm_cfft_f32.o ./Drivers/CMSIS/arm_cfft_f32.su ./Drivers/CMSIS/arm_cfft_radix8_f32.cyclo ./Drivers/CMSIS/arm_cfft_radix8_f32.d ./Drivers/CMSIS/arm_cfft_radix8_f32.o ./Drivers/CMSIS/arm_cfft_radix8_f32.su ./Drivers/CMSIS/arm_common_tables.cyclo ./Drivers/CMSIS/arm_common_tables.d ./Drivers/CMSIS/arm_common_tables.o ./Drivers/CMSIS/arm_common_tables.su ./Drivers/CMSIS/arm_cos_f32.cyclo ./Drivers/CMSIS/arm_cos_f32.d ./Drivers/CMSIS/arm_cos_f32.o ./Drivers/CMSIS/arm_cos_f32.su ./Drivers/CMSIS/arm_fully_connected_q7.cyclo ./Drivers/CMSIS/arm_fully_connected_q7.d ./Drivers/CMSIS/arm_fully_connected_q7.o ./Drivers/CMSIS/arm_fully_connected_q7.su ./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.cyclo ./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.d ./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.o ./Drivers/CMSIS/arm_q7_to_q15_reordered_no_shift.su ./Drivers/CMSIS/arm_relu_q7.cyclo ./Drivers/CMSIS/arm_relu_q7.d ./Drivers/CMSIS/arm_relu_q7.o ./Drivers/CMSIS/arm_relu_q7.su ./Drivers/CMSIS/arm_rfft_fast_f32.cyclo ./Drivers/CMSIS/arm_rfft_fast_f32.d ./Drivers/CMSIS/arm_rfft_fast_f32.o ./Drivers/CMSIS/arm_rfft_fast_f32.su ./Drivers/CMSIS/arm_rfft_fast_init_f32.cyclo ./Drivers/CMSIS/arm_rfft_fast_init_f32.d ./Drivers/CMSIS/arm_rfft_fast_init_f32.o ./Drivers/CMSIS/arm_rfft_fast_init_f32.su ./Drivers/CMSIS/arm_sin_f32.cyclo ./Drivers/CMSIS/arm_sin_f32.d ./Drivers/CMSIS/arm_sin_f32.o ./Drivers/CMSIS/arm_sin_f32.su ./Drivers/CMSIS/system_stm32g4xx.cyclo ./Drivers/CMSIS/system_stm32g4xx.d ./Drivers/CMSIS/system_stm32g4xx.o ./Drivers/CMSIS/system_stm32g4xx.su
 
 .PHONY: clean-Drivers-2f-CMSIS
 
@@ -0,0 +1,278 @@
+
+/**
+  ******************************************************************************
+  * @file    anomaly_detector.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Anomaly Detector component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup AnomalyDetector
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "anomaly_detector.h"
+#include "stm32g4xx.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup AnomalyDetector Anomaly Detector
+  * @brief Reconstruction error of an int8 autoencoder on the telemetry of the drive
+  *
+  * The medium frequency task averages #ANOM_FEATURE_NBR features of the running drive over
+  * hDecimation periods. In the idle time, never in an interrupt, the features are quantized to q7
+  * and run through an autoencoder of #ANOM_LAYER_NBR fully connected layers with the
+  * arm_fully_connected_q7 kernel of CMSIS-NN. Trained on the normal operation of the drive, the
+  * autoencoder reconstructs normal features closely and anomalous ones poorly: the mean squared
+  * difference between its input and its output, low passed, is the anomaly score.
+  *
+  * The anomaly flag is raised once the score stayed above the threshold of the model for hPersistence
+  * inferences, and cleared after as many inferences below it or at the next start of the drive.
+  *
+  * The model is generated with its quantization, the feature scaling and the threshold, by the host
+  * training script of Utilities/AnomalyDetector, whose host build runs ANOM_Infer on the same kernels.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Returns the reconstruction error of the model on a set of features, q7 squared.
+  * @param  pModel: autoencoder.
+  * @param  pFeatures: #ANOM_FEATURE_NBR features, in the order of #ANOM_Feature_t.
+  * @param  pActivations: buffer of 2 * #ANOM_MAX_WIDTH activations.
+  * @param  pVecBuffer: buffer of #ANOM_MAX_WIDTH q15, scratch of the kernel.
+  */
+uint16_t ANOM_Infer(const ANOM_Model_t *pModel, const float_t *pFeatures, q7_t *pActivations, q15_t *pVecBuffer)
+{
+  q7_t bInput[ANOM_FEATURE_NBR];
+  const q7_t *pLayerInput = bInput;
+  int32_t wError = 0;
+  uint8_t i;
+
+  for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+  {
+    float_t fInput = (pFeatures[i] - pModel->fOffset[i]) * pModel->fScale[i];
+
+    fInput = (fInput > 127.0f) ? 127.0f : ((fInput < -128.0f) ? -128.0f : fInput);
+    bInput[i] = (q7_t)((fInput >= 0.0f) ? (fInput + 0.5f) : (fInput - 0.5f));
+  }
+
+  for (i = 0U; i < ANOM_LAYER_NBR; i++)
+  {
+    const ANOM_Layer_t *pLayer = &pModel->Layers[i];
+    q7_t *pLayerOutput = &pActivations[(i & 1U) * ANOM_MAX_WIDTH];
+
+    (void)arm_fully_connected_q7(pLayerInput, pLayer->pWeights, pLayer->hInputs, pLayer->hOutputs,
+                                 pLayer->hBiasShift, pLayer->hOutShift, pLayer->pBias, pLayerOutput, pVecBuffer);
+    if (true == pLayer->bRelu)
+    {
+      arm_relu_q7(pLayerOutput, pLayer->hOutputs);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pLayerInput = pLayerOutput;
+  }
+
+  for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+  {
+    int32_t wDiff = (int32_t)bInput[i] - (int32_t)pLayerInput[i];
+
+    wError += wDiff * wDiff;
+  }
+  return ((uint16_t)(wError / (int32_t)ANOM_FEATURE_NBR));
+}
+
+/**
+  * @brief  Initializes the Anomaly Detector component.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  */
+__weak void ANOM_Init(ANOM_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_ANOM
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bRunning = false;
+    pHandle->bRestart = true;
+    pHandle->bReady = false;
+    pHandle->hCount = 0U;
+    pHandle->hRawScore = 0U;
+    pHandle->hInferences = 0U;
+    pHandle->wCycles = 0U;
+#ifdef NULL_PTR_CHECK_ANOM
+  }
+#endif
+}
+
+/**
+  * @brief  Averages the features while the drive runs, to be called by the medium frequency task.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  * @param  pFeatures: #ANOM_FEATURE_NBR features, in the order of #ANOM_Feature_t.
+  * @param  bRunning: the drive is in its RUN state.
+  */
+__weak void ANOM_Accumulate(ANOM_Handle_t *pHandle, const float_t *pFeatures, bool bRunning)
+{
+#ifdef NULL_PTR_CHECK_ANOM
+  if ((MC_NULL == pHandle) || (MC_NULL == pFeatures))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+    if (true == bRunning)
+    {
+      if (false == pHandle->bRunning)
+      {
+        for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+        {
+          pHandle->fSum[i] = 0.0f;
+        }
+        pHandle->hCount = 0U;
+        pHandle->bRestart = true;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+      {
+        pHandle->fSum[i] += pFeatures[i];
+      }
+      pHandle->hCount++;
+
+      if (pHandle->hCount >= pHandle->hDecimation)
+      {
+        /* An average the background task did not take yet is kept, this one is dropped */
+        for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+        {
+          if (false == pHandle->bReady)
+          {
+            pHandle->fFeatures[i] = pHandle->fSum[i] / (float_t)pHandle->hCount;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          pHandle->fSum[i] = 0.0f;
+        }
+        pHandle->hCount = 0U;
+        pHandle->bReady = true;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pHandle->bRunning = bRunning;
+#ifdef NULL_PTR_CHECK_ANOM
+  }
+#endif
+}
+
+/**
+  * @brief  Infers on the features averaged and updates the score and the flag, to be called in the
+  *         idle time.
+  * @param  pHandle: handler of the current instance of the Anomaly Detector component.
+  */
+__weak void ANOM_BackgroundTask(ANOM_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_ANOM
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (true == pHandle->bRestart)
+    {
+      pHandle->bRestart = false;
+      pHandle->wScoreAcc = 0U;
+      pHandle->hScore = 0U;
+      pHandle->hCrossings = 0U;
+      pHandle->bAnomaly = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (true == pHandle->bReady)
+    {
+      uint32_t wStart = DWT->CYCCNT;
+      bool bAbove;
+
+      pHandle->hRawScore = ANOM_Infer(pHandle->pModel, pHandle->fFeatures, pHandle->bActivations,
+                                      pHandle->hVecBuffer);
+      pHandle->bReady = false;
+
+      /* The state keeps the fraction of the score: a division of the step would stick within 2^bScoreShift */
+      pHandle->wScoreAcc += (uint32_t)pHandle->hRawScore - (pHandle->wScoreAcc >> pHandle->bScoreShift);
+      pHandle->hScore = (uint16_t)(pHandle->wScoreAcc >> pHandle->bScoreShift);
+
+      bAbove = (pHandle->hScore > pHandle->pModel->hThreshold);
+      if (bAbove == pHandle->bAnomaly)
+      {
+        pHandle->hCrossings = 0U;
+      }
+      else
+      {
+        pHandle->hCrossings++;
+        if (pHandle->hCrossings >= pHandle->hPersistence)
+        {
+          pHandle->bAnomaly = bAbove;
+          pHandle->hCrossings = 0U;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      pHandle->hInferences++;
+      pHandle->wCycles = DWT->CYCCNT - wStart;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_ANOM
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,128 @@
+
+/**
+  ******************************************************************************
+  * @file    anomaly_model.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains the autoencoder of the Anomaly Detector component,
+  *          generated by Utilities/AnomalyDetector/train_anomaly.py.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup AnomalyDetector
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "anomaly_detector.h"
+
+/* Generated file, do not edit: synthetic drive, 6000 samples, seed 1 */
+
+/* Layer 1: 6 inputs, 16 outputs, rectified */
+static const q7_t AnomalyWeights1M1[96] =
+{
+   -17,    1,  -39,   -1,   -5,  -11,
+     0,  -38,   -7,    9,    1,    3,
+     3,   -4,   14,  -10,   19,  -33,
+    36,   10,   -9,   13,    0,   -2,
+    -1,   -8,    5,   -4,   45,    2,
+   -26,  -22,    1,  -54,   -8,    6,
+     7,   -1,    2,   64,    1,   -1,
+     1,    3,   -9,    9,   19,   26,
+    -9,  -56,  -35,   39,  -34,   28,
+    26,  -18,    7,  -14,    4,    1,
+     5,   57,   46,  -38,   16,   -9,
+    24,  -51,  -10,   53,  -13,   21,
+    15,   11,  -11,   15,   15,   26,
+    14,  -15,  -16,   81,   -3,    2,
+    36,  -16,   47,    9,    2,   21,
+     2,   22,    9,   -9,  -16,   27,
+};
+
+static const q7_t AnomalyBias1M1[16] =
+{
+    56,  120,   78,   52,   90,  -25,  -33,  -14,   61,   90,   53,  -72,  -14,  -30,  -93,   83,
+};
+
+/* Layer 2: 16 inputs, 4 outputs */
+static const q7_t AnomalyWeights2M1[64] =
+{
+    -5,  -53,   20,    9,  -40,  -13,   23,   -7,   49,  -21,  -26,  -38,    5,   14,   -6,   23,
+    24,    9,  -24,  -25,  -34,   32,  -46,   15,  -57,   -5,   46,   37,  -13,  -75,  -15,    0,
+    14,    2,   51,   -5,  -19,    4,  -11,    3,   -8,    0,   -7,   -8,   -3,   20,  -12,  -32,
+    45,  -26,   20,    1,   36,    1,  -11,    3,   10,  -26,  -16,  -28,   -4,   35,  -40,    3,
+};
+
+static const q7_t AnomalyBias2M1[4] =
+{
+    30,  -82,  -19,  -31,
+};
+
+/* Layer 3: 4 inputs, 16 outputs, rectified */
+static const q7_t AnomalyWeights3M1[64] =
+{
+    14,   43,    9,   56,
+    41,   10,   66,  -34,
+   -54,  -17,    0,   47,
+    52,  -61,  -17,    8,
+   -72,  -32,   44,   47,
+     8,    1,   36,  -12,
+   -40,   -7, -102,   38,
+    26,  -78,   15,   11,
+   -50,    0,   17,  -38,
+   -58,    2,  -27,   31,
+   -76,  -49,   27,    4,
+     9,    8,    3,   -9,
+   -68,  -36,  -99,   62,
+    36,   15,    3,   92,
+   -83,  101,   29,   -9,
+   -71,  -48,  -16,  -59,
+};
+
+static const q7_t AnomalyBias3M1[16] =
+{
+    87,  -24,  -95,   41,    9,  -30,   23,  -88,   68,   75,   16,   53,   -4,  -44,  -63,   63,
+};
+
+/* Layer 4: 16 inputs, 6 outputs */
+static const q7_t AnomalyWeights4M1[96] =
+{
+   -43,   32,  -36,  -22,  -22,   -5,  -13,   36,   29,    2,    3,   19,   -1,   49,  -18,   19,
+    -2,   30,  -71,  -34,   -8,   15,   23,   69,    0,   43,  -33,   13,   -3,   51,  -22,  -34,
+   -61,  -24,  -25,  -19,  -30,  -24,   -1,   24,   18,   30,    6,    1,  -34,   -1,   15,   17,
+    -3,   -7,  -36,    9,   10,   38,    6,   38,   30,  -20,   -4,   12,    8,   26,  -73,  -14,
+   -16,   26,  -40,  -27,   30,   30,   19,    8,   -1,   11,   13,  -47,   40,   23,    4,  -18,
+   -13,  -14,   29,    0,  -38,  -15,   44,  -16,  -29,   -1,  -12,  -27,   46,  -20,   16,   24,
+};
+
+static const q7_t AnomalyBias4M1[6] =
+{
+   -10,   62,   26,  -14,  -65,  -28,
+};
+
+/**
+  * @brief  Autoencoder of the Anomaly Detector Motor 1.
+  */
+const ANOM_Model_t AnomalyModelM1 =
+{
+  .fOffset    = {2457.039f, -52.89223f, 16719.63f, 21.24883f, 15.7435f, 35.59229f},
+  .fScale     = {0.02453329f, 0.6843376f, 0.006595797f, 0.08799305f, 51.74697f, 3.634257f},
+  .Layers     =
+  {
+    {AnomalyWeights1M1, AnomalyBias1M1, 6U, 16U, 5U, 7U, true},
+    {AnomalyWeights2M1, AnomalyBias2M1, 16U, 4U, 2U, 7U, false},
+    {AnomalyWeights3M1, AnomalyBias3M1, 4U, 16U, 4U, 6U, true},
+    {AnomalyWeights4M1, AnomalyBias4M1, 16U, 6U, 4U, 5U, false},
+  },
+  .hThreshold = 72U,
+};
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
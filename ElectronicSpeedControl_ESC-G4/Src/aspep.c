@@ -467,7 +467,7 @@ uint8_t ASPEP_sendPacket(MCTL_Handle_t *pSupHandle, void *txBuffer, uint16_t txD
   *
   * This function contains a critical section.
   * It can be accessed concurently under High frequency task (by MCPA_datalog)
-  * and under Medium frequency task (MC_Scheduler -> ASPEP_RxFrameProcess ).
+  * and under the deferred Motor Control Protocol task (TSK_MCPTask -> ASPEP_RxFrameProcess ).
   *
   * @param  *pHandle Handler of the current instance of the ASPEP component
   * @param  dataType Nature of the communication : synchronous, asynchronous or a CTL packet
@@ -916,6 +916,31 @@ void ASPEP_HWDataReceivedIT(ASPEP_Handle_t *pHandle)
 #endif
 }
 
+/**
+  * @brief  Returns true if a packet received, or a reception error, waits for ASPEP_RXframeProcess.
+  *
+  * This function is to be called after ASPEP_HWDataReceivedIT, to release the task processing the packets.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  */
+bool ASPEP_IsPacketPending(const ASPEP_Handle_t *pHandle)
+{
+  bool result = false;
+#ifdef NULL_PTR_CHECK_ASP
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    result = (pHandle->NewPacketAvailable || (pHandle->badPacketFlag > ASPEP_OK));
+#ifdef NULL_PTR_CHECK_ASP
+  }
+#endif
+  return (result);
+}
+
 /**
   * @brief  Resets DMA after debugger has stopped the MCU.
   *
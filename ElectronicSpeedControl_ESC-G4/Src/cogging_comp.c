@@ -0,0 +1,346 @@
+
+/**
+  ******************************************************************************
+  * @file    cogging_comp.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Cogging Compensation component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup CoggingComp
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cogging_comp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup CoggingComp Cogging Compensation
+  * @brief Iq added along the rotor angle against the cogging torque
+  *
+  * The cogging torque is a periodic function of the rotor angle. At low speed the speed regulator can
+  * not follow it, and the speed ripples. A table of #COG_TABLE_SIZE Iq offsets over one revolution of
+  * the index angle is added to the Iq reference by the current control, interpolated between two
+  * entries. The index angle is the electrical angle, whose revolution holds a whole number of cogging
+  * periods on the usual slot and pole combinations (12 on a 12 slots, 14 poles motor), or the
+  * mechanical angle with a speed sensor giving an absolute position, hSpeedRatio being then the pole
+  * pairs.
+  *
+  * The table is learnt at a constant speed by an iterative learning. The current control accumulates
+  * the instantaneous speed at each entry for hLearnRevolutions revolutions. The medium frequency task
+  * derives the acceleration along the angle, w.dw/dtheta, and its torque in Iq digits from
+  * fAccelPerDigit. The torque the table does not compensate, smoothed along the angle, is subtracted
+  * from the table at a rate fLearnGain. An error on the inertia changes the convergence rate, not the
+  * table learnt. The speed being measured with a lag, the residual of each entry is applied fSensorLag
+  * earlier along the angle.
+  *
+  * The learning runs in COG_LEARN mode, when the drive runs with its ramp completed and its speed
+  * between hLearnMinSpeed and hLearnMaxSpeed: the cogging frequency shall remain within the bandwidth
+  * of the speed sensor, and each entry shall be sampled several times per revolution. The table is
+  * added up to hCompMaxSpeed, above which the inertia filters the cogging.
+  *
+  * @{
+  */
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Restarts the accumulation of the speed */
+static void COG_ResetAcquisition(COG_Handle_t *pHandle)
+{
+  uint16_t i;
+
+  for (i = 0U; i < COG_TABLE_SIZE; i++)
+  {
+    pHandle->wSpeedSum[i] = 0;
+    pHandle->hSamples[i] = 0U;
+  }
+  pHandle->hRevolutions = 0U;
+  pHandle->bLastBin = (uint8_t)(COG_TABLE_SIZE / 2U); /* No revolution counted on the first sample */
+  pHandle->bReady = false;
+}
+
+/* Returns the mean electrical speed accumulated at an entry, s16 per current control period */
+static float_t COG_MeanSpeed(const COG_Handle_t *pHandle, uint16_t hEntry)
+{
+  uint16_t hIndex = hEntry & (uint16_t)(COG_TABLE_SIZE - 1U);
+
+  return ((float_t)pHandle->wSpeedSum[hIndex] / (float_t)pHandle->hSamples[hIndex]);
+}
+
+/* Returns the speed difference across an entry over two entries, smoothed by 1/4, 1/2, 1/4 along the
+   angle so that the noise of the speed does not build up in the table */
+static float_t COG_SpeedSlope(const COG_Handle_t *pHandle, uint16_t hEntry)
+{
+  uint16_t hIndex = hEntry + COG_TABLE_SIZE;
+
+  return ((COG_MeanSpeed(pHandle, hIndex + 2U) - COG_MeanSpeed(pHandle, hIndex - 2U)
+           + (2.0f * (COG_MeanSpeed(pHandle, hIndex + 1U) - COG_MeanSpeed(pHandle, hIndex - 1U)))) * 0.25f);
+}
+
+/* Subtracts the torque the table does not compensate, Iq digit, from the table */
+static void COG_Learn(COG_Handle_t *pHandle)
+{
+  int32_t wSum = 0;
+  uint32_t wSamples = 0U;
+  bool bComplete = true;
+  uint16_t i;
+
+  for (i = 0U; i < COG_TABLE_SIZE; i++)
+  {
+    wSum += pHandle->wSpeedSum[i];
+    wSamples += pHandle->hSamples[i];
+    bComplete = (0U == pHandle->hSamples[i]) ? false : bComplete;
+  }
+
+  if (true == bComplete)
+  {
+    float_t fEntryAngle = 65536.0f / (float_t)COG_TABLE_SIZE;
+    float_t fIndexSpeed = ((float_t)wSum / (float_t)wSamples) / (float_t)pHandle->hSpeedRatio;
+    /* w.dw/dtheta over the acceleration of a digit, the slope taken over two entries. Periodic, the
+       residual has no mean: the table keeps the mean torque to the speed regulator */
+    float_t fScale = fIndexSpeed / (2.0f * fEntryAngle * pHandle->fAccelPerDigit);
+    float_t fLag = (fIndexSpeed * pHandle->fSensorLag) / fEntryAngle;
+    int16_t hShift = (int16_t)((fLag >= 0.0f) ? (fLag + 0.5f) : (fLag - 0.5f));
+    float_t fMax = (float_t)pHandle->hIqMax;
+
+    for (i = 0U; i < COG_TABLE_SIZE; i++)
+    {
+      uint16_t hEntry = (uint16_t)((int32_t)i - hShift) & (uint16_t)(COG_TABLE_SIZE - 1U);
+      float_t fEntry = pHandle->fTable[hEntry] - (pHandle->fLearnGain * fScale * COG_SpeedSlope(pHandle, i));
+
+      fEntry = (fEntry > fMax) ? fMax : ((fEntry < -fMax) ? -fMax : fEntry);
+      pHandle->fTable[hEntry] = fEntry;
+      pHandle->hTable[hEntry] = (int16_t)((fEntry >= 0.0f) ? (fEntry + 0.5f) : (fEntry - 0.5f));
+    }
+
+    if (pHandle->hIterations < UINT16_MAX)
+    {
+      pHandle->hIterations++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Initializes the Cogging Compensation component, the table cleared.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  */
+__weak void COG_Init(COG_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Mode = COG_OFF;
+    pHandle->bActive = false;
+    COG_ClearTable(pHandle);
+    COG_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @brief  Stops the acquisition, to be called when the drive stops. The table is kept.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  */
+__weak void COG_Clear(COG_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bAcquire = false;
+    COG_ResetAcquisition(pHandle);
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @brief  Clears the table.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  */
+__weak void COG_ClearTable(COG_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint16_t i;
+
+    for (i = 0U; i < COG_TABLE_SIZE; i++)
+    {
+      pHandle->hTable[i] = 0;
+      pHandle->fTable[i] = 0.0f;
+    }
+    pHandle->hIterations = 0U;
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @brief  Accumulates the speed at the index angle when learning, to be called by the current control.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  * @param  hAngle: index angle, electrical or mechanical, s16degree.
+  * @param  hElSpeedDpp: instantaneous electrical speed, s16degree per current control period.
+  */
+__weak void COG_Accumulate(COG_Handle_t *pHandle, int16_t hAngle, int16_t hElSpeedDpp)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((true == pHandle->bAcquire) && (false == pHandle->bReady))
+    {
+      /* Each entry gathers the angles within half an entry of its own */
+      uint8_t bBin = (uint8_t)(((((uint32_t)((uint16_t)hAngle)) + ((COG_FRACTION_MASK + 1U) / 2U))
+                                >> COG_FRACTION_BITS) & (COG_TABLE_SIZE - 1U));
+
+      if (pHandle->hSamples[bBin] < UINT16_MAX)
+      {
+        pHandle->wSpeedSum[bBin] += (int32_t)hElSpeedDpp;
+        pHandle->hSamples[bBin]++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if ((((uint8_t)(COG_TABLE_SIZE - 1U) == pHandle->bLastBin) && (0U == bBin))
+       || ((0U == pHandle->bLastBin) && ((uint8_t)(COG_TABLE_SIZE - 1U) == bBin)))
+      {
+        pHandle->hRevolutions++;
+        pHandle->bReady = (pHandle->hRevolutions >= pHandle->hLearnRevolutions);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->bLastBin = bBin;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @brief  Enables the table from the speed, and learns from the accumulated speed, to be called by the
+  *         medium frequency task.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  * @param  bRunning: the drive is in its RUN state.
+  */
+__weak void COG_Task(COG_Handle_t *pHandle, bool bRunning)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int32_t wSpeed = (int32_t)SPD_GetAvrgMecSpeedUnit(STC_GetSpeedSensor(pHandle->pSTC));
+
+    wSpeed = (wSpeed < 0) ? -wSpeed : wSpeed;
+    pHandle->bActive = ((COG_OFF != pHandle->Mode) && (wSpeed <= (int32_t)pHandle->hCompMaxSpeed));
+
+    if ((COG_LEARN == pHandle->Mode) && (true == bRunning) && (true == STC_RampCompleted(pHandle->pSTC))
+     && (wSpeed >= (int32_t)pHandle->hLearnMinSpeed) && (wSpeed <= (int32_t)pHandle->hLearnMaxSpeed))
+    {
+      if (false == pHandle->bAcquire)
+      {
+        COG_ResetAcquisition(pHandle);
+        pHandle->bAcquire = true;
+      }
+      else if (true == pHandle->bReady)
+      {
+        /* The current control does not write the accumulation until it is reset */
+        COG_Learn(pHandle);
+        COG_ResetAcquisition(pHandle);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      pHandle->bAcquire = false;
+    }
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the mode of the Cogging Compensation component. The table is kept.
+  * @param  pHandle: handler of the current instance of the Cogging Compensation component.
+  * @param  Mode: #COG_OFF, #COG_COMPENSATE or #COG_LEARN.
+  */
+__weak void COG_SetMode(COG_Handle_t *pHandle, COG_Mode_t Mode)
+{
+#ifdef NULL_PTR_CHECK_COG
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Mode = Mode;
+#ifdef NULL_PTR_CHECK_COG
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,274 @@
+
+/**
+  ******************************************************************************
+  * @file    deadbeat_current_ctrl.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Deadbeat Current Controller component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup DeadbeatCurrentCtrl
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "deadbeat_current_ctrl.h"
+#include "arm_math.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup DeadbeatCurrentCtrl Deadbeat Current Controller
+  * @brief Model based regulation of the Iqd currents, alternative to the PI regulators
+  *
+  * The windings are modelled by their resistance and inductance, discretized over the period of the
+  * current regulation, the back-emf and the cross coupling of the axes following the electrical speed:
+  *
+  *     i(k+1) = fAlpha.i(k) + fBeta.(v(k) + coupling - emf + disturbance)
+  *
+  * The voltage computed from the currents sampled at k is only applied from k+1, while v(k), computed
+  * one period before, is applied. The model first predicts i(k+1) from v(k), then computes the voltage
+  * bringing the current from i(k+1) to the reference at k+2. With fGain set to 1 the currents settle in
+  * two periods; lower gains leave a geometric decay, less sensitive to the errors of the model.
+  *
+  * The errors of the resistance, the flux and the inverter leave a voltage the model does not know. The
+  * error of each prediction, once the current is sampled, is integrated into that disturbance with the
+  * gain fDisturbanceGain: it plays the part of the integral term, cancelling the static error.
+  *
+  * A voltage vector above hMaxModule cannot be applied: the PI regulators, whose integral terms track
+  * the deadbeat voltage, take over for hHoldPeriods, their anti wind-up handling the saturation.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Initializes the Deadbeat Current Controller component.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  */
+__weak void DBC_Init(DBC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_DBC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (pHandle->fResistance > 0.0f)
+    {
+      /* Exact discretization of the first order of the windings, their time constant being a few periods */
+      pHandle->fAlpha = expf(-pHandle->fResistance / pHandle->fInductance);
+      pHandle->fBeta = (1.0f - pHandle->fAlpha) / pHandle->fResistance;
+    }
+    else
+    {
+      pHandle->fAlpha = 1.0f;
+      pHandle->fBeta = 1.0f / pHandle->fInductance;
+    }
+    pHandle->fInvBeta = 1.0f / pHandle->fBeta;
+    pHandle->wFallbacks = 0U;
+    pHandle->wCycles = 0U;
+    DBC_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_DBC
+  }
+#endif
+}
+
+/**
+  * @brief  Clears the voltage applied and the fallback, to be called before each motor restart.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  */
+__weak void DBC_Clear(DBC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_DBC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Vqd.q = 0;
+    pHandle->Vqd.d = 0;
+    pHandle->bPredicted = false;
+    pHandle->fDisturbanceQ = 0.0f;
+    pHandle->fDisturbanceD = 0.0f;
+    pHandle->hHold = 0U;
+#ifdef NULL_PTR_CHECK_DBC
+  }
+#endif
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Computes the voltage settling the currents at their references, false when the PI shall regulate.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  * @param  Iqd: currents sampled in the current period.
+  * @param  wIqref: Iq reference, digit.
+  * @param  wIdref: Id reference, digit.
+  * @param  hElSpeedDpp: electrical speed, dpp.
+  * @param  pVqd: voltage to apply from the next period, written when true is returned.
+  * @retval true when the deadbeat voltage is applied, false when disabled, saturated or holding the fallback.
+  */
+__weak bool DBC_Controller(DBC_Handle_t *pHandle, qd_t Iqd, int32_t wIqref, int32_t wIdref, int16_t hElSpeedDpp,
+                           qd_t *pVqd)
+{
+  bool bApplied = false;
+#ifdef NULL_PTR_CHECK_DBC
+  if ((MC_NULL == pHandle) || (MC_NULL == pVqd))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (false == pHandle->bEnabled)
+    {
+      pHandle->bPredicted = false;
+    }
+    else if (pHandle->hHold > 0U)
+    {
+      pHandle->bPredicted = false;
+      pHandle->hHold--;
+    }
+    else
+    {
+      /* Cross coupling per current digit, voltage digit, from the angle run over a period */
+      float_t fCoupling = ((float_t)hElSpeedDpp * ((2.0f * PI) / 65536.0f)) * pHandle->fInductance;
+      float_t fEmf = (float_t)hElSpeedDpp * pHandle->fEmfPerDpp;
+      float_t fIq = (float_t)Iqd.q;
+      float_t fId = (float_t)Iqd.d;
+      float_t fIqNext;
+      float_t fIdNext;
+      float_t fVq;
+      float_t fVd;
+      float_t fMax = (float_t)pHandle->hMaxModule;
+
+      if (true == pHandle->bPredicted)
+      {
+        /* Voltage the model missed over the last period */
+        float_t fDisturbanceGain = pHandle->fDisturbanceGain * pHandle->fInvBeta;
+
+        pHandle->fDisturbanceQ += fDisturbanceGain * (fIq - pHandle->fIqPredicted);
+        pHandle->fDisturbanceD += fDisturbanceGain * (fId - pHandle->fIdPredicted);
+        pHandle->fDisturbanceQ = (pHandle->fDisturbanceQ > fMax) ? fMax
+                               : ((pHandle->fDisturbanceQ < -fMax) ? -fMax : pHandle->fDisturbanceQ);
+        pHandle->fDisturbanceD = (pHandle->fDisturbanceD > fMax) ? fMax
+                               : ((pHandle->fDisturbanceD < -fMax) ? -fMax : pHandle->fDisturbanceD);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      /* Currents at the end of the period, under the voltage computed one period before */
+      fIqNext = (pHandle->fAlpha * fIq)
+              + (pHandle->fBeta * ((((float_t)pHandle->Vqd.q - (fCoupling * fId)) - fEmf) + pHandle->fDisturbanceQ));
+      fIdNext = (pHandle->fAlpha * fId)
+              + (pHandle->fBeta * (((float_t)pHandle->Vqd.d + (fCoupling * fIq)) + pHandle->fDisturbanceD));
+      pHandle->fIqPredicted = fIqNext;
+      pHandle->fIdPredicted = fIdNext;
+      pHandle->bPredicted = true;
+
+      /* Voltage bringing them to their references over the next period */
+      fVq = (pHandle->fInvBeta * ((fIqNext + (pHandle->fGain * ((float_t)wIqref - fIqNext)))
+                                  - (pHandle->fAlpha * fIqNext)))
+          + (fCoupling * fIdNext) + fEmf - pHandle->fDisturbanceQ;
+      fVd = (pHandle->fInvBeta * ((fIdNext + (pHandle->fGain * ((float_t)wIdref - fIdNext)))
+                                  - (pHandle->fAlpha * fIdNext)))
+          - (fCoupling * fIqNext) - pHandle->fDisturbanceD;
+
+      if (((fVq * fVq) + (fVd * fVd)) > (fMax * fMax))
+      {
+        /* Beyond the voltage available: the PI regulators resume from the voltage applied */
+        pHandle->bPredicted = false;
+        pHandle->hHold = pHandle->hHoldPeriods;
+        pHandle->wFallbacks++;
+      }
+      else
+      {
+        pVqd->q = (int16_t)fVq;
+        pVqd->d = (int16_t)fVd;
+        pHandle->Vqd = *pVqd;
+
+        /* Bumpless fallback: the PI outputs start from the voltage applied */
+        PID_SetIntegralTerm(pHandle->pPIDIq, (int32_t)pVqd->q * (int32_t)PID_GetKIDivisor(pHandle->pPIDIq));
+        PID_SetIntegralTerm(pHandle->pPIDId, (int32_t)pVqd->d * (int32_t)PID_GetKIDivisor(pHandle->pPIDId));
+        bApplied = true;
+      }
+    }
+#ifdef NULL_PTR_CHECK_DBC
+  }
+#endif
+  return (bApplied);
+}
+
+/**
+  * @brief  Records the voltage computed by the PI regulators, applied over the next period.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  * @param  Vqd: voltage computed by the PI regulators.
+  */
+__weak void DBC_SetApplied(DBC_Handle_t *pHandle, qd_t Vqd)
+{
+#ifdef NULL_PTR_CHECK_DBC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Vqd = Vqd;
+#ifdef NULL_PTR_CHECK_DBC
+  }
+#endif
+}
+
+/**
+  * @brief  Enables or disables the deadbeat regulation, the PI regulating when disabled.
+  * @param  pHandle: handler of the current instance of the Deadbeat Current Controller component.
+  * @param  bEnable: true to regulate with the model.
+  */
+__weak void DBC_SetEnabled(DBC_Handle_t *pHandle, bool bEnable)
+{
+#ifdef NULL_PTR_CHECK_DBC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bEnabled = bEnable;
+#ifdef NULL_PTR_CHECK_DBC
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
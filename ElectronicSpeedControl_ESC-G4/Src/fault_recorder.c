@@ -0,0 +1,387 @@
+
+/**
+  ******************************************************************************
+  * @file    fault_recorder.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Fault Recorder component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup FaultRecorder
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fault_recorder.h"
+#include "mcp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup FaultRecorder Fault Recorder
+  * @brief Log of the faults with the drive state that preceded them
+  *
+  * The high frequency task adds the currents, voltages, bus voltage and speed to a ring of
+  * #FLR_SAMPLE_NBR samples every #FLR_DECIMATION current control periods. The first high frequency
+  * task that sees a fault, or an over current still to be processed by the safety task, freezes
+  * the ring with the time, state, faults and temperature.
+  *
+  * The record is appended to @ref FlashRecords by FLR_BackgroundTask, from the main loop, once the
+  * state machine is in a fault state: the PWM is off, and the acknowledgement of the faults waits
+  * for the end of the write. The write takes at most a page erase and a record program, about 25 ms,
+  * during which interrupts running from the flash are stalled. Sampling restarts once the faults
+  * are acknowledged.
+  *
+  * The log is read back and erased by the FAULT_LOG_CMD command of the MCP.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* MCP reply header: sequence number of the newest record, number of chunks of a record */
+#define FLR_REPLY_HEADER_SIZE       5U
+#define FLR_CHUNK_NBR               ((sizeof(FLR_Record_t) + FLR_CHUNK_SIZE - 1U) / FLR_CHUNK_SIZE)
+
+/**
+  * @brief  Returns the faults the recorder reacts to.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  */
+static uint16_t FLR_GetFaults(const FLR_Handle_t *pHandle)
+{
+  uint16_t hFaults = pHandle->pMCI->CurrentFaults | pHandle->pMCI->PastFaults;
+
+  /* Over current signalled by the break input, not yet processed by the safety task */
+  return ((true == pHandle->pPWMC->OverCurrentFlag) ? (hFaults | (uint16_t)MC_OVER_CURR) : hFaults);
+}
+
+/**
+  * @brief  Reverses the order of the samples between two positions of the ring.
+  * @param  pSamples: samples.
+  * @param  bFirst: first sample.
+  * @param  bLast: last sample.
+  */
+static void FLR_Reverse(FLR_Sample_t *pSamples, uint8_t bFirst, uint8_t bLast)
+{
+  uint8_t i = bFirst;
+  uint8_t j = bLast;
+
+  while (i < j)
+  {
+    FLR_Sample_t Sample = pSamples[i];
+
+    pSamples[i] = pSamples[j];
+    pSamples[j] = Sample;
+    i++;
+    j--;
+  }
+}
+
+/**
+  * @brief  Initializes the Fault Recorder component and finds the newest record of the log.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  */
+__weak void FLR_Init(FLR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    FREC_Init(&pHandle->Records);
+    pHandle->hDecimationCnt = 0U;
+    pHandle->bIndex = 0U;
+    pHandle->Record.bSampleNbr = 0U;
+    pHandle->Record.hDecimation = pHandle->hDecimation;
+    pHandle->bEraseRequest = false;
+    pHandle->hWriteErrors = 0U;
+    pHandle->State = FLR_SAMPLING;
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  }
+#endif
+}
+
+/**
+  * @brief  Samples the drive, or freezes the samples on a fault.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  * @param  wTimestamp: time of the sample, GLOBAL_TIMESTAMP.
+  *
+  * - Called by the high frequency task, after the current regulation.
+  */
+__weak void FLR_Sample(FLR_Handle_t *pHandle, uint32_t wTimestamp)
+{
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint16_t hFaults = FLR_GetFaults(pHandle);
+    FLR_Record_t *pRecord = &pHandle->Record;
+
+    switch (pHandle->State)
+    {
+      case FLR_SAMPLING:
+      {
+        if (hFaults != MC_NO_FAULTS)
+        {
+          pRecord->wTimestamp = wTimestamp;
+          pRecord->hFaults = hFaults;
+          pRecord->bState = (uint8_t)pHandle->pMCI->State;
+          pRecord->hCelsius = NTC_GetAvTemp_C(pHandle->pTemperatureSensor);
+          pHandle->State = FLR_FROZEN;
+        }
+        else
+        {
+          pHandle->hDecimationCnt++;
+          if (pHandle->hDecimationCnt >= pHandle->hDecimation)
+          {
+            FLR_Sample_t *pSample = &pRecord->Samples[pHandle->bIndex];
+
+            pHandle->hDecimationCnt = 0U;
+            pSample->hIq = pHandle->pFOCVars->Iqd.q;
+            pSample->hId = pHandle->pFOCVars->Iqd.d;
+            pSample->hVq = pHandle->pFOCVars->Vqd.q;
+            pSample->hVd = pHandle->pFOCVars->Vqd.d;
+            pSample->hVbus = VBS_GetBusVoltage_d(pHandle->pBusSensor);
+            pSample->hMecSpeedUnit = SPD_GetAvrgMecSpeedUnit(STC_GetSpeedSensor(pHandle->pSTC));
+            pHandle->bIndex = (uint8_t)((pHandle->bIndex + 1U) % FLR_SAMPLE_NBR);
+            if (pRecord->bSampleNbr < FLR_SAMPLE_NBR)
+            {
+              pRecord->bSampleNbr++;
+            }
+            else
+            {
+              /* Nothing to do, the oldest sample was overwritten */
+            }
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        break;
+      }
+
+      case FLR_RECORDED:
+      {
+        if (MC_NO_FAULTS == hFaults)
+        {
+          pHandle->hDecimationCnt = 0U;
+          pHandle->bIndex = 0U;
+          pRecord->bSampleNbr = 0U;
+          pHandle->State = FLR_SAMPLING;
+        }
+        else
+        {
+          /* Nothing to do, waits for the acknowledgement */
+        }
+        break;
+      }
+
+      default:
+        /* Nothing to do, the record waits to be written */
+        break;
+    }
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  }
+#endif
+}
+
+/**
+  * @brief  Writes the frozen record to the flash and executes the erase requests.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  *
+  * - Called from the main loop. Flash operations are done with the PWM off only: in a fault
+  *   state for a record, in IDLE for an erase.
+  */
+__weak void FLR_BackgroundTask(FLR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    MCI_State_t State = MCI_GetSTMState(pHandle->pMCI);
+
+    if ((FLR_FROZEN == pHandle->State) && ((FAULT_NOW == State) || (FAULT_OVER == State)))
+    {
+      FLR_Record_t *pRecord = &pHandle->Record;
+
+      /* Oldest sample first: the ring is rotated left by its write position once full, already in
+         order when the write position wrapped to 0 */
+      if ((FLR_SAMPLE_NBR == pRecord->bSampleNbr) && (pHandle->bIndex > 0U))
+      {
+        FLR_Reverse(pRecord->Samples, 0U, (uint8_t)(pHandle->bIndex - 1U));
+        FLR_Reverse(pRecord->Samples, pHandle->bIndex, (uint8_t)(FLR_SAMPLE_NBR - 1U));
+        FLR_Reverse(pRecord->Samples, 0U, (uint8_t)(FLR_SAMPLE_NBR - 1U));
+      }
+      else
+      {
+        /* Nothing to do, the oldest sample is at 0 */
+      }
+      pRecord->hFaults |= pHandle->pMCI->PastFaults;
+
+      if (false == FREC_Append(&pHandle->Records, pRecord, (uint16_t)sizeof(FLR_Record_t)))
+      {
+        pHandle->hWriteErrors++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->State = FLR_RECORDED;
+    }
+    else if ((true == pHandle->bEraseRequest) && (IDLE == State))
+    {
+      (void)FREC_Erase(&pHandle->Records);
+      pHandle->bEraseRequest = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  }
+#endif
+}
+
+/**
+  * @brief  Returns true while a record waits to be written.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  */
+__weak bool FLR_IsPending(const FLR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  return ((MC_NULL == pHandle) ? false : (FLR_FROZEN == pHandle->State));
+#else
+  return (FLR_FROZEN == pHandle->State);
+#endif
+}
+
+/**
+  * @brief  Executes a fault recorder command received by the MCP.
+  * @param  pHandle: handler of the current instance of the Fault Recorder component.
+  * @param  rxLength: length of the received payload.
+  * @param  rxBuffer: received payload, the command (FLR_CMD_xxx) followed by its data.
+  * @param  txSyncFreeSpace: space available in the answer buffer.
+  * @param  txLength: set to the length of the answer.
+  * @param  txBuffer: answer, the sequence number of the newest record (4 bytes), the number of
+  *         chunks of a record, then the chunk read.
+  * @retval uint8_t MCP error code.
+  *
+  * - FLR_CMD_READ: the age of the record (2 bytes, 0 for the newest) and the chunk index follow the
+  *   command. A record is a #FLR_Record_t, read in chunks of #FLR_CHUNK_SIZE bytes. MCP_CMD_NOK is
+  *   returned for a record overwritten or not yet written.
+  * - FLR_CMD_ERASE: the log is erased by the background task, in IDLE.
+  */
+__weak uint8_t FLR_CMD(FLR_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace,
+                       uint16_t *txLength, uint8_t *txBuffer)
+{
+  uint8_t bResult = MCP_CMD_UNKNOWN;
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  if ((MC_NULL == pHandle) || (MC_NULL == rxBuffer) || (MC_NULL == txLength) || (MC_NULL == txBuffer))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((0U == rxLength) || (txSyncFreeSpace < (int16_t)(FLR_REPLY_HEADER_SIZE + FLR_CHUNK_SIZE)))
+    {
+      bResult = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else
+    {
+      uint32_t wSequence = pHandle->Records.wSequence;
+      uint16_t hLength = FLR_REPLY_HEADER_SIZE;
+
+      switch (rxBuffer[0])
+      {
+        case FLR_CMD_READ:
+        {
+          if (rxLength < 4U)
+          {
+            bResult = MCP_ERROR_BAD_RAW_FORMAT;
+          }
+          else
+          {
+            uint16_t hAge = (uint16_t)rxBuffer[1] | ((uint16_t)rxBuffer[2] << 8U);
+            uint16_t hOffset = (uint16_t)rxBuffer[3] * FLR_CHUNK_SIZE;
+            uint16_t hSize = ((sizeof(FLR_Record_t) - hOffset) < FLR_CHUNK_SIZE)
+                           ? (uint16_t)(sizeof(FLR_Record_t) - hOffset) : (uint16_t)FLR_CHUNK_SIZE;
+
+            if ((rxBuffer[3] < FLR_CHUNK_NBR)
+             && (true == FREC_Read(&pHandle->Records, hAge, hOffset, &txBuffer[FLR_REPLY_HEADER_SIZE], hSize)))
+            {
+              hLength += hSize;
+              bResult = MCP_CMD_OK;
+            }
+            else
+            {
+              bResult = MCP_CMD_NOK;
+            }
+          }
+          break;
+        }
+
+        case FLR_CMD_ERASE:
+        {
+          if (IDLE == MCI_GetSTMState(pHandle->pMCI))
+          {
+            pHandle->bEraseRequest = true;
+            bResult = MCP_CMD_OK;
+          }
+          else
+          {
+            bResult = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+        default:
+          /* Nothing to do */
+          break;
+      }
+
+      txBuffer[0] = (uint8_t)wSequence;
+      txBuffer[1] = (uint8_t)(wSequence >> 8U);
+      txBuffer[2] = (uint8_t)(wSequence >> 16U);
+      txBuffer[3] = (uint8_t)(wSequence >> 24U);
+      txBuffer[4] = (uint8_t)FLR_CHUNK_NBR;
+      *txLength = hLength;
+    }
+#ifdef NULL_PTR_CHECK_FAULT_REC
+  }
+#endif
+  return (bResult);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,412 @@
+
+/**
+  ******************************************************************************
+  * @file    flash_records.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Flash Records component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup FlashRecords
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "flash_records.h"
+#include "mc_flash.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup FlashRecords Flash Records
+  * @brief Versioned, CRC protected records appended to a ring of flash pages
+  *
+  * Each page holds fixed size slots written in order. A record is appended in the slot following
+  * the newest one, a page being erased when the ring enters it: the oldest records are lost while
+  * the newest ones stay readable, and the erase cycles are spread over all the pages.
+  *
+  * The payload is programmed before the header, a record interrupted by a reset is then ignored and
+  * its slot skipped. Records of another layout version, or with a wrong CRC, are ignored.
+  *
+  * The flash controller is shared by all the records: FREC_Append and FREC_Erase are only called from
+  * the main loop, by the background tasks of their users, so that two programs never interleave.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Bytes read at once to compute the CRC of a record */
+#define FREC_READ_CHUNK             32U
+
+/* Reflected polynomial of the CRC-32 */
+#define FREC_CRC_POLY               0xEDB88320U
+
+/**
+  * @brief  Returns the slot following a slot, the first slot of the next page when the page is full.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @param  wAddress: slot address.
+  */
+static uint32_t FREC_NextSlot(const FREC_Handle_t *pHandle, uint32_t wAddress)
+{
+  const FREC_Params_t *pParams = pHandle->pParams;
+  uint32_t wPageOffset = (wAddress - pParams->wBaseAddress) % pParams->wPageSize;
+  uint32_t wPage = (wAddress - pParams->wBaseAddress) / pParams->wPageSize;
+  uint32_t wNext = wAddress + pParams->hSlotSize;
+
+  if ((wPageOffset + (2U * (uint32_t)pParams->hSlotSize)) > pParams->wPageSize)
+  {
+    wPage = (wPage + 1U) % pParams->bPageNbr;
+    wNext = pParams->wBaseAddress + (wPage * pParams->wPageSize);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (wNext);
+}
+
+/**
+  * @brief  Checks a slot holds a valid record.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @param  wAddress: slot address.
+  * @param  pHeader: header read from the slot.
+  * @retval bool true if the magic, version, size and CRC are correct.
+  */
+static bool FREC_IsValid(const FREC_Handle_t *pHandle, uint32_t wAddress, FREC_Header_t *pHeader)
+{
+  bool bValid = false;
+
+  MCFLASH_Read(wAddress, pHeader, sizeof(FREC_Header_t));
+  if ((FREC_MAGIC == pHeader->wMagic) && (pHandle->pParams->hVersion == pHeader->hVersion)
+   && (((uint32_t)pHeader->hSize + sizeof(FREC_Header_t)) <= pHandle->pParams->hSlotSize))
+  {
+    uint8_t Chunk[FREC_READ_CHUNK];
+    uint32_t wCRC = FREC_CalcCRC(0U, &pHeader->hVersion, sizeof(FREC_Header_t) - (2U * sizeof(uint32_t)));
+    uint32_t wOffset;
+
+    for (wOffset = 0U; wOffset < pHeader->hSize; wOffset += FREC_READ_CHUNK)
+    {
+      uint32_t wChunk = ((pHeader->hSize - wOffset) < FREC_READ_CHUNK) ? (pHeader->hSize - wOffset) : FREC_READ_CHUNK;
+
+      MCFLASH_Read(wAddress + sizeof(FREC_Header_t) + wOffset, Chunk, wChunk);
+      wCRC = FREC_CalcCRC(wCRC, Chunk, wChunk);
+    }
+    bValid = (wCRC == pHeader->wCRC);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bValid);
+}
+
+/**
+  * @brief  Finds the newest valid record and the slot of the next one.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  *
+  * - Every slot is checked, the flash being read directly this takes well below 1 ms.
+  */
+__weak void FREC_Init(FREC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const FREC_Params_t *pParams = pHandle->pParams;
+    uint32_t wSlotsPerPage = pParams->wPageSize / pParams->hSlotSize;
+    uint32_t wPage;
+    uint32_t wSlot;
+
+    pHandle->wLastAddress = 0U;
+    pHandle->wSequence = 0U;
+    pHandle->wNextAddress = pParams->wBaseAddress;
+    for (wPage = 0U; wPage < pParams->bPageNbr; wPage++)
+    {
+      for (wSlot = 0U; wSlot < wSlotsPerPage; wSlot++)
+      {
+        FREC_Header_t Header;
+        uint32_t wAddress = pParams->wBaseAddress + (wPage * pParams->wPageSize) + (wSlot * pParams->hSlotSize);
+
+        if ((true == FREC_IsValid(pHandle, wAddress, &Header))
+         && ((0U == pHandle->wLastAddress) || (Header.wSequence > pHandle->wSequence)))
+        {
+          pHandle->wLastAddress = wAddress;
+          pHandle->wSequence = Header.wSequence;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+
+    if (pHandle->wLastAddress != 0U)
+    {
+      pHandle->wNextAddress = FREC_NextSlot(pHandle, pHandle->wLastAddress);
+    }
+    else
+    {
+      /* Nothing to do, the ring starts over on the first page */
+    }
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  }
+#endif
+}
+
+/**
+  * @brief  Reads the payload of the newest record.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @param  pPayload: destination of the payload.
+  * @param  hSize: payload bytes expected.
+  * @retval bool false if there is no valid record of this size, the destination being then unchanged.
+  */
+__weak bool FREC_ReadLast(FREC_Handle_t *pHandle, void *pPayload, uint16_t hSize)
+{
+  bool bRead = false;
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  if ((MC_NULL == pHandle) || (MC_NULL == pPayload))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    FREC_Header_t Header;
+
+    if ((pHandle->wLastAddress != 0U) && (true == FREC_IsValid(pHandle, pHandle->wLastAddress, &Header))
+     && (hSize == Header.hSize))
+    {
+      MCFLASH_Read(pHandle->wLastAddress + sizeof(FREC_Header_t), pPayload, hSize);
+      bRead = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  }
+#endif
+  return (bRead);
+}
+
+/**
+  * @brief  Reads part of the payload of a record.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @param  wAge: 0 for the newest record, 1 for the one before...
+  * @param  hOffset: first payload byte to read.
+  * @param  pData: destination.
+  * @param  hSize: bytes to read, the read stopping at the end of the payload.
+  * @retval bool false if this record was overwritten or is not valid.
+  *
+  * - The record is checked as a whole, a part can be read without a buffer of the record size.
+  */
+__weak bool FREC_Read(FREC_Handle_t *pHandle, uint32_t wAge, uint16_t hOffset, void *pData, uint16_t hSize)
+{
+  bool bRead = false;
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const FREC_Params_t *pParams = pHandle->pParams;
+    uint32_t wSlotsPerPage = pParams->wPageSize / pParams->hSlotSize;
+    uint32_t wSlots = wSlotsPerPage * pParams->bPageNbr;
+    uint32_t i;
+
+    for (i = 0U; (i < wSlots) && (pHandle->wLastAddress != 0U) && (wAge < pHandle->wSequence) && (false == bRead); i++)
+    {
+      FREC_Header_t Header;
+      uint32_t wAddress = pParams->wBaseAddress + ((i / wSlotsPerPage) * pParams->wPageSize)
+                        + ((i % wSlotsPerPage) * pParams->hSlotSize);
+
+      if ((true == FREC_IsValid(pHandle, wAddress, &Header)) && ((pHandle->wSequence - wAge) == Header.wSequence)
+       && (hOffset < Header.hSize))
+      {
+        uint16_t hRead = ((Header.hSize - hOffset) < hSize) ? (Header.hSize - hOffset) : hSize;
+
+        MCFLASH_Read(wAddress + sizeof(FREC_Header_t) + hOffset, pData, hRead);
+        bRead = true;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  }
+#endif
+  return (bRead);
+}
+
+/**
+  * @brief  Appends a record after the newest one.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @param  pPayload: payload to record.
+  * @param  hSize: payload bytes.
+  * @retval bool true if the record is programmed and read back valid.
+  *
+  * - A page is erased when the ring enters it. Slots left dirty by an interrupted write are skipped.
+  * - At most one page erase and one slot program: a failure is reported, the next call using
+  *   the next slot.
+  */
+__weak bool FREC_Append(FREC_Handle_t *pHandle, const void *pPayload, uint16_t hSize)
+{
+  bool bAppended = false;
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  if ((MC_NULL == pHandle) || (MC_NULL == pPayload))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const FREC_Params_t *pParams = pHandle->pParams;
+
+    if (((uint32_t)hSize + sizeof(FREC_Header_t)) <= pParams->hSlotSize)
+    {
+      uint32_t wAddress = pHandle->wNextAddress;
+      bool bFree = true;
+
+      while ((((wAddress - pParams->wBaseAddress) % pParams->wPageSize) != 0U)
+          && (false == MCFLASH_IsErased(wAddress, pParams->hSlotSize)))
+      {
+        wAddress = FREC_NextSlot(pHandle, wAddress);
+      }
+
+      if (0U == ((wAddress - pParams->wBaseAddress) % pParams->wPageSize))
+      {
+        bFree = MCFLASH_ErasePage(wAddress);
+      }
+      else
+      {
+        /* Nothing to do, the slot is erased */
+      }
+
+      if (true == bFree)
+      {
+        FREC_Header_t Header;
+        FREC_Header_t Check;
+
+        Header.wMagic = FREC_MAGIC;
+        Header.hVersion = pParams->hVersion;
+        Header.hSize = hSize;
+        Header.wSequence = pHandle->wSequence + 1U;
+        Header.wCRC = FREC_CalcCRC(FREC_CalcCRC(0U, &Header.hVersion, sizeof(FREC_Header_t) - (2U * sizeof(uint32_t))),
+                                   pPayload, hSize);
+
+        bAppended = MCFLASH_Program(wAddress + sizeof(FREC_Header_t), pPayload, hSize)
+                 && MCFLASH_Program(wAddress, &Header, sizeof(FREC_Header_t))
+                 && FREC_IsValid(pHandle, wAddress, &Check);
+        if (true == bAppended)
+        {
+          pHandle->wLastAddress = wAddress;
+          pHandle->wSequence = Header.wSequence;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->wNextAddress = FREC_NextSlot(pHandle, wAddress);
+    }
+    else
+    {
+      /* Nothing to do, the payload does not fit in a slot */
+    }
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  }
+#endif
+  return (bAppended);
+}
+
+/**
+  * @brief  Erases all the pages of the records.
+  * @param  pHandle: handler of the current instance of the Flash Records component.
+  * @retval bool true if all the pages are erased.
+  *
+  * - Takes one page erase per page, about 20 ms each.
+  */
+__weak bool FREC_Erase(FREC_Handle_t *pHandle)
+{
+  bool bErased = false;
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const FREC_Params_t *pParams = pHandle->pParams;
+    uint8_t i;
+
+    bErased = true;
+    for (i = 0U; i < pParams->bPageNbr; i++)
+    {
+      bErased = MCFLASH_ErasePage(pParams->wBaseAddress + ((uint32_t)i * pParams->wPageSize)) && bErased;
+    }
+    pHandle->wLastAddress = 0U;
+    pHandle->wNextAddress = pParams->wBaseAddress;
+#ifdef NULL_PTR_CHECK_FLASH_REC
+  }
+#endif
+  return (bErased);
+}
+
+/**
+  * @brief  Computes the CRC-32 of a buffer (IEEE 802.3, reflected), possibly in several calls.
+  * @param  wCRC: CRC of the previous bytes, 0 for the first call.
+  * @param  pData: buffer.
+  * @param  wSize: bytes.
+  * @retval uint32_t CRC of the previous bytes and the buffer.
+  */
+__weak uint32_t FREC_CalcCRC(uint32_t wCRC, const void *pData, uint32_t wSize)
+{
+  const uint8_t *pBytes = (const uint8_t *)pData;
+  uint32_t wResult = ~wCRC;
+  uint32_t i;
+  uint8_t j;
+
+  for (i = 0U; i < wSize; i++)
+  {
+    wResult ^= pBytes[i];
+    for (j = 0U; j < 8U; j++)
+    {
+      wResult = ((wResult & 1U) != 0U) ? ((wResult >> 1U) ^ FREC_CRC_POLY) : (wResult >> 1U);
+    }
+  }
+  return (~wResult);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
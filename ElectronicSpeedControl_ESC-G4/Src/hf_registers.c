@@ -76,9 +76,11 @@ __weak uint8_t HF_GetPtrReg(uint16_t dataID, void **dataPtr)
   {
 #endif
 
-    MCI_Handle_t *pMCIN = &Mci[0];
+    /* Motor field of the ID, 1 for motor 1. A register of a motor out of the drive is unknown */
+    uint8_t motorID = (uint8_t)EXTRACT_MOTORID(dataID);
     uint16_t regID = dataID & REG_MASK;
-    uint8_t typeID = ((uint8_t)dataID) & TYPE_MASK;
+    uint8_t typeID = (motorID < (uint8_t)NBR_OF_MOTORS) ? (((uint8_t)dataID) & TYPE_MASK) : TYPE_DATA_SEG_END;
+    MCI_Handle_t *pMCIN = &Mci[(motorID < (uint8_t)NBR_OF_MOTORS) ? motorID : M1];
 
     switch (typeID)
     {
@@ -135,7 +137,7 @@ __weak uint8_t HF_GetPtrReg(uint16_t dataID, void **dataPtr)
           }
           case MC_REG_OPENLOOP_EL_ANGLE:
           {
-            *dataPtr = &((&VirtualSpeedSensorM1)->_Super.hElAngle);
+            *dataPtr = &(pVSS[motorID]->_Super.hElAngle);
             break;
           }
 
@@ -165,13 +167,13 @@ __weak uint8_t HF_GetPtrReg(uint16_t dataID, void **dataPtr)
 
           case MC_REG_STOPLL_ROT_SPEED:
           {
-            *dataPtr = &((&STO_PLL_M1)->_Super.hAvrMecSpeedUnit);
+            *dataPtr = &(pSTO_PLL[motorID]->_Super.hAvrMecSpeedUnit);
             break;
           }
 
           case MC_REG_STOPLL_EL_ANGLE:
           {
-            *dataPtr = &((&STO_PLL_M1)->_Super.hElAngle);
+            *dataPtr = &(pSTO_PLL[motorID]->_Super.hElAngle);
             break;
           }
 
@@ -183,16 +185,52 @@ __weak uint8_t HF_GetPtrReg(uint16_t dataID, void **dataPtr)
 
           case MC_REG_STOPLL_BEMF_ALPHA:
           {
-            *dataPtr = &((&STO_PLL_M1)->hBemf_alfa_est);
+            *dataPtr = &(pSTO_PLL[motorID]->hBemf_alfa_est);
             break;
           }
 
           case MC_REG_STOPLL_BEMF_BETA:
           {
-            *dataPtr = &((&STO_PLL_M1)->hBemf_beta_est);
+            *dataPtr = &(pSTO_PLL[motorID]->hBemf_beta_est);
             break;
           }
 
+#if (VIB_MONITOR_ENABLE == 1)
+          /* Results of the vibration monitor, motor 1 only, updated at the end of each window */
+          case MC_REG_VIB_SPEED:
+          {
+            *dataPtr = &(VibMonitorM1.hMecSpeedUnit);
+            break;
+          }
+
+          case MC_REG_VIB_HARMONIC_1:
+          case MC_REG_VIB_HARMONIC_2:
+          case MC_REG_VIB_HARMONIC_N:
+          {
+            *dataPtr = &(VibMonitorM1.hHarmonic[(regID - MC_REG_VIB_HARMONIC_1) >> ELT_IDENTIFIER_POS]);
+            break;
+          }
+
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+          /* Low passed score of the anomaly detector, motor 1 only, updated at each inference */
+          case MC_REG_ANOMALY_SCORE:
+          {
+            *dataPtr = &(AnomalyDetectorM1.hScore);
+            break;
+          }
+
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+          /* Load torque estimated, Iq digit, motor 1 only, updated by the speed regulator */
+          case MC_REG_LOAD_TORQUE:
+          {
+            *dataPtr = &(LoadObserverM1.hLoad);
+            break;
+          }
+
+#endif
+
           default:
           {
             *dataPtr = &nullData16;
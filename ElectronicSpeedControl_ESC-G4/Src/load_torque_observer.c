@@ -0,0 +1,187 @@
+
+/**
+  ******************************************************************************
+  * @file    load_torque_observer.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Load Torque Observer component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup LoadTorqueObserver
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "load_torque_observer.h"
+#include "arm_math.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup LoadTorqueObserver Load Torque Observer
+  * @brief Estimation of the load torque from the measured Iq and speed, fed forward to the speed regulator
+  *
+  * The rotor and its propeller are modelled by their inertia and a viscous friction. Once per period of
+  * the speed regulator, the model is driven by the measured Iq minus the estimated load, and both its
+  * speed and the load are corrected by the error between the measured and the modelled speed:
+  *
+  *     speed += fAccelPerDigit.(Iq - load) - fDamping.speed + fGainSpeed.error
+  *     load  -= fGainLoad.error
+  *
+  * The gains place both poles of the estimation error at the bandwidth fBandwidth_Hz, which shall stay
+  * below the bandwidth of the speed sensor. Torques are expressed as the Iq balancing them, in digit.
+  *
+  * With the feed-forward enabled, the speed regulator adds the load and the modelled friction to the
+  * output of its PI: a step of the load is compensated within the settling time of the observer, instead
+  * of the one of the integral term, which is left with the errors of the model only.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Initializes the Load Torque Observer component.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  */
+__weak void LTO_Init(LTO_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_LTO
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float_t fPole = expf((-2.0f * PI * pHandle->fBandwidth_Hz) / pHandle->fSamplingFreq_Hz);
+
+    /* Characteristic polynomial of the error, z^2 - (2 - fDamping - fGainSpeed).z
+       + (1 - fDamping - fGainSpeed + fAccelPerDigit.fGainLoad), set to (z - fPole)^2 */
+    pHandle->fGainSpeed = 2.0f - (2.0f * fPole) - pHandle->fDamping;
+    pHandle->fGainLoad = ((1.0f - fPole) * (1.0f - fPole)) / pHandle->fAccelPerDigit;
+    LTO_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_LTO
+  }
+#endif
+}
+
+/**
+  * @brief  Restarts the observer from the next period, to be called when the drive stops.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  */
+__weak void LTO_Clear(LTO_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_LTO
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bPrimed = false;
+    pHandle->fSpeed = 0.0f;
+    pHandle->fLoad = 0.0f;
+    pHandle->hLoad = 0;
+#ifdef NULL_PTR_CHECK_LTO
+  }
+#endif
+}
+
+/**
+  * @brief  Updates the estimates and returns the feed-forward, to be called once per speed regulator period.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  * @param  hMecSpeedUnit: measured speed, #SPEED_UNIT.
+  * @retval Load and friction torques estimated, Iq digit, 0 when the feed-forward is disabled.
+  */
+__weak int16_t LTO_Update(LTO_Handle_t *pHandle, int16_t hMecSpeedUnit)
+{
+  int16_t hFeedForward = 0;
+#ifdef NULL_PTR_CHECK_LTO
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float_t fIq = (float_t)pHandle->pIqd->q;
+    float_t fMeasured = (float_t)hMecSpeedUnit;
+    float_t fFriction;
+    float_t fLoadMax = (float_t)pHandle->hLoadMax;
+
+    if (false == pHandle->bPrimed)
+    {
+      /* Starts from the steady state of the drive */
+      pHandle->fSpeed = fMeasured;
+      pHandle->fLoad = fIq - ((pHandle->fDamping * fMeasured) / pHandle->fAccelPerDigit);
+      pHandle->bPrimed = true;
+    }
+    else
+    {
+      float_t fError = fMeasured - pHandle->fSpeed;
+
+      pHandle->fSpeed += (pHandle->fAccelPerDigit * (fIq - pHandle->fLoad)) - (pHandle->fDamping * pHandle->fSpeed)
+                       + (pHandle->fGainSpeed * fError);
+      pHandle->fLoad -= pHandle->fGainLoad * fError;
+    }
+    pHandle->fLoad = (pHandle->fLoad > fLoadMax) ? fLoadMax
+                   : ((pHandle->fLoad < -fLoadMax) ? -fLoadMax : pHandle->fLoad);
+    pHandle->hLoad = (int16_t)pHandle->fLoad;
+
+    if (true == pHandle->bFeedForward)
+    {
+      fFriction = (pHandle->fDamping * pHandle->fSpeed) / pHandle->fAccelPerDigit;
+      fFriction = (fFriction > fLoadMax) ? fLoadMax : ((fFriction < -fLoadMax) ? -fLoadMax : fFriction);
+      hFeedForward = (int16_t)(pHandle->fLoad + fFriction);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_LTO
+  }
+#endif
+  return (hFeedForward);
+}
+
+/**
+  * @brief  Enables or disables the feed-forward of the load to the speed regulator.
+  * @param  pHandle: handler of the current instance of the Load Torque Observer component.
+  * @param  bEnable: true to add the load to the output of the speed regulator.
+  */
+__weak void LTO_SetFeedForward(LTO_Handle_t *pHandle, bool bEnable)
+{
+#ifdef NULL_PTR_CHECK_LTO
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bFeedForward = bEnable;
+#ifdef NULL_PTR_CHECK_LTO
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
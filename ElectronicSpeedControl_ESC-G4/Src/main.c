@@ -21,6 +21,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "mc_tasks.h"
 
 /* USER CODE END Includes */
 
@@ -138,10 +139,13 @@ int main(void)
   /* Initialize interrupts */
   MX_NVIC_Init();
   /* USER CODE BEGIN 2 */
-
-  /* USER CODE END 2 */
+#if (THR_INPUT_ENABLE == 0)
   MC_StartMotor1();
   MC_ProgramSpeedRampMotor1(2000,1000);
+#endif
+
+  /* USER CODE END 2 */
+
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1)
@@ -149,6 +153,7 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+    MC_RunBackgroundTasks();
   }
   /* USER CODE END 3 */
 }
@@ -875,6 +880,27 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(Start_Stop_GPIO_Port, &GPIO_InitStruct);
 
   /* USER CODE BEGIN MX_GPIO_Init_2 */
+#if (THR_INPUT_ENABLE == 1)
+  /* Throttle input: TIM2_CH1 on PA15 */
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  GPIO_InitStruct.Pin = GPIO_PIN_15;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+#if (THR_DSHOT_TELEMETRY_ENABLE == 1)
+  /* Bidirectional DShot idle high, replied through TIM4 and DMA1 channel 5, below the ADC interrupt */
+  __HAL_RCC_TIM4_CLK_ENABLE();
+  HAL_NVIC_SetPriority(TIM4_IRQn, 3, 0);
+  HAL_NVIC_EnableIRQ(TIM4_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Channel5_IRQn, 3, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel5_IRQn);
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+#else
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+#endif
+  GPIO_InitStruct.Alternate = GPIO_AF1_TIM2;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+#endif
 
   /* USER CODE END MX_GPIO_Init_2 */
 }
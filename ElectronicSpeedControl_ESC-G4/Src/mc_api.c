@@ -716,11 +716,41 @@ __weak float_t MC_GetAveragePowerMotor1_F(void)
 }
 
 /**
- * @brief Not implemented MC_Profiler function.
- *  */ //cstat !MISRAC2012-Rule-2.7 !RED-unused-param  !MISRAC2012-Rule-2.7  !MISRAC2012-Rule-8.13
+ * @brief Executes a command of the motor profiler, the self commissioning of Motor 1.
+ *
+ *  The first byte of @p rxBuffer is the command, CMD_SC_START or CMD_SC_STOP. The answer is the state of the
+ * self commissioning and the state of the speed regulator tuning. The command is unknown when
+ * SELF_COMMISSIONING_ENABLE is 0.
+ */
 __weak uint8_t MC_ProfilerCommand(uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer)
 {
+#if (SELF_COMMISSIONING_ENABLE == 1)
+  return (SCC_CMD(&SCC_M1, rxLength, rxBuffer, txSyncFreeSpace, txLength, txBuffer));
+#else
   return (MCP_CMD_UNKNOWN);
+#endif
+}
+
+/**
+ * @brief Executes a command of the parameter store of Motor 1.
+ *
+ *  The first byte of @p rxBuffer is the command, PST_CMD_READ, PST_CMD_WRITE, PST_CMD_CAPTURE or PST_CMD_COMMIT.
+ * The answer is the layout version of the parameter block followed by the block.
+ */
+__weak uint8_t MC_ParamStoreCommand(uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer)
+{
+  return (PST_CMD(&ParamStoreM1, rxLength, rxBuffer, txSyncFreeSpace, txLength, txBuffer));
+}
+
+/**
+ * @brief Executes a command of the fault recorder of Motor 1.
+ *
+ *  The first byte of @p rxBuffer is the command, FLR_CMD_READ or FLR_CMD_ERASE. The answer is the sequence
+ * number of the newest fault record and the number of chunks of a record, followed by the chunk read.
+ */
+__weak uint8_t MC_FaultLogCommand(uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength, uint8_t *txBuffer)
+{
+  return (FLR_CMD(&FaultRecorderM1, rxLength, rxBuffer, txSyncFreeSpace, txLength, txBuffer));
 }
 
 /**
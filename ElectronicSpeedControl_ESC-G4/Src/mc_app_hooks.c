@@ -77,6 +77,27 @@ __weak void MC_APP_PostMediumFrequencyHook_M1(void)
 /* USER SECTION END PostMediumFrequencyHookM1 */
 }
 
+#if (NBR_OF_MOTORS > 1)
+/**
+ * @brief Hook function called right after the Medium Frequency Task for Motor 2.
+ *
+ *
+ *
+ */
+__weak void MC_APP_PostMediumFrequencyHook_M2(void)
+{
+  /*
+   * This function can be overloaded or the application can inject
+   * code into it that will be executed right after the Medium
+   * Frequency Task of Motor 2
+   */
+
+/* USER SECTION BEGIN PostMediumFrequencyHookM2 */
+
+/* USER SECTION END PostMediumFrequencyHookM2 */
+}
+#endif
+
 /** @} */
 
 /** @} */
@@ -25,6 +25,7 @@
 #include "mc_parameters.h"
 #include "mc_config.h"
 #include "pqd_motor_power_measurement.h"
+#include "mc_flash.h"
 
 /* USER CODE BEGIN Additional include */
 
@@ -118,6 +119,16 @@ SpeednTorqCtrl_Handle_t SpeednTorqCtrlM1 =
   .MecSpeedRefUnitDefault     = (int16_t)(DEFAULT_TARGET_SPEED_UNIT),
   .TorqueRefDefault           = (int16_t)DEFAULT_TORQUE_COMPONENT,
   .IdrefDefault               = (int16_t)DEFAULT_FLUX_COMPONENT,
+#if (SPD_FILTER_ENABLE == 1)
+  .SpeedFilter                = &SpeedFilterM1,
+#else
+  .SpeedFilter                = MC_NULL,
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+  .LoadObserver               = &LoadObserverM1,
+#else
+  .LoadObserver               = MC_NULL,
+#endif
 };
 
 RevUpCtrl_Handle_t RevUpControlM1 =
@@ -127,7 +138,10 @@ RevUpCtrl_Handle_t RevUpControlM1 =
   .bFirstAccelerationStage = (ENABLE_SL_ALGO_FROM_PHASE-1u),
   .hMinStartUpValidSpeed   = OBS_MINIMUM_SPEED_UNIT,
   .hMinStartUpFlySpeed     = (int16_t)(OBS_MINIMUM_SPEED_UNIT/2),
-  .OTFStartupEnabled       = false,
+  .OTFStartupEnabled       = true,
+  .hOTFSection1Duration    = OTF_DETECTION_DURATION,
+  .AdaptiveEnabled         = true,
+  .hAdaptMinDurationms     = ADAPTIVE_REVUP_MIN_DURATION,
 
   .OTFPhaseParams =
   {
@@ -211,6 +225,34 @@ PWMC_R3_2_Handle_t PWM_Handle_M1 =
 /**
   * @brief  SpeedNPosition sensor parameters Motor 1 - State Observer + PLL.
   */
+/**
+  * @brief  Speed-indexed STO observer and PLL gains Motor 1.
+  */
+const STO_PLL_GainSchedPoint_t STO_PLL_GainSchedM1[STO_GAIN_SCHED_SIZE] =
+{
+  {
+    .hMecSpeedUnit = STO_GS_SPEED1_UNIT,
+    .hC2           = C2,
+    .hC4           = C4,
+    .hPLLKpGain    = PLL_KP_GAIN,
+    .hPLLKiGain    = PLL_KI_GAIN,
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED2_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED2_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED2_RPM),
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED3_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED3_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED3_RPM),
+  },
+};
+
 STO_PLL_Handle_t STO_PLL_M1 =
 {
   ._Super =
@@ -263,7 +305,118 @@ STO_PLL_Handle_t STO_PLL_M1 =
   .F1LOG                       = F1_LOG,
   .F2LOG                       = F2_LOG,
   .SpeedBufferSizeDppLOG       = STO_FIFO_DEPTH_DPP_LOG,
-  .hForcedDirection            = 0x0000U
+  .hForcedDirection            = 0x0000U,
+  .pGainSched                  = STO_PLL_GainSchedM1,
+  .bGainSchedSize              = STO_GAIN_SCHED_SIZE,
+  .hC1Rated                    = C1
+};
+
+/* Private data of the pulse injection component, word aligned for its float and fixp30 members */
+__ALIGNED(4) POLPULSE_Obj PolPulseM1;
+
+const POLPULSE_Params PolPulseParamsM1 =
+{
+  .VoltageScale       = (float_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+  .Ts                 = (float_t)(1.0 / ISR_FREQUENCY_HZ),
+  .Lsd                = (float_t)LS,
+  .PulseCurrentGoal_A = (float_t)POLPULSE_CURRENT_A,
+  .MinContrast        = (float_t)POLPULSE_MIN_CONTRAST,
+  .N                  = POLPULSE_PULSE_PERIODS,
+  .Nd                 = POLPULSE_DECAY_PERIODS,
+  .N_Angles           = POLPULSE_NUM_ANGLES,
+};
+
+HFI_Handle_t HFI_M1 =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .SpeedUnit                 = SPEED_UNIT,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = 0U,
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .pHighSpeedSensor            = MAIN_SPEED_SENSOR_M1,
+
+  .PIRegulator =
+  {
+    .hDefKpGain                = HFI_PLL_KP_GAIN,
+    .hDefKiGain                = HFI_PLL_KI_GAIN,
+    .hDefKdGain                = 0x0000U,
+    .hKpDivisor                = HFI_PLL_KPDIV,
+    .hKiDivisor                = HFI_PLL_KIDIV,
+    .hKdDivisor                = 0x0000U,
+    .wUpperIntegralLimit       = INT32_MAX,
+    .wLowerIntegralLimit       = -INT32_MAX,
+    .hUpperOutputLimit         = INT16_MAX,
+    .hLowerOutputLimit         = -INT16_MAX,
+    .hKpDivisorPOW2            = HFI_PLL_KPDIV_LOG,
+    .hKiDivisorPOW2            = HFI_PLL_KIDIV_LOG,
+    .hKdDivisorPOW2            = 0x0000U,
+  },
+
+  .hInjVoltage                 = HFI_INJECTION_VOLTAGE,
+  .bInjHalfPeriod              = HFI_INJECTION_HALF_PERIOD,
+  .hCrossoverLowUnit           = HFI_CROSSOVER_LOW_UNIT,
+  .hCrossoverHighUnit          = HFI_CROSSOVER_HIGH_UNIT,
+};
+
+/* Private data of the flux observer, word aligned for its float and fixp30 members */
+__ALIGNED(4) HSO_Obj HSO_ObjM1;
+
+const HSO_Params HSO_ParamsM1 =
+{
+  .Flux_Wb              = (float_t)HSO_FLUX_WB,
+  .CrossOver_Hz         = (float_t)HSO_CROSSOVER_HZ,
+  .isrTime_s            = (float_t)(1.0 / ISR_FREQUENCY_HZ),
+  .FullScaleVoltage_V   = (float_t)FULL_SCALE_VOLTAGE_V,
+  .FullScaleFreq_Hz     = (float_t)FULL_SCALE_FREQ_HZ,
+  .speedPole_rps        = (float_t)(2.0 * 3.1416 * HSO_SPEED_POLE_HZ),
+  .flag_FilterAdaptive  = true,
+  .Filter_adapt_fmin_Hz = (float_t)HSO_CROSSOVER_MIN_HZ,
+  .Filter_adapt_fmax_Hz = (float_t)HSO_CROSSOVER_MAX_HZ,
+  .CheckDirBW_Hz        = (float_t)HSO_CHECKDIR_BW_HZ,
+};
+
+HSO_SPD_Handle_t HSO_M1 =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .SpeedUnit                 = SPEED_UNIT,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .pHSO                        = &HSO_ObjM1,
+  .pParams                     = &HSO_ParamsM1,
+  .Rs                          = (float_t)RS,
+  .Ls                          = (float_t)LS,
+  .FullScaleCurrent_A          = (float_t)M1_MAX_READABLE_CURRENT,
+};
+
+/* Private data of the resistance estimation, aligned for its 64 bit accumulators */
+__ALIGNED(8) RSTEMP_Obj RSTempM1;
+
+const RSTEMP_Params RSTempParamsM1 =
+{
+  .FullScaleCurrent_A   = (float_t)M1_MAX_READABLE_CURRENT,
+  .FullScaleVoltage_V   = (float_t)FULL_SCALE_VOLTAGE_V,
+  .FullScaleFreq_Hz     = (float_t)FULL_SCALE_FREQ_HZ,
+  .RatedCelcius         = (float_t)RS_EST_RATED_CELSIUS,
+  .RsRatedOhm           = (float_t)RS,
+  .LsHenry              = (float_t)LS,
+  .MotorMaxCurrent_A    = (float_t)NOMINAL_CURRENT_A,
+  .F_background_Hz      = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .F_interrupt_Hz       = (float_t)ISR_FREQUENCY_HZ,
 };
 
 STO_Handle_t STO_M1 =
@@ -299,6 +452,9 @@ NTC_Handle_t *pTemperatureSensor[NBR_OF_MOTORS] = {&TempSensor_M1};
 PID_Handle_t *pPIDIq[NBR_OF_MOTORS]             = {&PIDIqHandle_M1};
 PID_Handle_t *pPIDId[NBR_OF_MOTORS]             = {&PIDIdHandle_M1};
 PQD_MotorPowMeas_Handle_t *pMPM[NBR_OF_MOTORS]  = {&PQD_MotorPowMeasM1};
+PID_Handle_t *pPIDSpeed[NBR_OF_MOTORS]          = {&PIDSpeedHandle_M1};
+STO_PLL_Handle_t *pSTO_PLL[NBR_OF_MOTORS]       = {&STO_PLL_M1};
+RevUpCtrl_Handle_t *pRevUpCtrl[NBR_OF_MOTORS]   = {&RevUpControlM1};
 
 MCI_Handle_t Mci[NBR_OF_MOTORS] =
 {
@@ -320,6 +476,308 @@ MCI_Handle_t Mci[NBR_OF_MOTORS] =
 
 };
 
+/**
+  * @brief  Self commissioning parameters Motor 1
+  */
+SCC_Params_t SCC_ParamsM1 =
+{
+  .rampExtMngrParams =
+  {
+    .FrequencyHz = MEDIUM_FREQUENCY_TASK_RATE
+  },
+  .fRshunt                 = (float)RSHUNT,
+  .fAmplificationGain      = (float)AMPLIFICATION_GAIN,
+  .fVbusConvFactor         = (float)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+  .fVbusPartitioningFactor = (float)VBUS_PARTITIONING_FACTOR,
+  .fRVNK                   = 1.0f,
+  .fRSMeasCurrLevelMax     = (float)SCC_RS_MEAS_CURRENT_A,
+  .hDutyRampDuration       = SCC_DUTY_RAMP_DURATION,
+  .hAlignmentDuration      = SCC_ALIGNMENT_DURATION,
+  .hRSDetectionDuration    = SCC_RS_DETECTION_DURATION,
+  .fLdLqRatio              = (float)SCC_LD_LQ_RATIO,
+  .fCurrentBW              = (float)SCC_CURRENT_BW_RPS,
+  .bPBCharacterization     = PB_CHARACTERIZATION_DISABLE,
+  .wNominalSpeed           = SCC_NOMINAL_SPEED_RPM,
+  .hPWMFreqHz              = PWM_FREQUENCY,
+  .bFOCRepRate             = REGULATION_EXECUTION_RATE,
+  .fMCUPowerSupply         = (float)ADC_REFERENCE_VOLTAGE,
+  .IThreshold              = (float)SCC_OVERCURRENT_A,
+  .fRSRated                = (float)RS,
+  .fLSRated                = (float)LS,
+  .fKeRated                = (float)MOTOR_VOLTAGE_CONSTANT,
+};
+
+SCC_Handle_t SCC_M1 =
+{
+  .pPWMC           = &PWM_Handle_M1._Super,
+  .pVBS            = &BusVoltageSensor_M1,
+  .pFOCVars        = &FOCVars[0],
+  .pMCI            = &Mci[M1],
+  .pVSS            = &VirtualSpeedSensorM1,
+  .pCLM            = &CircleLimitationM1,
+  .pPIDIq          = &PIDIqHandle_M1,
+  .pPIDId          = &PIDIdHandle_M1,
+  .pRevupCtrl      = &RevUpControlM1,
+  .pSTO            = &STO_PLL_M1,
+  .pSTC            = &SpeednTorqCtrlM1,
+  .pOTT            = &OTT_M1,
+  .pSCC_Params_str = &SCC_ParamsM1,
+};
+
+/**
+  * @brief  One touch tuning of the speed regulator parameters Motor 1
+  */
+const OTT_Params_t OTT_ParamsM1 =
+{
+  .rampExtMngrParams =
+  {
+    .FrequencyHz = MEDIUM_FREQUENCY_TASK_RATE
+  },
+  .fBWdef               = (float)OTT_SPEED_BW_RPS,
+  .fMeasWin             = (float)OTT_MEAS_WINDOW_S,
+  .bPolesPairs          = POLE_PAIR_NUM,
+  .hMaxPositiveTorque   = (uint16_t)IQMAX,
+  .fCurrtRegStabTimeSec = (float)OTT_CURR_REG_STAB_TIME_S,
+  .fOttLowSpeedPerc     = (float)OTT_LOW_SPEED_PERC,
+  .fOttHighSpeedPerc    = (float)OTT_HIGH_SPEED_PERC,
+  .fSpeedStabTimeSec    = (float)OTT_SPEED_STAB_TIME_S,
+  .fTimeOutSec          = (float)OTT_TIMEOUT_S,
+  .fSpeedMargin         = (float)OTT_SPEED_MARGIN,
+  .wNominalSpeed        = SCC_NOMINAL_SPEED_RPM,
+  .spdKp                = (float)PID_SPEED_KP_DEFAULT,
+  .spdKi                = (float)PID_SPEED_KI_DEFAULT,
+  .spdKs                = 0.0f,
+  .fRshunt              = (float)RSHUNT,
+  .fAmplificationGain   = (float)AMPLIFICATION_GAIN,
+};
+
+OTT_Handle_t OTT_M1 =
+{
+  .pSpeedSensor    = &STO_PLL_M1._Super,
+  .pFOCVars        = &FOCVars[0],
+  .pPIDSpeed       = &PIDSpeedHandle_M1,
+  .pSTC            = &SpeednTorqCtrlM1,
+  .pOTT_Params_str = &OTT_ParamsM1,
+};
+
+/**
+  * Parameter store of motor 1, in the pages reserved at the end of the flash
+  */
+const FREC_Params_t ParamStoreRecordsM1 =
+{
+  .wBaseAddress = MC_FLASH_PARAMS_ADDRESS,
+  .wPageSize    = MC_FLASH_PAGE_SIZE,
+  .hSlotSize    = PST_SLOT_SIZE,
+  .hVersion     = PST_VERSION,
+  .bPageNbr     = MC_FLASH_PARAMS_PAGES,
+};
+
+PST_Handle_t ParamStoreM1 =
+{
+  .Records          = {.pParams = &ParamStoreRecordsM1},
+  .pPIDIq           = &PIDIqHandle_M1,
+  .pPIDId           = &PIDIdHandle_M1,
+  .pPIDSpeed        = &PIDSpeedHandle_M1,
+  .pSTC             = &SpeednTorqCtrlM1,
+  .pRevupCtrl       = &RevUpControlM1,
+#if (SELF_COMMISSIONING_ENABLE == 1)
+  .pSCC             = &SCC_M1,
+#else
+  .pSCC             = MC_NULL,
+#endif
+  .pMCI             = &Mci[M1],
+  .hOffsetsMaxDrift = PST_OFFSETS_MAX_DRIFT_CELSIUS,
+};
+
+/**
+  * Fault recorder of motor 1, in the pages reserved in front of the parameter store
+  */
+const FREC_Params_t FaultRecorderRecordsM1 =
+{
+  .wBaseAddress = MC_FLASH_LOG_ADDRESS,
+  .wPageSize    = MC_FLASH_PAGE_SIZE,
+  .hSlotSize    = FLR_SLOT_SIZE,
+  .hVersion     = FLR_VERSION,
+  .bPageNbr     = MC_FLASH_LOG_PAGES,
+};
+
+FLR_Handle_t FaultRecorderM1 =
+{
+  .Records            = {.pParams = &FaultRecorderRecordsM1},
+  .pFOCVars           = &FOCVars[0],
+  .pBusSensor         = &BusVoltageSensor_M1._Super,
+  .pTemperatureSensor = &TempSensor_M1,
+  .pSTC               = &SpeednTorqCtrlM1,
+  .pPWMC              = &PWM_Handle_M1._Super,
+  .pMCI               = &Mci[M1],
+  .hDecimation        = FLR_DECIMATION,
+};
+
+/**
+  * @brief  PI bus voltage regulator of the regenerative braking limiter Motor 1.
+  */
+PID_Handle_t PIDRegenHandle_M1 =
+{
+  .hDefKpGain          = (int16_t)PID_REGEN_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_REGEN_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)((IQMAX + REGEN_ID_MAX) * REGEN_KIDIV),
+  .wLowerIntegralLimit = 0,
+  .hUpperOutputLimit   = (int16_t)(IQMAX + REGEN_ID_MAX),
+  .hLowerOutputLimit   = 0,
+  .hKpDivisor          = (uint16_t)REGEN_KPDIV,
+  .hKiDivisor          = (uint16_t)REGEN_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)REGEN_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)REGEN_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+REGEN_Handle_t RegenLimiterM1 =
+{
+  .pPIRegen     = &PIDRegenHandle_M1,
+  .pPISpeed     = &PIDSpeedHandle_M1,
+  .hVbusStart_d = REGEN_VBUS_START_d,
+  .hIdBrakeMax  = (int16_t)REGEN_ID_MAX,
+  .hIqRegenMax  = (int16_t)IQMAX,
+};
+
+/**
+  * @brief  Throttle input Motor 1.
+  */
+THR_Handle_t ThrottleInputM1 =
+{
+  .TIMx           = THR_TIM,
+  .DMAx           = THR_DMA,
+  .wDMAChannel    = THR_DMA_CHANNEL,
+  .wDMARequest    = THR_DMA_REQUEST,
+  .pMCI           = &Mci[M1],
+  .Protocol       = THR_PROTOCOL,
+  .ControlMode    = THR_CONTROL_MODE,
+  .hTicksPerUs    = (uint16_t)(SYSCLK_FREQ / 1000000uL),
+  .hPulseMin      = THR_PWM_MIN_US,
+  .hPulseMax      = THR_PWM_MAX_US,
+  .hGapMin        = THR_DSHOT_GAP_US,
+  .hArmingTime    = (uint16_t)THR_ARMING_TIME,
+  .hFailsafeTime  = (uint16_t)THR_FAILSAFE_TIMEOUT,
+  .hSpeedMin      = (int16_t)THR_SPEED_MIN_UNIT,
+  .hSpeedMax      = (int16_t)THR_SPEED_MAX_UNIT,
+  .hTorqueMax     = (int16_t)THR_TORQUE_MAX,
+  .hRampDuration  = THR_RAMP_DURATION_MS,
+  .bTelemetry     = (THR_DSHOT_TELEMETRY_ENABLE == 1),
+  .TLM_TIMx       = THR_TLM_TIM,
+  .wTlmDMAChannel = THR_TLM_DMA_CHANNEL,
+  .wTlmDMARequest = THR_TLM_DMA_REQUEST,
+  .wTlmTrigger    = THR_TLM_TRIGGER,
+  .GPIOx          = GPIOA,
+  .wPin           = LL_GPIO_PIN_15,
+  .hTurnaround    = THR_TURNAROUND_US,
+  .hPolePairs     = POLE_PAIR_NUM,
+};
+
+/**
+  * @brief  Speed loop filters Motor 1.
+  */
+SPDFLT_Handle_t SpeedFilterM1 =
+{
+  .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .fSpeedNotch_Hz    = (float_t)SPD_FLT_NOTCH_HZ,
+  .fSpeedLowPass_Hz  = (float_t)SPD_FLT_SPEED_LPF_HZ,
+  .fTorqueLowPass_Hz = (float_t)SPD_FLT_TORQUE_LPF_HZ,
+  .fNotchQ           = (float_t)SPD_FLT_NOTCH_Q,
+  .bAdaptive         = (SPD_FLT_ADAPTIVE_ENABLE == 1),
+  .fAdaptMin_Hz      = (float_t)SPD_FLT_ADAPTIVE_MIN_HZ,
+  .fAdaptMax_Hz      = (float_t)SPD_FLT_ADAPTIVE_MAX_HZ,
+  .fAdaptMinPower    = (float_t)SPD_FLT_ADAPTIVE_MIN_POWER,
+  .fAdaptStep        = (float_t)SPD_FLT_ADAPTIVE_STEP,
+};
+
+/**
+  * @brief  Load torque observer Motor 1.
+  */
+LTO_Handle_t LoadObserverM1 =
+{
+  .pIqd              = &FOCVars[M1].Iqd,
+  .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .fAccelPerDigit    = (float_t)LTO_ACCEL_PER_DIGIT,
+  .fDamping          = (float_t)LTO_DAMPING,
+  .fBandwidth_Hz     = (float_t)LTO_BANDWIDTH_HZ,
+  .hLoadMax          = (int16_t)IQMAX,
+  .bFeedForward      = (LTO_FEEDFORWARD_ENABLE == 1),
+};
+
+/**
+  * @brief  Deadbeat current control Motor 1.
+  */
+DBC_Handle_t DeadbeatCurrM1 =
+{
+  .pPIDIq            = &PIDIqHandle_M1,
+  .pPIDId            = &PIDIdHandle_M1,
+  .fResistance       = (float_t)DBC_RESISTANCE,
+  .fInductance       = (float_t)DBC_INDUCTANCE,
+  .fEmfPerDpp        = (float_t)DBC_EMF_PER_DPP,
+  .fGain             = (float_t)DBC_GAIN,
+  .fDisturbanceGain  = (float_t)DBC_DISTURBANCE_GAIN,
+  .hMaxModule        = MAX_MODULE,
+  .hHoldPeriods      = DBC_HOLD_PERIODS,
+  .bEnabled          = true,
+};
+
+/**
+  * @brief  Cogging compensation Motor 1.
+  */
+COG_Handle_t CoggingCompM1 =
+{
+  .pSTC              = &SpeednTorqCtrlM1,
+#if (COG_MECHANICAL_INDEX == 1)
+  .hSpeedRatio       = POLE_PAIR_NUM,
+#else
+  .hSpeedRatio       = 1U,
+#endif
+  .hIqMax            = (int16_t)COG_IQ_MAX,
+  .hCompMaxSpeed     = (int16_t)COG_COMP_MAX_UNIT,
+  .hLearnMinSpeed    = (int16_t)COG_LEARN_MIN_UNIT,
+  .hLearnMaxSpeed    = (int16_t)COG_LEARN_MAX_UNIT,
+  .hLearnRevolutions = COG_LEARN_REVOLUTIONS,
+  .fAccelPerDigit    = (float_t)COG_ACCEL_PER_DIGIT,
+  .fLearnGain        = (float_t)COG_LEARN_GAIN,
+  .fSensorLag        = (float_t)COG_SENSOR_LAG,
+};
+
+/**
+  * @brief  Vibration monitor Motor 1. The window is written by the current control.
+  */
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__( ( section ( ".ccmram" ) ) )
+#endif
+#endif
+static int16_t VibCaptureM1[VIB_FFT_SIZE];
+
+VIB_Handle_t VibMonitorM1 =
+{
+  .pMCI              = &Mci[M1],
+  .pCapture          = VibCaptureM1,
+  .hDecimation       = VIB_DECIMATION,
+  .hPolePairs        = POLE_PAIR_NUM,
+  .fControlFreq_Hz   = (float_t)TF_REGULATION_RATE,
+  .fSpeedTolerance   = (float_t)VIB_SPEED_TOLERANCE,
+  .bOrders           = {1U, 2U, VIB_HARMONIC_N},
+};
+
+/**
+  * @brief  Anomaly detector Motor 1. The model is generated by Utilities/AnomalyDetector.
+  */
+ANOM_Handle_t AnomalyDetectorM1 =
+{
+  .pModel            = &AnomalyModelM1,
+  .hDecimation       = ANOM_DECIMATION,
+  .hPersistence      = ANOM_PERSISTENCE,
+  .bScoreShift       = ANOM_SCORE_SHIFT,
+};
+
 /* USER CODE BEGIN Additional configuration */
 
 /* USER CODE END Additional configuration */
@@ -102,6 +102,10 @@ RDivider_Handle_t BusVoltageSensor_M1 =
 };
 
 PWMC_Handle_t *pwmcHandle[NBR_OF_MOTORS];
+RegConv_t *pTempRegConv[NBR_OF_MOTORS]           = {&TempRegConv_M1};
+RegConv_t *pVbusRegConv[NBR_OF_MOTORS]           = {&VbusRegConv_M1};
+RDivider_Handle_t *pBusSensor[NBR_OF_MOTORS]     = {&BusVoltageSensor_M1};
+VirtualSpeedSensor_Handle_t *pVSS[NBR_OF_MOTORS] = {&VirtualSpeedSensorM1};
 
 /* USER CODE BEGIN Additional configuration */
 
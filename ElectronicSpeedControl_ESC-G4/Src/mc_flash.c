@@ -0,0 +1,156 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_flash.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the flash
+  *          driver of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup MCFlash
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "mc_flash.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup MCFlash Flash driver
+  * @brief Page erase and double word programming of the internal flash
+  *
+  * The CPU stalls on flash reads while the flash is erased or programmed: about 20 ms per page
+  * erase, 90 us per double word. The functions are called with the motor stopped.
+  *
+  * The HAL timeout relies on the SysTick, it does not expire when the functions are called from
+  * the SysTick interrupt, the end of operation being then awaited without timeout.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Erases the page holding an address.
+  * @param  wAddress: address in the page.
+  * @retval bool true if the page is erased.
+  */
+__weak bool MCFLASH_ErasePage(uint32_t wAddress)
+{
+  FLASH_EraseInitTypeDef Erase;
+  uint32_t wPageError = 0U;
+  bool bErased;
+
+  Erase.TypeErase = FLASH_TYPEERASE_PAGES;
+  Erase.Banks = FLASH_BANK_1;
+  Erase.Page = (wAddress - FLASH_BASE) / MC_FLASH_PAGE_SIZE;
+  Erase.NbPages = 1U;
+
+  (void)HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+  bErased = (HAL_OK == HAL_FLASHEx_Erase(&Erase, &wPageError));
+  (void)HAL_FLASH_Lock();
+
+  return (bErased);
+}
+
+/**
+  * @brief  Programs a buffer to erased flash.
+  * @param  wAddress: destination, double word aligned.
+  * @param  pData: buffer to program.
+  * @param  wSize: bytes, the last double word being completed with the erased value.
+  * @retval bool true if the buffer is programmed.
+  */
+__weak bool MCFLASH_Program(uint32_t wAddress, const void *pData, uint32_t wSize)
+{
+  bool bProgrammed = false;
+#ifdef NULL_PTR_CHECK_MC_FLASH
+  if (MC_NULL == pData)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const uint8_t *pBytes = (const uint8_t *)pData;
+    uint32_t wOffset;
+
+    bProgrammed = true;
+    (void)HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    for (wOffset = 0U; (wOffset < wSize) && (true == bProgrammed); wOffset += MC_FLASH_PROGRAM_SIZE)
+    {
+      uint64_t dwData = UINT64_MAX;
+      uint32_t wChunk = ((wSize - wOffset) < MC_FLASH_PROGRAM_SIZE) ? (wSize - wOffset) : MC_FLASH_PROGRAM_SIZE;
+
+      (void)memcpy(&dwData, &pBytes[wOffset], wChunk);
+      bProgrammed = (HAL_OK == HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, wAddress + wOffset, dwData));
+    }
+    (void)HAL_FLASH_Lock();
+#ifdef NULL_PTR_CHECK_MC_FLASH
+  }
+#endif
+  return (bProgrammed);
+}
+
+/**
+  * @brief  Reads the flash to a buffer.
+  * @param  wAddress: source.
+  * @param  pData: destination buffer.
+  * @param  wSize: bytes.
+  */
+__weak void MCFLASH_Read(uint32_t wAddress, void *pData, uint32_t wSize)
+{
+#ifdef NULL_PTR_CHECK_MC_FLASH
+  if (MC_NULL == pData)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    (void)memcpy(pData, (const void *)wAddress, wSize); //cstat !MISRAC2012-Rule-11.6
+#ifdef NULL_PTR_CHECK_MC_FLASH
+  }
+#endif
+}
+
+/**
+  * @brief  Checks that a flash area is erased, so that it can be programmed.
+  * @param  wAddress: start of the area.
+  * @param  wSize: bytes.
+  * @retval bool true if all the bytes read as erased.
+  */
+__weak bool MCFLASH_IsErased(uint32_t wAddress, uint32_t wSize)
+{
+  const uint8_t *pBytes = (const uint8_t *)wAddress; //cstat !MISRAC2012-Rule-11.6
+  uint32_t wOffset;
+  bool bErased = true;
+
+  for (wOffset = 0U; (wOffset < wSize) && (true == bErased); wOffset++)
+  {
+    bErased = (UINT8_MAX == pBytes[wOffset]);
+  }
+  return (bErased);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -84,9 +84,14 @@ __weak void MCI_ExecSpeedRamp(MCI_Handle_t *pHandle, int16_t hFinalSpeed, uint16
   else
   {
 #endif
+    /* The command is withdrawn while its parameters are written, the caller being preempted by the
+       Medium Frequency task that executes it */
+    pHandle->CommandState = MCI_BUFFER_EMPTY;
+    __COMPILER_BARRIER();
     pHandle->lastCommand = MCI_CMD_EXECSPEEDRAMP;
     pHandle->hFinalSpeed = hFinalSpeed;
     pHandle->hDurationms = hDurationms;
+    __COMPILER_BARRIER();
     pHandle->CommandState = MCI_COMMAND_NOT_ALREADY_EXECUTED;
     pHandle->LastModalitySetByUser = MCM_SPEED_MODE;
 
@@ -164,9 +169,13 @@ __weak void MCI_ExecTorqueRamp(MCI_Handle_t *pHandle, int16_t hFinalTorque, uint
   else
   {
 #endif
+    /* Withdrawn while its parameters are written, see MCI_ExecSpeedRamp */
+    pHandle->CommandState = MCI_BUFFER_EMPTY;
+    __COMPILER_BARRIER();
     pHandle->lastCommand = MCI_CMD_EXECTORQUERAMP;
     pHandle->hFinalTorque = hFinalTorque;
     pHandle->hDurationms = hDurationms;
+    __COMPILER_BARRIER();
     pHandle->CommandState = MCI_COMMAND_NOT_ALREADY_EXECUTED;
     pHandle->LastModalitySetByUser = MCM_TORQUE_MODE;
 #ifdef NULL_PTR_CHECK_MC_INT
@@ -238,10 +247,13 @@ __weak void MCI_SetCurrentReferences(MCI_Handle_t *pHandle, qd_t Iqdref)
   else
   {
 #endif
-
+    /* Withdrawn while its parameters are written, see MCI_ExecSpeedRamp */
+    pHandle->CommandState = MCI_BUFFER_EMPTY;
+    __COMPILER_BARRIER();
     pHandle->lastCommand = MCI_CMD_SETCURRENTREFERENCES;
     pHandle->Iqdref.q = Iqdref.q;
     pHandle->Iqdref.d = Iqdref.d;
+    __COMPILER_BARRIER();
     pHandle->CommandState = MCI_COMMAND_NOT_ALREADY_EXECUTED;
     pHandle->LastModalitySetByUser = MCM_TORQUE_MODE;
 #ifdef NULL_PTR_CHECK_MC_INT
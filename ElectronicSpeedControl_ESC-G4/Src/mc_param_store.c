@@ -0,0 +1,537 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_param_store.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Parameter Store component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup ParamStore
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "mc_param_store.h"
+#include "mcp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup ParamStore Parameter Store
+  * @brief Drive parameters kept in the flash, overriding the built-in ones
+  *
+  * The parameter block holds the regulator gains, the speed and torque limits, the rev-up sequence,
+  * the motor model and the current reading offsets. It is appended to @ref FlashRecords, the newest
+  * block of the current layout version being loaded at boot:
+  *
+  * - PST_Load, before the components are initialized, sets the defaults they start from.
+  * - PST_Init, once they are initialized, retunes the observer on the stored motor model. Without
+  *   stored block, the built-in parameters are copied to the running block instead.
+  * - At start, the stored offsets replace the offset calibration when the temperature moved by
+  *   less than #PST_OFFSETS_MAX_DRIFT_CELSIUS since they were measured.
+  *
+  * The running block is read, written, refreshed from the running parameters and committed to the
+  * flash by the PARAM_STORE_CMD command of the MCP, changes being lost at reset until committed.
+  * A complete self commissioning run refreshes and commits it on its own.
+  * The commits are executed by PST_BackgroundTask, from the main loop as the writes of the
+  * @ref FaultRecorder "fault recorder": the flash is only programmed from that context.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* MCP reply: layout version followed by the block */
+#define PST_REPLY_SIZE              (2U + sizeof(PST_Data_t))
+
+/**
+  * @brief  Checks a block before it is applied.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @param  pData: block.
+  * @retval bool true if the gains are positive, the limits of the right sign and the motor model positive.
+  *
+  * - Without self commissioning, the motor model is not stored and not checked.
+  */
+static bool PST_IsValid(const PST_Handle_t *pHandle, const PST_Data_t *pData)
+{
+  return ((pData->hIqKp >= 0) && (pData->hIqKi >= 0) && (pData->hIdKp >= 0) && (pData->hIdKi >= 0)
+       && (pData->hSpeedKp >= 0) && (pData->hSpeedKi >= 0)
+       && (pData->hMinAppNegativeMecSpeedUnit <= 0) && (pData->hMinNegativeTorque <= 0)
+       && ((MC_NULL == pHandle->pSCC) || ((pData->fRs > 0.0f) && (pData->fLs > 0.0f) && (pData->fKe > 0.0f)))
+       && (pData->bOffsetsValid <= 1U));
+}
+
+/**
+  * @brief  Sets a regulator gains, also as defaults so that they survive the regulator initialization.
+  * @param  pPID: regulator.
+  * @param  hKp: proportional gain.
+  * @param  hKi: integral gain.
+  */
+static void PST_SetGains(PID_Handle_t *pPID, int16_t hKp, int16_t hKi)
+{
+  pPID->hDefKpGain = hKp;
+  pPID->hDefKiGain = hKi;
+  PID_SetKP(pPID, hKp);
+  PID_SetKI(pPID, hKi);
+}
+
+/**
+  * @brief  Applies the gains, limits and rev-up sequence of the block.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  */
+static void PST_ApplyDrive(PST_Handle_t *pHandle)
+{
+  const PST_Data_t *pData = &pHandle->Data;
+  SpeednTorqCtrl_Handle_t *pSTC = pHandle->pSTC;
+  uint8_t i;
+
+  PST_SetGains(pHandle->pPIDIq, pData->hIqKp, pData->hIqKi);
+  PST_SetGains(pHandle->pPIDId, pData->hIdKp, pData->hIdKi);
+  PST_SetGains(pHandle->pPIDSpeed, pData->hSpeedKp, pData->hSpeedKi);
+
+  pSTC->MaxAppPositiveMecSpeedUnit = pData->hMaxAppPositiveMecSpeedUnit;
+  pSTC->MinAppNegativeMecSpeedUnit = pData->hMinAppNegativeMecSpeedUnit;
+  pSTC->MaxPositiveTorque = pData->hMaxPositiveTorque;
+  pSTC->MinNegativeTorque = pData->hMinNegativeTorque;
+
+  for (i = 0U; i < RUC_MAX_PHASE_NUMBER; i++)
+  {
+    RUC_SetPhaseDurationms(pHandle->pRevupCtrl, i, pData->RevUp[i].hDurationms);
+    RUC_SetPhaseFinalMecSpeedUnit(pHandle->pRevupCtrl, i, pData->RevUp[i].hFinalMecSpeedUnit);
+    RUC_SetPhaseFinalTorque(pHandle->pRevupCtrl, i, pData->RevUp[i].hFinalTorque);
+  }
+}
+
+/**
+  * @brief  Copies the motor model applied by the self commissioning to the block.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  */
+static void PST_CaptureMotor(PST_Handle_t *pHandle)
+{
+  if (MC_NULL == pHandle->pSCC)
+  {
+    /* Nothing to do, no motor model to store */
+  }
+  else
+  {
+    pHandle->Data.fRs = pHandle->pSCC->fRSApplied;
+    pHandle->Data.fLs = pHandle->pSCC->fLSApplied;
+    pHandle->Data.fKe = pHandle->pSCC->fKeApplied;
+  }
+}
+
+/**
+  * @brief  Retunes the observer on a motor model.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @param  pData: block holding the model.
+  * @retval bool false if the model is out of the range of the observer constants.
+  */
+static bool PST_ApplyMotor(PST_Handle_t *pHandle, const PST_Data_t *pData)
+{
+  return ((MC_NULL == pHandle->pSCC) ? true : SCC_SetMotorParams(pHandle->pSCC, pData->fRs, pData->fLs, pData->fKe));
+}
+
+/**
+  * @brief  Reads the newest parameter block from the flash and applies it to the component defaults.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @retval bool true if a valid block of the current layout version was found.
+  *
+  * - Called before the components are initialized. The motor model is applied by PST_Init.
+  */
+__weak bool PST_Load(PST_Handle_t *pHandle)
+{
+  bool bLoaded = false;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    PST_Data_t Data;
+
+    FREC_Init(&pHandle->Records);
+    if ((true == FREC_ReadLast(&pHandle->Records, &Data, (uint16_t)sizeof(PST_Data_t))) && (true == PST_IsValid(pHandle, &Data)))
+    {
+      pHandle->Data = Data;
+      PST_ApplyDrive(pHandle);
+      bLoaded = true;
+    }
+    else
+    {
+      /* Nothing to do, the built-in parameters are kept */
+    }
+    pHandle->bLoaded = bLoaded;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+  return (bLoaded);
+}
+
+/**
+  * @brief  Completes the load once the components are initialized.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  *
+  * - The observer is retuned on the stored motor model. Without stored block, the running block
+  *   is filled with the built-in parameters, the offsets being left invalid.
+  */
+__weak void PST_Init(PST_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bCommitRequest = false;
+    pHandle->hWriteErrors = 0U;
+    if (true == pHandle->bLoaded)
+    {
+      if (false == PST_ApplyMotor(pHandle, &pHandle->Data))
+      {
+        /* Out of the range of the observer constants: the built-in motor model is kept */
+        PST_CaptureMotor(pHandle);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      PST_Capture(pHandle);
+    }
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Copies the running gains, limits, rev-up sequence and motor model to the block.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  *
+  * - The offsets of the block are updated at each offset calibration, see PST_SetOffsets.
+  */
+__weak void PST_Capture(PST_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    PST_Data_t *pData = &pHandle->Data;
+    SpeednTorqCtrl_Handle_t *pSTC = pHandle->pSTC;
+    uint8_t i;
+
+    pData->hIqKp = PID_GetKP(pHandle->pPIDIq);
+    pData->hIqKi = PID_GetKI(pHandle->pPIDIq);
+    pData->hIdKp = PID_GetKP(pHandle->pPIDId);
+    pData->hIdKi = PID_GetKI(pHandle->pPIDId);
+    pData->hSpeedKp = PID_GetKP(pHandle->pPIDSpeed);
+    pData->hSpeedKi = PID_GetKI(pHandle->pPIDSpeed);
+
+    pData->hMaxAppPositiveMecSpeedUnit = pSTC->MaxAppPositiveMecSpeedUnit;
+    pData->hMinAppNegativeMecSpeedUnit = pSTC->MinAppNegativeMecSpeedUnit;
+    pData->hMaxPositiveTorque = pSTC->MaxPositiveTorque;
+    pData->hMinNegativeTorque = pSTC->MinNegativeTorque;
+
+    for (i = 0U; i < RUC_MAX_PHASE_NUMBER; i++)
+    {
+      pData->RevUp[i].hDurationms = RUC_GetPhaseDurationms(pHandle->pRevupCtrl, i);
+      pData->RevUp[i].hFinalMecSpeedUnit = RUC_GetPhaseFinalMecSpeedUnit(pHandle->pRevupCtrl, i);
+      pData->RevUp[i].hFinalTorque = RUC_GetPhaseFinalTorque(pHandle->pRevupCtrl, i);
+      pData->RevUp[i].hReserved = 0U;
+    }
+    PST_CaptureMotor(pHandle);
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Appends the running block to the flash.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @retval bool true if the block is programmed.
+  *
+  * - Takes up to a page erase, about 20 ms: to be called from the main loop with the motor stopped,
+  *   see PST_BackgroundTask.
+  */
+__weak bool PST_Commit(PST_Handle_t *pHandle)
+{
+  bool bCommitted = false;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    PST_Data_t Data;
+
+    /* Enter critical section */
+    /* Disable interrupts so that an MCP write never changes the block between its CRC and its programming */
+    __disable_irq();
+    Data = pHandle->Data;
+
+    /* Exit critical section */
+    __enable_irq();
+
+    bCommitted = FREC_Append(&pHandle->Records, &Data, (uint16_t)sizeof(PST_Data_t));
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+  return (bCommitted);
+}
+
+/**
+  * @brief  Requests the running block to be appended to the flash by the background task.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  */
+__weak void PST_RequestCommit(PST_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bCommitRequest = true;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Executes the commit requests.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  *
+  * - Called from the main loop, the only context programming the flash. A request waits for IDLE.
+  */
+__weak void PST_BackgroundTask(PST_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((true == pHandle->bCommitRequest) && (IDLE == MCI_GetSTMState(pHandle->pMCI)))
+    {
+      pHandle->bCommitRequest = false;
+      if (false == PST_Commit(pHandle))
+      {
+        pHandle->hWriteErrors++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the offsets of the block if they were measured at about the present temperature.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @param  hCelsius: present temperature, Celsius.
+  * @param  pOffsets: set to the stored offsets.
+  * @retval bool true if the offsets can be used instead of a calibration.
+  */
+__weak bool PST_GetOffsets(PST_Handle_t *pHandle, int16_t hCelsius, PolarizationOffsets_t *pOffsets)
+{
+  bool bFresh = false;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == pOffsets))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int32_t wDrift = (int32_t)hCelsius - (int32_t)pHandle->Data.hOffsetsCelsius;
+
+    if ((1U == pHandle->Data.bOffsetsValid) && (wDrift <= pHandle->hOffsetsMaxDrift)
+     && (wDrift >= -(int32_t)pHandle->hOffsetsMaxDrift))
+    {
+      *pOffsets = pHandle->Data.Offsets;
+      bFresh = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+  return (bFresh);
+}
+
+/**
+  * @brief  Records offsets just measured in the running block.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @param  pOffsets: offsets.
+  * @param  hCelsius: temperature of the measurement, Celsius.
+  */
+__weak void PST_SetOffsets(PST_Handle_t *pHandle, const PolarizationOffsets_t *pOffsets, int16_t hCelsius)
+{
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == pOffsets))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Data.Offsets = *pOffsets;
+    pHandle->Data.hOffsetsCelsius = hCelsius;
+    pHandle->Data.bOffsetsValid = 1U;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Executes a parameter store command received by the MCP.
+  * @param  pHandle: handler of the current instance of the Parameter Store component.
+  * @param  rxLength: length of the received payload.
+  * @param  rxBuffer: received payload, the command (PST_CMD_xxx) followed by its data.
+  * @param  txSyncFreeSpace: space available in the answer buffer.
+  * @param  txLength: set to the length of the answer.
+  * @param  txBuffer: answer, the layout version (2 bytes) followed by the running block.
+  * @retval uint8_t MCP error code.
+  *
+  * - PST_CMD_WRITE carries the layout version and a #PST_Data_t. The block is checked and
+  *   applied at once, the motor being stopped.
+  * - PST_CMD_COMMIT is accepted with the motor stopped only, the block being appended by the
+  *   background task.
+  */
+__weak uint8_t PST_CMD(PST_Handle_t *pHandle, uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace,
+                       uint16_t *txLength, uint8_t *txBuffer)
+{
+  uint8_t bResult = MCP_CMD_UNKNOWN;
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == rxBuffer) || (MC_NULL == txLength) || (MC_NULL == txBuffer))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((0U == rxLength) || (txSyncFreeSpace < (int16_t)PST_REPLY_SIZE))
+    {
+      bResult = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else
+    {
+      bool bIdle = (IDLE == MCI_GetSTMState(pHandle->pMCI));
+
+      switch (rxBuffer[0])
+      {
+        case PST_CMD_READ:
+        {
+          bResult = MCP_CMD_OK;
+          break;
+        }
+
+        case PST_CMD_WRITE:
+        {
+          PST_Data_t Data;
+          uint16_t hVersion = (uint16_t)rxBuffer[1] | ((uint16_t)rxBuffer[2] << 8U);
+
+          if ((rxLength != (3U + sizeof(PST_Data_t))) || (hVersion != PST_VERSION))
+          {
+            bResult = MCP_ERROR_BAD_RAW_FORMAT;
+          }
+          else
+          {
+            (void)memcpy(&Data, &rxBuffer[3], sizeof(PST_Data_t));
+            if ((true == bIdle) && (true == PST_IsValid(pHandle, &Data)) && (true == PST_ApplyMotor(pHandle, &Data)))
+            {
+              pHandle->Data = Data;
+              PST_ApplyDrive(pHandle);
+              bResult = MCP_CMD_OK;
+            }
+            else
+            {
+              bResult = MCP_CMD_NOK;
+            }
+          }
+          break;
+        }
+
+        case PST_CMD_CAPTURE:
+        {
+          PST_Capture(pHandle);
+          bResult = MCP_CMD_OK;
+          break;
+        }
+
+        case PST_CMD_COMMIT:
+        {
+          if (true == bIdle)
+          {
+            PST_RequestCommit(pHandle);
+            bResult = MCP_CMD_OK;
+          }
+          else
+          {
+            bResult = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+        default:
+          /* Nothing to do */
+          break;
+      }
+
+      txBuffer[0] = (uint8_t)PST_VERSION;
+      txBuffer[1] = (uint8_t)(PST_VERSION >> 8U);
+      (void)memcpy(&txBuffer[2], &pHandle->Data, sizeof(PST_Data_t));
+      *txLength = (uint16_t)PST_REPLY_SIZE;
+    }
+#ifdef NULL_PTR_CHECK_PARAM_STORE
+  }
+#endif
+  return (bResult);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
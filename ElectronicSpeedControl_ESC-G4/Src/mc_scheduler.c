@@ -0,0 +1,354 @@
+
+/**
+  ******************************************************************************
+  * @file    mc_scheduler.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Task Scheduler component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup TaskScheduler
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_scheduler.h"
+#include "stm32g4xx.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup TaskScheduler Task Scheduler
+  * @brief Table driven scheduler of the Motor Control tasks
+  *
+  * Each task of the table is released every hPeriod ticks, from tick hPhase. Released tasks run to
+  * completion in the order of their priority, in one of two contexts:
+  *
+  * - #SCHED_TICK tasks run in the tick interrupt, right after their release.
+  * - #SCHED_DEFERRED tasks run in the PendSV exception, pended by the tick. It has the lowest
+  *   priority, so that these tasks never delay the tick tasks.
+  *
+  * A release that finds the previous job of the task not completed is an overrun: the jobs are
+  * merged and the overrun counted. The execution and response times of the jobs are measured with
+  * the DWT cycle counter and the response time is checked against the deadline of the task.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Returns the cycle counter.
+  */
+static inline uint32_t SCHED_GetCycles(void)
+{
+  return (DWT->CYCCNT);
+}
+
+/**
+  * @brief  Releases a task, or counts an overrun if its previous job is not completed.
+  * @param  pState: state of the task.
+  * @param  wCycles: cycle counter at the release.
+  */
+static void SCHED_Release(SCHED_TaskState_t *pState, uint32_t wCycles)
+{
+  if ((pState->hReleases != pState->hStarts) || (true == pState->bRunning))
+  {
+    pState->wOverruns++;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (pState->hReleases == pState->hStarts)
+  {
+    pState->wReleaseCycles = wCycles;
+    pState->hReleases++;
+  }
+  else
+  {
+    /* Nothing to do, merged with the pending job */
+  }
+}
+
+/**
+  * @brief  Runs the released tasks of a context, the highest priority first.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  * @param  Context: context of the caller.
+  */
+static void SCHED_Dispatch(SCHED_Handle_t *pHandle, SCHED_Context_t Context)
+{
+  bool bReady = true;
+
+  while (true == bReady)
+  {
+    uint8_t bSelected = pHandle->bTaskNbr;
+    uint16_t hReleases = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < pHandle->bTaskNbr; i++)
+    {
+      const SCHED_Task_t *pTask = &pHandle->pTasks[i];
+      uint16_t hTaskReleases = pHandle->pStates[i].hReleases;
+
+      if ((Context == pTask->Context) && (hTaskReleases != pHandle->pStates[i].hStarts)
+       && ((bSelected == pHandle->bTaskNbr) || (pTask->bPriority < pHandle->pTasks[bSelected].bPriority)))
+      {
+        bSelected = i;
+        hReleases = hTaskReleases;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+
+    if (bSelected == pHandle->bTaskNbr)
+    {
+      bReady = false;
+    }
+    else
+    {
+      SCHED_TaskState_t *pState = &pHandle->pStates[bSelected];
+      /* Read while pending: the tick does not write it before the job is started */
+      uint32_t wRelease = pState->wReleaseCycles;
+      uint32_t wStart;
+      uint32_t wEnd;
+
+      pState->hStarts = hReleases;
+      pState->bRunning = true;
+      wStart = SCHED_GetCycles();
+      pHandle->pTasks[bSelected].pFct();
+      wEnd = SCHED_GetCycles();
+      pState->bRunning = false;
+
+      pState->wRuns++;
+      if ((wEnd - wStart) > pState->wMaxExecCycles)
+      {
+        pState->wMaxExecCycles = wEnd - wStart;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if ((wEnd - wRelease) > pState->wMaxResponseCycles)
+      {
+        pState->wMaxResponseCycles = wEnd - wRelease;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if ((wEnd - wRelease) > ((uint32_t)pHandle->pTasks[bSelected].hDeadlineUs * pHandle->wCyclesPerUs))
+      {
+        pState->wDeadlineMisses++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Initializes the Task Scheduler component and starts the DWT cycle counter.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  */
+__weak void SCHED_Init(SCHED_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCHED
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    pHandle->wCyclesPerUs = SystemCoreClock / 1000000U;
+    pHandle->wTick = 0U;
+
+    for (i = 0U; i < pHandle->bTaskNbr; i++)
+    {
+      pHandle->pStates[i].hReleases = 0U;
+      pHandle->pStates[i].hStarts = 0U;
+      pHandle->pStates[i].bRunning = false;
+      pHandle->pStates[i].hCountdown = pHandle->pTasks[i].hPhase;
+    }
+    SCHED_ClearStats(pHandle);
+#ifdef NULL_PTR_CHECK_SCHED
+  }
+#endif
+}
+
+/**
+  * @brief  Releases the periodic tasks due at this tick, runs the tick tasks and pends the
+  *         deferred ones.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  */
+__weak void SCHED_Tick(SCHED_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCHED
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t wCycles = SCHED_GetCycles();
+    bool bDeferred = false;
+    uint8_t i;
+
+    pHandle->wTick++;
+    for (i = 0U; i < pHandle->bTaskNbr; i++)
+    {
+      const SCHED_Task_t *pTask = &pHandle->pTasks[i];
+      SCHED_TaskState_t *pState = &pHandle->pStates[i];
+
+      if (0U == pTask->hPeriod)
+      {
+        /* Nothing to do, released by SCHED_Trigger */
+      }
+      else
+      {
+        if (0U == pState->hCountdown)
+        {
+          SCHED_Release(pState, wCycles);
+          bDeferred = (SCHED_DEFERRED == pTask->Context) ? true : bDeferred;
+          pState->hCountdown = pTask->hPeriod;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        pState->hCountdown--;
+      }
+    }
+
+    SCHED_Dispatch(pHandle, SCHED_TICK);
+
+    if (true == bDeferred)
+    {
+      SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SCHED
+  }
+#endif
+}
+
+/**
+  * @brief  Releases a task out of its period.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  * @param  bTask: index of the task in the table.
+  *
+  * A tick task is run before returning, a deferred task is pended. The function is to be called
+  * by an interrupt that can not preempt the tick, nor be preempted by it.
+  */
+__weak void SCHED_Trigger(SCHED_Handle_t *pHandle, uint8_t bTask)
+{
+#ifdef NULL_PTR_CHECK_SCHED
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (bTask < pHandle->bTaskNbr)
+    {
+      SCHED_Release(&pHandle->pStates[bTask], SCHED_GetCycles());
+      if (SCHED_TICK == pHandle->pTasks[bTask].Context)
+      {
+        SCHED_Dispatch(pHandle, SCHED_TICK);
+      }
+      else
+      {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SCHED
+  }
+#endif
+}
+
+/**
+  * @brief  Runs the released deferred tasks.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  */
+__weak void SCHED_RunDeferred(SCHED_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCHED
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    SCHED_Dispatch(pHandle, SCHED_DEFERRED);
+#ifdef NULL_PTR_CHECK_SCHED
+  }
+#endif
+}
+
+/**
+  * @brief  Clears the statistics of the tasks.
+  * @param  pHandle: handler of the current instance of the Task Scheduler component.
+  */
+__weak void SCHED_ClearStats(SCHED_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SCHED
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+    for (i = 0U; i < pHandle->bTaskNbr; i++)
+    {
+      pHandle->pStates[i].wRuns = 0U;
+      pHandle->pStates[i].wOverruns = 0U;
+      pHandle->pStates[i].wDeadlineMisses = 0U;
+      pHandle->pStates[i].wMaxExecCycles = 0U;
+      pHandle->pStates[i].wMaxResponseCycles = 0U;
+    }
+#ifdef NULL_PTR_CHECK_SCHED
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -34,6 +34,7 @@
 #include "parameters_conversion.h"
 #include "mcp_config.h"
 #include "mc_app_hooks.h"
+#include "mc_scheduler.h"
 
 /* USER CODE BEGIN Includes */
 
@@ -48,13 +49,24 @@
 /* USER CODE END Private define */
 
 #define VBUS_TEMP_ERR_MASK (MC_OVER_VOLT| MC_UNDER_VOLT| MC_OVER_TEMP)
+#define VBUS_TEMP_ERR_MASK2 (MC_OVER_VOLT| MC_UNDER_VOLT| MC_OVER_TEMP)
 /* Private variables----------------------------------------------------------*/
 
-static uint16_t hMFTaskCounterM1 = 0; //cstat !MISRAC2012-Rule-8.9_a
-static volatile uint16_t hBootCapDelayCounterM1 = ((uint16_t)0);
-static volatile uint16_t hStopPermanencyCounterM1 = ((uint16_t)0);
+static volatile uint32_t wBootCapDelayEnd[NBR_OF_MOTORS];
+static volatile uint32_t wStopPermanencyEnd[NBR_OF_MOTORS];
 static volatile uint8_t bMCBootCompleted = ((uint8_t)0);
 
+#if (NBR_OF_MOTORS > 1)
+/* Motors whose FOC is due, in the order of their PWM updates. The R3_2 driver starts the timer of
+   motor 1 half a PWM period ahead of the one of motor 2, so that their current conversions and the
+   FOC of the two motors alternate on the shared ADCs: each timer update reserves the next ADC
+   interrupt for its motor (see TSK_DualDriveFIFOUpdate) */
+#define FOC_ARRAY_LENGTH                  2U
+static volatile uint8_t FOC_array[FOC_ARRAY_LENGTH] = {M1, M2};
+static volatile uint8_t FOC_array_head = 0U;
+static volatile uint8_t FOC_array_tail = 0U;
+#endif
+
 #define M1_CHARGE_BOOT_CAP_TICKS          (((uint16_t)SYS_TICK_FREQUENCY * (uint16_t)10) / 1000U)
 #define M1_CHARGE_BOOT_CAP_DUTY_CYCLES ((uint32_t)0.000\
                                       * ((uint32_t)PWM_PERIOD_CYCLES / 2U))
@@ -62,12 +74,85 @@ static volatile uint8_t bMCBootCompleted = ((uint8_t)0);
 #define M2_CHARGE_BOOT_CAP_DUTY_CYCLES ((uint32_t)0\
                                       * ((uint32_t)PWM_PERIOD_CYCLES2 / 2U))
 
+/* Tasks of the scheduler, by decreasing rate. The safety task comes after the Medium Frequency
+   task so that it can overcome actions they initiated. The MCP parser is released by the packets
+   received and deferred to the PendSV, so that it never delays them. The Medium Frequency tasks
+   of two motors are released on alternate ticks, half their period apart */
+#define MC_TASK_MF_M1                     0U
+#define MC_TASK_SAFETY                    1U
+#define MC_TASK_MCP                       2U
+#define MC_TASK_MF_M2                     3U
+#define MC_TASK_NBR                       (2U + (uint8_t)NBR_OF_MOTORS)
+
+#define MC_TASK_PERIOD_TICKS(hz)          ((uint16_t)(SYS_TICK_FREQUENCY / (hz)))
+#define MC_TICK_US                        ((uint16_t)(1000000U / SYS_TICK_FREQUENCY))
+#define MC_MCP_DEADLINE_US                2000U   /* Answer time of a packet */
+
+static void TSK_MediumFrequencyTasksM1(void);
+#if (NBR_OF_MOTORS > 1)
+static void TSK_MediumFrequencyTasksM2(void);
+#endif
+
+static const SCHED_Task_t MCTasks[MC_TASK_NBR] =
+{
+  [MC_TASK_MF_M1] =
+  {
+    .pFct        = &TSK_MediumFrequencyTasksM1,
+    .hPeriod     = MC_TASK_PERIOD_TICKS(MEDIUM_FREQUENCY_TASK_RATE),
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_TICK_US,
+    .bPriority   = 0U,
+    .Context     = SCHED_TICK,
+  },
+  [MC_TASK_SAFETY] =
+  {
+    .pFct        = &TSK_SafetyTask,
+    .hPeriod     = 1U,
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_TICK_US,
+    .bPriority   = 1U,
+    .Context     = SCHED_TICK,
+  },
+  [MC_TASK_MCP] =
+  {
+    .pFct        = &TSK_MCPTask,
+    .hPeriod     = 0U,                /* Released by MC_TriggerMCPTask */
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_MCP_DEADLINE_US,
+    .bPriority   = 2U,
+    .Context     = SCHED_DEFERRED,
+  },
+#if (NBR_OF_MOTORS > 1)
+  [MC_TASK_MF_M2] =
+  {
+    .pFct        = &TSK_MediumFrequencyTasksM2,
+    .hPeriod     = MC_TASK_PERIOD_TICKS(MEDIUM_FREQUENCY_TASK_RATE2),
+    .hPhase      = MC_TASK_PERIOD_TICKS(MEDIUM_FREQUENCY_TASK_RATE2) / 2U,
+    .hDeadlineUs = MC_TICK_US,
+    .bPriority   = 0U,
+    .Context     = SCHED_TICK,
+  },
+#endif
+};
+
+static SCHED_TaskState_t MCTaskStates[MC_TASK_NBR];
+
+SCHED_Handle_t MCTaskScheduler =
+{
+  .pTasks   = MCTasks,
+  .pStates  = MCTaskStates,
+  .bTaskNbr = MC_TASK_NBR,
+};
+
 /* USER CODE BEGIN Private Variables */
 
 /* USER CODE END Private Variables */
 
 /* Private functions ---------------------------------------------------------*/
 void TSK_MediumFrequencyTaskM1(void);
+#if (NBR_OF_MOTORS > 1)
+void TSK_MediumFrequencyTaskM2(void);
+#endif
 void TSK_MF_StopProcessing(uint8_t motor);
 MCI_Handle_t *GetMCI(uint8_t bMotor);
 void TSK_SafetyTask_PWMOFF(uint8_t motor);
@@ -101,6 +186,8 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     /*    FOC initialization         */
     /*************************************************/
     pMCIList[M1] = &Mci[M1];
+    /* Stored parameters become the defaults of the components */
+    (void)PST_Load(&ParamStoreM1);
     FOC_Init();
 
     ASPEP_start(&aspepOverUartA);
@@ -130,6 +217,13 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     (void)RCM_RegisterRegConv(&TempRegConv_M1);
     NTC_Init(&TempSensor_M1);
 
+#if (THR_INPUT_ENABLE == 1)
+    /*******************************************************/
+    /*   Throttle input component initialization           */
+    /*******************************************************/
+    THR_Init(&ThrottleInputM1);
+#endif
+
     /* Applicative hook in MCBoot() */
     MC_APP_BootHook();
 
@@ -142,6 +236,8 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
 
     /* USER CODE END MCboot 2 */
 
+    SCHED_Init(&MCTaskScheduler);
+
     bMCBootCompleted = 1U;
   }
 }
@@ -149,16 +245,15 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
 /**
  * @brief Runs all the Tasks of the Motor Control cockpit
  *
- * This function is to be called periodically at least at the Medium Frequency task
- * rate (It is typically called on the Systick interrupt). Exact invokation rate is
- * the Speed regulator execution rate set in the Motor Contorl Workbench.
+ * This function is to be called on the Systick interrupt, at SYS_TICK_FREQUENCY. It
+ * advances the task scheduler, which runs in this order the tasks it releases:
  *
- * The following tasks are executed in this order:
+ * - Medium Frequency Tasks of each motors, at the Speed regulator execution rate, on alternate
+ *   ticks for two motors.
+ * - Safety Task, at each tick.
  *
- * - Medium Frequency Tasks of each motors.
- * - Safety Task.
- * - Power Factor Correction Task (if enabled).
- * - User Interface task.
+ * The Motor Control Protocol task is released by MC_TriggerMCPTask and run by
+ * MC_RunDeferredTasks.
  */
 __weak void MC_RunMotorControlTasks(void)
 {
@@ -168,76 +263,209 @@ __weak void MC_RunMotorControlTasks(void)
   }
   else
   {
-    /* ** Medium Frequency Tasks ** */
+    SCHED_Tick(&MCTaskScheduler);
+  /* USER CODE BEGIN MC_Scheduler 2 */
+
+  /* USER CODE END MC_Scheduler 2 */
+  }
+}
+
+/**
+ * @brief Runs the Motor Control tasks deferred by the scheduler
+ *
+ * This function is to be called on the PendSV exception, at the lowest interrupt priority:
+ * the Systick and the control interrupts preempt these tasks.
+ */
+__weak void MC_RunDeferredTasks(void)
+{
+  if (0U == bMCBootCompleted)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    SCHED_RunDeferred(&MCTaskScheduler);
+  }
+}
+
+/**
+ * @brief Runs the Safety Task out of its period
+ *
+ * This function is to be called on an interrupt that has the priority of the Systick, when a
+ * fault has to be processed at once.
+ */
+__weak void MC_TriggerSafetyTask(void)
+{
+  if (0U == bMCBootCompleted)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    SCHED_Trigger(&MCTaskScheduler, MC_TASK_SAFETY);
+  }
+}
+
+/**
+ * @brief Releases the Motor Control Protocol task
+ *
+ * This function is to be called on the Systick interrupt, once the transport layer has
+ * received a packet. The packet is processed by the MCP task in the PendSV exception: the
+ * commands it carries reach the motors through the MC API, whose buffered commands are
+ * published to the Medium Frequency task complete (see MCI_ExecSpeedRamp).
+ *
+ * The packet stays pending in the transport layer until the job takes it: the task is not
+ * released again while its job waits, so that a packet is counted once as an overrun when it
+ * is received during the job of the previous one.
+ */
+__weak void MC_TriggerMCPTask(void)
+{
+  if ((0U == bMCBootCompleted) || (true == SCHED_IsPending(&MCTaskScheduler, MC_TASK_MCP)))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    SCHED_Trigger(&MCTaskScheduler, MC_TASK_MCP);
+  }
+}
+
+/**
+  * @brief  Executes the Medium Frequency Tasks of motor 1 and its applicative hook.
+  */
+static void TSK_MediumFrequencyTasksM1(void)
+{
 /* USER CODE BEGIN MC_Scheduler 0 */
 
 /* USER CODE END MC_Scheduler 0 */
 
-    if(hMFTaskCounterM1 > 0u)
-    {
-      hMFTaskCounterM1--;
-    }
-    else
-    {
-
-      TSK_MediumFrequencyTaskM1();
-
-      /* Applicative hook at end of Medium Frequency for Motor 1 */
-      MC_APP_PostMediumFrequencyHook_M1();
-
-      MCP_Over_UartA.rxBuffer = MCP_Over_UartA.pTransportLayer->fRXPacketProcess(MCP_Over_UartA.pTransportLayer,
-                                                                                &MCP_Over_UartA.rxLength);
-      if ( 0U == MCP_Over_UartA.rxBuffer)
-      {
-        /* Nothing to do */
-      }
-      else
-      {
-        /* Synchronous answer */
-        if (0U == MCP_Over_UartA.pTransportLayer->fGetBuffer(MCP_Over_UartA.pTransportLayer,
-                                                     (void **) &MCP_Over_UartA.txBuffer, //cstat !MISRAC2012-Rule-11.3
-                                                     MCTL_SYNC))
-        {
-          /* No buffer available to build the answer ... should not occur */
-        }
-        else
-        {
-          MCP_ReceivedPacket(&MCP_Over_UartA);
-          MCP_Over_UartA.pTransportLayer->fSendPacket(MCP_Over_UartA.pTransportLayer, MCP_Over_UartA.txBuffer,
-                                                      MCP_Over_UartA.txLength, MCTL_SYNC);
-          /* No buffer available to build the answer ... should not occur */
-        }
-      }
-
-      /* USER CODE BEGIN MC_Scheduler 1 */
-
-      /* USER CODE END MC_Scheduler 1 */
-
-      hMFTaskCounterM1 = (uint16_t)MF_TASK_OCCURENCE_TICKS;
-    }
-    if(hBootCapDelayCounterM1 > 0U)
+#if (THR_INPUT_ENABLE == 1)
+  /* Throttle commands applied by the medium frequency task of the same period */
+  THR_Task(&ThrottleInputM1);
+#endif
+  TSK_MediumFrequencyTaskM1();
+#if (COGGING_COMP_ENABLE == 1)
+  COG_Task(&CoggingCompM1, (RUN == MCI_GetSTMState(&Mci[M1])));
+#endif
+#if ((THR_INPUT_ENABLE == 1) && (THR_DSHOT_TELEMETRY_ENABLE == 1))
+  {
+    /* Telemetry of the next bidirectional DShot replies, the bus current from the motor power */
+    uint16_t hVbus_d = VBS_GetAvBusVoltage_d(&(BusVoltageSensor_M1._Super));
+    uint16_t hVbus_V = VBS_GetAvBusVoltage_V(&(BusVoltageSensor_M1._Super));
+    float_t Power = PQD_GetAvrgElMotorPowerW(pMPM[M1]);
+    uint16_t hCurrent_A = ((hVbus_V > 0U) && (Power > 0.0f)) ? (uint16_t)(Power / (float_t)hVbus_V) : 0U;
+
+    THR_SetTelemetry(&ThrottleInputM1, SPD_GetAvrgMecSpeedUnit(MAIN_SPEED_SENSOR_M1), NTC_GetAvTemp_C(&TempSensor_M1),
+                     (uint16_t)(((uint32_t)hVbus_d * BusVoltageSensor_M1._Super.ConversionFactor) >> 14U), hCurrent_A);
+  }
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+  {
+    /* Telemetry of the drive in the units of the training logs, see ANOM_Feature_t */
+    bool bRunning = (RUN == MCI_GetSTMState(&Mci[M1]));
+    float_t fFeatures[ANOM_FEATURE_NBR];
+
+    fFeatures[ANOM_IQ] = (float_t)FOCVars[M1].Iqd.q;
+    fFeatures[ANOM_ID] = (float_t)FOCVars[M1].Iqd.d;
+    fFeatures[ANOM_VQ] = (float_t)FOCVars[M1].Vqd.q;
+    fFeatures[ANOM_SPEED_ERROR] = (float_t)((int32_t)MCI_GetMecSpeedRefUnit(&Mci[M1])
+                                  - (int32_t)SPD_GetAvrgMecSpeedUnit(MAIN_SPEED_SENSOR_M1))
+                                  * ((float_t)U_RPM / (float_t)SPEED_UNIT);
+    fFeatures[ANOM_VBUS] = (float_t)VBS_GetAvBusVoltage_d(&(BusVoltageSensor_M1._Super))
+                           * ((float_t)BusVoltageSensor_M1._Super.ConversionFactor / 65536.0f);
+    fFeatures[ANOM_TEMPERATURE] = (float_t)NTC_GetAvTemp_C(&TempSensor_M1);
+    ANOM_Accumulate(&AnomalyDetectorM1, fFeatures, bRunning);
+#if (ANOM_FAULT_ENABLE == 1)
+    if ((true == bRunning) && (true == ANOM_IsAnomaly(&AnomalyDetectorM1)))
     {
-      hBootCapDelayCounterM1--;
+      MCI_FaultProcessing(&Mci[M1], MC_SW_ERROR, 0);
     }
     else
     {
       /* Nothing to do */
     }
-    if(hStopPermanencyCounterM1 > 0U)
+#endif
+  }
+#endif
+
+  /* Applicative hook at end of Medium Frequency for Motor 1 */
+  MC_APP_PostMediumFrequencyHook_M1();
+}
+
+#if (NBR_OF_MOTORS > 1)
+/**
+  * @brief  Executes the Medium Frequency Tasks of motor 2 and its applicative hook.
+  */
+static void TSK_MediumFrequencyTasksM2(void)
+{
+  TSK_MediumFrequencyTaskM2();
+
+  /* Applicative hook at end of Medium Frequency for Motor 2 */
+  MC_APP_PostMediumFrequencyHook_M2();
+}
+#endif
+
+/**
+  * @brief  Processes the packets received by the Motor Control Protocol and sends the answers.
+  */
+__weak void TSK_MCPTask(void)
+{
+  MCP_Over_UartA.rxBuffer = MCP_Over_UartA.pTransportLayer->fRXPacketProcess(MCP_Over_UartA.pTransportLayer,
+                                                                            &MCP_Over_UartA.rxLength);
+  if ( 0U == MCP_Over_UartA.rxBuffer)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    /* Synchronous answer */
+    if (0U == MCP_Over_UartA.pTransportLayer->fGetBuffer(MCP_Over_UartA.pTransportLayer,
+                                                 (void **) &MCP_Over_UartA.txBuffer, //cstat !MISRAC2012-Rule-11.3
+                                                 MCTL_SYNC))
     {
-      hStopPermanencyCounterM1--;
+      /* No buffer available to build the answer ... should not occur */
     }
     else
     {
-      /* Nothing to do */
+      MCP_ReceivedPacket(&MCP_Over_UartA);
+      MCP_Over_UartA.pTransportLayer->fSendPacket(MCP_Over_UartA.pTransportLayer, MCP_Over_UartA.txBuffer,
+                                                  MCP_Over_UartA.txLength, MCTL_SYNC);
+      /* No buffer available to build the answer ... should not occur */
     }
-  /* USER CODE BEGIN MC_Scheduler 2 */
+  }
 
-  /* USER CODE END MC_Scheduler 2 */
+  /* USER CODE BEGIN MC_Scheduler 1 */
+
+  /* USER CODE END MC_Scheduler 1 */
+}
 
-    /* Safety task is run after Medium Frequency task so that
-     * it can overcome actions they initiated if needed */
-    TSK_SafetyTask();
+/**
+ * @brief Runs the Motor Control tasks that are not time critical.
+ *
+ * This function is to be called from the main loop: its tasks may take milliseconds, during
+ * which the interrupts keep running the control.
+ *
+ * - Parameter store: appends the parameter block to the flash on request.
+ * - Fault recorder: writes the record of the last fault to the flash.
+ * - Vibration monitor: analyses the spectrum of the last window of Iq.
+ * - Anomaly detector: runs the autoencoder on the last features averaged.
+ */
+__weak void MC_RunBackgroundTasks(void)
+{
+  if (0U == bMCBootCompleted)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    PST_BackgroundTask(&ParamStoreM1);
+    FLR_BackgroundTask(&FaultRecorderM1);
+#if (VIB_MONITOR_ENABLE == 1)
+    VIB_BackgroundTask(&VibMonitorM1);
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+    ANOM_BackgroundTask(&AnomalyDetectorM1);
+#endif
   }
 }
 
@@ -249,7 +477,7 @@ __weak void MC_RunMotorControlTasks(void)
   */
 __weak void TSK_SetChargeBootCapDelayM1(uint16_t hTickCount)
 {
-   hBootCapDelayCounterM1 = hTickCount;
+   wBootCapDelayEnd[M1] = SCHED_GetTick(&MCTaskScheduler) + hTickCount;
 }
 
 /**
@@ -261,7 +489,7 @@ __weak void TSK_SetChargeBootCapDelayM1(uint16_t hTickCount)
 __weak bool TSK_ChargeBootCapDelayHasElapsedM1(void)
 {
   bool retVal = false;
-  if (((uint16_t)0) == hBootCapDelayCounterM1)
+  if ((int32_t)(SCHED_GetTick(&MCTaskScheduler) - wBootCapDelayEnd[M1]) >= 0)
   {
     retVal = true;
   }
@@ -276,7 +504,7 @@ __weak bool TSK_ChargeBootCapDelayHasElapsedM1(void)
   */
 __weak void TSK_SetStopPermanencyTimeM1(uint16_t hTickCount)
 {
-  hStopPermanencyCounterM1 = hTickCount;
+  wStopPermanencyEnd[M1] = SCHED_GetTick(&MCTaskScheduler) + hTickCount;
 }
 
 /**
@@ -288,13 +516,83 @@ __weak void TSK_SetStopPermanencyTimeM1(uint16_t hTickCount)
 __weak bool TSK_StopPermanencyTimeHasElapsedM1(void)
 {
   bool retVal = false;
-  if (((uint16_t)0) == hStopPermanencyCounterM1)
+  if ((int32_t)(SCHED_GetTick(&MCTaskScheduler) - wStopPermanencyEnd[M1]) >= 0)
+  {
+    retVal = true;
+  }
+  return (retVal);
+}
+
+#if (NBR_OF_MOTORS > 1)
+/**
+  * @brief  It set a counter intended to be used for counting the delay required
+  *         for drivers boot capacitors charging of motor 2.
+  * @param  hTickCount number of ticks to be counted.
+  * @retval void
+  */
+__weak void TSK_SetChargeBootCapDelayM2(uint16_t hTickCount)
+{
+   wBootCapDelayEnd[M2] = SCHED_GetTick(&MCTaskScheduler) + hTickCount;
+}
+
+/**
+  * @brief  Use this function to know whether the time required to charge boot
+  *         capacitors of motor 2 has elapsed.
+  * @param  none
+  * @retval bool true if time has elapsed, false otherwise.
+  */
+__weak bool TSK_ChargeBootCapDelayHasElapsedM2(void)
+{
+  bool retVal = false;
+  if ((int32_t)(SCHED_GetTick(&MCTaskScheduler) - wBootCapDelayEnd[M2]) >= 0)
+  {
+    retVal = true;
+  }
+  return (retVal);
+}
+
+/**
+  * @brief  It set a counter intended to be used for counting the permanency
+  *         time in STOP state of motor 2.
+  * @param  SysTickCount number of ticks to be counted.
+  * @retval void
+  */
+__weak void TSK_SetStopPermanencyTimeM2(uint16_t SysTickCount)
+{
+  wStopPermanencyEnd[M2] = SCHED_GetTick(&MCTaskScheduler) + SysTickCount;
+}
+
+/**
+  * @brief  Use this function to know whether the permanency time in STOP state
+  *         of motor 2 has elapsed.
+  * @param  none
+  * @retval bool true if time is elapsed, false otherwise.
+  */
+__weak bool TSK_StopPermanencyTimeHasElapsedM2(void)
+{
+  bool retVal = false;
+  if ((int32_t)(SCHED_GetTick(&MCTaskScheduler) - wStopPermanencyEnd[M2]) >= 0)
   {
     retVal = true;
   }
   return (retVal);
 }
 
+/**
+  * @brief  Reserves the FOC execution of a motor on the next ADC interrupt.
+  *
+  * This function is to be called on the update interrupt of the PWM timer of the motor, half a
+  * PWM period before the end of its current conversions.
+  * @param  Motor Motor reference number defined
+  *         \link Motors_reference_number here \endlink.
+  */
+__weak void TSK_DualDriveFIFOUpdate(uint8_t Motor)
+{
+  FOC_array[FOC_array_tail] = Motor;
+  FOC_array_tail = (FOC_array_tail + 1U) % FOC_ARRAY_LENGTH;
+}
+#endif
+
 #if defined (CCMRAM)
 #if defined (__ICCARM__)
 #pragma location = ".ccmram"
@@ -309,29 +607,45 @@ __attribute__((section (".ccmram")))
   *  This is mainly the FOC current control loop. It is executed depending on the state of the Motor Control
   * subsystem (see the state machine(s)).
   *
+  * With two motors, the motor is the one reserved by the oldest timer update. The fault recorder,
+  * the timestamp and the MCP data log run at the rate of motor 1.
+  *
   * @retval Number of the  motor instance which FOC loop was executed.
   */
 __weak uint8_t TSK_HighFrequencyTask(void)
 {
   uint8_t bMotorNbr;
-  bMotorNbr = 0;
+#if (NBR_OF_MOTORS > 1)
+  bMotorNbr = FOC_array[FOC_array_head];
+  FOC_array_head = (FOC_array_head + 1U) % FOC_ARRAY_LENGTH;
+#else
+  bMotorNbr = M1;
+#endif
 
   /* USER CODE BEGIN HighFrequencyTask 0 */
 
   /* USER CODE END HighFrequencyTask 0 */
-  FOC_HighFrequencyTask(bMotorNbr);
+  (void)FOC_HighFrequencyTask(bMotorNbr);
 
   /* USER CODE BEGIN HighFrequencyTask 1 */
 
   /* USER CODE END HighFrequencyTask 1 */
-  GLOBAL_TIMESTAMP++;
-  if (0U == MCPA_UART_A.Mark)
+  if (M1 == bMotorNbr)
   {
-    /* Nothing to do */
+    FLR_Sample(&FaultRecorderM1, GLOBAL_TIMESTAMP);
+    GLOBAL_TIMESTAMP++;
+    if (0U == MCPA_UART_A.Mark)
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      MCPA_dataLog (&MCPA_UART_A);
+    }
   }
   else
   {
-    MCPA_dataLog (&MCPA_UART_A);
+    /* Nothing to do */
   }
 
   return (bMotorNbr);
@@ -350,7 +664,12 @@ __weak void TSK_SafetyTask(void)
   /* USER CODE END TSK_SafetyTask 0 */
   if (1U == bMCBootCompleted)
   {
-    TSK_SafetyTask_PWMOFF(M1);
+    uint8_t bMotor;
+
+    for (bMotor = M1; bMotor < (uint8_t)NBR_OF_MOTORS; bMotor++)
+    {
+      TSK_SafetyTask_PWMOFF(bMotor);
+    }
   /* USER CODE BEGIN TSK_SafetyTask 1 */
 
   /* USER CODE END TSK_SafetyTask 1 */
@@ -372,32 +691,22 @@ __weak void TSK_SafetyTask_PWMOFF(uint8_t bMotor)
 
   /* USER CODE END TSK_SafetyTask_PWMOFF 0 */
   uint16_t CodeReturn = MC_NO_ERROR;
-  uint8_t lbmotor = M1;
+#if (NBR_OF_MOTORS > 1)
+  const uint16_t errMask[NBR_OF_MOTORS] = {VBUS_TEMP_ERR_MASK, VBUS_TEMP_ERR_MASK2};
+#else
   const uint16_t errMask[NBR_OF_MOTORS] = {VBUS_TEMP_ERR_MASK};
+#endif
+  uint16_t rawValue;
+
   /* Check for fault if FW protection is activated. It returns MC_OVER_TEMP or MC_NO_ERROR */
-  if (M1 == bMotor)
-  {
-    uint16_t rawValueM1 = RCM_GetRegularConv(&TempRegConv_M1);
-    CodeReturn |= errMask[bMotor] & NTC_CalcAvTemp(&TempSensor_M1, rawValueM1);
-  }
-  else
-  {
-    /* Nothing to do */
-  }
+  rawValue = RCM_GetRegularConv(pTempRegConv[bMotor]);
+  CodeReturn |= errMask[bMotor] & NTC_CalcAvTemp(pTemperatureSensor[bMotor], rawValue);
 
-/* Due to warning array subscript 1 is above array bounds of PWMC_Handle_t *[1] [-Warray-bounds] */
-   CodeReturn |= PWMC_IsFaultOccurred(pwmcHandle[lbmotor]);     /* check for fault. It return MC_OVER_CURR or MC_NO_FAULTS
+  CodeReturn |= PWMC_IsFaultOccurred(pwmcHandle[bMotor]);     /* check for fault. It return MC_OVER_CURR or MC_NO_FAULTS
                                                      (for STM32F30x can return MC_OVER_VOLT in case of HW Overvoltage) */
 
-  if (M1 == bMotor)
-  {
-    uint16_t rawValueM1 =  RCM_GetRegularConv(&VbusRegConv_M1);
-    CodeReturn |= errMask[bMotor] & RVBS_CalcAvVbus(&BusVoltageSensor_M1, rawValueM1);
-  }
-  else
-  {
-    /* Nothing to do */
-  }
+  rawValue = RCM_GetRegularConv(pVbusRegConv[bMotor]);
+  CodeReturn |= errMask[bMotor] & RVBS_CalcAvVbus(pBusSensor[bMotor], rawValue);
   MCI_FaultProcessing(&Mci[bMotor], CodeReturn, ~CodeReturn); /* Process faults */
 
   if (MCI_GetFaultState(&Mci[bMotor]) != (uint32_t)MC_NO_FAULTS)
@@ -429,8 +738,13 @@ __weak void TSK_HardwareFaultTask(void)
   /* USER CODE BEGIN TSK_HardwareFaultTask 0 */
 
   /* USER CODE END TSK_HardwareFaultTask 0 */
-   FOC_Clear(M1);
-  MCI_FaultProcessing(&Mci[M1], MC_SW_ERROR, 0);
+  uint8_t bMotor;
+
+  for (bMotor = M1; bMotor < (uint8_t)NBR_OF_MOTORS; bMotor++)
+  {
+    FOC_Clear(bMotor);
+    MCI_FaultProcessing(&Mci[bMotor], MC_SW_ERROR, 0);
+  }
 
   /* USER CODE BEGIN TSK_HardwareFaultTask 1 */
 
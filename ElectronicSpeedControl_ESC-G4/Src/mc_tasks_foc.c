@@ -34,6 +34,7 @@
 #include "parameters_conversion.h"
 #include "mcp_config.h"
 #include "mc_app_hooks.h"
+#include "foc_pipeline.h"
 
 /* USER CODE BEGIN Includes */
 
@@ -41,6 +42,28 @@
 
 /* USER CODE BEGIN Private define */
 /* Private define ------------------------------------------------------------*/
+#if (NBR_OF_MOTORS > 1)
+/* The drive has a single power stage: the tasks are indexed by motor, but the FOC, the Medium
+   Frequency task, the handles and the PWM timer interrupt of motor 2 come with its power stage */
+#error "NBR_OF_MOTORS > 1: the FOC and Medium Frequency tasks of motor 2 are not implemented"
+#endif
+
+#if (FOC_PIPELINE_ENABLE == 1)
+#define FOC_CURR_PI    FOCP_PI
+#else
+#define FOC_CURR_PI    PI_Controller
+#endif
+
+#if (HFI_STARTUP_ENABLE == 1) && (POLPULSE_ENABLE == 0)
+#error "HFI_STARTUP_ENABLE starts from the rotor position detected by POLPULSE_ENABLE"
+#endif
+
+/* Stator resistance the observer is tuned for */
+#if (SELF_COMMISSIONING_ENABLE == 1)
+#define FOC_RS_APPLIED_M1    SCC_M1.fRSApplied
+#else
+#define FOC_RS_APPLIED_M1    ((float_t)RS)
+#endif
 
 /* USER CODE END Private define */
 
@@ -54,6 +77,10 @@ static volatile uint16_t hStopPermanencyCounterM1 = ((uint16_t)0);
 #define M2_CHARGE_BOOT_CAP_TICKS         (((uint16_t)SYS_TICK_FREQUENCY * (uint16_t)10) / 1000U)
 #define M2_CHARGE_BOOT_CAP_DUTY_CYCLES (uint32_t)(0 * ((uint32_t)PWM_PERIOD_CYCLES2 / 2U))
 
+#if ((VBUS_COMPENSATION_ENABLE == 1) || (REGEN_LIMITER_ENABLE == 1))
+static uint16_t hVbusSampleM1 = NOMINAL_BUS_VOLTAGE_d; /* Bus voltage of the current period, unfiltered */
+#endif
+
 /* USER CODE BEGIN Private Variables */
 
 /* USER CODE END Private Variables */
@@ -65,7 +92,19 @@ void FOC_CalcCurrRef(uint8_t bMotor);
 void TSK_MF_StopProcessing(uint8_t motor);
 
 MCI_Handle_t *GetMCI(uint8_t bMotor);
+static void FOC_HighFrequencyTaskM1(void);
+#if (NBR_OF_MOTORS > 1)
+void FOC_HighFrequencyTaskM2(void);
+#endif
 static uint16_t FOC_CurrControllerM1(void);
+static void FOC_UpdateObserverGainsM1(void);
+static bool FOC_IsObserverTrackingM1(int16_t hForcedMecSpeedUnit);
+#if (POLPULSE_ENABLE == 1)
+static uint16_t FOC_PolPulseM1(void);
+#endif
+#if (RS_ESTIMATION_ENABLE == 1)
+static void FOC_UpdateStatorResistanceM1(void);
+#endif
 
 void TSK_SafetyTask_PWMOFF(uint8_t motor);
 
@@ -113,6 +152,40 @@ __weak void FOC_Init(void)
     /**************************************/
     RUC_Init(&RevUpControlM1, pSTC[M1], &VirtualSpeedSensorM1, &STO_M1, pwmcHandle[M1]);
 
+    FIXPMATH_init();
+#if (POLPULSE_ENABLE == 1)
+
+    /*******************************************************************/
+    /*   Initial position detection component initialization          */
+    /*******************************************************************/
+    (void)POLPULSE_init(&PolPulseM1, sizeof(PolPulseM1));
+    POLPULSE_setParams(&PolPulseM1, &PolPulseParamsM1);
+#endif
+
+#if (HFI_STARTUP_ENABLE == 1)
+    /*********************************************************/
+    /*   Low speed speed sensor component initialization     */
+    /*********************************************************/
+    HFI_Init(&HFI_M1);
+#endif
+#if (HSO_MAIN_SENSOR == 1)
+
+    /*********************************************************/
+    /*   Flux observer speed sensor initialization           */
+    /*********************************************************/
+    HSO_SPD_Init(&HSO_M1);
+#endif
+
+    /*********************************************************/
+    /*   Stator resistance estimation initialization         */
+    /*********************************************************/
+    (void)RSTEMP_init(&RSTempM1, sizeof(RSTempM1));
+    RSTEMP_setParams(&RSTempM1, &RSTempParamsM1);
+    RSTEMP_setFreqXY_Hz(&RSTempM1, (float_t)RS_EST_INJECTION_FREQ_HZ);
+    RSTEMP_setIref_A(&RSTempM1, (float_t)RS_EST_INJECTION_CURRENT_A);
+    RSTEMP_setBandwidth(&RSTempM1, (float_t)RS_EST_BANDWIDTH_RPS);
+    RSTEMP_setFlagEnable(&RSTempM1, (RS_ESTIMATION_ENABLE == 1));
+
     /********************************************************/
     /*   PID component initialization: current regulation   */
     /********************************************************/
@@ -128,6 +201,37 @@ __weak void FOC_Init(void)
     pREMNG[M1] = &RampExtMngrHFParamsM1;
     REMNG_Init(pREMNG[M1]);
 
+    /*******************************************************/
+    /*   Self commissioning component initialization       */
+    /*******************************************************/
+#if (SELF_COMMISSIONING_ENABLE == 1)
+    SCC_Init(&SCC_M1);
+    OTT_Init(&OTT_M1);
+#endif
+    PST_Init(&ParamStoreM1);
+    FLR_Init(&FaultRecorderM1);
+#if (REGEN_LIMITER_ENABLE == 1)
+    REGEN_Init(&RegenLimiterM1);
+#endif
+#if (SPD_FILTER_ENABLE == 1)
+    SPDFLT_Init(&SpeedFilterM1);
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+    LTO_Init(&LoadObserverM1);
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+    DBC_Init(&DeadbeatCurrM1);
+#endif
+#if (COGGING_COMP_ENABLE == 1)
+    COG_Init(&CoggingCompM1);
+#endif
+#if (VIB_MONITOR_ENABLE == 1)
+    VIB_Init(&VibMonitorM1);
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+    ANOM_Init(&AnomalyDetectorM1);
+#endif
+
     FOC_Clear(M1);
     FOCVars[M1].bDriveInput = EXTERNAL;
     FOCVars[M1].Iqdref = STC_GetDefaultIqdref(pSTC[M1]);
@@ -141,6 +245,121 @@ __weak void FOC_Init(void)
     /* USER CODE END MCboot 2 */
 }
 
+/**
+  * @brief  Applies the STO observer and PLL gains scheduled at the present speed of Motor 1.
+  *
+  *  Speed is taken from the sensor in use by the speed and torque controller, that is the
+  * virtual speed sensor during rev-up and the observer itself in closed loop. This function
+  * shall be called only during medium frequency task.
+  */
+static void FOC_UpdateObserverGainsM1(void)
+{
+  STO_PLL_GainSchedPoint_t Gains;
+
+  STO_PLL_CalcScheduledGains(&STO_PLL_M1, SPD_GetAvrgMecSpeedUnit(STC_GetSpeedSensor(pSTC[M1])), &Gains);
+
+  /* Enter critical section */
+  /* Disable interrupts so that the HF task never runs the observer with a mix of old and new gains */
+  __disable_irq();
+  STO_PLL_SetObserverGains(&STO_PLL_M1, Gains.hC2, Gains.hC4);
+  STO_SetPLLGains(&STO_PLL_M1, Gains.hPLLKpGain, Gains.hPLLKiGain);
+
+  /* Exit critical section */
+  __enable_irq();
+}
+
+#if (RS_ESTIMATION_ENABLE == 1)
+/**
+  * @brief  Runs the background of the stator resistance estimation of Motor 1 and applies its result to the
+  *         observers.
+  *
+  *  The low frequency injection is active in RUN only, under a load current of at least its amplitude, and not
+  * while the high frequency injection tracks the rotor. The last estimate is kept when the motor stops, the winding cools down slowly. This function shall be
+  * called only during medium frequency task.
+  */
+static void FOC_UpdateStatorResistanceM1(void)
+{
+  int16_t hIqref = FOCVars[M1].Iqdref.q;
+  /* The dead time error follows the signs of the phase currents, the noise flips them near zero */
+  bool bOKtoGo = (RUN == Mci[M1].State) && ((hIqref >= RS_EST_MIN_LOAD_S16) || (hIqref <= -RS_EST_MIN_LOAD_S16));
+
+#if (HFI_STARTUP_ENABLE == 1)
+  if ((&HFI_M1._Super == STC_GetSpeedSensor(pSTC[M1])) && (true == HFI_IsInjecting(&HFI_M1)))
+  {
+    bOKtoGo = false; /* Both inject on the d axis */
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
+  RSTEMP_runBackground(&RSTempM1, (float_t)FOC_RS_APPLIED_M1, bOKtoGo);
+
+  if (true == RSTEMP_getFlagUpdateEnable(&RSTempM1))
+  {
+    float_t Rs = RSTEMP_getRsOhm(&RSTempM1);
+
+    /* Enter critical section */
+    /* Disable interrupts so that the HF task never runs the observer with C1 and C2 out of step */
+    __disable_irq();
+    STO_PLL_SetStatorResistanceGain(&STO_PLL_M1, (int16_t)(((float_t)STO_PLL_M1.hC1Rated * Rs) / FOC_RS_APPLIED_M1));
+
+    /* Exit critical section */
+    __enable_irq();
+#if (HSO_MAIN_SENSOR == 1)
+    HSO_SPD_SetRs(&HSO_M1, Rs);
+#endif
+  }
+  else
+  {
+    /* Nothing to do, the observers keep the rated resistance */
+  }
+}
+#endif
+
+/**
+  * @brief  Checks that the STO observer of Motor 1 sees the Bemf of a turning rotor during the rev-up.
+  *
+  *  The observed Bemf must be consistent with the observed speed within #REVUP_BEMF_CONSISTENCY_TOL,
+  * tighter than the tolerance of the speed reliability: the observer of a stalled rotor follows the
+  * forced current at the forced speed, without any Bemf.
+  * @retval bool true if the observed Bemf matches the observed speed.
+  */
+static bool FOC_IsRotorObservedM1(void)
+{
+  return (STO_PLL_IsBemfConsistentWithin(&STO_PLL_M1, REVUP_BEMF_CONSISTENCY_TOL));
+}
+
+/**
+  * @brief  Checks that the STO observer of Motor 1 tracks the rotor forced by the rev-up.
+  *
+  *  The observed speed must have a tight variance and be consistent with the observed Bemf, and the
+  * forced current must still drive the rotor: the angle of the virtual speed sensor lies behind the
+  * observed one, by less than half a turn. The forced rotor swings about its load angle, its speed
+  * does not follow the forced one closely at low inertia.
+  * @param  hForcedMecSpeedUnit Mechanical speed imposed by the virtual speed sensor.
+  * @retval bool true if the observer tracks the rotor.
+  */
+static bool FOC_IsObserverTrackingM1(int16_t hForcedMecSpeedUnit)
+{
+  bool bTracking = false;
+  int16_t hDirection = MCI_GetImposedMotorDirection(&Mci[M1]);
+  int32_t wForced = (int32_t)hForcedMecSpeedUnit * hDirection;
+
+  if ((true == STO_PLL_IsVarianceTight(&STO_M1)) && (true == FOC_IsRotorObservedM1()) && (wForced > 0))
+  {
+    /* Load angle of the forced current, negative while it drives the rotor in the positive direction */
+    int16_t hLoadAngle = (int16_t)(SPD_GetElAngle(&VirtualSpeedSensorM1._Super) - SPD_GetElAngle(&STO_PLL_M1._Super));
+
+    bTracking = (hDirection > 0) ? (hLoadAngle < 0) : (hLoadAngle > 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bTracking);
+}
+
 /**
  * @brief Performs stop process and update the state machine.This function
  *        shall be called only during medium frequency task.
@@ -151,7 +370,18 @@ void TSK_MF_StopProcessing(uint8_t motor)
 
   FOC_Clear(motor);
 
+#if (NBR_OF_MOTORS > 1)
+  if (M1 == motor)
+  {
+    TSK_SetStopPermanencyTimeM1(STOPPERMANENCY_TICKS);
+  }
+  else
+  {
+    TSK_SetStopPermanencyTimeM2(STOPPERMANENCY_TICKS2);
+  }
+#else
   TSK_SetStopPermanencyTimeM1(STOPPERMANENCY_TICKS);
+#endif
   Mci[motor].State = STOP;
 }
 
@@ -171,7 +401,45 @@ __weak void TSK_MediumFrequencyTaskM1(void)
 
   int16_t wAux = 0;
   (void)STO_PLL_CalcAvrgMecSpeedUnit(&STO_PLL_M1, &wAux);
+#if (HSO_MAIN_SENSOR == 1)
+  (void)HSO_SPD_CalcAvrgMecSpeedUnit(&HSO_M1, &wAux);
+#endif
+#if (HFI_STARTUP_ENABLE == 1)
+  if (&HFI_M1._Super == STC_GetSpeedSensor(pSTC[M1]))
+  {
+    (void)HFI_CalcAvrgMecSpeedUnit(&HFI_M1, &wAux);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
   PQD_CalcElMotorPower(pMPM[M1]);
+#if (RS_ESTIMATION_ENABLE == 1)
+  FOC_UpdateStatorResistanceM1();
+#endif
+
+  if ((OTF_DETECTION == Mci[M1].State) || (START == Mci[M1].State) || (SWITCH_OVER == Mci[M1].State)
+      || (RUN == Mci[M1].State) || (PROFILE == Mci[M1].State))
+  {
+    FOC_UpdateObserverGainsM1();
+  }
+  else
+  {
+    /* Nothing to do, observer is not running */
+  }
+
+#if (SELF_COMMISSIONING_ENABLE == 1)
+  if ((MCI_GetOccurredFaults(&Mci[M1]) != MC_NO_FAULTS) && (true == SCC_IsOngoing(&SCC_M1)))
+  {
+    /* The self commissioning is aborted, the parameters already applied are kept */
+    SCC_Stop(&SCC_M1);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
 
   if (MCI_GetCurrentFaults(&Mci[M1]) == MC_NO_FAULTS)
   {
@@ -184,7 +452,26 @@ __weak void TSK_MediumFrequencyTaskM1(void)
         {
           if ((MCI_START == Mci[M1].DirectCommand) || (MCI_MEASURE_OFFSETS == Mci[M1].DirectCommand))
           {
-              RUC_Clear(&RevUpControlM1, MCI_GetImposedMotorDirection(&Mci[M1]));
+            RUC_Clear(&RevUpControlM1, MCI_GetImposedMotorDirection(&Mci[M1]));
+            if ((false == pwmcHandle[M1]->offsetCalibStatus) && (MCI_START == Mci[M1].DirectCommand))
+            {
+              PolarizationOffsets_t Offsets;
+
+              /* Offsets measured at about the present temperature: the calibration is skipped */
+              if (true == PST_GetOffsets(&ParamStoreM1, NTC_GetAvTemp_C(&TempSensor_M1), &Offsets))
+              {
+                PWMC_SetOffsetCalib(pwmcHandle[M1], &Offsets);
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+
             if (pwmcHandle[M1]->offsetCalibStatus == false)
             {
               (void)PWMC_CurrentReadingCalibr(pwmcHandle[M1], CRC_START);
@@ -218,6 +505,10 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           {
             if (PWMC_CurrentReadingCalibr(pwmcHandle[M1], CRC_EXEC))
             {
+              PolarizationOffsets_t Offsets;
+
+              PWMC_GetOffsetCalib(pwmcHandle[M1], &Offsets);
+              PST_SetOffsets(&ParamStoreM1, &Offsets, NTC_GetAvTemp_C(&TempSensor_M1));
               if (MCI_MEASURE_OFFSETS == Mci[M1].DirectCommand)
               {
                 FOC_Clear(M1);
@@ -249,15 +540,53 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           {
             if (TSK_ChargeBootCapDelayHasElapsedM1())
             {
+#if (SELF_COMMISSIONING_ENABLE == 1)
+              bool bProfiling = SCC_IsOngoing(&SCC_M1);
+#else
+              bool bProfiling = false;
+#endif
+
               R3_2_SwitchOffPWM(pwmcHandle[M1]);
               FOCVars[M1].bDriveInput = EXTERNAL;
-              STC_SetSpeedSensor( pSTC[M1], &VirtualSpeedSensorM1._Super );
+              if (true == bProfiling)
+              {
+                /* The rotor is first held by the self commissioning, then dragged by the virtual speed sensor */
+                STC_SetSpeedSensor(pSTC[M1], &VirtualSpeedSensorM1._Super);
+              }
+              else if (true == RevUpControlM1.OTFStartupEnabled)
+              {
+                /* The rotor may already be spinning: observe it with null currents before any rev-up */
+                STC_SetSpeedSensor(pSTC[M1], &STO_PLL_M1._Super);
+              }
+              else
+              {
+                STC_SetSpeedSensor( pSTC[M1], &VirtualSpeedSensorM1._Super );
+              }
 
               STO_PLL_Clear(&STO_PLL_M1);
+              FOC_UpdateObserverGainsM1();
 
               FOC_Clear( M1 );
 
+              if (true == bProfiling)
+              {
+                Mci[M1].State = PROFILE;
+              }
+              else if (true == RevUpControlM1.OTFStartupEnabled)
+              {
+                STO_SetDirection(&STO_PLL_M1, 0);
+                RUC_OTF_StartDetection(&RevUpControlM1);
+                Mci[M1].State = OTF_DETECTION;
+              }
+              else
+              {
+#if (POLPULSE_ENABLE == 1)
+                POLPULSE_trigger(&PolPulseM1);
+                Mci[M1].State = ALIGNMENT;
+#else
                 Mci[M1].State = START;
+#endif
+              }
               PWMC_SwitchOnPWM(pwmcHandle[M1]);
             }
             else
@@ -268,6 +597,124 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           break;
         }
 
+        case OTF_DETECTION:
+        {
+          if (MCI_STOP == Mci[M1].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M1);
+          }
+          else
+          {
+            /* Iqd references are kept null by FOC_Clear: the current loop only compensates the Bemf */
+            RUC_OTF_Status_t OTFStatus = RUC_OTF_Detect(&RevUpControlM1);
+
+            if (RUC_OTF_CAUGHT == OTFStatus)
+            {
+              int16_t hObsMecSpeedUnit = SPD_GetAvrgMecSpeedUnit(&STO_PLL_M1._Super);
+
+              /* Latch the forced convergence and lock the observer on the imposed direction */
+              (void)STO_PLL_IsObserverConverged(&STO_PLL_M1, &hObsMecSpeedUnit);
+              STO_SetDirection(&STO_PLL_M1, (int8_t)MCI_GetImposedMotorDirection(&Mci[M1]));
+
+              /* Rotor is spinning in the right direction: enter the closed loop straight away, from null torque */
+              STC_SetSpeedSensor(pSTC[M1], MAIN_SPEED_SENSOR_M1);
+              PID_SetIntegralTerm(&PIDSpeedHandle_M1, 0);
+              FOC_InitAdditionalMethods(M1);
+              FOC_CalcCurrRef(M1);
+              STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
+              MCI_ExecBufferedCommands(&Mci[M1]); /* Exec the speed ramp after changing of the speed sensor */
+              Mci[M1].State = RUN;
+            }
+            else if (RUC_OTF_NOT_CAUGHT == OTFStatus)
+            {
+              /* Rotor at standstill, too slow or reverse: fall back to the programmed rev-up,
+                 from the rotor position detected by pulse injection when enabled */
+              RUC_Clear(&RevUpControlM1, MCI_GetImposedMotorDirection(&Mci[M1]));
+              STC_SetSpeedSensor(pSTC[M1], &VirtualSpeedSensorM1._Super);
+              STO_PLL_Clear(&STO_PLL_M1);
+              FOC_UpdateObserverGainsM1();
+              FOC_Clear(M1);
+#if (POLPULSE_ENABLE == 1)
+              POLPULSE_trigger(&PolPulseM1);
+              Mci[M1].State = ALIGNMENT;
+#else
+              Mci[M1].State = START;
+#endif
+              PWMC_SwitchOnPWM(pwmcHandle[M1]);
+            }
+            else
+            {
+              /* Nothing to be done, FW waits for the end of the detection window */
+            }
+          }
+          break;
+        }
+
+#if (POLPULSE_ENABLE == 1)
+        case ALIGNMENT:
+        {
+          if (MCI_STOP == Mci[M1].DirectCommand)
+          {
+            POLPULSE_stopPulse(&PolPulseM1);
+            TSK_MF_StopProcessing(M1);
+          }
+          else
+          {
+            /* Bus voltage in per unit of its full scale and its inverse, floored to stay in the fixp_t range */
+            uint16_t hVbus_d = VBS_GetAvBusVoltage_d(&(BusVoltageSensor_M1._Super));
+            fixp_t wOneOverVbus = (fixp_t)((((int64_t)1) << (FIXP_FMT + 16)) / ((hVbus_d > 512U) ? hVbus_d : 512U));
+
+            POLPULSE_runBackground(&PolPulseM1, wOneOverVbus, ((fixp30_t)hVbus_d) << 14);
+
+            if ((POLPULSE_STATE_PostcalcsComplete == POLPULSE_getState(&PolPulseM1))
+                && (false == POLPULSE_getFlagAngleValid(&PolPulseM1)))
+            {
+              /* Poles not told apart: the programmed rev-up aligns the rotor */
+              POLPULSE_resetState(&PolPulseM1);
+              FOC_Clear(M1);
+              Mci[M1].State = START;
+              PWMC_SwitchOnPWM(pwmcHandle[M1]);
+            }
+            else if (POLPULSE_STATE_PostcalcsComplete == POLPULSE_getState(&PolPulseM1))
+            {
+              /* Direction of the d axis in the alpha beta plane, per unit, to the electrical angle in s16degree:
+                 MCM_Park puts the d axis at (sin, cos) of the electrical angle, a quarter turn minus the direction */
+              int16_t hElAngle = (int16_t)(16384 - (POLPULSE_getAngleEstimated(&PolPulseM1) >> 14));
+
+              POLPULSE_resetState(&PolPulseM1);
+              FOC_Clear(M1);
+              STO_PLL_SetMecAngle(&STO_PLL_M1, hElAngle / (int16_t)STO_PLL_M1._Super.bElToMecRatio);
+#if (HSO_MAIN_SENSOR == 1)
+              HSO_SPD_SetMecAngle(&HSO_M1, hElAngle / (int16_t)HSO_M1._Super.bElToMecRatio);
+#endif
+
+#if (HFI_STARTUP_ENABLE == 1)
+              /* Closed loop from standstill on the saliency, the State Observer is blended in with speed */
+              HFI_Clear(&HFI_M1);
+              HFI_SetMecAngle(&HFI_M1, hElAngle / (int16_t)HFI_M1._Super.bElToMecRatio);
+              STC_SetSpeedSensor(pSTC[M1], &HFI_M1._Super);
+              PID_SetIntegralTerm(&PIDSpeedHandle_M1, 0);
+              FOC_InitAdditionalMethods(M1);
+              FOC_CalcCurrRef(M1);
+              STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
+              MCI_ExecBufferedCommands(&Mci[M1]); /* Exec the speed ramp after changing of the speed sensor */
+              Mci[M1].State = RUN;
+#else
+              /* Rev-up from the detected position, without alignment */
+              RUC_SetStartingElAngle(&RevUpControlM1, hElAngle);
+              Mci[M1].State = START;
+#endif
+              PWMC_SwitchOnPWM(pwmcHandle[M1]);
+            }
+            else
+            {
+              /* Nothing to be done, FW waits for the end of the pulse sequence */
+            }
+          }
+          break;
+        }
+#endif
+
         case START:
         {
           if (MCI_STOP == Mci[M1].DirectCommand)
@@ -299,10 +746,16 @@ __weak void TSK_MediumFrequencyTaskM1(void)
 
             (void)VSS_CalcAvrgMecSpeedUnit(&VirtualSpeedSensorM1, &hForcedMecSpeedUnit);
 
+            /* Accelerate as fast as the observer keeps track of the rotor, a stalled rotor has no Bemf */
+            RUC_AdaptAcceleration(&RevUpControlM1, FOC_IsObserverTrackingM1(hForcedMecSpeedUnit),
+                                  FOC_IsRotorObservedM1());
+
             /* Check that startup stage where the observer has to be used has been reached */
             if (true == RUC_FirstAccelerationStageReached(&RevUpControlM1))
             {
-              ObserverConverged = STO_PLL_IsObserverConverged(&STO_PLL_M1, &hForcedMecSpeedUnit);
+              /* The adaptive rev-up may stall the rotor, whose observer follows the forced speed without any Bemf */
+              ObserverConverged = STO_PLL_IsObserverConverged(&STO_PLL_M1, &hForcedMecSpeedUnit)
+                               && ((false == RevUpControlM1.AdaptiveEnabled) || (true == FOC_IsRotorObservedM1()));
               STO_SetDirection(&STO_PLL_M1, (int8_t)MCI_GetImposedMotorDirection(&Mci[M1]));
 
               (void)VSS_SetStartTransition(&VirtualSpeedSensorM1, ObserverConverged);
@@ -313,7 +766,7 @@ __weak void TSK_MediumFrequencyTaskM1(void)
             }
             if (ObserverConverged)
             {
-              qd_t StatorCurrent = MCM_Park(FOCVars[M1].Ialphabeta, SPD_GetElAngle(&STO_PLL_M1._Super));
+              qd_t StatorCurrent = MCM_Park(FOCVars[M1].Ialphabeta, SPD_GetElAngle(MAIN_SPEED_SENSOR_M1));
 
               /* Start switch over ramp. This ramp will transition from the revup to the closed loop FOC */
               REMNG_Init(pREMNG[M1]);
@@ -357,7 +810,7 @@ __weak void TSK_MediumFrequencyTaskM1(void)
               /* USER CODE BEGIN MediumFrequencyTask M1 1 */
 
               /* USER CODE END MediumFrequencyTask M1 1 */
-              STC_SetSpeedSensor(pSTC[M1], &STO_PLL_M1._Super); /* Observer has converged */
+              STC_SetSpeedSensor(pSTC[M1], MAIN_SPEED_SENSOR_M1); /* Observer has converged */
               FOC_InitAdditionalMethods(M1);
               FOC_CalcCurrRef(M1);
               STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
@@ -388,7 +841,7 @@ __weak void TSK_MediumFrequencyTaskM1(void)
             MCI_ExecBufferedCommands(&Mci[M1]);
 
               FOC_CalcCurrRef(M1);
-              if(!SPD_Check((SpeednPosFdbk_Handle_t *)&STO_PLL_M1))
+              if(!SPD_Check(STC_GetSpeedSensor(pSTC[M1])))
               {
                 MCI_FaultProcessing(&Mci[M1], MC_SPEED_FDBK, 0);
               }
@@ -400,6 +853,33 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           break;
         }
 
+#if (SELF_COMMISSIONING_ENABLE == 1)
+        case PROFILE:
+        {
+          if (MCI_STOP == Mci[M1].DirectCommand)
+          {
+            SCC_Stop(&SCC_M1);
+            if ((uint8_t)SCC_CALIBRATION_END == SCC_GetState(&SCC_M1))
+            {
+              /* Complete run: the measured model and the tuned drive are kept for the next boots */
+              PST_Capture(&ParamStoreM1);
+              PST_RequestCommit(&ParamStoreM1);
+            }
+            else
+            {
+              /* Nothing to do, aborted */
+            }
+            TSK_MF_StopProcessing(M1);
+          }
+          else
+          {
+            SCC_MF(&SCC_M1);
+            FOC_CalcCurrRef(M1);
+          }
+          break;
+        }
+#endif
+
         case STOP:
         {
           if (TSK_StopPermanencyTimeHasElapsedM1())
@@ -422,14 +902,14 @@ __weak void TSK_MediumFrequencyTaskM1(void)
 
         case FAULT_OVER:
         {
-          if (MCI_ACK_FAULTS == Mci[M1].DirectCommand)
+          if ((MCI_ACK_FAULTS == Mci[M1].DirectCommand) && (false == FLR_IsPending(&FaultRecorderM1)))
           {
             Mci[M1].DirectCommand = MCI_NO_COMMAND;
             Mci[M1].State = IDLE;
           }
           else
           {
-            /* Nothing to do, FW stays in FAULT_OVER state until acknowledgement */
+            /* Nothing to do, FW stays in FAULT_OVER state until acknowledgement and fault record */
           }
           break;
         }
@@ -488,6 +968,24 @@ __weak void FOC_Clear(uint8_t bMotor)
   PID_SetIntegralTerm(pPIDId[bMotor], ((int32_t)0));
 
   STC_Clear(pSTC[bMotor]);
+#if (REGEN_LIMITER_ENABLE == 1)
+  REGEN_Clear(&RegenLimiterM1);
+#endif
+#if (SPD_FILTER_ENABLE == 1)
+  SPDFLT_Clear(&SpeedFilterM1);
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+  LTO_Clear(&LoadObserverM1);
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+  DBC_Clear(&DeadbeatCurrM1);
+#endif
+#if (COGGING_COMP_ENABLE == 1)
+  COG_Clear(&CoggingCompM1);
+#endif
+#if (VIB_MONITOR_ENABLE == 1)
+  VIB_Clear(&VibMonitorM1);
+#endif
 
   PWMC_SwitchOffPWM(pwmcHandle[bMotor]);
 
@@ -542,6 +1040,10 @@ __weak void FOC_CalcCurrRef(uint8_t bMotor)
   /* USER CODE END FOC_CalcCurrRef 0 */
   if (INTERNAL == FOCVars[bMotor].bDriveInput)
   {
+#if (REGEN_LIMITER_ENABLE == 1)
+    /* Limits the speed regulator output before it runs, so that its integral term does not wind up */
+    REGEN_SetSpeedLimits(&RegenLimiterM1, SPD_GetAvrgMecSpeedUnit(STC_GetSpeedSensor(pSTC[bMotor])));
+#endif
     FOCVars[bMotor].hTeref = STC_CalcTorqueReference(pSTC[bMotor]);
     IqdTmp.q = FOCVars[bMotor].hTeref;
 
@@ -570,27 +1072,19 @@ __weak void FOC_CalcCurrRef(uint8_t bMotor)
 __attribute__((section (".ccmram")))
 #endif
 #endif
-
 /**
-  * @brief  Executes the Motor Control duties that require a high frequency rate and a precise timing.
-  *
-  *  This is mainly the FOC current control loop. It is executed depending on the state of the Motor Control
-  * subsystem (see the state machine(s)).
-  * @param bMotorNbr Motor reference number defined
-  * @retval Number of the  motor instance which FOC loop was executed.
+  * @brief  Executes the FOC of motor 1: current controllers, or the pulses of the initial position
+  *         detection, and the sensorless observer.
   */
-__weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
+static void FOC_HighFrequencyTaskM1(void)
 {
   uint16_t hFOCreturn;
-  /* USER CODE BEGIN HighFrequencyTask 0 */
-
-  /* USER CODE END HighFrequencyTask 0 */
-
-  RCM_ReadOngoingConv();
-  RCM_ExecNextConv();
   Observer_Inputs_t STO_Inputs; /* Only if sensorless main */
 
   STO_Inputs.Valfa_beta = FOCVars[M1].Valphabeta;  /* Only if sensorless */
+#if ((VBUS_COMPENSATION_ENABLE == 1) || (REGEN_LIMITER_ENABLE == 1))
+  hVbusSampleM1 = RCM_GetRegularConv(&VbusRegConv_M1);
+#endif
   if (SWITCH_OVER == Mci[M1].State)
   {
     if (!REMNG_RampCompleted(pREMNG[M1]))
@@ -609,7 +1103,24 @@ __weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
   /* USER CODE BEGIN HighFrequencyTask SINGLEDRIVE_1 */
 
   /* USER CODE END HighFrequencyTask SINGLEDRIVE_1 */
-  hFOCreturn = FOC_CurrControllerM1();
+#if (POLPULSE_ENABLE == 1)
+  if (ALIGNMENT == Mci[M1].State)
+  {
+    hFOCreturn = FOC_PolPulseM1();
+  }
+  else
+#endif
+#if (SELF_COMMISSIONING_ENABLE == 1)
+  if ((PROFILE == Mci[M1].State) && (true == SCC_IsPhaseVoltageImposed(&SCC_M1)))
+  {
+    /* Current regulators bypassed by the resistance and inductance measurements */
+    hFOCreturn = SCC_SetPhaseVoltage(&SCC_M1);
+  }
+  else
+#endif
+  {
+    hFOCreturn = FOC_CurrControllerM1();
+  }
   /* USER CODE BEGIN HighFrequencyTask SINGLEDRIVE_2 */
 
   /* USER CODE END HighFrequencyTask SINGLEDRIVE_2 */
@@ -623,15 +1134,27 @@ __weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
     if ((IDLE == Mci[M1].State) || (FAULT_OVER == Mci[M1].State))
     {
       STO_PLL_Clear(&STO_PLL_M1);
+#if (HSO_MAIN_SENSOR == 1)
+      HSO_SPD_Clear(&HSO_M1);
+#endif
     }
     else
     {
       STO_Inputs.Ialfa_beta = FOCVars[M1].Ialphabeta; /* Only if sensorless */
+#if (VBUS_COMPENSATION_ENABLE == 1)
+      STO_Inputs.Vbus = hVbusSampleM1; /* Only for sensorless */
+#else
       STO_Inputs.Vbus = VBS_GetAvBusVoltage_d(&(BusVoltageSensor_M1._Super)); /* Only for sensorless */
+#endif
       (void)STO_PLL_CalcElAngle(&STO_PLL_M1, &STO_Inputs);
+#if (HSO_MAIN_SENSOR == 1)
+      (void)HSO_SPD_CalcElAngle(&HSO_M1, &STO_Inputs);
+#endif
     }
     STO_PLL_CalcAvrgElSpeedDpp(&STO_PLL_M1); /* Only in case of Sensor-less */
-    if (false == IsAccelerationStageReached)
+    /* PLL is held during the rev-up only: a rotor caught on the fly enters RUN without it */
+    if ((false == IsAccelerationStageReached) && (OTF_DETECTION != Mci[M1].State) && (RUN != Mci[M1].State)
+        && (PROFILE != Mci[M1].State))
     {
       STO_ResetPLL(&STO_PLL_M1);
     }
@@ -642,6 +1165,12 @@ __weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
     /* Only for sensor-less */
     if((START == Mci[M1].State) || (SWITCH_OVER == Mci[M1].State))
     {
+      int16_t hObsAngle = SPD_GetElAngle(MAIN_SPEED_SENSOR_M1);
+      (void)VSS_CalcElAngle(&VirtualSpeedSensorM1, &hObsAngle);
+    }
+    else if (PROFILE == Mci[M1].State)
+    {
+      /* The self commissioning switches over to the State Observer it has just tuned */
       int16_t hObsAngle = SPD_GetElAngle(&STO_PLL_M1._Super);
       (void)VSS_CalcElAngle(&VirtualSpeedSensorM1, &hObsAngle);
     }
@@ -649,6 +1178,45 @@ __weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
 
     /* USER CODE END HighFrequencyTask SINGLEDRIVE_3 */
   }
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Executes the Motor Control duties that require a high frequency rate and a precise timing.
+  *
+  *  This is mainly the FOC current control loop. It is executed depending on the state of the Motor Control
+  * subsystem (see the state machine(s)).
+  * @param bMotorNbr Motor reference number defined
+  * @retval Number of the  motor instance which FOC loop was executed.
+  */
+__weak uint8_t FOC_HighFrequencyTask(uint8_t bMotorNbr)
+{
+  /* USER CODE BEGIN HighFrequencyTask 0 */
+
+  /* USER CODE END HighFrequencyTask 0 */
+
+#if (RCM_DMA_ENABLE == 0)
+  RCM_ReadOngoingConv();
+  RCM_ExecNextConv();
+#endif
+#if (NBR_OF_MOTORS > 1)
+  if (M1 == bMotorNbr)
+  {
+    FOC_HighFrequencyTaskM1();
+  }
+  else
+  {
+    FOC_HighFrequencyTaskM2();
+  }
+#else
+  FOC_HighFrequencyTaskM1();
+#endif
 
   return (bMotorNbr);
 
@@ -676,27 +1244,136 @@ inline uint16_t FOC_CurrControllerM1(void)
   ab_t Iab;
   alphabeta_t Ialphabeta, Valphabeta;
   int16_t hElAngle;
+#if (FOC_PIPELINE_ENABLE == 1)
+  Trig_Components CosSin;
+#endif
   uint16_t hCodeError = MC_NO_FAULTS;
   SpeednPosFdbk_Handle_t *speedHandle;
   speedHandle = STC_GetSpeedSensor(pSTC[M1]);
   hElAngle = SPD_GetElAngle(speedHandle);
   hElAngle += SPD_GetInstElSpeedDpp(speedHandle)*PARK_ANGLE_COMPENSATION_FACTOR;
   PWMC_GetPhaseCurrents(pwmcHandle[M1], &Iab);
+#if (FOC_PIPELINE_ENABLE == 1)
+  CosSin = FOCP_CosSin(hElAngle);
+  Ialphabeta = FOCP_Clarke(Iab);
+  Iqd = FOCP_Park(Ialphabeta, CosSin);
+#else
   Ialphabeta = MCM_Clarke(Iab);
   Iqd = MCM_Park(Ialphabeta, hElAngle);
+#endif
+#if (HFI_STARTUP_ENABLE == 1)
+  if (&HFI_M1._Super == speedHandle)
+  {
+    /* Regulators act on the fundamental, the injection is added to their output */
+    Iqd = HFI_Demodulate(&HFI_M1, Iqd);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
   if (PWMC_GetPWMState(pwmcHandle[M1]) == true)
   {
-    Vqd.q = PI_Controller(pPIDIq[M1], (int32_t)(FOCVars[M1].Iqdref.q) - Iqd.q);
-    Vqd.d = PI_Controller(pPIDId[M1], (int32_t)(FOCVars[M1].Iqdref.d) - Iqd.d);
+    int32_t wIqref = (int32_t)(FOCVars[M1].Iqdref.q);
+    int32_t wIdref = (int32_t)(FOCVars[M1].Iqdref.d);
+    bool bDeadbeat = false;
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+    uint32_t wRegStart;
+#endif
+#if (COGGING_COMP_ENABLE == 1)
+    {
+      /* Cogging torque cancelled at the angle the current is applied, the table learnt from the speed */
+#if (COG_MECHANICAL_INDEX == 1)
+      int16_t hCogAngle = (int16_t)SPD_GetMecAngle(speedHandle);
+#else
+      int16_t hCogAngle = hElAngle;
+#endif
+      wIqref += (int32_t)COG_GetIq(&CoggingCompM1, hCogAngle);
+      COG_Accumulate(&CoggingCompM1, hCogAngle, SPD_GetInstElSpeedDpp(speedHandle));
+    }
+#endif
+#if (REGEN_LIMITER_ENABLE == 1)
+    {
+      /* Regenerative Iq, cogging term included, limited by the bus voltage, the windings dissipating
+         beforehand by Id */
+      int16_t hIqref = (int16_t)((wIqref > INT16_MAX) ? INT16_MAX : ((wIqref < -INT16_MAX) ? -INT16_MAX : wIqref));
+
+      REGEN_CalcLimits(&RegenLimiterM1, hVbusSampleM1, hIqref);
+      wIqref = (int32_t)REGEN_LimitIq(&RegenLimiterM1, hIqref);
+      wIdref += (int32_t)REGEN_GetIdBrake(&RegenLimiterM1);
+    }
+#endif
+#if (RS_ESTIMATION_ENABLE == 1)
+    /* Low frequency injection of the stator resistance estimation, null when inactive, fixp30 to s16 */
+    wIdref += RSTEMP_getIdqLFref(&RSTempM1).D >> 15;
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+    wRegStart = DWT->CYCCNT;
+    /* Model based regulation, the PI regulators taking over when the voltage saturates */
+    bDeadbeat = DBC_Controller(&DeadbeatCurrM1, Iqd, wIqref, wIdref, SPD_GetInstElSpeedDpp(speedHandle), &Vqd);
+#endif
+    if (false == bDeadbeat)
+    {
+      Vqd.q = FOC_CURR_PI(pPIDIq[M1], wIqref - Iqd.q);
+      Vqd.d = FOC_CURR_PI(pPIDId[M1], wIdref - Iqd.d);
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+      DBC_SetApplied(&DeadbeatCurrM1, Vqd);
+#endif
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+    DBC_SetCycles(&DeadbeatCurrM1, DWT->CYCCNT - wRegStart);
+#endif
+#if (HFI_STARTUP_ENABLE == 1)
+    if (&HFI_M1._Super == speedHandle)
+    {
+      int32_t wVd = (int32_t)Vqd.d + HFI_CalcInjection(&HFI_M1);
+      Vqd.d = (int16_t)((wVd > INT16_MAX) ? INT16_MAX : ((wVd < -INT16_MAX) ? -INT16_MAX : wVd));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#endif
   }
   else
   {
     Vqd.q = 0;
     Vqd.d = 0;
   }
+#if (VBUS_COMPENSATION_ENABLE == 1)
+  Vqd = FOCP_CompensateVbus(Vqd, hVbusSampleM1, NOMINAL_BUS_VOLTAGE_d, UNDERVOLTAGE_THRESHOLD_d);
+#endif
   Vqd = Circle_Limitation(&CircleLimitationM1, Vqd);
   hElAngle += SPD_GetInstElSpeedDpp(speedHandle)*REV_PARK_ANGLE_COMPENSATION_FACTOR;
+#if (HFI_STARTUP_ENABLE == 1) && (REV_PARK_ANGLE_COMPENSATION_FACTOR == 0)
+  if (&HFI_M1._Super == speedHandle)
+  {
+    /* The voltage is applied from half a period to one and a half after the sample: at the angle of the sample,
+       part of the injection falls on the q axis and is demodulated as an angle error growing with the speed */
+    hElAngle += SPD_GetInstElSpeedDpp(speedHandle);
+#if (FOC_PIPELINE_ENABLE == 1)
+    CosSin = FOCP_CosSin(hElAngle);
+#endif
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
+#if (FOC_PIPELINE_ENABLE == 1)
+#if (REV_PARK_ANGLE_COMPENSATION_FACTOR != 0)
+  CosSin = FOCP_CosSin(hElAngle);
+#else
+  /* Same angle as the Park transform, its sine and cosine are reused */
+#endif
+  Valphabeta = FOCP_RevPark(Vqd, CosSin);
+#else
   Valphabeta = MCM_Rev_Park(Vqd, hElAngle);
+#endif
 
   if (PWMC_GetPWMState(pwmcHandle[M1]) == true)
   {
@@ -713,10 +1390,133 @@ inline uint16_t FOC_CurrControllerM1(void)
   FOCVars[M1].Iqd = Iqd;
   FOCVars[M1].Valphabeta = Valphabeta;
   FOCVars[M1].hElAngle = hElAngle;
+#if (VIB_MONITOR_ENABLE == 1)
+  VIB_Capture(&VibMonitorM1, Iqd.q, SPD_GetInstElSpeedDpp(speedHandle));
+#endif
+
+#if (RS_ESTIMATION_ENABLE == 1)
+  if (RSTEMP_STATE_Idle != RSTEMP_getState(&RSTempM1))
+  {
+    Voltages_Uab_t Uab_pu;
+    Currents_Iab_t Iab_pu;
+    FIXP_CosSin_t CosSinPark;
+    alphabeta_t IalphabetaApplied;
+    int16_t hElSpeedDpp = SPD_GetInstElSpeedDpp(speedHandle);
+    /* The voltage is applied from half a period to one and a half after the sample, its d component is the one
+       on the angle a period after the sample. The current is rotated by the same angle, so that its projection
+       stays the Iqd of the sample */
+    int16_t hAppliedAngle = SPD_GetElAngle(speedHandle) + (hElSpeedDpp * (PARK_ANGLE_COMPENSATION_FACTOR + 1));
+    int32_t wSqrt3Beta;
+    int32_t wDeadA;
+    int32_t wDeadB;
+    int32_t wDeadC;
+    fixp30_t wRotation;
+#if (VBUS_COMPENSATION_ENABLE == 1)
+    fixp30_t wVbusHalf = (fixp30_t)(hVbusSampleM1 >> 1U);
+#else
+    fixp30_t wVbusHalf = (fixp30_t)(VBS_GetAvBusVoltage_d(&(BusVoltageSensor_M1._Super)) >> 1U);
+#endif
+
+    /* Dead time: each leg short of RS_EST_DEADTIME_S16 against its current during the application, the common
+       mode removed, so that the resistance estimated is the one of the windings whatever the load. Phase
+       currents as MCM_Clarke inverted, 56756 being sqrt(3) in Q15 */
+    IalphabetaApplied = MCM_Rev_Park(Iqd, hAppliedAngle);
+    wSqrt3Beta = ((int32_t)IalphabetaApplied.beta * 56756) >> 15;
+    wDeadA = (IalphabetaApplied.alpha > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+    wDeadB = ((-wSqrt3Beta - IalphabetaApplied.alpha) > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+    wDeadC = ((wSqrt3Beta - IalphabetaApplied.alpha) > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+
+    /* s16 voltages times the u16 bus voltage and s16 currents, to fixp30 per unit. Dead time errors to alpha beta
+       as MCM_Clarke, 37837 being 1/sqrt(3) in Q16 */
+    Uab_pu.A = ((fixp30_t)Valphabeta.alpha + (((2 * wDeadA) - wDeadB - wDeadC) / 3)) * wVbusHalf;
+    Uab_pu.B = ((fixp30_t)Valphabeta.beta - (((wDeadB - wDeadC) * 37837) >> 16)) * wVbusHalf;
+    Iab_pu.A = ((fixp30_t)IalphabetaApplied.alpha) << 15;
+    Iab_pu.B = ((fixp30_t)IalphabetaApplied.beta) << 15;
+
+    /* The voltage held over the period turns by its angle in the rotor frame: the sampled current falls short
+       of the injection response by about a quarter of its square, (dpp * 2 pi / 65536)^2 / 4, that is
+       (dpp^2 / 1024) * 2527 in fixp30 */
+    wRotation = (((int32_t)hElSpeedDpp * hElSpeedDpp) >> 10) * 2527;
+    Iab_pu.A += FIXP30_mpy(Iab_pu.A, wRotation);
+    Iab_pu.B += FIXP30_mpy(Iab_pu.B, wRotation);
+
+    /* RSTEMP_run projects on (cos, sin) of its angle: MCM_Park puts the d axis at (sin, cos) of the electrical
+       angle, a quarter turn minus the direction */
+    FIXP30_CosSinPU(((fixp30_t)(uint16_t)(16384 - hAppliedAngle)) << 14, &CosSinPark);
+    RSTEMP_run(&RSTempM1, &Uab_pu, &Iab_pu, &CosSinPark,
+               (fixp30_t)SPD_GetElSpeedDpp(speedHandle) * RS_EST_DPP_TO_FREQ_PU);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
 
   return (hCodeError);
 }
 
+#if (POLPULSE_ENABLE == 1)
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief Replaces the current controllers during the initial rotor position detection:
+  *        the voltage pulses are applied in open loop and the resulting currents sampled.
+  * @retval int16_t It returns MC_NO_FAULTS if the pulse has been set before
+  *         next PWM Update event, MC_DURATION otherwise
+  */
+static uint16_t FOC_PolPulseM1(void)
+{
+  ab_t Iab;
+  alphabeta_t Ialphabeta;
+  alphabeta_t Valphabeta = {((int16_t)0), ((int16_t)0)};
+  Currents_Iab_t Iab_pu;
+  Voltages_Uab_t Uab_pu;
+  uint16_t hCodeError = MC_NO_FAULTS;
+
+  PWMC_GetPhaseCurrents(pwmcHandle[M1], &Iab);
+  Ialphabeta = MCM_Clarke(Iab);
+
+  /* s16 quantities to per unit */
+  Iab_pu.A = ((fixp30_t)Ialphabeta.alpha) << 15;
+  Iab_pu.B = ((fixp30_t)Ialphabeta.beta) << 15;
+  Uab_pu.A = ((fixp30_t)FOCVars[M1].Valphabeta.alpha) << 15;
+  Uab_pu.B = ((fixp30_t)FOCVars[M1].Valphabeta.beta) << 15;
+  POLPULSE_run(&PolPulseM1, &Iab_pu, &Uab_pu, 0);
+
+  if (true == POLPULSE_getOverruleDuty(&PolPulseM1))
+  {
+    /* Duty is a ratio of the DC bus voltage while s16 voltages are referred to Vbus/sqrt(3) */
+    Duty_Dab_t Dab = POLPULSE_getDutyAB(&PolPulseM1);
+    Valphabeta.alpha = (int16_t)(FIXP30_mpy(Dab.A, FIXP30(SQRT_3)) >> 15);
+    Valphabeta.beta = (int16_t)(FIXP30_mpy(Dab.B, FIXP30(SQRT_3)) >> 15);
+  }
+  else
+  {
+    /* Null voltage while the pulses are being planned */
+  }
+
+  if (PWMC_GetPWMState(pwmcHandle[M1]) == true)
+  {
+    hCodeError = PWMC_SetPhaseVoltage(pwmcHandle[M1], Valphabeta);
+  }
+  else
+  {
+    /* Nothing to do. No PWM setting to prevent possible ChargeBootCap conflict */
+  }
+
+  FOCVars[M1].Iab = Iab;
+  FOCVars[M1].Ialphabeta = Ialphabeta;
+  FOCVars[M1].Valphabeta = Valphabeta;
+
+  return (hCodeError);
+}
+#endif
+
 /* USER CODE BEGIN mc_task 0 */
 
 /* USER CODE END mc_task 0 */
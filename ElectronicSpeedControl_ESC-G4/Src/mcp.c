@@ -72,7 +72,11 @@ uint8_t RI_SetRegCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace
     uint16_t regID;
     uint8_t typeID;
     uint8_t motorID;
-    uint8_t (*SetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1};
+    uint8_t (*SetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1
+#if (NBR_OF_MOTORS > 1)
+                                                                                              , &RI_SetRegisterMotor2
+#endif
+                                                                                              };
     uint8_t number_of_item =0;
     pHandle->txLength = 0;
 
@@ -175,7 +179,11 @@ uint8_t RI_GetRegCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace
     uint16_t regID;
     uint8_t typeID;
     uint8_t motorID;
-    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1};
+    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1
+#if (NBR_OF_MOTORS > 1)
+                                                                                              , &RI_GetRegisterMotor2
+#endif
+                                                                                              };
     pHandle->txLength = 0;
     while (rxLength > 0U)
     {
@@ -251,7 +259,8 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
     }
 
     motorID = (uint8_t)((*packetHeader - 1U) & MOTOR_MASK);
-    MCI_Handle_t *pMCI = &Mci[motorID];
+    /* Motor commands to a motor out of the drive are refused */
+    MCI_Handle_t *pMCI = (motorID < (uint8_t)NBR_OF_MOTORS) ? &Mci[motorID] : MC_NULL;
 
     /* Removing MCP Header from RxBuffer */
     pHandle->rxLength = pHandle->rxLength - MCP_HEADER_SIZE;
@@ -289,14 +298,21 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
 
       case START_MOTOR:
       {
-        MCPResponse = (MCI_StartMotor(pMCI) == true) ? MCP_CMD_OK : MCP_CMD_NOK;
+        MCPResponse = ((MC_NULL != pMCI) && (MCI_StartMotor(pMCI) == true)) ? MCP_CMD_OK : MCP_CMD_NOK;
         break;
       }
 
       case STOP_MOTOR: /* Todo: Check the pertinance of return value */
       {
-        (void)MCI_StopMotor(pMCI);
-        MCPResponse = MCP_CMD_OK;
+        if (MC_NULL == pMCI)
+        {
+          MCPResponse = MCP_CMD_NOK;
+        }
+        else
+        {
+          (void)MCI_StopMotor(pMCI);
+          MCPResponse = MCP_CMD_OK;
+        }
         break;
       }
 
@@ -309,22 +325,33 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
 
       case STOP_RAMP:
       {
-        if (RUN == MCI_GetSTMState(pMCI))
+        if (MC_NULL == pMCI)
         {
-          MCI_StopRamp(pMCI);
+          MCPResponse = MCP_CMD_NOK;
         }
         else
         {
-          /* Nothing to do */
+          if (RUN == MCI_GetSTMState(pMCI))
+          {
+            MCI_StopRamp(pMCI);
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          MCPResponse = MCP_CMD_OK;
         }
-        MCPResponse = MCP_CMD_OK;
         break;
       }
 
       case START_STOP:
       {
         /* Queries the STM and a command start or stop depending on the state */
-        if (IDLE == MCI_GetSTMState(pMCI))
+        if (MC_NULL == pMCI)
+        {
+          MCPResponse = MCP_CMD_NOK;
+        }
+        else if (IDLE == MCI_GetSTMState(pMCI))
         {
           MCPResponse = (MCI_StartMotor(pMCI) == true) ? MCP_CMD_OK : MCP_CMD_NOK;
         }
@@ -338,15 +365,29 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
 
       case FAULT_ACK:
       {
-        (void)MCI_FaultAcknowledged(pMCI);
-        MCPResponse = MCP_CMD_OK;
+        if (MC_NULL == pMCI)
+        {
+          MCPResponse = MCP_CMD_NOK;
+        }
+        else
+        {
+          (void)MCI_FaultAcknowledged(pMCI);
+          MCPResponse = MCP_CMD_OK;
+        }
         break;
       }
 
       case IQDREF_CLEAR:
       {
-        MCI_Clear_Iqdref(pMCI);
-        MCPResponse = MCP_CMD_OK;
+        if (MC_NULL == pMCI)
+        {
+          MCPResponse = MCP_CMD_NOK;
+        }
+        else
+        {
+          MCI_Clear_Iqdref(pMCI);
+          MCPResponse = MCP_CMD_OK;
+        }
         break;
       }
 
@@ -365,6 +406,20 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
         break;
       }
 
+      case PARAM_STORE_CMD:
+      {
+        MCPResponse = MC_ParamStoreCommand(pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace, &pHandle->txLength,
+                                           pHandle->txBuffer);
+        break;
+      }
+
+      case FAULT_LOG_CMD:
+      {
+        MCPResponse = MC_FaultLogCommand(pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace, &pHandle->txLength,
+                                         pHandle->txBuffer);
+        break;
+      }
+
       case MCP_USER_CMD:
       {
         if ((userCommand < MCP_USER_CALLBACK_MAX) && (MCP_UserCallBack[userCommand] != NULL))
@@ -51,6 +51,8 @@ __weak void MX_MotorControl_Init(void)
   /* Reconfigure the SysTick interrupt to fire every 500 us. */
   (void)HAL_SYSTICK_Config(HAL_RCC_GetHCLKFreq() / SYS_TICK_FREQUENCY);
   HAL_NVIC_SetPriority(SysTick_IRQn, uwTickPrio, 0U);
+  /* Deferred Motor Control tasks, preempted by all the interrupts */
+  HAL_NVIC_SetPriority(PendSV_IRQn, 7U, 1U);
 
   /* Initialize the Motor Control Subsystem */
   MCboot(pMCI);
@@ -0,0 +1,220 @@
+
+/**
+  ******************************************************************************
+  * @file    regen_limiter.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Regenerative Braking Limiter component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup RegenLimiter
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "regen_limiter.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup RegenLimiter Regenerative Braking Limiter
+  * @brief Deceleration limited by the energy the bus absorbs
+  *
+  * A deceleration returns the kinetic energy to the bus. When the battery can not absorb it, because of
+  * its resistance or its state of charge, the bus voltage rises up to the over voltage fault. A PI
+  * regulator of the bus voltage outputs the regenerative current in excess when the voltage is above
+  * hVbusStart_d. It runs in the current control, as the battery resistance and the bus capacitor
+  * react within a few PWM periods:
+  *
+  * - up to hIdBrakeMax, a negative Id is added to the reference. It keeps the braking torque while the
+  *   windings dissipate part of the energy;
+  * - beyond, the regenerative Iq is limited in the reference of the current regulator, whatever the
+  *   drive mode, and in the speed regulator output limits, its integral term held meanwhile so that it
+  *   does not wind up.
+  *
+  * The deceleration is then as fast as the bus absorbs the energy. Through the battery resistance, the
+  * bus voltage follows the current within a PWM period: the proportional gain of the regulator is kept
+  * low, a high one makes the limit cycle between no and full regeneration. The over voltage protection
+  * remains active for the faults of the regulation.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Initializes the Regenerative Braking Limiter component.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  */
+__weak void REGEN_Init(REGEN_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_REGEN
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    PID_HandleInit(pHandle->pPIRegen);
+    pHandle->hSpeedUpperLimit = pHandle->pPISpeed->hUpperOutputLimit;
+    pHandle->hSpeedLowerLimit = pHandle->pPISpeed->hLowerOutputLimit;
+    pHandle->wSpeedUpperIntegralLimit = pHandle->pPISpeed->wUpperIntegralLimit;
+    pHandle->wSpeedLowerIntegralLimit = pHandle->pPISpeed->wLowerIntegralLimit;
+    REGEN_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_REGEN
+  }
+#endif
+}
+
+/**
+  * @brief  Releases the limits, to be called when the drive stops.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  */
+__weak void REGEN_Clear(REGEN_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_REGEN
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    PID_SetIntegralTerm(pHandle->pPIRegen, 0);
+    pHandle->hIdBrake = 0;
+    pHandle->hIqLimit = pHandle->hIqRegenMax;
+    pHandle->bSpeedSign = 0;
+    PID_SetUpperOutputLimit(pHandle->pPISpeed, pHandle->hSpeedUpperLimit);
+    PID_SetLowerOutputLimit(pHandle->pPISpeed, pHandle->hSpeedLowerLimit);
+    PID_SetUpperIntegralTermLimit(pHandle->pPISpeed, pHandle->wSpeedUpperIntegralLimit);
+    PID_SetLowerIntegralTermLimit(pHandle->pPISpeed, pHandle->wSpeedLowerIntegralLimit);
+#ifdef NULL_PTR_CHECK_REGEN
+  }
+#endif
+}
+
+/**
+  * @brief  Computes the regenerative current limit and the braking Id from the bus voltage.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  * @param  hVbus_d: bus voltage of the current period, u16Volt.
+  * @param  hIqref: Iq reference, digit.
+  *
+  * To be called by the current control before the regulators. The battery resistance and the bus
+  * capacitor react within a few PWM periods to a braking torque step, faster than the medium
+  * frequency task.
+  */
+__weak void REGEN_CalcLimits(REGEN_Handle_t *pHandle, uint16_t hVbus_d, int16_t hIqref)
+{
+#ifdef NULL_PTR_CHECK_REGEN
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int16_t hExcess = PI_Controller(pHandle->pPIRegen, (int32_t)hVbus_d - (int32_t)pHandle->hVbusStart_d);
+    int16_t hIqReduction = hExcess - pHandle->hIdBrakeMax;
+
+    /* Braking, or motoring torque cancelled by the limitation: the windings dissipate */
+    if ((0 != pHandle->bSpeedSign) && (((int32_t)pHandle->bSpeedSign * hIqref) <= 0))
+    {
+      pHandle->hIdBrake = (hExcess < pHandle->hIdBrakeMax) ? -hExcess : -pHandle->hIdBrakeMax;
+    }
+    else
+    {
+      pHandle->hIdBrake = 0;
+    }
+
+    if (hIqReduction <= 0)
+    {
+      pHandle->hIqLimit = pHandle->hIqRegenMax;
+    }
+    else if (hIqReduction < pHandle->hIqRegenMax)
+    {
+      pHandle->hIqLimit = pHandle->hIqRegenMax - hIqReduction;
+    }
+    else
+    {
+      pHandle->hIqLimit = 0;
+    }
+#ifdef NULL_PTR_CHECK_REGEN
+  }
+#endif
+}
+
+/**
+  * @brief  Updates the direction of the rotation and limits the speed regulator output to the
+  *         regenerative current allowed, so that its integral term does not wind up.
+  * @param  pHandle: handler of the current instance of the Regenerative Braking Limiter component.
+  * @param  hMecSpeedUnit: speed of the rotor, #SPEED_UNIT.
+  *
+  * To be called by the medium frequency task before the torque reference is computed.
+  */
+__weak void REGEN_SetSpeedLimits(REGEN_Handle_t *pHandle, int16_t hMecSpeedUnit)
+{
+#ifdef NULL_PTR_CHECK_REGEN
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int32_t wKiDivisor = (int32_t)PID_GetKIDivisor(pHandle->pPISpeed);
+    int16_t hIqLimit = pHandle->hIqLimit;
+    int16_t hUpper = pHandle->hSpeedUpperLimit;
+    int16_t hLower = pHandle->hSpeedLowerLimit;
+    int32_t wUpperIntegral = pHandle->wSpeedUpperIntegralLimit;
+    int32_t wLowerIntegral = pHandle->wSpeedLowerIntegralLimit;
+
+    pHandle->bSpeedSign = (hMecSpeedUnit > 0) ? 1 : ((hMecSpeedUnit < 0) ? -1 : 0);
+
+    /* While the braking is limited, the integral term may unwind but not integrate further in the braking
+       direction: the output limit alone lets it wind up during the longer braking, and the speed undershoots */
+    if ((pHandle->bSpeedSign > 0) && (-hIqLimit > hLower))
+    {
+      hLower = -hIqLimit;
+      wLowerIntegral = pHandle->pPISpeed->wIntegralTerm;
+      wLowerIntegral = (wLowerIntegral < ((int32_t)hLower * wKiDivisor)) ? ((int32_t)hLower * wKiDivisor)
+                                                                        : wLowerIntegral;
+    }
+    else if ((pHandle->bSpeedSign < 0) && (hIqLimit < hUpper))
+    {
+      hUpper = hIqLimit;
+      wUpperIntegral = pHandle->pPISpeed->wIntegralTerm;
+      wUpperIntegral = (wUpperIntegral > ((int32_t)hUpper * wKiDivisor)) ? ((int32_t)hUpper * wKiDivisor)
+                                                                        : wUpperIntegral;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    PID_SetUpperOutputLimit(pHandle->pPISpeed, hUpper);
+    PID_SetLowerOutputLimit(pHandle->pPISpeed, hLower);
+    PID_SetUpperIntegralTermLimit(pHandle->pPISpeed, wUpperIntegral);
+    PID_SetLowerIntegralTermLimit(pHandle->pPISpeed, wLowerIntegral);
+#ifdef NULL_PTR_CHECK_REGEN
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
@@ -50,6 +50,12 @@
   * User regular conversion, as well as Vbus and temperature, are executed by the high frequency task. Each high
   * frequency task executes one of the conversion registered in the RCM array.
   *
+  * With #RCM_DMA_ENABLE set, the registered conversions are instead scanned continuously by their ADC, all on
+  * the ADC of the first one, and written by the DMA in #RCM_DMABuffer. The high frequency task does not
+  * access the regular sequencer any more, the injected current readings preempt the scan. With
+  * #RCM_OVERSAMPLING_LOG2 set, each result is the hardware average of 2^n conversions, scaled to 16 bits
+  * as the left aligned 12 bits results are.
+  *
   * To retrieve the result of a conversion the user must use  RCM_GetRegularConv() API.
   *
   * Example: of conversion registration:
@@ -76,31 +82,103 @@
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private defines -----------------------------------------------------------*/
-/**
-  * @brief Number of regular conversion allowed By default.
-  *
-  * In single drive configuration, it is defined to 4. 2 of them are consumed by
-  * Bus voltage and temperature reading. This leaves 2 handles available for
-  * user conversions
-  *
-  * In dual drives configuration, it is defined to 6. 2 of them are consumed by
-  * Bus voltage and temperature reading for each motor. This leaves 2 handles
-  * available for user conversion.
-  *
-  * Defined to 4 here.
-  */
-#define RCM_MAX_CONV  4U
 
 /* Global variables ----------------------------------------------------------*/
 
 static RegConv_t *RCM_handle_array[RCM_MAX_CONV];
+#if (RCM_DMA_ENABLE == 0)
 static uint8_t RCM_array_index = 0U; /*!< handled by RCM to point on the element for conversion. */
+#endif
 static uint8_t RCM_conversion_nb = 0U; /*!< total number of valid element in the array */
 
+#if (RCM_DMA_ENABLE == 1)
+#if (RCM_OVERSAMPLING_LOG2 > 0) && ((RCM_OVERSAMPLING_LOG2 < 4) || (RCM_OVERSAMPLING_LOG2 > 8))
+#error "RCM_OVERSAMPLING_LOG2 shall be 0, or 4 to 8 for 16 bits results"
+#endif
+
+volatile uint16_t RCM_DMABuffer[RCM_MAX_CONV];
+
+static const uint32_t RCM_Ranks[RCM_MAX_CONV] =
+{
+  LL_ADC_REG_RANK_1, LL_ADC_REG_RANK_2, LL_ADC_REG_RANK_3, LL_ADC_REG_RANK_4
+};
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 
 /* Private functions ---------------------------------------------------------*/
 
+#if (RCM_DMA_ENABLE == 1)
+/**
+  * @brief  (Re)starts the continuous scan of the registered conversions by the ADC and the DMA.
+  *
+  * The ADC configuration can only be written while no conversion is ongoing: the injected
+  * conversions, already started by the current sensing, are stopped and started again. They
+  * are triggered by the PWM timer, not yet running when the conversions are registered.
+  *
+  * @param  ADCx ADC of the registered conversions.
+  */
+static void RCM_StartScan(ADC_TypeDef *ADCx)
+{
+  uint32_t wInjected = LL_ADC_INJ_IsConversionOngoing(ADCx);
+  uint8_t i;
+
+  LL_ADC_REG_StopConversion(ADCx);
+  while (1U == LL_ADC_REG_IsStopConversionOngoing(ADCx))
+  {
+    /* Nothing to do */
+  }
+  if (1U == wInjected)
+  {
+    LL_ADC_INJ_StopConversion(ADCx);
+    while (1U == LL_ADC_INJ_IsStopConversionOngoing(ADCx))
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  LL_DMA_DisableChannel(RCM_DMA, RCM_DMA_CHANNEL);
+
+  for (i = 0U; i < RCM_conversion_nb; i++)
+  {
+    LL_ADC_REG_SetSequencerRanks(ADCx, RCM_Ranks[i], __LL_ADC_DECIMAL_NB_TO_CHANNEL(RCM_handle_array[i]->channel));
+  }
+  LL_ADC_REG_SetSequencerLength(ADCx, ((uint32_t)RCM_conversion_nb - 1U) << ADC_SQR1_L_Pos);
+  LL_ADC_REG_SetContinuousMode(ADCx, LL_ADC_REG_CONV_CONTINUOUS);
+  LL_ADC_REG_SetOverrun(ADCx, LL_ADC_REG_OVR_DATA_OVERWRITTEN);
+  LL_ADC_REG_SetDMATransfer(ADCx, LL_ADC_REG_DMA_TRANSFER_UNLIMITED);
+#if (RCM_OVERSAMPLING_LOG2 > 0)
+  /* The accumulation continues across the injected conversions. The oversampler ignores the
+     left alignment: the sum of 2^n 12 bits conversions is shifted to 16 bits */
+  LL_ADC_SetOverSamplingScope(ADCx, LL_ADC_OVS_GRP_REGULAR_CONTINUED);
+  LL_ADC_ConfigOverSamplingRatioShift(ADCx, (uint32_t)(RCM_OVERSAMPLING_LOG2 - 1) << ADC_CFGR2_OVSR_Pos,
+                                      (uint32_t)(RCM_OVERSAMPLING_LOG2 - 4) << ADC_CFGR2_OVSS_Pos);
+#endif
+
+  LL_DMA_ConfigTransfer(RCM_DMA, RCM_DMA_CHANNEL, LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_MODE_CIRCULAR
+                        | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_HALFWORD
+                        | LL_DMA_MDATAALIGN_HALFWORD | LL_DMA_PRIORITY_LOW);
+  LL_DMA_SetPeriphRequest(RCM_DMA, RCM_DMA_CHANNEL, (ADC1 == ADCx) ? LL_DMAMUX_REQ_ADC1 : LL_DMAMUX_REQ_ADC2);
+  LL_DMA_ConfigAddresses(RCM_DMA, RCM_DMA_CHANNEL, LL_ADC_DMA_GetRegAddr(ADCx, LL_ADC_DMA_REG_REGULAR_DATA),
+                         (uint32_t)RCM_DMABuffer, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+  LL_DMA_SetDataLength(RCM_DMA, RCM_DMA_CHANNEL, RCM_conversion_nb);
+  LL_DMA_EnableChannel(RCM_DMA, RCM_DMA_CHANNEL);
+
+  if (1U == wInjected)
+  {
+    LL_ADC_INJ_StartConversion(ADCx);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  LL_ADC_REG_StartConversion(ADCx);
+}
+#endif
+
 /**
   * @brief  Registers a regular conversion.
   *
@@ -131,8 +209,18 @@ bool RCM_RegisterRegConv(RegConv_t *regConv)
   {
 #endif
 
+#if (RCM_DMA_ENABLE == 1)
+    /* A single ADC scans the conversions */
+    if ((RCM_conversion_nb < RCM_MAX_CONV)
+     && ((0U == RCM_conversion_nb) || (RCM_handle_array[0]->regADC == regConv->regADC)))
+#else
     if (RCM_conversion_nb < RCM_MAX_CONV)
+#endif
     {
+#if (RCM_DMA_ENABLE == 1)
+      /* Value read until the first scan completes */
+      RCM_DMABuffer[RCM_conversion_nb] = regConv->data;
+#endif
       RCM_handle_array[RCM_conversion_nb] = regConv;
       RCM_handle_array[RCM_conversion_nb]->id = RCM_conversion_nb;
       RCM_conversion_nb++;
@@ -164,10 +252,15 @@ bool RCM_RegisterRegConv(RegConv_t *regConv)
       {
         /* Nothing to do */
       }
+#if (RCM_DMA_ENABLE == 0)
       LL_ADC_REG_SetSequencerLength(regConv->regADC, LL_ADC_REG_SEQ_SCAN_DISABLE);
+#endif
       /* Configure the sampling time (should already be configured by for non user conversions) */
       LL_ADC_SetChannelSamplingTime (regConv->regADC, __LL_ADC_DECIMAL_NB_TO_CHANNEL(regConv->channel),
                                      regConv->samplingTime);
+#if (RCM_DMA_ENABLE == 1)
+      RCM_StartScan(regConv->regADC);
+#endif
     }
     else
     {
@@ -197,6 +290,9 @@ __attribute__((section (".ccmram")))
  */
 void RCM_ExecNextConv(void)
 {
+#if (RCM_DMA_ENABLE == 1)
+  /* Nothing to do, the conversions are scanned by the ADC */
+#else
   if (RCM_conversion_nb > 0u)
   {
 
@@ -214,6 +310,7 @@ void RCM_ExecNextConv(void)
   {
      /* no conversion registered */
   }
+#endif
 }
 
 #if defined (CCMRAM)
@@ -234,6 +331,9 @@ __attribute__((section (".ccmram")))
  */
 void RCM_ReadOngoingConv(void)
 {
+#if (RCM_DMA_ENABLE == 1)
+  /* Nothing to do, the results are written by the DMA */
+#else
   uint32_t result;
 
   if (RCM_conversion_nb > 0u)
@@ -264,6 +364,7 @@ void RCM_ReadOngoingConv(void)
   {
      /* no conversion registered */
   }
+#endif
 }
 
 /*
@@ -287,6 +388,10 @@ uint16_t RCM_ExecRegularConv(RegConv_t *regConv)
   {
 #endif
 
+#if (RCM_DMA_ENABLE == 1)
+  /* Latest scanned result, no conversion to wait for */
+  result = RCM_DMABuffer[regConv->id];
+#else
   LL_ADC_REG_SetSequencerRanks(regConv->regADC,
                                LL_ADC_REG_RANK_1,
                                __LL_ADC_DECIMAL_NB_TO_CHANNEL(regConv->channel));
@@ -304,6 +409,7 @@ uint16_t RCM_ExecRegularConv(RegConv_t *regConv)
 
   /* Reading of ADC Converted Value */
   result = LL_ADC_REG_ReadConversionData12L(regConv->regADC);
+#endif
 #ifdef NULL_PTR_CHECK_REG_CON_MNG
   }
 #endif
@@ -318,6 +424,9 @@ uint16_t RCM_ExecRegularConv(RegConv_t *regConv)
  */
 void RCM_WaitForConv(void)
 {
+#if (RCM_DMA_ENABLE == 1)
+  /* Nothing to do, the results are always available */
+#else
   if (RCM_conversion_nb > 0u)
   {
     while (LL_ADC_IsActiveFlag_EOC(RCM_handle_array[RCM_array_index]->regADC) == 0U )
@@ -329,6 +438,7 @@ void RCM_WaitForConv(void)
   {
      /* no conversion registered */
   }
+#endif
 }
 
 /**
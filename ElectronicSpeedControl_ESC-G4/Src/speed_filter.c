@@ -0,0 +1,574 @@
+
+/**
+  ******************************************************************************
+  * @file    speed_filter.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Speed Loop Filter component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup SpeedFilter
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "speed_filter.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup SpeedFilter Speed Loop Filter
+  * @brief Biquads on the speed feedback and on the torque reference of the speed regulator
+  *
+  * The propeller and the frame resonances appear on the measured speed. The speed regulator amplifies
+  * them into the torque reference, which limits its bandwidth. Two cascades of #SPDFLT_STAGE_NBR biquads,
+  * run by CMSIS-DSP in the transposed direct form II, filter:
+  *
+  * - the speed feedback: the adaptive notch, a fixed notch and a low pass;
+  * - the torque reference: a low pass.
+  *
+  * The unused stages pass their input. The Motor Control Protocol writes the coefficients of any stage,
+  * they are applied at the next period of the speed regulator. A cascade restarts in the steady state of
+  * its input, so that a new set of coefficients or the start of the drive do not step the regulator.
+  *
+  * The adaptive notch follows the dominant vibration of the speed between fAdaptMin_Hz and fAdaptMax_Hz.
+  * A constrained notch, 1 + a.z^-1 + z^-2 over 1 + r.a.z^-1 + r^2.z^-2, has its zeros on the unit circle
+  * at the frequency acos(-a/2). A normalized gradient descent of its output power on a tunes it to the
+  * vibration. Once its output is 6 dB below its input, the stage #SPDFLT_ADAPTIVE_STAGE of the speed
+  * cascade becomes a notch of quality factor fNotchQ at this frequency. The notch is kept when the
+  * vibration vanishes, as it is then suppressing it, and released when a vibration it does not remove
+  * appears. fAdaptMin_Hz shall be well above the bandwidth of the speed regulator, so that the notch
+  * does not follow the oscillations of the regulator itself.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Pole radius of the notch of the adaptation, wide for a fast acquisition */
+#define SPDFLT_ADAPT_RADIUS     0.9f
+
+/* Averaging of the powers of the adaptation, 1 over the number of periods */
+#define SPDFLT_POWER_GAIN       0.02f
+
+/* Smallest power normalizing the adaptation gain, #SPEED_UNIT squared */
+#define SPDFLT_POWER_MIN        0.01f
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Writes a biquad passing its input */
+static void SPDFLT_DesignIdentity(float_t *pCoeffs)
+{
+  pCoeffs[0] = 1.0f;
+  pCoeffs[1] = 0.0f;
+  pCoeffs[2] = 0.0f;
+  pCoeffs[3] = 0.0f;
+  pCoeffs[4] = 0.0f;
+}
+
+/* Writes a notch biquad from the cosine of its normalized frequency */
+static void SPDFLT_DesignNotchCos(float_t *pCoeffs, float_t fCos, float_t fQ)
+{
+  float_t fAlpha = sqrtf(1.0f - (fCos * fCos)) / (2.0f * fQ);
+  float_t fNorm = 1.0f / (1.0f + fAlpha);
+
+  pCoeffs[0] = fNorm;
+  pCoeffs[1] = -2.0f * fCos * fNorm;
+  pCoeffs[2] = fNorm;
+  pCoeffs[3] = 2.0f * fCos * fNorm;
+  pCoeffs[4] = (fAlpha - 1.0f) * fNorm;
+}
+
+/* Returns true if the poles of the biquad are inside the unit circle */
+static bool SPDFLT_IsStable(const float_t *pCoeffs)
+{
+  return ((pCoeffs[4] > -1.0f) && (pCoeffs[4] < 1.0f) && (fabsf(pCoeffs[3]) < (1.0f - pCoeffs[4])));
+}
+
+/* Loads the state of a biquad in the steady state of a constant input, returns its output */
+static float_t SPDFLT_PrimeStage(const float_t *pCoeffs, float_t *pState, float_t fInput)
+{
+  float_t fOutput = fInput * (pCoeffs[0] + pCoeffs[1] + pCoeffs[2]) / (1.0f - pCoeffs[3] - pCoeffs[4]);
+
+  pState[1] = (pCoeffs[2] * fInput) + (pCoeffs[4] * fOutput);
+  pState[0] = (pCoeffs[1] * fInput) + (pCoeffs[3] * fOutput) + pState[1];
+  return (fOutput);
+}
+
+/* Filters a sample, the cascade restarting in the steady state of the sample if it is not primed */
+static float_t SPDFLT_Run(SPDFLT_Cascade_t *pCascade, float_t fInput)
+{
+  float_t fIn = fInput;
+  float_t fOut;
+
+  if (false == pCascade->bPrimed)
+  {
+    float_t fStageIn = fInput;
+    uint8_t i;
+
+    for (i = 0U; i < SPDFLT_STAGE_NBR; i++)
+    {
+      fStageIn = SPDFLT_PrimeStage(&pCascade->fCoeffs[i * SPDFLT_COEFF_NBR], &pCascade->fState[i * 2U], fStageIn);
+    }
+    pCascade->bPrimed = true;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  arm_biquad_cascade_df2T_f32(&pCascade->Cascade, &fIn, &fOut, 1U);
+  return (fOut);
+}
+
+/* Rounds and saturates a filter output */
+static int16_t SPDFLT_ToInt16(float_t fValue)
+{
+  int16_t hValue;
+
+  if (fValue >= 32767.0f)
+  {
+    hValue = INT16_MAX;
+  }
+  else if (fValue <= -32767.0f)
+  {
+    hValue = -INT16_MAX;
+  }
+  else
+  {
+    hValue = (int16_t)((fValue >= 0.0f) ? (fValue + 0.5f) : (fValue - 0.5f));
+  }
+  return (hValue);
+}
+
+/* Tunes the adaptive notch on a speed sample and writes its stage of the speed cascade */
+static void SPDFLT_Adapt(SPDFLT_Handle_t *pHandle, float_t fInput)
+{
+  SPDFLT_Cascade_t *pCascade = &pHandle->Chain[SPDFLT_SPEED];
+  float_t *pCoeffs = &pCascade->fCoeffs[SPDFLT_ADAPTIVE_STAGE * SPDFLT_COEFF_NBR];
+  float_t fHighPass = pHandle->fHighPassPole * ((pHandle->fHighPassOut + fInput) - pHandle->fHighPassIn);
+  float_t fA = pHandle->fA;
+  float_t fS = fHighPass - (SPDFLT_ADAPT_RADIUS * fA * pHandle->fS1)
+             - (SPDFLT_ADAPT_RADIUS * SPDFLT_ADAPT_RADIUS * pHandle->fS2);
+  float_t fE = fS + (fA * pHandle->fS1) + pHandle->fS2;
+  bool bLocked = pHandle->bLocked;
+
+  pHandle->fHighPassIn = fInput;
+  pHandle->fHighPassOut = fHighPass;
+  pHandle->fPowerS += SPDFLT_POWER_GAIN * ((pHandle->fS1 * pHandle->fS1) - pHandle->fPowerS);
+  pHandle->fPowerIn += SPDFLT_POWER_GAIN * ((fHighPass * fHighPass) - pHandle->fPowerIn);
+  pHandle->fPowerOut += SPDFLT_POWER_GAIN * ((fE * fE) - pHandle->fPowerOut);
+
+  /* Without vibration, the notch and its frequency are kept: the resonance it suppresses would come back */
+  if (pHandle->fPowerIn >= pHandle->fAdaptMinPower)
+  {
+    /* The output depends on a through the zeros, the poles follow slowly enough to be neglected */
+    fA -= (pHandle->fAdaptStep * fE * pHandle->fS1) / (pHandle->fPowerS + SPDFLT_POWER_MIN);
+    if (fA < pHandle->fAMin)
+    {
+      fA = pHandle->fAMin;
+    }
+    else if (fA > pHandle->fAMax)
+    {
+      fA = pHandle->fAMax;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pHandle->fA = fA;
+
+    /* Locked when the notch removes three quarters of the vibration power, released below half of it */
+    if ((4.0f * pHandle->fPowerOut) < pHandle->fPowerIn)
+    {
+      bLocked = true;
+    }
+    else if ((2.0f * pHandle->fPowerOut) > pHandle->fPowerIn)
+    {
+      bLocked = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  pHandle->fS2 = pHandle->fS1;
+  pHandle->fS1 = fS;
+
+  if (true == bLocked)
+  {
+    SPDFLT_DesignNotchCos(pCoeffs, -0.5f * fA, pHandle->fNotchQ);
+  }
+  else
+  {
+    SPDFLT_DesignIdentity(pCoeffs);
+  }
+  if (bLocked != pHandle->bLocked)
+  {
+    /* The stage is the first of the cascade, its input is the speed */
+    (void)SPDFLT_PrimeStage(pCoeffs, &pCascade->fState[SPDFLT_ADAPTIVE_STAGE * 2U], fInput);
+    pHandle->bLocked = bLocked;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Initializes the Speed Loop Filter component.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  */
+__weak void SPDFLT_Init(SPDFLT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float_t fFs = pHandle->fSamplingFreq_Hz;
+    float_t *pSpeed = pHandle->Chain[SPDFLT_SPEED].fCoeffs;
+    float_t *pTorque = pHandle->Chain[SPDFLT_TORQUE].fCoeffs;
+    uint8_t i;
+
+    for (i = 0U; i < SPDFLT_STAGE_NBR; i++)
+    {
+      SPDFLT_DesignIdentity(&pSpeed[i * SPDFLT_COEFF_NBR]);
+      SPDFLT_DesignIdentity(&pTorque[i * SPDFLT_COEFF_NBR]);
+    }
+    if (pHandle->fSpeedNotch_Hz > 0.0f)
+    {
+      SPDFLT_DesignNotch(&pSpeed[1U * SPDFLT_COEFF_NBR], pHandle->fSpeedNotch_Hz, pHandle->fNotchQ, fFs);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (pHandle->fSpeedLowPass_Hz > 0.0f)
+    {
+      SPDFLT_DesignLowPass(&pSpeed[2U * SPDFLT_COEFF_NBR], pHandle->fSpeedLowPass_Hz, fFs);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (pHandle->fTorqueLowPass_Hz > 0.0f)
+    {
+      SPDFLT_DesignLowPass(&pTorque[0U * SPDFLT_COEFF_NBR], pHandle->fTorqueLowPass_Hz, fFs);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    arm_biquad_cascade_df2T_init_f32(&pHandle->Chain[SPDFLT_SPEED].Cascade, (uint8_t)SPDFLT_STAGE_NBR, pSpeed,
+                                     pHandle->Chain[SPDFLT_SPEED].fState);
+    arm_biquad_cascade_df2T_init_f32(&pHandle->Chain[SPDFLT_TORQUE].Cascade, (uint8_t)SPDFLT_STAGE_NBR, pTorque,
+                                     pHandle->Chain[SPDFLT_TORQUE].fState);
+
+    /* The adaptation starts from the geometric mean of its range */
+    pHandle->fAMin = -2.0f * cosf((2.0f * PI * pHandle->fAdaptMin_Hz) / fFs);
+    pHandle->fAMax = -2.0f * cosf((2.0f * PI * pHandle->fAdaptMax_Hz) / fFs);
+    pHandle->fA = -2.0f * cosf((2.0f * PI * sqrtf(pHandle->fAdaptMin_Hz * pHandle->fAdaptMax_Hz)) / fFs);
+    pHandle->fHighPassPole = 1.0f - ((PI * pHandle->fAdaptMin_Hz) / fFs);
+    pHandle->bLocked = false;
+    pHandle->bPendingStage = 0U;
+    SPDFLT_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+}
+
+/**
+  * @brief  Restarts the filters in the steady state of their next samples, to be called when the drive
+  *         stops. The frequency of the adaptive notch is kept.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  */
+__weak void SPDFLT_Clear(SPDFLT_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Chain[SPDFLT_SPEED].bPrimed = false;
+    pHandle->Chain[SPDFLT_TORQUE].bPrimed = false;
+    pHandle->fPowerS = 0.0f;
+    pHandle->fPowerIn = 0.0f;
+    pHandle->fPowerOut = 0.0f;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+}
+
+/**
+  * @brief  Filters the speed feedback of the speed regulator, and applies the coefficients written by the
+  *         Motor Control Protocol.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  * @param  hMecSpeedUnit: measured speed, #SPEED_UNIT.
+  * @retval Speed filtered, #SPEED_UNIT.
+  *
+  * To be called once per period of the speed regulator, before SPDFLT_FilterTorque.
+  */
+__weak int16_t SPDFLT_FilterSpeed(SPDFLT_Handle_t *pHandle, int16_t hMecSpeedUnit)
+{
+  int16_t hSpeed;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if (MC_NULL == pHandle)
+  {
+    hSpeed = hMecSpeedUnit;
+  }
+  else
+  {
+#endif
+    float_t fInput = (float_t)hMecSpeedUnit;
+    uint8_t bPending = pHandle->bPendingStage;
+
+    if (0U != bPending)
+    {
+      uint8_t bIndex = bPending - 1U;
+      SPDFLT_Cascade_t *pCascade = &pHandle->Chain[bIndex / SPDFLT_STAGE_NBR];
+      uint8_t i;
+
+      for (i = 0U; i < SPDFLT_COEFF_NBR; i++)
+      {
+        pCascade->fCoeffs[((bIndex % SPDFLT_STAGE_NBR) * SPDFLT_COEFF_NBR) + i] = pHandle->fPending[i];
+      }
+      pCascade->bPrimed = false;
+      pHandle->bPendingStage = 0U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (false == pHandle->Chain[SPDFLT_SPEED].bPrimed)
+    {
+      pHandle->fHighPassIn = fInput;
+      pHandle->fHighPassOut = 0.0f;
+      pHandle->fS1 = 0.0f;
+      pHandle->fS2 = 0.0f;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (true == pHandle->bAdaptive)
+    {
+      SPDFLT_Adapt(pHandle, fInput);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    hSpeed = SPDFLT_ToInt16(SPDFLT_Run(&pHandle->Chain[SPDFLT_SPEED], fInput));
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+  return (hSpeed);
+}
+
+/**
+  * @brief  Filters the torque reference output by the speed regulator.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  * @param  hTorqueRef: torque reference, Iq digit.
+  * @retval Torque reference filtered, Iq digit.
+  */
+__weak int16_t SPDFLT_FilterTorque(SPDFLT_Handle_t *pHandle, int16_t hTorqueRef)
+{
+  int16_t hTorque;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if (MC_NULL == pHandle)
+  {
+    hTorque = hTorqueRef;
+  }
+  else
+  {
+#endif
+    hTorque = SPDFLT_ToInt16(SPDFLT_Run(&pHandle->Chain[SPDFLT_TORQUE], (float_t)hTorqueRef));
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+  return (hTorque);
+}
+
+/**
+  * @brief  Writes the coefficients of a biquad, applied by the next period of the speed regulator.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  * @param  Chain: cascade of the biquad.
+  * @param  bStage: biquad in the cascade, 0 to #SPDFLT_STAGE_NBR - 1.
+  * @param  pCoeffs: b0, b1, b2, a1, a2, the a coefficients negated as in CMSIS-DSP.
+  * @retval false if the stage does not exist or belongs to the adaptive notch, if its poles are outside
+  *         the unit circle, or if the previous coefficients are not applied yet.
+  */
+__weak bool SPDFLT_SetCoefficients(SPDFLT_Handle_t *pHandle, SPDFLT_Chain_t Chain, uint8_t bStage,
+                                   const float_t *pCoeffs)
+{
+  bool bRetVal = false;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if ((MC_NULL == pHandle) || (MC_NULL == pCoeffs))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((Chain >= SPDFLT_CHAIN_NBR) || (bStage >= SPDFLT_STAGE_NBR) || (0U != pHandle->bPendingStage))
+    {
+      /* Nothing to do */
+    }
+    else if ((true == pHandle->bAdaptive) && (SPDFLT_SPEED == Chain) && (SPDFLT_ADAPTIVE_STAGE == bStage))
+    {
+      /* Nothing to do */
+    }
+    else if (false == SPDFLT_IsStable(pCoeffs))
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      uint8_t i;
+
+      for (i = 0U; i < SPDFLT_COEFF_NBR; i++)
+      {
+        pHandle->fPending[i] = pCoeffs[i];
+      }
+      /* Written last, the speed regulator may interrupt the copy */
+      pHandle->bPendingStage = (uint8_t)(((uint8_t)Chain * SPDFLT_STAGE_NBR) + bStage + 1U);
+      bRetVal = true;
+    }
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+  return (bRetVal);
+}
+
+/**
+  * @brief  Reads the coefficients of a biquad.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  * @param  Chain: cascade of the biquad.
+  * @param  bStage: biquad in the cascade, 0 to #SPDFLT_STAGE_NBR - 1.
+  * @param  pCoeffs: b0, b1, b2, a1, a2, the a coefficients negated as in CMSIS-DSP.
+  * @retval false if the stage does not exist.
+  */
+__weak bool SPDFLT_GetCoefficients(const SPDFLT_Handle_t *pHandle, SPDFLT_Chain_t Chain, uint8_t bStage,
+                                   float_t *pCoeffs)
+{
+  bool bRetVal = false;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if ((MC_NULL == pHandle) || (MC_NULL == pCoeffs))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((Chain < SPDFLT_CHAIN_NBR) && (bStage < SPDFLT_STAGE_NBR))
+    {
+      uint8_t i;
+
+      for (i = 0U; i < SPDFLT_COEFF_NBR; i++)
+      {
+        pCoeffs[i] = pHandle->Chain[Chain].fCoeffs[(bStage * SPDFLT_COEFF_NBR) + i];
+      }
+      bRetVal = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+  return (bRetVal);
+}
+
+/**
+  * @brief  Designs a notch biquad of unity gain out of its band.
+  * @param  pCoeffs: b0, b1, b2, a1, a2 written.
+  * @param  fFreq_Hz: centre frequency, below half of fSamplingFreq_Hz.
+  * @param  fQ: quality factor, centre frequency over the -3 dB width.
+  * @param  fSamplingFreq_Hz: sampling frequency.
+  */
+__weak void SPDFLT_DesignNotch(float_t *pCoeffs, float_t fFreq_Hz, float_t fQ, float_t fSamplingFreq_Hz)
+{
+  SPDFLT_DesignNotchCos(pCoeffs, cosf((2.0f * PI * fFreq_Hz) / fSamplingFreq_Hz), fQ);
+}
+
+/**
+  * @brief  Designs a second order Butterworth low pass biquad.
+  * @param  pCoeffs: b0, b1, b2, a1, a2 written.
+  * @param  fFreq_Hz: -3 dB frequency, below half of fSamplingFreq_Hz.
+  * @param  fSamplingFreq_Hz: sampling frequency.
+  */
+__weak void SPDFLT_DesignLowPass(float_t *pCoeffs, float_t fFreq_Hz, float_t fSamplingFreq_Hz)
+{
+  float_t fW = (2.0f * PI * fFreq_Hz) / fSamplingFreq_Hz;
+  float_t fCos = cosf(fW);
+  float_t fAlpha = sinf(fW) * 0.70710678f;
+  float_t fNorm = 1.0f / (1.0f + fAlpha);
+
+  pCoeffs[0] = 0.5f * (1.0f - fCos) * fNorm;
+  pCoeffs[1] = (1.0f - fCos) * fNorm;
+  pCoeffs[2] = pCoeffs[0];
+  pCoeffs[3] = 2.0f * fCos * fNorm;
+  pCoeffs[4] = (fAlpha - 1.0f) * fNorm;
+}
+
+/**
+  * @brief  Returns the frequency of the adaptive notch, Hz, 0 when it is released.
+  * @param  pHandle: handler of the current instance of the Speed Loop Filter component.
+  */
+__weak float_t SPDFLT_GetNotchFrequency(const SPDFLT_Handle_t *pHandle)
+{
+  float_t fFreq_Hz = 0.0f;
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (true == pHandle->bLocked)
+    {
+      fFreq_Hz = (acosf(-0.5f * pHandle->fA) * pHandle->fSamplingFreq_Hz) / (2.0f * PI);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SPD_FLT
+  }
+#endif
+  return (fFreq_Hz);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
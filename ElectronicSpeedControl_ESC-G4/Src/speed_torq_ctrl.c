@@ -452,8 +452,47 @@ __weak int16_t STC_CalcTorqueReference(SpeednTorqCtrl_Handle_t *pHandle)
       hTargetSpeed = (int16_t)(wCurrentReference / 65536);
 #endif
       hMeasuredSpeed = SPD_GetAvrgMecSpeedUnit(pHandle->SPD);
+      if (MC_NULL != pHandle->SpeedFilter)
+      {
+        hMeasuredSpeed = SPDFLT_FilterSpeed(pHandle->SpeedFilter, hMeasuredSpeed);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
       hError = hTargetSpeed - hMeasuredSpeed;
       hTorqueReference = PI_Controller(pHandle->PISpeed, (int32_t)hError);
+      if (MC_NULL != pHandle->LoadObserver)
+      {
+        /* The load torque is fed forward, within the limits of the speed regulator */
+        int32_t wTorqueReference = (int32_t)hTorqueReference
+                                 + (int32_t)LTO_Update(pHandle->LoadObserver, hMeasuredSpeed);
+
+        if (wTorqueReference > (int32_t)pHandle->PISpeed->hUpperOutputLimit)
+        {
+          hTorqueReference = pHandle->PISpeed->hUpperOutputLimit;
+        }
+        else if (wTorqueReference < (int32_t)pHandle->PISpeed->hLowerOutputLimit)
+        {
+          hTorqueReference = pHandle->PISpeed->hLowerOutputLimit;
+        }
+        else
+        {
+          hTorqueReference = (int16_t)wTorqueReference;
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if (MC_NULL != pHandle->SpeedFilter)
+      {
+        hTorqueReference = SPDFLT_FilterTorque(pHandle->SpeedFilter, hTorqueReference);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
 
       pHandle->SpeedRefUnitExt = wCurrentReference;
       pHandle->TorqueRef = ((int32_t)hTorqueReference) * 65536;
@@ -467,6 +506,25 @@ __weak int16_t STC_CalcTorqueReference(SpeednTorqCtrl_Handle_t *pHandle)
 #else
       hTorqueReference = (int16_t)(wCurrentReference / 65536);
 #endif
+      if (MC_NULL != pHandle->SpeedFilter)
+      {
+        /* The filters follow the drive, for a smooth switch to the speed mode */
+        (void)SPDFLT_FilterSpeed(pHandle->SpeedFilter, SPD_GetAvrgMecSpeedUnit(pHandle->SPD));
+        (void)SPDFLT_FilterTorque(pHandle->SpeedFilter, hTorqueReference);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if (MC_NULL != pHandle->LoadObserver)
+      {
+        /* The observer follows the drive, its load is fed forward from the switch to the speed mode */
+        (void)LTO_Update(pHandle->LoadObserver, SPD_GetAvrgMecSpeedUnit(pHandle->SPD));
+      }
+      else
+      {
+        /* Nothing to do */
+      }
     }
 #ifdef NULL_PTR_CHECK_SPD_TRQ_CTL
   }
@@ -60,6 +60,7 @@
 void EXTI15_10_IRQHandler(void);
 void HardFault_Handler(void);
 void SysTick_Handler(void);
+void PendSV_Handler(void);
 
 /* This section is present only when MCP over UART_A is used */
 /**
@@ -195,6 +196,16 @@ static uint8_t SystickDividerCounter = SYSTICK_DIVIDER;
   {
     /* Nothing to do */
   }
+  /* The packet is processed by the deferred MCP task, a packet received during the boot being
+     processed once it is completed */
+  if (true == ASPEP_IsPacketPending(&aspepOverUartA))
+  {
+    MC_TriggerMCPTask();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
   /* USER CODE BEGIN SysTick_IRQn 1 */
 
   /* USER CODE END SysTick_IRQn 1 */
@@ -206,6 +217,23 @@ static uint8_t SystickDividerCounter = SYSTICK_DIVIDER;
   /* USER CODE END SysTick_IRQn 2 */
 }
 
+/**
+  * @brief  This function handles the PendSV exception, pended by the Systick to run the
+  *         deferred Motor Control tasks.
+  */
+void PendSV_Handler(void)
+{
+  /* USER CODE BEGIN PendSV_IRQn 0 */
+
+  /* USER CODE END PendSV_IRQn 0 */
+
+  MC_RunDeferredTasks();
+
+  /* USER CODE BEGIN PendSV_IRQn 1 */
+
+  /* USER CODE END PendSV_IRQn 1 */
+}
+
 /**
   * @brief  This function handles Button IRQ on PIN PC10.
 
@@ -56,6 +56,10 @@
 void ADC1_2_IRQHandler(void);
 void TIMx_UP_M1_IRQHandler(void);
 void TIMx_BRK_M1_IRQHandler(void);
+#if ((THR_INPUT_ENABLE == 1) && (THR_DSHOT_TELEMETRY_ENABLE == 1))
+void THR_TLM_TIM_IRQHandler(void);
+void THR_TLM_DMA_IRQHandler(void);
+#endif
 
 #if defined (CCMRAM)
 #if defined (__ICCARM__)
@@ -108,6 +112,9 @@ void TIMx_UP_M1_IRQHandler(void)
 
   LL_TIM_ClearFlag_UPDATE(TIM1);
   (void)R3_2_TIMx_UP_IRQHandler(&PWM_Handle_M1);
+#if (NBR_OF_MOTORS > 1)
+  TSK_DualDriveFIFOUpdate(M1);
+#endif
 
  /* USER CODE BEGIN TIMx_UP_M1_IRQn 1 */
 
@@ -140,14 +147,34 @@ void TIMx_BRK_M1_IRQHandler(void)
     PWMC_OVP_Handler(&PWM_Handle_M1._Super, TIM1);
   }
 
-  /* Systick is not executed due low priority so is necessary to call MC_Scheduler here */
-  MC_RunMotorControlTasks();
+  /* The fault is processed at once, the Systick keeping the period of the other tasks */
+  MC_TriggerSafetyTask();
 
   /* USER CODE BEGIN TIMx_BRK_M1_IRQn 1 */
 
   /* USER CODE END TIMx_BRK_M1_IRQn 1 */
 }
 
+#if ((THR_INPUT_ENABLE == 1) && (THR_DSHOT_TELEMETRY_ENABLE == 1))
+/**
+  * @brief  This function handles the end of the bidirectional DShot frames.
+  * @param  None
+  */
+void THR_TLM_TIM_IRQHandler(void)
+{
+  THR_FrameEnd_IRQHandler(&ThrottleInputM1);
+}
+
+/**
+  * @brief  This function handles the end of the bidirectional DShot replies.
+  * @param  None
+  */
+void THR_TLM_DMA_IRQHandler(void)
+{
+  THR_ReplyEnd_IRQHandler(&ThrottleInputM1);
+}
+#endif
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
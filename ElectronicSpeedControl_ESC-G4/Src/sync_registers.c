@@ -164,10 +164,78 @@ uint8_t RI_SetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint
   return (retVal);
 }
 
-uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+/* Hides the registers of the components instantiated for motor 1 only, the self commissioning, the
+   stator temperature estimation and the cogging compensation: for the other motors, they become element 0 of their type that
+   no 8, 16 or 32 bit register uses */
+static uint16_t RI_MotorRegID(uint8_t motorID, uint16_t regID)
+{
+  uint16_t retID = regID;
+
+  if (M1 == motorID)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    switch (regID)
+    {
+      case MC_REG_SC_STATE:
+      case MC_REG_SC_STEPS:
+      case MC_REG_SC_COMPLETED:
+      case MC_REG_SC_PP:
+      case MC_REG_SC_FOC_REP_RATE:
+      case MC_REG_SC_RS:
+      case MC_REG_SC_LS:
+      case MC_REG_SC_KE:
+      case MC_REG_SC_VBUS:
+      case MC_REG_SC_MEAS_NOMINALSPEED:
+      case MC_REG_SC_CURRENT:
+      case MC_REG_SC_SPDBANDWIDTH:
+      case MC_REG_SC_LDLQRATIO:
+      case MC_REG_SC_NOMINAL_SPEED:
+      case MC_REG_SC_CURRBANDWIDTH:
+      case MC_REG_SC_J:
+      case MC_REG_SC_F:
+      case MC_REG_SC_MAX_CURRENT:
+      case MC_REG_SC_STARTUP_SPEED:
+      case MC_REG_SC_STARTUP_ACC:
+      case MC_REG_WINDING_TEMP:
+      case MC_REG_COGGING_MODE:
+      case MC_REG_COGGING_ITERATIONS:
+      case MC_REG_VIB_SPEED:
+      case MC_REG_VIB_HARMONIC_1:
+      case MC_REG_VIB_HARMONIC_2:
+      case MC_REG_VIB_HARMONIC_N:
+      case MC_REG_VIB_CYCLES:
+      case MC_REG_ANOMALY_FLAG:
+      case MC_REG_ANOMALY_SCORE:
+      case MC_REG_ANOMALY_CYCLES:
+      case MC_REG_LOAD_FEEDFORWARD:
+      case MC_REG_LOAD_TORQUE:
+      case MC_REG_CURRENT_DEADBEAT:
+      case MC_REG_CURRENT_CTRL_CYCLES:
+      case MC_REG_DEADBEAT_FALLBACKS:
+      {
+        retID = regID & TYPE_MASK;
+        break;
+      }
+
+      default:
+      {
+        /* Nothing to do */
+        break;
+      }
+    }
+  }
+  return (retID);
+}
+
+/* Writes a register of a motor, the handles of the motor selected by motorID */
+static uint8_t RI_SetRegisterMotor(uint8_t motorID, uint16_t dataRegID, uint8_t typeID, uint8_t *data, uint16_t *size,
+                                   int16_t dataAvailable)
 {
   uint8_t retVal = MCP_CMD_OK;
-  uint8_t motorID=0;
+  uint16_t regID = RI_MotorRegID(motorID, dataRegID);
   MCI_Handle_t *pMCIN = &Mci[motorID];
 
   switch(typeID)
@@ -177,6 +245,7 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
       switch (regID)
       {
         case MC_REG_STATUS:
+        case MC_REG_ANOMALY_FLAG:
           {
             retVal = MCP_ERROR_RO_REG;
             break;
@@ -206,7 +275,63 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
           break;
         }
 
+#if (COGGING_COMP_ENABLE == 1)
+        case MC_REG_COGGING_MODE:
+        {
+          uint8_t regdata8 = *data;
+
+          if (regdata8 <= (uint8_t)COG_LEARN)
+          {
+            COG_SetMode(&CoggingCompM1, (COG_Mode_t)regdata8);
+          }
+          else
+          {
+            retVal = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+        case MC_REG_LOAD_FEEDFORWARD:
+        {
+          uint8_t regdata8 = *data;
+
+          if (regdata8 <= 1U)
+          {
+            LTO_SetFeedForward(&LoadObserverM1, (1U == regdata8));
+          }
+          else
+          {
+            retVal = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+        case MC_REG_CURRENT_DEADBEAT:
+        {
+          uint8_t regdata8 = *data;
+
+          if (regdata8 <= 1U)
+          {
+            DBC_SetEnabled(&DeadbeatCurrM1, (1U == regdata8));
+          }
+          else
+          {
+            retVal = MCP_CMD_NOK;
+          }
+          break;
+        }
+
+#endif
         case MC_REG_RUC_STAGE_NBR:
+        case MC_REG_SC_STATE:
+        case MC_REG_SC_STEPS:
+        case MC_REG_SC_COMPLETED:
+        case MC_REG_SC_PP:
+        case MC_REG_SC_FOC_REP_RATE:
         {
           retVal = MCP_ERROR_RO_REG;
           break;
@@ -230,60 +355,69 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
 
         case MC_REG_SPEED_KP:
         {
-          PID_SetKP(&PIDSpeedHandle_M1, (int16_t)regdata16);
+          PID_SetKP(pPIDSpeed[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_SPEED_KI:
         {
-          PID_SetKI(&PIDSpeedHandle_M1, (int16_t)regdata16);
+          PID_SetKI(pPIDSpeed[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_SPEED_KD:
         {
-          PID_SetKD(&PIDSpeedHandle_M1, (int16_t)regdata16);
+          PID_SetKD(pPIDSpeed[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_Q_KP:
         {
-          PID_SetKP(&PIDIqHandle_M1, (int16_t)regdata16);
+          PID_SetKP(pPIDIq[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_Q_KI:
         {
-          PID_SetKI(&PIDIqHandle_M1, (int16_t)regdata16);
+          PID_SetKI(pPIDIq[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_Q_KD:
         {
-          PID_SetKD(&PIDIqHandle_M1, (int16_t)regdata16);
+          PID_SetKD(pPIDIq[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_D_KP:
         {
-          PID_SetKP(&PIDIdHandle_M1, (int16_t)regdata16);
+          PID_SetKP(pPIDId[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_D_KI:
         {
-          PID_SetKI(&PIDIdHandle_M1, (int16_t)regdata16);
+          PID_SetKI(pPIDId[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_I_D_KD:
         {
-          PID_SetKD(&PIDIdHandle_M1, (int16_t)regdata16);
+          PID_SetKD(pPIDId[motorID], (int16_t)regdata16);
           break;
         }
 
         case MC_REG_BUS_VOLTAGE:
         case MC_REG_HEATS_TEMP:
+        case MC_REG_WINDING_TEMP:
+        case MC_REG_SPEED_NOTCH_FREQ:
+        case MC_REG_COGGING_ITERATIONS:
+        case MC_REG_VIB_SPEED:
+        case MC_REG_VIB_HARMONIC_1:
+        case MC_REG_VIB_HARMONIC_2:
+        case MC_REG_VIB_HARMONIC_N:
+        case MC_REG_ANOMALY_SCORE:
+        case MC_REG_LOAD_TORQUE:
         case MC_REG_MOTOR_POWER:
         {
           retVal = MCP_ERROR_RO_REG;
@@ -333,8 +467,8 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
         {
           int16_t hC1;
           int16_t hC2;
-          STO_PLL_GetObserverGains(&STO_PLL_M1, &hC1, &hC2);
-          STO_PLL_SetObserverGains(&STO_PLL_M1, (int16_t)regdata16, hC2);
+          STO_PLL_GetObserverGains(pSTO_PLL[motorID], &hC1, &hC2);
+          STO_PLL_SetObserverGains(pSTO_PLL[motorID], (int16_t)regdata16, hC2);
           break;
         }
 
@@ -342,20 +476,20 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
         {
           int16_t hC1;
           int16_t hC2;
-          STO_PLL_GetObserverGains(&STO_PLL_M1, &hC1, &hC2);
-          STO_PLL_SetObserverGains(&STO_PLL_M1, hC1, (int16_t)regdata16);
+          STO_PLL_GetObserverGains(pSTO_PLL[motorID], &hC1, &hC2);
+          STO_PLL_SetObserverGains(pSTO_PLL[motorID], hC1, (int16_t)regdata16);
           break;
         }
 
         case MC_REG_STOPLL_KI:
         {
-          PID_SetKI (&(&STO_PLL_M1)->PIRegulator, (int16_t)regdata16);
+          PID_SetKI (&pSTO_PLL[motorID]->PIRegulator, (int16_t)regdata16);
           break;
         }
 
         case MC_REG_STOPLL_KP:
         {
-          PID_SetKP (&(&STO_PLL_M1)->PIRegulator, (int16_t)regdata16);
+          PID_SetKP (&pSTO_PLL[motorID]->PIRegulator, (int16_t)regdata16);
           break;
         }
 
@@ -376,67 +510,67 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
 
         case MC_REG_SPEED_KP_DIV:
         {
-          PID_SetKPDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
+          PID_SetKPDivisorPOW2(pPIDSpeed[motorID], regdata16);
           break;
         }
 
         case MC_REG_SPEED_KI_DIV:
         {
-          PID_SetKIDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
+          PID_SetKIDivisorPOW2(pPIDSpeed[motorID], regdata16);
           break;
         }
 
         case MC_REG_SPEED_KD_DIV:
         {
-          PID_SetKDDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
+          PID_SetKDDivisorPOW2(pPIDSpeed[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_D_KP_DIV:
         {
-          PID_SetKPDivisorPOW2(&PIDIdHandle_M1, regdata16);
+          PID_SetKPDivisorPOW2(pPIDId[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_D_KI_DIV:
         {
-          PID_SetKIDivisorPOW2(&PIDIdHandle_M1, regdata16);
+          PID_SetKIDivisorPOW2(pPIDId[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_D_KD_DIV:
         {
-          PID_SetKDDivisorPOW2(&PIDIdHandle_M1, regdata16);
+          PID_SetKDDivisorPOW2(pPIDId[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_Q_KP_DIV:
         {
-          PID_SetKPDivisorPOW2(&PIDIqHandle_M1, regdata16);
+          PID_SetKPDivisorPOW2(pPIDIq[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_Q_KI_DIV:
         {
-          PID_SetKIDivisorPOW2(&PIDIqHandle_M1, regdata16);
+          PID_SetKIDivisorPOW2(pPIDIq[motorID], regdata16);
           break;
         }
 
         case MC_REG_I_Q_KD_DIV:
         {
-          PID_SetKDDivisorPOW2(&PIDIqHandle_M1, regdata16);
+          PID_SetKDDivisorPOW2(pPIDIq[motorID], regdata16);
           break;
         }
 
         case MC_REG_STOPLL_KI_DIV:
         {
-          PID_SetKIDivisorPOW2 (&(&STO_PLL_M1)->PIRegulator,regdata16);
+          PID_SetKIDivisorPOW2 (&pSTO_PLL[motorID]->PIRegulator,regdata16);
           break;
         }
 
         case MC_REG_STOPLL_KP_DIV:
         {
-          PID_SetKPDivisorPOW2 (&(&STO_PLL_M1)->PIRegulator,regdata16);
+          PID_SetKPDivisorPOW2 (&pSTO_PLL[motorID]->PIRegulator,regdata16);
           break;
         }
 
@@ -477,11 +611,63 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
 
         case MC_REG_STOPLL_EST_BEMF:
         case MC_REG_STOPLL_OBS_BEMF:
+        case MC_REG_SC_RS:
+        case MC_REG_SC_LS:
+        case MC_REG_SC_KE:
+        case MC_REG_SC_VBUS:
+        case MC_REG_SC_MEAS_NOMINALSPEED:
+        case MC_REG_SC_J:
+        case MC_REG_SC_F:
+        case MC_REG_SC_MAX_CURRENT:
+        case MC_REG_SC_STARTUP_SPEED:
+        case MC_REG_SC_STARTUP_ACC:
+        case MC_REG_VIB_CYCLES:
+        case MC_REG_ANOMALY_CYCLES:
+        case MC_REG_CURRENT_CTRL_CYCLES:
+        case MC_REG_DEADBEAT_FALLBACKS:
         {
           retVal = MCP_ERROR_RO_REG;
           break;
         }
 
+#if (SELF_COMMISSIONING_ENABLE == 1)
+        case MC_REG_SC_CURRENT:
+        case MC_REG_SC_SPDBANDWIDTH:
+        case MC_REG_SC_LDLQRATIO:
+        case MC_REG_SC_NOMINAL_SPEED:
+        case MC_REG_SC_CURRBANDWIDTH:
+        {
+          FloatToU32 WriteVal; //cstat !MISRAC2012-Rule-19.2
+          WriteVal.U32_Val = regdata32; //cstat !UNION-type-punning
+
+          if (true == SCC_IsOngoing(&SCC_M1))
+          {
+            retVal = MCP_CMD_NOK; /* Settings of the self commissioning are taken at its start */
+          }
+          else if (MC_REG_SC_CURRENT == regID)
+          {
+            SCC_SetNominalCurrent(&SCC_M1, WriteVal.Float_Val);
+          }
+          else if (MC_REG_SC_SPDBANDWIDTH == regID)
+          {
+            OTT_SetSpeedRegulatorBandwidth(&OTT_M1, WriteVal.Float_Val);
+          }
+          else if (MC_REG_SC_LDLQRATIO == regID)
+          {
+            SCC_SetLdLqRatio(&SCC_M1, WriteVal.Float_Val);
+          }
+          else if (MC_REG_SC_NOMINAL_SPEED == regID)
+          {
+            SCC_SetNominalSpeed(&SCC_M1, (int32_t)regdata32);
+          }
+          else
+          {
+            SCC_SetCurrentBandwidth(&SCC_M1, WriteVal.Float_Val);
+          }
+          break;
+        }
+
+#endif
         default:
         {
           retVal = MCP_ERROR_UNKNOWN_REG;
@@ -573,7 +759,7 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
               revUpPhase.hFinalMecSpeedUnit = (((int16_t)rpm) * ((int16_t)SPEED_UNIT)) / ((int16_t)U_RPM);
               revUpPhase.hFinalTorque = *((int16_t *) &rawData[4U + (i * 8U)]); //cstat !MISRAC2012-Rule-11.3
               revUpPhase.hDurationms  = *((uint16_t *) &rawData[6U +(i * 8U)]); //cstat !MISRAC2012-Rule-11.3
-              (void)RUC_SetPhase(&RevUpControlM1, i, &revUpPhase);
+              (void)RUC_SetPhase(pRevUpCtrl[motorID], i, &revUpPhase);
               }
             }
             break;
@@ -587,6 +773,35 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
             MCI_SetCurrentReferences(pMCIN, currComp);
             break;
           }
+
+          case MC_REG_SPEED_FILTER:
+          {
+            /* Chain, stage, then b0, b1, b2, a1, a2 in float, the a coefficients negated */
+            float_t coeffs[SPDFLT_COEFF_NBR];
+            SPDFLT_Handle_t *pSpeedFilter = pSTC[motorID]->SpeedFilter;
+
+            if (MC_NULL == pSpeedFilter)
+            {
+              retVal = MCP_ERROR_UNKNOWN_REG;
+            }
+            else if (rawSize != (2U + sizeof(coeffs)))
+            {
+              retVal = MCP_ERROR_BAD_RAW_FORMAT;
+            }
+            else
+            {
+              (void)memcpy(coeffs, &rawData[2], sizeof(coeffs));
+              if (false == SPDFLT_SetCoefficients(pSpeedFilter, (SPDFLT_Chain_t)rawData[0], rawData[1], coeffs))
+              {
+                retVal = MCP_ERROR_REGISTER_ACCESS;
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+            }
+            break;
+          }
           case MC_REG_ASYNC_UARTA:
           {
             retVal =  MCPA_cfgLog (&MCPA_UART_A, rawData);
@@ -613,6 +828,20 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
   return (retVal);
 }
 
+/* Writes a register of motor 1 */
+uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  return (RI_SetRegisterMotor(M1, regID, typeID, data, size, dataAvailable));
+}
+
+#if (NBR_OF_MOTORS > 1)
+/* Writes a register of motor 2 */
+uint8_t RI_SetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  return (RI_SetRegisterMotor(M2, regID, typeID, data, size, dataAvailable));
+}
+#endif
+
 uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16_t *size,int16_t freeSpace){
     uint8_t retVal = MCP_CMD_OK;
     switch (typeID)
@@ -758,11 +987,14 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
   return (retVal);
 }
 
-  uint8_t RI_GetRegisterMotor1(uint16_t regID,uint8_t typeID,uint8_t * data,uint16_t *size,int16_t freeSpace) {
+/* Reads a register of a motor, the handles of the motor selected by motorID */
+  static uint8_t RI_GetRegisterMotor(uint8_t motorID, uint16_t dataRegID, uint8_t typeID, uint8_t *data, uint16_t *size,
+                                     int16_t freeSpace)
+  {
     uint8_t retVal = MCP_CMD_OK;
-    uint8_t motorID=0;
+    uint16_t regID = RI_MotorRegID(motorID, dataRegID);
     MCI_Handle_t *pMCIN = &Mci[motorID];
-    BusVoltageSensor_Handle_t* BusVoltageSensor= &BusVoltageSensor_M1._Super;
+    BusVoltageSensor_Handle_t* BusVoltageSensor= &pBusSensor[motorID]->_Super;
     switch (typeID)
     {
       case TYPE_DATA_8BIT:
@@ -785,10 +1017,75 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
 
             case MC_REG_RUC_STAGE_NBR:
             {
-              *data = (uint8_t)RUC_GetNumberOfPhases(&RevUpControlM1);
+              *data = (uint8_t)RUC_GetNumberOfPhases(pRevUpCtrl[motorID]);
+              break;
+            }
+
+#if (SELF_COMMISSIONING_ENABLE == 1)
+            case MC_REG_SC_STATE:
+            {
+              *data = SCC_GetState(&SCC_M1);
               break;
             }
 
+            case MC_REG_SC_STEPS:
+            {
+              *data = SCC_GetSteps(&SCC_M1) + OTT_GetSteps(&OTT_M1);
+              break;
+            }
+
+            case MC_REG_SC_COMPLETED:
+            {
+              *data = (uint8_t)OTT_IsMotorAlreadyProfiled(&OTT_M1);
+              break;
+            }
+
+            case MC_REG_SC_PP:
+            {
+              *data = (uint8_t)SCC_M1.fPP;
+              break;
+            }
+
+            case MC_REG_SC_FOC_REP_RATE:
+            {
+              *data = SCC_GetFOCRepRate(&SCC_M1);
+              break;
+            }
+
+#endif
+#if (COGGING_COMP_ENABLE == 1)
+            case MC_REG_COGGING_MODE:
+            {
+              *data = (uint8_t)COG_GetMode(&CoggingCompM1);
+              break;
+            }
+
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+            case MC_REG_ANOMALY_FLAG:
+            {
+              *data = (true == ANOM_IsAnomaly(&AnomalyDetectorM1)) ? 1U : 0U;
+              break;
+            }
+
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+            case MC_REG_LOAD_FEEDFORWARD:
+            {
+              *data = (true == LTO_IsFeedForward(&LoadObserverM1)) ? 1U : 0U;
+              break;
+            }
+
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+            case MC_REG_CURRENT_DEADBEAT:
+            {
+              *data = (true == DBC_IsEnabled(&DeadbeatCurrM1)) ? 1U : 0U;
+              break;
+            }
+
+#endif
+
             default:
             {
               retVal = MCP_ERROR_UNKNOWN_REG;
@@ -816,55 +1113,55 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
 
             case MC_REG_SPEED_KP:
             {
-              *regdata16 = PID_GetKP(&PIDSpeedHandle_M1);
+              *regdata16 = PID_GetKP(pPIDSpeed[motorID]);
               break;
             }
 
             case MC_REG_SPEED_KI:
             {
-              *regdata16 = PID_GetKI(&PIDSpeedHandle_M1);
+              *regdata16 = PID_GetKI(pPIDSpeed[motorID]);
               break;
             }
 
             case MC_REG_SPEED_KD:
             {
-              *regdata16 = PID_GetKD(&PIDSpeedHandle_M1);
+              *regdata16 = PID_GetKD(pPIDSpeed[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KP:
             {
-              *regdata16 = PID_GetKP(&PIDIqHandle_M1);
+              *regdata16 = PID_GetKP(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KI:
             {
-              *regdata16 = PID_GetKI(&PIDIqHandle_M1);
+              *regdata16 = PID_GetKI(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KD:
             {
-              *regdata16 = PID_GetKD(&PIDIqHandle_M1);
+              *regdata16 = PID_GetKD(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_I_D_KP:
             {
-              *regdata16 = PID_GetKP(&PIDIdHandle_M1);
+              *regdata16 = PID_GetKP(pPIDId[motorID]);
               break;
             }
 
             case MC_REG_I_D_KI:
             {
-              *regdata16 = PID_GetKI(&PIDIdHandle_M1);
+              *regdata16 = PID_GetKI(pPIDId[motorID]);
               break;
             }
 
             case MC_REG_I_D_KD:
             {
-              *regdata16 = PID_GetKD(&PIDIdHandle_M1);
+              *regdata16 = PID_GetKD(pPIDId[motorID]);
               break;
             }
 
@@ -876,10 +1173,80 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
 
             case MC_REG_HEATS_TEMP:
             {
-              *regdata16 = NTC_GetAvTemp_C(&TempSensor_M1);
+              *regdata16 = NTC_GetAvTemp_C(pTemperatureSensor[motorID]);
+              break;
+            }
+
+            case MC_REG_WINDING_TEMP:
+            {
+              *regdata16 = (int16_t)RSTEMP_getTempCelcius(&RSTempM1);
               break;
             }
 
+            case MC_REG_SPEED_NOTCH_FREQ:
+            {
+              if (MC_NULL == pSTC[motorID]->SpeedFilter)
+              {
+                retVal = MCP_ERROR_UNKNOWN_REG;
+              }
+              else
+              {
+                *regdataU16 = (uint16_t)SPDFLT_GetNotchFrequency(pSTC[motorID]->SpeedFilter);
+              }
+              break;
+            }
+
+#if (COGGING_COMP_ENABLE == 1)
+            case MC_REG_COGGING_ITERATIONS:
+            {
+              *regdataU16 = COG_GetIterations(&CoggingCompM1);
+              break;
+            }
+
+#endif
+#if (VIB_MONITOR_ENABLE == 1)
+            case MC_REG_VIB_SPEED:
+            {
+              *regdata16 = (int16_t)(((int32_t)VIB_GetMecSpeedUnit(&VibMonitorM1) * U_RPM) / SPEED_UNIT);
+              break;
+            }
+
+            case MC_REG_VIB_HARMONIC_1:
+            {
+              *regdataU16 = VIB_GetHarmonic(&VibMonitorM1, 0U);
+              break;
+            }
+
+            case MC_REG_VIB_HARMONIC_2:
+            {
+              *regdataU16 = VIB_GetHarmonic(&VibMonitorM1, 1U);
+              break;
+            }
+
+            case MC_REG_VIB_HARMONIC_N:
+            {
+              *regdataU16 = VIB_GetHarmonic(&VibMonitorM1, 2U);
+              break;
+            }
+
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+            case MC_REG_ANOMALY_SCORE:
+            {
+              *regdataU16 = ANOM_GetScore(&AnomalyDetectorM1);
+              break;
+            }
+
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+            case MC_REG_LOAD_TORQUE:
+            {
+              *regdata16 = LTO_GetLoad(&LoadObserverM1);
+              break;
+            }
+
+#endif
+
             case MC_REG_I_A:
             {
               *regdata16 = MCI_GetIab(pMCIN).a;
@@ -955,38 +1322,38 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             case MC_REG_STOPLL_EL_ANGLE:
             {
               //cstat !MISRAC2012-Rule-11.3
-              *regdata16 = SPD_GetElAngle((SpeednPosFdbk_Handle_t *)&STO_PLL_M1);
+              *regdata16 = SPD_GetElAngle(&pSTO_PLL[motorID]->_Super);
               break;
             }
 
             case MC_REG_STOPLL_ROT_SPEED:
             {
               //cstat !MISRAC2012-Rule-11.3
-              *regdata16 = SPD_GetS16Speed((SpeednPosFdbk_Handle_t *)&STO_PLL_M1);
+              *regdata16 = SPD_GetS16Speed(&pSTO_PLL[motorID]->_Super);
               break;
             }
 
             case MC_REG_STOPLL_I_ALPHA:
             {
-              *regdata16 = STO_PLL_GetEstimatedCurrent(&STO_PLL_M1).alpha;
+              *regdata16 = STO_PLL_GetEstimatedCurrent(pSTO_PLL[motorID]).alpha;
               break;
             }
 
             case MC_REG_STOPLL_I_BETA:
             {
-              *regdata16 = STO_PLL_GetEstimatedCurrent(&STO_PLL_M1).beta;
+              *regdata16 = STO_PLL_GetEstimatedCurrent(pSTO_PLL[motorID]).beta;
               break;
             }
 
             case MC_REG_STOPLL_BEMF_ALPHA:
             {
-              *regdata16 = STO_PLL_GetEstimatedBemf(&STO_PLL_M1).alpha;
+              *regdata16 = STO_PLL_GetEstimatedBemf(pSTO_PLL[motorID]).alpha;
               break;
             }
 
             case MC_REG_STOPLL_BEMF_BETA:
             {
-              *regdata16 = STO_PLL_GetEstimatedBemf(&STO_PLL_M1).beta;
+              *regdata16 = STO_PLL_GetEstimatedBemf(pSTO_PLL[motorID]).beta;
               break;
             }
 
@@ -994,7 +1361,7 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             {
               int16_t hC1;
               int16_t hC2;
-              STO_PLL_GetObserverGains(&STO_PLL_M1, &hC1, &hC2);
+              STO_PLL_GetObserverGains(pSTO_PLL[motorID], &hC1, &hC2);
               *regdata16 = hC1;
               break;
             }
@@ -1003,20 +1370,20 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             {
               int16_t hC1;
               int16_t hC2;
-              STO_PLL_GetObserverGains(&STO_PLL_M1, &hC1, &hC2);
+              STO_PLL_GetObserverGains(pSTO_PLL[motorID], &hC1, &hC2);
               *regdata16 = hC2;
               break;
             }
 
             case MC_REG_STOPLL_KI:
             {
-              *regdata16 = PID_GetKI (&(&STO_PLL_M1)->PIRegulator);
+              *regdata16 = PID_GetKI (&pSTO_PLL[motorID]->PIRegulator);
               break;
             }
 
             case MC_REG_STOPLL_KP:
             {
-              *regdata16 = PID_GetKP (&(&STO_PLL_M1)->PIRegulator);
+              *regdata16 = PID_GetKP (&pSTO_PLL[motorID]->PIRegulator);
               break;
             }
 
@@ -1026,66 +1393,66 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
 
             case MC_REG_SPEED_KP_DIV:
             {
-              *regdataU16 = (uint16_t)PID_GetKPDivisorPOW2(&PIDSpeedHandle_M1);
+              *regdataU16 = (uint16_t)PID_GetKPDivisorPOW2(pPIDSpeed[motorID]);
               break;
             }
 
             case MC_REG_SPEED_KI_DIV:
             {
-              *regdataU16 = (uint16_t)PID_GetKIDivisorPOW2(&PIDSpeedHandle_M1);
+              *regdataU16 = (uint16_t)PID_GetKIDivisorPOW2(pPIDSpeed[motorID]);
               break;
             }
 
             case MC_REG_SPEED_KD_DIV:
             {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDSpeedHandle_M1);
+              *regdataU16 = PID_GetKDDivisorPOW2(pPIDSpeed[motorID]);
               break;
             }
             case MC_REG_I_D_KP_DIV:
             {
-              *regdataU16 = PID_GetKPDivisorPOW2(&PIDIdHandle_M1);
+              *regdataU16 = PID_GetKPDivisorPOW2(pPIDId[motorID]);
               break;
             }
 
             case MC_REG_I_D_KI_DIV:
             {
-              *regdataU16 = PID_GetKIDivisorPOW2(&PIDIdHandle_M1);
+              *regdataU16 = PID_GetKIDivisorPOW2(pPIDId[motorID]);
               break;
             }
 
             case MC_REG_I_D_KD_DIV:
             {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDIdHandle_M1);
+              *regdataU16 = PID_GetKDDivisorPOW2(pPIDId[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KP_DIV:
             {
-              *regdataU16 = PID_GetKPDivisorPOW2(&PIDIqHandle_M1);
+              *regdataU16 = PID_GetKPDivisorPOW2(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KI_DIV:
             {
-              *regdataU16 = PID_GetKIDivisorPOW2(&PIDIqHandle_M1);
+              *regdataU16 = PID_GetKIDivisorPOW2(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_I_Q_KD_DIV:
             {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDIqHandle_M1);
+              *regdataU16 = PID_GetKDDivisorPOW2(pPIDIq[motorID]);
               break;
             }
 
             case MC_REG_STOPLL_KI_DIV:
             {
-              *regdataU16 = PID_GetKIDivisorPOW2(&(&STO_PLL_M1)->PIRegulator);
+              *regdataU16 = PID_GetKIDivisorPOW2(&pSTO_PLL[motorID]->PIRegulator);
               break;
             }
 
             case MC_REG_STOPLL_KP_DIV:
             {
-              *regdataU16 = PID_GetKPDivisorPOW2(&(&STO_PLL_M1)->PIRegulator);
+              *regdataU16 = PID_GetKPDivisorPOW2(&pSTO_PLL[motorID]->PIRegulator);
               break;
             }
 
@@ -1132,24 +1499,147 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
 
             case MC_REG_STOPLL_EST_BEMF:
             {
-              *regdata32 = STO_PLL_GetEstimatedBemfLevel(&STO_PLL_M1);
+              *regdata32 = STO_PLL_GetEstimatedBemfLevel(pSTO_PLL[motorID]);
               break;
             }
 
             case MC_REG_STOPLL_OBS_BEMF:
             {
-              *regdata32 = STO_PLL_GetObservedBemfLevel(&STO_PLL_M1);
+              *regdata32 = STO_PLL_GetObservedBemfLevel(pSTO_PLL[motorID]);
               break;
             }
 
             case MC_REG_MOTOR_POWER:
             {
               FloatToU32 ReadVal; //cstat !MISRAC2012-Rule-19.2
-              ReadVal.Float_Val = PQD_GetAvrgElMotorPowerW(pMPM[M1]);
+              ReadVal.Float_Val = PQD_GetAvrgElMotorPowerW(pMPM[motorID]);
               *regdataU32 = ReadVal.U32_Val; //cstat !UNION-type-punning
               break;
             }
 
+#if (VIB_MONITOR_ENABLE == 1)
+            case MC_REG_VIB_CYCLES:
+            {
+              *regdataU32 = VIB_GetCycles(&VibMonitorM1);
+              break;
+            }
+
+#endif
+#if (ANOMALY_DETECTOR_ENABLE == 1)
+            case MC_REG_ANOMALY_CYCLES:
+            {
+              *regdataU32 = ANOM_GetCycles(&AnomalyDetectorM1);
+              break;
+            }
+
+#endif
+#if (DEADBEAT_CURRENT_ENABLE == 1)
+            case MC_REG_CURRENT_CTRL_CYCLES:
+            {
+              *regdataU32 = DBC_GetCycles(&DeadbeatCurrM1);
+              break;
+            }
+
+            case MC_REG_DEADBEAT_FALLBACKS:
+            {
+              *regdataU32 = DBC_GetFallbacks(&DeadbeatCurrM1);
+              break;
+            }
+
+#endif
+
+#if (SELF_COMMISSIONING_ENABLE == 1)
+            case MC_REG_SC_RS:
+            {
+              *regdataU32 = SCC_GetRs(&SCC_M1);
+              break;
+            }
+
+            case MC_REG_SC_LS:
+            {
+              *regdataU32 = SCC_GetLs(&SCC_M1);
+              break;
+            }
+
+            case MC_REG_SC_KE:
+            {
+              *regdataU32 = SCC_GetKe(&SCC_M1);
+              break;
+            }
+
+            case MC_REG_SC_VBUS:
+            {
+              *regdataU32 = SCC_GetVbus(&SCC_M1);
+              break;
+            }
+
+            case MC_REG_SC_MEAS_NOMINALSPEED:
+            {
+              *regdataU32 = OTT_GetNominalSpeed(&OTT_M1);
+              break;
+            }
+
+            case MC_REG_SC_CURRENT:
+            {
+              *regdataU32 = MCM_floatToIntBit(SCC_GetNominalCurrent(&SCC_M1));
+              break;
+            }
+
+            case MC_REG_SC_SPDBANDWIDTH:
+            {
+              *regdataU32 = MCM_floatToIntBit(OTT_GetSpeedRegulatorBandwidth(&OTT_M1));
+              break;
+            }
+
+            case MC_REG_SC_LDLQRATIO:
+            {
+              *regdataU32 = MCM_floatToIntBit(SCC_GetLdLqRatio(&SCC_M1));
+              break;
+            }
+
+            case MC_REG_SC_NOMINAL_SPEED:
+            {
+              *regdata32 = SCC_GetNominalSpeed(&SCC_M1);
+              break;
+            }
+
+            case MC_REG_SC_CURRBANDWIDTH:
+            {
+              *regdataU32 = MCM_floatToIntBit(SCC_GetCurrentBandwidth(&SCC_M1));
+              break;
+            }
+
+            case MC_REG_SC_J:
+            {
+              *regdataU32 = MCM_floatToIntBit(OTT_GetJ(&OTT_M1));
+              break;
+            }
+
+            case MC_REG_SC_F:
+            {
+              *regdataU32 = MCM_floatToIntBit(OTT_GetF(&OTT_M1));
+              break;
+            }
+
+            case MC_REG_SC_MAX_CURRENT:
+            {
+              *regdataU32 = MCM_floatToIntBit(SCC_GetStartupCurrentAmp(&SCC_M1));
+              break;
+            }
+
+            case MC_REG_SC_STARTUP_SPEED:
+            {
+              *regdata32 = (int32_t)SCC_M1.wSpeedThToValidateStartupRPM;
+              break;
+            }
+
+            case MC_REG_SC_STARTUP_ACC:
+            {
+              *regdata32 = SCC_GetEstMaxAcceleration(&SCC_M1);
+              break;
+            }
+
+#endif
             default:
             {
               retVal = MCP_ERROR_UNKNOWN_REG;
@@ -1256,7 +1746,7 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             }
             else
             {
-              memcpy(rawData, &scaleParams_M1, sizeof(ScaleParams_t) );
+              memcpy(rawData, pMCIN->pScale, sizeof(ScaleParams_t) );
             }
             break;
           }
@@ -1298,7 +1788,7 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             {
               for (i = 0; i <RUC_MAX_PHASE_NUMBER; i++)
               {
-                (void)RUC_GetPhase( &RevUpControlM1 ,i, &revUpPhase);
+                (void)RUC_GetPhase( pRevUpCtrl[motorID] ,i, &revUpPhase);
                 rpm = (int32_t *)&data[2U + (i * 8U)];  //cstat !MISRAC2012-Rule-11.3
                 *rpm = (((int32_t)revUpPhase.hFinalMecSpeedUnit) * U_RPM) / SPEED_UNIT; //cstat !MISRAC2012-Rule-11.3
                 finalTorque = (uint16_t *)&data[6U + (i * 8U)]; //cstat !MISRAC2012-Rule-11.3
@@ -1321,6 +1811,34 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
             break;
           }
 
+          case MC_REG_SPEED_FILTER:
+          {
+            /* Coefficients of the speed chain, then of the torque chain, stage by stage */
+            float_t coeffs[SPDFLT_COEFF_NBR];
+            uint8_t i;
+
+            *rawSize = (uint16_t)((uint16_t)SPDFLT_CHAIN_NBR * SPDFLT_STAGE_NBR * sizeof(coeffs));
+            if (MC_NULL == pSTC[motorID]->SpeedFilter)
+            {
+              *rawSize = 0;
+              retVal = MCP_ERROR_UNKNOWN_REG;
+            }
+            else if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+            {
+              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+            }
+            else
+            {
+              for (i = 0U; i < ((uint8_t)SPDFLT_CHAIN_NBR * SPDFLT_STAGE_NBR); i++)
+              {
+                (void)SPDFLT_GetCoefficients(pSTC[motorID]->SpeedFilter, (SPDFLT_Chain_t)(i / SPDFLT_STAGE_NBR),
+                                             i % SPDFLT_STAGE_NBR, coeffs);
+                (void)memcpy(&rawData[i * sizeof(coeffs)], coeffs, sizeof(coeffs));
+              }
+            }
+            break;
+          }
+
           case MC_REG_ASYNC_UARTA:
           case MC_REG_ASYNC_UARTB:
           case MC_REG_ASYNC_STLNK:
@@ -1345,6 +1863,20 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
     return (retVal);
   }
 
+/* Reads a register of motor 1 */
+uint8_t RI_GetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  return (RI_GetRegisterMotor(M1, regID, typeID, data, size, freeSpace));
+}
+
+#if (NBR_OF_MOTORS > 1)
+/* Reads a register of motor 2 */
+uint8_t RI_GetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  return (RI_GetRegisterMotor(M2, regID, typeID, data, size, freeSpace));
+}
+#endif
+
 uint8_t RI_MovString(const char_t *srcString, char_t *destString, uint16_t *size, int16_t maxSize)
 {
   uint8_t retVal = MCP_CMD_OK;
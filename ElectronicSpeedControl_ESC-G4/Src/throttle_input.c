@@ -0,0 +1,861 @@
+
+/**
+  ******************************************************************************
+  * @file    throttle_input.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Throttle Input component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup ThrottleInput
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "throttle_input.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup ThrottleInput Throttle Input
+  * @brief Throttle of a flight controller or a receiver, DShot or servo pulses
+  *
+  * The signal is captured by the channel 1 of a 32 bits timer, without interrupt:
+  *
+  * - PWM: the timer is in PWM input mode, reset on the rising edges. The channel 1 captures the
+  *   period and the channel 2 the pulse width;
+  * - DShot: each edge is captured and its timestamp written by a circular DMA into
+  *   THR_Handle_t::wEdges. The newest complete frame is found behind the DMA position: it follows a
+  *   low level longer than hGapMin and its bit period is measured, so that DShot150, DShot300 and
+  *   DShot600 are decoded alike. The frames with a bit out of timing or a wrong CRC are rejected.
+  *
+  * THR_Task(), run by the medium frequency task, decodes the last throttle and drives the motor
+  * through the MC interface. The motor starts only once a null throttle has been received during
+  * hArmingTime, it stops on a null throttle, and stops and disarms when no valid throttle is received
+  * during hFailsafeTime. After a fault, a null throttle acknowledges it and arms again.
+  *
+  * With bTelemetry, the frames of a bidirectional DShot, inverted and with an inverted CRC, are replied
+  * on the same line with the eRPM, and with the temperature, voltage and current once the extended
+  * telemetry is enabled by its DShot command. The replies are encoded by the medium frequency task
+  * (THR_SetTelemetry()), so that the turnaround is spent in the timers and the DMA:
+  *
+  * - TLM_TIMx is reset by each edge captured, its channel 1 compare interrupt at hGapMin marks the end
+  *   of a frame. Its counter is then the time since the last edge;
+  * - the medium frequency task decodes the frames and gives the bit rate of the replies, 5/4 of the
+  *   bit rate of the frames. The interrupt, below the current regulation, only counts the edges of the
+  *   frame, expands the reply into port set and reset words preceded by the idle bits left of the
+  *   turnaround, and starts the DMA to the port paced by TLM_TIMx;
+  * - the DMA transfer complete interrupt gives the line back to the capture.
+  *
+  * The replies only start after #THR_BIDIR_FRAMES consecutive inverted CRCs, the line is not driven
+  * against a flight controller sending a standard DShot.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Position in the edge ring */
+#define THR_IDX(i)                  ((uint16_t)((i) & (THR_EDGE_NBR - 1U)))
+
+/* Bit periods accepted, around DShot600 (1667 ns) and DShot150 (6667 ns) */
+#define THR_DSHOT_BIT_MIN_NS        1200U
+#define THR_DSHOT_BIT_MAX_NS        8000U
+
+/* Pulses accepted out of the throttle range, us */
+#define THR_PWM_MARGIN_US           200U
+
+/* Consecutive inverted CRCs before the replies start */
+#define THR_BIDIR_FRAMES            16U
+
+/* DShot commands of the extended telemetry, applied when the motor is stopped */
+#define THR_CMD_EXTENDED_TELEMETRY_ENABLE   13U
+#define THR_CMD_EXTENDED_TELEMETRY_DISABLE  14U
+
+/* Extended telemetry frames, 4 bits type and 8 bits value */
+#define THR_EDT_TEMPERATURE         0x200U /*!< Celsius degrees */
+#define THR_EDT_VOLTAGE             0x400U /*!< 0.25 V */
+#define THR_EDT_CURRENT             0x600U /*!< A */
+
+/* eRPM frame of a motor stopped, the longest period */
+#define THR_ERPM_STOPPED            0xFFFU
+
+/* One extended telemetry frame every 8 replies */
+#define THR_EDT_INTERVAL_LOG        3U
+
+/* GCR code of each nibble, 5 bits with at most 2 consecutive 0 */
+static const uint8_t THR_Gcr[16] =
+{
+  0x19U, 0x1BU, 0x12U, 0x13U, 0x1DU, 0x15U, 0x16U, 0x17U,
+  0x1AU, 0x09U, 0x0AU, 0x0BU, 0x1EU, 0x0DU, 0x0EU, 0x0FU
+};
+
+/**
+  * @brief  Reads the newest DShot frame captured since the previous call.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  pThrottle: throttle decoded.
+  * @retval true if a valid throttle was decoded.
+  */
+static bool THR_ReadDShot(THR_Handle_t *pHandle, uint16_t *pThrottle)
+{
+  bool bValid = false;
+  THR_Frame_t Frame = {.wStart = pHandle->wLastStart, .wBitPeriod = 0U, .bInverted = false};
+  uint16_t hWrite = THR_IDX(THR_EDGE_NBR - LL_DMA_GetDataLength(pHandle->DMAx, pHandle->wDMAChannel));
+  int32_t wFrame = THR_DecodeDShot(pHandle, THR_IDX(hWrite - 1U), &Frame);
+  uint16_t hWritten = THR_IDX(THR_EDGE_NBR - LL_DMA_GetDataLength(pHandle->DMAx, pHandle->wDMAChannel) - hWrite);
+
+  /* The edges read span 2 frames, the DMA must not have overwritten them meanwhile. The write position
+     alone does not tell the new frames, a multiple of the edge buffer may be received in a period */
+  if ((hWritten >= (THR_EDGE_NBR - (4U * THR_DSHOT_BITS) - 1U)) || (Frame.wStart == pHandle->wLastStart))
+  {
+    /* No new frame */
+  }
+  else if (wFrame >= 0)
+  {
+    bValid = THR_DShotToThrottle(pHandle, (uint16_t)wFrame, pThrottle);
+    pHandle->wLastStart = Frame.wStart;
+
+    if (false == Frame.bInverted)
+    {
+      pHandle->bBidirCount = 0U;
+    }
+    else if (pHandle->bBidirCount < THR_BIDIR_FRAMES)
+    {
+      pHandle->bBidirCount++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    /* The reply bits last 4/5 of the frame bits */
+    pHandle->wReplyBit = (4U * Frame.wBitPeriod) / 5U;
+    pHandle->bBidirectional = (pHandle->bBidirCount >= THR_BIDIR_FRAMES) ? true : false;
+  }
+  else
+  {
+    pHandle->hFrameErrors += (pHandle->hFrameErrors < UINT16_MAX) ? 1U : 0U;
+    pHandle->wLastStart = Frame.wStart;
+  }
+  return (bValid);
+}
+
+/**
+  * @brief  Reads the PWM pulse captured since the previous call.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  pThrottle: throttle decoded.
+  * @retval true if a valid throttle was decoded.
+  */
+static bool THR_ReadPWM(THR_Handle_t *pHandle, uint16_t *pThrottle)
+{
+  bool bValid = false;
+
+  if (0U == LL_TIM_IsActiveFlag_CC1(pHandle->TIMx))
+  {
+    /* No period completed since the previous call */
+  }
+  else
+  {
+    uint32_t wPulse = LL_TIM_IC_GetCaptureCH2(pHandle->TIMx);
+    /* Clears the capture flag */
+    uint32_t wPeriod = LL_TIM_IC_GetCaptureCH1(pHandle->TIMx);
+
+    bValid = THR_PulseToThrottle(pHandle, wPulse, wPeriod, pThrottle);
+    if (false == bValid)
+    {
+      pHandle->hFrameErrors += (pHandle->hFrameErrors < UINT16_MAX) ? 1U : 0U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (bValid);
+}
+
+/**
+  * @brief  Returns the ramp target of the throttle, #SPEED_UNIT or digit of Iq.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  */
+static int16_t THR_CalcTarget(const THR_Handle_t *pHandle)
+{
+  int32_t wThrottle = (int32_t)pHandle->hThrottle;
+  int32_t wTarget;
+
+  if (MCM_TORQUE_MODE == pHandle->ControlMode)
+  {
+    wTarget = (wThrottle * pHandle->hTorqueMax) / (int32_t)THR_FULL_SCALE;
+  }
+  else
+  {
+    wTarget = pHandle->hSpeedMin + ((wThrottle * (pHandle->hSpeedMax - pHandle->hSpeedMin)) / (int32_t)THR_FULL_SCALE);
+  }
+  return ((int16_t)wTarget);
+}
+
+/**
+  * @brief  Sends a ramp to the motor.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  hTarget: final speed, #SPEED_UNIT, or Iq, digit.
+  * @param  hDuration: duration of the ramp, ms.
+  */
+static void THR_ExecRamp(THR_Handle_t *pHandle, int16_t hTarget, uint16_t hDuration)
+{
+  if (MCM_TORQUE_MODE == pHandle->ControlMode)
+  {
+    MCI_ExecTorqueRamp(pHandle->pMCI, hTarget, hDuration);
+  }
+  else
+  {
+    MCI_ExecSpeedRamp(pHandle->pMCI, hTarget, hDuration);
+  }
+  pHandle->hTarget = hTarget;
+}
+
+/**
+  * @brief  Initializes the Throttle Input component and starts the capture.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  *
+  * The clock of the timer and its input pin are configured by the application.
+  */
+__weak void THR_Init(THR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_THR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    TIM_TypeDef *TIMx = pHandle->TIMx;
+    uint16_t i;
+
+    for (i = 0U; i < THR_EDGE_NBR; i++)
+    {
+      pHandle->wEdges[i] = 0U;
+    }
+    pHandle->wLastStart = 0U;
+    pHandle->hThrottle = 0U;
+    pHandle->hTarget = 0;
+    pHandle->hCounter = 0U;
+    pHandle->hTimeout = 0U;
+    pHandle->hFrameErrors = 0U;
+    pHandle->bCommand = 0U;
+    pHandle->bTelemetryRequest = false;
+    pHandle->State = THR_DISARMED;
+    pHandle->bBidirCount = 0U;
+    pHandle->bBidirectional = false;
+    pHandle->bExtendedTelemetry = false;
+    pHandle->hReplyCount = 0U;
+    pHandle->wReplyBit = 0U;
+    pHandle->hReplyWrite = 0U;
+    for (i = 0U; i < THR_TLM_SLOTS; i++)
+    {
+      pHandle->wReplies[i] = THR_EncodeReply(THR_ERPM_STOPPED);
+    }
+    /* Idle bits of the turnaround, the line high */
+    for (i = 0U; i < THR_TLM_PAD_MAX; i++)
+    {
+      pHandle->wTxBuffer[i] = pHandle->wPin;
+    }
+
+    LL_TIM_DisableCounter(TIMx);
+    LL_TIM_SetPrescaler(TIMx, 0U);
+    LL_TIM_SetAutoReload(TIMx, UINT32_MAX);
+    LL_TIM_IC_SetActiveInput(TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_ACTIVEINPUT_DIRECTTI);
+    LL_TIM_IC_SetPrescaler(TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_ICPSC_DIV1);
+    LL_TIM_IC_SetFilter(TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_IC_FILTER_FDIV1_N8);
+
+    if (THR_DSHOT == pHandle->Protocol)
+    {
+      LL_TIM_IC_SetPolarity(TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_IC_POLARITY_BOTHEDGE);
+
+      LL_DMA_DisableChannel(pHandle->DMAx, pHandle->wDMAChannel);
+      LL_DMA_ConfigTransfer(pHandle->DMAx, pHandle->wDMAChannel, LL_DMA_DIRECTION_PERIPH_TO_MEMORY
+                            | LL_DMA_MODE_CIRCULAR | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT
+                            | LL_DMA_PDATAALIGN_WORD | LL_DMA_MDATAALIGN_WORD | LL_DMA_PRIORITY_HIGH);
+      LL_DMA_SetPeriphRequest(pHandle->DMAx, pHandle->wDMAChannel, pHandle->wDMARequest);
+      LL_DMA_ConfigAddresses(pHandle->DMAx, pHandle->wDMAChannel, (uint32_t)&TIMx->CCR1,
+                             (uint32_t)pHandle->wEdges, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+      LL_DMA_SetDataLength(pHandle->DMAx, pHandle->wDMAChannel, THR_EDGE_NBR);
+      LL_DMA_EnableChannel(pHandle->DMAx, pHandle->wDMAChannel);
+      LL_TIM_EnableDMAReq_CC1(TIMx);
+
+      if (true == pHandle->bTelemetry)
+      {
+        TIM_TypeDef *TLM_TIMx = pHandle->TLM_TIMx;
+
+        /* Each capture resets TLM_TIMx, whose channel 1 compare ends the frame */
+        LL_TIM_SetTriggerOutput(TIMx, LL_TIM_TRGO_CC1IF);
+        LL_TIM_DisableCounter(TLM_TIMx);
+        LL_TIM_SetPrescaler(TLM_TIMx, 0U);
+        LL_TIM_SetAutoReload(TLM_TIMx, UINT16_MAX);
+        LL_TIM_SetTriggerInput(TLM_TIMx, pHandle->wTlmTrigger);
+        LL_TIM_SetSlaveMode(TLM_TIMx, LL_TIM_SLAVEMODE_RESET);
+        LL_TIM_OC_SetMode(TLM_TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_OCMODE_FROZEN);
+        LL_TIM_OC_SetCompareCH1(TLM_TIMx, (uint32_t)pHandle->hGapMin * pHandle->hTicksPerUs);
+
+        LL_DMA_DisableChannel(pHandle->DMAx, pHandle->wTlmDMAChannel);
+        LL_DMA_ConfigTransfer(pHandle->DMAx, pHandle->wTlmDMAChannel, LL_DMA_DIRECTION_MEMORY_TO_PERIPH
+                              | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT
+                              | LL_DMA_PDATAALIGN_WORD | LL_DMA_MDATAALIGN_WORD | LL_DMA_PRIORITY_VERYHIGH);
+        LL_DMA_SetPeriphRequest(pHandle->DMAx, pHandle->wTlmDMAChannel, pHandle->wTlmDMARequest);
+        LL_DMA_SetPeriphAddress(pHandle->DMAx, pHandle->wTlmDMAChannel, (uint32_t)&pHandle->GPIOx->BSRR);
+        LL_DMA_EnableIT_TC(pHandle->DMAx, pHandle->wTlmDMAChannel);
+
+        LL_TIM_GenerateEvent_UPDATE(TLM_TIMx);
+        LL_TIM_ClearFlag_CC1(TLM_TIMx);
+        LL_TIM_EnableIT_CC1(TLM_TIMx);
+        LL_TIM_EnableCounter(TLM_TIMx);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Period on the rising edges of TI1, pulse on its falling edges */
+      LL_TIM_IC_SetPolarity(TIMx, LL_TIM_CHANNEL_CH1, LL_TIM_IC_POLARITY_RISING);
+      LL_TIM_IC_SetActiveInput(TIMx, LL_TIM_CHANNEL_CH2, LL_TIM_ACTIVEINPUT_INDIRECTTI);
+      LL_TIM_IC_SetPrescaler(TIMx, LL_TIM_CHANNEL_CH2, LL_TIM_ICPSC_DIV1);
+      LL_TIM_IC_SetFilter(TIMx, LL_TIM_CHANNEL_CH2, LL_TIM_IC_FILTER_FDIV1_N8);
+      LL_TIM_IC_SetPolarity(TIMx, LL_TIM_CHANNEL_CH2, LL_TIM_IC_POLARITY_FALLING);
+      LL_TIM_SetTriggerInput(TIMx, LL_TIM_TS_TI1FP1);
+      LL_TIM_SetSlaveMode(TIMx, LL_TIM_SLAVEMODE_RESET);
+      LL_TIM_CC_EnableChannel(TIMx, LL_TIM_CHANNEL_CH2);
+    }
+    LL_TIM_CC_EnableChannel(TIMx, LL_TIM_CHANNEL_CH1);
+    LL_TIM_GenerateEvent_UPDATE(TIMx);
+    LL_TIM_ClearFlag_CC1(TIMx);
+    LL_TIM_EnableCounter(TIMx);
+#ifdef NULL_PTR_CHECK_THR
+  }
+#endif
+}
+
+/**
+  * @brief  Decodes the newest complete DShot frame of the edges captured.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  hNewest: position of the newest edge in THR_Handle_t::wEdges.
+  * @param  pFrame: timing and CRC of the frame found, its timestamp unchanged if none.
+  * @retval The 16 bits frame, #THR_NO_FRAME if no frame is complete, #THR_BAD_FRAME if the frame found
+  *         has a bit out of timing or a wrong CRC.
+  *
+  * The frame starts with the first rising edge after a low level longer than hGapMin, the line being
+  * low at rest. A bit is a 1 when its high level lasts more than 9/16 of the bit period, between the
+  * 3/8 of a 0 and the 3/4 of a 1. A high level within 1/16 of this threshold is rejected rather than
+  * guessed, the 4 bits CRC missing one double error out of 16. The bidirectional DShot is idle high: its
+  * edges are alike, only its CRC is inverted.
+  */
+__weak int32_t THR_DecodeDShot(const THR_Handle_t *pHandle, uint16_t hNewest, THR_Frame_t *pFrame)
+{
+  const volatile uint32_t *pEdges = pHandle->wEdges;
+  uint32_t wGap = (uint32_t)pHandle->hGapMin * pHandle->hTicksPerUs;
+  int32_t wFrame = THR_NO_FRAME;
+  uint16_t hStart = 0U;
+  uint16_t hAfter = 0U;
+  uint16_t i;
+
+  /* Latest gap followed by the 32 edges of a frame, searched backwards over a partial and a complete frame */
+  for (i = 0U; i < (4U * THR_DSHOT_BITS); i++)
+  {
+    uint16_t hEdge = THR_IDX(hNewest - i);
+
+    if ((pEdges[hEdge] - pEdges[THR_IDX(hEdge - 1U)]) <= wGap)
+    {
+      /* Nothing to do */
+    }
+    else if (i < ((2U * THR_DSHOT_BITS) - 1U))
+    {
+      /* Frame being received */
+    }
+    else
+    {
+      hStart = hEdge;
+      hAfter = i;
+      break;
+    }
+  }
+
+  if (0U == hAfter)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    uint32_t wPeriod = (pEdges[THR_IDX(hStart + (2U * (THR_DSHOT_BITS - 1U)))] - pEdges[hStart])
+                     / (THR_DSHOT_BITS - 1U);
+    uint32_t wBitMin = ((uint32_t)THR_DSHOT_BIT_MIN_NS * pHandle->hTicksPerUs) / 1000U;
+    uint32_t wBitMax = ((uint32_t)THR_DSHOT_BIT_MAX_NS * pHandle->hTicksPerUs) / 1000U;
+    uint16_t hValue = 0U;
+    bool bValid = (wPeriod >= wBitMin) && (wPeriod <= wBitMax);
+
+    pFrame->wStart = pEdges[hStart];
+    pFrame->wBitPeriod = wPeriod;
+
+    /* The last falling edge ends the frame */
+    if ((hAfter > ((2U * THR_DSHOT_BITS) - 1U))
+        && ((pEdges[THR_IDX(hStart + (2U * THR_DSHOT_BITS))]
+             - pEdges[THR_IDX(hStart + (2U * THR_DSHOT_BITS) - 1U)]) <= wGap))
+    {
+      bValid = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    for (i = 0U; (i < THR_DSHOT_BITS) && (true == bValid); i++)
+    {
+      uint32_t wRise = pEdges[THR_IDX(hStart + (2U * i))];
+      uint32_t wHigh = pEdges[THR_IDX(hStart + (2U * i) + 1U)] - wRise;
+
+      if (i < (THR_DSHOT_BITS - 1U))
+      {
+        uint32_t wBit = pEdges[THR_IDX(hStart + (2U * i) + 2U)] - wRise;
+
+        /* Period within 1/4 of the frame average */
+        bValid = (wBit < (2U * wPeriod)) && ((4U * wBit) >= (3U * wPeriod)) && ((4U * wBit) <= (5U * wPeriod));
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      bValid = bValid && (wHigh < wPeriod) && ((8U * wHigh) >= wPeriod) && ((8U * wHigh) <= (7U * wPeriod))
+               && (((16U * wHigh) <= (8U * wPeriod)) || ((16U * wHigh) >= (10U * wPeriod)));
+      hValue = (uint16_t)(hValue << 1U) | (((16U * wHigh) > (9U * wPeriod)) ? 1U : 0U);
+    }
+
+    if (true == bValid)
+    {
+      uint16_t hData = hValue >> 4U;
+      uint16_t hCrc = (hData ^ (hData >> 4U) ^ (hData >> 8U)) & 0x0FU;
+
+      pFrame->bInverted = (((~hCrc) & 0x0FU) == (hValue & 0x0FU)) ? true : false;
+      wFrame = ((hCrc == (hValue & 0x0FU)) || (true == pFrame->bInverted)) ? (int32_t)hValue : THR_BAD_FRAME;
+    }
+    else
+    {
+      wFrame = THR_BAD_FRAME;
+    }
+  }
+  return (wFrame);
+}
+
+/**
+  * @brief  Converts a DShot frame to the throttle, and records its command and telemetry request.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  hFrame: frame with a valid CRC.
+  * @param  pThrottle: throttle, 0 to #THR_FULL_SCALE. Null for the commands.
+  * @retval true, a DShot frame with a valid CRC always carries a throttle.
+  */
+__weak bool THR_DShotToThrottle(THR_Handle_t *pHandle, uint16_t hFrame, uint16_t *pThrottle)
+{
+  uint16_t hValue = hFrame >> 5U;
+
+  pHandle->bTelemetryRequest = (0U == (hFrame & 0x10U)) ? false : true;
+  if (hValue > THR_DSHOT_CMD_MAX)
+  {
+    *pThrottle = hValue - THR_DSHOT_CMD_MAX;
+    pHandle->bCommand = 0U;
+  }
+  else
+  {
+    *pThrottle = 0U;
+    pHandle->bCommand = (uint8_t)hValue;
+  }
+  return (true);
+}
+
+/**
+  * @brief  Converts a PWM pulse to the throttle.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  wPulseTicks: pulse width, timer ticks.
+  * @param  wPeriodTicks: period of the pulses, timer ticks.
+  * @param  pThrottle: throttle, 0 to #THR_FULL_SCALE.
+  * @retval true if the pulse is within hPulseMin and hPulseMax, with a margin, and shorter than the period.
+  */
+__weak bool THR_PulseToThrottle(const THR_Handle_t *pHandle, uint32_t wPulseTicks, uint32_t wPeriodTicks,
+                                uint16_t *pThrottle)
+{
+  uint32_t wMin = (uint32_t)pHandle->hPulseMin * pHandle->hTicksPerUs;
+  uint32_t wMax = (uint32_t)pHandle->hPulseMax * pHandle->hTicksPerUs;
+  uint32_t wMargin = (uint32_t)THR_PWM_MARGIN_US * pHandle->hTicksPerUs;
+  bool bValid = (wPulseTicks < wPeriodTicks) && ((wPulseTicks + wMargin) >= wMin) && (wPulseTicks <= (wMax + wMargin));
+
+  if (false == bValid)
+  {
+    /* Nothing to do */
+  }
+  else if (wPulseTicks <= wMin)
+  {
+    *pThrottle = 0U;
+  }
+  else if (wPulseTicks >= wMax)
+  {
+    *pThrottle = THR_FULL_SCALE;
+  }
+  else
+  {
+    *pThrottle = (uint16_t)(((wPulseTicks - wMin) * THR_FULL_SCALE) / (wMax - wMin));
+  }
+  return (bValid);
+}
+
+/**
+  * @brief  Decodes the throttle and drives the motor, to be called by the medium frequency task.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  */
+__weak void THR_Task(THR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_THR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint16_t hThrottle = 0U;
+    bool bValid = (THR_DSHOT == pHandle->Protocol) ? THR_ReadDShot(pHandle, &hThrottle)
+                                                    : THR_ReadPWM(pHandle, &hThrottle);
+    MCI_State_t McState = MCI_GetSTMState(pHandle->pMCI);
+
+    if (true == bValid)
+    {
+      pHandle->hThrottle = hThrottle;
+      pHandle->hTimeout = pHandle->hFailsafeTime;
+    }
+    else if (pHandle->hTimeout > 0U)
+    {
+      pHandle->hTimeout--;
+    }
+    else
+    {
+      /* Failsafe: no signal, or not a valid one */
+      pHandle->hThrottle = 0U;
+      if (THR_DISARMED == pHandle->State)
+      {
+        /* Nothing to do */
+      }
+      else
+      {
+        (void)MCI_StopMotor(pHandle->pMCI);
+        pHandle->State = THR_DISARMED;
+      }
+    }
+
+    /* Extended telemetry commands, applied with the motor stopped */
+    if ((false == bValid) || (THR_RUNNING == pHandle->State))
+    {
+      /* Nothing to do */
+    }
+    else if (THR_CMD_EXTENDED_TELEMETRY_ENABLE == pHandle->bCommand)
+    {
+      pHandle->bExtendedTelemetry = true;
+    }
+    else if (THR_CMD_EXTENDED_TELEMETRY_DISABLE == pHandle->bCommand)
+    {
+      pHandle->bExtendedTelemetry = false;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    switch (pHandle->State)
+    {
+      case THR_DISARMED:
+      {
+        if ((0U == pHandle->hTimeout) || (pHandle->hThrottle > 0U))
+        {
+          pHandle->hCounter = 0U;
+        }
+        else if ((FAULT_OVER == McState) && (true == bValid))
+        {
+          /* A null throttle acknowledges the fault */
+          (void)MCI_FaultAcknowledged(pHandle->pMCI);
+          pHandle->hCounter = 0U;
+        }
+        else if (IDLE == McState)
+        {
+          pHandle->hCounter++;
+          if (pHandle->hCounter >= pHandle->hArmingTime)
+          {
+            pHandle->hCounter = 0U;
+            pHandle->State = THR_ARMED;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        else
+        {
+          pHandle->hCounter = 0U;
+        }
+        break;
+      }
+
+      case THR_ARMED:
+      {
+        if ((FAULT_NOW == McState) || (FAULT_OVER == McState))
+        {
+          pHandle->State = THR_DISARMED;
+        }
+        else if ((pHandle->hThrottle > 0U) && (IDLE == McState))
+        {
+          THR_ExecRamp(pHandle, THR_CalcTarget(pHandle), 0U);
+          if (true == MCI_StartMotor(pHandle->pMCI))
+          {
+            pHandle->State = THR_RUNNING;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case THR_RUNNING:
+      {
+        if ((FAULT_NOW == McState) || (FAULT_OVER == McState))
+        {
+          pHandle->State = THR_DISARMED;
+        }
+        else if (IDLE == McState)
+        {
+          /* Stopped by another command source */
+          pHandle->State = THR_ARMED;
+        }
+        else if (0U == pHandle->hThrottle)
+        {
+          (void)MCI_StopMotor(pHandle->pMCI);
+          pHandle->State = THR_ARMED;
+        }
+        else
+        {
+          int16_t hTarget = THR_CalcTarget(pHandle);
+
+          if (hTarget == pHandle->hTarget)
+          {
+            /* Nothing to do */
+          }
+          else
+          {
+            THR_ExecRamp(pHandle, hTarget, pHandle->hRampDuration);
+          }
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+#ifdef NULL_PTR_CHECK_THR
+  }
+#endif
+}
+
+/**
+  * @brief  Encodes a 12 bits telemetry value into the line levels of the reply.
+  * @param  hValue: eRPM or extended telemetry frame.
+  * @retval Levels of the #THR_TLM_BITS bits, the first one in the most significant bit.
+  *
+  * The value and its inverted CRC are coded in GCR, each nibble in 5 bits. Each 1 of the GCR toggles
+  * the line, from the low level of the start bit.
+  */
+__weak uint32_t THR_EncodeReply(uint16_t hValue)
+{
+  uint16_t hData = hValue & 0x0FFFU;
+  uint16_t hCrc = (uint16_t)(~(hData ^ (hData >> 4U) ^ (hData >> 8U))) & 0x0FU;
+  uint16_t hFrame = (uint16_t)(hData << 4U) | hCrc;
+  uint32_t wGcr = 0U;
+  uint32_t wLevels = 0U;
+  uint32_t wLevel = 0U;
+  uint16_t i;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    wGcr = (wGcr << 5U) | THR_Gcr[(hFrame >> (12U - (4U * i))) & 0x0FU];
+  }
+  for (i = 0U; i < (THR_TLM_BITS - 1U); i++)
+  {
+    wLevel ^= (wGcr >> (THR_TLM_BITS - 2U - i)) & 1U;
+    wLevels = (wLevels << 1U) | wLevel;
+  }
+  return (wLevels);
+}
+
+/**
+  * @brief  Encodes the telemetry replied to the bidirectional DShot frames, to be called by the medium
+  *         frequency task.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  * @param  hMecSpeedUnit: speed of the rotor, #SPEED_UNIT.
+  * @param  hTemp_C: temperature, Celsius degrees.
+  * @param  hVbus_V4: bus voltage, 0.25 V.
+  * @param  hCurrent_A: bus current, A.
+  *
+  * The eRPM frame is the electrical period in us, a 9 bits mantissa shifted by a 3 bits exponent.
+  */
+__weak void THR_SetTelemetry(THR_Handle_t *pHandle, int16_t hMecSpeedUnit, int16_t hTemp_C, uint16_t hVbus_V4,
+                             uint16_t hCurrent_A)
+{
+#ifdef NULL_PTR_CHECK_THR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t wSpeed = (uint32_t)((hMecSpeedUnit < 0) ? -(int32_t)hMecSpeedUnit : (int32_t)hMecSpeedUnit);
+    uint16_t hErpm = THR_ERPM_STOPPED;
+
+    if (wSpeed > 0U)
+    {
+      uint32_t wPeriod = (1000000UL * (uint32_t)SPEED_UNIT) / (wSpeed * pHandle->hPolePairs);
+      uint16_t hExponent = 0U;
+
+      while ((wPeriod > 0x1FFU) && (hExponent < 8U))
+      {
+        wPeriod >>= 1U;
+        hExponent++;
+      }
+      hErpm = (hExponent < 8U) ? (uint16_t)((uint32_t)(hExponent << 9U) | wPeriod) : THR_ERPM_STOPPED;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    pHandle->wReplies[0] = THR_EncodeReply(hErpm);
+    pHandle->wReplies[1] = THR_EncodeReply(THR_EDT_TEMPERATURE
+                                           | ((hTemp_C < 0) ? 0U : ((hTemp_C > 255) ? 255U : (uint16_t)hTemp_C)));
+    pHandle->wReplies[2] = THR_EncodeReply(THR_EDT_VOLTAGE | ((hVbus_V4 > 255U) ? 255U : hVbus_V4));
+    pHandle->wReplies[3] = THR_EncodeReply(THR_EDT_CURRENT | ((hCurrent_A > 255U) ? 255U : hCurrent_A));
+#ifdef NULL_PTR_CHECK_THR
+  }
+#endif
+}
+
+/**
+  * @brief  Starts the reply at the end of a bidirectional DShot frame, channel 1 compare interrupt of
+  *         TLM_TIMx.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  *
+  * The frames are decoded by the medium frequency task, which sets the reply bit once the stream is
+  * bidirectional. A frame is replied when a complete frame of edges was captured since the previous
+  * end of frame and the line idles high. The counter of TLM_TIMx, reset by the last edge, gives the
+  * idle bits left of the turnaround.
+  */
+__weak void THR_FrameEnd_IRQHandler(THR_Handle_t *pHandle)
+{
+  TIM_TypeDef *TLM_TIMx = pHandle->TLM_TIMx;
+  uint16_t hWrite = THR_IDX(THR_EDGE_NBR - LL_DMA_GetDataLength(pHandle->DMAx, pHandle->wDMAChannel));
+  uint16_t hEdges = THR_IDX(hWrite - pHandle->hReplyWrite);
+  uint32_t wBit = pHandle->wReplyBit;
+
+  LL_TIM_ClearFlag_CC1(TLM_TIMx);
+  pHandle->hReplyWrite = hWrite;
+
+  if ((false == pHandle->bBidirectional) || (0U == wBit) || ((2U * THR_DSHOT_BITS) != hEdges)
+      || (0U == LL_GPIO_IsInputPinSet(pHandle->GPIOx, pHandle->wPin)))
+  {
+    /* Not a bidirectional frame, or the counter wrapped while idle */
+  }
+  else
+  {
+    uint32_t wTurnaround = (uint32_t)pHandle->hTurnaround * pHandle->hTicksPerUs;
+    uint32_t wElapsed = LL_TIM_GetCounter(TLM_TIMx);
+    uint32_t wPad = (wElapsed < wTurnaround) ? (((wTurnaround - wElapsed) + (wBit / 2U)) / wBit) : 0U;
+    uint32_t wSlot = 0U;
+    uint32_t wReply;
+    uint32_t *pTx;
+    uint16_t i;
+
+    pHandle->hReplyCount++;
+    if ((true == pHandle->bExtendedTelemetry)
+        && (0U == (pHandle->hReplyCount & ((1U << THR_EDT_INTERVAL_LOG) - 1U))))
+    {
+      wSlot = 1U + ((uint32_t)(pHandle->hReplyCount >> THR_EDT_INTERVAL_LOG) % (THR_TLM_SLOTS - 1U));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    wReply = pHandle->wReplies[wSlot];
+
+    wPad = (wPad > THR_TLM_PAD_MAX) ? THR_TLM_PAD_MAX : wPad;
+    pTx = &pHandle->wTxBuffer[THR_TLM_PAD_MAX - wPad];
+    for (i = 0U; i < THR_TLM_BITS; i++)
+    {
+      pHandle->wTxBuffer[THR_TLM_PAD_MAX + i] = (0U == ((wReply >> (THR_TLM_BITS - 1U - i)) & 1U))
+                                              ? (pHandle->wPin << 16U) : pHandle->wPin;
+    }
+    pHandle->wTxBuffer[THR_TLM_PAD_MAX + THR_TLM_BITS] = pHandle->wPin;
+
+    /* The capture stopped, the port drives the line, idle high */
+    LL_TIM_CC_DisableChannel(pHandle->TIMx, LL_TIM_CHANNEL_CH1);
+    LL_TIM_DisableIT_CC1(TLM_TIMx);
+    LL_TIM_SetSlaveMode(TLM_TIMx, LL_TIM_SLAVEMODE_DISABLED);
+    LL_TIM_SetAutoReload(TLM_TIMx, wBit - 1U);
+    LL_GPIO_SetOutputPin(pHandle->GPIOx, pHandle->wPin);
+    LL_GPIO_SetPinMode(pHandle->GPIOx, pHandle->wPin, LL_GPIO_MODE_OUTPUT);
+
+    LL_DMA_SetMemoryAddress(pHandle->DMAx, pHandle->wTlmDMAChannel, (uint32_t)pTx);
+    LL_DMA_SetDataLength(pHandle->DMAx, pHandle->wTlmDMAChannel, wPad + THR_TLM_BITS + 1U);
+    LL_DMA_EnableChannel(pHandle->DMAx, pHandle->wTlmDMAChannel);
+    LL_TIM_EnableDMAReq_UPDATE(TLM_TIMx);
+    /* First word written at once */
+    LL_TIM_GenerateEvent_UPDATE(TLM_TIMx);
+  }
+}
+
+/**
+  * @brief  Releases the line at the end of the reply, transfer complete interrupt of the reply DMA.
+  * @param  pHandle: handler of the current instance of the Throttle Input component.
+  */
+__weak void THR_ReplyEnd_IRQHandler(THR_Handle_t *pHandle)
+{
+  TIM_TypeDef *TLM_TIMx = pHandle->TLM_TIMx;
+
+  WRITE_REG(pHandle->DMAx->IFCR, DMA_IFCR_CGIF1 << (4U * pHandle->wTlmDMAChannel));
+  LL_DMA_DisableChannel(pHandle->DMAx, pHandle->wTlmDMAChannel);
+  LL_TIM_DisableDMAReq_UPDATE(TLM_TIMx);
+  LL_GPIO_SetPinMode(pHandle->GPIOx, pHandle->wPin, LL_GPIO_MODE_ALTERNATE);
+
+  LL_TIM_SetAutoReload(TLM_TIMx, UINT16_MAX);
+  LL_TIM_SetSlaveMode(TLM_TIMx, LL_TIM_SLAVEMODE_RESET);
+  LL_TIM_GenerateEvent_UPDATE(TLM_TIMx);
+  LL_TIM_ClearFlag_CC1(TLM_TIMx);
+  LL_TIM_EnableIT_CC1(TLM_TIMx);
+  LL_TIM_CC_EnableChannel(pHandle->TIMx, LL_TIM_CHANNEL_CH1);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
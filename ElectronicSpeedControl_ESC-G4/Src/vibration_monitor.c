@@ -0,0 +1,351 @@
+
+/**
+  ******************************************************************************
+  * @file    vibration_monitor.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file provides firmware functions that implement the features
+  *          of the Vibration Monitor component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup VibrationMonitor
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vibration_monitor.h"
+#include "stm32g4xx.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @defgroup VibrationMonitor Vibration Monitor
+  * @brief Spectrum of Iq at the harmonics of the mechanical frequency
+  *
+  * An unbalance, a bent shaft or a worn bearing load the motor with a torque periodic in the
+  * mechanical angle, which the speed regulator answers with Iq. The current control averages Iq over
+  * hDecimation periods into a window of #VIB_FFT_SIZE samples, together with the electrical angle
+  * travelled. The window is analysed in the idle time, never in an interrupt: its mean is removed, it
+  * is weighted by a Hann window and transformed by a real FFT of the CMSIS-DSP library.
+  *
+  * The mean speed of the window locates the harmonics bOrders of the mechanical frequency, and the
+  * amplitude of each is taken from the energy of the bins within two bins of it, the main lobe of the
+  * Hann window: the amplitude does not depend on where the harmonic falls between two bins. A window
+  * whose speed varied by more than fSpeedTolerance, or whose first harmonic is too close to the mean,
+  * is discarded and the previous results kept.
+  *
+  * A new window is captured while the previous one is analysed, its samples being copied first.
+  *
+  * @{
+  */
+
+/* Private defines -----------------------------------------------------------*/
+
+/* Bins on each side of a harmonic within the main lobe of the Hann window */
+#define VIB_LOBE_BINS               2
+
+/* Lowest first harmonic, bins, clear of the lobe of the residual mean */
+#define VIB_MIN_BIN                 4.0f
+
+/* Amplitude of a sinusoid from the energy of its Hann main lobe, times the window size:
+   sum |X|^2 = 3.N^2.A^2 / 32 */
+#define VIB_LOBE_ENERGY_GAIN        (32.0f / 3.0f)
+
+#if (VIB_FFT_SIZE != 256U) && (VIB_FFT_SIZE != 512U)
+#error "VIB_FFT_SIZE shall be 256 or 512"
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Restarts the capture of a window */
+static void VIB_StartCapture(VIB_Handle_t *pHandle)
+{
+  pHandle->hIndex = 0U;
+  pHandle->hCount = 0U;
+  pHandle->wIqSum = 0;
+  pHandle->wSpeedSum = 0;
+  pHandle->wSpeedTotal = 0;
+  pHandle->wSpeedMin = INT32_MAX;
+  pHandle->wSpeedMax = INT32_MIN;
+  pHandle->bCapturing = true;
+}
+
+/* Copies the window with its mean removed, weighted by a Hann window. The cosine is rotated sample
+   by sample rather than computed */
+static void VIB_Window(VIB_Handle_t *pHandle)
+{
+  float_t fStepCos = arm_cos_f32((2.0f * PI) / (float_t)VIB_FFT_SIZE);
+  float_t fStepSin = arm_sin_f32((2.0f * PI) / (float_t)VIB_FFT_SIZE);
+  float_t fCos = 1.0f;
+  float_t fSin = 0.0f;
+  float_t fMean;
+  int32_t wSum = 0;
+  uint16_t i;
+
+  for (i = 0U; i < VIB_FFT_SIZE; i++)
+  {
+    wSum += (int32_t)pHandle->pCapture[i];
+  }
+  fMean = (float_t)wSum / (float_t)VIB_FFT_SIZE;
+
+  for (i = 0U; i < VIB_FFT_SIZE; i++)
+  {
+    float_t fNextCos = (fCos * fStepCos) - (fSin * fStepSin);
+
+    fSin = (fSin * fStepCos) + (fCos * fStepSin);
+    pHandle->fSamples[i] = ((float_t)pHandle->pCapture[i] - fMean) * (0.5f - (0.5f * fCos));
+    fCos = fNextCos;
+  }
+}
+
+/* Returns the amplitude of the harmonic at a bin, digit, from the energy of its main lobe, corrected
+   by the gain of the average of hDecimation periods at its frequency */
+static uint16_t VIB_Amplitude(const VIB_Handle_t *pHandle, float_t fBin)
+{
+  float_t fDecimation = (float_t)pHandle->hDecimation;
+  float_t fAngle = (PI * fBin) / (fDecimation * (float_t)VIB_FFT_SIZE);
+  float_t fGain = arm_sin_f32(fDecimation * fAngle) / (fDecimation * arm_sin_f32(fAngle));
+  float_t fEnergy = 0.0f;
+  float_t fAmplitude;
+  int32_t wCenter = (int32_t)(fBin + 0.5f);
+  int32_t wBin;
+
+  for (wBin = wCenter - VIB_LOBE_BINS; wBin <= (wCenter + VIB_LOBE_BINS); wBin++)
+  {
+    /* Bin 0 holds the mean and the Nyquist bin, both real, not a lobe of a harmonic */
+    if (wBin > 0)
+    {
+      float_t fRe = pHandle->fSpectrum[2 * wBin];
+      float_t fIm = pHandle->fSpectrum[(2 * wBin) + 1];
+
+      fEnergy += (fRe * fRe) + (fIm * fIm);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  (void)arm_sqrt_f32(VIB_LOBE_ENERGY_GAIN * fEnergy, &fAmplitude);
+  fAmplitude = fAmplitude / (fGain * (float_t)VIB_FFT_SIZE);
+  return ((fAmplitude < 65535.0f) ? (uint16_t)(fAmplitude + 0.5f) : UINT16_MAX);
+}
+
+/* Analyses the window copied, given the electrical angle it travelled and the extreme angles of its
+   samples */
+static void VIB_Analyse(VIB_Handle_t *pHandle, int32_t wSpeedTotal, int32_t wSpeedMin, int32_t wSpeedMax)
+{
+  float_t fSampleFreq = pHandle->fControlFreq_Hz / (float_t)pHandle->hDecimation;
+  /* Mean electrical speed, s16 per sample */
+  float_t fSpeed = (float_t)wSpeedTotal / (float_t)VIB_FFT_SIZE;
+  float_t fAbsSpeed = (fSpeed >= 0.0f) ? fSpeed : -fSpeed;
+  /* Mechanical revolutions per window: the bin of the first harmonic */
+  float_t fBin = (fAbsSpeed * (float_t)VIB_FFT_SIZE) / (65536.0f * (float_t)pHandle->hPolePairs);
+
+  if ((((float_t)(wSpeedMax - wSpeedMin)) > (pHandle->fSpeedTolerance * fAbsSpeed)) || (fBin < VIB_MIN_BIN))
+  {
+    if (pHandle->hRejected < UINT16_MAX)
+    {
+      pHandle->hRejected++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    float_t fMecSpeed;
+    uint8_t i;
+
+    arm_rfft_fast_f32(&pHandle->Rfft, pHandle->fSamples, pHandle->fSpectrum, 0U);
+
+    for (i = 0U; i < VIB_HARMONIC_NBR; i++)
+    {
+      float_t fHarmonicBin = fBin * (float_t)pHandle->bOrders[i];
+
+      pHandle->hHarmonic[i] = ((fHarmonicBin + (float_t)VIB_LOBE_BINS) < (float_t)(VIB_FFT_SIZE / 2U))
+                            ? VIB_Amplitude(pHandle, fHarmonicBin) : 0U;
+    }
+
+    fMecSpeed = (fSpeed * fSampleFreq * (float_t)SPEED_UNIT) / (65536.0f * (float_t)pHandle->hPolePairs);
+    pHandle->hMecSpeedUnit = (int16_t)((fMecSpeed >= 0.0f) ? (fMecSpeed + 0.5f) : (fMecSpeed - 0.5f));
+    pHandle->hWindows++;
+  }
+}
+
+/**
+  * @brief  Initializes the Vibration Monitor component.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  */
+__weak void VIB_Init(VIB_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_VIB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+#if (VIB_FFT_SIZE == 512U)
+    (void)arm_rfft_512_fast_init_f32(&pHandle->Rfft);
+#else
+    (void)arm_rfft_256_fast_init_f32(&pHandle->Rfft);
+#endif
+    for (i = 0U; i < VIB_HARMONIC_NBR; i++)
+    {
+      pHandle->hHarmonic[i] = 0U;
+    }
+    pHandle->hMecSpeedUnit = 0;
+    pHandle->hWindows = 0U;
+    pHandle->hRejected = 0U;
+    pHandle->wCycles = 0U;
+    pHandle->bFull = false;
+    VIB_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_VIB
+  }
+#endif
+}
+
+/**
+  * @brief  Aborts the window being captured, to be called when the drive stops. The results are kept.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  */
+__weak void VIB_Clear(VIB_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_VIB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->bCapturing = false;
+#ifdef NULL_PTR_CHECK_VIB
+  }
+#endif
+}
+
+/**
+  * @brief  Accumulates Iq and the speed into the window, to be called by the current control.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  * @param  hIq: measured Iq, digit.
+  * @param  hElSpeedDpp: instantaneous electrical speed, s16degree per current control period.
+  */
+__weak void VIB_Capture(VIB_Handle_t *pHandle, int16_t hIq, int16_t hElSpeedDpp)
+{
+#ifdef NULL_PTR_CHECK_VIB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (true == pHandle->bCapturing)
+    {
+      pHandle->wIqSum += (int32_t)hIq;
+      pHandle->wSpeedSum += (int32_t)hElSpeedDpp;
+      pHandle->hCount++;
+
+      if (pHandle->hCount >= pHandle->hDecimation)
+      {
+        int32_t wSpeed = pHandle->wSpeedSum;
+
+        pHandle->pCapture[pHandle->hIndex] = (int16_t)(pHandle->wIqSum / (int32_t)pHandle->hDecimation);
+        pHandle->wSpeedTotal += wSpeed;
+        pHandle->wSpeedMin = (wSpeed < pHandle->wSpeedMin) ? wSpeed : pHandle->wSpeedMin;
+        pHandle->wSpeedMax = (wSpeed > pHandle->wSpeedMax) ? wSpeed : pHandle->wSpeedMax;
+        pHandle->wIqSum = 0;
+        pHandle->wSpeedSum = 0;
+        pHandle->hCount = 0U;
+        pHandle->hIndex++;
+
+        if (pHandle->hIndex >= VIB_FFT_SIZE)
+        {
+          pHandle->bCapturing = false;
+          pHandle->bFull = true;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_VIB
+  }
+#endif
+}
+
+/**
+  * @brief  Starts the windows while the drive runs and analyses them, to be called in the idle time.
+  *
+  *         The window is copied and the next one started before the FFT.
+  * @param  pHandle: handler of the current instance of the Vibration Monitor component.
+  */
+__weak void VIB_BackgroundTask(VIB_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_VIB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (true == pHandle->bFull)
+    {
+      uint32_t wStart = DWT->CYCCNT;
+      int32_t wSpeedTotal = pHandle->wSpeedTotal;
+      int32_t wSpeedMin = pHandle->wSpeedMin;
+      int32_t wSpeedMax = pHandle->wSpeedMax;
+
+      VIB_Window(pHandle);
+      pHandle->bFull = false;
+      VIB_Analyse(pHandle, wSpeedTotal, wSpeedMin, wSpeedMax);
+      pHandle->wCycles = DWT->CYCCNT - wStart;
+    }
+    else if ((false == pHandle->bCapturing) && (RUN == MCI_GetSTMState(pHandle->pMCI)))
+    {
+      VIB_StartCapture(pHandle);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_VIB
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/
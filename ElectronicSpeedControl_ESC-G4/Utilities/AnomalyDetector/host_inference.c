@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file    host_inference.c
+  * @brief   Host build of the inference of the Anomaly Detector component: the
+  *          firmware ANOM_Infer and the CMSIS-NN kernels, reference C path, run
+  *          on the features of a CSV file. Prints the score of each row.
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "anomaly_detector.h"
+
+extern const ANOM_Model_t AnomalyModelM1;
+
+int main(int argc, char *argv[])
+{
+  char line[512];
+  FILE *pFile;
+  int retVal = 0;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s features.csv\n", argv[0]);
+    retVal = 2;
+  }
+  else if (NULL == (pFile = fopen(argv[1], "r")))
+  {
+    perror(argv[1]);
+    retVal = 1;
+  }
+  else
+  {
+    q7_t bActivations[2U * ANOM_MAX_WIDTH];
+    q15_t hVecBuffer[ANOM_MAX_WIDTH];
+
+    (void)fgets(line, sizeof(line), pFile); /* Column names */
+    while (NULL != fgets(line, sizeof(line), pFile))
+    {
+      float_t fFeatures[ANOM_FEATURE_NBR];
+      char *pText = line;
+      uint8_t i;
+
+      for (i = 0U; i < ANOM_FEATURE_NBR; i++)
+      {
+        fFeatures[i] = strtof(pText, &pText);
+        pText += (',' == *pText) ? 1 : 0;
+      }
+      printf("%u\n", ANOM_Infer(&AnomalyModelM1, fFeatures, bActivations, hVecBuffer));
+    }
+    fclose(pFile);
+  }
+  return (retVal);
+}
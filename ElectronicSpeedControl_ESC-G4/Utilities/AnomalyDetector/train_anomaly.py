@@ -0,0 +1,435 @@
+#!/usr/bin/env python3
+"""Trains and quantizes the autoencoder of the Anomaly Detector component.
+
+The model reconstructs the features the medium frequency task averages over ANOM_DECIMATION periods,
+in the order and units of ANOM_Feature_t:
+
+    iq, id          measured Iq and Id, digit (MC_REG_I_Q_MEAS, MC_REG_I_D_MEAS)
+    vq              applied Vq, digit (MC_REG_V_Q)
+    speed_error     speed reference minus measured speed, rpm (MC_REG_SPEED_REF - MC_REG_SPEED_MEAS)
+    vbus            bus voltage, V
+    temperature     heatsink temperature, Celsius degree (MC_REG_HEATS_TEMP)
+
+Training data is a CSV file with these column names, logged at the inference rate while the drive runs
+in normal conditions over its whole operating range: speeds, accelerations, battery charge, temperature.
+Without a log, --synthetic trains on a simple model of the propeller drive, to exercise the flow only.
+
+The float model is trained with Adam, then quantized to the q7 power of two formats of
+arm_fully_connected_q7: the format of each layer output is taken from its range over the training set.
+The anomaly threshold is set above the scores of the training set, computed by a bit exact integer
+model of the kernels. The model is written as Src/anomaly_model.c.
+
+    python3 train_anomaly.py --synthetic 6000 --out ../../Src/anomaly_model.c
+    python3 train_anomaly.py --csv flight_logs.csv --out ../../Src/anomaly_model.c
+    python3 train_anomaly.py --csv flight_logs.csv --out ../../Src/anomaly_model.c --verify
+
+--verify rebuilds the host inference of this directory, the firmware ANOM_Infer and CMSIS-NN kernels
+compiled with the model written, and checks its scores on the test set against the integer model.
+make run does so on a model trained again as the committed one, and compares them.
+Only the standard library is used.
+"""
+
+import argparse
+import csv
+import math
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+
+FEATURES = ["iq", "id", "vq", "speed_error", "vbus", "temperature"]
+LAYERS = [(6, 16, True), (16, 4, False), (4, 16, True), (16, 6, False)]  # inputs, outputs, relu
+MAX_WIDTH = 16
+Q7_PER_SIGMA = 32.0  # Inputs within 4 standard deviations of the training set are not saturated
+
+# Drive of the synthetic data: A2212 on a 4S battery, as set in the motor and power stage parameters
+CURRENT_CONV_FACTOR = 544.0
+RS = 0.1
+KE_PEAK_PER_RPM = 0.8 * math.sqrt(2.0) / math.sqrt(3.0) / 1000.0
+MAX_RPM = 9864.0
+MIN_RPM = 3600.0
+NOMINAL_IQ_A = 10.0
+SAMPLE_PERIOD = 0.02  # ANOM_DECIMATION medium frequency task periods
+
+
+def synthetic_session(rng, samples, anomaly=None):
+    """Features of a flight at the inference rate, the drive running all along."""
+    load = NOMINAL_IQ_A / (MAX_RPM * MAX_RPM)
+    ke = KE_PEAK_PER_RPM
+    friction = 0.0
+    rbat = 0.05
+    temp_offset = 0.0
+    if anomaly == "propeller":
+        load *= 0.75
+    elif anomaly == "bearing":
+        friction = 1.0
+    elif anomaly == "demagnetization":
+        ke *= 0.9
+    elif anomaly == "battery":
+        rbat *= 5.0
+    elif anomaly == "cooling":
+        temp_offset = 15.0
+
+    v0 = rng.uniform(15.0, 16.8)
+    discharge = rng.uniform(0.1, 0.5) / (samples * SAMPLE_PERIOD)
+    speed = MIN_RPM
+    ref = MIN_RPM
+    hold = 0.0
+    temp = rng.uniform(20.0, 50.0)
+    rows = []
+    for _ in range(samples):
+        hold -= SAMPLE_PERIOD
+        if hold <= 0.0:
+            ref = rng.uniform(MIN_RPM, MAX_RPM - 100.0)
+            hold = rng.uniform(0.3, 3.0)
+        previous = speed
+        speed += (ref - speed) * (1.0 - math.exp(-SAMPLE_PERIOD / 0.08))
+        accel = (speed - previous) / SAMPLE_PERIOD
+        iq_a = (load * speed * speed + friction + 2.0e-4 * accel) * (KE_PEAK_PER_RPM / ke)
+        iq_a = max(-15.0, min(15.0, iq_a))
+        id_a = -0.03 * iq_a * speed / MAX_RPM
+        vq_v = RS * iq_a + ke * speed
+        v0 -= discharge * SAMPLE_PERIOD
+        vbus = v0
+        for _ in range(3):
+            ibus = max(0.0, 1.5 * vq_v * iq_a / vbus)
+            vbus = v0 - rbat * ibus
+        temp += (25.0 + 0.25 * iq_a * iq_a - temp) * (SAMPLE_PERIOD / 60.0)
+        rows.append([
+            iq_a * CURRENT_CONV_FACTOR + rng.gauss(0.0, 0.1 * CURRENT_CONV_FACTOR),
+            id_a * CURRENT_CONV_FACTOR + rng.gauss(0.0, 0.05 * CURRENT_CONV_FACTOR),
+            vq_v * 32767.0 * math.sqrt(3.0) / vbus + rng.gauss(0.0, 50.0),
+            (ref - speed) + rng.gauss(0.0, 30.0),
+            vbus + rng.gauss(0.0, 0.05),
+            round(temp + temp_offset + rng.gauss(0.0, 0.3)),
+        ])
+    return rows
+
+
+def synthetic_set(rng, samples, anomaly=None):
+    """Flights of 5 to 20 s, their battery charge and temperature drawn at random."""
+    rows = []
+    while len(rows) < samples:
+        rows += synthetic_session(rng, min(rng.randint(250, 1000), samples - len(rows)), anomaly)
+    return rows
+
+
+def load_csv(path):
+    with open(path, newline="") as f:
+        reader = csv.DictReader(f)
+        missing = [name for name in FEATURES if name not in reader.fieldnames]
+        if missing:
+            sys.exit("%s: missing columns %s" % (path, ", ".join(missing)))
+        return [[float(row[name]) for name in FEATURES] for row in reader]
+
+
+def f32(x):
+    """Rounds to single precision, the arithmetic of the firmware."""
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+def quantize_input(model, row):
+    out = []
+    for i, x in enumerate(row):
+        v = f32(f32(f32(x) - f32(model["offset"][i])) * f32(model["scale"][i]))
+        v = max(-128.0, min(127.0, v))
+        out.append(int(v + 0.5) if v >= 0.0 else -int(-v + 0.5))
+    return out
+
+
+# Float autoencoder ------------------------------------------------------------------------------
+
+def init_layers(rng):
+    layers = []
+    for n_in, n_out, relu in LAYERS:
+        bound = math.sqrt(6.0 / (n_in + n_out))
+        w = [[rng.uniform(-bound, bound) for _ in range(n_in)] for _ in range(n_out)]
+        layers.append({"w": w, "b": [0.0] * n_out, "relu": relu})
+    return layers
+
+
+def forward(layers, x):
+    acts = [x]
+    pre = []
+    for layer in layers:
+        z = [b + sum(wi * xi for wi, xi in zip(row, acts[-1])) for row, b in zip(layer["w"], layer["b"])]
+        pre.append(z)
+        acts.append([max(0.0, v) for v in z] if layer["relu"] else z)
+    return acts, pre
+
+
+def train(layers, data, epochs, rng, rate=2e-3, batch=32):
+    beta1, beta2, eps = 0.9, 0.999, 1e-8
+    moments = [{"mw": [[0.0] * len(r) for r in l["w"]], "vw": [[0.0] * len(r) for r in l["w"]],
+                "mb": [0.0] * len(l["b"]), "vb": [0.0] * len(l["b"])} for l in layers]
+    step = 0
+    for epoch in range(epochs):
+        order = list(range(len(data)))
+        rng.shuffle(order)
+        loss = 0.0
+        for start in range(0, len(order), batch):
+            grads = [{"w": [[0.0] * len(r) for r in l["w"]], "b": [0.0] * len(l["b"])} for l in layers]
+            chunk = order[start:start + batch]
+            for k in chunk:
+                x = data[k]
+                acts, pre = forward(layers, x)
+                delta = [2.0 * (o - t) / len(x) for o, t in zip(acts[-1], x)]
+                loss += sum((o - t) ** 2 for o, t in zip(acts[-1], x)) / len(x)
+                for li in range(len(layers) - 1, -1, -1):
+                    layer = layers[li]
+                    if layer["relu"]:
+                        delta = [d if z > 0.0 else 0.0 for d, z in zip(delta, pre[li])]
+                    g = grads[li]
+                    a_in = acts[li]
+                    for j, d in enumerate(delta):
+                        if d != 0.0:
+                            gw = g["w"][j]
+                            for i, a in enumerate(a_in):
+                                gw[i] += d * a
+                            g["b"][j] += d
+                    if li > 0:
+                        delta = [sum(layer["w"][j][i] * delta[j] for j in range(len(delta)))
+                                 for i in range(len(a_in))]
+            step += 1
+            scale = 1.0 / len(chunk)
+            corr1 = 1.0 - beta1 ** step
+            corr2 = 1.0 - beta2 ** step
+            for layer, g, m in zip(layers, grads, moments):
+                for j in range(len(layer["w"])):
+                    for i in range(len(layer["w"][j])):
+                        gi = g["w"][j][i] * scale
+                        m["mw"][j][i] = beta1 * m["mw"][j][i] + (1 - beta1) * gi
+                        m["vw"][j][i] = beta2 * m["vw"][j][i] + (1 - beta2) * gi * gi
+                        layer["w"][j][i] -= rate * (m["mw"][j][i] / corr1) / (math.sqrt(m["vw"][j][i] / corr2) + eps)
+                    gi = g["b"][j] * scale
+                    m["mb"][j] = beta1 * m["mb"][j] + (1 - beta1) * gi
+                    m["vb"][j] = beta2 * m["vb"][j] + (1 - beta2) * gi * gi
+                    layer["b"][j] -= rate * (m["mb"][j] / corr1) / (math.sqrt(m["vb"][j] / corr2) + eps)
+        if (epoch + 1) % 10 == 0 or epoch == 0:
+            print("epoch %3d  loss %.5f" % (epoch + 1, loss / len(data)), file=sys.stderr)
+
+
+# Quantization -----------------------------------------------------------------------------------
+
+def frac_bits(max_abs):
+    """Fractional bits of the q7 format holding max_abs."""
+    if max_abs <= 0.0:
+        return 7
+    return int(math.floor(math.log2(127.0 / max_abs)))
+
+
+def quantize(layers, data):
+    """Power of two q7 formats, CMSIS-NN style: input of the first layer and output of the last q0.7."""
+    ranges = [0.0] * len(layers)
+    for x in data:
+        _, pre = forward(layers, x)
+        for li, z in enumerate(pre):
+            # A rectified output saturates its negative values to -128, rectified to 0 all the same
+            ranges[li] = max(ranges[li], max((max(v, 0.0) if layers[li]["relu"] else abs(v)) for v in z))
+    frac_in = 7
+    qlayers = []
+    for li, layer in enumerate(layers):
+        frac_w = frac_bits(max(abs(v) for row in layer["w"] for v in row))
+        frac_b = frac_bits(max(abs(v) for v in layer["b"]))
+        frac_out = 7 if li == len(layers) - 1 else frac_bits(ranges[li])
+        frac_b = min(frac_b, frac_in + frac_w)
+        frac_out = min(frac_out, frac_in + frac_w)
+        if li == len(layers) - 1 and frac_out != 7:
+            sys.exit("output layer weights too small for the q0.7 output format")
+        q = lambda v, f: max(-128, min(127, int(round(v * (1 << f)))))
+        qlayers.append({
+            "w": [[q(v, frac_w) for v in row] for row in layer["w"]],
+            "b": [q(v, frac_b) for v in layer["b"]],
+            "bias_shift": frac_in + frac_w - frac_b,
+            "out_shift": frac_in + frac_w - frac_out,
+            "relu": layer["relu"],
+        })
+        frac_in = frac_out
+    return qlayers
+
+
+def infer_q7(model, row):
+    """Integer model of ANOM_Infer, bit exact with arm_fully_connected_q7 and arm_relu_q7."""
+    x = quantize_input(model, row)
+    a = x
+    for layer in model["layers"]:
+        rnd = (1 << layer["out_shift"]) >> 1
+        out = []
+        for wrow, b in zip(layer["w"], layer["b"]):
+            acc = (b << layer["bias_shift"]) + rnd + sum(w * v for w, v in zip(wrow, a))
+            out.append(max(-128, min(127, acc >> layer["out_shift"])))
+        a = [max(0, v) for v in out] if layer["relu"] else out
+    return sum((u - v) ** 2 for u, v in zip(x, a)) // len(x)
+
+
+def filtered(scores, shift):
+    """Low pass of ANOM_BackgroundTask, its state holding the score times 2^shift."""
+    out = []
+    acc = 0
+    for raw in scores:
+        acc += raw - (acc >> shift)
+        out.append(acc >> shift)
+    return out
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p * len(values)))]
+
+
+# Output -----------------------------------------------------------------------------------------
+
+HEADER = """
+/**
+  ******************************************************************************
+  * @file    anomaly_model.c
+  * @author  Motor Control SDK Team, ST Microelectronics
+  * @brief   This file contains the autoencoder of the Anomaly Detector component,
+  *          generated by Utilities/AnomalyDetector/train_anomaly.py.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  * @ingroup AnomalyDetector
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "anomaly_detector.h"
+
+/* Generated file, do not edit: %s */
+"""
+
+FOOTER = "\n/************************ (C) COPYRIGHT 2025 STMicroelectronics *****END OF FILE****/\n"
+
+
+def c_array(name, values, width):
+    lines = []
+    for start in range(0, len(values), width):
+        lines.append("  " + ", ".join("%4d" % v for v in values[start:start + width]) + ",")
+    return "static const q7_t %s[%d] =\n{\n%s\n};\n" % (name, len(values), "\n".join(lines))
+
+
+def c_float(v):
+    text = "%.7g" % v
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def write_model(path, model, source):
+    parts = [HEADER % source]
+    for li, layer in enumerate(model["layers"]):
+        flat = [v for row in layer["w"] for v in row]
+        parts.append("\n/* Layer %d: %d inputs, %d outputs%s */\n" % (
+            li + 1, len(layer["w"][0]), len(layer["w"]), ", rectified" if layer["relu"] else ""))
+        parts.append(c_array("AnomalyWeights%dM1" % (li + 1), flat, len(layer["w"][0])))
+        parts.append("\n" + c_array("AnomalyBias%dM1" % (li + 1), layer["b"], 16))
+    parts.append("\n/**\n  * @brief  Autoencoder of the Anomaly Detector Motor 1.\n  */\n")
+    parts.append("const ANOM_Model_t AnomalyModelM1 =\n{\n")
+    parts.append("  .fOffset    = {%s},\n" % ", ".join(c_float(v) for v in model["offset"]))
+    parts.append("  .fScale     = {%s},\n" % ", ".join(c_float(v) for v in model["scale"]))
+    parts.append("  .Layers     =\n  {\n")
+    for li, layer in enumerate(model["layers"]):
+        parts.append("    {AnomalyWeights%dM1, AnomalyBias%dM1, %dU, %dU, %dU, %dU, %s},\n" % (
+            li + 1, li + 1, len(layer["w"][0]), len(layer["w"]), layer["bias_shift"], layer["out_shift"],
+            "true" if layer["relu"] else "false"))
+    parts.append("  },\n")
+    parts.append("  .hThreshold = %dU,\n};\n" % model["threshold"])
+    parts.append(FOOTER)
+    with open(path, "w", newline="\n") as f:
+        f.write("".join(parts))
+
+
+def verify(model, rows, path):
+    """Builds the host inference on the model written and checks its scores against the integer model."""
+    here = os.path.dirname(os.path.abspath(__file__))
+    subprocess.run(["make", "-s", "-B", "-C", here, "anomaly_host", "MODEL=" + os.path.abspath(path)], check=True)
+    binary = os.path.join(here, "anomaly_host")
+    with tempfile.NamedTemporaryFile("w", suffix=".csv", delete=False) as f:
+        f.write(",".join(FEATURES) + "\n")
+        for row in rows:
+            f.write(",".join(repr(v) for v in row) + "\n")
+        name = f.name
+    try:
+        out = subprocess.run([binary, name], check=True, capture_output=True, text=True).stdout.split()
+    finally:
+        os.unlink(name)
+    expected = [infer_q7(model, row) for row in rows]
+    mismatches = sum(1 for e, o in zip(expected, out) if e != int(o))
+    print("host build: %d of %d scores differ from the integer model" % (mismatches, len(rows)))
+    return mismatches == 0 and len(out) == len(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--csv", help="features logged in normal operation")
+    source.add_argument("--synthetic", type=int, metavar="N", help="N samples of the synthetic drive")
+    parser.add_argument("--out", help="model source to write, Src/anomaly_model.c")
+    parser.add_argument("--epochs", type=int, default=120)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--margin", type=float, default=1.2, help="threshold over the 99.9th percentile score")
+    parser.add_argument("--score-shift", type=int, default=5, help="ANOM_SCORE_SHIFT of the firmware")
+    parser.add_argument("--verify", action="store_true", help="check the host build of the model written")
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    # Rows in the order of the log, so that the score is low passed as by the firmware
+    rows = synthetic_set(rng, args.synthetic) if args.synthetic else load_csv(args.csv)
+    split = int(0.8 * len(rows))
+    train_rows, test_rows = rows[:split], rows[split:]
+
+    offset, scale = [], []
+    for i in range(len(FEATURES)):
+        column = [r[i] for r in train_rows]
+        mean = sum(column) / len(column)
+        std = math.sqrt(sum((v - mean) ** 2 for v in column) / len(column))
+        offset.append(mean)
+        scale.append(Q7_PER_SIGMA / std if std > 1e-6 else 1.0)
+    model = {"offset": offset, "scale": scale}
+
+    data = [[v / 128.0 for v in quantize_input(model, r)] for r in train_rows]
+    rng.shuffle(data)
+    layers = init_layers(rng)
+    train(layers, data, args.epochs, rng)
+    model["layers"] = quantize(layers, data)
+
+    train_scores = filtered([infer_q7(model, r) for r in train_rows], args.score_shift)
+    test_scores = filtered([infer_q7(model, r) for r in test_rows], args.score_shift)
+    model["threshold"] = max(1, int(math.ceil(args.margin * percentile(train_scores, 0.999))))
+    print("filtered scores: training median %d, 99.9%% %d, max %d; test median %d, max %d; threshold %d" % (
+        percentile(train_scores, 0.5), percentile(train_scores, 0.999), max(train_scores),
+        percentile(test_scores, 0.5), max(test_scores), model["threshold"]))
+
+    if args.synthetic:
+        for anomaly in [None, "propeller", "bearing", "demagnetization", "battery", "cooling"]:
+            session = synthetic_set(random.Random(args.seed + 100), 3000, anomaly)
+            scores = filtered([infer_q7(model, r) for r in session], args.score_shift)
+            above = sum(1 for s in scores if s > model["threshold"]) / len(scores)
+            print("  %-16s filtered score median %5d, above the threshold %5.1f %%" % (
+                anomaly or "normal", percentile(scores, 0.5), 100.0 * above))
+
+    weights = sum(l[0] * l[1] for l in LAYERS)
+    print("model: %d weights, %d biases, as many MACs per inference" % (weights, sum(l[1] for l in LAYERS)))
+
+    if args.out:
+        write_model(args.out, model, "%s, %d samples, seed %d" % (
+            "synthetic drive" if args.synthetic else os.path.basename(args.csv), len(rows), args.seed))
+        print("written %s" % args.out)
+    if args.verify and ((args.out is None) or not verify(model, test_rows, args.out)):
+        sys.exit("verification failed" if args.out else "--verify checks the model written by --out")
+
+
+if __name__ == "__main__":
+    main()
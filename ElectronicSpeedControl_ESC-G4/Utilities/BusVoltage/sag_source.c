@@ -0,0 +1,405 @@
+/**
+  ******************************************************************************
+  * @file    sag_source.c
+  * @brief   Host test of the bus voltage compensation of the current
+  *          regulator outputs on a battery sagging under load.
+  *
+  * The firmware current PI regulators and FOCP_CompensateVbus run as
+  * FOC_CurrControllerM1 runs them, with the gains of mc_config.c, and drive
+  * a model of Motor 1 at SPEED_RPM fed by a battery:
+  *
+  * - the windings, inductance LS, resistance RS and the flux of the motor
+  *   voltage constant, integrated in the rotor frame within each period;
+  * - a battery of BATTERY_V behind ESR_OHM, supplying the inverter, lossless,
+  *   and an external load on the same battery, the other motors of the
+  *   craft;
+  * - the voltage set at a sample applied from the next update event, half a
+  *   period later, in volts of the bus voltage at that time;
+  * - the currents and the bus voltage read by 12 bits converters at the
+  *   sample, the bus voltage as RCM_GetRegularConv returns it.
+  *
+  * Each case runs with and without the compensation:
+  *
+  * - a step of the Iq reference without external load, the bus sagged by
+  *   the motor only, and with the bus sagged to about 10 V by the external
+  *   load: with the compensation, its 10-90 % rise time must stay within
+  *   RISE_RATIO of the one without external load;
+  * - an Iq reference held while the external load pulses, then varies as a
+  *   sine: with the compensation, the rms error of Iq must be below
+  *   RMS_RATIO of the one without;
+  * - a charged battery, above the nominal voltage: the compensation must not
+  *   act at all.
+  *
+  * FOCP_CompensateVbus must also hold its gain at the under voltage
+  * threshold and saturate its outputs. The program returns 1 when a check
+  * fails.
+  *
+  * Usage: sag_source
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mc_type.h"
+#include "pid_regulator.h"
+#include "foc_pipeline.h"
+
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Motor speed, mechanical, and battery */
+#define SPEED_RPM               3000.0
+#define BATTERY_V               ((double)NOMINAL_BUS_VOLTAGE_V)
+#define CHARGED_V               16.8
+#define ESR_OHM                 0.2
+/* External load sagging the bus to about 10 V, and the frequencies of its variations */
+#define SAG_LOAD_A              20.0
+#define PULSE_HZ                50.0
+#define SINE_HZ                 300.0
+/* Iq step and reference held */
+#define STEP_FROM_A             2.0
+#define STEP_TO_A               10.0
+#define HOLD_A                  10.0
+/* Settling before the measure, and duration of the measure, s */
+#define SETTLE_S                0.05
+#define STEP_S                  0.005
+#define LOAD_S                  0.2
+/* Largest rise time on the sagged bus over the one without external load, and rms errors with over without
+   compensation */
+#define RISE_RATIO              1.25
+#define RMS_RATIO               0.5
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             ((double)CURRENT_CONV_FACTOR)
+#define S16_PER_LSB             16.0
+#define VBUS_D_PER_VOLT         (65536.0 * VBUS_PARTITIONING_FACTOR / ADC_REFERENCE_VOLTAGE)
+
+typedef enum
+{
+  LOAD_CONSTANT = 0,
+  LOAD_PULSES,
+  LOAD_SINE
+} Load_t;
+
+typedef struct
+{
+  const char *pName;
+  double BatteryV;
+  Load_t Load;
+  double LoadA;                            /* Constant, or peak of the pulses and sine */
+  bool bStep;                              /* Iq step, or Iq held */
+} Case_t;
+
+typedef struct
+{
+  double Id;                               /* Currents in the rotor frame, A */
+  double Iq;
+  double ValphaS16;                        /* Voltage applied, s16 of the bus voltage */
+  double VbetaS16;
+  double NextValphaS16;                    /* Voltage set at the last sample */
+  double NextVbetaS16;
+  double Theta;                            /* Electrical angle, rad */
+  double W;                                /* Electrical speed, rad/s */
+  double VbusV;
+  double Time;                             /* s */
+  double StepTime;                         /* Of the Iq step, s */
+  double Rise10;                           /* Crossings of 10 % and 90 % of the step, s */
+  double Rise90;
+} Plant_t;
+
+typedef struct
+{
+  double MinVbusV;
+  double RiseUs;
+  double RmsA;
+  double IqSum;                            /* Of the samples, to compare two runs */
+} Result_t;
+
+static Plant_t Plant;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+
+/* mc_config.c */
+static void InitRegulators(void)
+{
+  const PID_Handle_t PIDIqInit =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIdInit =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+
+  PIDIq = PIDIqInit;
+  PIDId = PIDIdInit;
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+}
+
+/* Battery and load -----------------------------------------------------------*/
+
+static double ExternalLoad(const Case_t *pCase, double Time)
+{
+  double LoadA = pCase->LoadA;
+
+  if (Time < SETTLE_S)
+  {
+    /* The mean load while settling */
+    LoadA = (LOAD_CONSTANT == pCase->Load) ? LoadA : (0.5 * LoadA);
+  }
+  else if (LOAD_PULSES == pCase->Load)
+  {
+    LoadA = (fmod((Time - SETTLE_S) * PULSE_HZ, 1.0) < 0.5) ? LoadA : 0.0;
+  }
+  else if (LOAD_SINE == pCase->Load)
+  {
+    LoadA *= 0.5 * (1.0 - cos(TWO_PI * SINE_HZ * (Time - SETTLE_S)));
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (LoadA);
+}
+
+/* Integrates the windings and the bus from a sample to the next one */
+static void IntegratePeriod(const Case_t *pCase)
+{
+  const double Dt = 1.0 / ((double)ISR_FREQUENCY_HZ * (double)SUB_STEPS);
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    double VoltPerS16 = Plant.VbusV / (SQRT3 * 32768.0);
+    double Valpha;
+    double Vbeta;
+    double Vd;
+    double Vq;
+    double InverterA;
+
+    if ((SUB_STEPS / 2) == Sub)
+    {
+      /* Update event: the voltage set at the sample is loaded */
+      Plant.ValphaS16 = Plant.NextValphaS16;
+      Plant.VbetaS16 = Plant.NextVbetaS16;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* In the frame of MCM_Park: the d axis at (sin, cos) of the angle */
+    Valpha = Plant.ValphaS16 * VoltPerS16;
+    Vbeta = Plant.VbetaS16 * VoltPerS16;
+    Vd = (Valpha * sin(Plant.Theta)) + (Vbeta * cos(Plant.Theta));
+    Vq = (Valpha * cos(Plant.Theta)) - (Vbeta * sin(Plant.Theta));
+    Plant.Id += ((Vd - (RS * Plant.Id) + (Plant.W * LS * Plant.Iq)) * Dt) / LS;
+    Plant.Iq += ((Vq - (RS * Plant.Iq) - (Plant.W * LS * Plant.Id) - (Plant.W * HSO_FLUX_WB)) * Dt) / LS;
+    Plant.Theta = fmod(Plant.Theta + (Plant.W * Dt), TWO_PI);
+    Plant.Time += Dt;
+
+    /* The inverter draws the power of the windings from the bus */
+    InverterA = (1.5 * ((Vd * Plant.Id) + (Vq * Plant.Iq))) / Plant.VbusV;
+    Plant.VbusV = pCase->BatteryV - (ESR_OHM * (InverterA + ExternalLoad(pCase, Plant.Time)));
+
+    if (Plant.StepTime > 0.0)
+    {
+      double Fraction = (Plant.Iq - STEP_FROM_A) / (STEP_TO_A - STEP_FROM_A);
+
+      Plant.Rise10 = ((Plant.Rise10 < 0.0) && (Fraction >= 0.1)) ? (Plant.Time - Plant.StepTime) : Plant.Rise10;
+      Plant.Rise90 = ((Plant.Rise90 < 0.0) && (Fraction >= 0.9)) ? (Plant.Time - Plant.StepTime) : Plant.Rise90;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+}
+
+/* Value read by a 12 bits converter, left aligned */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+static uint16_t ReadVbus(double VbusV)
+{
+  double Lsb = floor((VbusV * VBUS_D_PER_VOLT) / 16.0);
+
+  Lsb = fmin(fmax(Lsb, 0.0), 4095.0);
+  return ((uint16_t)(Lsb * 16.0));
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* FOC_CurrControllerM1 on the exact angle, with or without the compensation */
+static void RunHF(int32_t wIqref, bool bCompensation)
+{
+  double Ialpha = (Plant.Id * sin(Plant.Theta)) + (Plant.Iq * cos(Plant.Theta));
+  double Ibeta = (Plant.Id * cos(Plant.Theta)) - (Plant.Iq * sin(Plant.Theta));
+  int16_t hIa = ReadCurrent(Ialpha);
+  int16_t hIb = ReadCurrent((-0.5 * Ialpha) - ((SQRT3 / 2.0) * Ibeta));
+  uint16_t hVbus_d = ReadVbus(Plant.VbusV);
+  double Angle = Plant.Theta;
+  double Module;
+  qd_t Iqd;
+  qd_t Vqd;
+
+  /* MCM_Clarke, MCM_Park */
+  Ialpha = (double)hIa;
+  Ibeta = -((double)hIa + (2.0 * (double)hIb)) / SQRT3;
+  Iqd.q = (int16_t)lround((Ialpha * cos(Angle)) - (Ibeta * sin(Angle)));
+  Iqd.d = (int16_t)lround((Ialpha * sin(Angle)) + (Ibeta * cos(Angle)));
+
+  Vqd.q = PI_Controller(&PIDIq, wIqref - Iqd.q);
+  Vqd.d = PI_Controller(&PIDId, -(int32_t)Iqd.d);
+  if (true == bCompensation)
+  {
+    Vqd = FOCP_CompensateVbus(Vqd, hVbus_d, NOMINAL_BUS_VOLTAGE_d, UNDERVOLTAGE_THRESHOLD_d);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Circle_Limitation */
+  Module = hypot((double)Vqd.q, (double)Vqd.d);
+  Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+  Vqd.q = (int16_t)lround((double)Vqd.q * Module);
+  Vqd.d = (int16_t)lround((double)Vqd.d * Module);
+
+  /* MCM_Rev_Park then PWMC_SetPhaseVoltage, applied from the next update event */
+  Plant.NextValphaS16 = ((double)Vqd.q * cos(Angle)) + ((double)Vqd.d * sin(Angle));
+  Plant.NextVbetaS16 = ((double)Vqd.d * cos(Angle)) - ((double)Vqd.q * sin(Angle));
+}
+
+static Result_t Run(const Case_t *pCase, bool bCompensation)
+{
+  const long Periods = lround((SETTLE_S + (pCase->bStep ? STEP_S : LOAD_S)) * (double)ISR_FREQUENCY_HZ);
+  Result_t Result = {pCase->BatteryV, 0.0, 0.0, 0.0};
+  double SquareSum = 0.0;
+  long Samples = 0;
+  long k;
+
+  Plant = (Plant_t){0};
+  Plant.W = (TWO_PI * SPEED_RPM * (double)POLE_PAIR_NUM) / 60.0;
+  Plant.VbusV = pCase->BatteryV - (ESR_OHM * ExternalLoad(pCase, 0.0));
+  Plant.Rise10 = -1.0;
+  Plant.Rise90 = -1.0;
+  InitRegulators();
+
+  for (k = 0; k < Periods; k++)
+  {
+    bool bMeasure = (Plant.Time >= SETTLE_S);
+    double RefA = (pCase->bStep && !bMeasure) ? STEP_FROM_A : (pCase->bStep ? STEP_TO_A : HOLD_A);
+
+    if (pCase->bStep && bMeasure && (Plant.StepTime <= 0.0))
+    {
+      Plant.StepTime = Plant.Time;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    RunHF(lround(RefA * S16_PER_AMP), bCompensation);
+    IntegratePeriod(pCase);
+    if (bMeasure)
+    {
+      SquareSum += (Plant.Iq - RefA) * (Plant.Iq - RefA);
+      Samples++;
+      Result.MinVbusV = fmin(Result.MinVbusV, Plant.VbusV);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Result.IqSum += Plant.Iq;
+  }
+  Result.RiseUs = ((Plant.Rise10 >= 0.0) && (Plant.Rise90 >= 0.0)) ? ((Plant.Rise90 - Plant.Rise10) * 1.0e6) : -1.0;
+  Result.RmsA = sqrt(SquareSum / (double)Samples);
+  return (Result);
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {"Iq step, no external load",      BATTERY_V, LOAD_CONSTANT, 0.0,        true},
+    {"Iq step, bus sagged",            BATTERY_V, LOAD_CONSTANT, SAG_LOAD_A, true},
+    {"load pulses",                    BATTERY_V, LOAD_PULSES,   SAG_LOAD_A, false},
+    {"sine load",                      BATTERY_V, LOAD_SINE,     SAG_LOAD_A, false},
+    {"Iq step, charged battery",       CHARGED_V, LOAD_CONSTANT, 0.0,        true},
+  };
+  Result_t Without[sizeof(Cases) / sizeof(Cases[0])];
+  Result_t With[sizeof(Cases) / sizeof(Cases[0])];
+  qd_t Vqd = {10000, -20000};
+  qd_t Low;
+  qd_t Threshold;
+  qd_t Saturated;
+  size_t i;
+
+  printf("Motor at %.0f rpm, battery %.1f V behind %.2f Ohm, external load up to %.0f A\n\n", SPEED_RPM, BATTERY_V,
+         ESR_OHM, SAG_LOAD_A);
+  printf("%-28s %10s  %21s  %21s\n", "", "", "without compensation", "with compensation");
+  printf("%-28s %10s  %10s %10s  %10s %10s\n", "case", "min bus V", "rise us", "rms A", "rise us", "rms A");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    Without[i] = Run(&Cases[i], false);
+    With[i] = Run(&Cases[i], true);
+    printf("%-28s %10.2f  %10.0f %10.3f  %10.0f %10.3f\n", Cases[i].pName, With[i].MinVbusV, Without[i].RiseUs,
+           Without[i].RmsA, With[i].RiseUs, With[i].RmsA);
+  }
+  printf("\n");
+
+  Check("sagged bus: the uncompensated step slowed by the sag",
+        Without[1].RiseUs > (1.5 * Without[0].RiseUs));
+  Check("sagged bus: the compensated step as fast as without external load",
+        (With[1].RiseUs > 0.0) && (With[1].RiseUs <= (RISE_RATIO * With[0].RiseUs)));
+  Check("load pulses: Iq error reduced by the compensation", With[2].RmsA < (RMS_RATIO * Without[2].RmsA));
+  Check("sine load: Iq error reduced by the compensation", With[3].RmsA < (RMS_RATIO * Without[3].RmsA));
+  Check("charged battery: the compensation does not act", Without[4].IqSum == With[4].IqSum);
+
+  Low = FOCP_CompensateVbus(Vqd, UNDERVOLTAGE_THRESHOLD_d / 2U, NOMINAL_BUS_VOLTAGE_d, UNDERVOLTAGE_THRESHOLD_d);
+  Threshold = FOCP_CompensateVbus(Vqd, UNDERVOLTAGE_THRESHOLD_d, NOMINAL_BUS_VOLTAGE_d, UNDERVOLTAGE_THRESHOLD_d);
+  Check("below the under voltage threshold, the gain of the threshold",
+        (Low.q == Threshold.q) && (Low.d == Threshold.d)
+        && (fabs(((double)Threshold.q / (double)Vqd.q)
+                 - ((double)NOMINAL_BUS_VOLTAGE_d / (double)UNDERVOLTAGE_THRESHOLD_d)) < 0.001));
+  Vqd.q = 30000;
+  Vqd.d = -30000;
+  Saturated = FOCP_CompensateVbus(Vqd, NOMINAL_BUS_VOLTAGE_d / 2U, NOMINAL_BUS_VOLTAGE_d, UNDERVOLTAGE_THRESHOLD_d);
+  Check("outputs saturated to the s16 range", (INT16_MAX == Saturated.q) && (-INT16_MAX == Saturated.d));
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,398 @@
+/**
+  ******************************************************************************
+  * @file    cogging_plant.c
+  * @brief   Host test of the Cogging Compensation on a plant model with a
+  *          synthetic cogging profile.
+  *
+  * The firmware Cogging Compensation runs with the settings of mc_config.c,
+  * the table added to the Iq reference and the speed accumulated at
+  * TF_REGULATION_RATE, COG_Task and the speed regulator,
+  * STC_CalcTorqueReference with its PI, at MEDIUM_FREQUENCY_TASK_RATE. The
+  * plant model is stepped at TF_REGULATION_RATE:
+  *
+  * - rotor and propeller of inertia and friction MOTOR_INERTIA_KGM2 and
+  *   MOTOR_FRICTION_NMS, loaded by the propeller torque, quadratic in the
+  *   speed, and by the cogging torque, COGGING_NM on the harmonics 12 and 24
+  *   of the electrical angle, those of a 12 slots, 14 poles motor;
+  * - Iq following its reference with the time constant of the current loop;
+  * - angle and speed given by a PLL with the gains of the State Observer on
+  *   the electrical angle, with ANGLE_NOISE of noise.
+  *
+  * The ripple of the true speed, taken from its mean over the last electrical
+  * revolution, is measured without the table and with the table learnt for
+  * LEARN_S at LEARN_RPM. The learning must cut it by
+  * RIPPLE_CUT, within EXACT_MARGIN of the ripple left by a table of the
+  * exact cogging torque, and by NOISY_CUT with a noisy angle or an error of
+  * the inertia by a factor INERTIA_ERROR. The table learnt must be the
+  * cogging torque within TABLE_ERROR, and still cut the ripple by USE_CUT at
+  * other speeds. The learning must stay out of its speed range, and nothing must
+  * be added in COG_OFF mode or above COG_COMP_MAX_RPM. The program returns 1
+  * when a check fails.
+  *
+  * Usage: cogging_plant
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "speed_torq_ctrl.h"
+#include "cogging_comp.h"
+
+/* Cogging torque, N.m, on the harmonics 12 and 24 of the electrical angle */
+#define COGGING_NM              5.0e-3
+#define COGGING_H24_RATIO       0.4
+#define COGGING_H24_PHASE       1.0
+/* Current loop of the drive, first order */
+#define CURRENT_LOOP_TAU_S      2.0e-4
+/* Propeller torque at the maximum speed, A of Iq */
+#define PROPELLER_IQ_A          ((double)NOMINAL_CURRENT_A)
+/* Noise of the angle of the speed sensor, s16degree */
+#define ANGLE_NOISE             100.0
+/* Learning, and runs without learning, the ripple measured on their last second */
+#define LEARN_RPM               150.0
+#define LEARN_S                 30.0
+#define RUN_S                   2.0
+#define MEASURE_S               1.0
+/* Current control periods of an electrical revolution at the lowest speed run */
+#define REVOLUTION_MAX          4096
+/* Required of the compensation */
+#define RIPPLE_CUT              5.0
+#define EXACT_MARGIN            1.25
+#define NOISY_CUT               3.0
+#define USE_CUT                 2.0
+#define TABLE_ERROR             0.15
+#define INERTIA_ERROR           2.0
+
+#define TWO_PI                  6.283185307179586
+
+/* Cogging compensation of mc_config.c */
+static const COG_Handle_t CoggingConfig =
+{
+  .hSpeedRatio       = 1U,
+  .hIqMax            = (int16_t)COG_IQ_MAX,
+  .hCompMaxSpeed     = (int16_t)COG_COMP_MAX_UNIT,
+  .hLearnMinSpeed    = (int16_t)COG_LEARN_MIN_UNIT,
+  .hLearnMaxSpeed    = (int16_t)COG_LEARN_MAX_UNIT,
+  .hLearnRevolutions = COG_LEARN_REVOLUTIONS,
+  .fAccelPerDigit    = (float_t)COG_ACCEL_PER_DIGIT,
+  .fLearnGain        = (float_t)COG_LEARN_GAIN,
+  .fSensorLag        = (float_t)COG_SENSOR_LAG,
+};
+
+static const double Kt = 1.5 * POLE_PAIR_NUM * HSO_FLUX_WB;            /* N.m/A */
+
+static uint32_t Seed = 1U;
+
+/* Uniform in [-Range, Range] */
+static double Noise(double Range)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Range * ((2.0 * (double)(Seed >> 8) / 16777216.0) - 1.0));
+}
+
+/* Cogging torque at an electrical angle, N.m */
+static double Cogging(double ElAngle)
+{
+  return (COGGING_NM * (sin(12.0 * ElAngle) + (COGGING_H24_RATIO * sin((24.0 * ElAngle) + COGGING_H24_PHASE))));
+}
+
+/* Drive and plant, kept from a run to the next */
+typedef struct
+{
+  COG_Handle_t Cog;
+  PID_Handle_t PISpeed;
+  SpeednPosFdbk_Handle_t Sensor;
+  SpeednTorqCtrl_Handle_t STC;
+  double Noise;                            /* Of the angle, s16degree */
+  double Theta;                            /* Mechanical angle, rad */
+  double W;                                /* Mechanical speed, rad/s */
+  double Iq;
+  double IqRef;                            /* Of the speed regulator, digit */
+  double PllAngle;                         /* s16degree */
+  double PllSpeed;                         /* s16degree per period */
+  double PllIntegral;
+} Drive_t;
+
+static void Start(Drive_t *pDrive, double SpeedRpm, double InertiaRatio, double AngleNoise)
+{
+  const double Wmax = (MAX_APPLICATION_SPEED_RPM * TWO_PI) / 60.0;
+  const double Kprop = (Kt * PROPELLER_IQ_A) / (Wmax * Wmax);
+  const int16_t hSpeedRef = (int16_t)lrint((SpeedRpm * SPEED_UNIT) / U_RPM);
+  PID_Handle_t PISpeed =
+  {
+    .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+    .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)SP_KPDIV,
+    .hKiDivisor          = (uint16_t)SP_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  };
+  SpeednTorqCtrl_Handle_t STC =
+  {
+    .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+    .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
+    .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .MaxPositiveTorque          = (int16_t)NOMINAL_CURRENT,
+    .MinNegativeTorque          = -(int16_t)NOMINAL_CURRENT,
+    .ModeDefault                = MCM_SPEED_MODE,
+    .MecSpeedRefUnitDefault     = hSpeedRef,
+    .SpeedFilter                = MC_NULL,
+    .LoadObserver               = MC_NULL,
+  };
+
+  pDrive->Cog = CoggingConfig;
+  pDrive->Cog.pSTC = &pDrive->STC;
+  pDrive->Cog.fAccelPerDigit = (float_t)(COG_ACCEL_PER_DIGIT / InertiaRatio);
+  pDrive->PISpeed = PISpeed;
+  pDrive->STC = STC;
+  pDrive->Noise = AngleNoise;
+  PID_HandleInit(&pDrive->PISpeed);
+  STC_Init(&pDrive->STC, &pDrive->PISpeed, &pDrive->Sensor);
+  COG_Init(&pDrive->Cog);
+
+  /* Steady state at the reference, the propeller torque held by the integral term */
+  pDrive->Theta = 0.0;
+  pDrive->W = (SpeedRpm * TWO_PI) / 60.0;
+  pDrive->Iq = (Kprop * pDrive->W * pDrive->W) + (MOTOR_FRICTION_NMS * pDrive->W);
+  pDrive->Iq /= Kt;
+  pDrive->IqRef = pDrive->Iq * CURRENT_CONV_FACTOR;
+  PID_SetIntegralTerm(&pDrive->PISpeed, (int32_t)(pDrive->IqRef * SP_KIDIV));
+  pDrive->PllAngle = 0.0;
+  pDrive->PllSpeed = ((pDrive->W * POLE_PAIR_NUM) / TWO_PI) * (65536.0 / (double)TF_REGULATION_RATE);
+  pDrive->PllIntegral = pDrive->PllSpeed;
+  pDrive->Sensor.hAvrMecSpeedUnit = hSpeedRef;
+}
+
+/* Runs the drive at a speed in a mode, returns the ripple of the true speed over the last MEASURE_S, rpm rms.
+   The ripple is taken from the mean speed of the last electrical revolution, that holds the harmonics of the
+   electrical angle and not the slower wander of the speed regulator on its speed of #SPEED_UNIT */
+static double Run(Drive_t *pDrive, double SpeedRpm, COG_Mode_t Mode, double Seconds)
+{
+  static double Revolution[REVOLUTION_MAX];
+  const int Periods = (int)lrint((60.0 * (double)TF_REGULATION_RATE) / (SpeedRpm * POLE_PAIR_NUM));
+  const double Wmax = (MAX_APPLICATION_SPEED_RPM * TWO_PI) / 60.0;
+  const double Kprop = (Kt * PROPELLER_IQ_A) / (Wmax * Wmax);
+  const double J = MOTOR_INERTIA_KGM2;
+  const double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  const int Ratio = TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE;
+  const int Steps = (int)(Seconds * (double)TF_REGULATION_RATE);
+  const int MeasureAt = Steps - (int)(MEASURE_S * (double)TF_REGULATION_RATE);
+  double SpeedSum = 0.0;
+  double RevolutionSum = 0.0;
+  double SquareSum = 0.0;
+  int i;
+
+  COG_SetMode(&pDrive->Cog, Mode);
+  STC_ExecRamp(&pDrive->STC, (int16_t)lrint((SpeedRpm * SPEED_UNIT) / U_RPM), 0U);
+  for (i = 0; i < Steps; i++)
+  {
+    int16_t hElAngle = (int16_t)((uint16_t)lrint(pDrive->PllAngle));
+    double Load = (Kprop * pDrive->W * pDrive->W) + (MOTOR_FRICTION_NMS * pDrive->W);
+    double IqRef;
+    double Error;
+
+    /* Current control: the table added to the Iq reference, the speed accumulated */
+    IqRef = pDrive->IqRef + (double)COG_GetIq(&pDrive->Cog, hElAngle);
+    COG_Accumulate(&pDrive->Cog, hElAngle, (int16_t)lrint(pDrive->PllSpeed));
+
+    pDrive->Iq += ((IqRef / CURRENT_CONV_FACTOR) - pDrive->Iq) * (Ts / CURRENT_LOOP_TAU_S);
+    pDrive->W += ((Kt * pDrive->Iq) + Cogging(pDrive->Theta * POLE_PAIR_NUM) - Load) * (Ts / J);
+    pDrive->Theta = fmod(pDrive->Theta + (pDrive->W * Ts), TWO_PI);
+
+    /* Speed sensor: PLL on the electrical angle */
+    Error = remainder(((pDrive->Theta * POLE_PAIR_NUM * 65536.0) / TWO_PI) + Noise(pDrive->Noise) - pDrive->PllAngle,
+                      65536.0);
+    pDrive->PllIntegral += (Error * PLL_KI_GAIN) / PLL_KIDIV;
+    pDrive->PllSpeed = ((Error * PLL_KP_GAIN) / PLL_KPDIV) + pDrive->PllIntegral;
+    pDrive->PllAngle = fmod(pDrive->PllAngle + pDrive->PllSpeed + 65536.0, 65536.0);
+    SpeedSum += pDrive->PllSpeed;
+
+    if ((Ratio - 1) == (i % Ratio))
+    {
+      /* Medium frequency task */
+      double Hz = ((SpeedSum / (double)Ratio) * (double)TF_REGULATION_RATE) / (65536.0 * POLE_PAIR_NUM);
+
+      pDrive->Sensor.hAvrMecSpeedUnit = (int16_t)lrint(Hz * SPEED_UNIT);
+      SpeedSum = 0.0;
+      pDrive->IqRef = (double)STC_CalcTorqueReference(&pDrive->STC);
+      COG_Task(&pDrive->Cog, true);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    RevolutionSum += ((pDrive->W * 60.0) / TWO_PI) - ((i >= Periods) ? Revolution[i % Periods] : 0.0);
+    Revolution[i % Periods] = (pDrive->W * 60.0) / TWO_PI;
+    if (i >= MeasureAt)
+    {
+      double Ripple = Revolution[i % Periods] - (RevolutionSum / (double)Periods);
+
+      SquareSum += Ripple * Ripple;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (sqrt(SquareSum / (double)(Steps - MeasureAt)));
+}
+
+/* Iq of the cogging torque at an entry of the table, digit */
+static double CoggingIq(unsigned int Entry)
+{
+  return ((Cogging((TWO_PI * (double)Entry) / (double)COG_TABLE_SIZE) / Kt) * CURRENT_CONV_FACTOR);
+}
+
+/* Error of the table to the cogging torque, relative to the cogging torque, rms */
+static double TableError(const COG_Handle_t *pCog)
+{
+  double Error = 0.0;
+  double Torque = 0.0;
+  unsigned int i;
+
+  for (i = 0U; i < COG_TABLE_SIZE; i++)
+  {
+    double Ideal = -CoggingIq(i);
+
+    Error += ((double)pCog->hTable[i] - Ideal) * ((double)pCog->hTable[i] - Ideal);
+    Torque += Ideal * Ideal;
+  }
+  return (sqrt(Error / Torque));
+}
+
+typedef struct
+{
+  double Before;                           /* Ripple without the table, rpm rms */
+  double After;                            /* With the table learnt */
+  double TableError;
+  uint16_t hIterations;
+} Learn_t;
+
+/* Learns the table at LEARN_RPM */
+static Learn_t Learn(Drive_t *pDrive, double InertiaRatio, double AngleNoise)
+{
+  Learn_t Result;
+
+  Start(pDrive, LEARN_RPM, InertiaRatio, AngleNoise);
+  Result.Before = Run(pDrive, LEARN_RPM, COG_OFF, RUN_S);
+  (void)Run(pDrive, LEARN_RPM, COG_LEARN, LEARN_S);
+  Result.hIterations = COG_GetIterations(&pDrive->Cog);
+  Result.After = Run(pDrive, LEARN_RPM, COG_COMPENSATE, RUN_S);
+  Result.TableError = TableError(&pDrive->Cog);
+  return (Result);
+}
+
+/* Ripple at LEARN_RPM with the table of the exact cogging torque, rpm rms */
+static double RunExactTable(Drive_t *pDrive)
+{
+  unsigned int i;
+
+  Start(pDrive, LEARN_RPM, 1.0, 0.0);
+  for (i = 0U; i < COG_TABLE_SIZE; i++)
+  {
+    pDrive->Cog.hTable[i] = (int16_t)lrint(-CoggingIq(i));
+  }
+  return (Run(pDrive, LEARN_RPM, COG_COMPENSATE, RUN_S));
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+int main(void)
+{
+  static const double UseRpm[] = {60.0, 500.0, 1000.0};
+  static Drive_t Drive;
+  Learn_t Clean;
+  Learn_t Noisy;
+  Learn_t Low;
+  Learn_t High;
+  double Exact;
+  bool bUsed = true;
+  bool bOutside;
+  bool bOff;
+  unsigned int i;
+
+  printf("Cogging of %.1f mN.m, learnt %.0f s at %.0f rpm: true speed ripple, rpm rms\n",
+         COGGING_NM * 1000.0, LEARN_S, LEARN_RPM);
+  printf("%-28s %10s %10s %12s %12s\n", "", "before", "after", "iterations", "table error");
+  Clean = Learn(&Drive, 1.0, 0.0);
+  printf("%-28s %10.3f %10.3f %12u %12.3f\n", "exact angle", Clean.Before, Clean.After, Clean.hIterations,
+         Clean.TableError);
+  Noisy = Learn(&Drive, 1.0, ANGLE_NOISE);
+  printf("%-28s %10.3f %10.3f %12u %12.3f\n", "noisy angle", Noisy.Before, Noisy.After, Noisy.hIterations,
+         Noisy.TableError);
+  Low = Learn(&Drive, 1.0 / INERTIA_ERROR, ANGLE_NOISE);
+  printf("%-28s %10.3f %10.3f %12u %12.3f\n", "noisy angle, inertia / 2", Low.Before, Low.After, Low.hIterations,
+         Low.TableError);
+  High = Learn(&Drive, INERTIA_ERROR, ANGLE_NOISE);
+  printf("%-28s %10.3f %10.3f %12u %12.3f\n", "noisy angle, inertia x 2", High.Before, High.After, High.hIterations,
+         High.TableError);
+  Exact = RunExactTable(&Drive);
+  printf("%-28s %10s %10.3f\n", "table of the cogging torque", "", Exact);
+  Check("exact angle: ripple cut by RIPPLE_CUT", (RIPPLE_CUT * Clean.After) <= Clean.Before);
+  Check("exact angle: ripple within EXACT_MARGIN of the exact table", Clean.After <= (EXACT_MARGIN * Exact));
+  Check("exact angle: table is the cogging torque within TABLE_ERROR", Clean.TableError <= TABLE_ERROR);
+  Check("noisy angle: ripple cut by NOISY_CUT", (NOISY_CUT * Noisy.After) <= Noisy.Before);
+  Check("inertia off by INERTIA_ERROR: ripple cut by NOISY_CUT",
+        ((NOISY_CUT * Low.After) <= Low.Before) && ((NOISY_CUT * High.After) <= High.Before));
+
+  /* Table learnt with the noisy angle, used at other speeds */
+  for (i = 0U; i < (sizeof(UseRpm) / sizeof(UseRpm[0])); i++)
+  {
+    double Before;
+    double After;
+
+    (void)Learn(&Drive, 1.0, ANGLE_NOISE);
+    Before = Run(&Drive, UseRpm[i], COG_OFF, RUN_S);
+    After = Run(&Drive, UseRpm[i], COG_COMPENSATE, RUN_S);
+    printf("used at %4.0f rpm: ripple %.3f -> %.3f rpm rms\n", UseRpm[i], Before, After);
+    bUsed = bUsed && ((USE_CUT * After) <= Before);
+  }
+  Check("table used out of the learning range: ripple cut by USE_CUT", bUsed);
+
+  /* Out of the learning range, no iteration */
+  Start(&Drive, 0.5 * LEARN_RPM, 1.0, 0.0);
+  (void)Run(&Drive, 0.5 * LEARN_RPM, COG_LEARN, RUN_S);
+  bOutside = (0U == COG_GetIterations(&Drive.Cog));
+  Start(&Drive, COG_LEARN_MAX_RPM + 50.0, 1.0, 0.0);
+  (void)Run(&Drive, COG_LEARN_MAX_RPM + 50.0, COG_LEARN, RUN_S);
+  Check("no learning out of COG_LEARN_MIN_RPM..COG_LEARN_MAX_RPM", bOutside && (0U == COG_GetIterations(&Drive.Cog)));
+
+  /* Nothing added when off or above COG_COMP_MAX_RPM, the table kept */
+  (void)Learn(&Drive, 1.0, 0.0);
+  (void)Run(&Drive, LEARN_RPM, COG_OFF, 0.01);
+  bOff = (0 == COG_GetIq(&Drive.Cog, 0)) && (0 != Drive.Cog.hTable[0]);
+  COG_SetMode(&Drive.Cog, COG_COMPENSATE);
+  Drive.Sensor.hAvrMecSpeedUnit = (int16_t)(COG_COMP_MAX_UNIT + 1);
+  COG_Task(&Drive.Cog, true);
+  Check("nothing added in COG_OFF mode or above COG_COMP_MAX_RPM",
+        bOff && (false == Drive.Cog.bActive) && (0 != Drive.Cog.hTable[0]));
+
+  /* Interpolation between two entries, across the last one */
+  {
+    COG_Handle_t Cog = CoggingConfig;
+    int16_t hStep = (int16_t)(65536 / COG_TABLE_SIZE);
+
+    COG_Init(&Cog);
+    Cog.bActive = true;
+    Cog.hTable[0] = 100;
+    Cog.hTable[1] = 300;
+    Cog.hTable[COG_TABLE_SIZE - 1U] = -100;
+    Check("table interpolated between two entries, across 360 degrees",
+          (200 == COG_GetIq(&Cog, (int16_t)(hStep / 2))) && (300 == COG_GetIq(&Cog, hStep))
+          && (0 == COG_GetIq(&Cog, (int16_t)(-hStep / 2))) && (-100 == COG_GetIq(&Cog, (int16_t)(-hStep))));
+  }
+
+  return ((0 == Failures) ? 0 : 1);
+}
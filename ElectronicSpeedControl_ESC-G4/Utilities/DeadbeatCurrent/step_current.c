@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file    step_current.c
+  * @brief   Host benchmark of the Deadbeat Current Controller against the PI
+  *          regulators of the currents: settling of a step of the Iq
+  *          reference and duration of the regulation.
+  *
+  * The firmware regulators, PI_Controller with the Iq and Id gains of the
+  * drive and DBC_Controller with its fallback as FOC_CurrControllerM1 runs
+  * it, drive a model of the windings integrated within each period:
+  *
+  * - resistance, inductance and flux of the motor parameters, scaled to test
+  *   errors of the model, at a constant electrical speed;
+  * - currents sampled at the start of the period, voltage computed from them
+  *   applied over the next period;
+  * - voltage vector limited to MAX_MODULE at the nominal bus voltage.
+  *
+  * Usage: step_current
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "parameters_conversion.h"
+#include "deadbeat_current_ctrl.h"
+
+/* Periods before the step, to reach the steady state, and after it */
+#define PERIODS_BEFORE          400
+#define PERIODS_AFTER           200
+/* Integration steps of the windings per period */
+#define SUB_STEPS               64
+/* Current error within which the step is settled, relative to the step */
+#define SETTLING_BAND           0.02
+
+#define TWO_PI                  6.283185307179586
+
+typedef struct
+{
+  const char *pName;
+  bool bDeadbeat;
+  double Gain;                             /* Of the deadbeat, 0: DBC_GAIN */
+  double FromA;                            /* Iq step */
+  double ToA;
+  double SpeedRpm;
+  double ResistanceRatio;                  /* Actual over modelled */
+  double InductanceRatio;
+  double FluxRatio;
+} Case_t;
+
+typedef struct
+{
+  int Settling;                            /* Periods after the step, the first voltage applied at 1 */
+  double OvershootPercent;
+  double IdPeakA;
+  uint32_t Fallbacks;
+} Result_t;
+
+static void InitRegulators(PID_Handle_t *pPIDIq, PID_Handle_t *pPIDId, DBC_Handle_t *pDBC, double Gain)
+{
+  const PID_Handle_t PIDIq =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDId =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const DBC_Handle_t DBC =
+  {
+    .pPIDIq              = pPIDIq,
+    .pPIDId              = pPIDId,
+    .fResistance         = (float_t)DBC_RESISTANCE,
+    .fInductance         = (float_t)DBC_INDUCTANCE,
+    .fEmfPerDpp          = (float_t)DBC_EMF_PER_DPP,
+    .fGain               = (float_t)((Gain > 0.0) ? Gain : DBC_GAIN),
+    .fDisturbanceGain    = (float_t)DBC_DISTURBANCE_GAIN,
+    .hMaxModule          = MAX_MODULE,
+    .hHoldPeriods        = DBC_HOLD_PERIODS,
+    .bEnabled            = true,
+  };
+
+  *pPIDIq = PIDIq;
+  *pPIDId = PIDId;
+  *pDBC = DBC;
+  PID_HandleInit(pPIDIq);
+  PID_HandleInit(pPIDId);
+  DBC_Init(pDBC);
+}
+
+/* Regulation of FOC_CurrControllerM1 */
+static qd_t Regulate(const Case_t *pCase, PID_Handle_t *pPIDIq, PID_Handle_t *pPIDId, DBC_Handle_t *pDBC,
+                     qd_t Iqd, int32_t wIqref, int16_t hElSpeedDpp)
+{
+  qd_t Vqd = {0, 0};
+  bool bDeadbeat = false;
+
+  if (true == pCase->bDeadbeat)
+  {
+    bDeadbeat = DBC_Controller(pDBC, Iqd, wIqref, 0, hElSpeedDpp, &Vqd);
+  }
+  if (false == bDeadbeat)
+  {
+    Vqd.q = PI_Controller(pPIDIq, wIqref - Iqd.q);
+    Vqd.d = PI_Controller(pPIDId, -Iqd.d);
+    DBC_SetApplied(pDBC, Vqd);
+  }
+  return (Vqd);
+}
+
+static Result_t Run(const Case_t *pCase)
+{
+  const double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  const double Dt = Ts / SUB_STEPS;
+  const double R = RS * pCase->ResistanceRatio;
+  const double L = LS * pCase->InductanceRatio;
+  const double Psi = HSO_FLUX_WB * pCase->FluxRatio;
+  const double W = (pCase->SpeedRpm * TWO_PI * POLE_PAIR_NUM) / 60.0;
+  const int16_t hElSpeedDpp = (int16_t)lround((W * 65536.0) / (TWO_PI * (double)TF_REGULATION_RATE));
+  const double Step = pCase->ToA - pCase->FromA;
+  PID_Handle_t PIDIq;
+  PID_Handle_t PIDId;
+  DBC_Handle_t DBC;
+  double Id = 0.0;
+  double Iq = 0.0;
+  double Vd = 0.0;                         /* Applied over the current period, V */
+  double Vq = 0.0;
+  double Peak = pCase->FromA;
+  uint32_t wFallbacks = 0U;
+  Result_t Result = {0, 0.0, 0.0, 0U};
+  int k;
+
+  InitRegulators(&PIDIq, &PIDId, &DBC, pCase->Gain);
+  for (k = -PERIODS_BEFORE; k < PERIODS_AFTER; k++)
+  {
+    double RefA = (k < 0) ? pCase->FromA : pCase->ToA;
+    qd_t Iqd;
+    qd_t Vqd;
+    double Module;
+    int s;
+
+    if (0 == k)
+    {
+      wFallbacks = DBC_GetFallbacks(&DBC);
+    }
+    Iqd.q = (int16_t)lround(Iq * CURRENT_CONV_FACTOR);
+    Iqd.d = (int16_t)lround(Id * CURRENT_CONV_FACTOR);
+    if (k >= 0)
+    {
+      if (fabs(Iq - pCase->ToA) > (SETTLING_BAND * fabs(Step)))
+      {
+        Result.Settling = k + 1;
+      }
+      Peak = (Step >= 0.0) ? fmax(Peak, Iq) : fmin(Peak, Iq);
+      Result.IdPeakA = fmax(Result.IdPeakA, fabs(Id));
+    }
+    Vqd = Regulate(pCase, &PIDIq, &PIDId, &DBC, Iqd, (int32_t)lround(RefA * CURRENT_CONV_FACTOR), hElSpeedDpp);
+
+    /* Windings over the period, under the voltage computed one period before */
+    for (s = 0; s < SUB_STEPS; s++)
+    {
+      double dId = (Vd - (R * Id) + (W * L * Iq)) / L;
+      double dIq = (Vq - (R * Iq) - (W * L * Id) - (W * Psi)) / L;
+
+      Id += dId * Dt;
+      Iq += dIq * Dt;
+    }
+
+    /* Circle limitation, then conversion at the nominal bus voltage */
+    Module = sqrt(((double)Vqd.q * Vqd.q) + ((double)Vqd.d * Vqd.d));
+    Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+    Vq = (Vqd.q * Module) / DBC_DIGIT_PER_VOLT;
+    Vd = (Vqd.d * Module) / DBC_DIGIT_PER_VOLT;
+  }
+  Result.OvershootPercent = (100.0 * (Peak - pCase->ToA)) / Step;
+  Result.Fallbacks = DBC_GetFallbacks(&DBC) - wFallbacks;
+  return (Result);
+}
+
+/* Host time of a regulation, ns */
+static double TimeRegulation(bool bDeadbeat)
+{
+  const Case_t Case = {"", bDeadbeat, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+  const int Calls = 10000000;
+  PID_Handle_t PIDIq;
+  PID_Handle_t PIDId;
+  DBC_Handle_t DBC;
+  struct timespec Start;
+  struct timespec End;
+  volatile int16_t hSink = 0;
+  int i;
+
+  InitRegulators(&PIDIq, &PIDId, &DBC, 0.0);
+  clock_gettime(CLOCK_MONOTONIC, &Start);
+  for (i = 0; i < Calls; i++)
+  {
+    qd_t Iqd = {(int16_t)(i & 0x3FF), (int16_t)((i >> 4) & 0xFF)};
+    qd_t Vqd = Regulate(&Case, &PIDIq, &PIDId, &DBC, Iqd, 512, 1000);
+
+    hSink = Vqd.q;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &End);
+  (void)hSink;
+  return ((((double)(End.tv_sec - Start.tv_sec) * 1e9) + (double)(End.tv_nsec - Start.tv_nsec)) / Calls);
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {"PI, 0 to 2 A, standstill",            false, 0.0, 0.0,  2.0,    0.0, 1.0, 1.0, 1.0},
+    {"deadbeat",                            true,  0.0, 0.0,  2.0,    0.0, 1.0, 1.0, 1.0},
+    {"PI, 2 to 4 A, 6000 rpm",              false, 0.0, 2.0,  4.0, 6000.0, 1.0, 1.0, 1.0},
+    {"deadbeat",                            true,  0.0, 2.0,  4.0, 6000.0, 1.0, 1.0, 1.0},
+    {"deadbeat, gain 1",                    true,  1.0, 2.0,  4.0, 6000.0, 1.0, 1.0, 1.0},
+    {"deadbeat, Ls x 0.7",                  true,  0.0, 2.0,  4.0, 6000.0, 1.0, 0.7, 1.0},
+    {"deadbeat, Ls x 1.5",                  true,  0.0, 2.0,  4.0, 6000.0, 1.0, 1.5, 1.0},
+    {"deadbeat, Ls x 1.5, gain 1",          true,  1.0, 2.0,  4.0, 6000.0, 1.0, 1.5, 1.0},
+    {"deadbeat, Rs x 1.5",                  true,  0.0, 2.0,  4.0, 6000.0, 1.5, 1.0, 1.0},
+    {"deadbeat, flux x 0.9",                true,  0.0, 2.0,  4.0, 6000.0, 1.0, 1.0, 0.9},
+    {"PI, 0 to 10 A, 9000 rpm",             false, 0.0, 0.0, 10.0, 9000.0, 1.0, 1.0, 1.0},
+    {"deadbeat",                            true,  0.0, 0.0, 10.0, 9000.0, 1.0, 1.0, 1.0},
+    {"deadbeat, gain 1, saturating",        true,  1.0, 0.0, 10.0, 9000.0, 1.0, 1.0, 1.0},
+  };
+  double PiNs;
+  double DeadbeatNs;
+  size_t i;
+
+  printf("Iq step, settling within %.0f %% in current control periods of %.1f us\n\n",
+         100.0 * SETTLING_BAND, 1e6 / (double)TF_REGULATION_RATE);
+  printf("%-34s %9s %10s %9s %10s\n", "", "settling", "overshoot", "Id peak", "fallbacks");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    Result_t Result = Run(&Cases[i]);
+
+    printf("%-34s %9d %8.1f %% %7.2f A %10u\n", Cases[i].pName, Result.Settling, Result.OvershootPercent,
+           Result.IdPeakA, (unsigned)Result.Fallbacks);
+  }
+
+  PiNs = TimeRegulation(false);
+  DeadbeatNs = TimeRegulation(true);
+  printf("\nHost time of the regulation: PI %.1f ns, deadbeat %.1f ns, ratio %.2f\n", PiNs, DeadbeatNs,
+         DeadbeatNs / PiNs);
+  return (0);
+}
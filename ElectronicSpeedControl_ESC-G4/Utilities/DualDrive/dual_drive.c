@@ -0,0 +1,462 @@
+/**
+  ******************************************************************************
+  * @file    dual_drive.c
+  * @brief   Host model of two motors driven by one STM32G4: speed tracking of
+  *          both motors and load of the interrupts on the shared core.
+  *
+  * Two motors of the drive parameters run at the same time on a simulated
+  * core at 170 MHz:
+  *
+  * - the PWM timers of the two motors are half a period apart, as the R3_2
+  *   driver starts them. Each end of the current conversions of a motor sets
+  *   the ADC interrupt, which runs its current regulation, PI_Controller with
+  *   the Iq and Id gains of the drive, for HF_US. A conversion ending while
+  *   the interrupt of the previous one is still pending is lost: the FIFO of
+  *   TSK_DualDriveFIFOUpdate would then pair the next interrupt with the
+  *   wrong motor;
+  * - the SysTick runs the firmware scheduler, SCHED_Tick, with the task
+  *   table of mc_tasks.c for two motors: the Medium Frequency tasks of the
+  *   motors released on alternate ticks, each running the speed regulation of
+  *   its motor for MF_US, and the safety task every tick for SAFETY_US. The
+  *   ADC interrupts preempt the SysTick, the cycle counter of the scheduler
+  *   is the simulated time;
+  * - each motor is a dq model of the windings and of the rotor, with the
+  *   voltage computed at a conversion applied over the next period.
+  *
+  * The durations are those of the build, to be replaced by the ones measured
+  * on the target (DWT around FOC_HighFrequencyTask, wMaxExecCycles of the
+  * scheduler): make run HF_US=12 MF_US=20. The model is run with them, then
+  * with longer current regulations to find where the dual drive stops
+  * fitting in a PWM period. The program returns 1 when, with the durations
+  * of the build, a motor misses its speed, a conversion is lost, a current
+  * regulation ends after the next PWM update or a scheduled task overruns or
+  * misses its deadline.
+  *
+  * Usage: dual_drive
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "pid_regulator.h"
+#include "mc_scheduler.h"
+#include "stm32g4xx.h"
+
+/* Core debug registers of the scheduler, simulated */
+static DWT_Type HostDWT;
+static CoreDebug_Type HostCoreDebug;
+static SCB_Type HostSCB;
+#undef DWT
+#undef CoreDebug
+#undef SCB
+#define DWT                     (&HostDWT)
+#define CoreDebug               (&HostCoreDebug)
+#define SCB                     (&HostSCB)
+#include "mc_scheduler.c"
+
+/* Durations on the target, us */
+#ifndef HF_US
+#define HF_US                   10.0
+#endif
+#ifndef MF_US
+#define MF_US                   15.0
+#endif
+#ifndef SAFETY_US
+#define SAFETY_US               3.0
+#endif
+#ifndef TICK_US
+#define TICK_US                 1.0               /* Entry of the SysTick and releases */
+#endif
+
+#define CORE_CLOCK_HZ           170000000U
+#define PWM_CYCLES              (CORE_CLOCK_HZ / TF_REGULATION_RATE)
+#define TICK_CYCLES             (CORE_CLOCK_HZ / SYS_TICK_FREQUENCY)
+#define US_TO_CYCLES(us)        ((uint64_t)llround((us) * (double)CORE_CLOCK_HZ / 1e6))
+/* End of the conversions after the update of the timer, sampling at the middle of the period */
+#define CONVERSION_DELAY        (PWM_CYCLES / 2U)
+
+#define RUN_S                   8.0
+#define SETTLED_S               6.0               /* Speed checked from this time */
+#define SPEED_TOLERANCE         0.02
+#define SUB_STEPS               16
+#define TWO_PI                  6.283185307179586
+
+#define MOTORS                  2
+
+#define TASK_MF_M1              0U
+#define TASK_SAFETY             1U
+#define TASK_MF_M2              2U
+#define TASK_NBR                3U
+
+typedef struct
+{
+  double SpeedRpm;                         /* Reference */
+  double LoadNm;                           /* Constant load, on top of the friction */
+  PID_Handle_t PIDIq;
+  PID_Handle_t PIDId;
+  PID_Handle_t PIDSpeed;
+  int32_t wIqref;                          /* Set by the Medium Frequency task, digit */
+  double Id;                               /* Plant, A and rad/s mechanical */
+  double Iq;
+  double Omega;
+  double Vd;                               /* Applied over the current period, V */
+  double Vq;
+  double NextVd;                           /* Computed at the last conversion */
+  double NextVq;
+  double SpeedErrorMax;                    /* Once settled, relative */
+} Motor_t;
+
+typedef struct
+{
+  uint64_t HfBusy;
+  uint64_t TickBusy;
+  uint64_t HfLatencyMax;                   /* From the end of the conversion to the start of the interrupt */
+  uint64_t HfResponseMax;                  /* From the end of the conversion to the end of the regulation */
+  uint32_t Lost;
+  uint32_t Late;                           /* Regulations ended after the next update of the timer */
+  bool bStarved;                           /* The SysTick did not complete before the end of the run */
+} Cpu_t;
+
+static Motor_t Motors[MOTORS];
+static Cpu_t Cpu;
+static uint64_t Now;                       /* Core cycles */
+static uint64_t End;
+static uint64_t NextConversion[MOTORS];
+static uint64_t HfCycles;
+static uint64_t MfCycles;
+static uint64_t SafetyCycles;
+static uint64_t TickEntryCycles;
+
+uint32_t SystemCoreClock = CORE_CLOCK_HZ;
+
+static void TaskMFM1(void);
+static void TaskMFM2(void);
+static void TaskSafety(void);
+
+/* Task table of mc_tasks.c with two motors, the MCP task left out */
+static const SCHED_Task_t Tasks[TASK_NBR] =
+{
+  [TASK_MF_M1] =
+  {
+    .pFct        = &TaskMFM1,
+    .hPeriod     = (uint16_t)(SYS_TICK_FREQUENCY / MEDIUM_FREQUENCY_TASK_RATE),
+    .hPhase      = 0U,
+    .hDeadlineUs = (uint16_t)(1000000U / SYS_TICK_FREQUENCY),
+    .bPriority   = 0U,
+    .Context     = SCHED_TICK,
+  },
+  [TASK_SAFETY] =
+  {
+    .pFct        = &TaskSafety,
+    .hPeriod     = 1U,
+    .hPhase      = 0U,
+    .hDeadlineUs = (uint16_t)(1000000U / SYS_TICK_FREQUENCY),
+    .bPriority   = 1U,
+    .Context     = SCHED_TICK,
+  },
+  [TASK_MF_M2] =
+  {
+    .pFct        = &TaskMFM2,
+    .hPeriod     = (uint16_t)(SYS_TICK_FREQUENCY / MEDIUM_FREQUENCY_TASK_RATE),
+    .hPhase      = (uint16_t)(SYS_TICK_FREQUENCY / MEDIUM_FREQUENCY_TASK_RATE) / 2U,
+    .hDeadlineUs = (uint16_t)(1000000U / SYS_TICK_FREQUENCY),
+    .bPriority   = 0U,
+    .Context     = SCHED_TICK,
+  },
+};
+
+static SCHED_TaskState_t TaskStates[TASK_NBR];
+
+static SCHED_Handle_t Scheduler =
+{
+  .pTasks   = Tasks,
+  .pStates  = TaskStates,
+  .bTaskNbr = TASK_NBR,
+};
+
+static void InitMotor(Motor_t *pMotor, double SpeedRpm, double LoadNm)
+{
+  const PID_Handle_t PIDIq =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDSpeed =
+  {
+    .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)IQMAX * (int32_t)SP_KIDIV,
+    .wLowerIntegralLimit = -(int32_t)IQMAX * (int32_t)SP_KIDIV,
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)SP_KPDIV,
+    .hKiDivisor          = (uint16_t)SP_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  };
+
+  memset(pMotor, 0, sizeof(Motor_t));
+  pMotor->SpeedRpm = SpeedRpm;
+  pMotor->LoadNm = LoadNm;
+  pMotor->PIDIq = PIDIq;
+  pMotor->PIDId = PIDIq;
+  pMotor->PIDId.hDefKpGain = (int16_t)PID_FLUX_KP_DEFAULT;
+  pMotor->PIDId.hDefKiGain = (int16_t)PID_FLUX_KI_DEFAULT;
+  pMotor->PIDSpeed = PIDSpeed;
+  PID_HandleInit(&pMotor->PIDIq);
+  PID_HandleInit(&pMotor->PIDId);
+  PID_HandleInit(&pMotor->PIDSpeed);
+}
+
+/* Windings and rotor over a PWM period, under the voltage applied */
+static void Integrate(Motor_t *pMotor)
+{
+  const double Dt = 1.0 / ((double)TF_REGULATION_RATE * SUB_STEPS);
+  int s;
+
+  for (s = 0; s < SUB_STEPS; s++)
+  {
+    double W = pMotor->Omega * POLE_PAIR_NUM;
+    double dId = (pMotor->Vd - (RS * pMotor->Id) + (W * LS * pMotor->Iq)) / LS;
+    double dIq = (pMotor->Vq - (RS * pMotor->Iq) - (W * LS * pMotor->Id) - (W * HSO_FLUX_WB)) / LS;
+    double Torque = 1.5 * POLE_PAIR_NUM * HSO_FLUX_WB * pMotor->Iq;
+    double Load = (MOTOR_FRICTION_NMS * pMotor->Omega) + ((pMotor->Omega >= 0.0) ? pMotor->LoadNm : -pMotor->LoadNm);
+
+    pMotor->Id += dId * Dt;
+    pMotor->Iq += dIq * Dt;
+    pMotor->Omega += ((Torque - Load) / MOTOR_INERTIA_KGM2) * Dt;
+  }
+}
+
+/* Current regulation of a motor, ADC interrupt */
+static void CurrentRegulation(Motor_t *pMotor)
+{
+  int16_t hIq = (int16_t)lround(pMotor->Iq * CURRENT_CONV_FACTOR);
+  int16_t hId = (int16_t)lround(pMotor->Id * CURRENT_CONV_FACTOR);
+  double Vq = PI_Controller(&pMotor->PIDIq, pMotor->wIqref - hIq);
+  double Vd = PI_Controller(&pMotor->PIDId, -(int32_t)hId);
+  double Module = sqrt((Vq * Vq) + (Vd * Vd));
+
+  Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+  pMotor->NextVq = (Vq * Module) / DBC_DIGIT_PER_VOLT;
+  pMotor->NextVd = (Vd * Module) / DBC_DIGIT_PER_VOLT;
+}
+
+/* Speed regulation of a motor, Medium Frequency task */
+static void SpeedRegulation(Motor_t *pMotor)
+{
+  double SpeedUnit = (pMotor->Omega * (double)SPEED_UNIT) / TWO_PI;
+  double Reference = (pMotor->SpeedRpm * (double)SPEED_UNIT) / (double)U_RPM;
+
+  pMotor->wIqref = PI_Controller(&pMotor->PIDSpeed, (int32_t)lround(Reference - SpeedUnit));
+  if (((double)Now / CORE_CLOCK_HZ) >= SETTLED_S)
+  {
+    double Error = fabs(((pMotor->Omega * 60.0) / TWO_PI) - pMotor->SpeedRpm) / fabs(pMotor->SpeedRpm);
+
+    pMotor->SpeedErrorMax = fmax(pMotor->SpeedErrorMax, Error);
+  }
+}
+
+/* Earliest end of conversion not yet served */
+static int NextMotor(void)
+{
+  return ((NextConversion[1] < NextConversion[0]) ? 1 : 0);
+}
+
+/* Runs the ADC interrupt of the oldest conversion, at once or after the one running */
+static void RunHighFrequency(void)
+{
+  int m = NextMotor();
+  uint64_t Conversion = NextConversion[m];
+  uint64_t Start = (Now > Conversion) ? Now : Conversion;
+  Motor_t *pMotor = &Motors[m];
+
+  /* The flag of the other motor set meanwhile is still pending: served next. A second end of
+     conversion before the interrupt starts would be merged with the pending one */
+  while ((NextConversion[m] + PWM_CYCLES) <= Start)
+  {
+    Cpu.Lost++;
+    Integrate(pMotor);
+    NextConversion[m] += PWM_CYCLES;
+  }
+  Conversion = NextConversion[m];
+
+  Cpu.HfLatencyMax = (Start - Conversion > Cpu.HfLatencyMax) ? (Start - Conversion) : Cpu.HfLatencyMax;
+  Integrate(pMotor);
+  pMotor->Vd = pMotor->NextVd;
+  pMotor->Vq = pMotor->NextVq;
+  CurrentRegulation(pMotor);
+
+  Now = Start + HfCycles;
+  Cpu.HfBusy += HfCycles;
+  Cpu.HfResponseMax = (Now - Conversion > Cpu.HfResponseMax) ? (Now - Conversion) : Cpu.HfResponseMax;
+  /* The duties are loaded by the next update, half a period after the conversion */
+  Cpu.Late += ((Now - Conversion) > (PWM_CYCLES - CONVERSION_DELAY)) ? 1U : 0U;
+  NextConversion[m] += PWM_CYCLES;
+}
+
+/* Executes cycles of a SysTick task, preempted by the ADC interrupts */
+static void Execute(uint64_t Cycles)
+{
+  uint64_t Left = Cycles;
+
+  while ((Left > 0U) && (Now < End))
+  {
+    uint64_t Conversion = NextConversion[NextMotor()];
+
+    if ((Now + Left) <= Conversion)
+    {
+      Now += Left;
+      Left = 0U;
+    }
+    else
+    {
+      Left -= (Conversion > Now) ? (Conversion - Now) : 0U;
+      Now = (Conversion > Now) ? Conversion : Now;
+      RunHighFrequency();
+    }
+    HostDWT.CYCCNT = (uint32_t)Now;
+  }
+  Cpu.TickBusy += Cycles - Left;
+  Cpu.bStarved = (Left > 0U) ? true : Cpu.bStarved;
+}
+
+/* Lets the core idle up to a time, serving the ADC interrupts */
+static void IdleUntil(uint64_t Time)
+{
+  while (NextConversion[NextMotor()] < Time)
+  {
+    RunHighFrequency();
+  }
+  Now = (Now > Time) ? Now : Time;
+  HostDWT.CYCCNT = (uint32_t)Now;
+}
+
+static void TaskMFM1(void)
+{
+  Execute(MfCycles);
+  SpeedRegulation(&Motors[0]);
+}
+
+static void TaskMFM2(void)
+{
+  Execute(MfCycles);
+  SpeedRegulation(&Motors[1]);
+}
+
+static void TaskSafety(void)
+{
+  Execute(SafetyCycles);
+}
+
+typedef struct
+{
+  double HfLoad;
+  double TickLoad;
+  double MfResponseUs;
+  uint32_t Overruns;
+  uint32_t Misses;
+} Result_t;
+
+static Result_t Run(double HfUs)
+{
+  uint64_t Tick = TICK_CYCLES;
+  Result_t Result;
+  uint8_t i;
+
+  HfCycles = US_TO_CYCLES(HfUs);
+  MfCycles = US_TO_CYCLES(MF_US);
+  SafetyCycles = US_TO_CYCLES(SAFETY_US);
+  TickEntryCycles = US_TO_CYCLES(TICK_US);
+  memset(&Cpu, 0, sizeof(Cpu));
+  Now = 0U;
+  End = (uint64_t)(RUN_S * CORE_CLOCK_HZ);
+  HostDWT.CYCCNT = 0U;
+  InitMotor(&Motors[0], 3000.0, 0.0);
+  InitMotor(&Motors[1], -4500.0, 0.0005);
+  NextConversion[0] = CONVERSION_DELAY;
+  NextConversion[1] = CONVERSION_DELAY + (PWM_CYCLES / 2U);
+  SCHED_Init(&Scheduler);
+
+  while ((Tick < End) && (Now < End))
+  {
+    IdleUntil(Tick);
+    Execute(TickEntryCycles);
+    SCHED_Tick(&Scheduler);
+    Tick += TICK_CYCLES;
+  }
+
+  Result.HfLoad = (double)Cpu.HfBusy / (double)Now;
+  Result.TickLoad = (double)Cpu.TickBusy / (double)Now;
+  Result.MfResponseUs = 0.0;
+  Result.Overruns = 0U;
+  Result.Misses = 0U;
+  for (i = 0U; i < TASK_NBR; i++)
+  {
+    Result.MfResponseUs = fmax(Result.MfResponseUs, (double)TaskStates[i].wMaxResponseCycles / (CORE_CLOCK_HZ / 1e6));
+    Result.Overruns += TaskStates[i].wOverruns;
+    Result.Misses += TaskStates[i].wDeadlineMisses;
+  }
+  return (Result);
+}
+
+static void Print(double HfUs, const Result_t *pResult)
+{
+  printf("%6.1f us %6.1f %% %6.1f %% %6.1f %% %7.1f us %7.1f us ", HfUs, 100.0 * pResult->HfLoad,
+         100.0 * pResult->TickLoad, 100.0 * (pResult->HfLoad + pResult->TickLoad),
+         (double)Cpu.HfLatencyMax / (CORE_CLOCK_HZ / 1e6), (double)Cpu.HfResponseMax / (CORE_CLOCK_HZ / 1e6));
+  if (true == Cpu.bStarved)
+  {
+    /* The speed regulations stopped */
+    printf("%10s %5u %5u %5s %5s %8s %8s\n", "starved", (unsigned)Cpu.Lost, (unsigned)Cpu.Late, "-", "-", "-", "-");
+  }
+  else
+  {
+    printf("%7.1f us %5u %5u %5u %5u %6.2f %% %6.2f %%\n", pResult->MfResponseUs, (unsigned)Cpu.Lost,
+           (unsigned)Cpu.Late, (unsigned)pResult->Overruns, (unsigned)pResult->Misses,
+           100.0 * Motors[0].SpeedErrorMax, 100.0 * Motors[1].SpeedErrorMax);
+  }
+}
+
+int main(void)
+{
+  static const double Sweep[] = {15.0, 20.0, 25.0, 28.0, 30.0, 32.0, 35.0};
+  Result_t Result;
+  bool bOk;
+  size_t i;
+
+  printf("Two motors on one core at %u MHz, PWM %u Hz half a period apart, SysTick %u Hz\n",
+         (unsigned)(CORE_CLOCK_HZ / 1000000U), (unsigned)TF_REGULATION_RATE, (unsigned)SYS_TICK_FREQUENCY);
+  printf("Medium frequency task %.1f us, safety task %.1f us, SysTick entry %.1f us; "
+         "motor 1 at 3000 rpm, motor 2 at -4500 rpm loaded\n\n", (double)MF_US, (double)SAFETY_US, (double)TICK_US);
+  printf("%9s %8s %8s %8s %10s %10s %10s %5s %5s %5s %5s %8s %8s\n", "current", "ADC", "SysTick", "total",
+         "ADC", "current", "SysTick", "lost", "late", "overr", "dead", "speed", "speed");
+  printf("%9s %8s %8s %8s %10s %10s %10s %5s %5s %5s %5s %8s %8s\n", "control", "load", "load", "load",
+         "latency", "response", "response", "", "", "", "miss", "error 1", "error 2");
+
+  Result = Run(HF_US);
+  Print((double)HF_US, &Result);
+  bOk = (false == Cpu.bStarved) && (0U == Cpu.Lost) && (0U == Cpu.Late) && (0U == Result.Overruns) && (0U == Result.Misses)
+     && (Motors[0].SpeedErrorMax < SPEED_TOLERANCE) && (Motors[1].SpeedErrorMax < SPEED_TOLERANCE);
+
+  printf("\nLonger current regulations:\n");
+  for (i = 0U; i < (sizeof(Sweep) / sizeof(Sweep[0])); i++)
+  {
+    Result = Run(Sweep[i]);
+    Print(Sweep[i], &Result);
+  }
+  printf("\nThe current regulation of a motor must end before the next PWM update, %.1f us after its conversion\n",
+         (double)(PWM_CYCLES - CONVERSION_DELAY) / (CORE_CLOCK_HZ / 1e6));
+  printf("%s with the durations of the build\n", (true == bOk) ? "Both motors tracked" : "FAILED");
+  return ((true == bOk) ? 0 : 1);
+}
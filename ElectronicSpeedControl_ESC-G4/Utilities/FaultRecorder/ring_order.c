@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    ring_order.c
+  * @brief   Host check of the order of the samples written by the Fault
+  *          Recorder, for any number of samples taken before the fault.
+  *
+  * The firmware FLR_Sample samples a counter as Iq, then a fault freezes the
+  * ring and FLR_BackgroundTask linearises it into the record appended to the
+  * flash, captured here. The record must hold the newest samples, the oldest
+  * first, including when the ring wrapped with its write position back to 0.
+  * The handle is followed by a guard filled with a pattern, the linearisation
+  * must not write past the ring.
+  *
+  * The program returns 1 when a record is out of order or the guard changed.
+  *
+  * Usage: ring_order
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "fault_recorder.h"
+
+#define GUARD_SIZE              4096U
+#define GUARD_PATTERN           0xA5U
+
+typedef struct
+{
+  FLR_Handle_t Handle;
+  uint8_t Guard[GUARD_SIZE];
+} Recorder_t;
+
+static Recorder_t Recorder;
+static FOCVars_t FOCVars;
+static MCI_Handle_t MCI;
+static PWMC_Handle_t PWMC;
+static SpeednTorqCtrl_Handle_t STC;
+static FLR_Record_t Appended;
+static int AppendNbr;
+
+/* Firmware dependencies of the recorder */
+void FREC_Init(FREC_Handle_t *pHandle)
+{
+  pHandle->wSequence = 0U;
+}
+
+bool FREC_Append(FREC_Handle_t *pHandle, const void *pPayload, uint16_t hSize)
+{
+  memcpy(&Appended, pPayload, hSize);
+  pHandle->wSequence++;
+  AppendNbr++;
+  return (true);
+}
+
+bool FREC_Read(FREC_Handle_t *pHandle, uint32_t wAge, uint16_t hOffset, void *pData, uint16_t hSize)
+{
+  return (false);
+}
+
+bool FREC_Erase(FREC_Handle_t *pHandle)
+{
+  return (true);
+}
+
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+int16_t NTC_GetAvTemp_C(NTC_Handle_t *pHandle)
+{
+  return (25);
+}
+
+uint16_t VBS_GetBusVoltage_d(const BusVoltageSensor_Handle_t *pHandle)
+{
+  return (0U);
+}
+
+int16_t SPD_GetAvrgMecSpeedUnit(const SpeednPosFdbk_Handle_t *pHandle)
+{
+  return (0);
+}
+
+/* Takes hSamples samples numbered from 1, freezes the ring on a fault and writes the record */
+static bool RecordFault(uint16_t hSamples)
+{
+  FLR_Handle_t *pHandle = &Recorder.Handle;
+  uint16_t hExpected = (hSamples < FLR_SAMPLE_NBR) ? hSamples : (uint16_t)FLR_SAMPLE_NBR;
+  bool bOk = true;
+  uint16_t i;
+
+  memset(&Recorder, 0, sizeof(Recorder));
+  memset(Recorder.Guard, GUARD_PATTERN, GUARD_SIZE);
+  pHandle->pFOCVars = &FOCVars;
+  pHandle->pMCI = &MCI;
+  pHandle->pPWMC = &PWMC;
+  pHandle->pSTC = &STC;
+  pHandle->hDecimation = 1U;
+  FLR_Init(pHandle);
+  AppendNbr = 0;
+
+  MCI.CurrentFaults = MC_NO_FAULTS;
+  MCI.State = RUN;
+  for (i = 1U; i <= hSamples; i++)
+  {
+    FOCVars.Iqd.q = (int16_t)i;
+    FLR_Sample(pHandle, i);
+  }
+  MCI.CurrentFaults = MC_OVER_VOLT;
+  FLR_Sample(pHandle, hSamples + 1U);
+  MCI.State = FAULT_NOW;
+  FLR_BackgroundTask(pHandle);
+
+  bOk = (1 == AppendNbr) && (hExpected == Appended.bSampleNbr);
+  for (i = 0U; (true == bOk) && (i < hExpected); i++)
+  {
+    /* Newest sample last */
+    bOk = (Appended.Samples[i].hIq == (int16_t)((hSamples - hExpected) + i + 1U));
+  }
+  for (i = 0U; (true == bOk) && (i < GUARD_SIZE); i++)
+  {
+    bOk = (GUARD_PATTERN == Recorder.Guard[i]);
+  }
+  return (bOk && (&FOCVars == pHandle->pFOCVars) && (&MCI == pHandle->pMCI));
+}
+
+int main(void)
+{
+  static const uint16_t Samples[] = {0U, 5U, 31U, 32U, 33U, 45U, 63U, 64U, 96U, 100U};
+  int Failures = 0;
+  uint32_t i;
+
+  printf("Fault records after a number of samples, ring of %u samples\n\n", (unsigned)FLR_SAMPLE_NBR);
+  printf("%8s %14s  %s\n", "samples", "write position", "record");
+  for (i = 0U; i < (sizeof(Samples) / sizeof(Samples[0])); i++)
+  {
+    bool bOk = RecordFault(Samples[i]);
+
+    Failures += (true == bOk) ? 0 : 1;
+    printf("%8u %14u  %s\n", (unsigned)Samples[i], (unsigned)(Samples[i] % FLR_SAMPLE_NBR),
+           (true == bOk) ? "in order" : "FAILED");
+  }
+  return ((0 == Failures) ? 0 : 1);
+}
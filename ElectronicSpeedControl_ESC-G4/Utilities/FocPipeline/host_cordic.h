@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    host_cordic.h
+  * @brief   CORDIC of the target on the host, included first in each
+  *          compilation unit of the FOC pipeline host test.
+  *
+  * The CORDIC registers are a host structure and a write of the argument
+  * computes the result: the cosine and sine of a q1.15 angle, the function
+  * used by the current loop. The interrupts the MC math masks around the
+  * CORDIC are those of the target only.
+  ******************************************************************************
+  */
+
+#ifndef HOST_CORDIC_H
+#define HOST_CORDIC_H
+
+#include "stm32g4xx.h"
+#include "stm32g4xx_ll_cordic.h"
+
+extern CORDIC_TypeDef HostCORDIC;
+
+/* Writes the argument and computes the result of the configured function */
+void HostCordic_WriteData(CORDIC_TypeDef *CORDICx, uint32_t InData);
+
+#undef CORDIC
+#define CORDIC                                (&HostCORDIC)
+#define LL_CORDIC_WriteData(CORDICx, InData)  HostCordic_WriteData((CORDICx), (InData))
+#define __disable_irq()                       ((void)0)
+#define __enable_irq()                        ((void)0)
+
+#endif /* HOST_CORDIC_H */
@@ -0,0 +1,268 @@
+/**
+  ******************************************************************************
+  * @file    pipeline_vs_c.c
+  * @brief   Host test of the inline stages of the current loop against the
+  *          MC math transforms and the PI regulator, and benchmark of both.
+  *
+  * FOCP_Clarke, FOCP_Park, FOCP_RevPark and FOCP_PI of foc_pipeline.h must
+  * give the results of MCM_Clarke, MCM_Park, MCM_Rev_Park and PI_Controller
+  * on random inputs over the full q1.15 range, the Park transforms taking
+  * the sine and cosine of one FOCP_CosSin evaluation of the angle, and the
+  * regulators updating the same integral term, with random gains, divisors
+  * and limits and the integral gain cleared from time to time. The Makefile
+  * builds the test with the shifts and with the FULL_MISRA divisions of the
+  * library.
+  *
+  * The current loop of FOC_CurrControllerM1, with the C functions and with
+  * the inline stages, is then timed on BENCH_INPUTS periods. The CORDIC is a
+  * table on the host, so that the timings only hint at the gain on the
+  * Cortex-M4. The program returns 1 when a stage differs from its function.
+  *
+  * Usage: pipeline_vs_c
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "mc_type.h"
+#include "mc_math.h"
+#include "pid_regulator.h"
+#include "foc_pipeline.h"
+
+/* Random inputs of each stage */
+#define CHECK_INPUTS            1000000U
+/* Periods of the benchmark, repeated BENCH_REPEAT times */
+#define BENCH_INPUTS            4096U
+#define BENCH_REPEAT            1000U
+/* One regulator in CLEAR_KI_RATIO with its integral gain cleared */
+#define CLEAR_KI_RATIO          8U
+
+CORDIC_TypeDef HostCORDIC;
+
+static double CosTable[65536];
+static double SinTable[65536];
+
+/* CORDIC cosine in q1.15: the angle in the low half word, the modulus in the high one */
+void HostCordic_WriteData(CORDIC_TypeDef *CORDICx, uint32_t InData)
+{
+  CORDICx->WDATA = InData;
+  if (LL_CORDIC_FUNCTION_COSINE == (CORDICx->CSR & CORDIC_CSR_FUNC))
+  {
+    double Modulus = (double)(InData >> 16);
+    uint16_t hAngle = (uint16_t)InData;
+    long Cos = lrint(Modulus * CosTable[hAngle]);
+    long Sin = lrint(Modulus * SinTable[hAngle]);
+
+    Cos = (Cos > INT16_MAX) ? INT16_MAX : Cos;
+    Sin = (Sin > INT16_MAX) ? INT16_MAX : Sin;
+    CORDICx->RDATA = ((uint32_t)(uint16_t)Sin << 16) | (uint32_t)(uint16_t)Cos;
+  }
+  else
+  {
+    /* Functions not used by the current loop */
+    CORDICx->RDATA = 0U;
+  }
+}
+
+static uint32_t Seed = 1U;
+
+static uint16_t Random16(void)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return ((uint16_t)(Seed >> 16));
+}
+
+static int16_t RandomS16(void)
+{
+  return ((int16_t)Random16());
+}
+
+/* Random gains, divisors and limits, the integral limits as set by the firmware */
+static void RandomRegulator(PID_Handle_t *pHandle)
+{
+  uint16_t hKpPow2 = Random16() % 16U;
+  uint16_t hKiPow2 = Random16() % 16U;
+  int16_t hLimit = (int16_t)(Random16() & 0x7FFFU);
+
+  pHandle->hKpGain = (int16_t)(Random16() & 0x7FFFU);
+  pHandle->hKiGain = (int16_t)(Random16() & 0x7FFFU);
+  pHandle->hKpDivisorPOW2 = hKpPow2;
+  pHandle->hKiDivisorPOW2 = hKiPow2;
+  pHandle->hKpDivisor = (uint16_t)(1U << hKpPow2);
+  pHandle->hKiDivisor = (uint16_t)(1U << hKiPow2);
+  pHandle->hUpperOutputLimit = hLimit;
+  pHandle->hLowerOutputLimit = -hLimit;
+  pHandle->wUpperIntegralLimit = (int32_t)hLimit * (int32_t)pHandle->hKiDivisor;
+  pHandle->wLowerIntegralLimit = -pHandle->wUpperIntegralLimit;
+  pHandle->wIntegralTerm = 0;
+}
+
+/* Inputs of a period of the benchmark */
+typedef struct
+{
+  ab_t Iab;
+  int16_t hElAngle;
+  qd_t Iqdref;
+} BenchInput_t;
+
+static BenchInput_t BenchInputs[BENCH_INPUTS];
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static volatile int32_t Sink;
+
+/* FOC_CurrControllerM1 with FOC_PIPELINE_ENABLE at 0 */
+__attribute__((noinline)) static alphabeta_t CurrentLoopC(const BenchInput_t *pInput)
+{
+  alphabeta_t Ialphabeta = MCM_Clarke(pInput->Iab);
+  qd_t Iqd = MCM_Park(Ialphabeta, pInput->hElAngle);
+  qd_t Vqd;
+
+  Vqd.q = PI_Controller(&PIDIq, (int32_t)pInput->Iqdref.q - Iqd.q);
+  Vqd.d = PI_Controller(&PIDId, (int32_t)pInput->Iqdref.d - Iqd.d);
+  return (MCM_Rev_Park(Vqd, pInput->hElAngle));
+}
+
+/* FOC_CurrControllerM1 with FOC_PIPELINE_ENABLE at 1 */
+__attribute__((noinline)) static alphabeta_t CurrentLoopInline(const BenchInput_t *pInput)
+{
+  Trig_Components CosSin = FOCP_CosSin(pInput->hElAngle);
+  alphabeta_t Ialphabeta = FOCP_Clarke(pInput->Iab);
+  qd_t Iqd = FOCP_Park(Ialphabeta, CosSin);
+  qd_t Vqd;
+
+  Vqd.q = FOCP_PI(&PIDIq, (int32_t)pInput->Iqdref.q - Iqd.q);
+  Vqd.d = FOCP_PI(&PIDId, (int32_t)pInput->Iqdref.d - Iqd.d);
+  return (FOCP_RevPark(Vqd, CosSin));
+}
+
+/* Time of a period of the current loop, ns */
+static double Bench(alphabeta_t (*pLoop)(const BenchInput_t *pInput))
+{
+  struct timespec Start;
+  struct timespec End;
+  uint32_t i;
+  uint32_t k;
+
+  PIDIq.wIntegralTerm = 0;
+  PIDId.wIntegralTerm = 0;
+  clock_gettime(CLOCK_MONOTONIC, &Start);
+  for (k = 0U; k < BENCH_REPEAT; k++)
+  {
+    for (i = 0U; i < BENCH_INPUTS; i++)
+    {
+      alphabeta_t Valphabeta = pLoop(&BenchInputs[i]);
+
+      Sink += Valphabeta.alpha + Valphabeta.beta;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &End);
+  return ((((double)(End.tv_sec - Start.tv_sec) * 1.0e9) + (double)(End.tv_nsec - Start.tv_nsec))
+          / ((double)BENCH_INPUTS * (double)BENCH_REPEAT));
+}
+
+static int Failures;
+
+static void Check(const char *pName, uint32_t Mismatches)
+{
+  printf("%-64s %8u %s\n", pName, Mismatches, (0U == Mismatches) ? "ok" : "FAILED");
+  Failures += (0U == Mismatches) ? 0 : 1;
+}
+
+int main(void)
+{
+  uint32_t ClarkeErrors = 0U;
+  uint32_t ParkErrors = 0U;
+  uint32_t RevParkErrors = 0U;
+  uint32_t PIErrors = 0U;
+  PID_Handle_t PIDC;
+  PID_Handle_t PIDInline;
+  double CNs;
+  double InlineNs;
+  uint32_t i;
+
+  for (i = 0U; i < 65536U; i++)
+  {
+    double Theta = M_PI * (double)(int16_t)(uint16_t)i / 32768.0;
+
+    CosTable[i] = cos(Theta);
+    SinTable[i] = sin(Theta);
+  }
+
+#ifdef FULL_MISRA_C_COMPLIANCY_MC_MATH
+  printf("FULL_MISRA build, %u random inputs per stage\n\n", CHECK_INPUTS);
+#else
+  printf("Shift build, %u random inputs per stage\n\n", CHECK_INPUTS);
+#endif
+
+  RandomRegulator(&PIDC);
+  PIDInline = PIDC;
+  for (i = 0U; i < CHECK_INPUTS; i++)
+  {
+    ab_t Iab = {RandomS16(), RandomS16()};
+    alphabeta_t Ialphabeta = {RandomS16(), RandomS16()};
+    qd_t Vqd = {RandomS16(), RandomS16()};
+    int16_t hAngle = RandomS16();
+    Trig_Components CosSin = FOCP_CosSin(hAngle);
+    alphabeta_t ClarkeC = MCM_Clarke(Iab);
+    alphabeta_t ClarkeInline = FOCP_Clarke(Iab);
+    qd_t ParkC = MCM_Park(Ialphabeta, hAngle);
+    qd_t ParkInline = FOCP_Park(Ialphabeta, CosSin);
+    alphabeta_t RevParkC = MCM_Rev_Park(Vqd, hAngle);
+    alphabeta_t RevParkInline = FOCP_RevPark(Vqd, CosSin);
+    int32_t wError = (int32_t)RandomS16() - (int32_t)RandomS16();
+    int16_t hOutputC;
+    int16_t hOutputInline;
+
+    ClarkeErrors += ((ClarkeC.alpha != ClarkeInline.alpha) || (ClarkeC.beta != ClarkeInline.beta)) ? 1U : 0U;
+    ParkErrors += ((ParkC.q != ParkInline.q) || (ParkC.d != ParkInline.d)) ? 1U : 0U;
+    RevParkErrors += ((RevParkC.alpha != RevParkInline.alpha) || (RevParkC.beta != RevParkInline.beta)) ? 1U : 0U;
+
+    /* New gains every 1000 periods, the integral gain cleared in one regulator in CLEAR_KI_RATIO */
+    if (0U == (i % 1000U))
+    {
+      RandomRegulator(&PIDC);
+      PIDC.hKiGain = (0U == (Random16() % CLEAR_KI_RATIO)) ? 0 : PIDC.hKiGain;
+      PIDInline = PIDC;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    hOutputC = PI_Controller(&PIDC, wError);
+    hOutputInline = FOCP_PI(&PIDInline, wError);
+    if ((hOutputC != hOutputInline) || (PIDC.wIntegralTerm != PIDInline.wIntegralTerm))
+    {
+      PIErrors++;
+      PIDInline = PIDC;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  Check("FOCP_Clarke against MCM_Clarke, mismatches", ClarkeErrors);
+  Check("FOCP_Park on FOCP_CosSin against MCM_Park, mismatches", ParkErrors);
+  Check("FOCP_RevPark on FOCP_CosSin against MCM_Rev_Park, mismatches", RevParkErrors);
+  Check("FOCP_PI against PI_Controller, output and integral, mismatches", PIErrors);
+
+  /* Currents of a loaded motor, references close to them */
+  RandomRegulator(&PIDIq);
+  PIDIq.hKiGain = (int16_t)(PIDIq.hKiGain | 1);
+  PIDId = PIDIq;
+  for (i = 0U; i < BENCH_INPUTS; i++)
+  {
+    BenchInputs[i].Iab.a = (int16_t)(RandomS16() / 4);
+    BenchInputs[i].Iab.b = (int16_t)(RandomS16() / 4);
+    BenchInputs[i].hElAngle = RandomS16();
+    BenchInputs[i].Iqdref.q = (int16_t)(RandomS16() / 4);
+    BenchInputs[i].Iqdref.d = (int16_t)(RandomS16() / 16);
+  }
+  CNs = Bench(&CurrentLoopC);
+  InlineNs = Bench(&CurrentLoopInline);
+  printf("\nCurrent loop, host CORDIC table: C functions %.1f ns, inline stages %.1f ns per period (%.0f %%)\n",
+         CNs, InlineNs, 100.0 * InlineNs / CNs);
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,365 @@
+/**
+  ******************************************************************************
+  * @file    hfi_salient.c
+  * @brief   Host test of the High Frequency Injection speed and position
+  *          sensor: angle error on a salient motor from standstill to the
+  *          crossover to the State Observer.
+  *
+  * The firmware HFI component and the current PI regulators run as
+  * FOC_CurrControllerM1 runs them on the HFI sensor, with the parameters of
+  * mc_config.c, and drive a model of the windings of Motor 1:
+  *
+  * - d and q inductances LD_H and LQ_H, resistance RS and the flux of the
+  *   motor voltage constant, integrated in the rotor frame within each
+  *   period at the speed of the case, the bus at its nominal voltage;
+  * - currents sampled in the middle of the PWM period, read by 12 bits
+  *   converters with a gaussian noise of NOISE_LSB, and the voltage set at
+  *   a sample applied from the next update event, half a period later;
+  * - the State Observer replaced by an ideal sensor, so that the blend above
+  *   HFI_CROSSOVER_LOW_RPM is tested on its own.
+  *
+  * Each case seeds the sensor with an angle error, as the initial position
+  * detection would, ramps the rotor to its speed in RAMP_S and holds it for
+  * HOLD_S under a load current. The mean and the largest angle error over
+  * the hold must stay within MEAN_DEG and MAX_DEG. The program returns 1
+  * when a case does not behave as expected.
+  *
+  * Usage: hfi_salient
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mc_type.h"
+#include "hfi_speed_pos_fdbk.h"
+
+/* Inductances of the salient motor, H */
+#define LD_H                    16e-6
+#define LQ_H                    24e-6
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#define NOISE_LSB               2.0
+/* Speed ramp from standstill and hold at the speed of the case, s */
+#define RAMP_S                  0.2
+#define HOLD_S                  0.3
+/* Largest mean and peak angle error over the hold, electrical degrees */
+#define MEAN_DEG                5.0
+#define MAX_DEG                 10.0
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define VOLT_PER_S16            (NOMINAL_BUS_VOLTAGE_V / (SQRT3 * 32768.0))
+#define DEG_PER_S16             (360.0 / 65536.0)
+
+typedef struct
+{
+  double SpeedRpm;                         /* Mechanical */
+  double LoadA;                            /* Iq reference */
+  double SeedErrorDeg;                     /* Of the seeded angle, electrical */
+} Case_t;
+
+typedef struct
+{
+  double Id;                               /* Currents in the rotor frame, A */
+  double Iq;
+  double ValphaV;                          /* Voltage applied, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad */
+  double W;                                /* Electrical speed, rad/s */
+  uint32_t Noise;
+} Plant_t;
+
+static Plant_t Plant;
+static SpeednPosFdbk_Handle_t HighSpeedSensor;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+
+/* mc_config.c */
+static HFI_Handle_t HFI =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .SpeedUnit                 = SPEED_UNIT,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = 0U,
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .pHighSpeedSensor            = &HighSpeedSensor,
+
+  .PIRegulator =
+  {
+    .hDefKpGain                = HFI_PLL_KP_GAIN,
+    .hDefKiGain                = HFI_PLL_KI_GAIN,
+    .hDefKdGain                = 0x0000U,
+    .hKpDivisor                = HFI_PLL_KPDIV,
+    .hKiDivisor                = HFI_PLL_KIDIV,
+    .hKdDivisor                = 0x0000U,
+    .wUpperIntegralLimit       = INT32_MAX,
+    .wLowerIntegralLimit       = -INT32_MAX,
+    .hUpperOutputLimit         = INT16_MAX,
+    .hLowerOutputLimit         = -INT16_MAX,
+    .hKpDivisorPOW2            = HFI_PLL_KPDIV_LOG,
+    .hKiDivisorPOW2            = HFI_PLL_KIDIV_LOG,
+    .hKdDivisorPOW2            = 0x0000U,
+  },
+
+  .hInjVoltage                 = HFI_INJECTION_VOLTAGE,
+  .bInjHalfPeriod              = HFI_INJECTION_HALF_PERIOD,
+  .hCrossoverLowUnit           = HFI_CROSSOVER_LOW_UNIT,
+  .hCrossoverHighUnit          = HFI_CROSSOVER_HIGH_UNIT,
+};
+
+static void InitRegulators(void)
+{
+  const PID_Handle_t PIDIqInit =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIdInit =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+
+  PIDIq = PIDIqInit;
+  PIDId = PIDIdInit;
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+}
+
+/* Power stage ---------------------------------------------------------------*/
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+/* Phase currents, in the frame of MCM_Clarke and MCM_Park: the d axis at (sin, cos) of the angle */
+static ab_t ReadPhaseCurrents(void)
+{
+  double Ialpha = (Plant.Id * sin(Plant.Theta)) + (Plant.Iq * cos(Plant.Theta));
+  double Ibeta = (Plant.Id * cos(Plant.Theta)) - (Plant.Iq * sin(Plant.Theta));
+  ab_t Iab;
+
+  Iab.a = ReadCurrent(Ialpha);
+  Iab.b = ReadCurrent((-0.5 * Ialpha) - ((SQRT3 / 2.0) * Ibeta));
+  return (Iab);
+}
+
+/* Integrates the windings from a sample to the next one */
+static void IntegratePeriod(void)
+{
+  const double Dt = 1.0 / ((double)ISR_FREQUENCY_HZ * (double)SUB_STEPS);
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    double Vd;
+    double Vq;
+
+    if ((SUB_STEPS / 2) == Sub)
+    {
+      /* Update event: the voltage set at the sample is loaded */
+      Plant.ValphaV = Plant.NextValphaV;
+      Plant.VbetaV = Plant.NextVbetaV;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Vd = (Plant.ValphaV * sin(Plant.Theta)) + (Plant.VbetaV * cos(Plant.Theta));
+    Vq = (Plant.ValphaV * cos(Plant.Theta)) - (Plant.VbetaV * sin(Plant.Theta));
+    Plant.Id += ((Vd - (RS * Plant.Id) + (Plant.W * LQ_H * Plant.Iq)) * Dt) / LD_H;
+    Plant.Iq += ((Vq - (RS * Plant.Iq) - (Plant.W * LD_H * Plant.Id) - (Plant.W * HSO_FLUX_WB)) * Dt) / LQ_H;
+    Plant.Theta += Plant.W * Dt;
+  }
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* FOC_CurrControllerM1 on the HFI sensor, with the Iq reference of the load */
+static void RunHF(int32_t wIqref)
+{
+  ab_t Iab = ReadPhaseCurrents();
+  double Angle = ((double)HFI._Super.hElAngle * TWO_PI) / 65536.0;
+  /* MCM_Clarke */
+  double Ialpha = (double)Iab.a;
+  double Ibeta = -((double)Iab.a + (2.0 * (double)Iab.b)) / SQRT3;
+  qd_t Iqd;
+  qd_t Vqd;
+  double Module;
+  int32_t wVd;
+
+  /* MCM_Park */
+  Iqd.q = (int16_t)lround((Ialpha * cos(Angle)) - (Ibeta * sin(Angle)));
+  Iqd.d = (int16_t)lround((Ialpha * sin(Angle)) + (Ibeta * cos(Angle)));
+
+  Iqd = HFI_Demodulate(&HFI, Iqd);
+  Vqd.q = PI_Controller(&PIDIq, wIqref - Iqd.q);
+  Vqd.d = PI_Controller(&PIDId, -Iqd.d);
+  wVd = (int32_t)Vqd.d + HFI_CalcInjection(&HFI);
+  Vqd.d = (int16_t)((wVd > INT16_MAX) ? INT16_MAX : ((wVd < -INT16_MAX) ? -INT16_MAX : wVd));
+
+  /* Circle_Limitation */
+  Module = hypot((double)Vqd.q, (double)Vqd.d);
+  Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+
+  /* MCM_Rev_Park, at the angle advanced to the middle of the application of the voltage, then
+     PWMC_SetPhaseVoltage */
+  Angle += ((double)HFI._Super.InstantaneousElSpeedDpp * TWO_PI) / 65536.0;
+  Plant.NextValphaV = ((((double)Vqd.q * cos(Angle)) + ((double)Vqd.d * sin(Angle))) * Module) * VOLT_PER_S16;
+  Plant.NextVbetaV = ((((double)Vqd.d * cos(Angle)) - ((double)Vqd.q * sin(Angle))) * Module) * VOLT_PER_S16;
+}
+
+/* Ideal State Observer, run after the current regulation as STO_PLL_CalcElAngle */
+static void RunHighSpeedSensor(void)
+{
+  HighSpeedSensor.hElAngle = (int16_t)(int32_t)lround(fmod(Plant.Theta, TWO_PI) * (65536.0 / TWO_PI));
+  HighSpeedSensor.hElSpeedDpp = (int16_t)lround((Plant.W * 65536.0) / (TWO_PI * (double)TF_REGULATION_RATE));
+}
+
+/* Angle error of the sensor, electrical degrees in [-180, 180[ */
+static double AngleErrorDeg(void)
+{
+  double Deg = ((double)HFI._Super.hElAngle * DEG_PER_S16) - ((Plant.Theta * 360.0) / TWO_PI);
+
+  return (fmod(fmod(Deg + 180.0, 360.0) + 360.0, 360.0) - 180.0);
+}
+
+/* Mean and largest angle error of a case over the hold, false if the sensor reported a fault */
+static bool Run(const Case_t *pCase, double *pMeanDeg, double *pMaxDeg)
+{
+  const int RampPeriods = (int)(RAMP_S * TF_REGULATION_RATE);
+  const int Periods = (int)((RAMP_S + HOLD_S) * TF_REGULATION_RATE);
+  const int32_t wIqref = (int32_t)lround(pCase->LoadA * CURRENT_CONV_FACTOR);
+  const double W = (pCase->SpeedRpm * TWO_PI * POLE_PAIR_NUM) / 60.0;
+  const int16_t hSeed = (int16_t)lround(pCase->SeedErrorDeg / DEG_PER_S16);
+  double SumDeg = 0.0;
+  bool bReliable = true;
+  int Period;
+
+  Plant = (Plant_t){0};
+  Plant.Noise = 1U + (uint32_t)pCase->SpeedRpm;
+  HighSpeedSensor = (SpeednPosFdbk_Handle_t){0};
+  HighSpeedSensor.bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS;
+  InitRegulators();
+
+  /* ALIGNMENT case of TSK_MediumFrequencyTaskM1 */
+  HFI_Init(&HFI);
+  HFI_SetMecAngle(&HFI, hSeed / (int16_t)HFI._Super.bElToMecRatio);
+
+  *pMaxDeg = 0.0;
+  for (Period = 0; Period < Periods; Period++)
+  {
+    Plant.W = (Period < RampPeriods) ? ((W * Period) / RampPeriods) : W;
+    RunHF(wIqref);
+    RunHighSpeedSensor();
+    if (0 == (Period % (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)))
+    {
+      int16_t hMecSpeedUnit;
+
+      /* TSK_MediumFrequencyTaskM1 */
+      bReliable = bReliable && HFI_CalcAvrgMecSpeedUnit(&HFI, &hMecSpeedUnit);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (Period >= RampPeriods)
+    {
+      double ErrorDeg = AngleErrorDeg();
+
+      SumDeg += ErrorDeg;
+      *pMaxDeg = fmax(*pMaxDeg, fabs(ErrorDeg));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    IntegratePeriod();
+  }
+  *pMeanDeg = SumDeg / (double)(Periods - RampPeriods);
+  return (bReliable);
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {0.0,    0.0,  0.0},
+    {0.0,    0.0,  80.0},
+    {0.0,    0.0, -80.0},
+    {0.0,    5.0,  0.0},
+    {100.0,  5.0,  0.0},
+    {250.0,  5.0,  0.0},
+    {500.0,  0.0,  0.0},
+    {500.0,  5.0,  30.0},
+    {0.5 * (HFI_CROSSOVER_LOW_RPM + HFI_CROSSOVER_HIGH_RPM), 5.0, 0.0},
+    {1.2 * HFI_CROSSOVER_HIGH_RPM, 5.0, 0.0},
+  };
+  int Failures = 0;
+  size_t i;
+
+  printf("HFI, Ld %.0f uH, Lq %.0f uH, %.1f V square wave at %d Hz, crossover %d to %d rpm\n\n", LD_H * 1e6,
+         LQ_H * 1e6, HFI_INJECTION_VOLTAGE_V, ISR_FREQUENCY_HZ / (2 * HFI_INJECTION_HALF_PERIOD),
+         HFI_CROSSOVER_LOW_RPM, HFI_CROSSOVER_HIGH_RPM);
+  printf("%8s %8s %8s  %10s %10s\n", "rpm", "load A", "seed", "mean error", "max error");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    double MeanDeg;
+    double MaxDeg;
+    bool bReliable = Run(&Cases[i], &MeanDeg, &MaxDeg);
+    bool bPassed = bReliable && (fabs(MeanDeg) < MEAN_DEG) && (MaxDeg < MAX_DEG);
+
+    printf("%8.0f %8.1f %6.0f d  %6.1f deg %6.1f deg  %s\n", Cases[i].SpeedRpm, Cases[i].LoadA,
+           Cases[i].SeedErrorDeg, MeanDeg, MaxDeg, bPassed ? "ok" : (bReliable ? "FAILED" : "FAILED, fault"));
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nLimits over the %.1f s hold after a %.1f s ramp: mean error %.0f deg, max error %.0f deg\n", HOLD_S,
+         RAMP_S, MEAN_DEG, MAX_DEG);
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    step_load.c
+  * @brief   Host benchmark of the Load Torque Observer: speed dip and recovery
+  *          of the speed loop on a step of the load torque.
+  *
+  * The firmware speed regulator, STC_CalcTorqueReference with its PI and the
+  * Load Torque Observer, runs at MEDIUM_FREQUENCY_TASK_RATE on a plant model
+  * stepped at TF_REGULATION_RATE:
+  *
+  * - rotor and propeller of inertia and friction MOTOR_INERTIA_KGM2 and
+  *   MOTOR_FRICTION_NMS, scaled to test errors of the model, loaded by the
+  *   propeller torque, quadratic in the speed, and the load step;
+  * - Iq following its reference with the time constant of the current loop;
+  * - speed measured as the State Observer does it, average of the last
+  *   STO_FIFO_DEPTH_UNIT current control periods.
+  *
+  * Usage: step_load [step_A [speed_rpm]]
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "parameters_conversion.h"
+#include "speed_torq_ctrl.h"
+
+/* Current loop of the drive, first order */
+#define CURRENT_LOOP_TAU_S      2.0e-4
+/* Propeller torque at the maximum speed, A of Iq */
+#define PROPELLER_IQ_A          ((double)NOMINAL_CURRENT_A)
+/* Time of the step and simulated duration, s */
+#define STEP_TIME_S             0.5
+#define END_TIME_S              3.0
+/* Speed error within which the drive is recovered, relative */
+#define RECOVERY_BAND           0.01
+
+#define TWO_PI                  6.283185307179586
+
+typedef struct
+{
+  const char *pName;
+  bool bObserver;
+  double InertiaRatio;                     /* Actual over modelled inertia */
+  double FrictionRatio;
+} Case_t;
+
+typedef struct
+{
+  double DipRpm;
+  double RecoveryMs;                       /* Last exit of the band after the step */
+  double ErrorRpm;                         /* At the end of the run */
+} Result_t;
+
+static Result_t Run(const Case_t *pCase, double StepA, double SpeedRpm)
+{
+  const double Kt = 1.5 * POLE_PAIR_NUM * HSO_FLUX_WB;                 /* N.m/A */
+  const double J = MOTOR_INERTIA_KGM2 * pCase->InertiaRatio;
+  const double B = MOTOR_FRICTION_NMS * pCase->FrictionRatio;
+  const double Wmax = (MAX_APPLICATION_SPEED_RPM * TWO_PI) / 60.0;
+  const double Kprop = (Kt * PROPELLER_IQ_A) / (Wmax * Wmax);
+  const double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  const int Ratio = TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE;
+  const int16_t hSpeedRef = (int16_t)((SpeedRpm * SPEED_UNIT) / U_RPM);
+  const int Steps = (int)(END_TIME_S / Ts);
+  const int StepAt = (int)(STEP_TIME_S / Ts);
+  double SpeedBuffer[STO_FIFO_DEPTH_UNIT];
+  double W = (SpeedRpm * TWO_PI) / 60.0;
+  double Iq;
+  double IqRef;
+  double Min = W;
+  double LastOutside = STEP_TIME_S;
+  qd_t Iqd = {0, 0};
+  Result_t Result;
+  int i;
+
+  PID_Handle_t PISpeed =
+  {
+    .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+    .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)SP_KPDIV,
+    .hKiDivisor          = (uint16_t)SP_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  };
+  LTO_Handle_t LoadObserver =
+  {
+    .pIqd              = &Iqd,
+    .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+    .fAccelPerDigit    = (float_t)LTO_ACCEL_PER_DIGIT,
+    .fDamping          = (float_t)LTO_DAMPING,
+    .fBandwidth_Hz     = (float_t)LTO_BANDWIDTH_HZ,
+    .hLoadMax          = (int16_t)IQMAX,
+    .bFeedForward      = true,
+  };
+  SpeednPosFdbk_Handle_t Sensor = {0};
+  SpeednTorqCtrl_Handle_t STC =
+  {
+    .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+    .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
+    .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .MaxPositiveTorque          = (int16_t)NOMINAL_CURRENT,
+    .MinNegativeTorque          = -(int16_t)NOMINAL_CURRENT,
+    .ModeDefault                = MCM_SPEED_MODE,
+    .MecSpeedRefUnitDefault     = hSpeedRef,
+    .SpeedFilter                = MC_NULL,
+    .LoadObserver               = (true == pCase->bObserver) ? &LoadObserver : MC_NULL,
+  };
+
+  PID_HandleInit(&PISpeed);
+  LTO_Init(&LoadObserver);
+  STC_Init(&STC, &PISpeed, &Sensor);
+
+  /* Steady state at the reference: the propeller torque is held by the feed-forward of the observer,
+     or else by the integral term */
+  IqRef = (Kprop * W * W + B * W) / Kt;
+  Iq = IqRef;
+  Iqd.q = (int16_t)(Iq * CURRENT_CONV_FACTOR);
+  if (false == pCase->bObserver)
+  {
+    PID_SetIntegralTerm(&PISpeed, (int32_t)(Iq * CURRENT_CONV_FACTOR * SP_KIDIV));
+  }
+  for (i = 0; i < STO_FIFO_DEPTH_UNIT; i++)
+  {
+    SpeedBuffer[i] = W;
+  }
+  Sensor.hAvrMecSpeedUnit = hSpeedRef;
+
+  for (i = 0; i < Steps; i++)
+  {
+    double Load = Kprop * W * W + B * W + ((i >= StepAt) ? (Kt * StepA) : 0.0);
+    double Sum = 0.0;
+    double t = i * Ts;
+    int k;
+
+    if (0 == (i % Ratio))
+    {
+      IqRef = (double)STC_CalcTorqueReference(&STC) / CURRENT_CONV_FACTOR;
+    }
+    Iq += (IqRef - Iq) * (Ts / CURRENT_LOOP_TAU_S);
+    W += ((Kt * Iq) - Load) * (Ts / J);
+    Iqd.q = (int16_t)(Iq * CURRENT_CONV_FACTOR);
+
+    SpeedBuffer[i % STO_FIFO_DEPTH_UNIT] = W;
+    for (k = 0; k < STO_FIFO_DEPTH_UNIT; k++)
+    {
+      Sum += SpeedBuffer[k];
+    }
+    Sensor.hAvrMecSpeedUnit = (int16_t)(((Sum / STO_FIFO_DEPTH_UNIT) * 60.0 / TWO_PI) * SPEED_UNIT / U_RPM);
+
+    if (i >= StepAt)
+    {
+      double Rpm = (W * 60.0) / TWO_PI;
+
+      Min = (W < Min) ? W : Min;
+      if (((Rpm - SpeedRpm) > (RECOVERY_BAND * SpeedRpm)) || ((SpeedRpm - Rpm) > (RECOVERY_BAND * SpeedRpm)))
+      {
+        LastOutside = t;
+      }
+    }
+  }
+
+  Result.DipRpm = SpeedRpm - ((Min * 60.0) / TWO_PI);
+  Result.RecoveryMs = (LastOutside - STEP_TIME_S) * 1000.0;
+  Result.ErrorRpm = SpeedRpm - ((W * 60.0) / TWO_PI);
+  return (Result);
+}
+
+int main(int argc, char *argv[])
+{
+  static const Case_t Cases[] =
+  {
+    {"PI only",                  false, 1.0, 1.0},
+    {"PI + observer",            true,  1.0, 1.0},
+    {"PI + observer, J x 0.5",   true,  0.5, 1.0},
+    {"PI + observer, J x 2",     true,  2.0, 1.0},
+    {"PI + observer, B x 5",     true,  1.0, 5.0},
+  };
+  double StepA = (argc > 1) ? atof(argv[1]) : 2.0;
+  double SpeedRpm = (argc > 2) ? atof(argv[2]) : 6000.0;
+  unsigned int i;
+
+  printf("Load step of %.1f A of Iq at %.0f rpm, observer bandwidth %d Hz\n", StepA, SpeedRpm, LTO_BANDWIDTH_HZ);
+  printf("%-26s %10s %14s %12s\n", "", "dip, rpm", "recovery, ms", "error, rpm");
+  for (i = 0U; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    Result_t Result = Run(&Cases[i], StepA, SpeedRpm);
+
+    if (Result.RecoveryMs < (((END_TIME_S - STEP_TIME_S) * 1000.0) - 1.0))
+    {
+      printf("%-26s %10.0f %14.0f %12.1f\n", Cases[i].pName, Result.DipRpm, Result.RecoveryMs, Result.ErrorRpm);
+    }
+    else
+    {
+      printf("%-26s %10.0f %14s %12.1f\n", Cases[i].pName, Result.DipRpm, "not recovered", Result.ErrorRpm);
+    }
+  }
+  return (0);
+}
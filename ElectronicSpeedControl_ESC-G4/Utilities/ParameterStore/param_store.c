@@ -0,0 +1,623 @@
+/**
+  ******************************************************************************
+  * @file    param_store.c
+  * @brief   Host test of the Parameter Store and of its Flash Records on a
+  *          RAM stand-in of the flash, reset included.
+  *
+  * The firmware PST and FREC components run on the two pages of the
+  * parameter store, held in RAM by MCFLASH_xxx as the flash behaves: a page
+  * erase sets its bytes to 0xFF, a double word is programmed once only,
+  * double word aligned, after the page erase. A power cut after a given
+  * number of flash operations leaves the program or the erase it stops half
+  * done, and the following operations undone until the reset. A reset runs
+  * PST_Load, the regulator initializations and PST_Init as MCboot and
+  * FOC_Init run them, on components holding the built-in parameters.
+  *
+  * - Blank flash: the built-in parameters are kept and captured;
+  * - PARAM_STORE_CMD: checked writes, in IDLE only, commit by the background
+  *   task in IDLE, read back after a reset;
+  * - wear: COMMITS commits spread over the two pages, each block read back
+  *   after a reset;
+  * - power cut at each flash operation of a commit, at each position of the
+  *   ring: after the reset, the previous or the new block is loaded, never
+  *   another, and the next commit is read back;
+  * - a record of another layout version or with a wrong CRC is ignored, the
+  *   previous block being loaded;
+  * - the stored offsets are used within PST_OFFSETS_MAX_DRIFT_CELSIUS;
+  * - a motor model out of the range of the observer keeps the built-in one.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: param_store
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "parameters_conversion.h"
+#include "mc_flash.h"
+#include "mcp.h"
+
+/* The firmware masks the interrupts around the copy of the block, run in sequence here */
+#define __disable_irq()         ((void)0)
+#define __enable_irq()          ((void)0)
+#include "mc_param_store.c"
+
+/* Commits of the wear check */
+#define COMMITS                 500U
+/* Largest difference of erase counts between the pages after the wear check */
+#define WEAR_SPREAD             1U
+
+#define STORE_SIZE              (MC_FLASH_PARAMS_PAGES * MC_FLASH_PAGE_SIZE)
+#define NO_POWER_CUT            (-1)
+
+/* RAM stand-in of the flash */
+static uint8_t Flash[STORE_SIZE];
+static uint32_t EraseCount[MC_FLASH_PARAMS_PAGES];
+static int PowerBudget = NO_POWER_CUT;    /* Flash operations before the power cut */
+static bool bPowerCut;
+static int AccessErrors;                  /* Out of the pages, unaligned or programmed twice */
+
+/* Components of Motor 1 used by the store */
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static PID_Handle_t PIDSpeed;
+static SpeednTorqCtrl_Handle_t STC;
+static RevUpCtrl_Handle_t RevUp;
+static SCC_Handle_t SCC;
+static MCI_Handle_t MCI;
+
+static const FREC_Params_t Records =
+{
+  .wBaseAddress = MC_FLASH_PARAMS_ADDRESS,
+  .wPageSize    = MC_FLASH_PAGE_SIZE,
+  .hSlotSize    = PST_SLOT_SIZE,
+  .hVersion     = PST_VERSION,
+  .bPageNbr     = MC_FLASH_PARAMS_PAGES,
+};
+
+static PST_Handle_t Store;
+static int Failures;
+
+/* Uses one flash operation of the power budget, false once the power is cut */
+static bool PowerOn(void)
+{
+  if (0 == PowerBudget)
+  {
+    bPowerCut = true;
+  }
+  else if (PowerBudget > 0)
+  {
+    PowerBudget--;
+  }
+  else
+  {
+    /* Nothing to do, no power cut */
+  }
+  return (false == bPowerCut);
+}
+
+/* Offset of an address in the stand-in, -1 if an area is out of the pages */
+static int32_t FlashOffset(uint32_t wAddress, uint32_t wSize)
+{
+  int32_t Offset = -1;
+
+  if ((wAddress >= MC_FLASH_PARAMS_ADDRESS) && ((wAddress + wSize) <= (MC_FLASH_PARAMS_ADDRESS + STORE_SIZE)))
+  {
+    Offset = (int32_t)(wAddress - MC_FLASH_PARAMS_ADDRESS);
+  }
+  else
+  {
+    AccessErrors++;
+  }
+  return (Offset);
+}
+
+/* Flash driver on the stand-in */
+bool MCFLASH_ErasePage(uint32_t wAddress)
+{
+  int32_t Offset = FlashOffset(wAddress, 1U);
+  bool bErased = false;
+
+  if (Offset >= 0)
+  {
+    uint32_t wPage = (uint32_t)Offset / MC_FLASH_PAGE_SIZE;
+
+    if (true == PowerOn())
+    {
+      (void)memset(&Flash[wPage * MC_FLASH_PAGE_SIZE], 0xFF, MC_FLASH_PAGE_SIZE);
+      EraseCount[wPage]++;
+      bErased = true;
+    }
+    else
+    {
+      /* Erase stopped half way */
+      (void)memset(&Flash[wPage * MC_FLASH_PAGE_SIZE], 0xFF, MC_FLASH_PAGE_SIZE / 2U);
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bErased);
+}
+
+bool MCFLASH_Program(uint32_t wAddress, const void *pData, uint32_t wSize)
+{
+  const uint8_t *pBytes = (const uint8_t *)pData;
+  int32_t Offset = FlashOffset(wAddress, wSize);
+  bool bProgrammed = (Offset >= 0) && (0U == (wAddress % MC_FLASH_PROGRAM_SIZE));
+  uint32_t wDone;
+
+  for (wDone = 0U; (wDone < wSize) && (true == bProgrammed); wDone += MC_FLASH_PROGRAM_SIZE)
+  {
+    uint8_t DoubleWord[MC_FLASH_PROGRAM_SIZE];
+    uint32_t wChunk = ((wSize - wDone) < MC_FLASH_PROGRAM_SIZE) ? (wSize - wDone) : MC_FLASH_PROGRAM_SIZE;
+    uint8_t *pFlash = &Flash[(uint32_t)Offset + wDone];
+    uint32_t i;
+
+    for (i = 0U; i < MC_FLASH_PROGRAM_SIZE; i++)
+    {
+      bProgrammed = bProgrammed && (0xFFU == pFlash[i]);
+    }
+    if (false == bProgrammed)
+    {
+      AccessErrors++;
+    }
+    else if (true == PowerOn())
+    {
+      (void)memset(DoubleWord, 0xFF, sizeof(DoubleWord));
+      (void)memcpy(DoubleWord, &pBytes[wDone], wChunk);
+      (void)memcpy(pFlash, DoubleWord, sizeof(DoubleWord));
+    }
+    else
+    {
+      /* Double word stopped half way */
+      pFlash[0] = pBytes[wDone];
+      bProgrammed = false;
+    }
+  }
+  return (bProgrammed);
+}
+
+void MCFLASH_Read(uint32_t wAddress, void *pData, uint32_t wSize)
+{
+  int32_t Offset = FlashOffset(wAddress, wSize);
+
+  if (Offset >= 0)
+  {
+    (void)memcpy(pData, &Flash[Offset], wSize);
+  }
+  else
+  {
+    (void)memset(pData, 0, wSize);
+  }
+}
+
+bool MCFLASH_IsErased(uint32_t wAddress, uint32_t wSize)
+{
+  int32_t Offset = FlashOffset(wAddress, wSize);
+  bool bErased = (Offset >= 0);
+  uint32_t i;
+
+  for (i = 0U; (i < wSize) && (true == bErased); i++)
+  {
+    bErased = (0xFFU == Flash[(uint32_t)Offset + i]);
+  }
+  return (bErased);
+}
+
+/* Firmware dependencies of the store */
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+void RUC_SetPhaseDurationms(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, uint16_t hDurationms)
+{
+  pHandle->ParamsData[bPhase].hDurationms = hDurationms;
+}
+
+void RUC_SetPhaseFinalMecSpeedUnit(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, int16_t hFinalMecSpeedUnit)
+{
+  pHandle->ParamsData[bPhase].hFinalMecSpeedUnit = hFinalMecSpeedUnit;
+}
+
+void RUC_SetPhaseFinalTorque(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, int16_t hFinalTorque)
+{
+  pHandle->ParamsData[bPhase].hFinalTorque = hFinalTorque;
+}
+
+uint16_t RUC_GetPhaseDurationms(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase)
+{
+  return ((uint16_t)pHandle->ParamsData[bPhase].hDurationms);
+}
+
+int16_t RUC_GetPhaseFinalMecSpeedUnit(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase)
+{
+  return ((int16_t)pHandle->ParamsData[bPhase].hFinalMecSpeedUnit);
+}
+
+int16_t RUC_GetPhaseFinalTorque(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase)
+{
+  return ((int16_t)pHandle->ParamsData[bPhase].hFinalTorque);
+}
+
+/* SCC_SetMotorParams, the observer constants out of range above an L over Ke of the built-in one times 8 */
+bool SCC_SetMotorParams(SCC_Handle_t *pHandle, float fRS, float fLS, float fKe)
+{
+  bool bApplied = (fRS > 0.0f) && (fLS > 0.0f) && (fKe > 0.0f)
+               && ((fLS / fKe) < (8.0f * (float)(LS / MOTOR_VOLTAGE_CONSTANT)));
+
+  if (true == bApplied)
+  {
+    pHandle->fRSApplied = fRS;
+    pHandle->fLSApplied = fLS;
+    pHandle->fKeApplied = fKe;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bApplied);
+}
+
+/* Components holding the built-in parameters, as mc_config.c */
+static void BuiltIn(void)
+{
+  static const PID_Handle_t PIDIqBuiltIn = {.hDefKpGain = (int16_t)PID_TORQUE_KP_DEFAULT,
+                                            .hDefKiGain = (int16_t)PID_TORQUE_KI_DEFAULT,
+                                            .hKpDivisor = (uint16_t)TF_KPDIV, .hKiDivisor = (uint16_t)TF_KIDIV};
+  static const PID_Handle_t PIDIdBuiltIn = {.hDefKpGain = (int16_t)PID_FLUX_KP_DEFAULT,
+                                            .hDefKiGain = (int16_t)PID_FLUX_KI_DEFAULT,
+                                            .hKpDivisor = (uint16_t)TF_KPDIV, .hKiDivisor = (uint16_t)TF_KIDIV};
+  static const PID_Handle_t PIDSpeedBuiltIn = {.hDefKpGain = (int16_t)PID_SPEED_KP_DEFAULT,
+                                               .hDefKiGain = (int16_t)PID_SPEED_KI_DEFAULT,
+                                               .hKpDivisor = (uint16_t)SP_KPDIV, .hKiDivisor = (uint16_t)SP_KIDIV};
+  uint8_t i;
+
+  PIDIq = PIDIqBuiltIn;
+  PIDId = PIDIdBuiltIn;
+  PIDSpeed = PIDSpeedBuiltIn;
+  PIDSpeed.hKpGain = PIDSpeed.hDefKpGain;
+  PIDSpeed.hKiGain = PIDSpeed.hDefKiGain;
+  STC = (SpeednTorqCtrl_Handle_t){0};
+  STC.MaxAppPositiveMecSpeedUnit = (uint16_t)MAX_APPLICATION_SPEED_UNIT;
+  STC.MinAppNegativeMecSpeedUnit = (int16_t)MIN_APPLICATION_SPEED_UNIT;
+  STC.MaxPositiveTorque = (int16_t)NOMINAL_CURRENT;
+  STC.MinNegativeTorque = -(int16_t)NOMINAL_CURRENT;
+  RevUp = (RevUpCtrl_Handle_t){0};
+  for (i = 0U; i < RUC_MAX_PHASE_NUMBER; i++)
+  {
+    RevUp.ParamsData[i].hDurationms = (uint16_t)(PHASE1_DURATION * (i + 1U));
+    RevUp.ParamsData[i].hFinalMecSpeedUnit = (int16_t)(PHASE1_FINAL_SPEED_UNIT + (10 * i));
+    RevUp.ParamsData[i].hFinalTorque = (int16_t)PHASE1_FINAL_CURRENT;
+  }
+  SCC = (SCC_Handle_t){0};
+  MCI = (MCI_Handle_t){0};
+  MCI.State = IDLE;
+}
+
+/* Reset: MCboot and FOC_Init on the built-in components, the flash kept */
+static bool Reset(void)
+{
+  bool bLoaded;
+
+  PowerBudget = NO_POWER_CUT;
+  bPowerCut = false;
+  BuiltIn();
+  SCC.fRSApplied = (float)RS;
+  SCC.fLSApplied = (float)LS;
+  SCC.fKeApplied = (float)MOTOR_VOLTAGE_CONSTANT;
+  Store = (PST_Handle_t){0};
+  Store.Records.pParams = &Records;
+  Store.pPIDIq = &PIDIq;
+  Store.pPIDId = &PIDId;
+  Store.pPIDSpeed = &PIDSpeed;
+  Store.pSTC = &STC;
+  Store.pRevupCtrl = &RevUp;
+  Store.pSCC = &SCC;
+  Store.pMCI = &MCI;
+  Store.hOffsetsMaxDrift = PST_OFFSETS_MAX_DRIFT_CELSIUS;
+
+  bLoaded = PST_Load(&Store);
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+  PST_Init(&Store);
+  PID_HandleInit(&PIDSpeed);
+  return (bLoaded);
+}
+
+/* Block numbered n, different gains, limits, rev-up and model for each n */
+static PST_Data_t Block(uint32_t n)
+{
+  PST_Data_t Data;
+  uint8_t i;
+
+  (void)memset(&Data, 0, sizeof(Data));
+  Data.hIqKp = (int16_t)(1000U + (n % 20000U));
+  Data.hIqKi = (int16_t)(500U + (n % 1000U));
+  Data.hIdKp = (int16_t)(1100U + (n % 20000U));
+  Data.hIdKi = (int16_t)(600U + (n % 1000U));
+  Data.hSpeedKp = (int16_t)(100U + (n % 300U));
+  Data.hSpeedKi = (int16_t)(10U + (n % 30U));
+  Data.hMaxAppPositiveMecSpeedUnit = (uint16_t)(1000U + (n % 500U));
+  Data.hMinAppNegativeMecSpeedUnit = -(int16_t)(1000U + (n % 500U));
+  Data.hMaxPositiveTorque = (uint16_t)(5000U + (n % 1000U));
+  Data.hMinNegativeTorque = -(int16_t)(5000U + (n % 1000U));
+  for (i = 0U; i < RUC_MAX_PHASE_NUMBER; i++)
+  {
+    Data.RevUp[i].hDurationms = (uint16_t)(100U * (i + 1U)) + (uint16_t)(n % 100U);
+    Data.RevUp[i].hFinalMecSpeedUnit = (int16_t)(10 * i) + (int16_t)(n % 50U);
+    Data.RevUp[i].hFinalTorque = (int16_t)(2000U + (n % 500U));
+  }
+  Data.fRs = (float)RS * (1.0f + (0.001f * (float)(n % 100U)));
+  Data.fLs = (float)LS;
+  Data.fKe = (float)MOTOR_VOLTAGE_CONSTANT;
+  return (Data);
+}
+
+/* PARAM_STORE_CMD as MCP_ReceivedPacket passes it, the reply copied to pReply */
+static uint8_t Command(uint8_t bCmd, const PST_Data_t *pData, PST_Data_t *pReply)
+{
+  uint8_t Rx[3U + sizeof(PST_Data_t)];
+  uint8_t Tx[PST_REPLY_SIZE];
+  uint16_t hRxLength = 1U;
+  uint16_t hTxLength = 0U;
+  uint8_t bResult;
+
+  Rx[0] = bCmd;
+  if (MC_NULL != pData)
+  {
+    Rx[1] = (uint8_t)PST_VERSION;
+    Rx[2] = (uint8_t)(PST_VERSION >> 8U);
+    (void)memcpy(&Rx[3], pData, sizeof(PST_Data_t));
+    hRxLength = (uint16_t)sizeof(Rx);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  bResult = PST_CMD(&Store, hRxLength, Rx, (int16_t)sizeof(Tx), &hTxLength, Tx);
+  if ((MC_NULL != pReply) && (PST_REPLY_SIZE == hTxLength))
+  {
+    (void)memcpy(pReply, &Tx[2], sizeof(PST_Data_t));
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bResult);
+}
+
+/* The components run the block */
+static bool Running(const PST_Data_t *pData)
+{
+  bool bRunning = (PID_GetKP(&PIDIq) == pData->hIqKp) && (PID_GetKI(&PIDIq) == pData->hIqKi)
+               && (PID_GetKP(&PIDId) == pData->hIdKp) && (PID_GetKI(&PIDId) == pData->hIdKi)
+               && (PID_GetKP(&PIDSpeed) == pData->hSpeedKp) && (PID_GetKI(&PIDSpeed) == pData->hSpeedKi)
+               && (STC.MaxAppPositiveMecSpeedUnit == pData->hMaxAppPositiveMecSpeedUnit)
+               && (STC.MinAppNegativeMecSpeedUnit == pData->hMinAppNegativeMecSpeedUnit)
+               && (STC.MaxPositiveTorque == pData->hMaxPositiveTorque)
+               && (STC.MinNegativeTorque == pData->hMinNegativeTorque)
+               && (SCC.fRSApplied == pData->fRs) && (SCC.fLSApplied == pData->fLs) && (SCC.fKeApplied == pData->fKe);
+  uint8_t i;
+
+  for (i = 0U; i < RUC_MAX_PHASE_NUMBER; i++)
+  {
+    bRunning = bRunning && (RevUp.ParamsData[i].hDurationms == pData->RevUp[i].hDurationms)
+            && (RevUp.ParamsData[i].hFinalMecSpeedUnit == pData->RevUp[i].hFinalMecSpeedUnit)
+            && (RevUp.ParamsData[i].hFinalTorque == pData->RevUp[i].hFinalTorque);
+  }
+  return (bRunning);
+}
+
+/* Commit by PARAM_STORE_CMD, executed by the background task */
+static bool Commit(const PST_Data_t *pData)
+{
+  bool bCommitted = (MCP_CMD_OK == Command(PST_CMD_WRITE, pData, MC_NULL))
+                 && (MCP_CMD_OK == Command(PST_CMD_COMMIT, MC_NULL, MC_NULL));
+  uint16_t hWriteErrors = Store.hWriteErrors;
+
+  PST_BackgroundTask(&Store);
+  return (bCommitted && (false == Store.bCommitRequest) && (hWriteErrors == Store.hWriteErrors));
+}
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-60s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+static void CheckBlank(void)
+{
+  PST_Data_t Reply;
+  bool bLoaded;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  bLoaded = Reset();
+  Check("blank flash: built-in parameters kept and captured",
+        (false == bLoaded) && (PID_GetKP(&PIDIq) == PID_TORQUE_KP_DEFAULT)
+        && (MCP_CMD_OK == Command(PST_CMD_READ, MC_NULL, &Reply)) && Running(&Reply)
+        && (Reply.hIqKp == PID_TORQUE_KP_DEFAULT) && (Reply.fRs == (float)RS) && (0U == Reply.bOffsetsValid));
+}
+
+static void CheckCommand(void)
+{
+  PST_Data_t New = Block(1U);
+  PST_Data_t Bad = Block(2U);
+  PST_Data_t Reply;
+  uint8_t Rx[3] = {PST_CMD_WRITE, (uint8_t)PST_VERSION, 0U};
+  uint8_t Tx[PST_REPLY_SIZE];
+  uint16_t hTxLength;
+  bool bRefused;
+
+  (void)Reset();
+  Bad.hSpeedKi = -1;
+  bRefused = (MCP_CMD_NOK == Command(PST_CMD_WRITE, &Bad, MC_NULL))
+          && (MCP_ERROR_BAD_RAW_FORMAT == PST_CMD(&Store, (uint16_t)sizeof(Rx), Rx, (int16_t)sizeof(Tx), &hTxLength, Tx))
+          && (MCP_ERROR_BAD_RAW_FORMAT == PST_CMD(&Store, 1U, Rx, (int16_t)(PST_REPLY_SIZE - 1U), &hTxLength, Tx));
+  MCI.State = RUN;
+  bRefused = bRefused && (MCP_CMD_NOK == Command(PST_CMD_WRITE, &New, MC_NULL))
+          && (MCP_CMD_NOK == Command(PST_CMD_COMMIT, MC_NULL, MC_NULL)) && (PID_GetKP(&PIDIq) == PID_TORQUE_KP_DEFAULT);
+  MCI.State = IDLE;
+  Check("PARAM_STORE_CMD: bad blocks, bad formats and writes in RUN refused", bRefused);
+
+  Check("PARAM_STORE_CMD: write applied at once",
+        (MCP_CMD_OK == Command(PST_CMD_WRITE, &New, &Reply)) && Running(&New)
+        && (0 == memcmp(&Reply, &New, sizeof(Reply))));
+
+  (void)Command(PST_CMD_COMMIT, MC_NULL, MC_NULL);
+  MCI.State = RUN;
+  PST_BackgroundTask(&Store);
+  MCI.State = STOP;
+  PST_BackgroundTask(&Store);
+  Check("PARAM_STORE_CMD: commit waits for IDLE", (true == Store.bCommitRequest) && (0U == EraseCount[0]));
+  MCI.State = IDLE;
+  PST_BackgroundTask(&Store);
+
+  Check("PARAM_STORE_CMD: committed block loaded at reset",
+        (true == Reset()) && Running(&New) && (MCP_CMD_OK == Command(PST_CMD_READ, MC_NULL, &Reply))
+        && (0 == memcmp(&Reply, &New, sizeof(Reply))));
+}
+
+static void CheckWear(void)
+{
+  uint32_t n;
+  uint32_t wMin;
+  uint32_t wMax;
+  uint32_t i;
+  bool bLoaded = true;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)memset(EraseCount, 0, sizeof(EraseCount));
+  (void)Reset();
+  for (n = 0U; n < COMMITS; n++)
+  {
+    PST_Data_t Data = Block(n);
+
+    bLoaded = bLoaded && Commit(&Data) && Reset() && Running(&Data);
+  }
+  wMin = EraseCount[0];
+  wMax = EraseCount[0];
+  for (i = 1U; i < MC_FLASH_PARAMS_PAGES; i++)
+  {
+    wMin = (EraseCount[i] < wMin) ? EraseCount[i] : wMin;
+    wMax = (EraseCount[i] > wMax) ? EraseCount[i] : wMax;
+  }
+  printf("%u commits of %u bytes slots: page erases %u to %u\n", COMMITS, (unsigned)PST_SLOT_SIZE, wMin, wMax);
+  Check("wear: each commit loaded at reset, erases spread over the pages",
+        bLoaded && ((wMax - wMin) <= WEAR_SPREAD) && (wMin > 0U));
+}
+
+static void CheckPowerCut(void)
+{
+  /* Header and payload double words and the page erase */
+  const int Operations = (int)(PST_SLOT_SIZE / MC_FLASH_PROGRAM_SIZE) + 1;
+  const uint32_t SlotsPerPage = MC_FLASH_PAGE_SIZE / PST_SLOT_SIZE;
+  uint32_t n = 0U;
+  uint32_t Cuts = 0U;
+  PST_Data_t Old = Block(n);
+  bool bPassed;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)Reset();
+  bPassed = Commit(&Old);
+
+  /* Two rounds of the ring, cut at a different operation at each position */
+  while ((n < (2U * MC_FLASH_PARAMS_PAGES * SlotsPerPage)) && (true == bPassed))
+  {
+    PST_Data_t New = Block(n + 1U);
+    PST_Data_t Next = Block(n + 2U);
+
+    PowerBudget = (int)(n % (uint32_t)(Operations + 1));
+    (void)Commit(&New);
+    Cuts += bPowerCut ? 1U : 0U;
+    (void)Reset();
+    bPassed = Running(&Old) || Running(&New);
+    bPassed = bPassed && Commit(&Next) && Reset() && Running(&Next);
+    Old = Next;
+    n += 2U;
+  }
+  printf("%u power cuts within %d flash operations of a commit, %u ring positions\n", Cuts, Operations, n / 2U);
+  Check("power cut: previous or new block loaded, next commit loaded", bPassed && (Cuts > 0U));
+}
+
+static void CheckRejected(void)
+{
+  PST_Data_t Old = Block(7U);
+  PST_Data_t New = Block(8U);
+  FREC_Params_t OtherVersion = Records;
+  FREC_Handle_t Other = {.pParams = &OtherVersion};
+  uint32_t wPayload;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)Reset();
+  (void)Commit(&Old);
+  OtherVersion.hVersion = PST_VERSION + 1U;
+  FREC_Init(&Other);
+  Other.wSequence = Store.Records.wSequence;
+  Other.wNextAddress = Store.Records.wNextAddress;
+  (void)FREC_Append(&Other, &New, (uint16_t)sizeof(New));
+  Check("record of another layout version ignored", (true == Reset()) && Running(&Old));
+
+  (void)Commit(&New);
+  wPayload = Store.Records.wLastAddress - MC_FLASH_PARAMS_ADDRESS + (uint32_t)sizeof(FREC_Header_t);
+  Flash[wPayload] ^= 0x01U;
+  Check("record with a wrong CRC ignored, previous block loaded", (true == Reset()) && Running(&Old));
+}
+
+static void CheckOffsets(void)
+{
+  PolarizationOffsets_t Measured = {.phaseAOffset = 32100, .phaseBOffset = 32200, .phaseCOffset = 32300};
+  PolarizationOffsets_t Stored;
+  bool bFresh;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)Reset();
+  bFresh = PST_GetOffsets(&Store, 30, &Stored);
+  PST_SetOffsets(&Store, &Measured, 30);
+  PST_RequestCommit(&Store);
+  PST_BackgroundTask(&Store);
+  (void)memset(&Stored, 0, sizeof(Stored));
+  Check("offsets: calibrated until measured, then used within the drift",
+        (false == bFresh) && (true == Reset())
+        && (true == PST_GetOffsets(&Store, 30 + PST_OFFSETS_MAX_DRIFT_CELSIUS, &Stored))
+        && (0 == memcmp(&Stored, &Measured, sizeof(Stored)))
+        && (true == PST_GetOffsets(&Store, 30 - PST_OFFSETS_MAX_DRIFT_CELSIUS, &Stored))
+        && (false == PST_GetOffsets(&Store, 31 + PST_OFFSETS_MAX_DRIFT_CELSIUS, &Stored))
+        && (false == PST_GetOffsets(&Store, 29 - PST_OFFSETS_MAX_DRIFT_CELSIUS, &Stored)));
+}
+
+static void CheckMotorModel(void)
+{
+  PST_Data_t Data = Block(9U);
+  PST_Data_t Reply;
+
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)Reset();
+  Data.fLs = (float)(16.0 * LS);
+  Check("motor model out of range refused by the write", MCP_CMD_NOK == Command(PST_CMD_WRITE, &Data, MC_NULL));
+  Store.Data = Data;
+  PST_RequestCommit(&Store);
+  PST_BackgroundTask(&Store);
+  Check("motor model out of range loaded: built-in model kept and captured",
+        (true == Reset()) && (PID_GetKP(&PIDIq) == Data.hIqKp) && (SCC.fLSApplied == (float)LS)
+        && (MCP_CMD_OK == Command(PST_CMD_READ, MC_NULL, &Reply)) && (Reply.fLs == (float)LS));
+}
+
+int main(void)
+{
+  printf("Parameter store: %u pages of %u bytes at 0x%08X, %u bytes blocks in %u bytes slots\n\n",
+         (unsigned)MC_FLASH_PARAMS_PAGES, (unsigned)MC_FLASH_PAGE_SIZE, (unsigned)MC_FLASH_PARAMS_ADDRESS,
+         (unsigned)sizeof(PST_Data_t), (unsigned)PST_SLOT_SIZE);
+  CheckBlank();
+  CheckCommand();
+  CheckWear();
+  CheckPowerCut();
+  CheckRejected();
+  CheckOffsets();
+  CheckMotorModel();
+  Check("flash accessed within the pages, double words programmed once", 0 == AccessErrors);
+  return ((0 == Failures) ? 0 : 1);
+}
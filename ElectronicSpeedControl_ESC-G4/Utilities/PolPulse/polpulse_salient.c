@@ -0,0 +1,356 @@
+/**
+  ******************************************************************************
+  * @file    polpulse_salient.c
+  * @brief   Host test of the initial rotor position detection by inductive
+  *          pulses, on a model of a salient motor at standstill.
+  *
+  * The firmware pulse injection component runs as the ALIGNMENT state of
+  * TSK_MediumFrequencyTaskM1 and FOC_PolPulseM1 run it, with the parameters
+  * of mc_config.c, and drives a model of the windings of Motor 1:
+  *
+  * - rotor locked at the angle of the case, windings integrated in its d q
+  *   frame within each period, the currents sampled in the middle of the
+  *   PWM period and the voltage set at a sample applied from the next update
+  *   event, half a period later, the bus at its nominal voltage;
+  * - mean inductance LS, the q axis inductance SALIENCY times the d axis
+  *   one, the d axis saturated by the magnet: its incremental inductance
+  *   falls by SATURATION at POLPULSE_CURRENT_A adding to the magnet flux and
+  *   rises as much against it;
+  * - currents read by 12 bits converters, saturated at their full scale,
+  *   with a gaussian noise of NOISE_LSB.
+  *
+  * Each motor is detected at rotor angles all around the electrical turn.
+  * An angle handed to the rev-up must be within LOCATED_DEG of the rotor,
+  * its north pole told from its south pole, and the currents of the pulses
+  * must not exceed PEAK_RATIO times POLPULSE_CURRENT_A. Without saturation
+  * nothing tells the poles apart: the detection must be found inconclusive
+  * and the drive fall back to the alignment of the rev-up. Motors saturated
+  * enough must be located at every angle, those with little saturation may
+  * fall back. The program returns 1 when a case does not behave as
+  * expected.
+  *
+  * Usage: polpulse_salient
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mc_type.h"
+#include "polpulse.h"
+
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#define NOISE_LSB               2.0
+/* Rotor angles of each motor */
+#define NUM_ANGLES              72
+/* Largest error of the detected angle, electrical degrees */
+#define LOCATED_DEG             30.0
+/* Largest current of the pulses over POLPULSE_CURRENT_A */
+#define PEAK_RATIO              1.5
+/* Longest pulse sequence, periods */
+#define MAX_PERIODS             1000
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define DEG_PER_S16             (360.0 / 65536.0)
+
+typedef struct
+{
+  const char *pName;
+  double Saliency;                         /* Lq over Ld */
+  double Saturation;                       /* Relative change of Ld at POLPULSE_CURRENT_A */
+  bool bLocated;                           /* Expected located at every angle, else may fall back */
+} Motor_t;
+
+typedef struct
+{
+  double Id;                               /* Currents in the rotor frame, A */
+  double Iq;
+  double VdV;                              /* Voltage applied, V */
+  double VqV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad, 0 when the d axis is on beta */
+  double Ld;                               /* Unsaturated d axis inductance, H */
+  double Lq;
+  double Saturation;
+  double PeakA;
+  uint32_t Noise;
+} Plant_t;
+
+static Plant_t Plant;
+static POLPULSE_Obj PolPulse;
+static alphabeta_t Valphabeta;
+
+/* mc_config.c */
+static const POLPULSE_Params PolPulseParams =
+{
+  .VoltageScale       = (float_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+  .Ts                 = (float_t)(1.0 / ISR_FREQUENCY_HZ),
+  .Lsd                = (float_t)LS,
+  .PulseCurrentGoal_A = (float_t)POLPULSE_CURRENT_A,
+  .N                  = POLPULSE_PULSE_PERIODS,
+  .Nd                 = POLPULSE_DECAY_PERIODS,
+  .N_Angles           = POLPULSE_NUM_ANGLES,
+  .MinContrast        = (float_t)POLPULSE_MIN_CONTRAST,
+};
+
+/* The CORDIC of the target, computed in floating point */
+void FIXP30_CosSinPU(fixp30_t angle_pu, FIXP_CosSin_t *pCosSin)
+{
+  double Angle = ((double)(angle_pu & (FIXP30(1.0f) - 1)) * TWO_PI) / 1073741824.0;
+
+  pCosSin->cos = (fixp30_t)lround(1073741823.0 * cos(Angle));
+  pCosSin->sin = (fixp30_t)lround(1073741823.0 * sin(Angle));
+}
+
+void FIXP30_polar(const fixp30_t x, const fixp30_t y, fixp30_t *pAngle_pu, fixp30_t *pMagnitude)
+{
+  double Turn = atan2((double)y, (double)x) / TWO_PI;
+
+  *pAngle_pu = ((fixp30_t)llround(((Turn < 0.0) ? (Turn + 1.0) : Turn) * 1073741824.0)) & (FIXP30(1.0f) - 1);
+  *pMagnitude = (fixp30_t)fmin(hypot((double)x, (double)y), 2147483647.0);
+}
+
+/* Power stage ---------------------------------------------------------------*/
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+/* Phase currents, in the frame of MCM_Clarke: beta is -(a + 2 b) / sqrt(3) */
+static ab_t ReadPhaseCurrents(void)
+{
+  double Ialpha = (Plant.Id * sin(Plant.Theta)) + (Plant.Iq * cos(Plant.Theta));
+  double Ibeta = (Plant.Id * cos(Plant.Theta)) - (Plant.Iq * sin(Plant.Theta));
+  ab_t Iab;
+
+  Iab.a = ReadCurrent(Ialpha);
+  Iab.b = ReadCurrent((-0.5 * Ialpha) - ((SQRT3 / 2.0) * Ibeta));
+  return (Iab);
+}
+
+/* Incremental inductance of the d axis, saturated by the magnet */
+static double GetLdInc(double Id)
+{
+  return (Plant.Ld * fmin(fmax(1.0 - ((Plant.Saturation * Id) / POLPULSE_CURRENT_A), 0.2), 1.8));
+}
+
+/* Integrates the windings of the locked rotor from a sample to the next one */
+static void IntegratePeriod(void)
+{
+  const double Dt = 1.0 / ((double)ISR_FREQUENCY_HZ * (double)SUB_STEPS);
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    if ((SUB_STEPS / 2) == Sub)
+    {
+      /* Update event: the voltage set at the sample is loaded */
+      Plant.VdV = (Plant.NextValphaV * sin(Plant.Theta)) + (Plant.NextVbetaV * cos(Plant.Theta));
+      Plant.VqV = (Plant.NextValphaV * cos(Plant.Theta)) - (Plant.NextVbetaV * sin(Plant.Theta));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Plant.Id += ((Plant.VdV - (RS * Plant.Id)) * Dt) / GetLdInc(Plant.Id);
+    Plant.Iq += ((Plant.VqV - (RS * Plant.Iq)) * Dt) / Plant.Lq;
+    Plant.PeakA = fmax(Plant.PeakA, hypot(Plant.Id, Plant.Iq));
+  }
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* MCM_Clarke */
+static alphabeta_t Clarke(ab_t Iab)
+{
+  alphabeta_t Output;
+  int32_t wBeta = -(((int32_t)Iab.a * 18919) >> 15) - (((int32_t)Iab.b * 37838) >> 15);
+
+  Output.alpha = Iab.a;
+  Output.beta = (int16_t)((wBeta > 32767) ? 32767 : ((wBeta < -32768) ? -32768 : wBeta));
+  return (Output);
+}
+
+/* FOC_PolPulseM1 */
+static void RunHF(void)
+{
+  alphabeta_t Ialphabeta = Clarke(ReadPhaseCurrents());
+  Currents_Iab_t Iab_pu;
+  Voltages_Uab_t Uab_pu;
+
+  Iab_pu.A = ((fixp30_t)Ialphabeta.alpha) << 15;
+  Iab_pu.B = ((fixp30_t)Ialphabeta.beta) << 15;
+  Uab_pu.A = ((fixp30_t)Valphabeta.alpha) << 15;
+  Uab_pu.B = ((fixp30_t)Valphabeta.beta) << 15;
+  POLPULSE_run(&PolPulse, &Iab_pu, &Uab_pu, 0);
+
+  Valphabeta.alpha = 0;
+  Valphabeta.beta = 0;
+  if (true == POLPULSE_getOverruleDuty(&PolPulse))
+  {
+    Duty_Dab_t Dab = POLPULSE_getDutyAB(&PolPulse);
+    Valphabeta.alpha = (int16_t)(FIXP30_mpy(Dab.A, FIXP30(SQRT_3)) >> 15);
+    Valphabeta.beta = (int16_t)(FIXP30_mpy(Dab.B, FIXP30(SQRT_3)) >> 15);
+  }
+  else
+  {
+    /* Null voltage while the pulses are being planned */
+  }
+
+  /* PWMC_SetPhaseVoltage */
+  Plant.NextValphaV = ((double)Valphabeta.alpha * NOMINAL_BUS_VOLTAGE_V) / (SQRT3 * 32768.0);
+  Plant.NextVbetaV = ((double)Valphabeta.beta * NOMINAL_BUS_VOLTAGE_V) / (SQRT3 * 32768.0);
+}
+
+/* ALIGNMENT case of TSK_MediumFrequencyTaskM1, true once completed, with the detected angle in *phElAngle or
+   *pbFallback set when the detection is inconclusive */
+static bool RunMF(int16_t *phElAngle, bool *pbFallback)
+{
+  uint16_t hVbus_d = (uint16_t)NOMINAL_BUS_VOLTAGE_d;
+  fixp_t wOneOverVbus = (fixp_t)((((int64_t)1) << (FIXP_FMT + 16)) / ((hVbus_d > 512U) ? hVbus_d : 512U));
+  bool bDone = false;
+
+  POLPULSE_runBackground(&PolPulse, wOneOverVbus, ((fixp30_t)hVbus_d) << 14);
+  if (POLPULSE_STATE_PostcalcsComplete == POLPULSE_getState(&PolPulse))
+  {
+    *phElAngle = (int16_t)(16384 - (POLPULSE_getAngleEstimated(&PolPulse) >> 14));
+    *pbFallback = (false == POLPULSE_getFlagAngleValid(&PolPulse));
+    POLPULSE_resetState(&PolPulse);
+    bDone = true;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bDone);
+}
+
+/* Detected angle of the rotor at ThetaDeg, minus its actual one, electrical degrees in [-180, 180[, with
+   *pbFallback set when the drive falls back to the alignment */
+static double Detect(const Motor_t *pMotor, double ThetaDeg, double *pPeakA, bool *pbFallback)
+{
+  const double Ld = (2.0 * LS) / (1.0 + pMotor->Saliency);
+  int16_t hElAngle = 0;
+  bool bDone = false;
+  int Period;
+  double ErrorDeg;
+
+  Plant = (Plant_t){0};
+  Plant.Theta = (ThetaDeg * TWO_PI) / 360.0;
+  Plant.Ld = Ld;
+  Plant.Lq = pMotor->Saliency * Ld;
+  Plant.Saturation = pMotor->Saturation;
+  Plant.Noise = 1U + (uint32_t)ThetaDeg;
+  Valphabeta.alpha = 0;
+  Valphabeta.beta = 0;
+  *pbFallback = false;
+
+  (void)POLPULSE_init(&PolPulse, sizeof(PolPulse));
+  POLPULSE_setParams(&PolPulse, &PolPulseParams);
+  POLPULSE_trigger(&PolPulse);
+
+  for (Period = 0; (Period < MAX_PERIODS) && (false == bDone); Period++)
+  {
+    RunHF();
+    if (0 == (Period % (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)))
+    {
+      bDone = RunMF(&hElAngle, pbFallback);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    IntegratePeriod();
+  }
+
+  *pPeakA = Plant.PeakA;
+  ErrorDeg = fmod(((double)hElAngle * DEG_PER_S16) - ThetaDeg + 540.0, 360.0) - 180.0;
+  return ((true == bDone) ? ErrorDeg : 180.0);
+}
+
+int main(void)
+{
+  const Motor_t Motors[] =
+  {
+    {"surface magnets",       1.0, 0.20, true},
+    {"slightly salient",      1.1, 0.20, true},
+    {"salient",               1.3, 0.20, true},
+    {"surface, saturated 5%", 1.0, 0.05, false},
+    {"salient, saturated 5%", 1.3, 0.05, false},
+    {"surface, unsaturated",  1.0, 0.0,  false},
+    {"salient, unsaturated",  1.3, 0.0,  false},
+  };
+  int Failures = 0;
+  size_t i;
+
+  printf("Pulse injection, %d directions, %.0f A pulses of %d periods, decay %d periods, contrast %.3f\n\n",
+         POLPULSE_NUM_ANGLES, (double)POLPULSE_CURRENT_A, POLPULSE_PULSE_PERIODS, POLPULSE_DECAY_PERIODS,
+         (double)POLPULSE_MIN_CONTRAST);
+  printf("%-22s %6s %10s %10s %9s %9s %8s  %s\n", "", "Lq/Ld", "saturation", "max error", "flipped", "fallback",
+         "peak A", "");
+  for (i = 0; i < (sizeof(Motors) / sizeof(Motors[0])); i++)
+  {
+    const Motor_t *pMotor = &Motors[i];
+    double MaxErrorDeg = 0.0;
+    double PeakA = 0.0;
+    int Flipped = 0;
+    int Fallbacks = 0;
+    int k;
+    bool bPassed;
+
+    for (k = 0; k < NUM_ANGLES; k++)
+    {
+      double CasePeakA;
+      bool bFallback;
+      double ErrorDeg = fabs(Detect(pMotor, (360.0 * k) / NUM_ANGLES, &CasePeakA, &bFallback));
+
+      PeakA = fmax(PeakA, CasePeakA);
+      if (true == bFallback)
+      {
+        /* Aligned by the rev-up */
+        Fallbacks++;
+      }
+      else if (ErrorDeg > 90.0)
+      {
+        Flipped++;
+      }
+      else
+      {
+        MaxErrorDeg = fmax(MaxErrorDeg, ErrorDeg);
+      }
+    }
+    bPassed = (0 == Flipped) && (MaxErrorDeg < LOCATED_DEG) && (PeakA < (PEAK_RATIO * POLPULSE_CURRENT_A))
+           && ((false == pMotor->bLocated) || (0 == Fallbacks))
+           && ((0.0 != pMotor->Saturation) || (NUM_ANGLES == Fallbacks));
+    printf("%-22s %6.2f %9.0f %% %6.1f deg %3d / %-3d %3d / %-3d %8.2f  %s\n", pMotor->pName, pMotor->Saliency,
+           100.0 * pMotor->Saturation, MaxErrorDeg, Flipped, NUM_ANGLES, Fallbacks, NUM_ANGLES, PeakA,
+           bPassed ? "ok" : "FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nLimits: angle error %.0f deg, no pole flipped, peak current %.1f A, fallback without saturation\n",
+         LOCATED_DEG, PEAK_RATIO * POLPULSE_CURRENT_A);
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,495 @@
+/**
+  ******************************************************************************
+  * @file    regen_brake.c
+  * @brief   Host test of the regenerative braking limiter on a battery that
+  *          can not absorb the braking energy.
+  *
+  * The firmware limiter and PI regulators run as mc_tasks_foc.c runs them,
+  * with the handles of mc_config.c: REGEN_SetSpeedLimits then the speed
+  * regulator in the medium frequency task, REGEN_CalcLimits on the bus
+  * voltage of the period then the current regulators in the current
+  * control. They drive a model of Motor 1:
+  *
+  * - the windings, inductance LS, resistance RS and the flux of the motor
+  *   voltage constant, integrated in the rotor frame within each period;
+  * - the rotor and propeller, inertia MOTOR_INERTIA_KGM2 and viscous
+  *   friction MOTOR_FRICTION_NMS;
+  * - the bus capacitor BUS_CAPACITOR_F, charged by the lossless inverter and
+  *   by a battery of an open circuit voltage behind its resistance;
+  * - the voltage set at a sample applied from the next update event, half a
+  *   period later, in volts of the bus voltage at that time;
+  * - the currents and the bus voltage read by 12 bits converters at the
+  *   sample, the speed exact.
+  *
+  * The motor brakes from FROM_RPM to TO_RPM, with and without the limiter,
+  * in torque mode at -IQMAX until TO_RPM, and in speed mode to a target of
+  * TO_RPM, both on the THR_RAMP_DURATION_MS ramps of the throttle. The run
+  * stops when the bus voltage reaches OV_VOLTAGE_THRESHOLD_V, the drive
+  * tripped:
+  *
+  * - a charged battery, or one of a high resistance: the drive trips without
+  *   the limiter in torque mode. With it, in both modes, the bus must stay
+  *   below REGEN_VBUS_START_V plus VBUS_PEAK_V, within VBUS_BAND_V of
+  *   REGEN_VBUS_START_V in REGULATED_RATIO of the periods with Iq cut, and
+  *   the braking Id within REGEN_ID_MAX_A;
+  * - a battery at the nominal voltage, or of a low resistance: the limiter
+  *   must not act at all;
+  * - in speed mode, the longer braking must not wind up the speed
+  *   regulator: its undershoot below TO_RPM within UNDERSHOOT_RPM of the one
+  *   without the limiter;
+  * - in all cases, the limits must be released once braked.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: regen_brake
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mc_type.h"
+#include "pid_regulator.h"
+#include "regen_limiter.h"
+
+/* Integration steps of the windings and the bus per period */
+#define SUB_STEPS               16
+/* Speed target step, mechanical */
+#define FROM_RPM                9000.0
+#define TO_RPM                  1000.0
+/* Bus capacitor of the board */
+#define BUS_CAPACITOR_F         220.0e-6
+/* Settling before the step, and longest braking, s */
+#define SETTLE_S                0.02
+#define BRAKE_S                 2.0
+/* Largest bus voltage over REGEN_VBUS_START_V, band of the regulation and least ratio of the periods within it
+   while the limiter cuts Iq */
+#define VBUS_PEAK_V             0.4
+#define VBUS_BAND_V             0.1
+#define REGULATED_RATIO         0.9
+/* Largest undershoot of the speed regulator over the one without the limiter */
+#define UNDERSHOOT_RPM          200.0
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             ((double)CURRENT_CONV_FACTOR)
+#define S16_PER_LSB             16.0
+#define VBUS_D_PER_VOLT         (65536.0 * VBUS_PARTITIONING_FACTOR / ADC_REFERENCE_VOLTAGE)
+#define HF_PER_MF               ((int)ISR_FREQUENCY_HZ / (int)MEDIUM_FREQUENCY_TASK_RATE)
+
+typedef struct
+{
+  const char *pName;
+  MC_ControlMode_t Mode;
+  double BatteryV;
+  double EsrOhm;
+  bool bAbsorbed;                          /* The battery absorbs the braking energy */
+} Case_t;
+
+typedef struct
+{
+  double Id;                               /* Currents in the rotor frame, A */
+  double Iq;
+  double ValphaS16;                        /* Voltage applied, s16 of the bus voltage */
+  double VbetaS16;
+  double NextValphaS16;                    /* Voltage set at the last sample */
+  double NextVbetaS16;
+  double Theta;                            /* Electrical angle, rad */
+  double Wm;                               /* Mechanical speed, rad/s */
+  double VbusV;
+  double Time;                             /* s */
+} Plant_t;
+
+typedef struct
+{
+  bool bTripped;
+  double PeakVbusV;
+  double BrakeMs;                          /* From the step to TO_RPM, ms */
+  double UndershootRpm;                    /* Below TO_RPM, from the step */
+  double IdBrakeMaxA;                      /* Largest braking Id, A */
+  long LimitedPeriods;                     /* Periods with Iq cut, and among them the ones within VBUS_BAND_V */
+  long RegulatedPeriods;
+  double SpeedSum;                         /* Of the samples, to compare two runs */
+  bool bReleased;                          /* Limits released at the end */
+} Result_t;
+
+static Plant_t Plant;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static PID_Handle_t PIDSpeed;
+static PID_Handle_t PIDRegen;
+static REGEN_Handle_t Regen;
+static double Ramp;                        /* Torque reference, digit, or speed target, rpm */
+
+/* mc_config.c */
+static void InitRegulators(void)
+{
+  const PID_Handle_t PIDIqInit =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIdInit =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDSpeedInit =
+  {
+    .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+    .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)SP_KPDIV,
+    .hKiDivisor          = (uint16_t)SP_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDRegenInit =
+  {
+    .hDefKpGain          = (int16_t)PID_REGEN_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_REGEN_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)((IQMAX + REGEN_ID_MAX) * REGEN_KIDIV),
+    .wLowerIntegralLimit = 0,
+    .hUpperOutputLimit   = (int16_t)(IQMAX + REGEN_ID_MAX),
+    .hLowerOutputLimit   = 0,
+    .hKpDivisor          = (uint16_t)REGEN_KPDIV,
+    .hKiDivisor          = (uint16_t)REGEN_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)REGEN_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)REGEN_KIDIV_LOG,
+  };
+  const REGEN_Handle_t RegenInit =
+  {
+    .pPIRegen     = &PIDRegen,
+    .pPISpeed     = &PIDSpeed,
+    .hVbusStart_d = REGEN_VBUS_START_d,
+    .hIdBrakeMax  = (int16_t)REGEN_ID_MAX,
+    .hIqRegenMax  = (int16_t)IQMAX,
+  };
+
+  PIDIq = PIDIqInit;
+  PIDId = PIDIdInit;
+  PIDSpeed = PIDSpeedInit;
+  PIDRegen = PIDRegenInit;
+  Regen = RegenInit;
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+  PID_HandleInit(&PIDSpeed);
+  REGEN_Init(&Regen);
+}
+
+/* Motor and bus --------------------------------------------------------------*/
+
+/* Integrates the windings, the rotor and the bus from a sample to the next one */
+static void IntegratePeriod(const Case_t *pCase)
+{
+  const double Dt = 1.0 / ((double)ISR_FREQUENCY_HZ * (double)SUB_STEPS);
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    double VoltPerS16 = Plant.VbusV / (SQRT3 * 32768.0);
+    double W = Plant.Wm * (double)POLE_PAIR_NUM;
+    double Valpha;
+    double Vbeta;
+    double Vd;
+    double Vq;
+    double InverterA;
+
+    if ((SUB_STEPS / 2) == Sub)
+    {
+      /* Update event: the voltage set at the sample is loaded */
+      Plant.ValphaS16 = Plant.NextValphaS16;
+      Plant.VbetaS16 = Plant.NextVbetaS16;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* In the frame of MCM_Park: the d axis at (sin, cos) of the angle */
+    Valpha = Plant.ValphaS16 * VoltPerS16;
+    Vbeta = Plant.VbetaS16 * VoltPerS16;
+    Vd = (Valpha * sin(Plant.Theta)) + (Vbeta * cos(Plant.Theta));
+    Vq = (Valpha * cos(Plant.Theta)) - (Vbeta * sin(Plant.Theta));
+    Plant.Id += ((Vd - (RS * Plant.Id) + (W * LS * Plant.Iq)) * Dt) / LS;
+    Plant.Iq += ((Vq - (RS * Plant.Iq) - (W * LS * Plant.Id) - (W * HSO_FLUX_WB)) * Dt) / LS;
+    Plant.Wm += ((((1.5 * (double)POLE_PAIR_NUM * HSO_FLUX_WB) * Plant.Iq) - (MOTOR_FRICTION_NMS * Plant.Wm)) * Dt)
+                / MOTOR_INERTIA_KGM2;
+    Plant.Theta = fmod(Plant.Theta + (W * Dt), TWO_PI);
+    Plant.Time += Dt;
+
+    /* The inverter draws the power of the windings from the bus, or returns it */
+    InverterA = (1.5 * ((Vd * Plant.Id) + (Vq * Plant.Iq))) / Plant.VbusV;
+    Plant.VbusV += ((((pCase->BatteryV - Plant.VbusV) / pCase->EsrOhm) - InverterA) * Dt) / BUS_CAPACITOR_F;
+  }
+}
+
+/* Value read by a 12 bits converter, left aligned */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+static uint16_t ReadVbus(double VbusV)
+{
+  double Lsb = floor((VbusV * VBUS_D_PER_VOLT) / 16.0);
+
+  Lsb = fmin(fmax(Lsb, 0.0), 4095.0);
+  return ((uint16_t)(Lsb * 16.0));
+}
+
+static int16_t SpeedUnit(double Wm)
+{
+  return ((int16_t)lround((Wm * (double)SPEED_UNIT) / TWO_PI));
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* FOC_CurrControllerM1 on the exact angle, with or without the limiter */
+static void RunHF(int16_t hIqref, bool bLimiter)
+{
+  double Ialpha = (Plant.Id * sin(Plant.Theta)) + (Plant.Iq * cos(Plant.Theta));
+  double Ibeta = (Plant.Id * cos(Plant.Theta)) - (Plant.Iq * sin(Plant.Theta));
+  int16_t hIa = ReadCurrent(Ialpha);
+  int16_t hIb = ReadCurrent((-0.5 * Ialpha) - ((SQRT3 / 2.0) * Ibeta));
+  double Angle = Plant.Theta;
+  int32_t wIqref = hIqref;
+  int32_t wIdref = 0;
+  double Module;
+  qd_t Iqd;
+  qd_t Vqd;
+
+  /* MCM_Clarke, MCM_Park */
+  Ialpha = (double)hIa;
+  Ibeta = -((double)hIa + (2.0 * (double)hIb)) / SQRT3;
+  Iqd.q = (int16_t)lround((Ialpha * cos(Angle)) - (Ibeta * sin(Angle)));
+  Iqd.d = (int16_t)lround((Ialpha * sin(Angle)) + (Ibeta * cos(Angle)));
+
+  if (true == bLimiter)
+  {
+    REGEN_CalcLimits(&Regen, ReadVbus(Plant.VbusV), hIqref);
+    wIqref = (int32_t)REGEN_LimitIq(&Regen, hIqref);
+    wIdref += (int32_t)REGEN_GetIdBrake(&Regen);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  Vqd.q = PI_Controller(&PIDIq, wIqref - Iqd.q);
+  Vqd.d = PI_Controller(&PIDId, wIdref - Iqd.d);
+
+  /* Circle_Limitation */
+  Module = hypot((double)Vqd.q, (double)Vqd.d);
+  Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+  Vqd.q = (int16_t)lround((double)Vqd.q * Module);
+  Vqd.d = (int16_t)lround((double)Vqd.d * Module);
+
+  /* MCM_Rev_Park then PWMC_SetPhaseVoltage, applied from the next update event */
+  Plant.NextValphaS16 = ((double)Vqd.q * cos(Angle)) + ((double)Vqd.d * sin(Angle));
+  Plant.NextVbetaS16 = ((double)Vqd.d * cos(Angle)) - ((double)Vqd.q * sin(Angle));
+}
+
+/* FOC_CalcCurrRef: the torque reference, or the speed regulator its output limits set by the limiter, on the
+   ramps of the throttle */
+static int16_t RunMF(const Case_t *pCase, bool bBraking, bool bLimiter)
+{
+  const double Steps = ((double)THR_RAMP_DURATION_MS * (double)MEDIUM_FREQUENCY_TASK_RATE) / 1000.0;
+  int16_t hSpeed = SpeedUnit(Plant.Wm);
+  double Target;
+  int16_t hIqref;
+
+  if (true == bLimiter)
+  {
+    REGEN_SetSpeedLimits(&Regen, hSpeed);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if (MCM_TORQUE_MODE == pCase->Mode)
+  {
+    /* Full brake down to TO_RPM, then released */
+    Target = (bBraking && (Plant.Wm > ((TWO_PI * TO_RPM) / 60.0))) ? -(double)IQMAX : 0.0;
+    Ramp += fmin(fmax(Target - Ramp, -(double)IQMAX / Steps), (double)IQMAX / Steps);
+    hIqref = (int16_t)lround(Ramp);
+  }
+  else
+  {
+    Target = bBraking ? TO_RPM : FROM_RPM;
+    Ramp += fmin(fmax(Target - Ramp, -(FROM_RPM - TO_RPM) / Steps), (FROM_RPM - TO_RPM) / Steps);
+    hIqref = PI_Controller(&PIDSpeed, lround((Ramp * (double)SPEED_UNIT) / (double)U_RPM) - (int32_t)hSpeed);
+  }
+  return (hIqref);
+}
+
+static Result_t Run(const Case_t *pCase, bool bLimiter)
+{
+  const long Periods = lround((SETTLE_S + BRAKE_S) * (double)ISR_FREQUENCY_HZ);
+  Result_t Result = {false, pCase->BatteryV, -1.0, 0.0, 0.0, 0, 0, 0.0, false};
+  int16_t hIqref = 0;
+  long k;
+
+  Plant = (Plant_t){0};
+  Ramp = (MCM_TORQUE_MODE == pCase->Mode) ? 0.0 : FROM_RPM;
+  Plant.Wm = (TWO_PI * FROM_RPM) / 60.0;
+  Plant.VbusV = pCase->BatteryV;
+  InitRegulators();
+
+  /* Running at FROM_RPM: the Iq regulator holds the voltage of the flux */
+  Plant.NextValphaS16 = (Plant.Wm * (double)POLE_PAIR_NUM * HSO_FLUX_WB * SQRT3 * 32768.0) / Plant.VbusV;
+  Plant.ValphaS16 = Plant.NextValphaS16;
+  PID_SetIntegralTerm(&PIDIq, (int32_t)lround(Plant.NextValphaS16) * (int32_t)TF_KIDIV);
+
+  for (k = 0; (k < Periods) && (false == Result.bTripped); k++)
+  {
+    bool bBraking = (Plant.Time >= SETTLE_S);
+    double Rpm;
+
+    if (0 == (k % HF_PER_MF))
+    {
+      hIqref = RunMF(pCase, bBraking, bLimiter);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    RunHF(hIqref, bLimiter);
+    Result.IdBrakeMaxA = fmax(Result.IdBrakeMaxA, -(double)REGEN_GetIdBrake(&Regen) / S16_PER_AMP);
+    if (Regen.hIqLimit < Regen.hIqRegenMax)
+    {
+      Result.LimitedPeriods++;
+      Result.RegulatedPeriods += (fabs(Plant.VbusV - REGEN_VBUS_START_V) <= VBUS_BAND_V) ? 1 : 0;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    IntegratePeriod(pCase);
+
+    /* Over voltage protection */
+    Result.PeakVbusV = fmax(Result.PeakVbusV, Plant.VbusV);
+    Result.bTripped = (Plant.VbusV >= (double)OV_VOLTAGE_THRESHOLD_V);
+
+    Rpm = (Plant.Wm * 60.0) / TWO_PI;
+    if (bBraking && (Result.BrakeMs < 0.0) && (Rpm <= TO_RPM))
+    {
+      Result.BrakeMs = (Plant.Time - SETTLE_S) * 1000.0;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Result.UndershootRpm = bBraking ? fmax(Result.UndershootRpm, TO_RPM - Rpm) : Result.UndershootRpm;
+    Result.SpeedSum += Plant.Wm;
+  }
+  Result.bReleased = (0 == Regen.hIdBrake) && (Regen.hIqLimit == Regen.hIqRegenMax)
+                     && (PIDSpeed.hLowerOutputLimit == -(int16_t)IQMAX);
+  return (Result);
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {"torque, charged, 0.4 Ohm",   MCM_TORQUE_MODE, 16.8,                          0.4,  false},
+    {"torque, 17 V, 0.5 Ohm",      MCM_TORQUE_MODE, 17.0,                          0.5,  false},
+    {"torque, charged, 0.05 Ohm",  MCM_TORQUE_MODE, 16.8,                          0.05, true},
+    {"torque, nominal, 0.3 Ohm",   MCM_TORQUE_MODE, (double)NOMINAL_BUS_VOLTAGE_V, 0.3,  true},
+    {"speed, charged, 0.4 Ohm",    MCM_SPEED_MODE,  16.8,                          0.4,  false},
+    {"speed, 17 V, 0.5 Ohm",       MCM_SPEED_MODE,  17.0,                          0.5,  false},
+    {"speed, nominal, 0.3 Ohm",    MCM_SPEED_MODE,  (double)NOMINAL_BUS_VOLTAGE_V, 0.3,  true},
+  };
+  Result_t Without[sizeof(Cases) / sizeof(Cases[0])];
+  Result_t With[sizeof(Cases) / sizeof(Cases[0])];
+  bool bTrips = true;
+  bool bHeld = true;
+  bool bRegulated = true;
+  bool bIdLimited = true;
+  bool bIdentical = true;
+  bool bSettled = true;
+  bool bReleased = true;
+  size_t i;
+
+  printf("Braking from %.0f to %.0f rpm, bus capacitor %.0f uF, over voltage at %d V, limiter from %.1f V\n\n",
+         FROM_RPM, TO_RPM, BUS_CAPACITOR_F * 1.0e6, OV_VOLTAGE_THRESHOLD_V, REGEN_VBUS_START_V);
+  printf("%-26s  %37s  %56s\n", "", "without limiter", "with limiter");
+  printf("%-26s  %8s %8s %9s %9s  %8s %8s %9s %9s %8s %9s\n", "case", "tripped", "peak V", "brake ms", "under rpm",
+         "tripped", "peak V", "brake ms", "under rpm", "Id A", "in band");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    const Case_t *pCase = &Cases[i];
+    double Regulated;
+
+    Without[i] = Run(pCase, false);
+    With[i] = Run(pCase, true);
+    Regulated = (With[i].LimitedPeriods > 0) ? ((double)With[i].RegulatedPeriods / (double)With[i].LimitedPeriods)
+                                             : 1.0;
+    printf("%-26s  %8s %8.2f %9.1f %9.0f  %8s %8.2f %9.1f %9.0f %8.2f %8.0f%%\n", pCase->pName,
+           Without[i].bTripped ? "yes" : "no", Without[i].PeakVbusV, Without[i].BrakeMs, Without[i].UndershootRpm,
+           With[i].bTripped ? "yes" : "no", With[i].PeakVbusV, With[i].BrakeMs, With[i].UndershootRpm,
+           With[i].IdBrakeMaxA, 100.0 * Regulated);
+
+    if (pCase->bAbsorbed)
+    {
+      bIdentical = bIdentical && !Without[i].bTripped && (Without[i].SpeedSum == With[i].SpeedSum);
+    }
+    else
+    {
+      bTrips = bTrips && ((MCM_SPEED_MODE == pCase->Mode) || Without[i].bTripped);
+      bHeld = bHeld && !With[i].bTripped && (With[i].PeakVbusV < (REGEN_VBUS_START_V + VBUS_PEAK_V));
+      bRegulated = bRegulated && (With[i].LimitedPeriods > 0) && (Regulated >= REGULATED_RATIO);
+      bIdLimited = bIdLimited && (With[i].IdBrakeMaxA > 0.0) && (With[i].IdBrakeMaxA <= (double)REGEN_ID_MAX_A);
+    }
+    if ((MCM_SPEED_MODE == pCase->Mode) && !Without[i].bTripped)
+    {
+      bSettled = bSettled && (With[i].BrakeMs > 0.0)
+                 && (With[i].UndershootRpm <= (Without[i].UndershootRpm + UNDERSHOOT_RPM));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    bReleased = bReleased && With[i].bReleased;
+  }
+  printf("\n");
+
+  Check("battery unable to absorb the energy: trips without the limiter", bTrips);
+  Check("battery unable to absorb the energy: bus held with the limiter", bHeld);
+  Check("bus regulated without limit cycle while Iq is cut", bRegulated);
+  Check("braking Id within REGEN_ID_MAX_A", bIdLimited);
+  Check("battery absorbing the energy: the limiter does not act", bIdentical);
+  Check("speed mode: no undershoot of a wound up speed regulator", bSettled);
+  Check("limits released once braked", bReleased);
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,551 @@
+/**
+  ******************************************************************************
+  * @file    plant_validation.c
+  * @brief   Host validation of the Self Commissioning against a simulated
+  *          motor: R, the inverter drop, L, Ke and the observer constant C1
+  *          measured by the procedure compared with those of the plant.
+  *
+  * The firmware procedure, SCC_SetPhaseVoltage every current control period
+  * and SCC_MF every medium frequency period as the PROFILE state runs them,
+  * drives a model of the motor and of the inverter:
+  *
+  * - R and L detection: three phase windings integrated within each period,
+  *   each leg dropping a constant voltage along its current, the neutral
+  *   removed. The voltage set at a sample is applied from the middle of the
+  *   period, the currents are read by 12 bits converters with 1 LSB of noise;
+  * - Ke detection: rotor dragged by the virtual speed sensor, the currents
+  *   regulated on their references, the voltages those of the steady state
+  *   with the fundamental of the inverter drop and a viscous friction.
+  *
+  * The procedure is run up to the switch over to the observer. A plant whose
+  * L over Ke is too high for the fixed point constants of the observer has
+  * the procedure aborted before it, the observer unchanged. The program
+  * returns 1 when a parameter is measured out of its tolerance or when the
+  * procedure does not end as expected.
+  *
+  * Usage: plant_validation
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mp_self_com_ctrl.h"
+
+/* The firmware masks the interrupts around the data shared with the current control, run in sequence here */
+#define __disable_irq()         ((void)0)
+#define __enable_irq()          ((void)0)
+#include "mp_self_com_ctrl.c"
+
+/* Longest procedure, medium frequency periods */
+#define MF_PERIODS_MAX          60000
+/* Current control periods per medium frequency period */
+#define HF_PER_MF               (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)
+/* Integration steps of the windings per half period */
+#define SUB_STEPS               32
+/* Viscous friction of the rotor, Nm per rad/s */
+#define FRICTION                1e-5
+
+/* Tolerances, relative, and of the inverter drop, V */
+#define RS_TOLERANCE            0.03
+#define LS_TOLERANCE            0.05
+#define KE_TOLERANCE            0.03
+#define C1_TOLERANCE            0.06
+#define VDT_TOLERANCE_V         0.03
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define SQRT2                   1.4142135623730951
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+
+typedef struct
+{
+  const char *pName;
+  double ResistanceOhm;
+  double InductanceH;
+  double KeVrmsKrpm;                       /* Vrms ph-ph / kRPM */
+  double LegDropV;                         /* Voltage drop of each leg along its current */
+  double BusV;
+  bool bRetuned;                           /* false: observer constants out of range, the procedure aborted */
+} Case_t;
+
+typedef struct
+{
+  double Ia;                               /* Phase currents, A */
+  double Ib;
+  double Ic;
+  double ValphaV;                          /* Voltage applied, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set by the last PWMC_SetPhaseVoltage, V */
+  double NextVbetaV;
+  uint32_t Noise;
+} Plant_t;
+
+static const Case_t *pPlantCase;
+static Plant_t Plant;
+static uint16_t hFault;
+
+static PWMC_Handle_t Pwmc;
+static RDivider_Handle_t Vbs;
+static FOCVars_t FocVars;
+static MCI_Handle_t Mci;
+static VirtualSpeedSensor_Handle_t Vss;
+static CircleLimitation_Handle_t Clm;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static PID_Handle_t PIDSpeed;
+static RevUpCtrl_Handle_t Ruc;
+static STO_PLL_Handle_t Sto;
+static SpeednTorqCtrl_Handle_t Stc;
+static OTT_Handle_t Ott;
+static SCC_Params_t SccParams;
+static SCC_Handle_t Scc;
+
+static const STO_PLL_GainSchedPoint_t GainSched[STO_GAIN_SCHED_SIZE] =
+{
+  {
+    .hMecSpeedUnit = STO_GS_SPEED1_UNIT,
+    .hC2           = C2,
+    .hC4           = C4,
+    .hPLLKpGain    = PLL_KP_GAIN,
+    .hPLLKiGain    = PLL_KI_GAIN,
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED2_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED2_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED2_RPM),
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED3_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED3_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED3_RPM),
+  },
+};
+
+/* Components the procedure drives, only recording what the plant needs ------*/
+
+uint16_t PWMC_SetPhaseVoltage(PWMC_Handle_t *pHandle, alphabeta_t Valfa_beta)
+{
+  (void)pHandle;
+  Plant.NextValphaV = ((double)Valfa_beta.alpha * pPlantCase->BusV) / (SQRT3 * 32768.0);
+  Plant.NextVbetaV = ((double)Valfa_beta.beta * pPlantCase->BusV) / (SQRT3 * 32768.0);
+  return (MC_NO_ERROR);
+}
+
+void MCI_FaultProcessing(MCI_Handle_t *pHandle, uint16_t hSetErrors, uint16_t hResetErrors)
+{
+  (void)pHandle;
+  (void)hResetErrors;
+  hFault |= hSetErrors;
+}
+
+bool MCI_StopMotor(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (true);
+}
+
+bool MCI_StartMotor(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (true);
+}
+
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (IDLE);
+}
+
+uint16_t MCI_GetOccurredFaults(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (hFault);
+}
+
+void STC_SetSpeedSensor(SpeednTorqCtrl_Handle_t *pHandle, SpeednPosFdbk_Handle_t *SPD_Handle)
+{
+  pHandle->SPD = SPD_Handle;
+}
+
+void STC_SetControlMode(SpeednTorqCtrl_Handle_t *pHandle, MC_ControlMode_t bMode)
+{
+  pHandle->Mode = bMode;
+}
+
+void STC_ForceSpeedReferenceToCurrentSpeed(SpeednTorqCtrl_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void STO_PLL_Clear(STO_PLL_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void STO_SetDirection(STO_PLL_Handle_t *pHandle, int8_t direction)
+{
+  (void)pHandle;
+  (void)direction;
+}
+
+void STO_PLL_CalcScheduledGains(STO_PLL_Handle_t *pHandle, int16_t hMecSpeedUnit, STO_PLL_GainSchedPoint_t *pGains)
+{
+  (void)hMecSpeedUnit;
+  *pGains = pHandle->pGainSched[0];
+}
+
+void STO_PLL_SetObserverGains(STO_PLL_Handle_t *pHandle, int16_t hhC1, int16_t hhC2)
+{
+  pHandle->hC2 = hhC1;
+  pHandle->hC4 = hhC2;
+}
+
+bool STO_PLL_IsObserverConverged(STO_PLL_Handle_t *pHandle, int16_t *phForcedMecSpeedUnit)
+{
+  (void)pHandle;
+  (void)phForcedMecSpeedUnit;
+  return (true);
+}
+
+void OTT_Clear(OTT_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void OTT_Stop(OTT_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void OTT_SR(OTT_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void OTT_MF(OTT_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void RUC_SetPhaseDurationms(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, uint16_t hDurationms)
+{
+  (void)pHandle;
+  (void)bPhase;
+  (void)hDurationms;
+}
+
+void RUC_SetPhaseFinalMecSpeedUnit(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, int16_t hFinalMecSpeedUnit)
+{
+  (void)pHandle;
+  (void)bPhase;
+  (void)hFinalMecSpeedUnit;
+}
+
+void RUC_SetPhaseFinalTorque(RevUpCtrl_Handle_t *pHandle, uint8_t bPhase, int16_t hFinalTorque)
+{
+  (void)pHandle;
+  (void)bPhase;
+  (void)hFinalTorque;
+}
+
+alphabeta_t MCM_Clarke(ab_t Input)
+{
+  alphabeta_t Output;
+
+  Output.alpha = Input.a;
+  Output.beta = (int16_t)(-((int32_t)Input.a + (2 * (int32_t)Input.b)) * 18919 / 32768);
+  return (Output);
+}
+
+qd_t MCM_Park(alphabeta_t Input, int16_t Theta)
+{
+  double Angle = ((double)Theta * TWO_PI) / 65536.0;
+  qd_t Output;
+
+  Output.q = (int16_t)(((double)Input.alpha * cos(Angle)) - ((double)Input.beta * sin(Angle)));
+  Output.d = (int16_t)(((double)Input.alpha * sin(Angle)) + ((double)Input.beta * cos(Angle)));
+  return (Output);
+}
+
+/* Plant ---------------------------------------------------------------------*/
+
+/* Current read by a 12 bits converter, 16 s16A per LSB, with 1 LSB of noise */
+static int16_t SampleCurrent(double CurrentA)
+{
+  int32_t wLsb = (int32_t)lround((CurrentA * S16_PER_AMP) / 16.0);
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  wLsb += (int32_t)((Plant.Noise >> 16) % 3U) - 1;
+  return ((int16_t)(wLsb * 16));
+}
+
+static void ReadPhaseCurrents(PWMC_Handle_t *pHandle, ab_t *Iab)
+{
+  (void)pHandle;
+  Iab->a = SampleCurrent(Plant.Ia);
+  Iab->b = SampleCurrent(Plant.Ib);
+}
+
+static double Sign(double Value)
+{
+  return ((Value > 0.0) ? 1.0 : ((Value < 0.0) ? -1.0 : 0.0));
+}
+
+/* Integrates the windings over half a period under the voltage applied */
+static void IntegrateHalfPeriod(void)
+{
+  const double Dt = 1.0 / (2.0 * (double)TF_REGULATION_RATE * (double)SUB_STEPS);
+  double Va = Plant.ValphaV;
+  double Vb = (-0.5 * Plant.ValphaV) + ((SQRT3 / 2.0) * Plant.VbetaV);
+  int i;
+
+  for (i = 0; i < SUB_STEPS; i++)
+  {
+    double Sa = Sign(Plant.Ia);
+    double Sb = Sign(Plant.Ib);
+    double Sc = Sign(Plant.Ic);
+    double Sn = (Sa + Sb + Sc) / 3.0;
+    double Drop = pPlantCase->LegDropV;
+
+    Plant.Ia += ((Va - (Drop * (Sa - Sn)) - (pPlantCase->ResistanceOhm * Plant.Ia)) * Dt) / pPlantCase->InductanceH;
+    Plant.Ib += ((Vb - (Drop * (Sb - Sn)) - (pPlantCase->ResistanceOhm * Plant.Ib)) * Dt) / pPlantCase->InductanceH;
+    Plant.Ic = -Plant.Ia - Plant.Ib;
+  }
+}
+
+/* One current control period with the voltage imposed by the procedure */
+static void RunCurrentControlPeriod(void)
+{
+  (void)SCC_SetPhaseVoltage(&Scc);
+
+  /* The voltage set at the sample is applied from the middle of the period */
+  IntegrateHalfPeriod();
+  Plant.ValphaV = Plant.NextValphaV;
+  Plant.VbetaV = Plant.NextVbetaV;
+  IntegrateHalfPeriod();
+}
+
+/* Steady state of the dragged rotor: currents on their references, voltages of the plant */
+static void SetDraggedRotorState(void)
+{
+  double Flux = (pPlantCase->KeVrmsKrpm * SQRT2 / SQRT3) / ((1000.0 * TWO_PI * (double)POLE_PAIR_NUM) / 60.0);
+  double MecSpeed = ((double)Vss._Super.hAvrMecSpeedUnit * TWO_PI) / (double)SPEED_UNIT;
+  double ElSpeed = MecSpeed * (double)POLE_PAIR_NUM;
+  double Iq = (double)FocVars.Iqdref.q / S16_PER_AMP;
+  double SinLoad = (Iq > 0.0) ? ((FRICTION * MecSpeed) / (1.5 * (double)POLE_PAIR_NUM * Flux * Iq)) : 0.0;
+  double CosLoad = sqrt(1.0 - (SinLoad * SinLoad));
+  double VqV = (pPlantCase->ResistanceOhm * Iq) + ((4.0 / M_PI) * pPlantCase->LegDropV) + (ElSpeed * Flux * SinLoad);
+  double VdV = -(ElSpeed * pPlantCase->InductanceH * Iq) - (ElSpeed * Flux * CosLoad);
+  double ToS16 = (SQRT3 * 32768.0) / pPlantCase->BusV;
+
+  FocVars.Iqd = FocVars.Iqdref;
+  FocVars.Vqd.q = (int16_t)lround(VqV * ToS16);
+  FocVars.Vqd.d = (int16_t)lround(VdV * ToS16);
+}
+
+/* Handles of the drive with the parameters of the firmware ------------------*/
+
+static void InitHandles(void)
+{
+  const PID_Handle_t PIDCurrent =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const VirtualSpeedSensor_Handle_t VssInit =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .hSpeedSamplingFreqHz        = MEDIUM_FREQUENCY_TASK_RATE,
+    .hTransitionSteps            = (int16_t)((TF_REGULATION_RATE * TRANSITION_DURATION) / 1000.0),
+  };
+  const SCC_Params_t Params =
+  {
+    .rampExtMngrParams =
+    {
+      .FrequencyHz = MEDIUM_FREQUENCY_TASK_RATE
+    },
+    .fRshunt                 = (float)RSHUNT,
+    .fAmplificationGain      = (float)AMPLIFICATION_GAIN,
+    .fVbusConvFactor         = (float)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+    .fVbusPartitioningFactor = (float)VBUS_PARTITIONING_FACTOR,
+    .fRVNK                   = 1.0f,
+    .fRSMeasCurrLevelMax     = (float)SCC_RS_MEAS_CURRENT_A,
+    .hDutyRampDuration       = SCC_DUTY_RAMP_DURATION,
+    .hAlignmentDuration      = SCC_ALIGNMENT_DURATION,
+    .hRSDetectionDuration    = SCC_RS_DETECTION_DURATION,
+    .fLdLqRatio              = (float)SCC_LD_LQ_RATIO,
+    .fCurrentBW              = (float)SCC_CURRENT_BW_RPS,
+    .bPBCharacterization     = PB_CHARACTERIZATION_DISABLE,
+    .wNominalSpeed           = SCC_NOMINAL_SPEED_RPM,
+    .hPWMFreqHz              = PWM_FREQUENCY,
+    .bFOCRepRate             = REGULATION_EXECUTION_RATE,
+    .fMCUPowerSupply         = (float)ADC_REFERENCE_VOLTAGE,
+    .IThreshold              = (float)SCC_OVERCURRENT_A,
+    .fRSRated                = (float)RS,
+    .fLSRated                = (float)LS,
+    .fKeRated                = (float)MOTOR_VOLTAGE_CONSTANT,
+  };
+
+  memset(&Pwmc, 0, sizeof(Pwmc));
+  Pwmc.pFctGetPhaseCurrents = ReadPhaseCurrents;
+  memset(&Vbs, 0, sizeof(Vbs));
+  Vbs._Super.AvBusVoltage_d = (uint16_t)((pPlantCase->BusV * 65536.0 * VBUS_PARTITIONING_FACTOR)
+                                         / ADC_REFERENCE_VOLTAGE);
+  memset(&FocVars, 0, sizeof(FocVars));
+  memset(&Mci, 0, sizeof(Mci));
+  Vss = VssInit;
+  memset(&Clm, 0, sizeof(Clm));
+  PIDIq = PIDCurrent;
+  PIDId = PIDCurrent;
+  PIDSpeed = PIDCurrent;
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+  PID_HandleInit(&PIDSpeed);
+  memset(&Ruc, 0, sizeof(Ruc));
+  memset(&Sto, 0, sizeof(Sto));
+  Sto._Super.bElToMecRatio = POLE_PAIR_NUM;
+  Sto.hF1 = (int16_t)F1;
+  Sto.hC1 = (int16_t)C1;
+  Sto.hC2 = (int16_t)C2;
+  Sto.hC3 = (int16_t)C3;
+  Sto.hC4 = (int16_t)C4;
+  Sto.hC5 = (int16_t)C5;
+  Sto.hC1Rated = (int16_t)C1;
+  Sto.MinStartUpValidSpeed = OBS_MINIMUM_SPEED_UNIT;
+  Sto.pGainSched = GainSched;
+  Sto.bGainSchedSize = STO_GAIN_SCHED_SIZE;
+  memset(&Stc, 0, sizeof(Stc));
+  Stc.PISpeed = &PIDSpeed;
+  Stc.MaxAppPositiveMecSpeedUnit = (uint16_t)MAX_APPLICATION_SPEED_UNIT;
+  Stc.ModeDefault = MCM_SPEED_MODE;
+  memset(&Ott, 0, sizeof(Ott));
+  SccParams = Params;
+  memset(&Scc, 0, sizeof(Scc));
+  Scc.pPWMC = &Pwmc;
+  Scc.pVBS = &Vbs;
+  Scc.pFOCVars = &FocVars;
+  Scc.pMCI = &Mci;
+  Scc.pVSS = &Vss;
+  Scc.pCLM = &Clm;
+  Scc.pPIDIq = &PIDIq;
+  Scc.pPIDId = &PIDId;
+  Scc.pRevupCtrl = &Ruc;
+  Scc.pSTO = &Sto;
+  Scc.pSTC = &Stc;
+  Scc.pOTT = &Ott;
+  Scc.pSCC_Params_str = &SccParams;
+  memset(&Plant, 0, sizeof(Plant));
+  Plant.Noise = 1U;
+  hFault = MC_NO_FAULTS;
+}
+
+/* Runs the procedure up to the switch over to the observer or up to a fault, returns the seconds it took */
+static double Run(const Case_t *pCase)
+{
+  int Mf;
+
+  pPlantCase = pCase;
+  InitHandles();
+  SCC_Init(&Scc);
+  (void)SCC_Start(&Scc);
+  for (Mf = 0; Mf < MF_PERIODS_MAX; Mf++)
+  {
+    if (true == SCC_IsPhaseVoltageImposed(&Scc))
+    {
+      int Hf;
+
+      for (Hf = 0; Hf < HF_PER_MF; Hf++)
+      {
+        RunCurrentControlPeriod();
+      }
+    }
+    else
+    {
+      SetDraggedRotorState();
+    }
+    SCC_MF(&Scc);
+    if ((MC_NO_FAULTS != hFault)
+        || ((SCC_KE_DETECTING_PHASE == Scc.sm_state) && (KEDET_STABILIZEPLL == Scc.KEDetState)))
+    {
+      break;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return ((double)(Mf + 1) / (double)MEDIUM_FREQUENCY_TASK_RATE);
+}
+
+static double Error(double Measured, double Actual)
+{
+  return ((Measured - Actual) / Actual);
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {"motor parameters",                RS,       LS,       MOTOR_VOLTAGE_CONSTANT,       0.05, 15.0, true},
+    {"R x 1.3, L x 0.8, Ke x 1.2",      RS * 1.3, LS * 0.8, MOTOR_VOLTAGE_CONSTANT * 1.2, 0.05, 15.0, true},
+    {"R x 0.7, L x 1.1, Ke x 1.1",      RS * 0.7, LS * 1.1, MOTOR_VOLTAGE_CONSTANT * 1.1, 0.05, 15.0, true},
+    {"inverter drop 0.3 V",             RS,       LS,       MOTOR_VOLTAGE_CONSTANT,       0.3,  15.0, true},
+    {"bus 24 V",                        RS,       LS,       MOTOR_VOLTAGE_CONSTANT,       0.05, 24.0, true},
+    {"L x 1.5, Ke x 0.8, out of range", RS,       LS * 1.5, MOTOR_VOLTAGE_CONSTANT * 0.8, 0.05, 15.0, false},
+  };
+  int Failures = 0;
+  size_t i;
+
+  printf("Self commissioning on a simulated plant, errors of the measurements\n\n");
+  printf("%-32s %7s %8s %8s %8s %10s %8s  %s\n", "", "time", "R", "L", "Ke", "drop", "C1", "end");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    const Case_t *pCase = &Cases[i];
+    double Seconds = Run(pCase);
+    double C1Actual = ((double)F1 * pCase->ResistanceOhm) / (pCase->InductanceH * (double)TF_REGULATION_RATE);
+    double RError = Error((double)Scc.fRS, pCase->ResistanceOhm);
+    double LError = Error((double)Scc.fLS, pCase->InductanceH);
+    double KeError = Error((double)Scc.fKe, pCase->KeVrmsKrpm);
+    double DropError = (double)Scc.fVdt - ((4.0 / 3.0) * pCase->LegDropV);
+    double C1Error = Error((double)Sto.hC1, C1Actual);
+    bool bSwitchOver = (MC_NO_FAULTS == hFault) && (SCC_KE_DETECTING_PHASE == Scc.sm_state)
+                       && (KEDET_STABILIZEPLL == Scc.KEDetState);
+    bool bRefused = (MC_SW_ERROR == hFault) && (KEDET_SET_OBS_PARAMS == Scc.KEDetState) && (C1 == Sto.hC1);
+    bool bPassed = (fabs(RError) <= RS_TOLERANCE) && (fabs(LError) <= LS_TOLERANCE)
+                   && (fabs(KeError) <= KE_TOLERANCE) && (fabs(DropError) <= VDT_TOLERANCE_V);
+
+    bPassed = bPassed && ((true == pCase->bRetuned) ? (bSwitchOver && (fabs(C1Error) <= C1_TOLERANCE)) : bRefused);
+    printf("%-32s %5.1f s %6.1f %% %6.1f %% %6.1f %% %+7.3f V %6.1f %%  %s%s\n", pCase->pName, Seconds,
+           100.0 * RError, 100.0 * LError, 100.0 * KeError, DropError, 100.0 * C1Error,
+           bSwitchOver ? "switch over" : (bRefused ? "observer out of range" : "aborted"),
+           bPassed ? "" : ", FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nTolerances: R %.0f %%, L %.0f %%, Ke %.0f %%, drop %.2f V, C1 %.0f %%\n", 100.0 * RS_TOLERANCE,
+         100.0 * LS_TOLERANCE, 100.0 * KE_TOLERANCE, VDT_TOLERANCE_V, 100.0 * C1_TOLERANCE);
+  return ((0 == Failures) ? 0 : 1);
+}
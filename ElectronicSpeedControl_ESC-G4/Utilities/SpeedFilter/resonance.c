@@ -0,0 +1,382 @@
+/**
+  ******************************************************************************
+  * @file    resonance.c
+  * @brief   Host test of the Speed Loop Filter on an injected resonance.
+  *
+  * The firmware filters run with the settings of mc_config.c at
+  * MEDIUM_FREQUENCY_TASK_RATE:
+  *
+  * - a vibration of INJECT_UNITS, from INJECT_MIN_HZ to INJECT_MAX_HZ, is
+  *   injected on a constant speed with NOISE_UNITS of noise. The adaptive
+  *   notch must lock within LOCK_MS, on the vibration within FREQ_ERROR_HZ,
+  *   and cut its ripple by RIPPLE_CUT. A vibration of SMALL_UNITS must
+  *   still be followed, the noise alone and a vibration below
+  *   SPD_FLT_ADAPTIVE_MIN_RPM must leave the notch released;
+  * - the speed regulator, STC_CalcTorqueReference with its PI and the
+  *   filters, runs on a two mass model of the rotor and the propeller
+  *   stepped at TF_REGULATION_RATE: a shaft of RESONANCE_HZ and damping
+  *   RESONANCE_ZETA, MOTOR_SIDE_RATIO of MOTOR_INERTIA_KGM2 on the motor
+  *   side, the propeller torque quadratic in the speed, Iq following its
+  *   reference with the time constant of the current loop, and the speed
+  *   measured as the State Observer does it, average of the last
+  *   STO_FIFO_DEPTH_UNIT current control periods. The gains of the speed
+  *   regulator are set for a crossover on the rigid rotor, raised until the
+  *   loop oscillates. Without filter, the resonance must make it oscillate
+  *   below LIMITED_HZ. The adaptive notch, as a fixed notch at the
+  *   resonance, must keep it stable up to CROSSOVER_GAIN times higher;
+  * - the coefficients written as by the Motor Control Protocol are applied
+  *   at the next period without a step of the speed, the unstable ones and
+  *   those of the adaptive stage refused.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: resonance
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "speed_torq_ctrl.h"
+#include "speed_filter.h"
+
+/* Injected vibration, SPEED_UNIT */
+#define SPEED_UNITS             ((6000 * SPEED_UNIT) / U_RPM)
+#define INJECT_UNITS            20.0
+#define SMALL_UNITS             5.0
+#define NOISE_UNITS             1.0
+#define INJECT_MIN_HZ           90.0
+#define INJECT_MAX_HZ           350.0
+#define INJECT_S                2.0
+/* Required of the adaptive notch */
+#define LOCK_MS                 500.0
+#define FREQ_ERROR_HZ           0.5
+#define RIPPLE_CUT              5.0
+/* Resonance of the propeller on its shaft */
+#define RESONANCE_HZ            120.0
+#define RESONANCE_ZETA          0.02
+/* Current loop of the drive, first order */
+#define CURRENT_LOOP_TAU_S      2.0e-4
+/* Propeller torque at the maximum speed, A of Iq */
+#define PROPELLER_IQ_A          ((double)NOMINAL_CURRENT_A)
+/* Closed loop run, the oscillation measured on its last part */
+#define LOOP_S                  3.0
+#define LOOP_MEASURE_S          0.5
+/* Speed regulator of the loop, its integral zero a decade below the crossover of the rigid rotor */
+#define LOOP_KPDIV_LOG          6U
+#define LOOP_KIDIV_LOG          12U
+#define LOOP_ZERO_RATIO         0.1
+/* Share of the inertia on the motor side of the shaft */
+#define MOTOR_SIDE_RATIO        0.3
+/* Torque reference peak to peak of a stable loop, A */
+#define STABLE_IQ_A             2.0
+/* Crossover reached without filter and with the notches */
+#define LIMITED_HZ              10.0
+#define CROSSOVER_GAIN          4.0
+
+#define TWO_PI                  6.283185307179586
+
+/* Filters of mc_config.c */
+static const SPDFLT_Handle_t FilterConfig =
+{
+  .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .fSpeedNotch_Hz    = (float_t)SPD_FLT_NOTCH_HZ,
+  .fSpeedLowPass_Hz  = (float_t)SPD_FLT_SPEED_LPF_HZ,
+  .fTorqueLowPass_Hz = (float_t)SPD_FLT_TORQUE_LPF_HZ,
+  .fNotchQ           = (float_t)SPD_FLT_NOTCH_Q,
+  .bAdaptive         = true,
+  .fAdaptMin_Hz      = (float_t)SPD_FLT_ADAPTIVE_MIN_HZ,
+  .fAdaptMax_Hz      = (float_t)SPD_FLT_ADAPTIVE_MAX_HZ,
+  .fAdaptMinPower    = (float_t)SPD_FLT_ADAPTIVE_MIN_POWER,
+  .fAdaptStep        = (float_t)SPD_FLT_ADAPTIVE_STEP,
+};
+
+static uint32_t Seed = 1U;
+
+/* Uniform in [-Range, Range] */
+static double Noise(double Range)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Range * ((2.0 * (double)(Seed >> 8) / 16777216.0) - 1.0));
+}
+
+typedef struct
+{
+  double LockMs;                           /* Last lock of the notch, -1 if not locked at the end */
+  double FreqHz;                           /* Frequency of the notch at the end */
+  double RippleIn;                         /* Ripple of the speed, RMS over the last second */
+  double RippleOut;
+} Inject_t;
+
+/* Vibration of an amplitude and a frequency on a constant speed */
+static Inject_t Inject(double Units, double FreqHz)
+{
+  SPDFLT_Handle_t Filter = FilterConfig;
+  const double Fs = (double)MEDIUM_FREQUENCY_TASK_RATE;
+  const int Periods = (int)(INJECT_S * Fs);
+  Inject_t Result = {-1.0, 0.0, 0.0, 0.0};
+  bool bLocked = false;
+  int k;
+
+  SPDFLT_Init(&Filter);
+  for (k = 0; k < Periods; k++)
+  {
+    double Vibration = (Units * sin((TWO_PI * FreqHz * (double)k) / Fs)) + Noise(NOISE_UNITS);
+    int16_t hIn = (int16_t)lrint((double)SPEED_UNITS + Vibration);
+    int16_t hOut = SPDFLT_FilterSpeed(&Filter, hIn);
+
+    if (Filter.bLocked != bLocked)
+    {
+      Result.LockMs = (true == Filter.bLocked) ? ((1000.0 * (double)k) / Fs) : -1.0;
+      bLocked = Filter.bLocked;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (k >= (Periods - (int)Fs))
+    {
+      Result.RippleIn += ((double)hIn - SPEED_UNITS) * ((double)hIn - SPEED_UNITS) / Fs;
+      Result.RippleOut += ((double)hOut - SPEED_UNITS) * ((double)hOut - SPEED_UNITS) / Fs;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  Result.FreqHz = (double)SPDFLT_GetNotchFrequency(&Filter);
+  Result.RippleIn = sqrt(Result.RippleIn);
+  Result.RippleOut = sqrt(Result.RippleOut);
+  return (Result);
+}
+
+/* Filters of the speed loop */
+typedef enum
+{
+  LOOP_NO_FILTER = 0,
+  LOOP_ADAPTIVE,
+  LOOP_FIXED_NOTCH
+} Loop_t;
+
+/* Torque reference peak to peak at the end of a run of the speed loop at 6000 rpm, A, the gains of the
+   speed regulator giving a crossover on the rigid rotor */
+static double RunLoop(Loop_t Filtering, double CrossoverHz)
+{
+  const double Kt = 1.5 * POLE_PAIR_NUM * HSO_FLUX_WB;                 /* N.m/A */
+  const double Jm = MOTOR_SIDE_RATIO * MOTOR_INERTIA_KGM2;
+  const double Jl = (1.0 - MOTOR_SIDE_RATIO) * MOTOR_INERTIA_KGM2;
+  const double Kp = (MOTOR_INERTIA_KGM2 * TWO_PI * CrossoverHz * CURRENT_CONV_FACTOR * TWO_PI) / (Kt * SPEED_UNIT);
+  const double Ki = (Kp * LOOP_ZERO_RATIO * TWO_PI * CrossoverHz) / (double)MEDIUM_FREQUENCY_TASK_RATE;
+  const double Mu = (Jm * Jl) / (Jm + Jl);
+  const double Wr = TWO_PI * RESONANCE_HZ;
+  const double K = Wr * Wr * Mu;
+  const double C = 2.0 * RESONANCE_ZETA * Wr * Mu;
+  const double Wmax = (MAX_APPLICATION_SPEED_RPM * TWO_PI) / 60.0;
+  const double Kprop = (Kt * PROPELLER_IQ_A) / (Wmax * Wmax);
+  const double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  const int Ratio = TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE;
+  const int Steps = (int)(LOOP_S / Ts);
+  const int MeasureAt = (int)((LOOP_S - LOOP_MEASURE_S) / Ts);
+  double SpeedBuffer[STO_FIFO_DEPTH_UNIT];
+  double W = (6000.0 * TWO_PI) / 60.0;
+  double Wm = W;
+  double Wl = W;
+  double Twist;
+  double Iq;
+  double IqRef;
+  double IqMin = 1.0e9;
+  double IqMax = -1.0e9;
+  SPDFLT_Handle_t Filter = FilterConfig;
+  int i;
+
+  PID_Handle_t PISpeed =
+  {
+    .hDefKpGain          = (int16_t)lrint(Kp * (double)(1U << LOOP_KPDIV_LOG)),
+    .hDefKiGain          = (int16_t)lrint(Ki * (double)(1U << LOOP_KIDIV_LOG)),
+    .wUpperIntegralLimit = (int32_t)(IQMAX << LOOP_KIDIV_LOG),
+    .wLowerIntegralLimit = -(int32_t)(IQMAX << LOOP_KIDIV_LOG),
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)(1U << LOOP_KPDIV_LOG),
+    .hKiDivisor          = (uint16_t)(1U << LOOP_KIDIV_LOG),
+    .hKpDivisorPOW2      = (uint16_t)LOOP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)LOOP_KIDIV_LOG,
+  };
+  SpeednPosFdbk_Handle_t Sensor = {0};
+  SpeednTorqCtrl_Handle_t STC =
+  {
+    .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+    .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
+    .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .MaxPositiveTorque          = (int16_t)NOMINAL_CURRENT,
+    .MinNegativeTorque          = -(int16_t)NOMINAL_CURRENT,
+    .ModeDefault                = MCM_SPEED_MODE,
+    .MecSpeedRefUnitDefault     = (int16_t)SPEED_UNITS,
+    .SpeedFilter                = (LOOP_NO_FILTER == Filtering) ? MC_NULL : &Filter,
+    .LoadObserver               = MC_NULL,
+  };
+
+  Filter.bAdaptive = (LOOP_ADAPTIVE == Filtering) ? true : false;
+  Filter.fSpeedNotch_Hz = (LOOP_FIXED_NOTCH == Filtering) ? (float_t)RESONANCE_HZ : 0.0f;
+  SPDFLT_Init(&Filter);
+  PID_HandleInit(&PISpeed);
+  STC_Init(&STC, &PISpeed, &Sensor);
+
+  /* Steady state at the reference, the propeller torque held by the integral term and twisting the shaft */
+  IqRef = (Kprop * W * W) / Kt;
+  Iq = IqRef;
+  Twist = (Kprop * W * W) / K;
+  PID_SetIntegralTerm(&PISpeed, (int32_t)(Iq * CURRENT_CONV_FACTOR * (double)(1U << LOOP_KIDIV_LOG)));
+  for (i = 0; i < STO_FIFO_DEPTH_UNIT; i++)
+  {
+    SpeedBuffer[i] = W;
+  }
+  Sensor.hAvrMecSpeedUnit = (int16_t)SPEED_UNITS;
+
+  for (i = 0; i < Steps; i++)
+  {
+    double Shaft;
+    double Sum = 0.0;
+    int k;
+
+    if (0 == (i % Ratio))
+    {
+      IqRef = (double)STC_CalcTorqueReference(&STC) / CURRENT_CONV_FACTOR;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Iq += (IqRef - Iq) * (Ts / CURRENT_LOOP_TAU_S);
+    Shaft = (K * Twist) + (C * (Wm - Wl));
+    Wm += ((Kt * Iq) - Shaft) * (Ts / Jm);
+    Wl += (Shaft - (Kprop * Wl * Wl)) * (Ts / Jl);
+    Twist += (Wm - Wl) * Ts;
+
+    SpeedBuffer[i % STO_FIFO_DEPTH_UNIT] = Wm;
+    for (k = 0; k < STO_FIFO_DEPTH_UNIT; k++)
+    {
+      Sum += SpeedBuffer[k];
+    }
+    Sensor.hAvrMecSpeedUnit = (int16_t)lrint((((Sum / STO_FIFO_DEPTH_UNIT) * 60.0 / TWO_PI) * SPEED_UNIT / U_RPM)
+                                             + Noise(NOISE_UNITS));
+    if (i >= MeasureAt)
+    {
+      IqMin = (IqRef < IqMin) ? IqRef : IqMin;
+      IqMax = (IqRef > IqMax) ? IqRef : IqMax;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (IqMax - IqMin);
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+int main(void)
+{
+  static const double Crossovers[] = {5.0, 10.0, 15.0, 20.0, 25.0, 30.0, 40.0};
+  static const char *pLoops[] = {"no filter", "adaptive notch", "fixed notch"};
+  bool bLocked = true;
+  bool bMismatch = false;
+  bool bCut = true;
+  double Freq;
+  Inject_t Result;
+  double Stable[3] = {0.0, 0.0, 0.0};
+  unsigned int i;
+  unsigned int k;
+
+  /* Injected vibration */
+  printf("Vibration of %.0f units on %d units, noise %.0f units\n", INJECT_UNITS, SPEED_UNITS, NOISE_UNITS);
+  printf("%10s %10s %12s %16s\n", "Hz", "lock, ms", "notch, Hz", "ripple in, out");
+  for (Freq = INJECT_MIN_HZ; Freq <= INJECT_MAX_HZ; Freq += 20.0)
+  {
+    Result = Inject(INJECT_UNITS, Freq);
+    printf("%10.0f %10.0f %12.2f %8.1f %7.1f\n", Freq, Result.LockMs, Result.FreqHz, Result.RippleIn, Result.RippleOut);
+    bLocked = bLocked && (Result.LockMs >= 0.0) && (Result.LockMs <= LOCK_MS);
+    bMismatch = bMismatch || (fabs(Result.FreqHz - Freq) > FREQ_ERROR_HZ);
+    bCut = bCut && ((RIPPLE_CUT * Result.RippleOut) <= Result.RippleIn);
+  }
+  Check("adaptive notch locked on the vibration within LOCK_MS", bLocked);
+  Check("adaptive notch on the vibration within FREQ_ERROR_HZ", !bMismatch);
+  Check("ripple of the vibration cut by RIPPLE_CUT", bCut);
+
+  Result = Inject(SMALL_UNITS, RESONANCE_HZ);
+  printf("%.0f units at %.0f Hz: notch at %.2f Hz\n", SMALL_UNITS, RESONANCE_HZ, Result.FreqHz);
+  Check("small vibration followed", (Result.LockMs >= 0.0) && (fabs(Result.FreqHz - RESONANCE_HZ) <= FREQ_ERROR_HZ));
+  Result = Inject(0.0, RESONANCE_HZ);
+  Check("noise alone: notch released", (Result.LockMs < 0.0) && (0.0 == Result.FreqHz));
+  Result = Inject(0.5 * SPD_FLT_ADAPTIVE_MIN_UNIT, RESONANCE_HZ);
+  Check("vibration below SPD_FLT_ADAPTIVE_MIN_RPM: notch released", (Result.LockMs < 0.0));
+
+  /* Speed loop on the resonance */
+  printf("\nSpeed loop at 6000 rpm, resonance at %.0f Hz: Iq reference peak to peak, A\n", RESONANCE_HZ);
+  printf("%16s", "crossover, Hz");
+  for (k = 0U; k < (sizeof(Crossovers) / sizeof(Crossovers[0])); k++)
+  {
+    printf(" %8.2f", Crossovers[k]);
+  }
+  printf("\n");
+  for (i = 0U; i < 3U; i++)
+  {
+    printf("%16s", pLoops[i]);
+    for (k = 0U; k < (sizeof(Crossovers) / sizeof(Crossovers[0])); k++)
+    {
+      double PeakToPeak = RunLoop((Loop_t)i, Crossovers[k]);
+
+      printf(" %8.3f", PeakToPeak);
+      Stable[i] = ((PeakToPeak < STABLE_IQ_A) && (Stable[i] == (k > 0U ? Crossovers[k - 1U] : 0.0)))
+                  ? Crossovers[k] : Stable[i];
+    }
+    printf("\n");
+  }
+  printf("largest stable crossover: %.0f Hz without filter, %.0f Hz with the adaptive notch\n",
+         Stable[LOOP_NO_FILTER], Stable[LOOP_ADAPTIVE]);
+  Check("without filter: the resonance makes the loop oscillate", Stable[LOOP_NO_FILTER] < LIMITED_HZ);
+  Check("adaptive notch: stable to CROSSOVER_GAIN times the crossover",
+        Stable[LOOP_ADAPTIVE] >= (CROSSOVER_GAIN * Stable[LOOP_NO_FILTER]));
+  Check("fixed notch: stable to CROSSOVER_GAIN times the crossover",
+        Stable[LOOP_FIXED_NOTCH] >= (CROSSOVER_GAIN * Stable[LOOP_NO_FILTER]));
+
+  /* Coefficients of the Motor Control Protocol */
+  {
+    SPDFLT_Handle_t Filter = FilterConfig;
+    float_t fNotch[SPDFLT_COEFF_NBR];
+    float_t fRead[SPDFLT_COEFF_NBR];
+    float_t fUnstable[SPDFLT_COEFF_NBR] = {1.0f, 0.0f, 0.0f, 1.2f, -0.1f};
+    bool bApplied;
+    bool bSmooth = true;
+    int16_t hOut;
+
+    SPDFLT_Init(&Filter);
+    hOut = SPDFLT_FilterSpeed(&Filter, (int16_t)SPEED_UNITS);
+    bSmooth = (SPEED_UNITS == hOut);
+    SPDFLT_DesignNotch(fNotch, 200.0f, 2.0f, (float_t)MEDIUM_FREQUENCY_TASK_RATE);
+    bApplied = SPDFLT_SetCoefficients(&Filter, SPDFLT_SPEED, 1U, fNotch)
+               && (false == SPDFLT_SetCoefficients(&Filter, SPDFLT_SPEED, 2U, fNotch));
+    (void)SPDFLT_GetCoefficients(&Filter, SPDFLT_SPEED, 1U, fRead);
+    bApplied = bApplied && (1.0f == fRead[0]);
+    hOut = SPDFLT_FilterSpeed(&Filter, (int16_t)SPEED_UNITS);
+    bSmooth = bSmooth && (SPEED_UNITS == hOut);
+    (void)SPDFLT_GetCoefficients(&Filter, SPDFLT_SPEED, 1U, fRead);
+    for (k = 0U; k < SPDFLT_COEFF_NBR; k++)
+    {
+      bApplied = bApplied && (fRead[k] == fNotch[k]);
+    }
+    Check("coefficients applied at the next period, without step", bApplied && bSmooth);
+    Check("unstable coefficients and adaptive stage refused",
+          (false == SPDFLT_SetCoefficients(&Filter, SPDFLT_TORQUE, 0U, fUnstable))
+          && (false == SPDFLT_SetCoefficients(&Filter, SPDFLT_SPEED, SPDFLT_ADAPTIVE_STAGE, fNotch))
+          && (false == SPDFLT_SetCoefficients(&Filter, SPDFLT_SPEED, SPDFLT_STAGE_NBR, fNotch)));
+  }
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,214 @@
+/**
+  ******************************************************************************
+  * @file    otf_restart.c
+  * @brief   Host test of the on-the-fly start: restart time of a rotor found
+  *          spinning by the start command, at various speeds.
+  *
+  * The start command enters OTF_DETECTION: the State Observer watches the
+  * rotor with null currents and RUC_OTF_Detect either catches it, the drive
+  * entering RUN at once, or falls back to the rev-up at the end of the
+  * window. The motor of startup_model.c turns at the speed of the case,
+  * held by the airflow or slowing down in still air, and the drive is
+  * commanded to its initial speed, or to a speed it can hold in still air:
+  *
+  * - above OBS_MINIMUM_SPEED_RPM, in the commanded direction, the rotor must
+  *   be caught within the window, its angle followed in RUN, the speed back
+  *   within SETTLED_BAND of the command, and the torque current must not
+  *   brake the rotor by more than JOLT_A;
+  * - at standstill, below the minimum speed or in reverse, the drive must
+  *   fall back at the end of the window.
+  *
+  * The bridge switched on over the Bemf of a spinning rotor draws a current
+  * the regulators only cancel once the observer follows the rotor: during
+  * the detection the currents must stay below the peak of a short circuit
+  * of the windings at the speed of the case, SHORT_CIRCUIT_PEAK times its
+  * steady amplitude, and at least FLOOR_A. The program returns 1 when a case
+  * does not behave as expected.
+  *
+  * Usage: otf_restart
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "startup_model.h"
+
+/* Simulated time of each case, s: without the load torque observer, the speed regulator takes seconds to bring
+   a rotor slowed down in still air back to the command */
+#define RUN_S                   15.0
+/* Electrical angle of the rotor at the start command, degrees */
+#define START_ANGLE_DEG         37.0
+/* Transient peak of a short circuit of the windings over its steady amplitude */
+#define SHORT_CIRCUIT_PEAK      2.0
+/* Smallest limit of the current during the detection, A */
+#define FLOOR_A                 1.0
+/* Largest error of the angle in RUN, electrical degrees */
+#define LOCKED_DEG              30.0
+/* Largest braking torque current in RUN, A */
+#define JOLT_A                  1.0
+/* Speed error of a settled drive, relative */
+#define SETTLED_BAND            0.02
+
+typedef struct
+{
+  const char *pName;
+  double SpeedRpm;                         /* At the start command */
+  double WindRpm;                          /* Speed the airflow turns the propeller at */
+  double CommandRpm;
+  bool bCaught;                            /* Expected */
+} Case_t;
+
+typedef struct
+{
+  double CatchMs;                          /* RUN entered, < 0 if not */
+  double FallbackMs;                       /* ALIGNMENT or START entered, < 0 if not */
+  double SettledMs;                        /* Last entry in the speed band, < 0 if not settled */
+  double CatchRpm;
+  double DetectionPeakA;
+  double MaxErrorDeg;
+  double MinIqA;
+  bool bFault;
+} Result_t;
+
+/* Largest current allowed during the detection, A */
+static double DetectionLimitA(double SpeedRpm)
+{
+  double OmegaEl = (fabs(SpeedRpm) * POLE_PAIR_NUM * 6.283185307179586) / 60.0;
+  double SteadyA = (OmegaEl * HSO_FLUX_WB) / hypot(RS, OmegaEl * LS);
+
+  return (fmax(SHORT_CIRCUIT_PEAK * SteadyA, FLOOR_A));
+}
+
+static Result_t Run(const Case_t *pCase)
+{
+  const Mechanics_t Mechanics = {MOTOR_INERTIA_KGM2, pCase->WindRpm};
+  Result_t Result = {-1.0, -1.0, -1.0, 0.0, 0.0, 0.0, 0.0, false};
+  int Mf;
+
+  Model_Init(&Mechanics, pCase->SpeedRpm, START_ANGLE_DEG);
+  Model_Start(pCase->CommandRpm, 0U);
+  for (Mf = 0; Mf < (int)(RUN_S * MEDIUM_FREQUENCY_TASK_RATE); Mf++)
+  {
+    MCI_State_t Previous = State;
+
+    Model_RunMF();
+    if (OTF_DETECTION == Previous)
+    {
+      Result.DetectionPeakA = fmax(Result.DetectionPeakA, Model_GetPeakCurrentA());
+    }
+    else if (RUN == Previous)
+    {
+      double Error = fabs(Model_GetSpeedRpm() - pCase->CommandRpm);
+
+      Result.MaxErrorDeg = fmax(Result.MaxErrorDeg, fabs(Model_GetAngleErrorDeg()));
+      Result.MinIqA = fmin(Result.MinIqA, Model_GetMinIqA());
+      if (Error > (SETTLED_BAND * fabs(pCase->CommandRpm)))
+      {
+        Result.SettledMs = -1.0;
+      }
+      else if (Result.SettledMs < 0.0)
+      {
+        Result.SettledMs = 1000.0 * Model_GetTime();
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if ((RUN == State) && (OTF_DETECTION == Previous))
+    {
+      Result.CatchMs = 1000.0 * Model_GetTime();
+      Result.CatchRpm = Model_GetSpeedRpm();
+    }
+    else if ((ALIGNMENT == State) || (START == State))
+    {
+      Result.FallbackMs = 1000.0 * Model_GetTime();
+      break;
+    }
+    else if (FAULT_NOW == State)
+    {
+      Result.bFault = true;
+      break;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (Result);
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {"standstill",                  0.0,      0.0,     5000.0, false},
+    {"slowing down, below minimum", 2500.0,   0.0,     2500.0, false},
+    {"windmilling in reverse",      -5000.0,  -5000.0, 5000.0, false},
+    {"windmilling",                 4500.0,   4500.0,  4500.0, true},
+    {"windmilling",                 7000.0,   7000.0,  7000.0, true},
+    {"windmilling, maximum speed",  MAX_APPLICATION_SPEED_RPM, MAX_APPLICATION_SPEED_RPM, MAX_APPLICATION_SPEED_RPM,
+     true},
+    {"slowing down",                7000.0,   0.0,     7000.0, true},
+    {"slowing down, maximum speed", MAX_APPLICATION_SPEED_RPM, 0.0, 8000.0,   true},
+  };
+  int Failures = 0;
+  size_t i;
+
+  printf("On-the-fly start, window %d ms, minimum speed %d rpm\n\n", OTF_DETECTION_DURATION, OBS_MINIMUM_SPEED_RPM);
+  printf("%-28s %6s %7s %7s %8s %8s %8s %9s %8s %8s  %s\n", "", "rpm", "peak A", "limit", "catch", "at rpm", "settled",
+         "angle", "min iq", "fallback", "");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    const Case_t *pCase = &Cases[i];
+    Result_t Result = Run(pCase);
+    double LimitA = DetectionLimitA(pCase->SpeedRpm);
+    bool bPassed = (false == Result.bFault) && (Result.DetectionPeakA < LimitA);
+
+    if (true == pCase->bCaught)
+    {
+      bPassed = bPassed && (Result.CatchMs >= 0.0) && (Result.CatchMs < (double)OTF_DETECTION_DURATION)
+                && (Result.SettledMs >= 0.0) && (Result.MaxErrorDeg < LOCKED_DEG) && (Result.MinIqA > -JOLT_A);
+    }
+    else
+    {
+      bPassed = bPassed && (Result.CatchMs < 0.0)
+                && (fabs(Result.FallbackMs - (double)OTF_DETECTION_DURATION) <= 2.0);
+    }
+    printf("%-28s %6.0f %7.2f %7.2f ", pCase->pName, pCase->SpeedRpm, Result.DetectionPeakA, LimitA);
+    if (Result.CatchMs >= 0.0)
+    {
+      printf("%5.0f ms %8.0f ", Result.CatchMs, Result.CatchRpm);
+      if (Result.SettledMs >= 0.0)
+      {
+        printf("%5.0f ms ", Result.SettledMs);
+      }
+      else
+      {
+        printf("%8s ", "no");
+      }
+      printf("%7.1f deg %6.2f A %8s", Result.MaxErrorDeg, Result.MinIqA, "");
+    }
+    else
+    {
+      printf("%8s %8s %8s %9s %8s ", "", "", "", "", "");
+      if (Result.FallbackMs >= 0.0)
+      {
+        printf("%5.0f ms", Result.FallbackMs);
+      }
+      else
+      {
+        printf("%8s", "none");
+      }
+    }
+    printf("  %s%s\n", (true == Result.bFault) ? "speed feedback fault, " : "", bPassed ? "ok" : "FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nLimits: angle error %.0f deg, braking current %.1f A, settled within %.0f %%\n", LOCKED_DEG, JOLT_A, 100.0 * SETTLED_BAND);
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    revup_time.c
+  * @brief   Host benchmark of the adaptive rev-up: time from the start command
+  *          to the closed loop at various load inertias.
+  *
+  * The rotor of startup_model.c is at standstill in still air: the drive
+  * goes through the on-the-fly detection window, then the rev-up of the
+  * virtual speed sensor until the State Observer converges and the drive
+  * switches over to RUN. Each inertia, from the motor alone to a large
+  * propeller, is started with the programmed profile and with the adaptive
+  * acceleration of RUC_AdaptAcceleration:
+  *
+  * - the rotor must be within HELD_BAND of the command HOLD_S after RUN is
+  *   entered: an observer following the forced current of a stalled rotor
+  *   would reach RUN too;
+  * - the adaptive rev-up must start every rotor the programmed profile
+  *   starts, never later than the programmed one, and at least SPEED_UP
+  *   times faster with the motor alone;
+  * - a rotor the programmed profile cannot start must end in a fault with
+  *   the adaptive rev-up. The programmed profile may switch over on an
+  *   observer that follows the forced current of the stalled rotor.
+  *
+  * The program returns 1 when a case does not behave as expected.
+  *
+  * Usage: revup_time
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "startup_model.h"
+
+/* Speed commanded at the start, rpm */
+#define COMMAND_RPM             5000.0
+/* Longest simulated time of a start, s: a restarted rev-up and a margin */
+#define RUN_S                   20.0
+/* Smallest gain of the adaptive rev-up on the motor alone: the programmed
+   profile runs until the observer sees the rotor, at half its minimum speed */
+#define SPEED_UP                1.5
+/* Time in RUN before the speed is checked, s: without the load torque observer, the speed regulator takes
+   seconds to bring a large propeller to the command in still air */
+#define HOLD_S                  8.0
+/* Speed error HOLD_S after RUN, relative: the speed loop still settles */
+#define HELD_BAND               0.2
+
+typedef struct
+{
+  double RunMs;                            /* RUN entered, < 0 if not */
+  double StartMs;                          /* START entered, < 0 if not */
+  double SwitchOverRpm;
+  double HeldRpm;                          /* HOLD_S after RUN entered */
+  bool bFault;
+} Result_t;
+
+static Result_t Run(double InertiaKgm2, bool bAdaptive)
+{
+  const Mechanics_t Mechanics = {InertiaKgm2, 0.0};
+  Result_t Result = {-1.0, -1.0, 0.0, 0.0, false};
+  int Mf;
+
+  Model_Init(&Mechanics, 0.0, 0.0);
+  Ruc.AdaptiveEnabled = bAdaptive;
+  Model_Start(COMMAND_RPM, 0U);
+  for (Mf = 0; Mf < (int)((RUN_S + HOLD_S) * MEDIUM_FREQUENCY_TASK_RATE); Mf++)
+  {
+    MCI_State_t Previous = State;
+
+    Model_RunMF();
+    if ((START == State) && (START != Previous))
+    {
+      Result.StartMs = 1000.0 * Model_GetTime();
+    }
+    else if (SWITCH_OVER == State)
+    {
+      Result.SwitchOverRpm = Model_GetSpeedRpm();
+    }
+    else if ((RUN == State) && (RUN != Previous))
+    {
+      Result.RunMs = 1000.0 * Model_GetTime();
+    }
+    else if ((RUN == State) && (Model_GetTime() >= ((0.001 * Result.RunMs) + HOLD_S)))
+    {
+      Result.HeldRpm = Model_GetSpeedRpm();
+      break;
+    }
+    else if (FAULT_NOW == State)
+    {
+      Result.bFault = true;
+      break;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (Result);
+}
+
+/* RUN reached and the command held */
+static bool IsStarted(const Result_t *pResult)
+{
+  return ((false == pResult->bFault) && (pResult->RunMs >= 0.0)
+          && (fabs(pResult->HeldRpm - COMMAND_RPM) <= (HELD_BAND * COMMAND_RPM)));
+}
+
+static void PrintResult(const Result_t *pResult)
+{
+  if (pResult->RunMs >= 0.0)
+  {
+    printf("  %7.0f ms %7.0f ms %6.0f %6.0f", pResult->RunMs, pResult->RunMs - pResult->StartMs,
+           pResult->SwitchOverRpm, pResult->HeldRpm);
+  }
+  else
+  {
+    printf("  %10s %10s %6s %6s", pResult->bFault ? "fault" : "none", "", "", "");
+  }
+}
+
+int main(void)
+{
+  const double Inertias[] = {1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0};
+  int Failures = 0;
+  size_t i;
+
+  printf("Rev-up to %.0f rpm in still air, programmed acceleration stage %d ms, adaptive from %d ms\n\n",
+         COMMAND_RPM, PHASE2_DURATION, ADAPTIVE_REVUP_MIN_DURATION);
+  printf("%-14s  %-36s  %-36s\n", "inertia", "programmed", "adaptive");
+  printf("%-14s  %10s %10s %6s %6s  %10s %10s %6s %6s\n", "x motor", "to RUN", "rev-up", "rpm", "held",
+         "to RUN", "rev-up", "rpm", "held");
+  for (i = 0; i < (sizeof(Inertias) / sizeof(Inertias[0])); i++)
+  {
+    Result_t Programmed = Run(Inertias[i] * MOTOR_INERTIA_KGM2, false);
+    Result_t Adaptive = Run(Inertias[i] * MOTOR_INERTIA_KGM2, true);
+    bool bPassed;
+
+    if (false == IsStarted(&Programmed))
+    {
+      bPassed = (true == Adaptive.bFault);
+    }
+    else if (0U == i)
+    {
+      bPassed = IsStarted(&Adaptive)
+                && ((Programmed.RunMs - Programmed.StartMs) >= (SPEED_UP * (Adaptive.RunMs - Adaptive.StartMs)));
+    }
+    else
+    {
+      bPassed = IsStarted(&Adaptive) && (Adaptive.RunMs <= Programmed.RunMs);
+    }
+    printf("%-14.0f", Inertias[i]);
+    PrintResult(&Programmed);
+    PrintResult(&Adaptive);
+    printf("  %s\n", bPassed ? "ok" : "FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nTo RUN from the start command, rev-up from the START state, speed at the switch over and %.0f s later\n",
+         HOLD_S);
+  return ((0 == Failures) ? 0 : 1);
+}
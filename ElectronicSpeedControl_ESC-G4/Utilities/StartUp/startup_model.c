@@ -0,0 +1,911 @@
+/**
+  ******************************************************************************
+  * @file    startup_model.c
+  * @brief   Host model of the start-up of Motor 1.
+  *
+  * The firmware State Observer + PLL, virtual speed sensor, rev-up controller,
+  * speed and torque controller with its filters and load observer, current
+  * regulators and circle limitation, run as FOC_HighFrequencyTaskM1 and
+  * TSK_MediumFrequencyTaskM1 run them, drive a model of the motor:
+  *
+  * - windings integrated in the alpha beta frame within each period, the
+  *   voltage set at a sample applied during the next period, no current
+  *   with the PWM off, the Bemf of the rotor below the bus voltage;
+  * - currents read by 12 bits converters, saturated at their full scale,
+  *   with a gaussian noise of NOISE_LSB, the bus at its nominal voltage;
+  * - rotor and propeller of the given inertia, with the viscous friction of
+  *   the motor. The propeller torque is that of step_load.c, nominal current
+  *   at the maximum speed, and vanishes at the speed the airflow turns it at.
+  *
+  * The transforms and the current regulators are those of foc_pipeline.h,
+  * the sine and cosine of the CORDIC computed in floating point.
+  * With POLPULSE_ENABLE, the pulse injection is ideal: the ALIGNMENT state
+  * finds the rotor position at once.
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include <math.h>
+#include "startup_model.h"
+#include "circle_limitation.h"
+#include "ramp_ext_mngr.h"
+#include "foc_pipeline.h"
+
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#define NOISE_LSB               2.0
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define DEG_PER_S16             (360.0 / 65536.0)
+
+typedef struct
+{
+  double Ialpha;                           /* Phase currents, alpha beta, A */
+  double Ibeta;
+  double ValphaV;                          /* Voltage applied during the period, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad, 0 when the d axis is on beta */
+  double Omega;                            /* Mechanical speed, rad/s */
+  double PeakA;                            /* Largest current amplitude of the medium frequency period */
+  double MinIqA;                           /* Lowest torque current of the medium frequency period */
+  bool bPwmOn;
+  uint32_t Noise;
+  uint32_t Periods;                        /* Current control periods since the start */
+} Plant_t;
+
+STO_PLL_Handle_t Sto;
+VirtualSpeedSensor_Handle_t Vss;
+RevUpCtrl_Handle_t Ruc;
+SpeednTorqCtrl_Handle_t Stc;
+FOCVars_t FocVars;
+MCI_State_t State;
+
+static Plant_t Plant;
+static Mechanics_t Mechanics;
+static STO_Handle_t StoIf;
+static PWMC_Handle_t Pwmc;
+static PID_Handle_t PIDSpeed;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static CircleLimitation_Handle_t Clm;
+static RampExtMngr_Handle_t Remng;
+static SPDFLT_Handle_t SpeedFilter;
+static LTO_Handle_t LoadObserver;
+static int16_t hCommandSpeedUnit;
+static uint16_t hCommandDurationms;
+static int16_t hDirection;
+static bool bCommandPending;
+
+/* Schedule of mc_config.c */
+static const STO_PLL_GainSchedPoint_t GainSched[STO_GAIN_SCHED_SIZE] =
+{
+  {
+    .hMecSpeedUnit = STO_GS_SPEED1_UNIT,
+    .hC2           = C2,
+    .hC4           = C4,
+    .hPLLKpGain    = PLL_KP_GAIN,
+    .hPLLKiGain    = PLL_KI_GAIN,
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED2_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED2_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED2_RPM),
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED3_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED3_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED3_RPM),
+  },
+};
+
+/* The CORDIC of the target, computed in floating point */
+Trig_Components MCM_Trig_Functions(int16_t hAngle)
+{
+  Trig_Components Components;
+  double Angle = ((double)hAngle * TWO_PI) / 65536.0;
+
+  Components.hCos = (int16_t)lround(32767.0 * cos(Angle));
+  Components.hSin = (int16_t)lround(32767.0 * sin(Angle));
+  return (Components);
+}
+
+int32_t MCM_Sqrt(int32_t wInput)
+{
+  return ((wInput > 0) ? (int32_t)sqrt((double)wInput) : 0);
+}
+
+/* Power stage, only recording what the plant needs ---------------------------*/
+
+uint16_t PWMC_SetPhaseVoltage(PWMC_Handle_t *pHandle, alphabeta_t Valfa_beta)
+{
+  Plant.NextValphaV = ((double)Valfa_beta.alpha * NOMINAL_BUS_VOLTAGE_V) / (SQRT3 * 32768.0);
+  Plant.NextVbetaV = ((double)Valfa_beta.beta * NOMINAL_BUS_VOLTAGE_V) / (SQRT3 * 32768.0);
+  return (MC_NO_ERROR);
+}
+
+void PWMC_SwitchOffPWM(PWMC_Handle_t *pHandle)
+{
+  Plant.bPwmOn = false;
+}
+
+void PWMC_SwitchOnPWM(PWMC_Handle_t *pHandle)
+{
+  /* Null voltage up to the first update */
+  Plant.bPwmOn = true;
+  Plant.NextValphaV = 0.0;
+  Plant.NextVbetaV = 0.0;
+}
+
+/* Braking of RUC_OTF_Exec, not run by the model */
+void PWMC_TurnOnLowSides(PWMC_Handle_t *pHandle, uint32_t ticks)
+{
+}
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+/* Phase currents of the alpha beta ones, in the frame of MCM_Clarke: beta is -(a + 2 b) / sqrt(3) */
+static ab_t ReadPhaseCurrents(void)
+{
+  ab_t Iab;
+
+  Iab.a = ReadCurrent(Plant.Ialpha);
+  Iab.b = ReadCurrent((-0.5 * Plant.Ialpha) - ((SQRT3 / 2.0) * Plant.Ibeta));
+  return (Iab);
+}
+
+/* Integrates the motor over one current control period */
+static void IntegratePeriod(void)
+{
+  const double Dt = 1.0 / ((double)TF_REGULATION_RATE * (double)SUB_STEPS);
+  const double Flux = HSO_FLUX_WB;
+  const double Kt = 1.5 * POLE_PAIR_NUM * Flux;
+  const double Wmax = (MAX_APPLICATION_SPEED_RPM * TWO_PI) / 60.0;
+  const double Kprop = (Kt * NOMINAL_CURRENT_A) / (Wmax * Wmax);
+  const double Wwind = (Mechanics.WindRpm * TWO_PI) / 60.0;
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    double OmegaEl = Plant.Omega * (double)POLE_PAIR_NUM;
+    double Iq = (Plant.Ialpha * cos(Plant.Theta)) - (Plant.Ibeta * sin(Plant.Theta));
+    double Torque = (Kt * Iq) - (MOTOR_FRICTION_NMS * Plant.Omega)
+                    + (Kprop * ((Wwind * fabs(Wwind)) - (Plant.Omega * fabs(Plant.Omega))));
+
+    if (true == Plant.bPwmOn)
+    {
+      double Ealpha = OmegaEl * Flux * cos(Plant.Theta);
+      double Ebeta = -OmegaEl * Flux * sin(Plant.Theta);
+
+      Plant.Ialpha += ((Plant.ValphaV - (RS * Plant.Ialpha) - Ealpha) * Dt) / LS;
+      Plant.Ibeta += ((Plant.VbetaV - (RS * Plant.Ibeta) - Ebeta) * Dt) / LS;
+    }
+    else
+    {
+      /* Bridge off, the line Bemf below the bus voltage: the diodes do not conduct */
+      Plant.Ialpha = 0.0;
+      Plant.Ibeta = 0.0;
+    }
+    Plant.Theta += OmegaEl * Dt;
+    Plant.Omega += (Torque * Dt) / Mechanics.InertiaKgm2;
+
+    Plant.PeakA = fmax(Plant.PeakA, hypot(Plant.Ialpha, Plant.Ibeta));
+    Plant.MinIqA = fmin(Plant.MinIqA, Iq);
+  }
+  Plant.Theta = fmod(Plant.Theta, TWO_PI);
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* FOC_UpdateObserverGainsM1 */
+static void UpdateObserverGains(void)
+{
+  STO_PLL_GainSchedPoint_t Gains;
+
+  STO_PLL_CalcScheduledGains(&Sto, SPD_GetAvrgMecSpeedUnit(STC_GetSpeedSensor(&Stc)), &Gains);
+  STO_PLL_SetObserverGains(&Sto, Gains.hC2, Gains.hC4);
+  STO_SetPLLGains(&Sto, Gains.hPLLKpGain, Gains.hPLLKiGain);
+}
+
+/* FOC_IsRotorObservedM1 */
+static bool IsRotorObserved(void)
+{
+  return (STO_PLL_IsBemfConsistentWithin(&Sto, REVUP_BEMF_CONSISTENCY_TOL));
+}
+
+/* FOC_IsObserverTrackingM1 */
+static bool IsObserverTracking(int16_t hForcedMecSpeedUnit)
+{
+  bool bTracking = false;
+  int32_t wForced = (int32_t)hForcedMecSpeedUnit * hDirection;
+
+  if ((true == STO_PLL_IsVarianceTight(&StoIf)) && (true == IsRotorObserved()) && (wForced > 0))
+  {
+    int16_t hLoadAngle = (int16_t)(SPD_GetElAngle(&Vss._Super) - SPD_GetElAngle(&Sto._Super));
+
+    bTracking = (hDirection > 0) ? (hLoadAngle < 0) : (hLoadAngle > 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (bTracking);
+}
+
+/* FOC_Clear */
+static void ClearFOC(void)
+{
+  memset(&FocVars.Iab, 0, sizeof(FocVars.Iab));
+  memset(&FocVars.Ialphabeta, 0, sizeof(FocVars.Ialphabeta));
+  memset(&FocVars.Iqd, 0, sizeof(FocVars.Iqd));
+  memset(&FocVars.Iqdref, 0, sizeof(FocVars.Iqdref));
+  FocVars.hTeref = 0;
+  memset(&FocVars.Vqd, 0, sizeof(FocVars.Vqd));
+  memset(&FocVars.Valphabeta, 0, sizeof(FocVars.Valphabeta));
+  FocVars.hElAngle = 0;
+  PID_SetIntegralTerm(&PIDIq, 0);
+  PID_SetIntegralTerm(&PIDId, 0);
+  STC_Clear(&Stc);
+#if (SPD_FILTER_ENABLE == 1)
+  SPDFLT_Clear(&SpeedFilter);
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+  LTO_Clear(&LoadObserver);
+#endif
+  PWMC_SwitchOffPWM(&Pwmc);
+}
+
+/* FOC_CalcCurrRef */
+static void CalcCurrRef(void)
+{
+  if (INTERNAL == FocVars.bDriveInput)
+  {
+    FocVars.hTeref = STC_CalcTorqueReference(&Stc);
+    FocVars.Iqdref.q = FocVars.hTeref;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/* MCI_ExecBufferedCommands, for the speed ramp of the start command */
+static void ExecBufferedCommands(void)
+{
+  if (true == bCommandPending)
+  {
+    FocVars.bDriveInput = INTERNAL;
+    STC_SetControlMode(&Stc, MCM_SPEED_MODE);
+    bCommandPending = !STC_ExecRamp(&Stc, hCommandSpeedUnit, hCommandDurationms);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/* Closed loop entry of the OTF_DETECTION and SWITCH_OVER states, the speed integral term set */
+static void EnterRun(void)
+{
+  STC_SetSpeedSensor(&Stc, &Sto._Super);
+  CalcCurrRef();
+  STC_ForceSpeedReferenceToCurrentSpeed(&Stc);
+  ExecBufferedCommands();
+  State = RUN;
+}
+
+/* FOC_CurrControllerM1, the bus at its nominal voltage: its compensation is neutral */
+static void CurrController(void)
+{
+  SpeednPosFdbk_Handle_t *pSensor = STC_GetSpeedSensor(&Stc);
+  int16_t hElAngle = SPD_GetElAngle(pSensor) + (SPD_GetInstElSpeedDpp(pSensor) * PARK_ANGLE_COMPENSATION_FACTOR);
+  Trig_Components CosSin = MCM_Trig_Functions(hElAngle);
+  ab_t Iab = ReadPhaseCurrents();
+  alphabeta_t Ialphabeta = FOCP_Clarke(Iab);
+  qd_t Iqd = FOCP_Park(Ialphabeta, CosSin);
+  alphabeta_t Valphabeta;
+  qd_t Vqd;
+
+  if (true == Plant.bPwmOn)
+  {
+    Vqd.q = FOCP_PI(&PIDIq, (int32_t)FocVars.Iqdref.q - Iqd.q);
+    Vqd.d = FOCP_PI(&PIDId, (int32_t)FocVars.Iqdref.d - Iqd.d);
+  }
+  else
+  {
+    Vqd.q = 0;
+    Vqd.d = 0;
+  }
+  Vqd = Circle_Limitation(&Clm, Vqd);
+  hElAngle += SPD_GetInstElSpeedDpp(pSensor) * REV_PARK_ANGLE_COMPENSATION_FACTOR;
+  CosSin = MCM_Trig_Functions(hElAngle);
+  Valphabeta = FOCP_RevPark(Vqd, CosSin);
+  if (true == Plant.bPwmOn)
+  {
+    (void)PWMC_SetPhaseVoltage(&Pwmc, Valphabeta);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  FocVars.Vqd = Vqd;
+  FocVars.Iab = Iab;
+  FocVars.Ialphabeta = Ialphabeta;
+  FocVars.Iqd = Iqd;
+  FocVars.Valphabeta = Valphabeta;
+  FocVars.hElAngle = hElAngle;
+}
+
+/* FOC_HighFrequencyTaskM1, followed by the current control period of the motor */
+static void RunHF(void)
+{
+  Observer_Inputs_t Inputs;
+
+  /* Sample of the current control: the voltage set at the last sample applied from now on */
+  Plant.ValphaV = Plant.NextValphaV;
+  Plant.VbetaV = Plant.NextVbetaV;
+
+  Inputs.Valfa_beta = FocVars.Valphabeta;
+  if ((SWITCH_OVER == State) && (false == REMNG_RampCompleted(&Remng)))
+  {
+    FocVars.Iqdref.q = (int16_t)REMNG_Calc(&Remng);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  CurrController();
+  if (IDLE == State)
+  {
+    STO_PLL_Clear(&Sto);
+  }
+  else
+  {
+    Inputs.Ialfa_beta = FocVars.Ialphabeta;
+    Inputs.Vbus = NOMINAL_BUS_VOLTAGE_d;
+    (void)STO_PLL_CalcElAngle(&Sto, &Inputs);
+  }
+  STO_PLL_CalcAvrgElSpeedDpp(&Sto);
+  if ((false == RUC_FirstAccelerationStageReached(&Ruc)) && (OTF_DETECTION != State) && (RUN != State))
+  {
+    STO_ResetPLL(&Sto);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if ((START == State) || (SWITCH_OVER == State))
+  {
+    int16_t hObsAngle = SPD_GetElAngle(&Sto._Super);
+
+    (void)VSS_CalcElAngle(&Vss, &hObsAngle);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  IntegratePeriod();
+  Plant.Periods++;
+}
+
+/* OTF_DETECTION case of TSK_MediumFrequencyTaskM1 */
+static void RunOTFDetection(void)
+{
+  RUC_OTF_Status_t OTFStatus = RUC_OTF_Detect(&Ruc);
+
+  if (RUC_OTF_CAUGHT == OTFStatus)
+  {
+    int16_t hObsMecSpeedUnit = SPD_GetAvrgMecSpeedUnit(&Sto._Super);
+
+    (void)STO_PLL_IsObserverConverged(&Sto, &hObsMecSpeedUnit);
+    STO_SetDirection(&Sto, (int8_t)hDirection);
+    PID_SetIntegralTerm(&PIDSpeed, 0);
+    EnterRun();
+  }
+  else if (RUC_OTF_NOT_CAUGHT == OTFStatus)
+  {
+    RUC_Clear(&Ruc, hDirection);
+    STC_SetSpeedSensor(&Stc, &Vss._Super);
+    STO_PLL_Clear(&Sto);
+    UpdateObserverGains();
+    ClearFOC();
+#if (POLPULSE_ENABLE == 1)
+    State = ALIGNMENT;
+#else
+    State = START;
+#endif
+    PWMC_SwitchOnPWM(&Pwmc);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+#if (POLPULSE_ENABLE == 1)
+/* ALIGNMENT case of TSK_MediumFrequencyTaskM1, the pulse injection ideal: the rotor position is found at once */
+static void RunAlignment(void)
+{
+  int16_t hElAngle = (int16_t)lround(Plant.Theta / (TWO_PI / 65536.0));
+
+  ClearFOC();
+  STO_PLL_SetMecAngle(&Sto, hElAngle / (int16_t)Sto._Super.bElToMecRatio);
+  RUC_SetStartingElAngle(&Ruc, hElAngle);
+  State = START;
+  PWMC_SwitchOnPWM(&Pwmc);
+}
+#endif
+
+/* START case of TSK_MediumFrequencyTaskM1 */
+static void RunStart(void)
+{
+  int16_t hForcedMecSpeedUnit;
+  bool ObserverConverged = false;
+
+  if (false == RUC_Exec(&Ruc))
+  {
+    /* MC_START_UP */
+    PWMC_SwitchOffPWM(&Pwmc);
+    State = FAULT_NOW;
+  }
+  else
+  {
+    FocVars.Iqdref.q = STC_CalcTorqueReference(&Stc);
+    FocVars.Iqdref.d = FocVars.UserIdref;
+
+    (void)VSS_CalcAvrgMecSpeedUnit(&Vss, &hForcedMecSpeedUnit);
+    RUC_AdaptAcceleration(&Ruc, IsObserverTracking(hForcedMecSpeedUnit), IsRotorObserved());
+    if (true == RUC_FirstAccelerationStageReached(&Ruc))
+    {
+      ObserverConverged = STO_PLL_IsObserverConverged(&Sto, &hForcedMecSpeedUnit)
+                        && ((false == Ruc.AdaptiveEnabled) || (true == IsRotorObserved()));
+      STO_SetDirection(&Sto, (int8_t)hDirection);
+      (void)VSS_SetStartTransition(&Vss, ObserverConverged);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (true == ObserverConverged)
+    {
+      qd_t StatorCurrent = FOCP_Park(FocVars.Ialphabeta, MCM_Trig_Functions(SPD_GetElAngle(&Sto._Super)));
+
+      REMNG_Init(&Remng);
+      (void)REMNG_ExecRamp(&Remng, FocVars.Iqdref.q, 0);
+      (void)REMNG_ExecRamp(&Remng, StatorCurrent.q, TRANSITION_DURATION);
+      State = SWITCH_OVER;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+}
+
+/* SWITCH_OVER case of TSK_MediumFrequencyTaskM1 */
+static void RunSwitchOver(void)
+{
+  int16_t hForcedMecSpeedUnit;
+  bool FlagEnableClosedLoop = VSS_CalcAvrgMecSpeedUnit(&Vss, &hForcedMecSpeedUnit);
+  bool FlagTransitionPhaseCompleted = VSS_TransitionEnded(&Vss);
+
+  FlagEnableClosedLoop = FlagEnableClosedLoop || FlagTransitionPhaseCompleted;
+  if (true == FlagEnableClosedLoop)
+  {
+#if (PID_SPEED_INTEGRAL_INIT_DIV == 0)
+    PID_SetIntegralTerm(&PIDSpeed, 0);
+#else
+    PID_SetIntegralTerm(&PIDSpeed, (((int32_t)FocVars.Iqdref.q * (int16_t)PID_GetKIDivisor(&PIDSpeed))
+                                   / PID_SPEED_INTEGRAL_INIT_DIV));
+#endif
+    EnterRun();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/* Interface of the model ----------------------------------------------------*/
+
+void Model_Init(const Mechanics_t *pMechanics, double SpeedRpm, double ElAngleDeg)
+{
+  const STO_PLL_Handle_t StoInit =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .SpeedUnit                 = SPEED_UNIT,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .hC1                         = C1,
+    .hC2                         = C2,
+    .hC3                         = C3,
+    .hC4                         = C4,
+    .hC5                         = C5,
+    .hF1                         = F1,
+    .hF2                         = F2,
+    .PIRegulator =
+    {
+      .hDefKpGain                = PLL_KP_GAIN,
+      .hDefKiGain                = PLL_KI_GAIN,
+      .hKpDivisor                = PLL_KPDIV,
+      .hKiDivisor                = PLL_KIDIV,
+      .wUpperIntegralLimit       = INT32_MAX,
+      .wLowerIntegralLimit       = -INT32_MAX,
+      .hUpperOutputLimit         = INT16_MAX,
+      .hLowerOutputLimit         = -INT16_MAX,
+      .hKpDivisorPOW2            = PLL_KPDIV_LOG,
+      .hKiDivisorPOW2            = PLL_KIDIV_LOG,
+    },
+    .SpeedBufferSizeUnit         = STO_FIFO_DEPTH_UNIT,
+    .SpeedBufferSizeDpp          = STO_FIFO_DEPTH_DPP,
+    .VariancePercentage          = PERCENTAGE_FACTOR,
+    .SpeedValidationBand_H       = SPEED_BAND_UPPER_LIMIT,
+    .SpeedValidationBand_L       = SPEED_BAND_LOWER_LIMIT,
+    .MinStartUpValidSpeed        = OBS_MINIMUM_SPEED_UNIT,
+    .StartUpConsistThreshold     = NB_CONSECUTIVE_TESTS,
+    .BemfConsistencyCheck        = M1_BEMF_CONSISTENCY_TOL,
+    .BemfConsistencyGain         = M1_BEMF_CONSISTENCY_GAIN,
+    .MaxAppPositiveMecSpeedUnit  = (uint16_t)(MAX_APPLICATION_SPEED_UNIT * 1.15),
+    .F1LOG                       = F1_LOG,
+    .F2LOG                       = F2_LOG,
+    .SpeedBufferSizeDppLOG       = STO_FIFO_DEPTH_DPP_LOG,
+    .hForcedDirection            = 0x0000U,
+    .pGainSched                  = GainSched,
+    .bGainSchedSize              = STO_GAIN_SCHED_SIZE,
+    .hC1Rated                    = C1
+  };
+  const VirtualSpeedSensor_Handle_t VssInit =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .hSpeedSamplingFreqHz        = MEDIUM_FREQUENCY_TASK_RATE,
+    .hTransitionSteps            = (int16_t)((TF_REGULATION_RATE * TRANSITION_DURATION) / 1000.0),
+  };
+  const PID_Handle_t PIDSpeedInit =
+  {
+    .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+    .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+    .hUpperOutputLimit   = (int16_t)IQMAX,
+    .hLowerOutputLimit   = -(int16_t)IQMAX,
+    .hKpDivisor          = (uint16_t)SP_KPDIV,
+    .hKiDivisor          = (uint16_t)SP_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIqInit =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIdInit =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const SPDFLT_Handle_t SpeedFilterInit =
+  {
+    .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+    .fSpeedNotch_Hz    = (float_t)SPD_FLT_NOTCH_HZ,
+    .fSpeedLowPass_Hz  = (float_t)SPD_FLT_SPEED_LPF_HZ,
+    .fTorqueLowPass_Hz = (float_t)SPD_FLT_TORQUE_LPF_HZ,
+    .fNotchQ           = (float_t)SPD_FLT_NOTCH_Q,
+    .bAdaptive         = (SPD_FLT_ADAPTIVE_ENABLE == 1),
+    .fAdaptMin_Hz      = (float_t)SPD_FLT_ADAPTIVE_MIN_HZ,
+    .fAdaptMax_Hz      = (float_t)SPD_FLT_ADAPTIVE_MAX_HZ,
+    .fAdaptMinPower    = (float_t)SPD_FLT_ADAPTIVE_MIN_POWER,
+    .fAdaptStep        = (float_t)SPD_FLT_ADAPTIVE_STEP,
+  };
+  const LTO_Handle_t LoadObserverInit =
+  {
+    .pIqd              = &FocVars.Iqd,
+    .fSamplingFreq_Hz  = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+    .fAccelPerDigit    = (float_t)LTO_ACCEL_PER_DIGIT,
+    .fDamping          = (float_t)LTO_DAMPING,
+    .fBandwidth_Hz     = (float_t)LTO_BANDWIDTH_HZ,
+    .hLoadMax          = (int16_t)IQMAX,
+    .bFeedForward      = (LTO_FEEDFORWARD_ENABLE == 1),
+  };
+  const SpeednTorqCtrl_Handle_t StcInit =
+  {
+    .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+    .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
+    .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .MaxAppNegativeMecSpeedUnit = (int16_t)(-MIN_APPLICATION_SPEED_UNIT),
+    .MinAppNegativeMecSpeedUnit = (int16_t)(-MAX_APPLICATION_SPEED_UNIT),
+    .MaxPositiveTorque          = (int16_t)NOMINAL_CURRENT,
+    .MinNegativeTorque          = -(int16_t)NOMINAL_CURRENT,
+    .ModeDefault                = DEFAULT_CONTROL_MODE,
+    .MecSpeedRefUnitDefault     = (int16_t)(DEFAULT_TARGET_SPEED_UNIT),
+    .TorqueRefDefault           = (int16_t)DEFAULT_TORQUE_COMPONENT,
+    .IdrefDefault               = (int16_t)DEFAULT_FLUX_COMPONENT,
+#if (SPD_FILTER_ENABLE == 1)
+    .SpeedFilter                = &SpeedFilter,
+#else
+    .SpeedFilter                = MC_NULL,
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+    .LoadObserver               = &LoadObserver,
+#else
+    .LoadObserver               = MC_NULL,
+#endif
+  };
+  const RevUpCtrl_Handle_t RucInit =
+  {
+    .hRUCFrequencyHz         = MEDIUM_FREQUENCY_TASK_RATE,
+    .hStartingMecAngle       = (int16_t)((int32_t)(STARTING_ANGLE_DEG)* 65536/360),
+    .bFirstAccelerationStage = (ENABLE_SL_ALGO_FROM_PHASE-1u),
+    .hMinStartUpValidSpeed   = OBS_MINIMUM_SPEED_UNIT,
+    .hMinStartUpFlySpeed     = (int16_t)(OBS_MINIMUM_SPEED_UNIT/2),
+    .OTFStartupEnabled       = true,
+    .hOTFSection1Duration    = OTF_DETECTION_DURATION,
+    .AdaptiveEnabled         = true,
+    .hAdaptMinDurationms     = ADAPTIVE_REVUP_MIN_DURATION,
+    .OTFPhaseParams          = {(uint16_t)500, 0, (int16_t)PHASE5_FINAL_CURRENT, (void*)MC_NULL},
+    .ParamsData =
+    {
+      {(uint16_t)PHASE1_DURATION,(int16_t)(PHASE1_FINAL_SPEED_UNIT),(uint16_t)PHASE1_FINAL_CURRENT,&Ruc.ParamsData[1]},
+      {(uint16_t)PHASE2_DURATION,(int16_t)(PHASE2_FINAL_SPEED_UNIT),(uint16_t)PHASE2_FINAL_CURRENT,&Ruc.ParamsData[2]},
+      {(uint16_t)PHASE3_DURATION,(int16_t)(PHASE3_FINAL_SPEED_UNIT),(uint16_t)PHASE3_FINAL_CURRENT,&Ruc.ParamsData[3]},
+      {(uint16_t)PHASE4_DURATION,(int16_t)(PHASE4_FINAL_SPEED_UNIT),(uint16_t)PHASE4_FINAL_CURRENT,&Ruc.ParamsData[4]},
+      {(uint16_t)PHASE5_DURATION,(int16_t)(PHASE5_FINAL_SPEED_UNIT),(uint16_t)PHASE5_FINAL_CURRENT,(void*)MC_NULL},
+    },
+  };
+
+  Mechanics = *pMechanics;
+  memset(&Plant, 0, sizeof(Plant));
+  Plant.Omega = (SpeedRpm * TWO_PI) / 60.0;
+  Plant.Theta = (ElAngleDeg * TWO_PI) / 360.0;
+  Plant.Noise = 1U;
+
+  Sto = StoInit;
+  Vss = VssInit;
+  PIDSpeed = PIDSpeedInit;
+  PIDIq = PIDIqInit;
+  PIDId = PIDIdInit;
+  SpeedFilter = SpeedFilterInit;
+  LoadObserver = LoadObserverInit;
+  Stc = StcInit;
+  Ruc = RucInit;
+  memset(&StoIf, 0, sizeof(StoIf));
+  StoIf._Super = &Sto._Super;
+  StoIf.pFctForceConvergency1 = &STO_PLL_ForceConvergency1;
+  StoIf.pFctForceConvergency2 = &STO_PLL_ForceConvergency2;
+  StoIf.pFctStoOtfResetPLL = &STO_OTF_ResetPLL;
+  StoIf.pFctSTO_SpeedReliabilityCheck = &STO_PLL_IsVarianceTight;
+  memset(&Pwmc, 0, sizeof(Pwmc));
+  Clm.MaxModule = MAX_MODULE;
+  Clm.MaxVd = (uint16_t)((MAX_MODULE * 950) / 1000);
+  Remng.FrequencyHz = TF_REGULATION_RATE;
+  memset(&FocVars, 0, sizeof(FocVars));
+
+  /* FOC_Init */
+  PID_HandleInit(&PIDSpeed);
+  STO_PLL_Init(&Sto);
+#if (SPD_FILTER_ENABLE == 1)
+  SPDFLT_Init(&SpeedFilter);
+#endif
+#if (LOAD_OBSERVER_ENABLE == 1)
+  LTO_Init(&LoadObserver);
+#endif
+  STC_Init(&Stc, &PIDSpeed, &Sto._Super);
+  VSS_Init(&Vss);
+  RUC_Init(&Ruc, &Stc, &Vss, &StoIf, &Pwmc);
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+  REMNG_Init(&Remng);
+  ClearFOC();
+  FocVars.bDriveInput = EXTERNAL;
+  FocVars.Iqdref = STC_GetDefaultIqdref(&Stc);
+  FocVars.UserIdref = STC_GetDefaultIqdref(&Stc).d;
+  bCommandPending = false;
+  State = IDLE;
+}
+
+void Model_Start(double SpeedRpm, uint16_t Durationms)
+{
+  /* MCI_ExecSpeedRamp and MCI_StartMotor */
+  hCommandSpeedUnit = (int16_t)lround((SpeedRpm * SPEED_UNIT) / U_RPM);
+  hCommandDurationms = Durationms;
+  hDirection = (hCommandSpeedUnit < 0) ? -1 : 1;
+  bCommandPending = true;
+
+  /* IDLE */
+  RUC_Clear(&Ruc, hDirection);
+
+  /* CHARGE_BOOT_CAP */
+  PWMC_SwitchOffPWM(&Pwmc);
+  FocVars.bDriveInput = EXTERNAL;
+  if (true == Ruc.OTFStartupEnabled)
+  {
+    STC_SetSpeedSensor(&Stc, &Sto._Super);
+  }
+  else
+  {
+    STC_SetSpeedSensor(&Stc, &Vss._Super);
+  }
+  STO_PLL_Clear(&Sto);
+  UpdateObserverGains();
+  ClearFOC();
+  if (true == Ruc.OTFStartupEnabled)
+  {
+    STO_SetDirection(&Sto, 0);
+    RUC_OTF_StartDetection(&Ruc);
+    State = OTF_DETECTION;
+  }
+  else
+  {
+#if (POLPULSE_ENABLE == 1)
+    State = ALIGNMENT;
+#else
+    State = START;
+#endif
+  }
+  PWMC_SwitchOnPWM(&Pwmc);
+}
+
+void Model_RunMF(void)
+{
+  int16_t hMecSpeedUnit;
+  int Hf;
+
+  Plant.PeakA = 0.0;
+  Plant.MinIqA = INFINITY;
+  for (Hf = 0; Hf < HF_PER_MF; Hf++)
+  {
+    RunHF();
+  }
+
+  (void)STO_PLL_CalcAvrgMecSpeedUnit(&Sto, &hMecSpeedUnit);
+  if ((OTF_DETECTION == State) || (START == State) || (SWITCH_OVER == State) || (RUN == State))
+  {
+    UpdateObserverGains();
+  }
+  else
+  {
+    /* Nothing to do, observer is not running */
+  }
+
+  switch (State)
+  {
+    case OTF_DETECTION:
+    {
+      RunOTFDetection();
+      break;
+    }
+
+#if (POLPULSE_ENABLE == 1)
+    case ALIGNMENT:
+    {
+      RunAlignment();
+      break;
+    }
+#endif
+
+    case START:
+    {
+      RunStart();
+      break;
+    }
+
+    case SWITCH_OVER:
+    {
+      RunSwitchOver();
+      break;
+    }
+
+    case RUN:
+    {
+      ExecBufferedCommands();
+      CalcCurrRef();
+      if (false == SPD_Check(STC_GetSpeedSensor(&Stc)))
+      {
+        /* MC_SPEED_FDBK */
+        PWMC_SwitchOffPWM(&Pwmc);
+        State = FAULT_NOW;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+double Model_GetTime(void)
+{
+  return ((double)Plant.Periods / (double)TF_REGULATION_RATE);
+}
+
+double Model_GetSpeedRpm(void)
+{
+  return ((Plant.Omega * 60.0) / TWO_PI);
+}
+
+double Model_GetAngleErrorDeg(void)
+{
+  double Deg = ((double)SPD_GetElAngle(STC_GetSpeedSensor(&Stc)) * DEG_PER_S16) - ((Plant.Theta * 360.0) / TWO_PI);
+
+  return (Deg - (360.0 * floor((Deg + 180.0) / 360.0)));
+}
+
+double Model_GetIqA(void)
+{
+  return ((Plant.Ialpha * cos(Plant.Theta)) - (Plant.Ibeta * sin(Plant.Theta)));
+}
+
+double Model_GetPeakCurrentA(void)
+{
+  return (Plant.PeakA);
+}
+
+double Model_GetMinIqA(void)
+{
+  return (Plant.MinIqA);
+}
@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file    startup_model.h
+  * @brief   Host model of the start-up of Motor 1: the firmware speed sensors,
+  *          rev-up and speed controllers driving a simulated motor and
+  *          propeller, as the tasks of mc_tasks_foc.c run them.
+  ******************************************************************************
+  */
+
+#ifndef STARTUP_MODEL_H
+#define STARTUP_MODEL_H
+
+#include "parameters_conversion.h"
+#include "mc_interface.h"
+#include "sto_pll_speed_pos_fdbk.h"
+#include "virtual_speed_sensor.h"
+#include "revup_ctrl.h"
+#include "speed_torq_ctrl.h"
+
+/* Current control periods per medium frequency period */
+#define HF_PER_MF               (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)
+
+typedef struct
+{
+  double InertiaKgm2;                      /* Rotor and propeller */
+  double WindRpm;                          /* Speed the airflow turns the propeller at, 0 in still air */
+} Mechanics_t;
+
+/* Handles of the drive, with the parameters of mc_config.c */
+extern STO_PLL_Handle_t Sto;
+extern VirtualSpeedSensor_Handle_t Vss;
+extern RevUpCtrl_Handle_t Ruc;
+extern SpeednTorqCtrl_Handle_t Stc;
+extern FOCVars_t FocVars;
+extern MCI_State_t State;
+
+/* Initializes the motor turning at SpeedRpm, its d axis at ElAngleDeg, and the drive in IDLE */
+void Model_Init(const Mechanics_t *pMechanics, double SpeedRpm, double ElAngleDeg);
+
+/* Start command of a speed ramp to SpeedRpm in Durationms: IDLE and CHARGE_BOOT_CAP of
+   TSK_MediumFrequencyTaskM1, the bootstrap capacitors charged at once */
+void Model_Start(double SpeedRpm, uint16_t Durationms);
+
+/* One medium frequency period: HF_PER_MF current control periods of FOC_HighFrequencyTaskM1 then
+   TSK_MediumFrequencyTaskM1 */
+void Model_RunMF(void);
+
+/* Simulated time since Model_Init, s */
+double Model_GetTime(void);
+
+/* Actual speed of the rotor, rpm */
+double Model_GetSpeedRpm(void);
+
+/* Angle of the speed sensor in use minus the actual one, electrical degrees in [-180, 180[ */
+double Model_GetAngleErrorDeg(void);
+
+/* Actual torque current, A */
+double Model_GetIqA(void);
+
+/* Largest amplitude of the currents during the last medium frequency period, A */
+double Model_GetPeakCurrentA(void);
+
+/* Lowest torque current during the last medium frequency period, A */
+double Model_GetMinIqA(void);
+
+#endif /* STARTUP_MODEL_H */
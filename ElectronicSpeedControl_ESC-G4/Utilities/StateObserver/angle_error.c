@@ -0,0 +1,437 @@
+/**
+  ******************************************************************************
+  * @file    angle_error.c
+  * @brief   Host benchmark of the State Observer + PLL gain schedule: angle
+  *          error of the observer across the speed range, with the fixed
+  *          workbench gains and with the gains scheduled on the speed.
+  *
+  * The firmware observer, STO_PLL_CalcElAngle and STO_PLL_CalcAvrgElSpeedDpp
+  * every current control period and STO_PLL_CalcAvrgMecSpeedUnit followed by
+  * the update of the scheduled gains every medium frequency period, as
+  * TSK_MediumFrequencyTaskM1 runs them in RUN, observes a model of the motor:
+  *
+  * - rotor held at a constant speed, the windings integrated within each
+  *   period, the voltage set at a sample applied during the next period;
+  * - currents kept on id = 0, iq = IQ_A by the steady state voltages of the
+  *   dq model, computed on the actual angle so that the currents do not
+  *   depend on the observer under test;
+  * - currents read by 12 bits converters with a gaussian noise of NOISE_LSB.
+  *
+  * The observer is started at the speed of the case, the error between the
+  * angle estimated and the actual one measured over the last MEASURE_PERIODS
+  * periods: its offset, the lag of the observer, and its deviation around the
+  * offset, the noise. The program returns 1 when the observer does not lock
+  * on one of the cases, when above STO_GS_SPEED1_RPM the scheduled gains do
+  * not lower the noise or shift the angle by more than OFFSET_MARGIN_DEG, or
+  * when the interpolation of the schedule is wrong.
+  *
+  * Usage: angle_error
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "sto_pll_speed_pos_fdbk.h"
+
+/* Simulated time of each case, s, and current control periods of the measure at its end */
+#define RUN_S                   1.0
+#define MEASURE_PERIODS         4000
+/* Current control periods per medium frequency period */
+#define HF_PER_MF               (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Torque current, A */
+#define IQ_A                    2.0
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#ifndef NOISE_LSB
+#define NOISE_LSB               2.0
+#endif
+/* Largest error of a locked observer, electrical degrees */
+#define LOCKED_DEG              30.0
+/* Largest increase of the offset by the scheduled gains, electrical degrees */
+#define OFFSET_MARGIN_DEG       0.5
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define SQRT2                   1.4142135623730951
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define DEG_PER_S16             (360.0 / 65536.0)
+
+typedef struct
+{
+  double Ialpha;                           /* Phase currents, alpha beta, A */
+  double Ibeta;
+  double ValphaV;                          /* Voltage applied during the period, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad, 0 when the d axis is on beta */
+  uint32_t Noise;
+} Plant_t;
+
+typedef struct
+{
+  double MeanDeg;                          /* Offset */
+  double DevDeg;                           /* Standard deviation around the offset */
+  double PeakDeg;                          /* Largest deviation from the offset */
+} Error_t;
+
+static Plant_t Plant;
+static STO_PLL_Handle_t Sto;
+static double ErrorsDeg[MEASURE_PERIODS];
+
+/* Schedule of mc_config.c */
+static const STO_PLL_GainSchedPoint_t GainSched[STO_GAIN_SCHED_SIZE] =
+{
+  {
+    .hMecSpeedUnit = STO_GS_SPEED1_UNIT,
+    .hC2           = C2,
+    .hC4           = C4,
+    .hPLLKpGain    = PLL_KP_GAIN,
+    .hPLLKiGain    = PLL_KI_GAIN,
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED2_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED2_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED2_RPM),
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED3_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED3_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED3_RPM),
+  },
+};
+
+/* The CORDIC of the target, computed in floating point */
+Trig_Components MCM_Trig_Functions(int16_t hAngle)
+{
+  Trig_Components Components;
+  double Angle = ((double)hAngle * TWO_PI) / 65536.0;
+
+  Components.hCos = (int16_t)lround(32767.0 * cos(Angle));
+  Components.hSin = (int16_t)lround(32767.0 * sin(Angle));
+  return (Components);
+}
+
+/* Observer of mc_config.c, with or without its schedule */
+static void InitObserver(bool bScheduled)
+{
+  STO_PLL_Handle_t Init =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .SpeedUnit                 = SPEED_UNIT,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .hC1                         = C1,
+    .hC2                         = C2,
+    .hC3                         = C3,
+    .hC4                         = C4,
+    .hC5                         = C5,
+    .hF1                         = F1,
+    .hF2                         = F2,
+    .PIRegulator =
+    {
+      .hDefKpGain                = PLL_KP_GAIN,
+      .hDefKiGain                = PLL_KI_GAIN,
+      .hKpDivisor                = PLL_KPDIV,
+      .hKiDivisor                = PLL_KIDIV,
+      .wUpperIntegralLimit       = INT32_MAX,
+      .wLowerIntegralLimit       = -INT32_MAX,
+      .hUpperOutputLimit         = INT16_MAX,
+      .hLowerOutputLimit         = -INT16_MAX,
+      .hKpDivisorPOW2            = PLL_KPDIV_LOG,
+      .hKiDivisorPOW2            = PLL_KIDIV_LOG,
+    },
+    .SpeedBufferSizeUnit         = STO_FIFO_DEPTH_UNIT,
+    .SpeedBufferSizeDpp          = STO_FIFO_DEPTH_DPP,
+    .VariancePercentage          = PERCENTAGE_FACTOR,
+    .SpeedValidationBand_H       = SPEED_BAND_UPPER_LIMIT,
+    .SpeedValidationBand_L       = SPEED_BAND_LOWER_LIMIT,
+    .MinStartUpValidSpeed        = OBS_MINIMUM_SPEED_UNIT,
+    .StartUpConsistThreshold     = NB_CONSECUTIVE_TESTS,
+    .BemfConsistencyCheck        = M1_BEMF_CONSISTENCY_TOL,
+    .BemfConsistencyGain         = M1_BEMF_CONSISTENCY_GAIN,
+    .MaxAppPositiveMecSpeedUnit  = (uint16_t)(MAX_APPLICATION_SPEED_UNIT * 1.15),
+    .F1LOG                       = F1_LOG,
+    .F2LOG                       = F2_LOG,
+    .SpeedBufferSizeDppLOG       = STO_FIFO_DEPTH_DPP_LOG,
+    .hForcedDirection            = 0x0000U,
+    .pGainSched                  = GainSched,
+    .bGainSchedSize              = STO_GAIN_SCHED_SIZE,
+    .hC1Rated                    = C1
+  };
+
+  if (false == bScheduled)
+  {
+    Init.pGainSched = MC_NULL;
+    Init.bGainSchedSize = 0U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  Sto = Init;
+  STO_PLL_Init(&Sto);
+}
+
+/* Gains update of TSK_MediumFrequencyTaskM1 */
+static void UpdateObserverGains(void)
+{
+  STO_PLL_GainSchedPoint_t Gains;
+
+  STO_PLL_CalcScheduledGains(&Sto, SPD_GetAvrgMecSpeedUnit(&Sto._Super), &Gains);
+  STO_PLL_SetObserverGains(&Sto, Gains.hC2, Gains.hC4);
+  STO_SetPLLGains(&Sto, Gains.hPLLKpGain, Gains.hPLLKiGain);
+}
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+static double WrapDeg(double Deg)
+{
+  return (Deg - (360.0 * floor((Deg + 180.0) / 360.0)));
+}
+
+/* Runs the observer on the motor turning at SpeedRpm */
+static Error_t RunCase(double SpeedRpm, bool bScheduled)
+{
+  Error_t Error = {0.0, 0.0, 0.0};
+  double Flux = HSO_FLUX_WB;
+  double Omega = (SpeedRpm * TWO_PI * (double)POLE_PAIR_NUM) / 60.0;
+  double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  double Dt = Ts / (double)SUB_STEPS;
+  double Vd = -Omega * LS * IQ_A;
+  double Vq = (RS * IQ_A) + (Omega * Flux);
+  double Sum = 0.0;
+  double SumSq = 0.0;
+  int Samples = 0;
+  int Steps = (int)(RUN_S * TF_REGULATION_RATE);
+  int MeasureFrom = Steps - MEASURE_PERIODS;
+  int Step;
+  int Sub;
+  Observer_Inputs_t Inputs;
+
+  InitObserver(bScheduled);
+  Plant.Ialpha = IQ_A;
+  Plant.Ibeta = 0.0;
+  Plant.ValphaV = 0.0;
+  Plant.VbetaV = 0.0;
+  Plant.NextValphaV = 0.0;
+  Plant.NextVbetaV = 0.0;
+  Plant.Theta = 0.0;
+  Plant.Noise = 1U;
+  Inputs.Vbus = NOMINAL_BUS_VOLTAGE_d;
+
+  for (Step = 0; Step < Steps; Step++)
+  {
+    double Theta;
+
+    /* Sample of the current control: the voltage set at the last sample applied from now on */
+    Plant.ValphaV = Plant.NextValphaV;
+    Plant.VbetaV = Plant.NextVbetaV;
+    Inputs.Ialfa_beta.alpha = ReadCurrent(Plant.Ialpha);
+    Inputs.Ialfa_beta.beta = ReadCurrent(Plant.Ibeta);
+    Inputs.Valfa_beta.alpha = (int16_t)lround((Plant.ValphaV * SQRT3 * 32768.0) / NOMINAL_BUS_VOLTAGE_V);
+    Inputs.Valfa_beta.beta = (int16_t)lround((Plant.VbetaV * SQRT3 * 32768.0) / NOMINAL_BUS_VOLTAGE_V);
+
+    if (Step >= MeasureFrom)
+    {
+      ErrorsDeg[Samples] = WrapDeg((((double)SPD_GetElAngle(&Sto._Super)) * DEG_PER_S16)
+                                   - ((Plant.Theta * 360.0) / TWO_PI));
+      Sum += ErrorsDeg[Samples];
+      Samples++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    (void)STO_PLL_CalcElAngle(&Sto, &Inputs);
+    STO_PLL_CalcAvrgElSpeedDpp(&Sto);
+
+    if (0 == (Step % HF_PER_MF))
+    {
+      int16_t hMecSpeedUnit;
+
+      (void)STO_PLL_CalcAvrgMecSpeedUnit(&Sto, &hMecSpeedUnit);
+      if (true == bScheduled)
+      {
+        UpdateObserverGains();
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* Steady state voltage of the next period, on the angle at its middle: d is (sin, cos), q (cos, -sin) */
+    Theta = Plant.Theta + (1.5 * Omega * Ts);
+    Plant.NextValphaV = (Vq * cos(Theta)) + (Vd * sin(Theta));
+    Plant.NextVbetaV = (Vd * cos(Theta)) - (Vq * sin(Theta));
+
+    for (Sub = 0; Sub < SUB_STEPS; Sub++)
+    {
+      double Ealpha = Omega * Flux * cos(Plant.Theta + (0.5 * Omega * Dt));
+      double Ebeta = -Omega * Flux * sin(Plant.Theta + (0.5 * Omega * Dt));
+
+      Plant.Ialpha += ((Plant.ValphaV - (RS * Plant.Ialpha) - Ealpha) * Dt) / LS;
+      Plant.Ibeta += ((Plant.VbetaV - (RS * Plant.Ibeta) - Ebeta) * Dt) / LS;
+      Plant.Theta += Omega * Dt;
+    }
+    Plant.Theta = fmod(Plant.Theta, TWO_PI);
+  }
+
+  Error.MeanDeg = Sum / (double)Samples;
+  for (Step = 0; Step < Samples; Step++)
+  {
+    double Deviation = fabs(ErrorsDeg[Step] - Error.MeanDeg);
+
+    SumSq += Deviation * Deviation;
+    Error.PeakDeg = (Deviation > Error.PeakDeg) ? Deviation : Error.PeakDeg;
+  }
+  Error.DevDeg = sqrt(SumSq / (double)Samples);
+  return (Error);
+}
+
+/* Gain interpolated at hSpeed between two points of the schedule, within 1 */
+static bool IsInterpolated(int16_t hGain, int16_t hLow, int16_t hHigh, const STO_PLL_GainSchedPoint_t *pLow,
+                           const STO_PLL_GainSchedPoint_t *pHigh, int16_t hSpeed)
+{
+  double Expected = (double)hLow + (((double)(hHigh - hLow) * (double)(hSpeed - (int16_t)pLow->hMecSpeedUnit))
+                                    / (double)(pHigh->hMecSpeedUnit - pLow->hMecSpeedUnit));
+
+  return (fabs((double)hGain - Expected) <= 1.0);
+}
+
+/* Gains at the points of the schedule, halfway between them and out of its range */
+static bool CheckInterpolation(void)
+{
+  bool bOk = true;
+  uint8_t i;
+
+  InitObserver(true);
+  for (i = 0U; i < STO_GAIN_SCHED_SIZE; i++)
+  {
+    const STO_PLL_GainSchedPoint_t *pPoint = &GainSched[i];
+    STO_PLL_GainSchedPoint_t Gains;
+    int16_t hSpeed = (int16_t)pPoint->hMecSpeedUnit;
+
+    STO_PLL_CalcScheduledGains(&Sto, hSpeed, &Gains);
+    bOk = bOk && (Gains.hC2 == pPoint->hC2) && (Gains.hC4 == pPoint->hC4)
+          && (Gains.hPLLKpGain == pPoint->hPLLKpGain) && (Gains.hPLLKiGain == pPoint->hPLLKiGain);
+    /* Symmetric in the direction */
+    STO_PLL_CalcScheduledGains(&Sto, -hSpeed, &Gains);
+    bOk = bOk && (Gains.hC2 == pPoint->hC2) && (Gains.hC4 == pPoint->hC4);
+
+    if (i > 0U)
+    {
+      const STO_PLL_GainSchedPoint_t *pLow = &GainSched[i - 1U];
+      int16_t hMiddle = (int16_t)((pLow->hMecSpeedUnit + pPoint->hMecSpeedUnit) / 2U);
+
+      STO_PLL_CalcScheduledGains(&Sto, hMiddle, &Gains);
+      bOk = bOk && IsInterpolated(Gains.hC2, pLow->hC2, pPoint->hC2, pLow, pPoint, hMiddle)
+            && IsInterpolated(Gains.hC4, pLow->hC4, pPoint->hC4, pLow, pPoint, hMiddle)
+            && IsInterpolated(Gains.hPLLKpGain, pLow->hPLLKpGain, pPoint->hPLLKpGain, pLow, pPoint, hMiddle)
+            && IsInterpolated(Gains.hPLLKiGain, pLow->hPLLKiGain, pPoint->hPLLKiGain, pLow, pPoint, hMiddle);
+    }
+    else
+    {
+      STO_PLL_CalcScheduledGains(&Sto, 0, &Gains);
+      bOk = bOk && (Gains.hC2 == pPoint->hC2) && (Gains.hC4 == pPoint->hC4);
+    }
+  }
+
+  {
+    const STO_PLL_GainSchedPoint_t *pLast = &GainSched[STO_GAIN_SCHED_SIZE - 1U];
+    STO_PLL_GainSchedPoint_t Gains;
+
+    STO_PLL_CalcScheduledGains(&Sto, INT16_MAX, &Gains);
+    bOk = bOk && (Gains.hC2 == pLast->hC2) && (Gains.hPLLKiGain == pLast->hPLLKiGain);
+
+    /* C2 follows a stator resistance retuned away from the one of the schedule */
+    STO_PLL_SetStatorResistanceGain(&Sto, (int16_t)(C1 + 100));
+    STO_PLL_CalcScheduledGains(&Sto, INT16_MAX, &Gains);
+    bOk = bOk && (Gains.hC2 == (pLast->hC2 + 100)) && (Gains.hC4 == pLast->hC4);
+  }
+  return (bOk);
+}
+
+int main(void)
+{
+  static const double SpeedsRpm[] =
+  {
+    OBS_MINIMUM_SPEED_RPM * 0.7,
+    STO_GS_SPEED1_RPM,
+    (STO_GS_SPEED1_RPM + STO_GS_SPEED2_RPM) / 2.0,
+    STO_GS_SPEED2_RPM,
+    (STO_GS_SPEED2_RPM + STO_GS_SPEED3_RPM) / 2.0,
+    STO_GS_SPEED3_RPM,
+  };
+  bool bOk = true;
+  unsigned int i;
+
+  printf("Angle error, electrical degrees, iq %.1f A, noise %.1f LSB\n", IQ_A, (double)NOISE_LSB);
+  printf("%8s  %23s  %23s\n", "", "fixed gains", "scheduled gains");
+  printf("%8s  %7s %7s %7s  %7s %7s %7s\n", "rpm", "offset", "dev", "peak", "offset", "dev", "peak");
+  for (i = 0U; i < (sizeof(SpeedsRpm) / sizeof(SpeedsRpm[0])); i++)
+  {
+    Error_t Fixed = RunCase(SpeedsRpm[i], false);
+    Error_t Scheduled = RunCase(SpeedsRpm[i], true);
+    bool bLocked = ((fabs(Fixed.MeanDeg) + Fixed.PeakDeg) < LOCKED_DEG)
+                   && ((fabs(Scheduled.MeanDeg) + Scheduled.PeakDeg) < LOCKED_DEG);
+    /* Above the first point the schedule is to lower the noise, without shifting the angle */
+    bool bQuieter = (SpeedsRpm[i] <= STO_GS_SPEED1_RPM) || (Scheduled.DevDeg < Fixed.DevDeg);
+    bool bShifted = (fabs(Scheduled.MeanDeg) > (fabs(Fixed.MeanDeg) + OFFSET_MARGIN_DEG));
+
+    printf("%8.0f  %7.2f %7.2f %7.2f  %7.2f %7.2f %7.2f  %s\n", SpeedsRpm[i],
+           Fixed.MeanDeg, Fixed.DevDeg, Fixed.PeakDeg, Scheduled.MeanDeg, Scheduled.DevDeg, Scheduled.PeakDeg,
+           (false == bLocked) ? "not locked" : ((false == bQuieter) ? "noisier" : ((true == bShifted) ? "shifted" : "ok")));
+    bOk = bOk && bLocked && bQuieter && (false == bShifted);
+  }
+
+  if (false == CheckInterpolation())
+  {
+    printf("Interpolation of the schedule: wrong\n");
+    bOk = false;
+  }
+  else
+  {
+    printf("Interpolation of the schedule: ok\n");
+  }
+
+  return ((true == bOk) ? 0 : 1);
+}
@@ -0,0 +1,523 @@
+/**
+  ******************************************************************************
+  * @file    hso_sto.c
+  * @brief   Host benchmark of the HSO flux observer against the State
+  *          Observer + PLL: angle error across the speed range, convergence
+  *          from a wrong angle and duration of a call.
+  *
+  * The firmware sensors, HSO_SPD_CalcElAngle and STO_PLL_CalcElAngle with
+  * STO_PLL_CalcAvrgElSpeedDpp every current control period, their average
+  * speed and the scheduled gains of the State Observer every medium frequency
+  * period, as TSK_HighFrequencyTask and TSK_MediumFrequencyTaskM1 run them,
+  * with the parameters of mc_config.c, observe a model of the motor:
+  *
+  * - rotor held at a constant speed, the windings integrated within each
+  *   period, the currents sampled in the middle of the PWM period and the
+  *   voltage set at a sample applied from the next update event, half a
+  *   period later;
+  * - currents kept on id = 0, iq = IQ_A by the steady state voltages of the
+  *   dq model, computed on the actual angle so that the currents do not
+  *   depend on the observer under test;
+  * - currents read by 12 bits converters with a gaussian noise of NOISE_LSB.
+  *
+  * Each observer is started SEED_DEG off the rotor, as after a rev-up that
+  * lost the rotor, the error measured over the last MEASURE_PERIODS of the
+  * case: its offset, the lag of the observer, and its deviation around the
+  * offset. The voltage being loaded half a period after the sample, the
+  * offsets of the State Observer are larger than in angle_error. The
+  * convergence time is the last time the error is more than CONVERGED_DEG
+  * off that offset. The program returns 1 when an observer does not converge
+  * on a case, or when the HSO is not locked within LOCKED_DEG, or reports a
+  * speed against the rotor or not reliable, from OBS_MINIMUM_SPEED_RPM up.
+  *
+  * fixpmath.c is built in, without the CORDIC peripheral of the target: on
+  * its MATHLIB implementation. The durations are measured on the host: they
+  * compare the two observers, not the cycles on the target.
+  *
+  * Usage: hso_sto
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "parameters_conversion.h"
+#include "sto_pll_speed_pos_fdbk.h"
+#include "hso_speed_pos_fdbk.h"
+#include "mc_stm_types.h"
+
+/* The host has no CORDIC: fixpmath.c on the MATHLIB functions it uses on the devices without one */
+#undef CORDIC
+#include "fixpmath.c"
+
+/* Current control periods of each case, one second, and of the measure at its end */
+#define RUN_PERIODS             16000
+#define MEASURE_PERIODS         4000
+/* Current control periods per medium frequency period */
+#define HF_PER_MF               (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Torque current, A */
+#define IQ_A                    2.0
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#define NOISE_LSB               2.0
+/* Error of the angle the observers start from, electrical degrees */
+#define SEED_DEG                90.0
+/* Error within which an observer is converged, and largest offset of the HSO, electrical degrees */
+#define CONVERGED_DEG           10.0
+#define LOCKED_DEG              5.0
+/* Calls of each observer to measure its duration */
+#define TIMED_CALLS             1000000
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define DEG_PER_S16             (360.0 / 65536.0)
+
+typedef enum
+{
+  OBSERVER_STO,
+  OBSERVER_HSO,
+} Observer_t;
+
+typedef struct
+{
+  double Ialpha;                           /* Phase currents, alpha beta, A */
+  double Ibeta;
+  double ValphaV;                          /* Voltage applied, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad, 0 when the d axis is on beta */
+  uint32_t Noise;
+} Plant_t;
+
+typedef struct
+{
+  double MeanDeg;                          /* Offset */
+  double DevDeg;                           /* Standard deviation around the offset */
+  double ConvergedMs;                      /* < 0 if not converged */
+  int16_t hMecSpeedUnit;                   /* Average speed at the end */
+  bool bReliable;                          /* Speed reliable at the end */
+} Result_t;
+
+static Plant_t Plant;
+static STO_PLL_Handle_t Sto;
+static HSO_Obj HsoObj;
+static HSO_SPD_Handle_t Hso;
+static double ErrorsDeg[RUN_PERIODS];
+
+/* Schedule of mc_config.c */
+static const STO_PLL_GainSchedPoint_t GainSched[STO_GAIN_SCHED_SIZE] =
+{
+  {
+    .hMecSpeedUnit = STO_GS_SPEED1_UNIT,
+    .hC2           = C2,
+    .hC4           = C4,
+    .hPLLKpGain    = PLL_KP_GAIN,
+    .hPLLKiGain    = PLL_KI_GAIN,
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED2_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED2_POLE_A, STO_GS_SPEED2_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED2_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED2_RPM),
+  },
+  {
+    .hMecSpeedUnit = STO_GS_SPEED3_UNIT,
+    .hC2           = STO_GAIN1(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hC4           = STO_GAIN2(STO_GS_SPEED3_POLE_A, STO_GS_SPEED3_POLE_B),
+    .hPLLKpGain    = STO_GS_PLL_GAIN(PLL_KP_GAIN, STO_GS_SPEED3_RPM),
+    .hPLLKiGain    = STO_GS_PLL_GAIN(PLL_KI_GAIN, STO_GS_SPEED3_RPM),
+  },
+};
+
+/* mc_config.c */
+static const HSO_Params HsoParams =
+{
+  .Flux_Wb              = (float_t)HSO_FLUX_WB,
+  .CrossOver_Hz         = (float_t)HSO_CROSSOVER_HZ,
+  .isrTime_s            = (float_t)(1.0 / ISR_FREQUENCY_HZ),
+  .FullScaleVoltage_V   = (float_t)FULL_SCALE_VOLTAGE_V,
+  .FullScaleFreq_Hz     = (float_t)FULL_SCALE_FREQ_HZ,
+  .speedPole_rps        = (float_t)(2.0 * 3.1416 * HSO_SPEED_POLE_HZ),
+  .flag_FilterAdaptive  = true,
+  .Filter_adapt_fmin_Hz = (float_t)HSO_CROSSOVER_MIN_HZ,
+  .Filter_adapt_fmax_Hz = (float_t)HSO_CROSSOVER_MAX_HZ,
+  .CheckDirBW_Hz        = (float_t)HSO_CHECKDIR_BW_HZ,
+};
+
+/* The CORDIC of the target, in floating point */
+Trig_Components MCM_Trig_Functions(int16_t hAngle)
+{
+  Trig_Components Components;
+  double Angle = ((double)hAngle * TWO_PI) / 65536.0;
+
+  Components.hCos = (int16_t)lround(32767.0 * cos(Angle));
+  Components.hSin = (int16_t)lround(32767.0 * sin(Angle));
+  return (Components);
+}
+
+/* Observers of mc_config.c ---------------------------------------------------*/
+
+static void InitSto(void)
+{
+  const STO_PLL_Handle_t Init =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .SpeedUnit                 = SPEED_UNIT,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .hC1                         = C1,
+    .hC2                         = C2,
+    .hC3                         = C3,
+    .hC4                         = C4,
+    .hC5                         = C5,
+    .hF1                         = F1,
+    .hF2                         = F2,
+    .PIRegulator =
+    {
+      .hDefKpGain                = PLL_KP_GAIN,
+      .hDefKiGain                = PLL_KI_GAIN,
+      .hKpDivisor                = PLL_KPDIV,
+      .hKiDivisor                = PLL_KIDIV,
+      .wUpperIntegralLimit       = INT32_MAX,
+      .wLowerIntegralLimit       = -INT32_MAX,
+      .hUpperOutputLimit         = INT16_MAX,
+      .hLowerOutputLimit         = -INT16_MAX,
+      .hKpDivisorPOW2            = PLL_KPDIV_LOG,
+      .hKiDivisorPOW2            = PLL_KIDIV_LOG,
+    },
+    .SpeedBufferSizeUnit         = STO_FIFO_DEPTH_UNIT,
+    .SpeedBufferSizeDpp          = STO_FIFO_DEPTH_DPP,
+    .VariancePercentage          = PERCENTAGE_FACTOR,
+    .SpeedValidationBand_H       = SPEED_BAND_UPPER_LIMIT,
+    .SpeedValidationBand_L       = SPEED_BAND_LOWER_LIMIT,
+    .MinStartUpValidSpeed        = OBS_MINIMUM_SPEED_UNIT,
+    .StartUpConsistThreshold     = NB_CONSECUTIVE_TESTS,
+    .BemfConsistencyCheck        = M1_BEMF_CONSISTENCY_TOL,
+    .BemfConsistencyGain         = M1_BEMF_CONSISTENCY_GAIN,
+    .MaxAppPositiveMecSpeedUnit  = (uint16_t)(MAX_APPLICATION_SPEED_UNIT * 1.15),
+    .F1LOG                       = F1_LOG,
+    .F2LOG                       = F2_LOG,
+    .SpeedBufferSizeDppLOG       = STO_FIFO_DEPTH_DPP_LOG,
+    .hForcedDirection            = 0x0000U,
+    .pGainSched                  = GainSched,
+    .bGainSchedSize              = STO_GAIN_SCHED_SIZE,
+    .hC1Rated                    = C1
+  };
+
+  Sto = Init;
+  STO_PLL_Init(&Sto);
+}
+
+static void InitHso(void)
+{
+  const HSO_SPD_Handle_t Init =
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .SpeedUnit                 = SPEED_UNIT,
+      .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+      .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+      .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .pHSO                        = &HsoObj,
+    .pParams                     = &HsoParams,
+    .Rs                          = (float_t)RS,
+    .Ls                          = (float_t)LS,
+    .FullScaleCurrent_A          = (float_t)M1_MAX_READABLE_CURRENT,
+  };
+
+  Hso = Init;
+  HSO_SPD_Init(&Hso);
+}
+
+static SpeednPosFdbk_Handle_t *Init(Observer_t Observer, int16_t hElAngle)
+{
+  SpeednPosFdbk_Handle_t *pSensor;
+
+  if (OBSERVER_STO == Observer)
+  {
+    InitSto();
+    STO_PLL_SetMecAngle(&Sto, hElAngle / (int16_t)POLE_PAIR_NUM);
+    pSensor = &Sto._Super;
+  }
+  else
+  {
+    InitHso();
+    HSO_SPD_SetMecAngle(&Hso, hElAngle / (int16_t)POLE_PAIR_NUM);
+    pSensor = &Hso._Super;
+  }
+  return (pSensor);
+}
+
+/* Observer part of TSK_HighFrequencyTask */
+static void RunHF(Observer_t Observer, Observer_Inputs_t *pInputs)
+{
+  if (OBSERVER_STO == Observer)
+  {
+    (void)STO_PLL_CalcElAngle(&Sto, pInputs);
+    STO_PLL_CalcAvrgElSpeedDpp(&Sto);
+  }
+  else
+  {
+    (void)HSO_SPD_CalcElAngle(&Hso, pInputs);
+  }
+}
+
+/* Observer part of TSK_MediumFrequencyTaskM1, false when the sensor is not reliable */
+static bool RunMF(Observer_t Observer, int16_t *phMecSpeedUnit)
+{
+  bool bReliable;
+
+  if (OBSERVER_STO == Observer)
+  {
+    STO_PLL_GainSchedPoint_t Gains;
+
+    bReliable = STO_PLL_CalcAvrgMecSpeedUnit(&Sto, phMecSpeedUnit);
+    STO_PLL_CalcScheduledGains(&Sto, SPD_GetAvrgMecSpeedUnit(&Sto._Super), &Gains);
+    STO_PLL_SetObserverGains(&Sto, Gains.hC2, Gains.hC4);
+    STO_SetPLLGains(&Sto, Gains.hPLLKpGain, Gains.hPLLKiGain);
+  }
+  else
+  {
+    bReliable = HSO_SPD_CalcAvrgMecSpeedUnit(&Hso, phMecSpeedUnit);
+  }
+  return (bReliable);
+}
+
+/* Motor ---------------------------------------------------------------------*/
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+static double WrapDeg(double Deg)
+{
+  return (Deg - (360.0 * floor((Deg + 180.0) / 360.0)));
+}
+
+/* Runs an observer on the motor turning at SpeedRpm, started SEED_DEG off */
+static Result_t RunCase(Observer_t Observer, double SpeedRpm)
+{
+  Result_t Result = {0.0, 0.0, 0.0, 0, false};
+  double Omega = (SpeedRpm * TWO_PI * (double)POLE_PAIR_NUM) / 60.0;
+  double Ts = 1.0 / (double)TF_REGULATION_RATE;
+  double Dt = Ts / (double)SUB_STEPS;
+  double Vd = -Omega * LS * IQ_A;
+  double Vq = (RS * IQ_A) + (Omega * HSO_FLUX_WB);
+  double Sum = 0.0;
+  double SumSq = 0.0;
+  int Samples = 0;
+  int Steps = RUN_PERIODS;
+  int MeasureFrom = Steps - MEASURE_PERIODS;
+  int LastOut = -1;
+  int Step;
+  int Sub;
+  SpeednPosFdbk_Handle_t *pSensor = Init(Observer, (int16_t)lround(SEED_DEG / DEG_PER_S16));
+  Observer_Inputs_t Inputs;
+
+  Plant = (Plant_t){0};
+  Plant.Ialpha = IQ_A;
+  Plant.Noise = 1U;
+  Inputs.Vbus = NOMINAL_BUS_VOLTAGE_d;
+
+  for (Step = 0; Step < Steps; Step++)
+  {
+    double ErrorDeg = WrapDeg(((double)SPD_GetElAngle(pSensor) * DEG_PER_S16) - ((Plant.Theta * 360.0) / TWO_PI));
+    double Theta;
+
+    ErrorsDeg[Step] = ErrorDeg;
+    if (Step >= MeasureFrom)
+    {
+      Sum += ErrorDeg;
+      Samples++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* Steady state voltage, applied from the next update event, on the angle at the middle of its application:
+       d is (sin, cos), q (cos, -sin) */
+    Theta = Plant.Theta + (Omega * Ts);
+    Plant.NextValphaV = (Vq * cos(Theta)) + (Vd * sin(Theta));
+    Plant.NextVbetaV = (Vd * cos(Theta)) - (Vq * sin(Theta));
+
+    /* Sample of this period and voltage set in it */
+    Inputs.Ialfa_beta.alpha = ReadCurrent(Plant.Ialpha);
+    Inputs.Ialfa_beta.beta = ReadCurrent(Plant.Ibeta);
+    Inputs.Valfa_beta.alpha = (int16_t)lround((Plant.NextValphaV * SQRT3 * 32768.0) / NOMINAL_BUS_VOLTAGE_V);
+    Inputs.Valfa_beta.beta = (int16_t)lround((Plant.NextVbetaV * SQRT3 * 32768.0) / NOMINAL_BUS_VOLTAGE_V);
+    RunHF(Observer, &Inputs);
+    if (0 == (Step % HF_PER_MF))
+    {
+      Result.bReliable = RunMF(Observer, &Result.hMecSpeedUnit);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    for (Sub = 0; Sub < SUB_STEPS; Sub++)
+    {
+      double Ealpha = Omega * HSO_FLUX_WB * cos(Plant.Theta + (0.5 * Omega * Dt));
+      double Ebeta = -Omega * HSO_FLUX_WB * sin(Plant.Theta + (0.5 * Omega * Dt));
+
+      if ((SUB_STEPS / 2) == Sub)
+      {
+        /* Update event: the voltage set at the sample is loaded */
+        Plant.ValphaV = Plant.NextValphaV;
+        Plant.VbetaV = Plant.NextVbetaV;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      Plant.Ialpha += ((Plant.ValphaV - (RS * Plant.Ialpha) - Ealpha) * Dt) / LS;
+      Plant.Ibeta += ((Plant.VbetaV - (RS * Plant.Ibeta) - Ebeta) * Dt) / LS;
+      Plant.Theta += Omega * Dt;
+    }
+    Plant.Theta = fmod(Plant.Theta, TWO_PI);
+  }
+
+  Result.MeanDeg = Sum / (double)Samples;
+  for (Step = 0; Step < Steps; Step++)
+  {
+    double Deviation = WrapDeg(ErrorsDeg[Step] - Result.MeanDeg);
+
+    if (Step >= MeasureFrom)
+    {
+      SumSq += Deviation * Deviation;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (fabs(Deviation) > CONVERGED_DEG)
+    {
+      LastOut = Step;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  Result.DevDeg = sqrt(SumSq / (double)Samples);
+  Result.ConvergedMs = (LastOut < MeasureFrom) ? ((1000.0 * (double)(LastOut + 1)) / TF_REGULATION_RATE) : -1.0;
+  return (Result);
+}
+
+/* Host time of a call of the observer, ns */
+static double TimeObserver(Observer_t Observer)
+{
+  SpeednPosFdbk_Handle_t *pSensor = Init(Observer, 0);
+  Observer_Inputs_t Inputs;
+  struct timespec Start;
+  struct timespec End;
+  volatile int16_t hSink = 0;
+  int i;
+
+  Inputs.Vbus = NOMINAL_BUS_VOLTAGE_d;
+  clock_gettime(CLOCK_MONOTONIC, &Start);
+  for (i = 0; i < TIMED_CALLS; i++)
+  {
+    Inputs.Ialfa_beta.alpha = (int16_t)(i & 0x3FF);
+    Inputs.Ialfa_beta.beta = (int16_t)((i >> 4) & 0x3FF);
+    Inputs.Valfa_beta.alpha = (int16_t)((i >> 2) & 0xFFF);
+    Inputs.Valfa_beta.beta = (int16_t)((i >> 6) & 0xFFF);
+    RunHF(Observer, &Inputs);
+    hSink = SPD_GetElAngle(pSensor);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &End);
+  (void)hSink;
+  return ((((double)(End.tv_sec - Start.tv_sec) * 1e9) + (double)(End.tv_nsec - Start.tv_nsec)) / TIMED_CALLS);
+}
+
+static void PrintResult(const Result_t *pResult)
+{
+  if (pResult->ConvergedMs >= 0.0)
+  {
+    printf("  %6.2f %6.2f %6.0f ms", pResult->MeanDeg, pResult->DevDeg, pResult->ConvergedMs);
+  }
+  else
+  {
+    printf("  %6.2f %6.2f %9s", pResult->MeanDeg, pResult->DevDeg, "none");
+  }
+}
+
+int main(void)
+{
+  static const double SpeedsRpm[] =
+  {
+    300.0,
+    1000.0,
+    OBS_MINIMUM_SPEED_RPM,
+    STO_GS_SPEED2_RPM,
+    MAX_APPLICATION_SPEED_RPM * 0.8,
+  };
+  int Failures = 0;
+  size_t i;
+
+  FIXPMATH_init();
+  printf("Observers started %.0f deg off, iq %.1f A, noise %.1f LSB, angle error over the last %d periods\n\n",
+         SEED_DEG, IQ_A, NOISE_LSB, MEASURE_PERIODS);
+  printf("%8s  %-25s  %-25s\n", "", "State Observer + PLL", "HSO");
+  printf("%8s  %6s %6s %9s    %6s %6s %9s\n", "rpm", "offset", "dev", "converged", "offset", "dev", "converged");
+  for (i = 0; i < (sizeof(SpeedsRpm) / sizeof(SpeedsRpm[0])); i++)
+  {
+    Result_t StoResult = RunCase(OBSERVER_STO, SpeedsRpm[i]);
+    Result_t HsoResult = RunCase(OBSERVER_HSO, SpeedsRpm[i]);
+    bool bPassed = true;
+
+    if (SpeedsRpm[i] >= OBS_MINIMUM_SPEED_RPM)
+    {
+      /* The State Observer is checked by angle_error: here it is the reference of the HSO */
+      bPassed = (StoResult.ConvergedMs >= 0.0) && (HsoResult.ConvergedMs >= 0.0)
+                && (fabs(HsoResult.MeanDeg) < LOCKED_DEG) && (HsoResult.hMecSpeedUnit > 0) && HsoResult.bReliable;
+    }
+    else
+    {
+      /* Below the speed the State Observer is specified for */
+    }
+    printf("%8.0f", SpeedsRpm[i]);
+    PrintResult(&StoResult);
+    PrintResult(&HsoResult);
+    printf("  %s\n", bPassed ? "ok" : "FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nOffset and deviation in electrical degrees, converged within %.0f deg of the offset\n", CONVERGED_DEG);
+  printf("Host time of a call: State Observer %.0f ns, HSO %.0f ns\n", TimeObserver(OBSERVER_STO),
+         TimeObserver(OBSERVER_HSO));
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,440 @@
+/**
+  ******************************************************************************
+  * @file    rs_temp.c
+  * @brief   Host test of the online stator resistance and winding
+  *          temperature estimation on a motor whose resistance heats up.
+  *
+  * The firmware RSTEMP component and the current PI regulators run as
+  * FOC_CurrControllerM1 and FOC_UpdateStatorResistanceM1 run them in RUN,
+  * with the parameters of mc_config.c, and drive a model of the windings of
+  * Motor 1:
+  *
+  * - inductance LS, the flux of the motor voltage constant, and a resistance
+  *   at RS for HEAT_START_S, then ramping by RS_RISE of RS over HEAT_RAMP_S,
+  *   the copper heating up, integrated in the rotor frame within each period
+  *   at the speed of the case, the bus at its nominal voltage;
+  * - each phase voltage short of the dead time error against the sign of its
+  *   current, as the power stage does without compensation;
+  * - currents sampled in the middle of the PWM period, read by 12 bits
+  *   converters with a gaussian noise of NOISE_LSB, and the voltage set at
+  *   a sample applied from the next update event, half a period later;
+  * - the speed sensor replaced by an ideal one, off the rotor by the angle
+  *   error of the case.
+  *
+  * Under a load current below the injection amplitude the estimation must
+  * pause, the observers keeping the rated resistance. Otherwise, once the
+  * estimate is applied to the observers, it must stay within
+  * TRACK_PCT of the resistance of the windings seen through the low pass
+  * filter of the estimation, RS_EST_BANDWIDTH_RPS, and the winding temperature
+  * read by MC_REG_WINDING_TEMP within TEMP_C of the one of the windings at
+  * the end. The program returns 1 when a case does not behave as expected.
+  *
+  * Usage: rs_temp
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "mc_type.h"
+#include "pid_regulator.h"
+#include "rstemp.h"
+#include "mc_stm_types.h"
+
+/* The host has no CORDIC: fixpmath.c on the MATHLIB functions it uses on the devices without one */
+#undef CORDIC
+#include "fixpmath.c"
+
+/* Integration steps of the windings per period */
+#define SUB_STEPS               16
+/* Standard deviation of the noise of the current readings, 12 bits LSB */
+#define NOISE_LSB               2.0
+/* Heating of the windings: rise of the resistance, ratio of RS, after HEAT_START_S over HEAT_RAMP_S, s */
+#define RS_RISE                 0.35
+#define HEAT_START_S            8.0
+#define HEAT_RAMP_S             10.0
+#define RUN_S                   22.0
+/* Largest tracking error of the resistance applied, percent, and of the final temperature, deg C */
+#define TRACK_PCT               3.0
+#define TEMP_C                  8.0
+/* Temperature coefficient of copper, as rstemp.c */
+#define COPPER_TEMPCO           0.00393
+
+#define TWO_PI                  6.283185307179586
+#define SQRT3                   1.7320508075688772
+#define S16_PER_AMP             (32768.0 * 2.0 * RSHUNT * AMPLIFICATION_GAIN / ADC_REFERENCE_VOLTAGE)
+#define S16_PER_LSB             16.0
+#define VOLT_PER_S16            (NOMINAL_BUS_VOLTAGE_V / (SQRT3 * 32768.0))
+#ifndef DEADTIME_V
+#define DEADTIME_V              (NOMINAL_BUS_VOLTAGE_V * RS_EST_DEADTIME_RATIO)
+#endif
+
+typedef struct
+{
+  double SpeedRpm;                         /* Mechanical */
+  double LoadA;                            /* Iq reference */
+  double AngleErrorDeg;                    /* Of the speed sensor, electrical */
+  bool bEstimated;                         /* Load enough for the estimation to run */
+} Case_t;
+
+typedef struct
+{
+  double Id;                               /* Currents in the rotor frame, A */
+  double Iq;
+  double ValphaV;                          /* Voltage applied, V */
+  double VbetaV;
+  double NextValphaV;                      /* Voltage set at the last sample, V */
+  double NextVbetaV;
+  double Theta;                            /* Electrical angle, rad */
+  double W;                                /* Electrical speed, rad/s */
+  double Rs;                               /* Resistance of the windings, Ohm */
+  double RsFiltered;                       /* Through the filter of the estimation */
+  uint32_t Noise;
+} Plant_t;
+
+typedef struct
+{
+  double MaxTrackPct;                      /* Largest error of the resistance applied */
+  double RsOhm;                            /* Estimate and windings at the end */
+  double PlantRsOhm;
+  int16_t hTempC;                          /* MC_REG_WINDING_TEMP and windings at the end */
+  double PlantTempC;
+  bool bApplied;                           /* Estimate applied to the observers */
+} Result_t;
+
+static Plant_t Plant;
+static PID_Handle_t PIDIq;
+static PID_Handle_t PIDId;
+static RSTEMP_Obj RSTemp;
+
+/* mc_config.c */
+static const RSTEMP_Params RSTempParams =
+{
+  .FullScaleCurrent_A   = (float_t)M1_MAX_READABLE_CURRENT,
+  .FullScaleVoltage_V   = (float_t)FULL_SCALE_VOLTAGE_V,
+  .FullScaleFreq_Hz     = (float_t)FULL_SCALE_FREQ_HZ,
+  .RatedCelcius         = (float_t)RS_EST_RATED_CELSIUS,
+  .RsRatedOhm           = (float_t)RS,
+  .LsHenry              = (float_t)LS,
+  .MotorMaxCurrent_A    = (float_t)NOMINAL_CURRENT_A,
+  .F_background_Hz      = (float_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .F_interrupt_Hz       = (float_t)ISR_FREQUENCY_HZ,
+};
+
+static void InitRegulators(void)
+{
+  const PID_Handle_t PIDIqInit =
+  {
+    .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+  const PID_Handle_t PIDIdInit =
+  {
+    .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+    .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+    .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+    .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+    .hUpperOutputLimit   = INT16_MAX,
+    .hLowerOutputLimit   = -INT16_MAX,
+    .hKpDivisor          = (uint16_t)TF_KPDIV,
+    .hKiDivisor          = (uint16_t)TF_KIDIV,
+    .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+    .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  };
+
+  PIDIq = PIDIqInit;
+  PIDId = PIDIdInit;
+  PID_HandleInit(&PIDIq);
+  PID_HandleInit(&PIDId);
+}
+
+/* MC_Perform startup of mc_tasks_foc.c */
+static void InitEstimation(void)
+{
+  (void)RSTEMP_init(&RSTemp, sizeof(RSTemp));
+  RSTEMP_setParams(&RSTemp, &RSTempParams);
+  RSTEMP_setFreqXY_Hz(&RSTemp, (float_t)RS_EST_INJECTION_FREQ_HZ);
+  RSTEMP_setIref_A(&RSTemp, (float_t)RS_EST_INJECTION_CURRENT_A);
+  RSTEMP_setBandwidth(&RSTemp, (float_t)RS_EST_BANDWIDTH_RPS);
+  RSTEMP_setFlagEnable(&RSTemp, true);
+}
+
+/* Power stage ---------------------------------------------------------------*/
+
+static double Gauss(void)
+{
+  double U1;
+  double U2;
+
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U1 = ((double)(Plant.Noise >> 8) + 1.0) / 16777217.0;
+  Plant.Noise = (Plant.Noise * 1103515245U) + 12345U;
+  U2 = (double)(Plant.Noise >> 8) / 16777216.0;
+  return (sqrt(-2.0 * log(U1)) * cos(TWO_PI * U2));
+}
+
+/* Current read by a 12 bits converter, s16A */
+static int16_t ReadCurrent(double CurrentA)
+{
+  double Lsb = floor(((CurrentA * S16_PER_AMP) / S16_PER_LSB) + (NOISE_LSB * Gauss()) + 0.5);
+
+  Lsb = fmin(fmax(Lsb, -2048.0), 2047.0);
+  return ((int16_t)(Lsb * S16_PER_LSB));
+}
+
+/* Phase currents a and b, in the frame of MCM_Clarke and MCM_Park: the d axis at (sin, cos) of the angle */
+static void PhaseCurrents(double *pIa, double *pIb)
+{
+  double Ialpha = (Plant.Id * sin(Plant.Theta)) + (Plant.Iq * cos(Plant.Theta));
+  double Ibeta = (Plant.Id * cos(Plant.Theta)) - (Plant.Iq * sin(Plant.Theta));
+
+  *pIa = Ialpha;
+  *pIb = (-0.5 * Ialpha) - ((SQRT3 / 2.0) * Ibeta);
+}
+
+/* Integrates the windings from a sample to the next one */
+static void IntegratePeriod(void)
+{
+  const double Dt = 1.0 / ((double)ISR_FREQUENCY_HZ * (double)SUB_STEPS);
+  int Sub;
+
+  for (Sub = 0; Sub < SUB_STEPS; Sub++)
+  {
+    double Ia;
+    double Ib;
+    double Ea;
+    double Eb;
+    double Ec;
+    double Mean;
+    double Valpha;
+    double Vbeta;
+    double Vd;
+    double Vq;
+
+    if ((SUB_STEPS / 2) == Sub)
+    {
+      /* Update event: the voltage set at the sample is loaded */
+      Plant.ValphaV = Plant.NextValphaV;
+      Plant.VbetaV = Plant.NextVbetaV;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* Dead time: each leg short of DEADTIME_V against its current, the common mode removed */
+    PhaseCurrents(&Ia, &Ib);
+    Ea = (Ia > 0.0) ? -DEADTIME_V : DEADTIME_V;
+    Eb = (Ib > 0.0) ? -DEADTIME_V : DEADTIME_V;
+    Ec = ((-Ia - Ib) > 0.0) ? -DEADTIME_V : DEADTIME_V;
+    Mean = (Ea + Eb + Ec) / 3.0;
+    Valpha = Plant.ValphaV + (Ea - Mean);
+    Vbeta = Plant.VbetaV - (((Ea - Mean) + (2.0 * (Eb - Mean))) / SQRT3);
+
+    Vd = (Valpha * sin(Plant.Theta)) + (Vbeta * cos(Plant.Theta));
+    Vq = (Valpha * cos(Plant.Theta)) - (Vbeta * sin(Plant.Theta));
+    Plant.Id += ((Vd - (Plant.Rs * Plant.Id) + (Plant.W * LS * Plant.Iq)) * Dt) / LS;
+    Plant.Iq += ((Vq - (Plant.Rs * Plant.Iq) - (Plant.W * LS * Plant.Id) - (Plant.W * HSO_FLUX_WB)) * Dt) / LS;
+    Plant.Theta += Plant.W * Dt;
+  }
+  Plant.Theta = fmod(Plant.Theta, TWO_PI);
+}
+
+/* Drive, as mc_tasks_foc.c runs it ------------------------------------------*/
+
+/* FOC_CurrControllerM1 with the Iq reference of the load, on the angle of the speed sensor */
+static void RunHF(int32_t wIqref, int16_t hElAngle, int16_t hElSpeedDpp)
+{
+  double Ia;
+  double Ib;
+  ab_t Iab;
+  double Angle = ((double)hElAngle * TWO_PI) / 65536.0;
+  /* MCM_Clarke */
+  double Ialpha;
+  double Ibeta;
+  qd_t Iqd;
+  qd_t Vqd;
+  alphabeta_t Valphabeta;
+  double Module;
+  int32_t wIdref = 0;
+
+  PhaseCurrents(&Ia, &Ib);
+  Iab.a = ReadCurrent(Ia);
+  Iab.b = ReadCurrent(Ib);
+  Ialpha = (double)Iab.a;
+  Ibeta = -((double)Iab.a + (2.0 * (double)Iab.b)) / SQRT3;
+
+  /* MCM_Park */
+  Iqd.q = (int16_t)lround((Ialpha * cos(Angle)) - (Ibeta * sin(Angle)));
+  Iqd.d = (int16_t)lround((Ialpha * sin(Angle)) + (Ibeta * cos(Angle)));
+
+  /* Low frequency injection of the stator resistance estimation, null when inactive, fixp30 to s16 */
+  wIdref += RSTEMP_getIdqLFref(&RSTemp).D >> 15;
+  Vqd.q = PI_Controller(&PIDIq, wIqref - Iqd.q);
+  Vqd.d = PI_Controller(&PIDId, wIdref - Iqd.d);
+
+  /* Circle_Limitation */
+  Module = hypot((double)Vqd.q, (double)Vqd.d);
+  Module = (Module > MAX_MODULE) ? (MAX_MODULE / Module) : 1.0;
+  Vqd.q = (int16_t)lround((double)Vqd.q * Module);
+  Vqd.d = (int16_t)lround((double)Vqd.d * Module);
+
+  /* MCM_Rev_Park then PWMC_SetPhaseVoltage */
+  Valphabeta.alpha = (int16_t)lround(((double)Vqd.q * cos(Angle)) + ((double)Vqd.d * sin(Angle)));
+  Valphabeta.beta = (int16_t)lround(((double)Vqd.d * cos(Angle)) - ((double)Vqd.q * sin(Angle)));
+  Plant.NextValphaV = (double)Valphabeta.alpha * VOLT_PER_S16;
+  Plant.NextVbetaV = (double)Valphabeta.beta * VOLT_PER_S16;
+
+  if (RSTEMP_STATE_Idle != RSTEMP_getState(&RSTemp))
+  {
+    Voltages_Uab_t Uab_pu;
+    Currents_Iab_t Iab_pu;
+    FIXP_CosSin_t CosSinPark;
+    int16_t hAppliedAngle = hElAngle + hElSpeedDpp;
+    double AppliedAngle = ((double)hAppliedAngle * TWO_PI) / 65536.0;
+    fixp30_t wVbusHalf = (fixp30_t)(NOMINAL_BUS_VOLTAGE_d >> 1U);
+    fixp30_t wRotation;
+    /* MCM_Rev_Park of the Iqd of the sample on the angle the voltage is applied at */
+    int16_t hIalpha = (int16_t)lround(((double)Iqd.q * cos(AppliedAngle)) + ((double)Iqd.d * sin(AppliedAngle)));
+    int16_t hIbeta = (int16_t)lround(((double)Iqd.d * cos(AppliedAngle)) - ((double)Iqd.q * sin(AppliedAngle)));
+
+    /* Dead time error of each leg, on the phase currents during the application, the common mode removed */
+    int32_t wSqrt3Beta = ((int32_t)hIbeta * 56756) >> 15;
+    int32_t wDeadA = (hIalpha > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+    int32_t wDeadB = ((-wSqrt3Beta - hIalpha) > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+    int32_t wDeadC = ((wSqrt3Beta - hIalpha) > 0) ? -RS_EST_DEADTIME_S16 : RS_EST_DEADTIME_S16;
+
+    Uab_pu.A = ((fixp30_t)Valphabeta.alpha + (((2 * wDeadA) - wDeadB - wDeadC) / 3)) * wVbusHalf;
+    Uab_pu.B = ((fixp30_t)Valphabeta.beta - (((wDeadB - wDeadC) * 37837) >> 16)) * wVbusHalf;
+    Iab_pu.A = ((fixp30_t)hIalpha) << 15;
+    Iab_pu.B = ((fixp30_t)hIbeta) << 15;
+    /* The voltage held over the period turns by its angle in the rotor frame */
+    wRotation = (((int32_t)hElSpeedDpp * hElSpeedDpp) >> 10) * 2527;
+    Iab_pu.A += FIXP30_mpy(Iab_pu.A, wRotation);
+    Iab_pu.B += FIXP30_mpy(Iab_pu.B, wRotation);
+    FIXP30_CosSinPU(((fixp30_t)(uint16_t)(16384 - hAppliedAngle)) << 14, &CosSinPark);
+    RSTEMP_run(&RSTemp, &Uab_pu, &Iab_pu, &CosSinPark, (fixp30_t)hElSpeedDpp * RS_EST_DPP_TO_FREQ_PU);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/* FOC_UpdateStatorResistanceM1, true and the resistance applied to the observers once the estimate settled */
+static bool RunMF(int16_t hIqref, double *pRsOhm)
+{
+  bool bOKtoGo = (hIqref >= RS_EST_MIN_LOAD_S16) || (hIqref <= -RS_EST_MIN_LOAD_S16);
+  bool bApplied;
+
+  RSTEMP_runBackground(&RSTemp, (float_t)RS, bOKtoGo);
+  bApplied = RSTEMP_getFlagUpdateEnable(&RSTemp);
+  *pRsOhm = bApplied ? (double)RSTEMP_getRsOhm(&RSTemp) : RS;
+  return (bApplied);
+}
+
+/* Resistance of the windings heating up */
+static double PlantRs(double TimeS)
+{
+  double Ramp = fmin(fmax((TimeS - HEAT_START_S) / HEAT_RAMP_S, 0.0), 1.0);
+
+  return (RS * (1.0 + (RS_RISE * Ramp)));
+}
+
+static Result_t Run(const Case_t *pCase)
+{
+  const int Periods = (int)(RUN_S * TF_REGULATION_RATE);
+  const int32_t wIqref = (int32_t)lround(pCase->LoadA * CURRENT_CONV_FACTOR);
+  const int16_t hElSpeedDpp = (int16_t)lround(((pCase->SpeedRpm * POLE_PAIR_NUM) / 60.0) * 65536.0
+                                              / (double)TF_REGULATION_RATE);
+  Result_t Result = {0.0, RS, RS, 0, 0.0, false};
+  int Period;
+
+  Plant = (Plant_t){0};
+  Plant.Noise = 1U + (uint32_t)pCase->SpeedRpm;
+  Plant.W = (pCase->SpeedRpm * TWO_PI * POLE_PAIR_NUM) / 60.0;
+  Plant.RsFiltered = RS;
+  InitRegulators();
+  InitEstimation();
+
+  for (Period = 0; Period < Periods; Period++)
+  {
+    double TimeS = (double)Period / (double)TF_REGULATION_RATE;
+    /* Speed sensor, off the rotor by the angle error */
+    int16_t hElAngle = (int16_t)(int32_t)lround((Plant.Theta * (65536.0 / TWO_PI))
+                                                + (pCase->AngleErrorDeg * (65536.0 / 360.0)));
+
+    Plant.Rs = PlantRs(TimeS);
+    RunHF(wIqref, hElAngle, hElSpeedDpp);
+    if (0 == (Period % (int)(TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE)))
+    {
+      /* TSK_MediumFrequencyTaskM1 */
+      Result.bApplied = RunMF((int16_t)wIqref, &Result.RsOhm);
+      Plant.RsFiltered += (RS_EST_BANDWIDTH_RPS / MEDIUM_FREQUENCY_TASK_RATE) * (Plant.Rs - Plant.RsFiltered);
+      if (true == Result.bApplied)
+      {
+        Result.MaxTrackPct = fmax(Result.MaxTrackPct,
+                                  fabs((100.0 * (Result.RsOhm - Plant.RsFiltered)) / Plant.RsFiltered));
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    IntegratePeriod();
+  }
+  Result.PlantRsOhm = Plant.Rs;
+  /* MC_REG_WINDING_TEMP */
+  Result.hTempC = (int16_t)RSTEMP_getTempCelcius(&RSTemp);
+  Result.PlantTempC = RS_EST_RATED_CELSIUS + (((Plant.Rs / RS) - 1.0) / COPPER_TEMPCO);
+  return (Result);
+}
+
+int main(void)
+{
+  const Case_t Cases[] =
+  {
+    {300.0,  5.0, 0.0,  true},
+    {3000.0, 5.0, 0.0,  true},
+    {3000.0, 1.0, 0.0,  true},
+    {3000.0, 0.5, 0.0,  false},
+    {3000.0, 5.0, 10.0, true},
+    {6500.0, 5.0, 0.0,  true},
+    {9000.0, 5.0, 0.0,  true},
+  };
+  int Failures = 0;
+  size_t i;
+
+  FIXPMATH_init();
+  printf("Resistance from %.3f to %.3f Ohm, %.2f A at %d Hz on the d axis, dead time %.2f V\n\n", RS,
+         RS * (1.0 + RS_RISE), RS_EST_INJECTION_CURRENT_A, RS_EST_INJECTION_FREQ_HZ, DEADTIME_V);
+  printf("%8s %8s %8s  %9s  %9s %9s  %8s %8s\n", "rpm", "load A", "angle", "max error", "estimate", "windings",
+         "register", "windings");
+  for (i = 0; i < (sizeof(Cases) / sizeof(Cases[0])); i++)
+  {
+    Result_t Result = Run(&Cases[i]);
+    bool bPassed = (false == Cases[i].bEstimated)
+                   ? (false == Result.bApplied)
+                   : (Result.bApplied && (Result.MaxTrackPct < TRACK_PCT)
+                      && (fabs((double)Result.hTempC - Result.PlantTempC) < TEMP_C));
+
+    printf("%8.0f %8.1f %6.0f d  %7.2f %%  %9.4f %9.4f  %6d C %6.0f C  %s\n", Cases[i].SpeedRpm, Cases[i].LoadA,
+           Cases[i].AngleErrorDeg, Result.MaxTrackPct, Result.RsOhm, Result.PlantRsOhm, Result.hTempC,
+           Result.PlantTempC, bPassed ? (Cases[i].bEstimated ? "ok" : "ok, paused") : "FAILED");
+    Failures += bPassed ? 0 : 1;
+  }
+  printf("\nLimits once applied: resistance within %.0f %%, final temperature within %.0f C\n", TRACK_PCT, TEMP_C);
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,626 @@
+/**
+  ******************************************************************************
+  * @file    sched_sim.c
+  * @brief   Host test of the Task Scheduler on a simulated tick source,
+  *          interrupt priorities and cycle counter.
+  *
+  * The firmware scheduler runs the task table of mc_tasks.c, one motor, on
+  * a simulated core at SystemCoreClock whose DWT cycle counter is the
+  * simulated time. The interrupts preempt by priority as on the device:
+  *
+  * - the current control interrupt, every PWM period, for HF_COST_US;
+  * - the SysTick, at SYS_TICK_FREQUENCY, releasing the MCP task when a
+  *   packet is pending then running SCHED_Tick, and the TIM1 break, at the
+  *   SysTick priority, triggering the safety task;
+  * - PendSV, the lowest priority, running the deferred tasks.
+  *
+  * The Medium Frequency and safety tasks take MF_COST_US and SAFETY_COST_US.
+  * The MCP traffic is run in turn:
+  *
+  * - none, giving the reference start jitter of the Medium Frequency task;
+  * - periodic: a packet every PACKET_TICKS, taking PACKET_COST_US, and every
+  *   LONG_TICKS, a packet taking several ticks and a packet longer than the
+  *   MCP deadline;
+  * - a register read flood: a GET_DATA_ELEMENT batch taking FLOOD_COST_US,
+  *   longer than the time left to the MCP task, sent as soon as the answer
+  *   to the previous one is received, as the ASPEP controller must;
+  * - the same flood sent every FLOOD_TICKS without waiting for the answers,
+  *   so that the packets are received during the job of the previous one.
+  *   The transport layer holds one packet: it re-arms its receiver once the
+  *   MCP task has taken the pending packet, and a packet sent in between is
+  *   lost;
+  * - the same flood parsed in the SysTick after the Medium Frequency task,
+  *   as MC_RunMotorControlTasks did before the MCP task was deferred.
+  *
+  * The Medium Frequency task must be released on every other tick with a
+  * start jitter below JITTER_US, the same as without traffic whatever the
+  * MCP load, the safety task on each tick and break, and each packet taken
+  * answered. A flood waiting for the answers must lose no packet and miss
+  * no deadline; without waiting, exactly the packets sent while one is
+  * pending must be lost. The deadline misses counted by the scheduler must
+  * be those of the packets, its response times those measured here, a
+  * release while the job is pending merged with it as an overrun, and a
+  * packet received during the job of the previous one counted once as an
+  * overrun, however long it waits. The tick deadlines of mc_tasks.c must elapse on time across the
+  * wrap of the tick counter.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: sched_sim
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "parameters_conversion.h"
+#include "mc_scheduler.h"
+#include "stm32g4xx.h"
+
+/* Core registers of the scheduler on the simulated core */
+static DWT_Type HostDWT;
+static SCB_Type HostSCB;
+static CoreDebug_Type HostCoreDebug;
+#undef DWT
+#undef SCB
+#undef CoreDebug
+#define DWT                     (&HostDWT)
+#define SCB                     (&HostSCB)
+#define CoreDebug               (&HostCoreDebug)
+#include "mc_scheduler.c"
+
+uint32_t SystemCoreClock = 170000000U;
+
+/* Simulated ticks */
+#define SIM_TICKS               20000U
+/* Execution times of the interrupts and tasks, us */
+#define HF_COST_US              12.0
+#define TICK_COST_US            2.0
+#define MF_COST_US              40.0
+#define SAFETY_COST_US          5.0
+#define PACKET_COST_US          150.0
+#define LONG_COST_US            1000.0
+#define OVERLONG_COST_US        2000.0
+#define FLOOD_COST_US           1200.0
+/* Packet arrivals, ticks */
+#define PACKET_TICKS            10U
+#define LONG_TICKS              1000U
+#define LONG_PHASE              505U
+#define OVERLONG_PHASE          751U
+#define FLOOD_TICKS             3U
+#define BREAK_TICKS             3333U
+/* Largest start jitter of the Medium Frequency task after the tick, us */
+#define JITTER_US               25.0
+
+/* MCP traffic */
+typedef enum
+{
+  TRAFFIC_NONE = 0,
+  TRAFFIC_PERIODIC,
+  TRAFFIC_FLOOD,                           /* Each packet sent once the previous one is answered */
+  TRAFFIC_FLOOD_UNPACED,                   /* Sent every FLOOD_TICKS, answered or not */
+  TRAFFIC_FLOOD_INLINE                     /* Unpaced, parsed in the SysTick, the previous design */
+} Traffic_t;
+
+/* Task table of mc_tasks.c, one motor */
+#define MC_TASK_MF_M1           0U
+#define MC_TASK_SAFETY          1U
+#define MC_TASK_MCP             2U
+#define MC_TASK_NBR             3U
+#define MC_TASK_PERIOD_TICKS(hz) ((uint16_t)(SYS_TICK_FREQUENCY / (hz)))
+#define MC_TICK_US              ((uint16_t)(1000000U / SYS_TICK_FREQUENCY))
+#define MC_MCP_DEADLINE_US      2000U
+
+#define CYCLES(us)              ((uint64_t)((us) * (double)SystemCoreClock / 1.0e6))
+
+typedef enum
+{
+  LEVEL_THREAD = 0,
+  LEVEL_PENDSV,
+  LEVEL_TICK,                              /* SysTick and TIM1 break */
+  LEVEL_HF
+} Level_t;
+
+static void TSK_MediumFrequencyTasksM1(void);
+static void TSK_SafetyTask(void);
+static void TSK_MCPTask(void);
+
+static const SCHED_Task_t MCTasks[MC_TASK_NBR] =
+{
+  [MC_TASK_MF_M1] =
+  {
+    .pFct        = &TSK_MediumFrequencyTasksM1,
+    .hPeriod     = MC_TASK_PERIOD_TICKS(MEDIUM_FREQUENCY_TASK_RATE),
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_TICK_US,
+    .bPriority   = 0U,
+    .Context     = SCHED_TICK,
+  },
+  [MC_TASK_SAFETY] =
+  {
+    .pFct        = &TSK_SafetyTask,
+    .hPeriod     = 1U,
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_TICK_US,
+    .bPriority   = 1U,
+    .Context     = SCHED_TICK,
+  },
+  [MC_TASK_MCP] =
+  {
+    .pFct        = &TSK_MCPTask,
+    .hPeriod     = 0U,
+    .hPhase      = 0U,
+    .hDeadlineUs = MC_MCP_DEADLINE_US,
+    .bPriority   = 2U,
+    .Context     = SCHED_DEFERRED,
+  },
+};
+
+static SCHED_TaskState_t MCTaskStates[MC_TASK_NBR];
+
+static SCHED_Handle_t MCTaskScheduler =
+{
+  .pTasks   = MCTasks,
+  .pStates  = MCTaskStates,
+  .bTaskNbr = MC_TASK_NBR,
+};
+
+/* Simulated core */
+static Traffic_t Traffic;
+static uint64_t Now;
+static Level_t Level = LEVEL_THREAD;
+static uint64_t NextHF;
+static uint64_t NextTick;
+static uint64_t NextBreak;
+static uint64_t LastTick;
+static uint32_t Ticks;
+
+/* Packets received by the transport layer, and their answers */
+static bool bPacketPending;
+static bool bAnswerDue;                    /* Packet taken, its answer not sent yet */
+static uint64_t PacketArrival;
+static double PacketCostUs;
+static uint32_t Packets;
+static uint32_t Overlong;
+static uint32_t Dropped;
+static uint32_t Overlapping;
+
+/* Measures */
+static uint32_t MFRuns;
+static uint32_t MFOddTicks;
+static uint64_t MaxJitter;
+static uint32_t SafetyRuns;
+static uint32_t Breaks;
+static uint32_t Answers;
+static uint64_t MaxPacketResponse;
+static uint32_t PacketsLate;
+
+static void SetNow(uint64_t Time)
+{
+  Now = Time;
+  HostDWT.CYCCNT = (uint32_t)Now;
+}
+
+static void RunPendSV(void);
+
+/* Runs an interrupt at its level, the interrupted level resumed at the end */
+static void RunInterrupt(Level_t IrqLevel, void (*pHandler)(void))
+{
+  Level_t Interrupted = Level;
+
+  Level = IrqLevel;
+  pHandler();
+  Level = Interrupted;
+  if ((Level < LEVEL_PENDSV) && (0U != (HostSCB.ICSR & SCB_ICSR_PENDSVSET_Msk)))
+  {
+    /* Tail chained */
+    RunPendSV();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+static void Consume(uint64_t Cycles);
+static void TSK_MCPTask(void);
+
+static void HF_Handler(void)
+{
+  NextHF += CYCLES(1.0e6 / PWM_FREQUENCY);
+  Consume(CYCLES(HF_COST_US));
+}
+
+/* ASPEP_HWDataReceivedIT, just before the tick */
+static void Receive(double CostUs)
+{
+  Packets++;
+  if (true == bPacketPending)
+  {
+    /* Not taken, the transport layer still holds the pending one */
+    Dropped++;
+  }
+  else
+  {
+    bPacketPending = true;
+    bAnswerDue = true;
+    PacketArrival = Now;
+    PacketCostUs = CostUs;
+    Overlapping += (true == MCTaskStates[MC_TASK_MCP].bRunning) ? 1U : 0U;
+  }
+}
+
+/* MC_TriggerMCPTask */
+static void MC_TriggerMCPTask(void)
+{
+  if (true == SCHED_IsPending(&MCTaskScheduler, MC_TASK_MCP))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    SCHED_Trigger(&MCTaskScheduler, MC_TASK_MCP);
+  }
+}
+
+/* SysTick_Handler: packet pending and MC_TriggerMCPTask, then MC_RunMotorControlTasks */
+static void SysTick_Handler(void)
+{
+  uint32_t Phase;
+
+  LastTick = NextTick;
+  NextTick += CYCLES(1.0e6 / SYS_TICK_FREQUENCY);
+  Ticks++;
+  Consume(CYCLES(TICK_COST_US));
+
+  /* The traffic stops at the end of the simulation, the flood keeping the MCP task busy */
+  Phase = Ticks % LONG_TICKS;
+  if (Ticks > SIM_TICKS)
+  {
+    /* Nothing to do */
+  }
+  else if (TRAFFIC_PERIODIC == Traffic)
+  {
+    if ((0U == (Ticks % PACKET_TICKS)) || (LONG_PHASE == Phase) || (OVERLONG_PHASE == Phase))
+    {
+      Receive((LONG_PHASE == Phase) ? LONG_COST_US : ((OVERLONG_PHASE == Phase) ? OVERLONG_COST_US : PACKET_COST_US));
+      Overlong += (OVERLONG_PHASE == Phase) ? 1U : 0U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else if (TRAFFIC_FLOOD == Traffic)
+  {
+    if (false == bAnswerDue)
+    {
+      Receive(FLOOD_COST_US);
+    }
+    else
+    {
+      /* Nothing to do, the controller waits for the answer */
+    }
+  }
+  else if ((TRAFFIC_NONE != Traffic) && (0U == (Ticks % FLOOD_TICKS)))
+  {
+    Receive(FLOOD_COST_US);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (TRAFFIC_FLOOD_INLINE == Traffic)
+  {
+    SCHED_Tick(&MCTaskScheduler);
+    TSK_MCPTask();
+  }
+  else
+  {
+    if (true == bPacketPending)
+    {
+      MC_TriggerMCPTask();
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    SCHED_Tick(&MCTaskScheduler);
+  }
+
+  /* The SysTick is pended once, whatever the periods elapsed during the handler */
+  while ((NextTick + CYCLES(1.0e6 / SYS_TICK_FREQUENCY)) <= Now)
+  {
+    NextTick += CYCLES(1.0e6 / SYS_TICK_FREQUENCY);
+  }
+}
+
+/* TIM1_BRK_TIM15_IRQHandler: MC_TriggerSafetyTask */
+static void Break_Handler(void)
+{
+  NextBreak += CYCLES(BREAK_TICKS * 1.0e6 / SYS_TICK_FREQUENCY);
+  Breaks++;
+  SCHED_Trigger(&MCTaskScheduler, MC_TASK_SAFETY);
+}
+
+/* PendSV_Handler: MC_RunDeferredTasks */
+static void PendSV_Handler(void)
+{
+  SCHED_RunDeferred(&MCTaskScheduler);
+}
+
+static void RunPendSV(void)
+{
+  Level_t Interrupted = Level;
+
+  HostSCB.ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+  Level = LEVEL_PENDSV;
+  PendSV_Handler();
+  Level = Interrupted;
+}
+
+/* Executes for a number of cycles at the present level, preempted by the higher interrupts */
+static void Consume(uint64_t Cycles)
+{
+  uint64_t Remaining = Cycles;
+
+  while (Remaining > 0U)
+  {
+    uint64_t Due = UINT64_MAX;
+    Level_t IrqLevel = LEVEL_THREAD;
+    void (*pHandler)(void) = MC_NULL;
+
+    if (Level < LEVEL_HF)
+    {
+      Due = NextHF;
+      IrqLevel = LEVEL_HF;
+      pHandler = &HF_Handler;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if ((Level < LEVEL_TICK) && (NextTick < Due))
+    {
+      Due = NextTick;
+      IrqLevel = LEVEL_TICK;
+      pHandler = &SysTick_Handler;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if ((Level < LEVEL_TICK) && (NextBreak < Due))
+    {
+      Due = NextBreak;
+      IrqLevel = LEVEL_TICK;
+      pHandler = &Break_Handler;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if ((MC_NULL != pHandler) && (Due < (Now + Remaining)))
+    {
+      if (Due > Now)
+      {
+        Remaining -= Due - Now;
+        SetNow(Due);
+      }
+      else
+      {
+        /* Nothing to do, pending since the level was lowered */
+      }
+      RunInterrupt(IrqLevel, pHandler);
+    }
+    else
+    {
+      SetNow(Now + Remaining);
+      Remaining = 0U;
+    }
+  }
+}
+
+/* Tasks */
+static void TSK_MediumFrequencyTasksM1(void)
+{
+  uint64_t Jitter = Now - LastTick;
+
+  MaxJitter = (Jitter > MaxJitter) ? Jitter : MaxJitter;
+  MFOddTicks += (1U == (Ticks % 2U)) ? 1U : 0U;
+  MFRuns++;
+  Consume(CYCLES(MF_COST_US));
+}
+
+static void TSK_SafetyTask(void)
+{
+  SafetyRuns++;
+  Consume(CYCLES(SAFETY_COST_US));
+}
+
+/* TSK_MCPTask: the transport layer hands the packet over, the answer is sent at the end */
+static void TSK_MCPTask(void)
+{
+  if (true == bPacketPending)
+  {
+    uint64_t Arrival = PacketArrival;
+    uint64_t Response;
+
+    bPacketPending = false;
+    Consume(CYCLES(PacketCostUs));
+    Response = Now - Arrival;
+    MaxPacketResponse = (Response > MaxPacketResponse) ? Response : MaxPacketResponse;
+    PacketsLate += (Response > CYCLES(MC_MCP_DEADLINE_US)) ? 1U : 0U;
+    Answers++;
+    bAnswerDue = bPacketPending;
+  }
+  else
+  {
+    /* Nothing to do, no packet */
+  }
+}
+
+/* TSK_ChargeBootCapDelayHasElapsedM1 on a deadline set by TSK_SetChargeBootCapDelayM1 */
+static bool DeadlineElapsed(uint32_t wEnd)
+{
+  return ((int32_t)(SCHED_GetTick(&MCTaskScheduler) - wEnd) >= 0);
+}
+
+static int Failures;
+static double UsPerCycle;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+/* Runs SIM_TICKS ticks of an MCP traffic from the reset of the scheduler, and the MCP jobs left */
+static void Simulate(Traffic_t SimTraffic)
+{
+  Traffic = SimTraffic;
+  Level = LEVEL_THREAD;
+  Ticks = 0U;
+  bPacketPending = false;
+  bAnswerDue = false;
+  Packets = 0U;
+  Overlong = 0U;
+  Dropped = 0U;
+  Overlapping = 0U;
+  MFRuns = 0U;
+  MFOddTicks = 0U;
+  MaxJitter = 0U;
+  SafetyRuns = 0U;
+  Breaks = 0U;
+  Answers = 0U;
+  MaxPacketResponse = 0U;
+  PacketsLate = 0U;
+  HostSCB.ICSR = 0U;
+
+  SetNow(0U);
+  SCHED_Init(&MCTaskScheduler);
+  /* The current control interrupt starts 5 us before each tick, delaying it */
+  NextHF = CYCLES(1.0e6 / PWM_FREQUENCY) - CYCLES(5.0);
+  NextTick = CYCLES(1.0e6 / SYS_TICK_FREQUENCY);
+  NextBreak = NextTick + CYCLES(0.5e6 / SYS_TICK_FREQUENCY) + 12345U;
+  while (Ticks < SIM_TICKS)
+  {
+    Consume(CYCLES(1.0));
+  }
+}
+
+static void PrintStats(const char *pName)
+{
+  const SCHED_TaskState_t *pStates = MCTaskStates;
+  static const char *const pTaskNames[MC_TASK_NBR] = {"MF", "safety", "MCP"};
+  uint8_t i;
+
+  printf("%s: %u packets, %u lost, %u answered\n", pName, Packets, Dropped, Answers);
+  printf("%-8s %8s %9s %9s %14s %15s\n", "task", "runs", "overruns", "deadline", "max exec us", "max response us");
+  for (i = 0U; i < MC_TASK_NBR; i++)
+  {
+    printf("%-8s %8u %9u %9u %14.1f %15.1f\n", pTaskNames[i], pStates[i].wRuns, pStates[i].wOverruns,
+           pStates[i].wDeadlineMisses, pStates[i].wMaxExecCycles * UsPerCycle,
+           pStates[i].wMaxResponseCycles * UsPerCycle);
+  }
+  printf("Medium Frequency task start jitter %.1f us\n\n", (double)MaxJitter * UsPerCycle);
+}
+
+int main(void)
+{
+  const SCHED_TaskState_t *pMF = &MCTaskStates[MC_TASK_MF_M1];
+  const SCHED_TaskState_t *pSafety = &MCTaskStates[MC_TASK_SAFETY];
+  const SCHED_TaskState_t *pMCP = &MCTaskStates[MC_TASK_MCP];
+  uint64_t QuietJitter;
+  uint32_t wEnd;
+  uint32_t i;
+  bool bOnTime = true;
+
+  UsPerCycle = 1.0e6 / (double)SystemCoreClock;
+  printf("%u ticks at %u Hz, current control %.0f us every %.1f us\n\n", SIM_TICKS,
+         (unsigned)SYS_TICK_FREQUENCY, HF_COST_US, 1.0e6 / PWM_FREQUENCY);
+
+  Simulate(TRAFFIC_NONE);
+  QuietJitter = MaxJitter;
+  PrintStats("No MCP traffic");
+
+  Simulate(TRAFFIC_PERIODIC);
+  PrintStats("Periodic packets");
+  Check("MF task released on every other tick, on the odd ones",
+        (Ticks == SIM_TICKS) && (MFRuns == (SIM_TICKS / 2U)) && (MFOddTicks == MFRuns) && (pMF->wRuns == MFRuns));
+  Check("MF task started within the jitter whatever the MCP load", MaxJitter <= CYCLES(JITTER_US));
+  Check("MF and safety tasks without overrun nor deadline miss",
+        (0U == pMF->wOverruns) && (0U == pMF->wDeadlineMisses) && (0U == pSafety->wOverruns)
+        && (0U == pSafety->wDeadlineMisses));
+  Check("safety task run on each tick and each break",
+        (Breaks > 0U) && (SafetyRuns == (Ticks + Breaks)) && (pSafety->wRuns == SafetyRuns));
+  Check("each packet answered, one MCP job per packet",
+        (0U == Dropped) && (Answers == Packets) && (pMCP->wRuns == Packets));
+  Check("MCP task without overrun, the packets not overlapping", (0U == Overlapping) && (0U == pMCP->wOverruns));
+  Check("MCP deadline misses: the packets longer than the deadline",
+        (pMCP->wDeadlineMisses == Overlong) && (PacketsLate == Overlong));
+  Check("MCP response time measured by the cycle counter",
+        (pMCP->wMaxResponseCycles >= MaxPacketResponse)
+        && (pMCP->wMaxResponseCycles <= (MaxPacketResponse + CYCLES(TICK_COST_US + HF_COST_US))));
+  Check("execution times measured, preemptions included",
+        (pMF->wMaxExecCycles >= CYCLES(MF_COST_US)) && (pMF->wMaxExecCycles <= CYCLES(MF_COST_US + (2.0 * HF_COST_US)))
+        && (pMCP->wMaxExecCycles > CYCLES(OVERLONG_COST_US * 1.2)) && (pMCP->wMaxExecCycles < pMCP->wMaxResponseCycles));
+
+  /* Two releases before the job starts: merged, one overrun */
+  Level = LEVEL_TICK;
+  bPacketPending = true;
+  PacketArrival = Now;
+  PacketCostUs = PACKET_COST_US;
+  SCHED_Trigger(&MCTaskScheduler, MC_TASK_MCP);
+  SCHED_Trigger(&MCTaskScheduler, MC_TASK_MCP);
+  Level = LEVEL_THREAD;
+  RunPendSV();
+  Check("release while the job is pending merged and counted as an overrun",
+        (1U == pMCP->wOverruns) && (pMCP->wRuns == (Packets + 1U)) && (Answers == (Packets + 1U)));
+
+  Simulate(TRAFFIC_FLOOD);
+  PrintStats("Register read flood, deferred MCP task");
+  Check("flood: MF task released on every other tick, on the odd ones",
+        (MFRuns == (Ticks / 2U)) && (MFOddTicks == MFRuns) && (pMF->wRuns == MFRuns));
+  Check("flood: MF task start jitter the same as without traffic",
+        (QuietJitter <= CYCLES(JITTER_US)) && (MaxJitter == QuietJitter));
+  Check("flood: MF and safety tasks without overrun nor deadline miss",
+        (0U == pMF->wOverruns) && (0U == pMF->wDeadlineMisses) && (0U == pSafety->wOverruns)
+        && (0U == pSafety->wDeadlineMisses) && (pSafety->wRuns == (Ticks + Breaks)));
+  Check("flood: no packet lost, each answered, one MCP job per packet",
+        (Packets > (SIM_TICKS / (2U * FLOOD_TICKS))) && (0U == Dropped) && (Answers == Packets)
+        && (pMCP->wRuns == Packets));
+  Check("flood: MCP task without overrun nor deadline miss",
+        (0U == Overlapping) && (0U == pMCP->wOverruns) && (0U == pMCP->wDeadlineMisses) && (0U == PacketsLate));
+
+  Simulate(TRAFFIC_FLOOD_UNPACED);
+  PrintStats("Register read flood not waiting for the answers, deferred MCP task");
+  Check("unpaced flood: MF task start jitter the same as without traffic",
+        (MFRuns == (Ticks / 2U)) && (MaxJitter == QuietJitter));
+  Check("unpaced flood: MF and safety tasks without overrun nor deadline miss",
+        (0U == pMF->wOverruns) && (0U == pMF->wDeadlineMisses) && (0U == pSafety->wOverruns)
+        && (0U == pSafety->wDeadlineMisses));
+  Check("unpaced flood: packets sent while one pending lost, others answered",
+        (Dropped > 0U) && ((Answers + Dropped) == Packets) && (pMCP->wRuns == Answers));
+  Check("unpaced flood: an MCP overrun per packet received during a job",
+        (Overlapping > (Answers / 2U)) && (pMCP->wOverruns == Overlapping));
+  Check("unpaced flood: MCP deadline misses those of the late answers",
+        (PacketsLate > 0U) && (pMCP->wDeadlineMisses == PacketsLate));
+
+  Simulate(TRAFFIC_FLOOD_INLINE);
+  PrintStats("Register read flood, parsed in the SysTick (previous design)");
+  Check("flood parsed in the SysTick: MF task start delayed beyond the jitter", MaxJitter > CYCLES(JITTER_US));
+
+  /* Deadlines of mc_tasks.c across the wrap of the tick counter */
+  MCTaskScheduler.wTick = UINT32_MAX - 5U;
+  wEnd = SCHED_GetTick(&MCTaskScheduler) + 10U;
+  for (i = 0U; i < 12U; i++)
+  {
+    bOnTime = bOnTime && (DeadlineElapsed(wEnd) == (i >= 10U));
+    MCTaskScheduler.wTick++;
+  }
+  Check("tick deadlines elapsed on time across the wrap of the tick", bOnTime);
+
+  return ((0 == Failures) ? 0 : 1);
+}
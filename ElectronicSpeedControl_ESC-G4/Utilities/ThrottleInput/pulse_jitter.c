@@ -0,0 +1,562 @@
+/**
+  ******************************************************************************
+  * @file    pulse_jitter.c
+  * @brief   Host test of the Throttle Input decoding on synthetic DShot and
+  *          PWM pulse trains with jitter.
+  *
+  * The firmware throttle input runs with the handle of mc_config.c, its
+  * 32 bits capture timer at SYSCLK_FREQ and the medium frequency task at
+  * MEDIUM_FREQUENCY_TASK_RATE. A flight controller sends its frames every
+  * FRAME_US, asynchronous to the task, each edge moved by a uniform jitter:
+  *
+  * - DShot: the timestamps of the edges are written into the edge ring as
+  *   by the circular DMA, up to the time of the task, which decodes the
+  *   newest complete frame, a frame being received behind it. The clock of
+  *   the timer wraps during the runs;
+  * - PWM: the timer captures the period on the rising edges, setting the
+  *   capture flag cleared by the read of the period, and the pulse width on
+  *   the falling edges, a servo signal at 50 Hz and at 400 Hz.
+  *
+  * The checks:
+  *
+  * - DShot150, DShot300 and DShot600 with JITTER_NS: every frame decoded;
+  * - DShot600 with HIGH_JITTER_NS, short of the threshold margin of a bit:
+  *   frames rejected, none decoded wrong;
+  * - frames with a wrong CRC rejected and counted, the throttle unchanged;
+  * - inverted CRCs of the bidirectional DShot: decoded, the replies enabled
+  *   after THR_BIDIR_FRAMES frames, at 5/4 of the bit rate;
+  * - PWM with PWM_JITTER_US: the pulse converted within a throttle step,
+  *   the pulses beyond THR_PWM_MARGIN_US rejected;
+  * - THR_Task on DShot600: no arming on a throttle at power up, arming
+  *   after THR_ARMING_TIME_MS of null throttle, the motor started on a
+  *   throttle at its speed, a loss shorter than THR_FAILSAFE_TIMEOUT_MS
+  *   ridden through, a longer loss or frames with wrong CRCs stopping and
+  *   disarming on time, and a fault acknowledged by a null throttle.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: pulse_jitter
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "throttle_input.h"
+
+/* Edge ring written by the host DMA, capture timer of the host */
+static uint16_t HostWrite;
+static TIM_TypeDef HostTIM;
+
+static uint32_t HostDMA_GetDataLength(void)
+{
+  return (THR_EDGE_NBR - HostWrite);
+}
+
+/* Reading the capture of the channel 1 clears its flag */
+static uint32_t HostTIM_GetCaptureCH1(TIM_TypeDef *TIMx)
+{
+  TIMx->SR &= ~TIM_SR_CC1IF;
+  return (TIMx->CCR1);
+}
+
+#define LL_DMA_GetDataLength(DMAx, Channel)   HostDMA_GetDataLength()
+#define LL_TIM_IC_GetCaptureCH1(TIMx)          HostTIM_GetCaptureCH1(TIMx)
+#include "throttle_input.c"
+
+/* Medium frequency task period */
+#define MF_US                   (1000000.0 / (double)MEDIUM_FREQUENCY_TASK_RATE)
+/* Frames of the flight controller, asynchronous to the task */
+#define FRAME_US                251.3
+/* Timer clock, ticks per us */
+#define TICKS_PER_US            (SYSCLK_FREQ / 1000000uL)
+/* Timestamp of the start, the clock wraps after WRAP_MS */
+#define WRAP_MS                 700U
+/* Jitter of the edges, +/- */
+#define JITTER_NS               80.0
+#define HIGH_JITTER_NS          200.0
+#define PWM_JITTER_US           1.0
+/* Frames and pulses decoded by each case, task periods */
+#define DECODE_MS               5000U
+/* Bit periods */
+#define DSHOT150_NS             (1.0e9 / 150000.0)
+#define DSHOT300_NS             (1.0e9 / 300000.0)
+#define DSHOT600_NS             (1.0e9 / 600000.0)
+
+/* Motor of the host, started and stopped through the MC interface */
+static MCI_Handle_t HostMCI;
+static MCI_State_t HostState;
+static uint32_t HostStarts;
+static uint32_t HostAcks;
+static int16_t HostTarget;
+
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  return (HostState);
+}
+
+bool MCI_StartMotor(MCI_Handle_t *pHandle)
+{
+  bool bStarted = (IDLE == HostState) ? true : false;
+
+  HostStarts += bStarted ? 1U : 0U;
+  HostState = bStarted ? RUN : HostState;
+  return (bStarted);
+}
+
+bool MCI_StopMotor(MCI_Handle_t *pHandle)
+{
+  HostState = IDLE;
+  return (true);
+}
+
+bool MCI_FaultAcknowledged(MCI_Handle_t *pHandle)
+{
+  HostAcks++;
+  HostState = (FAULT_OVER == HostState) ? IDLE : HostState;
+  return (true);
+}
+
+void MCI_ExecSpeedRamp(MCI_Handle_t *pHandle, int16_t hFinalSpeed, uint16_t hDurationms)
+{
+  HostTarget = hFinalSpeed;
+}
+
+void MCI_ExecTorqueRamp(MCI_Handle_t *pHandle, int16_t hFinalTorque, uint16_t hDurationms)
+{
+  HostTarget = hFinalTorque;
+}
+
+/* Handle of mc_config.c on the host timer and motor */
+static const THR_Handle_t ThrottleConfig =
+{
+  .TIMx           = &HostTIM,
+  .pMCI           = &HostMCI,
+  .Protocol       = THR_DSHOT,
+  .ControlMode    = MCM_SPEED_MODE,
+  .hTicksPerUs    = (uint16_t)(SYSCLK_FREQ / 1000000uL),
+  .hPulseMin      = THR_PWM_MIN_US,
+  .hPulseMax      = THR_PWM_MAX_US,
+  .hGapMin        = THR_DSHOT_GAP_US,
+  .hArmingTime    = (uint16_t)THR_ARMING_TIME,
+  .hFailsafeTime  = (uint16_t)THR_FAILSAFE_TIMEOUT,
+  .hSpeedMin      = (int16_t)THR_SPEED_MIN_UNIT,
+  .hSpeedMax      = (int16_t)THR_SPEED_MAX_UNIT,
+  .hTorqueMax     = (int16_t)THR_TORQUE_MAX,
+  .hRampDuration  = THR_RAMP_DURATION_MS,
+  .hTurnaround    = THR_TURNAROUND_US,
+  .hPolePairs     = POLE_PAIR_NUM,
+};
+
+static THR_Handle_t Throttle;
+
+static uint32_t Seed = 1U;
+
+/* Uniform in [-Range, Range] */
+static double Jitter(double Range)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Range * ((2.0 * (double)(Seed >> 8) / 16777216.0) - 1.0));
+}
+
+static uint16_t RandomThrottle(void)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return ((uint16_t)(1U + ((Seed >> 8) % THR_FULL_SCALE)));
+}
+
+/* Signal sent by the flight controller */
+typedef enum
+{
+  SEND_FRAMES = 0,
+  SEND_NOTHING,                   /* Signal lost */
+  SEND_BAD_CRC                    /* Each frame with a wrong CRC */
+} Send_t;
+
+typedef struct
+{
+  double Us;                      /* Time of the edge since the start */
+  int16_t hThrottle;              /* Throttle of the frame ended by this edge, -1 if wrong, -2 if none */
+} Edge_t;
+
+/* Edges sent and not yet captured */
+#define PENDING_NBR             256U
+static Edge_t Pending[PENDING_NBR];
+static uint16_t PendingHead;
+static uint16_t PendingTail;
+
+/* Flight controller */
+static double BitNs;
+static double JitterNs;
+static bool bInvertedCrc;
+static double NowUs;
+static double NextFrameUs;
+static double LastRiseUs;
+static uint16_t FrameCount;
+/* Frames captured since the previous task, throttle of the newest, newest pulse */
+static uint16_t NewFrames;
+static int16_t hLastThrottle;
+static double LastPulseUs;
+static double PendingFallUs;
+
+static uint32_t Ticks(double Us)
+{
+  uint64_t Start = ((uint64_t)1U << 32U) - ((uint64_t)WRAP_MS * 1000U * TICKS_PER_US);
+
+  return ((uint32_t)(Start + (uint64_t)llround(Us * (double)TICKS_PER_US)));
+}
+
+static void Reset(const THR_Handle_t *pConfig, double Bit, double Jitter)
+{
+  Throttle = *pConfig;
+  HostWrite = 0U;
+  HostTIM.SR = 0U;
+  HostState = IDLE;
+  HostStarts = 0U;
+  HostAcks = 0U;
+  HostTarget = 0;
+  BitNs = Bit;
+  JitterNs = Jitter;
+  bInvertedCrc = false;
+  NowUs = 0.0;
+  NextFrameUs = FRAME_US / 2.0;
+  LastRiseUs = 0.0;
+  FrameCount = 0U;
+  PendingHead = 0U;
+  PendingTail = 0U;
+  NewFrames = 0U;
+  hLastThrottle = -2;
+  LastPulseUs = 0.0;
+  PendingFallUs = 0.0;
+}
+
+/* 32 edges of a DShot frame: the high level of a 1 lasts 3/4 of the bit, of a 0 3/8 */
+static void SendDShot(uint16_t hThrottle, bool bBadCrc)
+{
+  uint16_t hValue = (0U == hThrottle) ? 0U : (uint16_t)(hThrottle + THR_DSHOT_CMD_MAX);
+  uint16_t hData = (uint16_t)(hValue << 1U);
+  uint16_t hCrc = (hData ^ (hData >> 4U) ^ (hData >> 8U)) & 0x0FU;
+  uint16_t hFrame;
+  uint16_t i;
+
+  hCrc = bInvertedCrc ? ((~hCrc) & 0x0FU) : hCrc;
+  hCrc ^= bBadCrc ? (uint16_t)(1U << (FrameCount % 4U)) : 0U;
+  hFrame = (uint16_t)(hData << 4U) | hCrc;
+  for (i = 0U; i < THR_DSHOT_BITS; i++)
+  {
+    double RiseUs = NextFrameUs + (((double)i * BitNs) / 1000.0);
+    double High = (0U == ((hFrame >> (THR_DSHOT_BITS - 1U - i)) & 1U)) ? 0.375 : 0.75;
+
+    Pending[PendingHead].Us = RiseUs + (Jitter(JitterNs) / 1000.0);
+    Pending[PendingHead].hThrottle = -2;
+    PendingHead = (uint16_t)((PendingHead + 1U) % PENDING_NBR);
+    Pending[PendingHead].Us = RiseUs + (((High * BitNs) + Jitter(JitterNs)) / 1000.0);
+    Pending[PendingHead].hThrottle = bBadCrc ? -1 : (int16_t)hThrottle;
+    Pending[PendingHead].hThrottle = (i < (THR_DSHOT_BITS - 1U)) ? -2 : Pending[PendingHead].hThrottle;
+    PendingHead = (uint16_t)((PendingHead + 1U) % PENDING_NBR);
+  }
+}
+
+/* Frames sent up to the next task, and the edges captured */
+static void SendDShotPeriod(Send_t Send, uint16_t hThrottle)
+{
+  NowUs += MF_US;
+  while (NextFrameUs <= NowUs)
+  {
+    if (SEND_NOTHING == Send)
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      SendDShot((0U == hThrottle) ? 0U : ((UINT16_MAX == hThrottle) ? RandomThrottle() : hThrottle),
+                (SEND_BAD_CRC == Send) ? true : false);
+    }
+    FrameCount++;
+    NextFrameUs += FRAME_US;
+  }
+  while ((PendingTail != PendingHead) && (Pending[PendingTail].Us <= NowUs))
+  {
+    Throttle.wEdges[HostWrite] = Ticks(Pending[PendingTail].Us);
+    HostWrite = THR_IDX(HostWrite + 1U);
+    if (Pending[PendingTail].hThrottle > -2)
+    {
+      hLastThrottle = Pending[PendingTail].hThrottle;
+      NewFrames++;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    PendingTail = (uint16_t)((PendingTail + 1U) % PENDING_NBR);
+  }
+}
+
+/* Servo pulses of the throttle up to the next task, captured on their rising and falling edges */
+static void SendPWMPeriod(double PeriodUs, double PulseUs)
+{
+  bool bSending = true;
+
+  NowUs += MF_US;
+  while (true == bSending)
+  {
+    if ((PendingFallUs > 0.0) && (PendingFallUs <= NowUs))
+    {
+      HostTIM.CCR2 = Ticks(PendingFallUs) - Ticks(LastRiseUs);
+      LastPulseUs = PendingFallUs - LastRiseUs;
+      PendingFallUs = 0.0;
+    }
+    else if ((PendingFallUs <= 0.0) && (NextFrameUs <= NowUs))
+    {
+      double RiseUs = NextFrameUs + (Jitter(JitterNs) / 1000.0);
+
+      HostTIM.CCR1 = Ticks(RiseUs) - Ticks(LastRiseUs);
+      HostTIM.SR |= TIM_SR_CC1IF;
+      LastRiseUs = RiseUs;
+      PendingFallUs = RiseUs + PulseUs + (Jitter(JitterNs) / 1000.0);
+      NextFrameUs += PeriodUs;
+    }
+    else
+    {
+      bSending = false;
+    }
+  }
+}
+
+/* Outcome of the decoding of the newest frames */
+typedef struct
+{
+  uint32_t Decoded;
+  uint32_t Wrong;
+  uint32_t Rejected;
+  uint32_t Lost;
+} Decoding_t;
+
+/* THR_ReadDShot on each task, against the newest frame sent */
+static Decoding_t DecodeDShot(double Bit, double Jitter, uint16_t hBadEvery)
+{
+  Decoding_t Result = {0U, 0U, 0U, 0U};
+  uint32_t k;
+
+  Reset(&ThrottleConfig, Bit, Jitter);
+  for (k = 0U; k < DECODE_MS; k++)
+  {
+    uint16_t hThrottle = 0U;
+    bool bValid;
+
+    NewFrames = 0U;
+    SendDShotPeriod(((0U != hBadEvery) && (0U == (k % hBadEvery))) ? SEND_BAD_CRC : SEND_FRAMES, UINT16_MAX);
+    bValid = THR_ReadDShot(&Throttle, &hThrottle);
+
+    if ((0U == NewFrames) || (hLastThrottle < 0))
+    {
+      Result.Wrong += bValid ? 1U : 0U;
+      Result.Rejected += ((0U != NewFrames) && (false == bValid)) ? 1U : 0U;
+    }
+    else if (true == bValid)
+    {
+      Result.Decoded += (hThrottle == (uint16_t)hLastThrottle) ? 1U : 0U;
+      Result.Wrong += (hThrottle == (uint16_t)hLastThrottle) ? 0U : 1U;
+    }
+    else
+    {
+      Result.Rejected += (Throttle.hFrameErrors > 0U) ? 1U : 0U;
+      Result.Lost += (Throttle.hFrameErrors > 0U) ? 0U : 1U;
+      Throttle.hFrameErrors = 0U;
+    }
+  }
+  return (Result);
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+static void Print(const char *pName, Decoding_t Result)
+{
+  printf("%-28s decoded %5u, wrong %u, rejected %4u, lost %u\n", pName, Result.Decoded, Result.Wrong,
+         Result.Rejected, Result.Lost);
+}
+
+/* Runs THR_Task on DShot600 frames of a throttle, returns the task periods until the state is reached */
+static uint32_t RunTask(uint32_t Ms, Send_t Send, uint16_t hThrottle, THR_State_t Until)
+{
+  uint32_t k;
+
+  for (k = 0U; k < Ms; k++)
+  {
+    SendDShotPeriod(Send, hThrottle);
+    THR_Task(&Throttle);
+    if (Until == Throttle.State)
+    {
+      break;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (k + 1U);
+}
+
+int main(void)
+{
+  static const double Bits[3] = {DSHOT150_NS, DSHOT300_NS, DSHOT600_NS};
+  static const char *pNames[3] = {"DShot150", "DShot300", "DShot600"};
+  bool bDecoded = true;
+  Decoding_t Result;
+  uint32_t Ms;
+  uint16_t i;
+
+  printf("Frames every %.1f us, task every %.0f us, timer at %lu MHz\n\n", FRAME_US, MF_US, TICKS_PER_US);
+
+  /* Decoding */
+  for (i = 0U; i < 3U; i++)
+  {
+    char Name[40];
+
+    Result = DecodeDShot(Bits[i], JITTER_NS, 0U);
+    (void)snprintf(Name, sizeof(Name), "%s, +/-%.0f ns", pNames[i], JITTER_NS);
+    Print(Name, Result);
+    bDecoded = bDecoded && (DECODE_MS == Result.Decoded);
+  }
+  Check("DShot150, 300 and 600 with jitter: every frame decoded", bDecoded);
+
+  Result = DecodeDShot(DSHOT600_NS, HIGH_JITTER_NS, 0U);
+  Print("DShot600, +/-200 ns", Result);
+  Check("DShot600 with high jitter: frames rejected, none decoded wrong", (0U == Result.Wrong) && (Result.Rejected > 0U)
+        && (0U == Result.Lost));
+
+  Result = DecodeDShot(DSHOT300_NS, JITTER_NS, 3U);
+  Print("DShot300, wrong CRCs", Result);
+  Check("wrong CRCs rejected and counted", (0U == Result.Wrong) && (0U == Result.Lost)
+        && (Result.Rejected > (DECODE_MS / 4U)) && ((Result.Decoded + Result.Rejected) == DECODE_MS));
+
+  /* Bidirectional DShot */
+  Reset(&ThrottleConfig, DSHOT600_NS, JITTER_NS);
+  bInvertedCrc = true;
+  Ms = 0U;
+  bDecoded = true;
+  while ((false == Throttle.bBidirectional) && (Ms < DECODE_MS))
+  {
+    uint16_t hThrottle = 0U;
+
+    SendDShotPeriod(SEND_FRAMES, UINT16_MAX);
+    bDecoded = bDecoded && THR_ReadDShot(&Throttle, &hThrottle) && (hThrottle == (uint16_t)hLastThrottle);
+    Ms++;
+  }
+  Check("inverted CRCs decoded, replies after THR_BIDIR_FRAMES frames",
+        bDecoded && (THR_BIDIR_FRAMES == Ms)
+        && (fabs((double)Throttle.wReplyBit - ((0.8 * DSHOT600_NS * (double)TICKS_PER_US) / 1000.0))
+            < (0.01 * (double)Throttle.wReplyBit)));
+
+  /* PWM at 50 Hz and 400 Hz */
+  bDecoded = true;
+  for (i = 0U; i < 2U; i++)
+  {
+    double PeriodUs = (0U == i) ? 20000.0 : 2500.0;
+    uint32_t Reads = 0U;
+    uint32_t k;
+
+    Reset(&ThrottleConfig, 0.0, 1000.0 * PWM_JITTER_US);
+    Throttle.Protocol = THR_PWM;
+    for (k = 0U; k < DECODE_MS; k++)
+    {
+      double PulseUs = (double)THR_PWM_MIN_US + ((double)(THR_PWM_MAX_US - THR_PWM_MIN_US) * (double)(k % 1000U) / 1000.0);
+      uint16_t hThrottle = 0U;
+      bool bPeriod;
+
+      SendPWMPeriod(PeriodUs, PulseUs);
+      bPeriod = (0U != (HostTIM.SR & TIM_SR_CC1IF)) ? true : false;
+      if (0.0 == LastPulseUs)
+      {
+        /* No pulse captured yet */
+        (void)THR_ReadPWM(&Throttle, &hThrottle);
+        Throttle.hFrameErrors = 0U;
+      }
+      else if (true == THR_ReadPWM(&Throttle, &hThrottle))
+      {
+        double Expected = ((LastPulseUs - (double)THR_PWM_MIN_US) * (double)THR_FULL_SCALE)
+                        / (double)(THR_PWM_MAX_US - THR_PWM_MIN_US);
+
+        Expected = (Expected < 0.0) ? 0.0 : ((Expected > (double)THR_FULL_SCALE) ? (double)THR_FULL_SCALE : Expected);
+        bDecoded = bDecoded && (fabs((double)hThrottle - Expected) <= 1.0);
+        Reads++;
+      }
+      else
+      {
+        bDecoded = bDecoded && (false == bPeriod);
+      }
+    }
+    printf("PWM, %3.0f Hz, +/-%.0f us      read %u pulses, %u errors\n", 1.0e6 / PeriodUs, PWM_JITTER_US, Reads,
+           Throttle.hFrameErrors);
+    bDecoded = bDecoded && ((double)Reads >= (((double)DECODE_MS * MF_US) / PeriodUs) - 2.0);
+  }
+  Check("PWM with jitter: every period read, pulse within a throttle step", bDecoded);
+
+  {
+    uint16_t hThrottle = 1U;
+    uint32_t wTicks = TICKS_PER_US;
+    bool bRange = (false == THR_PulseToThrottle(&ThrottleConfig, wTicks * 750U, wTicks * 2500U, &hThrottle))
+                  && (false == THR_PulseToThrottle(&ThrottleConfig, wTicks * 2250U, wTicks * 2500U, &hThrottle))
+                  && (false == THR_PulseToThrottle(&ThrottleConfig, wTicks * 2000U, wTicks * 1900U, &hThrottle));
+
+    bRange = bRange && THR_PulseToThrottle(&ThrottleConfig, wTicks * 850U, wTicks * 2500U, &hThrottle)
+             && (0U == hThrottle);
+    bRange = bRange && THR_PulseToThrottle(&ThrottleConfig, wTicks * 2150U, wTicks * 2500U, &hThrottle)
+             && (THR_FULL_SCALE == hThrottle);
+    Check("PWM pulses beyond THR_PWM_MARGIN_US rejected, within clamped", bRange);
+  }
+
+  /* Arming and failsafe of THR_Task on DShot600 */
+  Reset(&ThrottleConfig, DSHOT600_NS, JITTER_NS);
+  (void)RunTask(1000U, SEND_FRAMES, 500U, THR_ARMED);
+  Check("throttle at power up: not armed", (THR_DISARMED == Throttle.State) && (0U == HostStarts));
+
+  Ms = RunTask(2U * THR_ARMING_TIME_MS, SEND_FRAMES, 0U, THR_ARMED);
+  printf("armed after %u ms of null throttle\n", Ms);
+  Check("armed after THR_ARMING_TIME_MS of null throttle",
+        (THR_ARMED == Throttle.State) && (Ms >= THR_ARMING_TIME) && (Ms <= (THR_ARMING_TIME + 2U)));
+
+  (void)RunTask(10U, SEND_FRAMES, 1000U, THR_RUNNING);
+  Check("throttle: motor started at the speed of the throttle",
+        (THR_RUNNING == Throttle.State) && (RUN == HostState) && (1U == HostStarts)
+        && (HostTarget == (int16_t)(THR_SPEED_MIN_UNIT + ((1000 * (THR_SPEED_MAX_UNIT - THR_SPEED_MIN_UNIT))
+                                                          / (int32_t)THR_FULL_SCALE))));
+
+  (void)RunTask(THR_FAILSAFE_TIMEOUT_MS / 2U, SEND_NOTHING, 0U, THR_DISARMED);
+  (void)RunTask(10U, SEND_FRAMES, 1000U, THR_DISARMED);
+  Check("signal lost shorter than THR_FAILSAFE_TIMEOUT_MS: still running",
+        (THR_RUNNING == Throttle.State) && (RUN == HostState));
+
+  Ms = RunTask(2U * THR_FAILSAFE_TIMEOUT_MS, SEND_NOTHING, 0U, THR_DISARMED);
+  printf("signal lost: stopped after %u ms\n", Ms);
+  Check("signal lost: stopped and disarmed after THR_FAILSAFE_TIMEOUT_MS",
+        (THR_DISARMED == Throttle.State) && (IDLE == HostState)
+        && (Ms >= THR_FAILSAFE_TIMEOUT) && (Ms <= (THR_FAILSAFE_TIMEOUT + 2U)));
+
+  (void)RunTask(1000U, SEND_FRAMES, 1000U, THR_ARMED);
+  Check("signal back with a throttle: not armed again", (THR_DISARMED == Throttle.State) && (1U == HostStarts));
+
+  (void)RunTask(2U * THR_ARMING_TIME_MS, SEND_FRAMES, 0U, THR_ARMED);
+  (void)RunTask(10U, SEND_FRAMES, 800U, THR_RUNNING);
+  Ms = RunTask(2U * THR_FAILSAFE_TIMEOUT_MS, SEND_BAD_CRC, 800U, THR_DISARMED);
+  printf("wrong CRCs only: stopped after %u ms\n", Ms);
+  Check("wrong CRCs only: stopped and disarmed after THR_FAILSAFE_TIMEOUT_MS",
+        (2U == HostStarts) && (THR_DISARMED == Throttle.State) && (IDLE == HostState)
+        && (Ms >= THR_FAILSAFE_TIMEOUT) && (Ms <= (THR_FAILSAFE_TIMEOUT + 2U)));
+
+  (void)RunTask(2U * THR_ARMING_TIME_MS, SEND_FRAMES, 0U, THR_ARMED);
+  (void)RunTask(10U, SEND_FRAMES, 800U, THR_RUNNING);
+  HostState = FAULT_OVER;
+  (void)RunTask(10U, SEND_FRAMES, 800U, THR_DISARMED);
+  Ms = RunTask(2U * THR_ARMING_TIME_MS, SEND_FRAMES, 0U, THR_ARMED);
+  Check("fault: disarmed, acknowledged by a null throttle, armed again",
+        (THR_ARMED == Throttle.State) && (IDLE == HostState) && (1U == HostAcks) && (3U == HostStarts));
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,409 @@
+/**
+  ******************************************************************************
+  * @file    telemetry_gcr.c
+  * @brief   Host round trip test of the bidirectional DShot telemetry, the
+  *          replies encoded by the firmware and decoded as by a flight
+  *          controller.
+  *
+  * The flight controller decoder samples the 21 bits of a reply on the
+  * line, from the low level of its start bit: each change of level is a 1
+  * of the GCR, each 5 bits of the GCR a nibble, and the 12 bits value must
+  * match its inverted CRC. An eRPM frame gives the electrical period in us,
+  * a 9 bits mantissa shifted by a 3 bits exponent, normalized so that its
+  * mantissa never looks like an extended telemetry frame.
+  *
+  * The checks:
+  *
+  * - THR_Init: the replies of a stopped motor until the first telemetry;
+  * - THR_EncodeReply: each of the 4096 values decoded back, the line never
+  *   held longer than 3 bits, and the replies with one level wrong rejected
+  *   by the decoder in REJECTED_RATIO, a wrong level changing 2 bits of the
+  *   GCR that the CRC can miss;
+  * - THR_SetTelemetry: the eRPM of the speeds up to twice the maximum
+  *   application speed, both directions, within the resolution of the
+  *   mantissa and of the us, the stopped motor and the speeds below the
+  *   longest period replied as stopped, and the temperature, voltage and
+  *   current frames clamped to 8 bits;
+  * - THR_FrameEnd_IRQHandler, on DShot150, DShot300 and DShot600: the port
+  *   words written by the DMA decoded back, the reply starting at
+  *   THR_TURNAROUND_US within half a bit, the extended telemetry frames
+  *   interleaved once enabled, and no reply when the frames are not
+  *   bidirectional, incomplete or when the line is held low.
+  *   THR_ReplyEnd_IRQHandler must give the line back to the capture.
+  *
+  * The program returns 1 when a check fails.
+  *
+  * Usage: telemetry_gcr
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "throttle_input.h"
+
+/* Edge ring written by the host DMA, reply DMA of the host, the configuration of the DMA ignored */
+static uint16_t HostWrite;
+static uint32_t HostReplyLength;
+static bool bHostReplyEnabled;
+
+static uint32_t HostDMA_GetDataLength(void)
+{
+  return (THR_EDGE_NBR - HostWrite);
+}
+
+#define LL_DMA_GetDataLength(DMAx, Channel)            HostDMA_GetDataLength()
+#define LL_DMA_SetMemoryAddress(DMAx, Channel, Address) ((void)(Address))
+#define LL_DMA_SetDataLength(DMAx, Channel, Length)     (HostReplyLength = (Length))
+#define LL_DMA_EnableChannel(DMAx, Channel)             (bHostReplyEnabled = true)
+#define LL_DMA_DisableChannel(DMAx, Channel)            (bHostReplyEnabled = false)
+#define LL_DMA_ConfigTransfer(DMAx, Channel, Configuration)
+#define LL_DMA_SetPeriphRequest(DMAx, Channel, Request)
+#define LL_DMA_ConfigAddresses(DMAx, Channel, Source, Destination, Direction) ((void)(Source), (void)(Destination))
+#define LL_DMA_SetPeriphAddress(DMAx, Channel, Address) ((void)(Address))
+#define LL_DMA_EnableIT_TC(DMAx, Channel)
+#include "throttle_input.c"
+
+/* Timer clock, ticks per us */
+#define TICKS_PER_US            (SYSCLK_FREQ / 1000000uL)
+/* End of frame interrupt, after the compare at THR_DSHOT_GAP_US */
+#define IRQ_LATENCY_US          2U
+/* Replies with one level wrong rejected by the GCR and the 4 bits CRC */
+#define REJECTED_RATIO          0.99
+/* Replies of each bit rate */
+#define REPLY_NBR               64U
+/* Bit periods */
+#define DSHOT150_NS             (1.0e9 / 150000.0)
+#define DSHOT300_NS             (1.0e9 / 300000.0)
+#define DSHOT600_NS             (1.0e9 / 600000.0)
+
+/* Speed of the eRPM frames */
+#define SPEED_MAX_UNIT          ((2 * MAX_APPLICATION_SPEED_RPM * SPEED_UNIT) / U_RPM)
+
+/* Extended telemetry frames: an exponent not null over a mantissa below 0x100 */
+#define EDT_TYPE(hValue)        ((hValue) & 0xF00U)
+
+static MCI_Handle_t HostMCI;
+static TIM_TypeDef HostTIM;
+static TIM_TypeDef HostTLM;
+static DMA_TypeDef HostDMA;
+static GPIO_TypeDef HostGPIO;
+
+/* The throttle input does not drive the motor here */
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  return (IDLE);
+}
+
+bool MCI_StartMotor(MCI_Handle_t *pHandle)
+{
+  return (false);
+}
+
+bool MCI_StopMotor(MCI_Handle_t *pHandle)
+{
+  return (true);
+}
+
+bool MCI_FaultAcknowledged(MCI_Handle_t *pHandle)
+{
+  return (true);
+}
+
+void MCI_ExecSpeedRamp(MCI_Handle_t *pHandle, int16_t hFinalSpeed, uint16_t hDurationms)
+{
+}
+
+void MCI_ExecTorqueRamp(MCI_Handle_t *pHandle, int16_t hFinalTorque, uint16_t hDurationms)
+{
+}
+
+/* Handle of mc_config.c on the host peripherals */
+static THR_Handle_t Throttle =
+{
+  .TIMx           = &HostTIM,
+  .DMAx           = &HostDMA,
+  .pMCI           = &HostMCI,
+  .Protocol       = THR_DSHOT,
+  .ControlMode    = MCM_SPEED_MODE,
+  .hTicksPerUs    = (uint16_t)(SYSCLK_FREQ / 1000000uL),
+  .hGapMin        = THR_DSHOT_GAP_US,
+  .bTelemetry     = true,
+  .TLM_TIMx       = &HostTLM,
+  .wTlmDMAChannel = THR_TLM_DMA_CHANNEL,
+  .GPIOx          = &HostGPIO,
+  .wPin           = LL_GPIO_PIN_15,
+  .hTurnaround    = THR_TURNAROUND_US,
+  .hPolePairs     = POLE_PAIR_NUM,
+};
+
+/* Nibble of each GCR code of the DShot specification, -1 for the codes not used */
+static const int8_t GcrDecode[32] =
+{
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x9, 0xA, 0xB, -1, 0xD, 0xE, 0xF,
+  -1, -1, 0x2, 0x3, -1, 0x5, 0x6, 0x7, -1, 0x0, 0x8, 0x1, -1, 0x4, 0xC, -1
+};
+
+/* Value decoded by the flight controller from the levels of the 21 bits, the first one the start bit,
+   -1 if the reply is rejected */
+static int32_t DecodeReply(const uint8_t *pLevels)
+{
+  int32_t wValue = 0;
+  uint32_t wGcr = 0U;
+  uint16_t i;
+
+  for (i = 1U; i < THR_TLM_BITS; i++)
+  {
+    wGcr = (wGcr << 1U) | (uint32_t)(pLevels[i] ^ pLevels[i - 1U]);
+  }
+  for (i = 0U; (i < 4U) && (wValue >= 0); i++)
+  {
+    int8_t Nibble = GcrDecode[(wGcr >> (15U - (5U * i))) & 0x1FU];
+
+    wValue = (Nibble < 0) ? -1 : ((wValue << 4) | Nibble);
+  }
+  if ((0U != pLevels[0]) || (wValue < 0))
+  {
+    wValue = -1;
+  }
+  else
+  {
+    uint32_t wData = (uint32_t)wValue >> 4U;
+    uint32_t wCrc = (~(wData ^ (wData >> 4U) ^ (wData >> 8U))) & 0x0FU;
+
+    wValue = (wCrc == ((uint32_t)wValue & 0x0FU)) ? (int32_t)wData : -1;
+  }
+  return (wValue);
+}
+
+/* Levels of a reply of THR_EncodeReply, the first bit in the most significant one */
+static void Levels(uint32_t wReply, uint8_t *pLevels)
+{
+  uint16_t i;
+
+  for (i = 0U; i < THR_TLM_BITS; i++)
+  {
+    pLevels[i] = (uint8_t)((wReply >> (THR_TLM_BITS - 1U - i)) & 1U);
+  }
+}
+
+static int32_t DecodeSlot(uint16_t hSlot)
+{
+  uint8_t Line[THR_TLM_BITS];
+
+  Levels(Throttle.wReplies[hSlot], Line);
+  return (DecodeReply(Line));
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+/* Ends a frame of 32 edges, reply decoded from the port words of the DMA, -1 if none, -2 if rejected */
+static int32_t EndFrame(uint16_t hEdges, bool bLineHigh, double *pStartUs)
+{
+  int32_t wValue = -1;
+
+  HostWrite = THR_IDX(HostWrite + hEdges);
+  HostGPIO.IDR = bLineHigh ? Throttle.wPin : 0U;
+  HostTLM.CNT = (THR_DSHOT_GAP_US + IRQ_LATENCY_US) * TICKS_PER_US;
+  HostReplyLength = 0U;
+  bHostReplyEnabled = false;
+  THR_FrameEnd_IRQHandler(&Throttle);
+
+  if ((false == bHostReplyEnabled) || (HostReplyLength < (THR_TLM_BITS + 1U)))
+  {
+    /* No reply */
+  }
+  else
+  {
+    uint32_t wPad = HostReplyLength - THR_TLM_BITS - 1U;
+    const uint32_t *pTx = &Throttle.wTxBuffer[THR_TLM_PAD_MAX - wPad];
+    uint8_t Line[THR_TLM_BITS];
+    bool bIdle = (Throttle.wPin == pTx[wPad + THR_TLM_BITS]) ? true : false;
+    uint16_t i;
+
+    for (i = 0U; i < wPad; i++)
+    {
+      bIdle = bIdle && (Throttle.wPin == pTx[i]);
+    }
+    for (i = 0U; i < THR_TLM_BITS; i++)
+    {
+      uint32_t wWord = pTx[wPad + i];
+
+      bIdle = bIdle && ((Throttle.wPin == wWord) || ((Throttle.wPin << 16U) == wWord));
+      Line[i] = (Throttle.wPin == wWord) ? 1U : 0U;
+    }
+    wValue = bIdle ? DecodeReply(Line) : -2;
+    wValue = (wValue < 0) ? -2 : wValue;
+    *pStartUs = (double)(THR_DSHOT_GAP_US + IRQ_LATENCY_US)
+              + (((double)wPad * (double)(HostTLM.ARR + 1U)) / (double)TICKS_PER_US);
+
+    THR_ReplyEnd_IRQHandler(&Throttle);
+  }
+  return (wValue);
+}
+
+int main(void)
+{
+  static const double Bits[3] = {DSHOT150_NS, DSHOT300_NS, DSHOT600_NS};
+  uint8_t Line[THR_TLM_BITS];
+  bool bRoundTrip = true;
+  bool bRunLength = true;
+  bool bErpm = true;
+  bool bStopped = true;
+  bool bEdt;
+  bool bReplies = true;
+  bool bInterleaved = true;
+  bool bTurnaround = true;
+  bool bReleased = true;
+  bool bSilent;
+  uint32_t wCorrupted = 0U;
+  uint32_t wRejected = 0U;
+  double MaxErrorPct = 0.0;
+  double MaxLateUs = 0.0;
+  double StartUs = 0.0;
+  int32_t wSpeed;
+  uint16_t hValue;
+  uint16_t i;
+
+  THR_Init(&Throttle);
+  Check("THR_Init: stopped motor replied until the first telemetry",
+        (THR_ERPM_STOPPED == (uint32_t)DecodeSlot(0U)) && (THR_ERPM_STOPPED == (uint32_t)DecodeSlot(THR_TLM_SLOTS - 1U)));
+
+  /* Round trip of every value, and of every reply with one level wrong */
+  for (hValue = 0U; hValue < 0x1000U; hValue++)
+  {
+    uint16_t hRun = 1U;
+
+    Levels(THR_EncodeReply(hValue), Line);
+    bRoundTrip = bRoundTrip && (DecodeReply(Line) == (int32_t)hValue);
+    for (i = 1U; i < THR_TLM_BITS; i++)
+    {
+      hRun = (Line[i] == Line[i - 1U]) ? (uint16_t)(hRun + 1U) : 1U;
+      bRunLength = bRunLength && (hRun <= 3U);
+    }
+    for (i = 0U; i < THR_TLM_BITS; i++)
+    {
+      Line[i] ^= 1U;
+      wRejected += (DecodeReply(Line) < 0) ? 1U : 0U;
+      wCorrupted++;
+      Line[i] ^= 1U;
+    }
+  }
+  printf("replies with one level wrong: %u of %u rejected\n", wRejected, wCorrupted);
+  Check("THR_EncodeReply: each value decoded back", bRoundTrip);
+  Check("THR_EncodeReply: line held 3 bits at most", bRunLength);
+  Check("THR_EncodeReply: one level wrong rejected but for the CRC misses",
+        ((double)wRejected >= (REJECTED_RATIO * (double)wCorrupted)));
+
+  /* eRPM of the speeds, SPEED_UNIT, both directions */
+  for (wSpeed = -SPEED_MAX_UNIT; wSpeed <= SPEED_MAX_UNIT; wSpeed++)
+  {
+    int32_t wErpm;
+    double PeriodUs;
+
+    THR_SetTelemetry(&Throttle, (int16_t)wSpeed, 25, 60U, 2U);
+    wErpm = DecodeSlot(0U);
+    PeriodUs = (1.0e6 * (double)SPEED_UNIT) / fabs((double)wSpeed * (double)POLE_PAIR_NUM);
+    if ((wErpm < 0) || ((0 != (wErpm & 0xF00)) && (0 == (wErpm & 0x100))))
+    {
+      /* Rejected, or taken for an extended telemetry frame */
+      bErpm = false;
+    }
+    else if ((0 == wSpeed) || (PeriodUs > (double)(0x1FFU << 7U)))
+    {
+      bStopped = bStopped && (THR_ERPM_STOPPED == (uint32_t)wErpm);
+    }
+    else
+    {
+      double Replied = (double)((uint32_t)(wErpm & 0x1FF) << ((uint32_t)wErpm >> 9U));
+      double ErrorPct = 100.0 * fabs(Replied - PeriodUs) / PeriodUs;
+      double Resolution = (100.0 / 256.0) + (100.0 / PeriodUs);
+
+      MaxErrorPct = (ErrorPct > MaxErrorPct) ? ErrorPct : MaxErrorPct;
+      bErpm = bErpm && (ErrorPct <= Resolution) && (Replied > 0.0);
+    }
+  }
+  printf("eRPM period to %d rpm: %.2f %% at most\n", (2 * MAX_APPLICATION_SPEED_RPM), MaxErrorPct);
+  Check("THR_SetTelemetry: eRPM within the resolution of the frame", bErpm);
+  Check("THR_SetTelemetry: stopped and slow motor replied stopped", bStopped);
+
+  THR_SetTelemetry(&Throttle, 0, 25, 60U, 12U);
+  bEdt = (DecodeSlot(1U) == (int32_t)(THR_EDT_TEMPERATURE | 25U)) && (DecodeSlot(2U) == (int32_t)(THR_EDT_VOLTAGE | 60U))
+         && (DecodeSlot(3U) == (int32_t)(THR_EDT_CURRENT | 12U));
+  THR_SetTelemetry(&Throttle, 0, -10, 300U, 300U);
+  bEdt = bEdt && (DecodeSlot(1U) == (int32_t)THR_EDT_TEMPERATURE) && (DecodeSlot(2U) == (int32_t)(THR_EDT_VOLTAGE | 255U))
+         && (DecodeSlot(3U) == (int32_t)(THR_EDT_CURRENT | 255U));
+  THR_SetTelemetry(&Throttle, 0, 300, 0U, 0U);
+  bEdt = bEdt && (DecodeSlot(1U) == (int32_t)(THR_EDT_TEMPERATURE | 255U));
+  Check("THR_SetTelemetry: temperature, voltage and current frames clamped", bEdt);
+
+  /* Replies written on the line at the end of the frames */
+  THR_SetTelemetry(&Throttle, (int16_t)((MAX_APPLICATION_SPEED_RPM * SPEED_UNIT) / U_RPM), 40, 62U, 7U);
+  for (i = 0U; i < 3U; i++)
+  {
+    uint32_t wBit = (uint32_t)llround((0.8 * Bits[i] * (double)TICKS_PER_US) / 1000.0);
+    uint16_t hEdt = 0U;
+    uint16_t hType = 0U;
+    uint16_t hLastEdt = 0U;
+    uint16_t k;
+
+    Throttle.bBidirectional = true;
+    Throttle.wReplyBit = wBit;
+    Throttle.bExtendedTelemetry = false;
+    Throttle.hReplyCount = 0U;
+    for (k = 0U; k < (2U * REPLY_NBR); k++)
+    {
+      int32_t wValue;
+
+      Throttle.bExtendedTelemetry = (k >= REPLY_NBR) ? true : false;
+      wValue = EndFrame(2U * THR_DSHOT_BITS, true, &StartUs);
+      if (wValue < 0)
+      {
+        bReplies = false;
+      }
+      else if ((0U == EDT_TYPE((uint32_t)wValue)) || (0U != ((uint32_t)wValue & 0x100U)))
+      {
+        bReplies = bReplies && (DecodeSlot(0U) == wValue);
+      }
+      else
+      {
+        /* Extended telemetry, the temperature, voltage and current in turn, once every 8 replies */
+        hType = (THR_EDT_CURRENT == hType) ? (uint16_t)THR_EDT_TEMPERATURE : (uint16_t)(hType + 0x200U);
+        hType = (0U == hEdt) ? (uint16_t)EDT_TYPE((uint32_t)wValue) : hType;
+        bInterleaved = bInterleaved && (k >= REPLY_NBR) && (k >= (hLastEdt + 8U)) && (EDT_TYPE((uint32_t)wValue) == hType)
+                       && (DecodeSlot((uint16_t)(hType >> 9U)) == wValue);
+        hLastEdt = k;
+        hEdt++;
+      }
+      MaxLateUs = (fabs(StartUs - (double)THR_TURNAROUND_US) > MaxLateUs) ? fabs(StartUs - (double)THR_TURNAROUND_US)
+                                                                           : MaxLateUs;
+      bTurnaround = bTurnaround
+                    && (fabs(StartUs - (double)THR_TURNAROUND_US) <= ((double)wBit / (2.0 * (double)TICKS_PER_US)));
+      bReleased = bReleased && (false == bHostReplyEnabled)
+                  && (LL_GPIO_MODE_ALTERNATE == LL_GPIO_GetPinMode(&HostGPIO, Throttle.wPin))
+                  && (0U != (HostTIM.CCER & TIM_CCER_CC1E)) && (0U != (HostTLM.DIER & TIM_DIER_CC1IE))
+                  && (LL_TIM_SLAVEMODE_RESET == (HostTLM.SMCR & TIM_SMCR_SMS));
+    }
+    printf("DShot%3.0f: %u extended telemetry frames in %u replies\n", 1.0e6 / Bits[i], hEdt, 2U * REPLY_NBR);
+    bInterleaved = bInterleaved && (hEdt == (REPLY_NBR / 8U));
+  }
+  printf("reply start to THR_TURNAROUND_US: %.2f us at most\n", MaxLateUs);
+  Check("THR_FrameEnd_IRQHandler: eRPM replied on the line", bReplies);
+  Check("THR_FrameEnd_IRQHandler: extended telemetry interleaved once enabled", bInterleaved);
+  Check("THR_FrameEnd_IRQHandler: turnaround within half a bit", bTurnaround);
+  Check("THR_ReplyEnd_IRQHandler: line given back to the capture", bReleased);
+
+  bSilent = (-1 == EndFrame(2U * THR_DSHOT_BITS - 2U, true, &StartUs));
+  bSilent = bSilent && (-1 == EndFrame(2U * THR_DSHOT_BITS, false, &StartUs));
+  Throttle.bBidirectional = false;
+  bSilent = bSilent && (-1 == EndFrame(2U * THR_DSHOT_BITS, true, &StartUs));
+  Check("no reply to a standard, incomplete or held low frame", bSilent);
+
+  return ((0 == Failures) ? 0 : 1);
+}
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file    iq_spectrum.c
+  * @brief   Host benchmark of the Vibration Monitor on a synthetic Iq.
+  *
+  * The firmware Vibration Monitor runs with the settings of mc_config.c, the
+  * capture at TF_REGULATION_RATE and the background task once per
+  * MEDIUM_FREQUENCY_TASK_RATE period, on an Iq made of a mean, harmonics of
+  * IQ_1X, IQ_2X and IQ_NX digits at 1x, 2x and VIB_HARMONIC_N x the
+  * mechanical frequency, a tone OFF_ORDER times the mechanical frequency and
+  * NOISE digits of noise. The speed ripples by SPEED_RIPPLE, and is given to
+  * the capture rounded to a s16degree per period, as by the speed sensor.
+  *
+  * From MIN_RPM to MAX_APPLICATION_SPEED_RPM, each harmonic must be measured
+  * within AMPLITUDE_ERROR, the windows following each other without gap. The
+  * windows of a ramp and those at LOW_RPM, whose first harmonic falls too
+  * close to the mean, must be discarded and the results kept, a harmonic
+  * above the bandwidth reported as 0, and nothing captured out of the RUN
+  * state. The component, its capture buffer included, must fit in
+  * RAM_MAX_BYTES, and an analysis take below ANALYSIS_MAX_US on the host.
+  * The program returns 1 when a check fails.
+  *
+  * Usage: iq_spectrum
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include "parameters_conversion.h"
+#include "stm32g4xx.h"
+
+/* Cycle counter of the analysis on the host, left at 0 */
+static DWT_Type HostDWT;
+#undef DWT
+#define DWT                     (&HostDWT)
+#include "vibration_monitor.c"
+
+/* Harmonics of the synthetic Iq, digit */
+#define IQ_MEAN                 300.0
+#define IQ_1X                   200.0
+#define IQ_2X                   80.0
+#define IQ_NX                   40.0
+#define IQ_OFF                  100.0
+#define OFF_ORDER               5.5
+#define NOISE                   20.0
+/* Ripple of the speed, relative, at the first harmonic */
+#define SPEED_RIPPLE            0.005
+/* Speed range and windows analysed at each speed */
+#define MIN_RPM                 2000.0
+#define SPEED_STEP_RPM          500.0
+#define WINDOWS                 4
+#define LOW_RPM                 1500.0
+/* Required of the monitor */
+#define AMPLITUDE_ERROR         0.03
+#define RAM_MAX_BYTES           3072U
+#define ANALYSIS_MAX_US         1000.0
+
+#define TWO_PI                  6.283185307179586
+
+static MCI_State_t HostState = RUN;
+
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  return (HostState);
+}
+
+static MCI_Handle_t HostMCI;
+static int16_t VibCapture[VIB_FFT_SIZE];
+
+/* Vibration monitor of mc_config.c */
+static VIB_Handle_t VibMonitor =
+{
+  .pMCI              = &HostMCI,
+  .pCapture          = VibCapture,
+  .hDecimation       = VIB_DECIMATION,
+  .hPolePairs        = POLE_PAIR_NUM,
+  .fControlFreq_Hz   = (float_t)TF_REGULATION_RATE,
+  .fSpeedTolerance   = (float_t)VIB_SPEED_TOLERANCE,
+  .bOrders           = {1U, 2U, VIB_HARMONIC_N},
+};
+
+static const double Amplitudes[VIB_HARMONIC_NBR] = {IQ_1X, IQ_2X, IQ_NX};
+
+static uint32_t Seed = 1U;
+
+/* Uniform in [-Range, Range] */
+static double Noise(double Range)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Range * ((2.0 * (double)(Seed >> 8) / 16777216.0) - 1.0));
+}
+
+static double Now(void)
+{
+  struct timespec Time;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &Time);
+  return (((double)Time.tv_sec * 1.0e6) + ((double)Time.tv_nsec / 1.0e3));
+}
+
+/* Drive, kept from a run to the next */
+static double Angle;                       /* Mechanical, rad, not wrapped for the tone off the orders */
+static double AnalysisUs;                  /* Longest analysis on the host */
+static double CaptureNs;                   /* Mean capture on the host */
+
+/* Runs the drive from a speed to another over a duration, returns the windows analysed */
+static uint16_t Run(double FromRpm, double ToRpm, double Seconds)
+{
+  const int Steps = (int)(Seconds * (double)TF_REGULATION_RATE);
+  const int Ratio = TF_REGULATION_RATE / MEDIUM_FREQUENCY_TASK_RATE;
+  uint16_t hWindows = VibMonitor.hWindows;
+  double CaptureUs = 0.0;
+  int i;
+
+  for (i = 0; i < Steps; i++)
+  {
+    double Rpm = FromRpm + (((ToRpm - FromRpm) * (double)i) / (double)Steps);
+    double W = ((Rpm * TWO_PI) / 60.0) * (1.0 + (SPEED_RIPPLE * sin(Angle)));
+    double Iq = IQ_MEAN + (IQ_OFF * sin(OFF_ORDER * Angle)) + Noise(NOISE);
+    double Dpp = ((W * POLE_PAIR_NUM) / TWO_PI) * (65536.0 / (double)TF_REGULATION_RATE);
+    double Start;
+    uint8_t k;
+
+    for (k = 0U; k < VIB_HARMONIC_NBR; k++)
+    {
+      Iq += Amplitudes[k] * sin(((double)VibMonitor.bOrders[k] * Angle) + (double)k);
+    }
+    Start = Now();
+    VIB_Capture(&VibMonitor, (int16_t)lrint(Iq), (int16_t)lrint(Dpp));
+    CaptureUs += Now() - Start;
+    Angle += W / (double)TF_REGULATION_RATE;
+
+    if ((Ratio - 1) == (i % Ratio))
+    {
+      bool bAnalysis = VibMonitor.bFull;
+
+      Start = Now();
+      VIB_BackgroundTask(&VibMonitor);
+      AnalysisUs = ((true == bAnalysis) && ((Now() - Start) > AnalysisUs)) ? (Now() - Start) : AnalysisUs;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  CaptureNs = (1000.0 * CaptureUs) / (double)Steps;
+  return ((uint16_t)(VibMonitor.hWindows - hWindows));
+}
+
+static int Failures;
+
+static void Check(const char *pName, bool bPassed)
+{
+  printf("%-68s %s\n", pName, bPassed ? "ok" : "FAILED");
+  Failures += bPassed ? 0 : 1;
+}
+
+int main(void)
+{
+  const double WindowS = ((double)VIB_DECIMATION * (double)VIB_FFT_SIZE) / (double)TF_REGULATION_RATE;
+  double Worst[VIB_HARMONIC_NBR] = {0.0, 0.0, 0.0};
+  bool bContinuous = true;
+  bool bSpeed = true;
+  double Rpm;
+  uint16_t hRejected;
+  uint16_t hKept[VIB_HARMONIC_NBR];
+  uint16_t hWindows;
+  uint8_t k;
+
+  VIB_Init(&VibMonitor);
+
+  /* Steady speeds */
+  printf("Iq harmonics of %.0f / %.0f / %.0f digits at 1x / 2x / %dx, %.0f digits at %.1fx, noise %.0f digits\n",
+         IQ_1X, IQ_2X, IQ_NX, VIB_HARMONIC_N, IQ_OFF, OFF_ORDER, NOISE);
+  printf("%10s %10s %10s %10s %10s\n", "rpm", "speed", "1x", "2x", "Nx");
+  for (Rpm = MIN_RPM; Rpm <= MAX_APPLICATION_SPEED_RPM; Rpm += SPEED_STEP_RPM)
+  {
+    (void)Run(Rpm, Rpm, WindowS);
+    hWindows = Run(Rpm, Rpm, WINDOWS * WindowS);
+    bContinuous = bContinuous && (hWindows >= (WINDOWS - 1));
+    bSpeed = bSpeed && (fabs(((double)VIB_GetMecSpeedUnit(&VibMonitor) * U_RPM / SPEED_UNIT) - Rpm) <= (0.01 * Rpm));
+    printf("%10.0f %10d", Rpm, VIB_GetMecSpeedUnit(&VibMonitor));
+    for (k = 0U; k < VIB_HARMONIC_NBR; k++)
+    {
+      double Error = fabs(((double)VIB_GetHarmonic(&VibMonitor, k) / Amplitudes[k]) - 1.0);
+
+      Worst[k] = (Error > Worst[k]) ? Error : Worst[k];
+      printf(" %10u", VIB_GetHarmonic(&VibMonitor, k));
+    }
+    printf("\n");
+  }
+  printf("largest error: %.1f %% / %.1f %% / %.1f %%\n", 100.0 * Worst[0], 100.0 * Worst[1], 100.0 * Worst[2]);
+  Check("harmonics measured within AMPLITUDE_ERROR", (Worst[0] <= AMPLITUDE_ERROR)
+        && (Worst[1] <= AMPLITUDE_ERROR) && (Worst[2] <= AMPLITUDE_ERROR));
+  Check("speed of the windows within 1 %", bSpeed);
+  Check("windows analysed one after the other", bContinuous);
+
+  /* Discarded windows, the results kept */
+  for (k = 0U; k < VIB_HARMONIC_NBR; k++)
+  {
+    hKept[k] = VIB_GetHarmonic(&VibMonitor, k);
+  }
+  hRejected = VibMonitor.hRejected;
+  hWindows = Run(6000.0, 8000.0, WINDOWS * WindowS);
+  hWindows += Run(LOW_RPM, LOW_RPM, WINDOWS * WindowS);
+  Check("windows of a ramp and at LOW_RPM discarded, results kept",
+        (0U == hWindows) && ((VibMonitor.hRejected - hRejected) >= (2 * (WINDOWS - 1)))
+        && (hKept[0] == VIB_GetHarmonic(&VibMonitor, 0U)) && (hKept[2] == VIB_GetHarmonic(&VibMonitor, 2U)));
+
+  /* Harmonic N above the bandwidth of the window */
+  Rpm = (60.0 * (double)TF_REGULATION_RATE) / (2.0 * (double)VIB_DECIMATION * (double)VIB_HARMONIC_N);
+  (void)Run(1.1 * Rpm, 1.1 * Rpm, (WINDOWS + 1) * WindowS);
+  Check("harmonic above the bandwidth reported as 0",
+        (0U == VIB_GetHarmonic(&VibMonitor, 2U)) && (0U != VIB_GetHarmonic(&VibMonitor, 0U)));
+
+  /* Stopped */
+  HostState = IDLE;
+  VIB_Clear(&VibMonitor);
+  hRejected = VibMonitor.hRejected;
+  hWindows = Run(6000.0, 6000.0, WINDOWS * WindowS);
+  Check("nothing captured out of the RUN state", (0U == hWindows) && (hRejected == VibMonitor.hRejected));
+  HostState = RUN;
+
+  /* Budget */
+  printf("RAM: %u bytes, handle %u and capture %u; host: capture %.0f ns, analysis %.1f us, window %.0f ms\n",
+         (unsigned int)(sizeof(VibMonitor) + sizeof(VibCapture)), (unsigned int)sizeof(VibMonitor),
+         (unsigned int)sizeof(VibCapture), CaptureNs, AnalysisUs, 1000.0 * WindowS);
+  Check("component and capture within RAM_MAX_BYTES", (sizeof(VibMonitor) + sizeof(VibCapture)) <= RAM_MAX_BYTES);
+  Check("analysis within ANALYSIS_MAX_US on the host", (AnalysisUs > 0.0) && (AnalysisUs <= ANALYSIS_MAX_US));
+
+  return ((0 == Failures) ? 0 : 1);
+}